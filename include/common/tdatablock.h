@@ -240,6 +240,12 @@ int32_t blockGetEncodeSize(const SSDataBlock* pBlock);
 int32_t blockEncode(const SSDataBlock* pBlock, char* data, int32_t numOfCols);
 const char* blockDecode(SSDataBlock* pBlock, const char* pData);
 
+bool    blockIsCompressed(const char* pData);
+int32_t blockGetCompressBufSize(const char* pData);
+int32_t blockGetDecompressSize(const char* pData);
+int32_t blockCompressEncodeBuf(const char* pData, char* pOut);
+int32_t blockDecompressEncodeBuf(const char* pData, char* pOut);
+
 // for debug
 char* dumpBlockData(SSDataBlock* pDataBlock, const char* flag, char** dumpBuf);
 
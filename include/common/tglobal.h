@@ -46,6 +46,7 @@ extern int32_t tsShellActivityTimer;
 extern int32_t tsCompressMsgSize;
 extern int32_t tsCompressColData;
 extern int32_t tsMaxNumOfDistinctResults;
+extern int32_t tsPercentileCompression;
 extern int32_t tsCompatibleModel;
 extern bool    tsPrintAuth;
 extern int64_t tsTickPerMin[3];
@@ -115,7 +116,15 @@ extern char    *tsSvrCrashReportUri;
 // query buffer management
 extern int32_t tsQueryBufferSize;  // maximum allowed usage buffer size in MB for each data node during query processing
 extern int64_t tsQueryBufferSizeBytes;    // maximum allowed usage buffer size in byte for each data node
+extern bool    tsPagedBufCompress;        // compress the pages the query buffers spill to disk
 extern int32_t tsCacheLazyLoadThreshold;  // cost threshold for last/last_row loading cache as much as possible
+extern int32_t tsTsdbPageCacheSize;       // size of the tsdb file page cache in MB for each vnode, 0 to disable
+extern int32_t tsTsdbFSetThreads;         // number of threads committing/merging file sets of a vnode concurrently
+extern int32_t tsTsdbFSetIoBudget;        // write budget in MB/s of the file set commit/merge of a vnode, 0 no limit
+extern int32_t tsTsdbRecompressLevel;     // file sets migrated to this tier or a colder one are rewritten, 0 to disable
+extern int32_t tsTsdbRecompressMaxRows;   // max rows of a block in the rewritten files, 0 for 4 times the vnode maxRows
+extern int32_t tsExchangePrefetchDepth;   // number of responses buffered or in flight for each exchange source
+extern int32_t tsExchangeBufferSize;      // buffered exchange responses in MB for each exchange operator
 
 // query client
 extern int32_t tsQueryPolicy;
@@ -1176,6 +1176,11 @@ typedef struct {
   int64_t numOfBatchInsertReqs;
   int64_t numOfBatchInsertSuccessReqs;
   int32_t numOfCachedTables;
+  int64_t pageCacheHit;
+  int64_t pageCacheMiss;
+  int64_t numOfFSetJobs;
+  int64_t numOfFSetJobsDone;
+  int64_t fsetJobBytes;
 } SVnodeLoad;
 
 typedef struct {
@@ -1837,6 +1842,7 @@ typedef struct {
   uint64_t queryId;
   uint64_t taskId;
   int32_t  execId;
+  int8_t   compress;  // the fetched blocks can be compressed column by column
 } SResFetchReq;
 
 int32_t tSerializeSResFetchReq(void* buf, int32_t bufLen, SResFetchReq* pReq);
@@ -3570,9 +3576,11 @@ void    tDestroySSubmitRsp2(SSubmitRsp2* pRsp, int32_t flag);
 typedef struct {
   union {
     struct {
-      void*   msgStr;
-      int32_t msgLen;
-      int64_t ver;
+      void*    msgStr;
+      int32_t  msgLen;
+      int64_t  ver;
+      int64_t  term;   // term and body checksum of the wal head, term is 0 if the msg is not read from wal
+      uint32_t cksum;
     };
     void* pDataBlock;
   };
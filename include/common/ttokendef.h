@@ -275,84 +275,86 @@
 #define TK_IN                             257
 #define TK_JOIN                           258
 #define TK_INNER                          259
-#define TK_SELECT                         260
-#define TK_DISTINCT                       261
-#define TK_WHERE                          262
-#define TK_PARTITION                      263
-#define TK_BY                             264
-#define TK_SESSION                        265
-#define TK_STATE_WINDOW                   266
-#define TK_EVENT_WINDOW                   267
-#define TK_SLIDING                        268
-#define TK_FILL                           269
-#define TK_VALUE                          270
-#define TK_VALUE_F                        271
-#define TK_NONE                           272
-#define TK_PREV                           273
-#define TK_NULL_F                         274
-#define TK_LINEAR                         275
-#define TK_NEXT                           276
-#define TK_HAVING                         277
-#define TK_RANGE                          278
-#define TK_EVERY                          279
-#define TK_ORDER                          280
-#define TK_SLIMIT                         281
-#define TK_SOFFSET                        282
-#define TK_LIMIT                          283
-#define TK_OFFSET                         284
-#define TK_ASC                            285
-#define TK_NULLS                          286
-#define TK_ABORT                          287
-#define TK_AFTER                          288
-#define TK_ATTACH                         289
-#define TK_BEFORE                         290
-#define TK_BEGIN                          291
-#define TK_BITAND                         292
-#define TK_BITNOT                         293
-#define TK_BITOR                          294
-#define TK_BLOCKS                         295
-#define TK_CHANGE                         296
-#define TK_COMMA                          297
-#define TK_CONCAT                         298
-#define TK_CONFLICT                       299
-#define TK_COPY                           300
-#define TK_DEFERRED                       301
-#define TK_DELIMITERS                     302
-#define TK_DETACH                         303
-#define TK_DIVIDE                         304
-#define TK_DOT                            305
-#define TK_EACH                           306
-#define TK_FAIL                           307
-#define TK_FILE                           308
-#define TK_FOR                            309
-#define TK_GLOB                           310
-#define TK_ID                             311
-#define TK_IMMEDIATE                      312
-#define TK_IMPORT                         313
-#define TK_INITIALLY                      314
-#define TK_INSTEAD                        315
-#define TK_ISNULL                         316
-#define TK_KEY                            317
-#define TK_MODULES                        318
-#define TK_NK_BITNOT                      319
-#define TK_NK_SEMI                        320
-#define TK_NOTNULL                        321
-#define TK_OF                             322
-#define TK_PLUS                           323
-#define TK_PRIVILEGE                      324
-#define TK_RAISE                          325
-#define TK_RESTRICT                       326
-#define TK_ROW                            327
-#define TK_SEMI                           328
-#define TK_STAR                           329
-#define TK_STATEMENT                      330
-#define TK_STRICT                         331
-#define TK_STRING                         332
-#define TK_TIMES                          333
-#define TK_VALUES                         334
-#define TK_VARIABLE                       335
-#define TK_VIEW                           336
-#define TK_WAL                            337
+#define TK_LEFT                           260
+#define TK_OUTER                          261
+#define TK_SELECT                         262
+#define TK_DISTINCT                       263
+#define TK_WHERE                          264
+#define TK_PARTITION                      265
+#define TK_BY                             266
+#define TK_SESSION                        267
+#define TK_STATE_WINDOW                   268
+#define TK_EVENT_WINDOW                   269
+#define TK_SLIDING                        270
+#define TK_FILL                           271
+#define TK_VALUE                          272
+#define TK_VALUE_F                        273
+#define TK_NONE                           274
+#define TK_PREV                           275
+#define TK_NULL_F                         276
+#define TK_LINEAR                         277
+#define TK_NEXT                           278
+#define TK_HAVING                         279
+#define TK_RANGE                          280
+#define TK_EVERY                          281
+#define TK_ORDER                          282
+#define TK_SLIMIT                         283
+#define TK_SOFFSET                        284
+#define TK_LIMIT                          285
+#define TK_OFFSET                         286
+#define TK_ASC                            287
+#define TK_NULLS                          288
+#define TK_ABORT                          289
+#define TK_AFTER                          290
+#define TK_ATTACH                         291
+#define TK_BEFORE                         292
+#define TK_BEGIN                          293
+#define TK_BITAND                         294
+#define TK_BITNOT                         295
+#define TK_BITOR                          296
+#define TK_BLOCKS                         297
+#define TK_CHANGE                         298
+#define TK_COMMA                          299
+#define TK_CONCAT                         300
+#define TK_CONFLICT                       301
+#define TK_COPY                           302
+#define TK_DEFERRED                       303
+#define TK_DELIMITERS                     304
+#define TK_DETACH                         305
+#define TK_DIVIDE                         306
+#define TK_DOT                            307
+#define TK_EACH                           308
+#define TK_FAIL                           309
+#define TK_FILE                           310
+#define TK_FOR                            311
+#define TK_GLOB                           312
+#define TK_ID                             313
+#define TK_IMMEDIATE                      314
+#define TK_IMPORT                         315
+#define TK_INITIALLY                      316
+#define TK_INSTEAD                        317
+#define TK_ISNULL                         318
+#define TK_KEY                            319
+#define TK_MODULES                        320
+#define TK_NK_BITNOT                      321
+#define TK_NK_SEMI                        322
+#define TK_NOTNULL                        323
+#define TK_OF                             324
+#define TK_PLUS                           325
+#define TK_PRIVILEGE                      326
+#define TK_RAISE                          327
+#define TK_RESTRICT                       328
+#define TK_ROW                            329
+#define TK_SEMI                           330
+#define TK_STAR                           331
+#define TK_STATEMENT                      332
+#define TK_STRICT                         333
+#define TK_STRING                         334
+#define TK_TIMES                          335
+#define TK_VALUES                         336
+#define TK_VARIABLE                       337
+#define TK_VIEW                           338
+#define TK_WAL                            339
 
 
 #define TK_NK_SPACE   600
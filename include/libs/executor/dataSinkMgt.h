@@ -104,6 +104,13 @@ void dsEndPut(DataSinkHandle handle, uint64_t useconds);
  */
 void dsGetDataLength(DataSinkHandle handle, int64_t* pLen, bool* pQueryEnd);
 
+/**
+ * Compress the blocks returned by the following calls of dsGetDataBlock column by column.
+ * @param handle
+ * @param compress
+ */
+void dsSetCompress(DataSinkHandle handle, bool compress);
+
 /**
  * Get data, the caller needs to allocate data memory.
  * @param handle
@@ -40,6 +40,7 @@ extern "C" {
 
 typedef struct SMeta SMeta;
 typedef TSKEY (*GetTsFun)(void*);
+typedef int32_t (*DecodeRowFun)(void* param, const void* pSrc, int32_t srcLen, void* pDst, int32_t dstLen);
 
 typedef struct SMetaEntry {
   int64_t  version;
@@ -99,10 +100,12 @@ typedef struct SMTbCursor {
 } SMTbCursor;
 
 typedef struct SRowBuffPos {
-  void* pRowBuff;
-  void* pKey;
-  bool  beFlushed;
-  bool  beUsed;
+  void*   pRowBuff;
+  void*   pKey;
+  bool    beFlushed;
+  bool    beUsed;
+  int32_t compLen;
+  void*   pCompBuff;  // compressed row kept in memory after the row buffer is released
 } SRowBuffPos;
 
 // tq
@@ -195,7 +198,8 @@ bool    tqNextBlockImpl(STqReader *pReader, const char* idstr);
 STqReader *tqReaderOpen(void *pVnode);
 void       tqReaderClose(STqReader *);
 
-int32_t tqReaderSetSubmitMsg(STqReader *pReader, void *msgStr, int32_t msgLen, int64_t ver);
+int32_t tqReaderSetSubmitMsg(STqReader *pReader, void *msgStr, int32_t msgLen, int64_t ver, int64_t term,
+                             uint32_t cksum);
 bool    tqNextDataBlockFilterOut(STqReader *pReader, SHashObj *filterOutUids);
 SWalReader* tqGetWalReader(STqReader* pReader);
 int32_t tqRetrieveTaosxBlock(STqReader *pReader, SArray *blocks, SArray *schemas, SSubmitTbData **pSubmitTbDataRet);
@@ -256,9 +260,9 @@ typedef struct SStoreMeta {
                                    int32_t payloadLen);
 
   int32_t (*getCachedTableList)(void* pVnode, tb_uid_t suid, const uint8_t* pKey, int32_t keyLen, SArray* pList1,
-                                bool* acquireRes);
+                                SArray* pChanged, int64_t* pVer, bool* acquireRes);
   int32_t (*putCachedTableList)(void* pVnode, uint64_t suid, const void* pKey, int32_t keyLen, void* pPayload,
-                                int32_t payloadLen, double selectivityRatio);
+                                int32_t payloadLen, double selectivityRatio, int64_t ver);
 
   void* (*storeGetIndexInfo)();
   void* (*getInvertIndex)(void* pVnode);
@@ -382,7 +386,8 @@ typedef struct SStateStore {
   SStreamStateCur* (*streamStateSessionSeekKeyCurrentNext)(SStreamState* pState, const SSessionKey* key);
 
   struct SStreamFileState* (*streamFileStateInit)(int64_t memSize, uint32_t keySize, uint32_t rowSize,
-                                                  uint32_t selectRowSize, GetTsFun fp, void* pFile, TSKEY delMark, const char*id);
+                                                  uint32_t selectRowSize, GetTsFun fp, DecodeRowFun fpDecode,
+                                                  void* pDecodeParam, void* pFile, TSKEY delMark, const char* id);
 
   void (*streamFileStateDestroy)(struct SStreamFileState* pFileState);
   void (*streamFileStateClear)(struct SStreamFileState* pFileState);
@@ -28,18 +28,23 @@ struct SqlFunctionCtx;
 struct SResultRowEntryInfo;
 
 struct SFunctionNode;
+struct SFuncRowSegment;
 typedef struct SScalarParam SScalarParam;
 
 typedef struct SFuncExecEnv {
   int32_t calcMemSize;
+  int32_t maxMemSize;  // the buffer to keep the whole intermediate result in the row, 0 if it is calcMemSize
 } SFuncExecEnv;
 
 typedef bool (*FExecGetEnv)(struct SFunctionNode *pFunc, SFuncExecEnv *pEnv);
 typedef bool (*FExecInit)(struct SqlFunctionCtx *pCtx, struct SResultRowEntryInfo *pResultCellInfo);
 typedef int32_t (*FExecProcess)(struct SqlFunctionCtx *pCtx);
+typedef int32_t (*FExecProcessBatch)(struct SqlFunctionCtx *pCtx, const struct SFuncRowSegment *pSegs, int32_t numOfSegs);
 typedef int32_t (*FExecFinalize)(struct SqlFunctionCtx *pCtx, SSDataBlock *pBlock);
 typedef int32_t (*FScalarExecProcess)(SScalarParam *pInput, int32_t inputNum, SScalarParam *pOutput);
 typedef int32_t (*FExecCombine)(struct SqlFunctionCtx *pDestCtx, struct SqlFunctionCtx *pSourceCtx);
+typedef void (*FExecCleanUp)(struct SResultRowEntryInfo *pResultCellInfo);
+typedef int32_t (*FExecDecodeLegacy)(const char *pLegacy, char *pBuf);
 
 typedef struct SScalarFuncExecFuncs {
   FExecGetEnv        getEnv;
@@ -47,11 +52,13 @@ typedef struct SScalarFuncExecFuncs {
 } SScalarFuncExecFuncs;
 
 typedef struct SFuncExecFuncs {
-  FExecGetEnv   getEnv;
-  FExecInit     init;
-  FExecProcess  process;
-  FExecFinalize finalize;
-  FExecCombine  combine;
+  FExecGetEnv       getEnv;
+  FExecInit         init;
+  FExecProcess      process;
+  FExecFinalize     finalize;
+  FExecCombine      combine;
+  FExecCleanUp      cleanup;       // release the memory out of the row, if the row is destroyed before it is finalized
+  FExecProcessBatch processBatch;  // optional, accumulate several row ranges into their own result rows in one call
 } SFuncExecFuncs;
 
 #define MAX_INTERVAL_TIME_WINDOW 10000000  // maximum allowed time windows in final results
@@ -66,6 +73,13 @@ typedef struct SResultRowEntryInfo {
   uint16_t numOfRes;         // num of output result in current buffer. NOT NULL RESULT
 } SResultRowEntryInfo;
 
+// a range of rows in the current input block, and the result entry it is accumulated into
+typedef struct SFuncRowSegment {
+  int32_t              startRowIndex;
+  int32_t              numOfRows;
+  SResultRowEntryInfo *pResInfo;
+} SFuncRowSegment;
+
 // determine the real data need to calculated the result
 enum {
   BLK_DATA_NOT_LOAD = 0x0,
@@ -157,6 +157,8 @@ typedef enum EFunctionType {
   FUNCTION_TYPE_AVG_MERGE,
   FUNCTION_TYPE_STDDEV_PARTIAL,
   FUNCTION_TYPE_STDDEV_MERGE,
+  FUNCTION_TYPE_PERCENTILE_PARTIAL,
+  FUNCTION_TYPE_PERCENTILE_MERGE,
 
   // geometry functions
   FUNCTION_TYPE_GEOM_FROM_TEXT = 4250,
@@ -253,6 +255,8 @@ int32_t fmGetScalarFuncExecFuncs(int32_t funcId, SScalarFuncExecFuncs* pFpSet);
 int32_t fmGetUdafExecFuncs(int32_t funcId, SFuncExecFuncs* pFpSet);
 int32_t fmSetInvertFunc(int32_t funcId, SFuncExecFuncs* pFpSet);
 int32_t fmSetNormalFunc(int32_t funcId, SFuncExecFuncs* pFpSet);
+int32_t fmGetLegacyResBufSize(int32_t funcId);
+int32_t fmDecodeLegacyResBuf(int32_t funcId, const char* pLegacy, char* pBuf);
 bool    fmIsInvertible(int32_t funcId);
 char*   fmGetFuncName(int32_t funcId);
 
@@ -45,9 +45,19 @@ typedef struct {
 } SMonLogs;
 
 typedef struct {
-  char      name[TSDB_FILENAME_LEN];
-  int8_t    level;
-  SDiskSize size;
+  int64_t ops;
+  int64_t bytes;
+  int64_t inflightBytes;
+  int64_t latency;  // us
+} SMonDiskIo;
+
+typedef struct {
+  char       name[TSDB_FILENAME_LEN];
+  int8_t     level;
+  SDiskSize  size;
+  SMonDiskIo read;
+  SMonDiskIo write;
+  SMonDiskIo sync;
 } SMonDiskDesc;
 
 typedef struct {
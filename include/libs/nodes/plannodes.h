@@ -109,13 +109,16 @@ typedef struct SScanLogicNode {
   bool          groupOrderScan;
 } SScanLogicNode;
 
+typedef enum EJoinAlgorithm { JOIN_ALGO_MERGE = 1, JOIN_ALGO_HASH } EJoinAlgorithm;
+
 typedef struct SJoinLogicNode {
-  SLogicNode node;
-  EJoinType  joinType;
-  SNode*     pMergeCondition;
-  SNode*     pOnConditions;
-  bool       isSingleTableJoin;
-  SNode*     pColEqualOnConditions;
+  SLogicNode     node;
+  EJoinType      joinType;
+  EJoinAlgorithm joinAlgo;
+  SNode*         pMergeCondition;
+  SNode*         pOnConditions;
+  bool           isSingleTableJoin;
+  SNode*         pColEqualOnConditions;
 } SJoinLogicNode;
 
 typedef struct SAggLogicNode {
@@ -415,6 +418,14 @@ typedef struct SSortMergeJoinPhysiNode {
   SNode*     pColEqualOnConditions;
 } SSortMergeJoinPhysiNode;
 
+typedef struct SHashJoinPhysiNode {
+  SPhysiNode node;
+  EJoinType  joinType;
+  SNode*     pOnConditions;  // conditions evaluated on the joined rows, besides the equal keys
+  SNodeList* pTargets;
+  SNode*     pColEqualOnConditions;  // equal keys, the left one is the probe side and the right one is the build side
+} SHashJoinPhysiNode;
+
 typedef struct SAggPhysiNode {
   SPhysiNode node;
   SNodeList* pExprs;  // these are expression list of group_by_clause and parameter expression of aggregate function
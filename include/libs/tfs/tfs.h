@@ -32,6 +32,13 @@ typedef struct {
   int32_t id;
 } SDiskID;
 
+typedef enum {
+  TFS_IO_READ = 0,
+  TFS_IO_WRITE,
+  TFS_IO_SYNC,
+  TFS_IO_MAX,
+} ETfsIoType;
+
 typedef struct {
   SDiskID did;
   char    aname[TSDB_FILENAME_LEN];  // TABS name
@@ -94,6 +101,37 @@ int32_t tfsGetLevel(STfs *pTfs);
  */
 int32_t tfsAllocDisk(STfs *pTfs, int32_t expLevel, SDiskID *pDiskId);
 
+/**
+ * @brief Get the disk a path lives on.
+ *
+ * @param pTfs The fs object.
+ * @param path The absolute path.
+ * @param pDiskId The disk ID of the path.
+ * @return int32_t 0 for success, -1 if the path is not under any disk.
+ */
+int32_t tfsGetDiskIdByPath(STfs *pTfs, const char *path, SDiskID *pDiskId);
+
+/**
+ * @brief Account an io on a disk before it is issued.
+ *
+ * @param pTfs The fs object.
+ * @param diskId The disk ID.
+ * @param type TFS_IO_READ, TFS_IO_WRITE or TFS_IO_SYNC.
+ * @param bytes Bytes the io transfers, or the unsynced bytes an fsync flushes.
+ */
+void tfsIoBegin(STfs *pTfs, SDiskID diskId, ETfsIoType type, int64_t bytes);
+
+/**
+ * @brief Account an io on a disk after it is done.
+ *
+ * @param pTfs The fs object.
+ * @param diskId The disk ID.
+ * @param type TFS_IO_READ, TFS_IO_WRITE or TFS_IO_SYNC.
+ * @param bytes Bytes given to tfsIoBegin.
+ * @param latency Time the io took in us.
+ */
+void tfsIoEnd(STfs *pTfs, SDiskID diskId, ETfsIoType type, int64_t bytes, int64_t latency);
+
 /**
  * @brief Get the primary path.
  *
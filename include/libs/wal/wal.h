@@ -43,6 +43,7 @@ extern "C" {
 #define WAL_FILE_LEN      (WAL_PATH_LEN + 32)
 #define WAL_MAGIC         0xFAFBFCFDF4F3F2F1ULL
 #define WAL_SCAN_BUF_SIZE (1024 * 1024 * 3)
+#define WAL_READ_BUF_SIZE (1024 * 1024)
 
 typedef enum {
   TAOS_WAL_WRITE = 1,
@@ -131,6 +132,15 @@ typedef struct {
   SWal *pWal;
 } SWalRef;
 
+// one entry of a group commit
+typedef struct {
+  int64_t      index;
+  tmsg_t       msgType;
+  SWalSyncInfo syncMeta;
+  const void  *body;
+  int32_t      bodyLen;
+} SWalBatchEntry;
+
 typedef struct {
   int8_t scanUncommited;
   int8_t scanNotApplied;
@@ -154,6 +164,13 @@ struct SWalReader {
   TdThreadMutex  mutex;
   SWalFilterCond cond;
   SWalCkHead *pHead;
+  // read ahead buffer of the log file, the position of the log file is always at bufOffset + bufLen
+  char          *pBuf;
+  int64_t        bufOffset;
+  int64_t        bufLen;
+  int64_t        bufPos;
+  int64_t        bufCommitVer;  // entries of later versions may be rolled back after the buffer is filled
+  bool           bufBypass;     // read the current entry from the log file directly
 };
 
 // module initialization
@@ -177,6 +194,10 @@ int32_t walWriteWithSyncInfo(SWal *, int64_t index, tmsg_t msgType, SWalSyncInfo
 // -1 will be returned for failed writes
 int64_t walAppendLog(SWal *, int64_t index, tmsg_t msgType, SWalSyncInfo syncMeta, const void *body, int32_t bodyLen);
 
+// Group commit: append consecutive entries under one lock with a single vectored write, and fsync them once if
+// forceSync is set or the wal is configured with fsyncPeriod 0. Returns the index of the last entry, or -1.
+int64_t walAppendLogBatch(SWal *, const SWalBatchEntry *pEntries, int32_t num, bool forceSync);
+
 void walFsync(SWal *, bool force);
 
 // apis for lifecycle management
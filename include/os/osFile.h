@@ -89,6 +89,14 @@ int64_t taosReadFile(TdFilePtr pFile, void *buf, int64_t count);
 int64_t taosPReadFile(TdFilePtr pFile, void *buf, int64_t count, int64_t offset);
 int64_t taosWriteFile(TdFilePtr pFile, const void *buf, int64_t count);
 int64_t taosPWriteFile(TdFilePtr pFile, const void *buf, int64_t count, int64_t offset);
+
+typedef struct TdFileIoVec {
+  const void *buf;
+  int64_t     len;
+} TdFileIoVec;
+
+// write all the buffers in order, using as few syscalls as possible
+int64_t taosWritevFile(TdFilePtr pFile, const TdFileIoVec *iov, int32_t iovcnt);
 void    taosFprintfFile(TdFilePtr pFile, const char *format, ...);
 
 int64_t taosGetLineFile(TdFilePtr pFile, char **__restrict ptrBuf);
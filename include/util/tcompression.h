@@ -86,6 +86,14 @@ static FORCE_INLINE int32_t tsDecompressDoubleLossy(const char *const input, int
 /*************************************************************************
  *                  REGULAR COMPRESSION
  *************************************************************************/
+// the lossless float and double codecs and the lz4 stage, they ignore lossyFloat and lossyDouble
+int32_t tsCompressFloatImp(const char *const input, const int32_t nelements, char *const output);
+int32_t tsDecompressFloatImp(const char *const input, const int32_t nelements, char *const output);
+int32_t tsCompressDoubleImp(const char *const input, const int32_t nelements, char *const output);
+int32_t tsDecompressDoubleImp(const char *const input, const int32_t nelements, char *const output);
+int32_t tsCompressStringImp(const char *const input, int32_t inputSize, char *const output, int32_t outputSize);
+int32_t tsDecompressStringImp(const char *const input, int32_t compressedSize, char *const output, int32_t outputSize);
+
 int32_t tsCompressTimestamp(void *pIn, int32_t nIn, int32_t nEle, void *pOut, int32_t nOut, uint8_t cmprAlg, void *pBuf,
                             int32_t nBuf);
 int32_t tsDecompressTimestamp(void *pIn, int32_t nIn, int32_t nEle, void *pOut, int32_t nOut, uint8_t cmprAlg,
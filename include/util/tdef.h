@@ -429,6 +429,10 @@ typedef enum ELogicConditionType {
 #define TSDB_MAX_RPC_THREADS 10
 #endif
 
+// the range of the t-digest compression of percentile, a larger one keeps more centroids for a smaller error
+#define TSDB_MIN_PERCENTILE_COMPRESSION 100
+#define TSDB_MAX_PERCENTILE_COMPRESSION 500
+
 #define TSDB_QUERY_TYPE_NON_TYPE 0x00u  // none type
 
 #define TSDB_META_COMPACT_RATIO 0  // disable tsdb meta compact by default
@@ -48,10 +48,11 @@ typedef struct SDiskbasedBufStatis {
  * @param pagesize
  * @param inMemPages
  * @param handle
+ * @param comp  compress the pages flushed to disk
  * @return
  */
 int32_t createDiskbasedBuf(SDiskbasedBuf** pBuf, int32_t pagesize, int32_t inMemBufSize, const char* id,
-                           const char* dir);
+                           const char* dir, bool comp);
 
 /**
  *
@@ -103,6 +104,11 @@ size_t getTotalBufSize(const SDiskbasedBuf* pBuf);
  */
 void destroyDiskbasedBuf(SDiskbasedBuf* pBuf);
 
+/**
+ * stop the flusher thread shared by all paged buffers, after the queued pages are written.
+ */
+void cleanupDiskbasedBufFlusher();
+
 /**
  *
  * @param pList
@@ -147,6 +153,7 @@ void setBufPageDirty(void* pPage, bool dirty);
 
 /**
  * Set the compress/ no-compress flag for paged buffer, when flushing data in disk.
+ * The default is given when the buffer is created.
  * @param pBuf
  */
 void setBufPageCompressOnDisk(SDiskbasedBuf* pBuf, bool comp);
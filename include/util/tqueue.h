@@ -33,6 +33,9 @@ Notes:
 1: taosOpenQueue/taosCloseQueue, taosOpenQset/taosCloseQset is NOT multi-thread safe
 2: after taosCloseQueue/taosCloseQset is called, read/write operation APIs are not safe.
 3: read/write operation APIs are multi-thread safe
+4: writers push items into a lock-free stack and never block, readers take the whole stack at once and
+   keep the items in FIFO order. A reader of a queue set spins for a while before it sleeps, and the
+   writers only wake up the sleeping readers.
 
 To remove the limitation and make this set of queue APIs multi-thread safe, REF(tref.c)
 shall be used to set up the protection.
@@ -73,14 +76,15 @@ struct STaosQnode {
 };
 
 struct STaosQueue {
-  STaosQnode   *head;
+  STaosQnode   *head;     // items taken over by the readers, in FIFO order
   STaosQnode   *tail;
+  STaosQnode   *pending;  // lock-free stack the writers push items into
   STaosQueue   *next;     // for queue set
   STaosQset    *qset;     // for queue set
   void         *ahandle;  // for queue set
   FItem         itemFp;
   FItems        itemsFp;
-  TdThreadMutex mutex;
+  TdThreadMutex mutex;  // serializes the readers only
   int64_t       memOfItems;
   int32_t       numOfItems;
   int64_t       threadId;
@@ -95,6 +99,9 @@ struct STaosQset {
   tsem_t        sem;
   int32_t       numOfQueues;
   int32_t       numOfItems;
+  int32_t       numOfWaiters;  // readers sleeping on sem
+  int32_t       numOfResumes;  // readers asked to exit by taosQsetThreadResume
+  int32_t       spinCount;
 };
 
 struct STaosQall {
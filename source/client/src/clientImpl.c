@@ -2101,6 +2101,27 @@ void resetConnectDB(STscObj* pTscObj) {
   taosThreadMutexUnlock(&pTscObj->mutex);
 }
 
+static int32_t doDecompressResData(SReqResultInfo* pResultInfo) {
+  int32_t len = blockGetDecompressSize(pResultInfo->pData);
+  if (pResultInfo->decompBufSize < len) {
+    char* p = taosMemoryRealloc(pResultInfo->decompBuf, len);
+    if (p == NULL) {
+      return TSDB_CODE_OUT_OF_MEMORY;
+    }
+
+    pResultInfo->decompBuf = p;
+    pResultInfo->decompBufSize = len;
+  }
+
+  if (blockDecompressEncodeBuf(pResultInfo->pData, pResultInfo->decompBuf) < 0) {
+    tscError("failed to decompress result block since %s", tstrerror(terrno));
+    return terrno;
+  }
+
+  pResultInfo->pData = pResultInfo->decompBuf;
+  return TSDB_CODE_SUCCESS;
+}
+
 int32_t setQueryResultFromRsp(SReqResultInfo* pResultInfo, const SRetrieveTableRsp* pRsp, bool convertUcs4,
                               bool freeAfterUse) {
   if (pResultInfo == NULL || pRsp == NULL) {
@@ -2118,7 +2139,13 @@ int32_t setQueryResultFromRsp(SReqResultInfo* pResultInfo, const SRetrieveTableR
   pResultInfo->payloadLen = htonl(pRsp->compLen);
   pResultInfo->precision = pRsp->precision;
 
-  // TODO handle the compressed case
+  if (pRsp->compressed && pResultInfo->numOfRows > 0 && blockIsCompressed(pResultInfo->pData)) {
+    int32_t code = doDecompressResData(pResultInfo);
+    if (code != TSDB_CODE_SUCCESS) {
+      return code;
+    }
+  }
+
   pResultInfo->totalRows += pResultInfo->numOfRows;
   return setResultDataPtr(pResultInfo, pResultInfo->fields, pResultInfo->numOfCols, pResultInfo->numOfRows,
                           convertUcs4);
@@ -314,14 +314,17 @@ cleanup:
   kvVal->type = TSDB_DATA_TYPE_FLOAT;                                                          \
   kvVal->f = (float)result;
 
-#define SET_BIGINT                                                                                       \
-  errno = 0;                                                                                             \
-  int64_t tmp = taosStr2Int64(pVal, &endptr, 10);                                                        \
-  if (errno == ERANGE) {                                                                                 \
-    smlBuildInvalidDataMsg(msg, "big int out of range[-9223372036854775808,9223372036854775807]", pVal); \
-    return false;                                                                                        \
-  }                                                                                                      \
-  kvVal->type = TSDB_DATA_TYPE_BIGINT;                                                                   \
+#define SET_BIGINT                                                                                         \
+  int64_t tmp = iVal;                                                                                      \
+  if (!isInt) {                                                                                            \
+    errno = 0;                                                                                             \
+    tmp = taosStr2Int64(pVal, &endptr, 10);                                                                \
+    if (errno == ERANGE) {                                                                                 \
+      smlBuildInvalidDataMsg(msg, "big int out of range[-9223372036854775808,9223372036854775807]", pVal); \
+      return false;                                                                                        \
+    }                                                                                                      \
+  }                                                                                                        \
+  kvVal->type = TSDB_DATA_TYPE_BIGINT;                                                                     \
   kvVal->i = tmp;
 
 #define SET_INT                                                                    \
@@ -341,9 +344,12 @@ cleanup:
   kvVal->i = result;
 
 #define SET_UBIGINT                                                                             \
-  errno = 0;                                                                                    \
-  uint64_t tmp = taosStr2UInt64(pVal, &endptr, 10);                                             \
-  if (errno == ERANGE || result < 0) {                                                          \
+  uint64_t tmp = (uint64_t)iVal;                                                                \
+  if (!isInt) {                                                                                 \
+    errno = 0;                                                                                  \
+    tmp = taosStr2UInt64(pVal, &endptr, 10);                                                    \
+  }                                                                                             \
+  if ((!isInt && errno == ERANGE) || result < 0) {                                              \
     smlBuildInvalidDataMsg(msg, "unsigned big int out of range[0,18446744073709551615]", pVal); \
     return false;                                                                               \
   }                                                                                             \
@@ -382,11 +388,43 @@ cleanup:
   kvVal->type = TSDB_DATA_TYPE_UTINYINT;                                        \
   kvVal->u = result;
 
+// Decimal integers of at most 18 digits, optionally followed by a type suffix, are parsed in place. Anything else,
+// fractions, exponents, hex, inf or nan, goes through strtod.
+static double smlStr2Number(const char *pVal, int32_t len, char **endptr, bool *isInt, int64_t *iVal) {
+  const char *p = pVal;
+  const char *end = pVal + len;
+  bool        neg = false;
+
+  if (p < end && (*p == '-' || *p == '+')) {
+    neg = (*p == '-');
+    p++;
+  }
+
+  const char *digits = p;
+  uint64_t    u = 0;
+  while (p < end && p - digits < 18 && *p >= '0' && *p <= '9') {
+    u = u * 10 + (*p - '0');
+    p++;
+  }
+
+  if (p > digits && (p == end || *p == 'i' || *p == 'I' || *p == 'u' || *p == 'U' || *p == 'f' || *p == 'F')) {
+    *isInt = true;
+    *iVal = neg ? -(int64_t)u : (int64_t)u;
+    *endptr = (char *)p;
+    return neg ? -(double)u : (double)u;
+  }
+
+  *isInt = false;
+  return taosStr2Double(pVal, endptr);
+}
+
 bool smlParseNumber(SSmlKv *kvVal, SSmlMsgBuf *msg) {
   const char *pVal = kvVal->value;
   int32_t     len = kvVal->length;
   char       *endptr = NULL;
-  double      result = taosStr2Double(pVal, &endptr);
+  bool        isInt = false;
+  int64_t     iVal = 0;
+  double      result = smlStr2Number(pVal, len, &endptr, &isInt, &iVal);
   if (pVal == endptr) {
     RETURN_FALSE
   }
@@ -18,6 +18,8 @@
 #include <taoserror.h>
 #include <tglobal.h>
 #include <iostream>
+#include <string>
+#include <vector>
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wwrite-strings"
@@ -581,4 +583,130 @@ TEST(testCase, smlParseNumber_performance_Test) {
     printf("smlParseNumberOld:%s cost:%" PRId64, str[i], taosGetTimestampUs() - t2);
     printf("\n\n");
   }
-}
\ No newline at end of file
+}
+
+// parse every line, dump what the parser found for each of them unless only the parse is measured
+static std::vector<std::string> smlParseLinesDump(const std::vector<std::string> &lines, bool dump = true) {
+  std::vector<std::string> out;
+  SSmlHandle              *info = smlBuildSmlInfo(NULL);
+  info->protocol = TSDB_SML_LINE_PROTOCOL;
+  info->dataFormat = false;
+  char msg[256] = {0};
+  info->msgBuf.buf = msg;
+  info->msgBuf.len = 256;
+
+  // the handle refers to the previous line, keep all of them till the end
+  std::vector<char *> sqls;
+  for (const std::string &line : lines) {
+    SSmlLineInfo elements = {0};
+    char        *sql = (char *)taosMemoryCalloc(line.size() + 1, 1);
+    memcpy(sql, line.c_str(), line.size());
+    sqls.push_back(sql);
+    int32_t ret = smlParseInfluxString(info, sql, sql + line.size(), &elements);
+
+    std::string res = std::to_string(ret);
+    if (dump && ret == TSDB_CODE_SUCCESS) {
+      res += " " + std::to_string(elements.measureLen) + " " + std::to_string(elements.measureTagsLen) + " " +
+             std::to_string(elements.tagsLen) + " " + std::to_string(elements.colsLen) + " " +
+             std::to_string(elements.timestampLen);
+      for (int32_t i = 1; i < taosArrayGetSize(elements.colArray); i++) {
+        SSmlKv *kv = (SSmlKv *)taosArrayGet(elements.colArray, i);
+        res += "|" + std::string(kv->key, kv->keyLen) + ":" + std::to_string(kv->type);
+        if (IS_VAR_DATA_TYPE(kv->type)) {
+          res += ":" + std::string(kv->value, kv->length);
+        } else {
+          res += ":" + std::to_string(kv->i);
+        }
+      }
+    }
+    for (int32_t i = 1; i < taosArrayGetSize(elements.colArray); i++) {
+      freeSSmlKv((SSmlKv *)taosArrayGet(elements.colArray, i));
+    }
+    if (dump) out.push_back(res);
+    taosArrayDestroy(elements.colArray);
+  }
+
+  smlDestroyInfo(info);
+  for (char *sql : sqls) {
+    taosMemoryFree(sql);
+  }
+  return out;
+}
+
+TEST(testCase, smlParseInfluxString_simd_Test) {
+  std::string              longName(70, 'm');
+  std::string              longValue(100, 'v');
+  std::vector<std::string> lines = {
+      "st,t1=3,t2=4 c1=3i64,c2=\"passit\" 1626006833639000000",
+      longName + ",tag_with_a_long_name=" + longValue + " col_with_a_long_name=\"" + longValue + "\" 1626006833639",
+      longName + "\\," + longName + "\\ x,t\\=1=a\\,b\\ c" + longValue + " c=1i 1626006833639",
+      "st,t=1 cb\\=in=\"pass\\,it hello,c=2\",cnch=L\"ii\\=sdfsf\",cbool=false,cf64=4.31f64 1626006833639000000",
+      "st,t=1 c=\"" + longValue + "\\\"" + longValue + "\\\\\",c2=-12345678901234i64 1626006833639000000",
+      "st,t=1 c=\"" + longValue + " " + longValue + "," + longValue + "\",c2=7u8,c3=1e3,c4=0x10 1626006833639000000",
+      "st,t=1 c=\"" + longValue + "\"\"" + longValue + "\" 1626006833639000000",
+      "st,t=1 " + longName + "=12345678901234567890u64 1626006833639000000",
+      "st,t=1 c=\"" + longValue + " 1626006833639000000",
+      "st,t=1," + longName + " c=1 1626006833639000000",
+  };
+
+  char avx2 = tsAVX2Enable;
+  char simd = tsSIMDBuiltins;
+
+  tsAVX2Enable = 0;
+  tsSIMDBuiltins = 0;
+  std::vector<std::string> expect = smlParseLinesDump(lines);
+
+  tsAVX2Enable = 1;
+  tsSIMDBuiltins = 1;
+  std::vector<std::string> res = smlParseLinesDump(lines);
+
+  tsAVX2Enable = avx2;
+  tsSIMDBuiltins = simd;
+
+  ASSERT_EQ(res.size(), expect.size());
+  for (size_t i = 0; i < res.size(); i++) {
+    ASSERT_EQ(res[i], expect[i]) << "line " << i;
+  }
+  ASSERT_EQ(res[0], "0 2 12 9 19 19|c1:5:3|c2:8:passit");
+}
+
+// set SML_LINE_FILE to a file of captured lines to measure on real data
+TEST(testCase, smlParseInfluxString_performance_Test) {
+  std::vector<std::string> lines;
+
+  const char *file = getenv("SML_LINE_FILE");
+  if (file != NULL) {
+    TdFilePtr pFile = taosOpenFile(file, TD_FILE_READ | TD_FILE_STREAM);
+    ASSERT_NE(pFile, nullptr);
+    char   *line = NULL;
+    int64_t len = 0;
+    while ((len = taosGetLineFile(pFile, &line)) != -1) {
+      while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r')) len--;
+      if (len > 0) lines.push_back(std::string(line, len));
+    }
+    taosMemoryFree(line);
+    taosCloseFile(&pFile);
+  } else {
+    char buf[512] = {0};
+    for (int i = 0; i < 100000; ++i) {
+      snprintf(buf, sizeof(buf),
+               "cpu,host=server%04d,region=us-west-2,datacenter=us-west-2a,rack=%d,os=Ubuntu16.10 "
+               "usage_user=%d.5,usage_system=%di64,usage_idle=%du32,usage_nice=\"nice value %d\" %" PRId64,
+               i % 1000, i % 100, i % 100, i, i * 7, i, (int64_t)1626006833639000000 + i);
+      lines.push_back(buf);
+    }
+  }
+
+  char avx2 = tsAVX2Enable;
+  char simd = tsSIMDBuiltins;
+  for (int simdOn = 0; simdOn <= 1; ++simdOn) {
+    tsAVX2Enable = simdOn;
+    tsSIMDBuiltins = simdOn;
+    int64_t t1 = taosGetTimestampUs();
+    smlParseLinesDump(lines, false);
+    printf("smlParseInfluxString simd:%d lines:%d cost:%" PRId64 "\n", simdOn, (int)lines.size(),
+           taosGetTimestampUs() - t1);
+  }
+  tsAVX2Enable = avx2;
+  tsSIMDBuiltins = simd;
+}
@@ -16,6 +16,7 @@
 #define _DEFAULT_SOURCE
 #include "tdatablock.h"
 #include "tcompare.h"
+#include "tcompression.h"
 #include "tlog.h"
 #include "tname.h"
 
@@ -2190,9 +2191,277 @@ int32_t blockEncode(const SSDataBlock* pBlock, char* data, int32_t numOfCols) {
   return dataLen;
 }
 
+// the second bit of the flag segment marks a block whose columns are compressed one by one
+#define BLOCK_FLAG_COMPRESSED (1 << 30)
+
+typedef int32_t (*FBlockColCodec)(void* pIn, int32_t nIn, int32_t nEle, void* pOut, int32_t nOut, uint8_t cmprAlg,
+                                  void* pBuf, int32_t nBuf);
+
+typedef int32_t (*FBlockFloatImp)(const char* const input, const int32_t nelements, char* const output);
+
+// the float and double columns are always compressed losslessly, the lossy columns only apply to the stored data
+static int32_t blockCompressFloatCol(FBlockFloatImp fp, void* pIn, int32_t nEle, void* pOut, int32_t nOut,
+                                     uint8_t cmprAlg, void* pBuf) {
+  if (cmprAlg == ONE_STAGE_COMP) {
+    return fp(pIn, nEle, pOut);
+  } else if (cmprAlg == TWO_STAGE_COMP) {
+    int32_t len = fp(pIn, nEle, pBuf);
+    return tsCompressStringImp(pBuf, len, pOut, nOut);
+  }
+  return -1;
+}
+
+static int32_t blockDecompressFloatCol(FBlockFloatImp fp, void* pIn, int32_t nIn, int32_t nEle, void* pOut,
+                                       uint8_t cmprAlg, void* pBuf, int32_t nBuf) {
+  if (cmprAlg == ONE_STAGE_COMP) {
+    return fp(pIn, nEle, pOut);
+  } else if (cmprAlg == TWO_STAGE_COMP) {
+    if (tsDecompressStringImp(pIn, nIn, pBuf, nBuf) < 0) return -1;
+    return fp(pBuf, nEle, pOut);
+  }
+  return -1;
+}
+
+static int32_t blockCompressFloat(void* pIn, int32_t nIn, int32_t nEle, void* pOut, int32_t nOut, uint8_t cmprAlg,
+                                  void* pBuf, int32_t nBuf) {
+  return blockCompressFloatCol(tsCompressFloatImp, pIn, nEle, pOut, nOut, cmprAlg, pBuf);
+}
+
+static int32_t blockDecompressFloat(void* pIn, int32_t nIn, int32_t nEle, void* pOut, int32_t nOut, uint8_t cmprAlg,
+                                    void* pBuf, int32_t nBuf) {
+  return blockDecompressFloatCol(tsDecompressFloatImp, pIn, nIn, nEle, pOut, cmprAlg, pBuf, nBuf);
+}
+
+static int32_t blockCompressDouble(void* pIn, int32_t nIn, int32_t nEle, void* pOut, int32_t nOut, uint8_t cmprAlg,
+                                   void* pBuf, int32_t nBuf) {
+  return blockCompressFloatCol(tsCompressDoubleImp, pIn, nEle, pOut, nOut, cmprAlg, pBuf);
+}
+
+static int32_t blockDecompressDouble(void* pIn, int32_t nIn, int32_t nEle, void* pOut, int32_t nOut, uint8_t cmprAlg,
+                                     void* pBuf, int32_t nBuf) {
+  return blockDecompressFloatCol(tsDecompressDoubleImp, pIn, nIn, nEle, pOut, cmprAlg, pBuf, nBuf);
+}
+
+static void blockGetColCodec(int8_t type, FBlockColCodec* fCompress, FBlockColCodec* fDecompress) {
+  switch (type) {
+    case TSDB_DATA_TYPE_TIMESTAMP:
+      *fCompress = tsCompressTimestamp;
+      *fDecompress = tsDecompressTimestamp;
+      break;
+    case TSDB_DATA_TYPE_BIGINT:
+    case TSDB_DATA_TYPE_UBIGINT:
+      *fCompress = tsCompressBigint;
+      *fDecompress = tsDecompressBigint;
+      break;
+    case TSDB_DATA_TYPE_INT:
+    case TSDB_DATA_TYPE_UINT:
+      *fCompress = tsCompressInt;
+      *fDecompress = tsDecompressInt;
+      break;
+    case TSDB_DATA_TYPE_SMALLINT:
+    case TSDB_DATA_TYPE_USMALLINT:
+      *fCompress = tsCompressSmallint;
+      *fDecompress = tsDecompressSmallint;
+      break;
+    case TSDB_DATA_TYPE_BOOL:
+    case TSDB_DATA_TYPE_TINYINT:
+    case TSDB_DATA_TYPE_UTINYINT:
+      *fCompress = tsCompressTinyint;
+      *fDecompress = tsDecompressTinyint;
+      break;
+    case TSDB_DATA_TYPE_FLOAT:
+      *fCompress = blockCompressFloat;
+      *fDecompress = blockDecompressFloat;
+      break;
+    case TSDB_DATA_TYPE_DOUBLE:
+      *fCompress = blockCompressDouble;
+      *fDecompress = blockDecompressDouble;
+      break;
+    default:  // var data and the others are compressed by lz4
+      *fCompress = tsCompressString;
+      *fDecompress = tsDecompressString;
+      break;
+  }
+}
+
+// | compressed length | compressed data |
+static int32_t blockCompressSegment(FBlockColCodec fp, const char** ppIn, int32_t nIn, int32_t nEle, char** ppOut) {
+  int32_t len = 0;
+  if (nIn > 0) {
+    len = fp((void*)*ppIn, nIn, nEle, *ppOut + sizeof(int32_t), nIn + COMP_OVERFLOW_BYTES, ONE_STAGE_COMP, NULL, 0);
+    if (len <= 0) {
+      terrno = TSDB_CODE_INVALID_DATA_FMT;
+      return -1;
+    }
+  }
+
+  *(int32_t*)(*ppOut) = len;
+  *ppIn += nIn;
+  *ppOut += sizeof(int32_t) + len;
+  return 0;
+}
+
+static int32_t blockDecompressSegment(FBlockColCodec fp, const char** ppIn, int32_t nEle, char** ppOut, int32_t nOut) {
+  int32_t len = *(int32_t*)(*ppIn);
+  if (len > 0) {
+    if (fp((void*)(*ppIn + sizeof(int32_t)), len, nEle, *ppOut, nOut, ONE_STAGE_COMP, NULL, 0) != nOut) {
+      terrno = TSDB_CODE_INVALID_DATA_FMT;
+      return -1;
+    }
+  } else if (nOut != 0) {
+    terrno = TSDB_CODE_INVALID_DATA_FMT;
+    return -1;
+  }
+
+  *ppIn += sizeof(int32_t) + len;
+  *ppOut += nOut;
+  return 0;
+}
+
+bool blockIsCompressed(const char* pData) {
+  int32_t flagSeg = *(int32_t*)(pData + sizeof(int32_t) * 4);
+  return (flagSeg & BLOCK_FLAG_COMPRESSED) != 0;
+}
+
+int32_t blockGetCompressBufSize(const char* pData) {
+  int32_t dataLen = *(int32_t*)(pData + sizeof(int32_t));
+  int32_t numOfCols = *(int32_t*)(pData + sizeof(int32_t) * 3);
+  return dataLen + sizeof(int32_t) + numOfCols * 2 * (sizeof(int32_t) + COMP_OVERFLOW_BYTES);
+}
+
+int32_t blockGetDecompressSize(const char* pData) {
+  int32_t numOfCols = *(int32_t*)(pData + sizeof(int32_t) * 3);
+  return *(int32_t*)(pData + blockDataGetSerialMetaSize(numOfCols));
+}
+
+/**
+ * Compress a block encoded by blockEncode column by column. The meta part is kept as it is, except that the
+ * compressed flag is set, and the original length is appended to it:
+ * | meta | original length | col1 meta length | col1 meta | col1 data length | col1 data | ... |
+ * If the compressed block is not smaller, the original block is copied to pOut without the flag.
+ * @param pData encoded block
+ * @param pOut output buffer, at least blockGetCompressBufSize(pData) bytes
+ * @return the length of the block in pOut, or -1 on failure
+ */
+int32_t blockCompressEncodeBuf(const char* pData, char* pOut) {
+  int32_t numOfRows = *(int32_t*)(pData + sizeof(int32_t) * 2);
+  int32_t numOfCols = *(int32_t*)(pData + sizeof(int32_t) * 3);
+  int32_t metaSize = blockDataGetSerialMetaSize(numOfCols);
+
+  if (blockIsCompressed(pData)) {
+    terrno = TSDB_CODE_INVALID_PARA;
+    return -1;
+  }
+
+  memcpy(pOut, pData, metaSize);
+  *(int32_t*)(pOut + sizeof(int32_t) * 4) |= BLOCK_FLAG_COMPRESSED;
+  *(int32_t*)(pOut + metaSize) = *(int32_t*)(pData + sizeof(int32_t));
+
+  const char*    pSchema = pData + sizeof(int32_t) * 5 + sizeof(uint64_t);
+  const int32_t* colSizes = (const int32_t*)(pSchema + numOfCols * (sizeof(int8_t) + sizeof(int32_t)));
+  const char*    pIn = pData + metaSize;
+  char*          p = pOut + metaSize + sizeof(int32_t);
+
+  for (int32_t col = 0; col < numOfCols; ++col) {
+    int8_t  type = *(int8_t*)(pSchema + col * (sizeof(int8_t) + sizeof(int32_t)));
+    int32_t bytes = *(int32_t*)(pSchema + col * (sizeof(int8_t) + sizeof(int32_t)) + sizeof(int8_t));
+    int32_t colSize = htonl(colSizes[col]);
+
+    FBlockColCodec fCompress = NULL, fDecompress = NULL;
+    blockGetColCodec(type, &fCompress, &fDecompress);
+
+    int32_t code = 0;
+    if (IS_VAR_DATA_TYPE(type)) {
+      code = blockCompressSegment(tsCompressInt, &pIn, numOfRows * sizeof(int32_t), numOfRows, &p);
+    } else {
+      code = blockCompressSegment(tsCompressString, &pIn, BitmapLen(numOfRows), 0, &p);
+    }
+    if (code) return -1;
+
+    int32_t nEle = (IS_VAR_DATA_TYPE(type) || bytes <= 0) ? 0 : colSize / bytes;
+    if (blockCompressSegment(fCompress, &pIn, colSize, nEle, &p)) return -1;
+  }
+
+  int32_t len = p - pOut;
+  int32_t rawLen = *(int32_t*)(pData + sizeof(int32_t));
+  if (len >= rawLen) {
+    memcpy(pOut, pData, rawLen);
+    return rawLen;
+  }
+
+  *(int32_t*)(pOut + sizeof(int32_t)) = len;
+  return len;
+}
+
+/**
+ * Restore a block compressed by blockCompressEncodeBuf to the layout of blockEncode.
+ * @param pData compressed block
+ * @param pOut output buffer, at least blockGetDecompressSize(pData) bytes
+ * @return the length of the restored block, or -1 on failure
+ */
+int32_t blockDecompressEncodeBuf(const char* pData, char* pOut) {
+  int32_t numOfRows = *(int32_t*)(pData + sizeof(int32_t) * 2);
+  int32_t numOfCols = *(int32_t*)(pData + sizeof(int32_t) * 3);
+  int32_t metaSize = blockDataGetSerialMetaSize(numOfCols);
+  int32_t rawLen = blockGetDecompressSize(pData);
+
+  memcpy(pOut, pData, metaSize);
+  *(int32_t*)(pOut + sizeof(int32_t)) = rawLen;
+  *(int32_t*)(pOut + sizeof(int32_t) * 4) &= ~BLOCK_FLAG_COMPRESSED;
+
+  const char*    pSchema = pData + sizeof(int32_t) * 5 + sizeof(uint64_t);
+  const int32_t* colSizes = (const int32_t*)(pSchema + numOfCols * (sizeof(int8_t) + sizeof(int32_t)));
+  const char*    pIn = pData + metaSize + sizeof(int32_t);
+  char*          p = pOut + metaSize;
+
+  for (int32_t col = 0; col < numOfCols; ++col) {
+    int8_t  type = *(int8_t*)(pSchema + col * (sizeof(int8_t) + sizeof(int32_t)));
+    int32_t bytes = *(int32_t*)(pSchema + col * (sizeof(int8_t) + sizeof(int32_t)) + sizeof(int8_t));
+    int32_t colSize = htonl(colSizes[col]);
+
+    FBlockColCodec fCompress = NULL, fDecompress = NULL;
+    blockGetColCodec(type, &fCompress, &fDecompress);
+
+    int32_t code = 0;
+    if (IS_VAR_DATA_TYPE(type)) {
+      code = blockDecompressSegment(tsDecompressInt, &pIn, numOfRows, &p, numOfRows * sizeof(int32_t));
+    } else {
+      code = blockDecompressSegment(tsDecompressString, &pIn, 0, &p, BitmapLen(numOfRows));
+    }
+    if (code) return -1;
+
+    int32_t nEle = (IS_VAR_DATA_TYPE(type) || bytes <= 0) ? 0 : colSize / bytes;
+    if (blockDecompressSegment(fDecompress, &pIn, nEle, &p, colSize)) return -1;
+  }
+
+  if (p - pOut != rawLen) {
+    terrno = TSDB_CODE_INVALID_DATA_FMT;
+    return -1;
+  }
+
+  return rawLen;
+}
+
 const char* blockDecode(SSDataBlock* pBlock, const char* pData) {
   const char* pStart = pData;
 
+  if (blockIsCompressed(pData)) {
+    char* pBuf = taosMemoryMalloc(blockGetDecompressSize(pData));
+    if (pBuf == NULL) {
+      terrno = TSDB_CODE_OUT_OF_MEMORY;
+      return NULL;
+    }
+
+    const char* pEnd = NULL;
+    if (blockDecompressEncodeBuf(pData, pBuf) >= 0) {
+      pEnd = blockDecode(pBlock, pBuf);
+    }
+    taosMemoryFree(pBuf);
+
+    // the compressed length is recorded in the total length field
+    return (pEnd == NULL) ? NULL : pData + *(int32_t*)(pData + sizeof(int32_t));
+  }
+
   int32_t version = *(int32_t*)pStart;
   pStart += sizeof(int32_t);
   ASSERT(version == 1);
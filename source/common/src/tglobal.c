@@ -150,10 +150,10 @@ int32_t tsSlowLogScope = SLOW_LOG_TYPE_ALL;
  */
 int32_t tsCompressMsgSize = -1;
 
-/* denote if server needs to compress the retrieved column data before adding to the rpc response message body.
- * 0: all data are compressed
+/* denote if the fetcher asks the server to compress the retrieved blocks column by column before adding them to the
+ * rpc response message body.
  * -1: all data are not compressed
- * other values: if any retrieved column size is greater than the tsCompressColData, all data will be compressed.
+ * other values: all data are compressed
  */
 int32_t tsCompressColData = -1;
 
@@ -166,6 +166,9 @@ int32_t tsMinSlidingTime = 1;
 // the maxinum number of distict query result
 int32_t tsMaxNumOfDistinctResults = 1000 * 10000;
 
+// the t-digest compression of percentile on the groups too large to be kept exactly
+int32_t tsPercentileCompression = 300;
+
 // 1 database precision unit for interval time range, changed accordingly
 int32_t tsMinIntervalTime = 1;
 
@@ -182,7 +185,15 @@ char    tsTagFilterCache = 0;
 // positive value (in MB)
 int32_t tsQueryBufferSize = -1;
 int64_t tsQueryBufferSizeBytes = -1;
+bool    tsPagedBufCompress = true;
 int32_t tsCacheLazyLoadThreshold = 500;
+int32_t tsTsdbPageCacheSize = 16;
+int32_t tsTsdbFSetThreads = 2;
+int32_t tsTsdbFSetIoBudget = 0;
+int32_t tsTsdbRecompressLevel = 0;
+int32_t tsTsdbRecompressMaxRows = 0;
+int32_t tsExchangePrefetchDepth = 2;
+int32_t tsExchangeBufferSize = 64;
 
 int32_t  tsDiskCfgNum = 0;
 SDiskCfg tsDiskCfg[TFS_MAX_DISKS] = {0};
@@ -462,7 +473,11 @@ static int32_t taosAddServerCfg(SConfig *pCfg) {
                   CFG_SCOPE_SERVER) != 0)
     return -1;
   if (cfgAddInt32(pCfg, "countAlwaysReturnValue", tsCountAlwaysReturnValue, 0, 1, CFG_SCOPE_BOTH) != 0) return -1;
+  if (cfgAddInt32(pCfg, "percentileCompression", tsPercentileCompression, TSDB_MIN_PERCENTILE_COMPRESSION,
+                  TSDB_MAX_PERCENTILE_COMPRESSION, CFG_SCOPE_SERVER) != 0)
+    return -1;
   if (cfgAddInt32(pCfg, "queryBufferSize", tsQueryBufferSize, -1, 500000000000, CFG_SCOPE_SERVER) != 0) return -1;
+  if (cfgAddBool(pCfg, "pagedBufCompress", tsPagedBufCompress, CFG_SCOPE_SERVER) != 0) return -1;
   if (cfgAddBool(pCfg, "printAuth", tsPrintAuth, CFG_SCOPE_SERVER) != 0) return -1;
   if (cfgAddInt32(pCfg, "queryRspPolicy", tsQueryRspPolicy, 0, 1, CFG_SCOPE_SERVER) != 0) return -1;
 
@@ -576,6 +591,16 @@ static int32_t taosAddServerCfg(SConfig *pCfg) {
 
   if (cfgAddInt32(pCfg, "cacheLazyLoadThreshold", tsCacheLazyLoadThreshold, 0, 100000, CFG_SCOPE_SERVER) != 0)
     return -1;
+  if (cfgAddInt32(pCfg, "tsdbPageCacheSize", tsTsdbPageCacheSize, 0, 65536, CFG_SCOPE_SERVER) != 0) return -1;
+  if (cfgAddInt32(pCfg, "tsdbFSetThreads", tsTsdbFSetThreads, 1, 64, CFG_SCOPE_SERVER) != 0) return -1;
+  if (cfgAddInt32(pCfg, "tsdbFSetIoBudget", tsTsdbFSetIoBudget, 0, 65536, CFG_SCOPE_SERVER) != 0) return -1;
+  if (cfgAddInt32(pCfg, "tsdbRecompressLevel", tsTsdbRecompressLevel, 0, TFS_MAX_LEVEL, CFG_SCOPE_SERVER) != 0)
+    return -1;
+  if (cfgAddInt32(pCfg, "tsdbRecompressMaxRows", tsTsdbRecompressMaxRows, 0, TSDB_MAX_MAXROWS_FBLOCK,
+                  CFG_SCOPE_SERVER) != 0)
+    return -1;
+  if (cfgAddInt32(pCfg, "exchangePrefetchDepth", tsExchangePrefetchDepth, 1, 16, CFG_SCOPE_SERVER) != 0) return -1;
+  if (cfgAddInt32(pCfg, "exchangeBufferSize", tsExchangeBufferSize, 1, 65536, CFG_SCOPE_SERVER) != 0) return -1;
 
   if (cfgAddBool(pCfg, "filterScalarMode", tsFilterScalarMode, CFG_SCOPE_SERVER) != 0) return -1;
   if (cfgAddInt32(pCfg, "keepTimeOffset", tsKeepTimeOffset, 0, 23, CFG_SCOPE_SERVER) != 0) return -1;
@@ -902,8 +927,10 @@ static int32_t taosSetServerCfg(SConfig *pCfg) {
   tsMinSlidingTime = cfgGetItem(pCfg, "minSlidingTime")->i32;
   tsMinIntervalTime = cfgGetItem(pCfg, "minIntervalTime")->i32;
   tsMaxNumOfDistinctResults = cfgGetItem(pCfg, "maxNumOfDistinctRes")->i32;
+  tsPercentileCompression = cfgGetItem(pCfg, "percentileCompression")->i32;
   tsCountAlwaysReturnValue = cfgGetItem(pCfg, "countAlwaysReturnValue")->i32;
   tsQueryBufferSize = cfgGetItem(pCfg, "queryBufferSize")->i32;
+  tsPagedBufCompress = cfgGetItem(pCfg, "pagedBufCompress")->bval;
   tsPrintAuth = cfgGetItem(pCfg, "printAuth")->bval;
 
   tsNumOfRpcThreads = cfgGetItem(pCfg, "numOfRpcThreads")->i32;
@@ -972,6 +999,13 @@ static int32_t taosSetServerCfg(SConfig *pCfg) {
   }
 
   tsCacheLazyLoadThreshold = cfgGetItem(pCfg, "cacheLazyLoadThreshold")->i32;
+  tsTsdbPageCacheSize = cfgGetItem(pCfg, "tsdbPageCacheSize")->i32;
+  tsTsdbFSetThreads = cfgGetItem(pCfg, "tsdbFSetThreads")->i32;
+  tsTsdbFSetIoBudget = cfgGetItem(pCfg, "tsdbFSetIoBudget")->i32;
+  tsTsdbRecompressLevel = cfgGetItem(pCfg, "tsdbRecompressLevel")->i32;
+  tsTsdbRecompressMaxRows = cfgGetItem(pCfg, "tsdbRecompressMaxRows")->i32;
+  tsExchangePrefetchDepth = cfgGetItem(pCfg, "exchangePrefetchDepth")->i32;
+  tsExchangeBufferSize = cfgGetItem(pCfg, "exchangeBufferSize")->i32;
 
   tsDisableStream = cfgGetItem(pCfg, "disableStream")->bval;
   tsStreamBufferSize = cfgGetItem(pCfg, "streamBufferSize")->i64;
@@ -1235,6 +1269,8 @@ int32_t taosApplyLocalCfg(SConfig *pCfg, char *name) {
     case 'p': {
       if (strcasecmp("printAuth", name) == 0) {
         tsPrintAuth = cfgGetItem(pCfg, "printAuth")->bval;
+      } else if (strcasecmp("pagedBufCompress", name) == 0) {
+        tsPagedBufCompress = cfgGetItem(pCfg, "pagedBufCompress")->bval;
       }
       break;
     }
@@ -260,4 +260,115 @@ TEST(testCase, var_dataBlock_split_test) {
   }
 }
 
+TEST(testCase, compressed_dataBlock_encode_test) {
+  int32_t numOfRows = 4096;
+
+  SSDataBlock* b = createDataBlock();
+
+  SColumnInfoData infoData = createColumnInfoData(TSDB_DATA_TYPE_TIMESTAMP, 8, 1);
+  blockDataAppendColInfo(b, &infoData);
+
+  SColumnInfoData infoData1 = createColumnInfoData(TSDB_DATA_TYPE_DOUBLE, 8, 2);
+  blockDataAppendColInfo(b, &infoData1);
+
+  SColumnInfoData infoData2 = createColumnInfoData(TSDB_DATA_TYPE_BINARY, 40, 3);
+  blockDataAppendColInfo(b, &infoData2);
+
+  blockDataEnsureCapacity(b, numOfRows);
+
+  char buf[41] = {0};
+  for (int32_t i = 0; i < numOfRows; ++i) {
+    SColumnInfoData* p0 = (SColumnInfoData*)taosArrayGet(b->pDataBlock, 0);
+    SColumnInfoData* p1 = (SColumnInfoData*)taosArrayGet(b->pDataBlock, 1);
+    SColumnInfoData* p2 = (SColumnInfoData*)taosArrayGet(b->pDataBlock, 2);
+
+    int64_t ts = 1700000000000 + i * 1000;
+    double  v = 20.5 + (i % 16) * 0.25;
+    colDataSetVal(p0, i, (const char*)&ts, false);
+    colDataSetVal(p1, i, (const char*)&v, (i % 7) == 0);
+
+    int32_t len = sprintf(varDataVal(buf), "device_%d", i % 10);
+    varDataSetLen(buf, len);
+    colDataSetVal(p2, i, buf, (i % 5) == 0);
+    b->info.rows++;
+  }
+
+  int32_t numOfCols = taosArrayGetSize(b->pDataBlock);
+  char*   pEncode = (char*)taosMemoryMalloc(blockGetEncodeSize(b));
+  int32_t len = blockEncode(b, pEncode, numOfCols);
+  ASSERT_FALSE(blockIsCompressed(pEncode));
+
+  char*   pCompress = (char*)taosMemoryMalloc(blockGetCompressBufSize(pEncode));
+  int32_t cmprLen = blockCompressEncodeBuf(pEncode, pCompress);
+  ASSERT_GT(cmprLen, 0);
+  ASSERT_LT(cmprLen, len);
+  ASSERT_TRUE(blockIsCompressed(pCompress));
+  ASSERT_EQ(blockGetDecompressSize(pCompress), len);
+
+  char* pDecompress = (char*)taosMemoryMalloc(len);
+  ASSERT_EQ(blockDecompressEncodeBuf(pCompress, pDecompress), len);
+  ASSERT_EQ(memcmp(pEncode, pDecompress, len), 0);
+
+  SSDataBlock* pRes = createOneDataBlock(b, false);
+  ASSERT_EQ(blockDecode(pRes, pCompress), pCompress + cmprLen);
+  ASSERT_EQ(pRes->info.rows, numOfRows);
+  for (int32_t i = 0; i < numOfRows; ++i) {
+    for (int32_t j = 0; j < numOfCols; ++j) {
+      SColumnInfoData* pSrc = (SColumnInfoData*)taosArrayGet(b->pDataBlock, j);
+      SColumnInfoData* pDst = (SColumnInfoData*)taosArrayGet(pRes->pDataBlock, j);
+      ASSERT_EQ(colDataIsNull_s(pSrc, i), colDataIsNull_s(pDst, i));
+      if (colDataIsNull_s(pSrc, i)) continue;
+
+      char* p0 = colDataGetData(pSrc, i);
+      char* p1 = colDataGetData(pDst, i);
+      int32_t size = IS_VAR_DATA_TYPE(pSrc->info.type) ? varDataTLen(p0) : pSrc->info.bytes;
+      ASSERT_EQ(memcmp(p0, p1, size), 0);
+    }
+  }
+
+  taosMemoryFree(pEncode);
+  taosMemoryFree(pCompress);
+  taosMemoryFree(pDecompress);
+  blockDataDestroy(pRes);
+  blockDataDestroy(b);
+}
+
+// the block is kept as it is if the compressed one is not smaller
+TEST(testCase, compressed_dataBlock_incompressible_test) {
+  int32_t numOfRows = 8;
+
+  SSDataBlock* b = createDataBlock();
+
+  SColumnInfoData infoData = createColumnInfoData(TSDB_DATA_TYPE_BIGINT, 8, 1);
+  blockDataAppendColInfo(b, &infoData);
+  blockDataEnsureCapacity(b, numOfRows);
+
+  SColumnInfoData* p0 = (SColumnInfoData*)taosArrayGet(b->pDataBlock, 0);
+  for (int32_t i = 0; i < numOfRows; ++i) {
+    int64_t v = ((int64_t)taosRand() << 32) | taosRand();
+    colDataSetVal(p0, i, (const char*)&v, false);
+    b->info.rows++;
+  }
+
+  char*   pEncode = (char*)taosMemoryMalloc(blockGetEncodeSize(b));
+  int32_t len = blockEncode(b, pEncode, 1);
+
+  char*   pCompress = (char*)taosMemoryMalloc(blockGetCompressBufSize(pEncode));
+  int32_t cmprLen = blockCompressEncodeBuf(pEncode, pCompress);
+  ASSERT_EQ(cmprLen, len);
+  ASSERT_FALSE(blockIsCompressed(pCompress));
+  ASSERT_EQ(memcmp(pEncode, pCompress, len), 0);
+
+  SSDataBlock* pRes = createOneDataBlock(b, false);
+  ASSERT_EQ(blockDecode(pRes, pCompress), pCompress + len);
+  ASSERT_EQ(pRes->info.rows, numOfRows);
+  SColumnInfoData* p1 = (SColumnInfoData*)taosArrayGet(pRes->pDataBlock, 0);
+  ASSERT_EQ(memcmp(p0->pData, p1->pData, numOfRows * sizeof(int64_t)), 0);
+
+  taosMemoryFree(pEncode);
+  taosMemoryFree(pCompress);
+  blockDataDestroy(pRes);
+  blockDataDestroy(b);
+}
+
 #pragma GCC diagnostic pop
\ No newline at end of file
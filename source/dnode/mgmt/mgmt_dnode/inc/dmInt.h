@@ -38,6 +38,7 @@ typedef struct SDnodeMgmt {
   GetVnodeLoadsFp     getVnodeLoadsFp;
   GetMnodeLoadsFp     getMnodeLoadsFp;
   GetQnodeLoadsFp     getQnodeLoadsFp;
+  GetDiskInfosFp      getDiskInfosFp;
   int32_t             statusSeq;
 } SDnodeMgmt;
 
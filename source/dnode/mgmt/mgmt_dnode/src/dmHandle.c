@@ -213,7 +213,7 @@ int32_t dmProcessServerRunStatus(SDnodeMgmt *pMgmt, SRpcMsg *pMsg) {
   return 0;
 }
 
-SSDataBlock *dmBuildVariablesBlock(void) {
+SSDataBlock *dmBuildSysTableBlock(const char *tbName) {
   SSDataBlock         *pBlock = taosMemoryCalloc(1, sizeof(SSDataBlock));
   size_t               size = 0;
   const SSysTableMeta *pMeta = NULL;
@@ -221,7 +221,7 @@ SSDataBlock *dmBuildVariablesBlock(void) {
 
   int32_t index = 0;
   for (int32_t i = 0; i < size; ++i) {
-    if (strcmp(pMeta[i].name, TSDB_INS_TABLE_DNODE_VARIABLES) == 0) {
+    if (strcasecmp(pMeta[i].name, tbName) == 0) {
       index = i;
       break;
     }
@@ -280,6 +280,50 @@ int32_t dmAppendVariablesToBlock(SSDataBlock *pBlock, int32_t dnodeId) {
   return TSDB_CODE_SUCCESS;
 }
 
+int32_t dmAppendDisksToBlock(SDnodeMgmt *pMgmt, SSDataBlock *pBlock, int32_t dnodeId) {
+  SMonDiskInfo info = {0};
+  (*pMgmt->getDiskInfosFp)(&info);
+
+  int32_t numOfDisks = taosArrayGetSize(info.datadirs);
+  blockDataEnsureCapacity(pBlock, numOfDisks);
+
+  for (int32_t i = 0, c = 0; i < numOfDisks; ++i, c = 0) {
+    SMonDiskDesc *pDesc = taosArrayGet(info.datadirs, i);
+
+    SColumnInfoData *pColInfo = taosArrayGet(pBlock->pDataBlock, c++);
+    colDataSetVal(pColInfo, i, (const char *)&dnodeId, false);
+
+    char name[TSDB_FILENAME_LEN + VARSTR_HEADER_SIZE] = {0};
+    STR_WITH_MAXSIZE_TO_VARSTR(name, pDesc->name, TSDB_FILENAME_LEN + VARSTR_HEADER_SIZE);
+    pColInfo = taosArrayGet(pBlock->pDataBlock, c++);
+    colDataSetVal(pColInfo, i, name, false);
+
+    pColInfo = taosArrayGet(pBlock->pDataBlock, c++);
+    colDataSetVal(pColInfo, i, (const char *)&pDesc->level, false);
+    pColInfo = taosArrayGet(pBlock->pDataBlock, c++);
+    colDataSetVal(pColInfo, i, (const char *)&pDesc->size.total, false);
+    pColInfo = taosArrayGet(pBlock->pDataBlock, c++);
+    colDataSetVal(pColInfo, i, (const char *)&pDesc->size.avail, false);
+
+    SMonDiskIo *aIo[] = {&pDesc->read, &pDesc->write, &pDesc->sync};
+    for (int32_t t = 0; t < tListLen(aIo); ++t) {
+      pColInfo = taosArrayGet(pBlock->pDataBlock, c++);
+      colDataSetVal(pColInfo, i, (const char *)&aIo[t]->ops, false);
+      pColInfo = taosArrayGet(pBlock->pDataBlock, c++);
+      colDataSetVal(pColInfo, i, (const char *)&aIo[t]->bytes, false);
+      pColInfo = taosArrayGet(pBlock->pDataBlock, c++);
+      colDataSetVal(pColInfo, i, (const char *)&aIo[t]->inflightBytes, false);
+      pColInfo = taosArrayGet(pBlock->pDataBlock, c++);
+      colDataSetVal(pColInfo, i, (const char *)&aIo[t]->latency, false);
+    }
+  }
+
+  pBlock->info.rows = numOfDisks;
+  taosArrayDestroy(info.datadirs);
+
+  return TSDB_CODE_SUCCESS;
+}
+
 int32_t dmProcessRetrieve(SDnodeMgmt *pMgmt, SRpcMsg *pMsg) {
   int32_t size = 0;
   int32_t rowsRead = 0;
@@ -295,14 +339,19 @@ int32_t dmProcessRetrieve(SDnodeMgmt *pMgmt, SRpcMsg *pMsg) {
     return -1;
   }
 
-  if (strcasecmp(retrieveReq.tb, TSDB_INS_TABLE_DNODE_VARIABLES)) {
+  bool isDisks = (strcasecmp(retrieveReq.tb, TSDB_INS_TABLE_DISKS) == 0);
+  if (!isDisks && strcasecmp(retrieveReq.tb, TSDB_INS_TABLE_DNODE_VARIABLES)) {
     terrno = TSDB_CODE_INVALID_MSG;
     return -1;
   }
 
-  SSDataBlock *pBlock = dmBuildVariablesBlock();
+  SSDataBlock *pBlock = dmBuildSysTableBlock(retrieveReq.tb);
 
-  dmAppendVariablesToBlock(pBlock, pMgmt->pData->dnodeId);
+  if (isDisks) {
+    dmAppendDisksToBlock(pMgmt, pBlock, pMgmt->pData->dnodeId);
+  } else {
+    dmAppendVariablesToBlock(pBlock, pMgmt->pData->dnodeId);
+  }
 
   size_t numOfCols = taosArrayGetSize(pBlock->pDataBlock);
   size = sizeof(SRetrieveMetaTableRsp) + sizeof(int32_t) + sizeof(SSysTableSchema) * numOfCols +
@@ -85,6 +85,11 @@ void vmGetMonitorInfo(SVnodeMgmt *pMgmt, SMonVmInfo *pInfo) {
   taosArrayDestroy(pVloads);
 }
 
+void vmGetDiskInfos(SVnodeMgmt *pMgmt, SMonDiskInfo *pInfo) {
+  tfsUpdateSize(pMgmt->pTfs);
+  tfsGetMonitorInfo(pMgmt->pTfs, pInfo);
+}
+
 static void vmGenerateVnodeCfg(SCreateVnodeReq *pCreate, SVnodeCfg *pCfg) {
   memcpy(pCfg, &vnodeCfgDefault, sizeof(SVnodeCfg));
 
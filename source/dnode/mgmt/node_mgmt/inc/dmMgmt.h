@@ -119,6 +119,7 @@ void dmSendMonitorReport();
 void dmGetVnodeLoads(SMonVloadInfo *pInfo);
 void dmGetMnodeLoads(SMonMloadInfo *pInfo);
 void dmGetQnodeLoads(SQnodeLoad *pInfo);
+void dmGetDiskInfos(SMonDiskInfo *pInfo);
 
 #ifdef __cplusplus
 }
@@ -15,6 +15,7 @@
 
 #define _DEFAULT_SOURCE
 #include "dmMgmt.h"
+#include "tpagedbuf.h"
 
 #define STR_CASE_CMP(s, d)   (0 == strcasecmp((s), (d)))
 #define STR_STR_CMP(s, d)    (strstr((s), (d)))
@@ -177,6 +178,7 @@ void dmCleanup() {
   udfcClose();
   udfStopUdfd();
   taosStopCacheRefreshWorker();
+  cleanupDiskbasedBufFlusher();
   dInfo("dnode env is cleaned up");
 
   taosCleanupCfg();
@@ -375,6 +377,7 @@ SMgmtInputOpt dmBuildMgmtInputOpt(SMgmtWrapper *pWrapper) {
       .getVnodeLoadsFp = dmGetVnodeLoads,
       .getMnodeLoadsFp = dmGetMnodeLoads,
       .getQnodeLoadsFp = dmGetQnodeLoads,
+      .getDiskInfosFp = dmGetDiskInfos,
   };
 
   opt.msgCb = dmGetMsgcb(pWrapper->pDnode);
@@ -140,3 +140,14 @@ void dmGetQnodeLoads(SQnodeLoad *pInfo) {
     dmReleaseWrapper(pWrapper);
   }
 }
+
+void dmGetDiskInfos(SMonDiskInfo *pInfo) {
+  SDnode       *pDnode = dmInstance();
+  SMgmtWrapper *pWrapper = &pDnode->wrappers[VNODE];
+  if (dmMarkWrapper(pWrapper) == 0) {
+    if (pWrapper->pMgmt != NULL) {
+      vmGetDiskInfos(pWrapper->pMgmt, pInfo);
+    }
+    dmReleaseWrapper(pWrapper);
+  }
+}
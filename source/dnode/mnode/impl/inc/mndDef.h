@@ -373,6 +373,11 @@ typedef struct {
   SVnodeGid vnodeGid[TSDB_MAX_REPLICA + TSDB_MAX_LEARNER_REPLICA];
   void*     pTsma;
   int32_t   numOfCachedTables;
+  int64_t   pageCacheHit;
+  int64_t   pageCacheMiss;
+  int64_t   numOfFSetJobs;
+  int64_t   numOfFSetJobsDone;
+  int64_t   fsetJobBytes;
 } SVgObj;
 
 typedef struct {
@@ -490,6 +490,11 @@ static int32_t mndProcessStatusReq(SRpcMsg *pReq) {
       if (pVload->syncState == TAOS_SYNC_STATE_LEADER) {
         pVgroup->cacheUsage = pVload->cacheUsage;
         pVgroup->numOfCachedTables = pVload->numOfCachedTables;
+        pVgroup->pageCacheHit = pVload->pageCacheHit;
+        pVgroup->pageCacheMiss = pVload->pageCacheMiss;
+        pVgroup->numOfFSetJobs = pVload->numOfFSetJobs;
+        pVgroup->numOfFSetJobsDone = pVload->numOfFSetJobsDone;
+        pVgroup->fsetJobBytes = pVload->fsetJobBytes;
         pVgroup->numOfTables = pVload->numOfTables;
         pVgroup->numOfTimeSeries = pVload->numOfTimeSeries;
         pVgroup->totalStorage = pVload->totalStorage;
@@ -992,7 +992,7 @@ TEST_F(MndTestSdb, 01_Read_Str) {
     while (sdbDoRead(pSdb, pReader, &pBuf, &len) == 0) {
       if (pBuf != NULL && len != 0) {
         sdbDoWrite(pSdb, pWritter, pBuf, len);
-        taosMemoryFree(pBuf);
+        taosMemoryFreeClear(pBuf);
       } else {
         break;
       }
@@ -584,7 +584,17 @@ void sdbStopRead(SSdb *pSdb, SSdbIter *pIter) { sdbCloseIter(pIter); }
 
 int32_t sdbDoRead(SSdb *pSdb, SSdbIter *pIter, void **ppBuf, int32_t *len) {
   int32_t maxlen = 4096;
-  void   *pBuf = taosMemoryCalloc(1, maxlen);
+  void   *pBuf = *ppBuf;
+
+  // reuse the buffer offered by the caller if it is large enough
+  if (pBuf != NULL && *len < maxlen) {
+    taosMemoryFreeClear(pBuf);
+  }
+  if (pBuf == NULL) {
+    pBuf = taosMemoryCalloc(1, maxlen);
+  }
+  *ppBuf = NULL;
+  *len = 0;
   if (pBuf == NULL) {
     terrno = TSDB_CODE_OUT_OF_MEMORY;
     return -1;
@@ -122,9 +122,9 @@ int      metaGetTableTypeByName(void *meta, char *tbName, ETableType *tbType);
 int      metaGetTableTtlByUid(void *meta, uint64_t uid, int64_t *ttlDays);
 bool     metaIsTableExist(void* pVnode, tb_uid_t uid);
 int32_t  metaGetCachedTableUidList(void *pVnode, tb_uid_t suid, const uint8_t *key, int32_t keyLen, SArray *pList,
-                                   bool *acquired);
+                                   SArray *pChanged, int64_t *pVer, bool *acquired);
 int32_t  metaUidFilterCachePut(void *pVnode, uint64_t suid, const void *pKey, int32_t keyLen, void *pPayload,
-                               int32_t payloadLen, double selectivityRatio);
+                               int32_t payloadLen, double selectivityRatio, int64_t ver);
 tb_uid_t metaGetTableEntryUidByName(SMeta *pMeta, const char *name);
 int32_t  metaGetCachedTbGroup(void *pVnode, tb_uid_t suid, const uint8_t *pKey, int32_t keyLen, SArray **pList);
 int32_t  metaPutTbGroupToCache(void* pVnode, uint64_t suid, const void *pKey, int32_t keyLen, void *pPayload,
@@ -201,6 +201,7 @@ void    tsdbCacheSetCapacity(SVnode *pVnode, size_t capacity);
 size_t  tsdbCacheGetCapacity(SVnode *pVnode);
 size_t  tsdbCacheGetUsage(SVnode *pVnode);
 int32_t tsdbCacheGetElems(SVnode *pVnode);
+void    tsdbCacheGetPageStat(SVnode *pVnode, int64_t *hit, int64_t *miss);
 
 //// tq
 typedef struct SIdInfo {
@@ -208,9 +209,14 @@ typedef struct SIdInfo {
   int32_t index;
 } SIdInfo;
 
+typedef struct STqSubmitCache STqSubmitCache;
+typedef struct STqSubmitEntry STqSubmitEntry;
+
 typedef struct STqReader {
   SPackedData     msg;
   SSubmitReq2     submit;
+  STqSubmitCache *pSubmitCache;
+  STqSubmitEntry *pSubmitEntry;  // the submit is borrowed from the shared cache if not NULL
   int32_t         nextBlk;
   int64_t         lastBlkUid;
   SWalReader     *pWalReader;
@@ -242,7 +248,8 @@ SWalReader* tqGetWalReader(STqReader* pReader);
 SSDataBlock* tqGetResultBlock (STqReader* pReader);
 
 int32_t extractMsgFromWal(SWalReader *pReader, void **pItem, int64_t maxVer, const char *id);
-int32_t tqReaderSetSubmitMsg(STqReader *pReader, void *msgStr, int32_t msgLen, int64_t ver);
+int32_t tqReaderSetSubmitMsg(STqReader *pReader, void *msgStr, int32_t msgLen, int64_t ver, int64_t term,
+                             uint32_t cksum);
 bool    tqNextDataBlockFilterOut(STqReader *pReader, SHashObj *filterOutUids);
 int32_t tqRetrieveDataBlock(STqReader *pReader, SSDataBlock** pRes, const char* idstr);
 int32_t tqRetrieveTaosxBlock(STqReader *pReader, SArray *blocks, SArray *schemas, SSubmitTbData **pSubmitTbDataRet);
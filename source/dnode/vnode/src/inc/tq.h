@@ -94,6 +94,31 @@ typedef struct {
   tq_handle_status        status;
 } STqHandle;
 
+// decoded submit msg shared by all readers of the same vnode, keyed by the wal version. An entry is identified by the
+// term and the body checksum of its wal head as well, since the version is reused after the wal is rolled back.
+#define TQ_SUBMIT_CACHE_SIZE (32 * 1024 * 1024)
+
+struct STqSubmitEntry {
+  int64_t     ver;
+  int64_t     term;
+  uint32_t    cksum;
+  int32_t     ref;
+  int32_t     msgLen;
+  int64_t     size;  // bytes of the msg and the decoded submit, charged to the cache
+  bool        evicted;
+  void*       msgStr;  // copy of the msg, the decoded submit refers to it
+  SSubmitReq2 submit;
+  SListNode*  pNode;   // node in the eviction queue
+};
+
+struct STqSubmitCache {
+  TdThreadMutex lock;
+  SHashObj*     pEntries;  // ver -> STqSubmitEntry*
+  SList*        pQueue;    // STqSubmitEntry*, in the order of insertion
+  int64_t       size;
+  int64_t       capacity;
+};
+
 struct STQ {
   SVnode*         pVnode;
   char*           path;
@@ -129,6 +154,13 @@ int32_t tqScanTaosx(STQ* pTq, const STqHandle* pHandle, STaosxRsp* pRsp, SMqMeta
 int32_t tqScanData(STQ* pTq, const STqHandle* pHandle, SMqDataRsp* pRsp, STqOffsetVal* pOffset);
 int32_t tqFetchLog(STQ* pTq, STqHandle* pHandle, int64_t* fetchOffset, uint64_t reqId);
 
+STqSubmitCache* tqSubmitCacheOpen(int64_t capacity);
+void            tqSubmitCacheClose(STqSubmitCache* pCache);
+STqSubmitEntry* tqSubmitCacheGet(STqSubmitCache* pCache, int64_t ver, int64_t term, uint32_t cksum);
+int32_t tqSubmitCachePut(STqSubmitCache* pCache, void* msgStr, int32_t msgLen, int64_t ver, int64_t term, uint32_t cksum,
+                         STqSubmitEntry** ppEntry);
+void    tqSubmitCacheRelease(STqSubmitCache* pCache, STqSubmitEntry* pEntry);
+
 // tqExec
 int32_t tqTaosxScanLog(STQ* pTq, STqHandle* pHandle, SPackedData submit, STaosxRsp* pRsp, int32_t* totalRows);
 int32_t tqAddBlockDataToRsp(const SSDataBlock* pBlock, SMqDataRsp* pRsp, int32_t numOfCols, int8_t precision);
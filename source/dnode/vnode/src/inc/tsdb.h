@@ -380,6 +380,11 @@ struct STsdb {
   TdThreadMutex        lruMutex;
   SLRUCache           *biCache;
   TdThreadMutex        biMutex;
+  SLRUCache           *pgCache;
+  TdThreadMutex        pgMutex;
+  int64_t              pgCacheVer;  // bumped by every page drop, a page read before a drop is not cached
+  int64_t              pgCacheHit;
+  int64_t              pgCacheMiss;
   struct STFileSystem *pFS;  // new
   SRocksCache          rCache;
 };
@@ -408,6 +413,14 @@ typedef struct SMemSkipList {
   SMemSkipListNode *pTail;
 } SMemSkipList;
 
+// a column format submit block appended in order, all its keys are greater than the keys already in the table
+typedef struct SMemChunk SMemChunk;
+struct SMemChunk {
+  SBlockData *pBlockData;
+  SMemChunk  *next;
+  SMemChunk  *prev;
+};
+
 struct STbData {
   tb_uid_t     suid;
   tb_uid_t     uid;
@@ -415,7 +428,10 @@ struct STbData {
   TSKEY        maxKey;
   SDelData    *pHead;
   SDelData    *pTail;
-  SMemSkipList sl;
+  SMemSkipList sl;  // rows not in order, merged with the chunks on read
+  SMemChunk   *pChunkHead;
+  SMemChunk   *pChunkTail;
+  int64_t      nChunkRow;
   STbData     *next;
   SRBTreeNode  rbtn[1];
 };
@@ -547,6 +563,9 @@ struct STbDataIter {
   STbData          *pTbData;
   int8_t            backward;
   SMemSkipListNode *pNode;
+  SMemChunk        *pChunk;  // NULL if the chunks are exhausted
+  int32_t           iChunkRow;
+  int8_t            fromChunk;  // pRow is read from pChunk
   TSDBROW          *pRow;
   TSDBROW           row;
 };
@@ -650,6 +669,9 @@ typedef struct {
   int64_t   pgno;
   uint8_t  *pBuf;
   int64_t   szFile;
+  STsdb    *pTsdb;
+  SDiskID   did;         // disk the file lives on, for io accounting
+  int64_t   szUnsynced;  // bytes written since the last fsync
 } STsdbFD;
 
 struct SDelFWriter {
@@ -861,6 +883,10 @@ int32_t tsdbCacheRelease(SLRUCache *pCache, LRUHandle *h);
 int32_t tsdbCacheGetBlockIdx(SLRUCache *pCache, SDataFReader *pFileReader, LRUHandle **handle);
 int32_t tsdbBICacheRelease(SLRUCache *pCache, LRUHandle *h);
 
+bool tsdbCacheGetPage(STsdb *pTsdb, const char *path, int64_t pgno, uint8_t *pBuf, int32_t szPage, int64_t *ver);
+void tsdbCachePutPage(STsdb *pTsdb, const char *path, int64_t pgno, const uint8_t *pBuf, int32_t szPage, int64_t ver);
+void tsdbCacheDelPages(STsdb *pTsdb, const char *path, int32_t szPage, int64_t pgnoFrom, int64_t pgnoTo);
+
 int32_t tsdbCacheDeleteLastrow(SLRUCache *pCache, tb_uid_t uid, TSKEY eKey);
 int32_t tsdbCacheDeleteLast(SLRUCache *pCache, tb_uid_t uid, TSKEY eKey);
 int32_t tsdbCacheDelete(SLRUCache *pCache, tb_uid_t uid, TSKEY eKey);
@@ -895,23 +921,44 @@ static FORCE_INLINE TSDBROW *tsdbTbDataIterGet(STbDataIter *pIter) {
     return pIter->pRow;
   }
 
+  bool hasNode;
   if (pIter->backward) {
-    if (pIter->pNode == pIter->pTbData->sl.pHead) {
-      return NULL;
-    }
+    hasNode = (pIter->pNode != pIter->pTbData->sl.pHead);
   } else {
-    if (pIter->pNode == pIter->pTbData->sl.pTail) {
-      return NULL;
-    }
+    hasNode = (pIter->pNode != pIter->pTbData->sl.pTail);
+  }
+
+  if (!hasNode && pIter->pChunk == NULL) {
+    return NULL;
   }
 
   pIter->pRow = &pIter->row;
-  if (pIter->pNode->flag == TSDBROW_ROW_FMT) {
-    pIter->row = tsdbRowFromTSRow(pIter->pNode->version, pIter->pNode->pData);
-  } else if (pIter->pNode->flag == TSDBROW_COL_FMT) {
-    pIter->row = tsdbRowFromBlockData(pIter->pNode->pData, pIter->pNode->iRow);
-  } else {
-    ASSERT(0);
+  if (hasNode) {
+    if (pIter->pNode->flag == TSDBROW_ROW_FMT) {
+      pIter->row = tsdbRowFromTSRow(pIter->pNode->version, pIter->pNode->pData);
+    } else if (pIter->pNode->flag == TSDBROW_COL_FMT) {
+      pIter->row = tsdbRowFromBlockData(pIter->pNode->pData, pIter->pNode->iRow);
+    } else {
+      ASSERT(0);
+    }
+  }
+
+  // merge the rows from the chunks and the skiplist by key
+  pIter->fromChunk = 0;
+  if (pIter->pChunk) {
+    TSDBROW cRow = tsdbRowFromBlockData(pIter->pChunk->pBlockData, pIter->iChunkRow);
+    if (hasNode) {
+      TSDBKEY cKey = TSDBROW_KEY(&cRow);
+      TSDBKEY nKey = TSDBROW_KEY(&pIter->row);
+      int32_t c = tsdbKeyCmprFn(&cKey, &nKey);
+      pIter->fromChunk = pIter->backward ? (c > 0) : (c <= 0);
+    } else {
+      pIter->fromChunk = 1;
+    }
+
+    if (pIter->fromChunk) {
+      pIter->row = cRow;
+    }
   }
 
   return pIter->pRow;
@@ -51,6 +51,7 @@ int32_t vnodeDecodeConfig(const SJson* pJson, void* pObj);
 // vnodeModule.c
 int vnodeScheduleTask(int (*execute)(void*), void* arg);
 int vnodeScheduleTaskEx(int tpid, int (*execute)(void*), void* arg);
+int vnodeScheduleThreads(int tpid);
 
 // vnodeBufPool.c
 typedef struct SVBufPoolNode SVBufPoolNode;
@@ -161,6 +161,7 @@ int             metaGetTableEntryByName(SMetaReader* pReader, const char* name);
 int             metaAlterCache(SMeta* pMeta, int32_t nPage);
 
 int32_t metaUidCacheClear(SMeta* pMeta, uint64_t suid);
+int32_t metaUidCacheUpdate(SMeta* pMeta, uint64_t suid, tb_uid_t uid);
 int32_t metaTbGroupCacheClear(SMeta* pMeta, uint64_t suid);
 
 int metaAddIndexToSTable(SMeta* pMeta, int64_t version, SVCreateStbReq* pReq);
@@ -351,6 +352,9 @@ struct SVStatis {
   int64_t nInsertSuccess;       // delta
   int64_t nBatchInsert;         // delta
   int64_t nBatchInsertSuccess;  // delta
+  int64_t nFSetJobs;            // file sets scheduled to commit or merge, but not failed
+  int64_t nFSetJobsDone;        // file sets committed or merged
+  int64_t nFSetJobBytes;        // bytes written by committing and merging file sets
 };
 
 struct SVnodeInfo {
@@ -405,6 +409,7 @@ struct SVnode {
   STsdb*        pTsdb;
   SWal*         pWal;
   STQ*          pTq;
+  STqSubmitCache* pSubmitCache;
   SSink*        pSink;
   tsem_t        canCommit;
   int64_t       sync;
@@ -14,9 +14,12 @@
  */
 #include "meta.h"
 
-#define TAG_FILTER_RES_KEY_LEN  32
-#define META_CACHE_BASE_BUCKET  1024
-#define META_CACHE_STATS_BUCKET 16
+#define TAG_FILTER_RES_KEY_LEN     32
+#define TAG_FILTER_RES_MAX_CHANGES 4096
+#define TAG_FILTER_RES_FILE        "tagfilter.cache"
+#define TAG_FILTER_RES_FILE_VER    1
+#define META_CACHE_BASE_BUCKET     1024
+#define META_CACHE_STATS_BUCKET    16
 
 // (uid , suid) : child table
 // (uid,     0) : normal table
@@ -35,8 +38,17 @@ typedef struct SMetaStbStatsEntry {
 typedef struct STagFilterResEntry {
   SList    list;      // the linked list of md5 digest, extracted from the serialized tag query condition
   uint32_t hitTimes;  // queried times for current super table
+  int64_t  ver;       // number of child table changes, and clears, of current super table since the entry is created
+  SArray*  pChanged;  // uid of the recently created, altered or dropped child tables, the last one is of version ver
 } STagFilterResEntry;
 
+// the item in the linked list of tag filter result cache, the cached uid list has applied all child table changes
+// no later than ver
+typedef struct STagFilterResKey {
+  uint64_t digest[2];
+  int64_t  ver;
+} STagFilterResKey;
+
 struct SMetaCache {
   // child, normal, super, table entry cache
   struct SEntryCache {
@@ -72,6 +84,10 @@ struct SMetaCache {
   } STbFilterCache;
 };
 
+static int32_t addNewEntry(SHashObj* pTableEntry, const void* pKey, int32_t keyLen, uint64_t suid);
+static void    uidFilterCacheSave(SMeta* pMeta);
+static void    uidFilterCacheLoad(SMeta* pMeta);
+
 static void entryCacheClose(SMeta* pMeta) {
   if (pMeta->pCache) {
     // close entry cache
@@ -105,6 +121,7 @@ static void statsCacheClose(SMeta* pMeta) {
 static void freeCacheEntryFp(void* param) {
   STagFilterResEntry** p = param;
   tdListEmpty(&(*p)->list);
+  taosArrayDestroy((*p)->pChanged);
   taosMemoryFreeClear(*p);
 }
 
@@ -179,6 +196,7 @@ int32_t metaCacheOpen(SMeta* pMeta) {
   }
 
   pMeta->pCache = pCache;
+  uidFilterCacheLoad(pMeta);
   return code;
 
 _err2:
@@ -192,6 +210,7 @@ _err:
 
 void metaCacheClose(SMeta* pMeta) {
   if (pMeta->pCache) {
+    uidFilterCacheSave(pMeta);
     entryCacheClose(pMeta);
     statsCacheClose(pMeta);
 
@@ -509,8 +528,27 @@ static void initCacheKey(uint64_t* buf, const SHashObj* pHashMap, uint64_t suid,
   ASSERT(keyLen == sizeof(uint64_t) * 2);
 }
 
+static SListNode* findTagFilterResKey(STagFilterResEntry* pEntry, const uint64_t* pDigest) {
+  SListIter iter = {0};
+  tdListInitIter(&pEntry->list, &iter, TD_LIST_FORWARD);
+
+  SListNode* pNode = NULL;
+  while ((pNode = tdListNext(&iter)) != NULL) {
+    STagFilterResKey* pResKey = (STagFilterResKey*)pNode->data;
+    if (pResKey->digest[0] == pDigest[0] && pResKey->digest[1] == pDigest[1]) {
+      return pNode;
+    }
+  }
+
+  return NULL;
+}
+
+// the uid list is returned together with the uid of child tables that are created, altered or dropped after the
+// result is cached, the caller should check these tables against the filter again. The version of the child table
+// changes at the time of the lookup is returned in pVer whether the result is found or not, the result the caller
+// puts back into the cache should be tagged with it.
 int32_t metaGetCachedTableUidList(void* pVnode, tb_uid_t suid, const uint8_t* pKey, int32_t keyLen, SArray* pList1,
-                                  bool* acquireRes) {
+                                  SArray* pChanged, int64_t* pVer, bool* acquireRes) {
   SMeta*  pMeta = ((SVnode*)pVnode)->pMeta;
   int32_t vgId = TD_VID(pMeta->pVnode);
 
@@ -520,23 +558,37 @@ int32_t metaGetCachedTableUidList(void* pVnode, tb_uid_t suid, const uint8_t* pK
   TdThreadMutex* pLock = &pMeta->pCache->sTagFilterResCache.lock;
 
   *acquireRes = 0;
+  *pVer = 0;
   uint64_t key[4];
   initCacheKey(key, pTableMap, suid, (const char*)pKey, keyLen);
 
   taosThreadMutexLock(pLock);
   pMeta->pCache->sTagFilterResCache.accTimes += 1;
 
+  // the entry records the child table changes from now on, for the result the caller is about to put
+  STagFilterResEntry** pEntry = taosHashGet(pTableMap, &suid, sizeof(uint64_t));
+  if (NULL == pEntry) {
+    int32_t code = addNewEntry(pTableMap, NULL, sizeof(STagFilterResKey), suid);
+    taosThreadMutexUnlock(pLock);
+    return code;
+  }
+
+  *pVer = (*pEntry)->ver;
+
   LRUHandle* pHandle = taosLRUCacheLookup(pCache, key, TAG_FILTER_RES_KEY_LEN);
   if (pHandle == NULL) {
     taosThreadMutexUnlock(pLock);
     return TSDB_CODE_SUCCESS;
   }
 
-  // do some book mark work after acquiring the filter result from cache
-  STagFilterResEntry** pEntry = taosHashGet(pTableMap, &suid, sizeof(uint64_t));
-  if (NULL == pEntry) {
-    metaError("meta/cache: pEntry should not be NULL.");
-    return TSDB_CODE_FAILED;
+  SListNode* pNode = findTagFilterResKey(*pEntry, (const uint64_t*)pKey);
+  int64_t    base = (*pEntry)->ver - (int64_t)taosArrayGetSize((*pEntry)->pChanged);
+  if (pNode == NULL || ((STagFilterResKey*)pNode->data)->ver < base) {
+    // the changes since the result was cached have been discarded, it can not be brought up to date anymore
+    taosLRUCacheRelease(pCache, pHandle, false);
+    taosLRUCacheErase(pCache, key, TAG_FILTER_RES_KEY_LEN);
+    taosThreadMutexUnlock(pLock);
+    return TSDB_CODE_SUCCESS;
   }
 
   *acquireRes = 1;
@@ -547,6 +599,12 @@ int32_t metaGetCachedTableUidList(void* pVnode, tb_uid_t suid, const uint8_t* pK
   // set the result into the buffer
   taosArrayAddBatch(pList1, p + sizeof(int32_t), size);
 
+  int64_t start = ((STagFilterResKey*)pNode->data)->ver - base;
+  int32_t numOfChanged = (int32_t)(taosArrayGetSize((*pEntry)->pChanged) - start);
+  if (pChanged != NULL && numOfChanged > 0) {
+    taosArrayAddBatch(pChanged, taosArrayGet((*pEntry)->pChanged, start), numOfChanged);
+  }
+
   (*pEntry)->hitTimes += 1;
 
   uint32_t acc = pMeta->pCache->sTagFilterResCache.accTimes;
@@ -609,15 +667,86 @@ static int32_t addNewEntry(SHashObj* pTableEntry, const void* pKey, int32_t keyL
   }
 
   p->hitTimes = 0;
+  p->ver = 0;
+  p->pChanged = NULL;
   tdListInit(&p->list, keyLen);
   taosHashPut(pTableEntry, &suid, sizeof(uint64_t), &p, POINTER_BYTES);
-  tdListAppend(&p->list, pKey);
+  if (pKey != NULL) {
+    tdListAppend(&p->list, pKey);
+  }
   return 0;
 }
 
+// discard the child table changes that have been applied to all cached results of current super table
+static void trimTagFilterResChanges(STagFilterResEntry* pEntry) {
+  int32_t size = (int32_t)taosArrayGetSize(pEntry->pChanged);
+  if (size == 0) {
+    return;
+  }
+
+  int64_t   minVer = pEntry->ver;
+  SListIter iter = {0};
+  tdListInitIter(&pEntry->list, &iter, TD_LIST_FORWARD);
+
+  SListNode* pNode = NULL;
+  while ((pNode = tdListNext(&iter)) != NULL) {
+    minVer = TMIN(minVer, ((STagFilterResKey*)pNode->data)->ver);
+  }
+
+  int64_t base = pEntry->ver - size;
+  if (minVer > base) {
+    taosArrayPopFrontBatch(pEntry->pChanged, minVer - base);
+  }
+}
+
+// the result has applied all child table changes up to ver. It is dropped if the changes after ver have been discarded
+// in between, since it can not be brought up to date anymore. The lock of tag filter result cache should be held by
+// the caller.
+static int32_t uidFilterCacheInsert(SMeta* pMeta, uint64_t suid, const void* pKey, int32_t keyLen, void* pPayload,
+                                    int32_t payloadLen, int64_t ver) {
+  SLRUCache* pCache = pMeta->pCache->sTagFilterResCache.pUidResCache;
+  SHashObj*  pTableEntry = pMeta->pCache->sTagFilterResCache.pTableEntry;
+
+  uint64_t key[4] = {0};
+  initCacheKey(key, pTableEntry, suid, pKey, keyLen);
+
+  STagFilterResKey resKey = {.ver = ver};
+  memcpy(resKey.digest, pKey, sizeof(resKey.digest));
+
+  STagFilterResEntry** pEntry = taosHashGet(pTableEntry, &suid, sizeof(uint64_t));
+  if (pEntry == NULL) {
+    int32_t code = addNewEntry(pTableEntry, NULL, sizeof(resKey), suid);
+    if (code != TSDB_CODE_SUCCESS) {
+      taosMemoryFree(pPayload);
+      return code;
+    }
+    pEntry = taosHashGet(pTableEntry, &suid, sizeof(uint64_t));
+  }
+
+  if (ver < (*pEntry)->ver - (int64_t)taosArrayGetSize((*pEntry)->pChanged)) {
+    metaDebug("vgId:%d, suid:%" PRIu64 " uid list of version %" PRId64 " expired, current version %" PRId64,
+              TD_VID(pMeta->pVnode), suid, ver, (*pEntry)->ver);
+    taosMemoryFree(pPayload);
+    return TSDB_CODE_SUCCESS;
+  }
+
+  // replace the existed one, of which the item in the linked list is removed in freeUidCachePayload
+  if (findTagFilterResKey(*pEntry, pKey) != NULL) {
+    taosLRUCacheErase(pCache, key, TAG_FILTER_RES_KEY_LEN);
+  }
+
+  tdListAppend(&(*pEntry)->list, &resKey);
+  trimTagFilterResChanges(*pEntry);
+
+  // add to cache.
+  taosLRUCacheInsert(pCache, key, TAG_FILTER_RES_KEY_LEN, pPayload, payloadLen, freeUidCachePayload, NULL,
+                     TAOS_LRU_PRIORITY_LOW, NULL);
+  return TSDB_CODE_SUCCESS;
+}
+
 // check both the payload size and selectivity ratio
 int32_t metaUidFilterCachePut(void* pVnode, uint64_t suid, const void* pKey, int32_t keyLen, void* pPayload,
-                              int32_t payloadLen, double selectivityRatio) {
+                              int32_t payloadLen, double selectivityRatio, int64_t ver) {
   int32_t code = 0;
   SMeta*  pMeta = ((SVnode*)pVnode)->pMeta;
   int32_t vgId = TD_VID(pMeta->pVnode);
@@ -642,38 +771,10 @@ int32_t metaUidFilterCachePut(void* pVnode, uint64_t suid, const void* pKey, int
   SHashObj*      pTableEntry = pMeta->pCache->sTagFilterResCache.pTableEntry;
   TdThreadMutex* pLock = &pMeta->pCache->sTagFilterResCache.lock;
 
-  uint64_t key[4] = {0};
-  initCacheKey(key, pTableEntry, suid, pKey, keyLen);
-
   taosThreadMutexLock(pLock);
-  STagFilterResEntry** pEntry = taosHashGet(pTableEntry, &suid, sizeof(uint64_t));
-  if (pEntry == NULL) {
-    code = addNewEntry(pTableEntry, pKey, keyLen, suid);
-    if (code != TSDB_CODE_SUCCESS) {
-      goto _end;
-    }
-  } else {  // check if it exists or not
-    size_t size = listNEles(&(*pEntry)->list);
-    if (size == 0) {
-      tdListAppend(&(*pEntry)->list, pKey);
-    } else {
-      SListNode* pNode = listHead(&(*pEntry)->list);
-      uint64_t*  p = (uint64_t*)pNode->data;
-      if (p[1] == ((uint64_t*)pKey)[1] && p[0] == ((uint64_t*)pKey)[0]) {
-        // we have already found the existed items, no need to added to cache anymore.
-        taosThreadMutexUnlock(pLock);
-        return TSDB_CODE_SUCCESS;
-      } else {  // not equal, append it
-        tdListAppend(&(*pEntry)->list, pKey);
-      }
-    }
-  }
-
-  // add to cache.
-  taosLRUCacheInsert(pCache, key, TAG_FILTER_RES_KEY_LEN, pPayload, payloadLen, freeUidCachePayload, NULL,
-                     TAOS_LRU_PRIORITY_LOW, NULL);
-_end:
+  code = uidFilterCacheInsert(pMeta, suid, pKey, keyLen, pPayload, payloadLen, ver);
   taosThreadMutexUnlock(pLock);
+
   metaDebug("vgId:%d, suid:%" PRIu64 " list cache added into cache, total:%d, tables:%d", vgId, suid,
             (int32_t)taosLRUCacheGetUsage(pCache), taosHashGetSize(pTableEntry));
 
@@ -693,7 +794,15 @@ int32_t metaUidCacheClear(SMeta* pMeta, uint64_t suid) {
   taosThreadMutexLock(pLock);
 
   STagFilterResEntry** pEntry = taosHashGet(pEntryHashMap, &suid, sizeof(uint64_t));
-  if (pEntry == NULL || listNEles(&(*pEntry)->list) == 0) {
+  if (pEntry == NULL) {
+    taosThreadMutexUnlock(pLock);
+    return TSDB_CODE_SUCCESS;
+  }
+
+  // the results being evaluated by the queries in progress are expired too
+  (*pEntry)->ver += 1;
+  taosArrayClear((*pEntry)->pChanged);
+  if (listNEles(&(*pEntry)->list) == 0) {
     taosThreadMutexUnlock(pLock);
     return TSDB_CODE_SUCCESS;
   }
@@ -716,6 +825,47 @@ int32_t metaUidCacheClear(SMeta* pMeta, uint64_t suid) {
   return TSDB_CODE_SUCCESS;
 }
 
+// record the child table that is created, altered or dropped, instead of clearing all the cached results of the super
+// table. The cached results are brought up to date by the next query that acquires them.
+int32_t metaUidCacheUpdate(SMeta* pMeta, uint64_t suid, tb_uid_t uid) {
+  int32_t   vgId = TD_VID(pMeta->pVnode);
+  SHashObj* pEntryHashMap = pMeta->pCache->sTagFilterResCache.pTableEntry;
+
+  TdThreadMutex* pLock = &pMeta->pCache->sTagFilterResCache.lock;
+  taosThreadMutexLock(pLock);
+
+  STagFilterResEntry** pEntry = taosHashGet(pEntryHashMap, &suid, sizeof(uint64_t));
+  if (pEntry == NULL) {  // never queried, nothing to record
+    taosThreadMutexUnlock(pLock);
+    return TSDB_CODE_SUCCESS;
+  }
+
+  // no cached results to apply the change to, only the results being evaluated are expired
+  if (listNEles(&(*pEntry)->list) == 0) {
+    (*pEntry)->ver += 1;
+    taosArrayClear((*pEntry)->pChanged);
+    taosThreadMutexUnlock(pLock);
+    return TSDB_CODE_SUCCESS;
+  }
+
+  if ((*pEntry)->pChanged == NULL) {
+    (*pEntry)->pChanged = taosArrayInit(16, sizeof(tb_uid_t));
+  }
+
+  // too many changes to apply, it is cheaper to evaluate the tag filter condition again
+  if ((*pEntry)->pChanged == NULL || taosArrayGetSize((*pEntry)->pChanged) >= TAG_FILTER_RES_MAX_CHANGES) {
+    taosThreadMutexUnlock(pLock);
+    metaDebug("vgId:%d suid:%" PRId64 " too many child table changes, clear cached tag filter uid list", vgId, suid);
+    return metaUidCacheClear(pMeta, suid);
+  }
+
+  taosArrayPush((*pEntry)->pChanged, &uid);
+  (*pEntry)->ver += 1;
+
+  taosThreadMutexUnlock(pLock);
+  return TSDB_CODE_SUCCESS;
+}
+
 int32_t metaGetCachedTbGroup(void* pVnode, tb_uid_t suid, const uint8_t* pKey, int32_t keyLen, SArray** pList) {
   SMeta*  pMeta = ((SVnode*)pVnode)->pMeta;
   int32_t vgId = TD_VID(pMeta->pVnode);
@@ -919,4 +1069,234 @@ int32_t metaSizeOfTbFilterCache(void* pVnode, int8_t type) {
     return taosHashGetSize(pMeta->pCache->STbFilterCache.pStb);
   }
   return 0;
-}
\ No newline at end of file
+}
+
+static void uidFilterCacheFileName(SMeta* pMeta, char* fname) {
+  snprintf(fname, TSDB_FILENAME_LEN, "%s%s%s", pMeta->path, TD_DIRSEP, TAG_FILTER_RES_FILE);
+}
+
+// the format of file:
+// version(4bytes) + committed version of vnode(8bytes) + number of items(4bytes) + items + checksum
+// item: suid(8bytes) + MD5 digest(16bytes) + payload length(4bytes) + payload
+static int32_t uidFilterCacheToBinary(SMeta* pMeta, uint8_t* p) {
+  SLRUCache* pCache = pMeta->pCache->sTagFilterResCache.pUidResCache;
+  SHashObj*  pTableEntry = pMeta->pCache->sTagFilterResCache.pTableEntry;
+  void*      buf = p;
+  int32_t    n = 0;
+  int32_t    numOfItems = 0;
+
+  n += taosEncodeFixedI32(p ? &buf : NULL, TAG_FILTER_RES_FILE_VER);
+  n += taosEncodeFixedI64(p ? &buf : NULL, pMeta->pVnode->state.committed);
+  void* pNumOfItems = buf;
+  n += taosEncodeFixedI32(p ? &buf : NULL, numOfItems);
+
+  void* pIter = taosHashIterate(pTableEntry, NULL);
+  while (pIter != NULL) {
+    STagFilterResEntry* pEntry = *(STagFilterResEntry**)pIter;
+    uint64_t            suid = *(uint64_t*)taosHashGetKey(pIter, NULL);
+
+    SListIter iter = {0};
+    tdListInitIter(&pEntry->list, &iter, TD_LIST_FORWARD);
+
+    SListNode* pNode = NULL;
+    while ((pNode = tdListNext(&iter)) != NULL) {
+      // the results that have not applied all child table changes yet are not kept
+      STagFilterResKey* pResKey = (STagFilterResKey*)pNode->data;
+      if (pResKey->ver != pEntry->ver) {
+        continue;
+      }
+
+      uint64_t key[4] = {0};
+      initCacheKey(key, pTableEntry, suid, (const char*)pResKey->digest, sizeof(pResKey->digest));
+
+      LRUHandle* pHandle = taosLRUCacheLookup(pCache, key, TAG_FILTER_RES_KEY_LEN);
+      if (pHandle == NULL) {
+        continue;
+      }
+
+      const char* pPayload = taosLRUCacheValue(pCache, pHandle);
+      int32_t     payloadLen = sizeof(int32_t) + (*(int32_t*)pPayload) * sizeof(uint64_t);
+
+      n += taosEncodeFixedU64(p ? &buf : NULL, suid);
+      n += taosEncodeFixedU64(p ? &buf : NULL, pResKey->digest[0]);
+      n += taosEncodeFixedU64(p ? &buf : NULL, pResKey->digest[1]);
+      n += taosEncodeFixedI32(p ? &buf : NULL, payloadLen);
+      n += taosEncodeBinary(p ? &buf : NULL, pPayload, payloadLen);
+      numOfItems += 1;
+
+      taosLRUCacheRelease(pCache, pHandle, false);
+    }
+
+    pIter = taosHashIterate(pTableEntry, pIter);
+  }
+
+  if (p) {
+    taosEncodeFixedI32(&pNumOfItems, numOfItems);
+  }
+
+  return numOfItems > 0 ? n : 0;
+}
+
+// keep the cached tag filter results in the meta directory, so they are still available after the vnode restarts
+static void uidFilterCacheSave(SMeta* pMeta) {
+  int32_t  code = 0;
+  uint8_t* pData = NULL;
+  char     fname[TSDB_FILENAME_LEN] = {0};
+
+  if (!tsTagFilterCache) {
+    return;
+  }
+
+  uidFilterCacheFileName(pMeta, fname);
+
+  TdThreadMutex* pLock = &pMeta->pCache->sTagFilterResCache.lock;
+  taosThreadMutexLock(pLock);
+
+  int32_t size = uidFilterCacheToBinary(pMeta, NULL);
+  if (size == 0) {
+    goto _exit;
+  }
+
+  size += sizeof(TSCKSUM);
+  pData = taosMemoryMalloc(size);
+  if (pData == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _exit;
+  }
+
+  uidFilterCacheToBinary(pMeta, pData);
+  taosCalcChecksumAppend(0, pData, size);
+
+  TdFilePtr pFD = taosOpenFile(fname, TD_FILE_WRITE | TD_FILE_CREATE | TD_FILE_TRUNC);
+  if (pFD == NULL) {
+    code = TAOS_SYSTEM_ERROR(errno);
+    goto _exit;
+  }
+
+  if (taosWriteFile(pFD, pData, size) < 0 || taosFsyncFile(pFD) < 0) {
+    code = TAOS_SYSTEM_ERROR(errno);
+    taosCloseFile(&pFD);
+    taosRemoveFile(fname);
+    goto _exit;
+  }
+
+  taosCloseFile(&pFD);
+
+_exit:
+  taosThreadMutexUnlock(pLock);
+  taosMemoryFree(pData);
+  if (code) {
+    metaWarn("vgId:%d, failed to save tag filter cache to %s since %s", TD_VID(pMeta->pVnode), fname, tstrerror(code));
+  } else if (size > 0) {
+    metaDebug("vgId:%d, tag filter cache saved to %s, size:%d", TD_VID(pMeta->pVnode), fname, size);
+  }
+}
+
+// the file is removed once loaded, since the child table changes applied after that are not recorded in it
+static void uidFilterCacheLoad(SMeta* pMeta) {
+  int32_t  code = 0;
+  int64_t  size = 0;
+  uint8_t* pData = NULL;
+  int32_t  numOfItems = 0;
+  char     fname[TSDB_FILENAME_LEN] = {0};
+
+  uidFilterCacheFileName(pMeta, fname);
+  if (!taosCheckExistFile(fname)) {
+    return;
+  }
+
+  if (!tsTagFilterCache) {
+    goto _exit;
+  }
+
+  if (taosStatFile(fname, &size, NULL) < 0 || size <= sizeof(TSCKSUM)) {
+    code = TSDB_CODE_FILE_CORRUPTED;
+    goto _exit;
+  }
+
+  pData = taosMemoryMalloc(size);
+  if (pData == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _exit;
+  }
+
+  TdFilePtr pFD = taosOpenFile(fname, TD_FILE_READ);
+  if (pFD == NULL) {
+    code = TAOS_SYSTEM_ERROR(errno);
+    goto _exit;
+  }
+
+  if (taosReadFile(pFD, pData, size) != size) {
+    code = TSDB_CODE_FILE_CORRUPTED;
+    taosCloseFile(&pFD);
+    goto _exit;
+  }
+  taosCloseFile(&pFD);
+
+  if (!taosCheckChecksumWhole(pData, size)) {
+    code = TSDB_CODE_FILE_CORRUPTED;
+    goto _exit;
+  }
+
+  const void* buf = pData;
+  int32_t     fver = 0;
+  int64_t     committed = 0;
+  buf = taosDecodeFixedI32(buf, &fver);
+  buf = taosDecodeFixedI64(buf, &committed);
+  buf = taosDecodeFixedI32(buf, &numOfItems);
+
+  // the meta may be changed without going through the cache, e.g. by a snapshot, since the file is saved
+  if (fver != TAG_FILTER_RES_FILE_VER || committed != pMeta->pVnode->state.committed) {
+    numOfItems = 0;
+    goto _exit;
+  }
+
+  TdThreadMutex* pLock = &pMeta->pCache->sTagFilterResCache.lock;
+  taosThreadMutexLock(pLock);
+
+  const uint8_t* pEnd = pData + size - sizeof(TSCKSUM);
+  for (int32_t i = 0; i < numOfItems; ++i) {
+    uint64_t suid = 0;
+    uint64_t digest[2] = {0};
+    int32_t  payloadLen = 0;
+    void*    pPayload = NULL;
+
+    if ((const uint8_t*)buf + sizeof(uint64_t) * 3 + sizeof(int32_t) > pEnd) {
+      code = TSDB_CODE_FILE_CORRUPTED;
+      break;
+    }
+
+    buf = taosDecodeFixedU64(buf, &suid);
+    buf = taosDecodeFixedU64(buf, &digest[0]);
+    buf = taosDecodeFixedU64(buf, &digest[1]);
+    buf = taosDecodeFixedI32(buf, &payloadLen);
+    if (payloadLen < sizeof(int32_t) || (const uint8_t*)buf + payloadLen > pEnd ||
+        payloadLen != sizeof(int32_t) + (*(int32_t*)buf) * sizeof(uint64_t)) {
+      code = TSDB_CODE_FILE_CORRUPTED;
+      break;
+    }
+
+    buf = taosDecodeBinary(buf, &pPayload, payloadLen);
+    if (buf == NULL) {
+      code = TSDB_CODE_OUT_OF_MEMORY;
+      break;
+    }
+
+    code = uidFilterCacheInsert(pMeta, suid, digest, sizeof(digest), pPayload, payloadLen, 0);
+    if (code) {
+      break;
+    }
+  }
+
+  taosThreadMutexUnlock(pLock);
+
+_exit:
+  taosMemoryFree(pData);
+  taosRemoveFile(fname);
+  if (code) {
+    metaWarn("vgId:%d, failed to load tag filter cache from %s since %s", TD_VID(pMeta->pVnode), fname,
+             tstrerror(code));
+  } else {
+    metaDebug("vgId:%d, %d tag filter cache items loaded from %s", TD_VID(pMeta->pVnode), numOfItems, fname);
+  }
+}
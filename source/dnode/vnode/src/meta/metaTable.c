@@ -769,7 +769,7 @@ int metaCreateTable(SMeta *pMeta, int64_t ver, SVCreateTbReq *pReq, STableMetaRs
 
     metaWLock(pMeta);
     metaUpdateStbStats(pMeta, me.ctbEntry.suid, 1);
-    metaUidCacheClear(pMeta, me.ctbEntry.suid);
+    metaUidCacheUpdate(pMeta, me.ctbEntry.suid, me.uid);
     metaTbGroupCacheClear(pMeta, me.ctbEntry.suid);
     metaULock(pMeta);
   } else {
@@ -1076,7 +1076,7 @@ static int metaDropTableByUid(SMeta *pMeta, tb_uid_t uid, int *type) {
     --pMeta->pVnode->config.vndStats.numOfCTables;
 
     metaUpdateStbStats(pMeta, e.ctbEntry.suid, -1);
-    metaUidCacheClear(pMeta, e.ctbEntry.suid);
+    metaUidCacheUpdate(pMeta, e.ctbEntry.suid, uid);
     metaTbGroupCacheClear(pMeta, e.ctbEntry.suid);
   } else if (e.type == TSDB_NORMAL_TABLE) {
     // drop schema.db (todo)
@@ -1511,7 +1511,7 @@ static int metaUpdateTableTagVal(SMeta *pMeta, int64_t version, SVAlterTbReq *pA
   tdbTbUpsert(pMeta->pCtbIdx, &ctbIdxKey, sizeof(ctbIdxKey), ctbEntry.ctbEntry.pTags,
               ((STag *)(ctbEntry.ctbEntry.pTags))->len, pMeta->txn);
 
-  metaUidCacheClear(pMeta, ctbEntry.ctbEntry.suid);
+  metaUidCacheUpdate(pMeta, ctbEntry.ctbEntry.suid, uid);
   metaTbGroupCacheClear(pMeta, ctbEntry.ctbEntry.suid);
 
   metaULock(pMeta);
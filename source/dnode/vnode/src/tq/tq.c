@@ -108,6 +108,13 @@ STQ* tqOpen(const char* path, SVnode* pVnode) {
   pTq->pCheckInfo = taosHashInit(64, MurmurHash3_32, true, HASH_ENTRY_LOCK);
   taosHashSetFreeFp(pTq->pCheckInfo, (FDelete)tDeleteSTqCheckInfo);
 
+  // readers are opened when the handles and tasks are restored, so the cache needs to be ready before that
+  pVnode->pSubmitCache = tqSubmitCacheOpen(TQ_SUBMIT_CACHE_SIZE);
+  if (pVnode->pSubmitCache == NULL) {
+    tqClose(pTq);
+    return NULL;
+  }
+
   int32_t code = tqInitialize(pTq);
   if (code != TSDB_CODE_SUCCESS) {
     tqClose(pTq);
@@ -167,6 +174,8 @@ void tqClose(STQ* pTq) {
   taosMemoryFree(pTq->path);
   tqMetaClose(pTq);
   streamMetaClose(pTq->pStreamMeta);
+  tqSubmitCacheClose(pTq->pVnode->pSubmitCache);
+  pTq->pVnode->pSubmitCache = NULL;
   taosMemoryFree(pTq);
 }
 
@@ -244,6 +244,215 @@ END:
   return code;
 }
 
+STqSubmitCache* tqSubmitCacheOpen(int64_t capacity) {
+  STqSubmitCache* pCache = taosMemoryCalloc(1, sizeof(STqSubmitCache));
+  if (pCache == NULL) {
+    terrno = TSDB_CODE_OUT_OF_MEMORY;
+    return NULL;
+  }
+
+  pCache->pEntries = taosHashInit(64, taosGetDefaultHashFunction(TSDB_DATA_TYPE_BIGINT), false, HASH_NO_LOCK);
+  pCache->pQueue = tdListNew(POINTER_BYTES);
+  if (pCache->pEntries == NULL || pCache->pQueue == NULL) {
+    taosHashCleanup(pCache->pEntries);
+    tdListFree(pCache->pQueue);
+    taosMemoryFree(pCache);
+    terrno = TSDB_CODE_OUT_OF_MEMORY;
+    return NULL;
+  }
+
+  pCache->capacity = capacity;
+  taosThreadMutexInit(&pCache->lock, NULL);
+  return pCache;
+}
+
+static void tqSubmitEntryDestroy(STqSubmitEntry* pEntry) {
+  tDestroySubmitReq(&pEntry->submit, TSDB_MSG_FLG_DECODE);
+  taosMemoryFree(pEntry->msgStr);
+  taosMemoryFree(pEntry);
+}
+
+static int64_t tqArraySize(const SArray* pArray) {
+  return (pArray == NULL) ? 0 : sizeof(SArray) + (int64_t)pArray->capacity * pArray->elemSize;
+}
+
+// the rows and columns refer to the msg, but the arrays of them and the create table reqs are decoded into new memory
+static int64_t tqSubmitEntrySize(const STqSubmitEntry* pEntry) {
+  const SArray* pTbList = pEntry->submit.aSubmitTbData;
+  int64_t       size = sizeof(STqSubmitEntry) + pEntry->msgLen + tqArraySize(pTbList);
+
+  int32_t numOfTables = taosArrayGetSize(pTbList);
+  for (int32_t i = 0; i < numOfTables; ++i) {
+    const SSubmitTbData* pTbData = taosArrayGet(pTbList, i);
+    if (pTbData->flags & SUBMIT_REQ_COLUMN_DATA_FORMAT) {
+      size += tqArraySize(pTbData->aCol);
+    } else {
+      size += tqArraySize(pTbData->aRowP);
+    }
+
+    const SVCreateTbReq* pCreateTbReq = pTbData->pCreateTbReq;
+    if (pCreateTbReq != NULL) {
+      size += sizeof(SVCreateTbReq) + pCreateTbReq->commentLen + 1;
+      if (pCreateTbReq->type == TSDB_CHILD_TABLE) {
+        size += tqArraySize(pCreateTbReq->ctb.tagName);
+      }
+    }
+  }
+
+  return size;
+}
+
+// remove the entry from the cache, it is freed by the last reader that releases it.
+static void tqSubmitCacheRemove(STqSubmitCache* pCache, STqSubmitEntry* pEntry) {
+  taosHashRemove(pCache->pEntries, &pEntry->ver, sizeof(int64_t));
+  taosMemoryFree(tdListPopNode(pCache->pQueue, pEntry->pNode));
+  pEntry->pNode = NULL;
+  pCache->size -= pEntry->size;
+  pEntry->evicted = true;
+  if (pEntry->ref == 0) {
+    tqSubmitEntryDestroy(pEntry);
+  }
+}
+
+static void tqSubmitCacheEvict(STqSubmitCache* pCache) {
+  while (pCache->size > pCache->capacity) {
+    SListNode* pNode = tdListGetHead(pCache->pQueue);
+    if (pNode == NULL) {
+      break;
+    }
+
+    tqSubmitCacheRemove(pCache, *(STqSubmitEntry**)pNode->data);
+  }
+}
+
+void tqSubmitCacheClose(STqSubmitCache* pCache) {
+  if (pCache == NULL) {
+    return;
+  }
+
+  pCache->capacity = 0;
+  tqSubmitCacheEvict(pCache);
+
+  taosHashCleanup(pCache->pEntries);
+  tdListFree(pCache->pQueue);
+  taosThreadMutexDestroy(&pCache->lock);
+  taosMemoryFree(pCache);
+}
+
+static bool tqSubmitEntryMatch(const STqSubmitEntry* pEntry, int64_t term, uint32_t cksum) {
+  return pEntry->term == term && pEntry->cksum == cksum;
+}
+
+// an entry of the same version but another term or checksum was written before the wal is rolled back
+STqSubmitEntry* tqSubmitCacheGet(STqSubmitCache* pCache, int64_t ver, int64_t term, uint32_t cksum) {
+  STqSubmitEntry* pEntry = NULL;
+
+  taosThreadMutexLock(&pCache->lock);
+  STqSubmitEntry** ppEntry = taosHashGet(pCache->pEntries, &ver, sizeof(int64_t));
+  if (ppEntry != NULL) {
+    if (tqSubmitEntryMatch(*ppEntry, term, cksum)) {
+      pEntry = *ppEntry;
+      pEntry->ref += 1;
+    } else {
+      tqSubmitCacheRemove(pCache, *ppEntry);
+    }
+  }
+  taosThreadMutexUnlock(&pCache->lock);
+
+  return pEntry;
+}
+
+int32_t tqSubmitCachePut(STqSubmitCache* pCache, void* msgStr, int32_t msgLen, int64_t ver, int64_t term, uint32_t cksum,
+                         STqSubmitEntry** ppEntry) {
+  *ppEntry = NULL;
+
+  // decode out of the lock, other readers of the same version may do it concurrently
+  STqSubmitEntry* pEntry = taosMemoryCalloc(1, sizeof(STqSubmitEntry));
+  if (pEntry == NULL || (pEntry->msgStr = taosMemoryMalloc(msgLen)) == NULL) {
+    taosMemoryFree(pEntry);
+    terrno = TSDB_CODE_OUT_OF_MEMORY;
+    return -1;
+  }
+
+  memcpy(pEntry->msgStr, msgStr, msgLen);
+  pEntry->msgLen = msgLen;
+  pEntry->ver = ver;
+  pEntry->term = term;
+  pEntry->cksum = cksum;
+  pEntry->ref = 1;
+
+  SDecoder decoder = {0};
+  tDecoderInit(&decoder, pEntry->msgStr, msgLen);
+  if (tDecodeSubmitReq(&decoder, &pEntry->submit) < 0) {
+    tDecoderClear(&decoder);
+    tqSubmitEntryDestroy(pEntry);
+    tqError("DecodeSSubmitReq2 error, msgLen:%d, ver:%" PRId64, msgLen, ver);
+    return -1;
+  }
+  tDecoderClear(&decoder);
+  pEntry->size = tqSubmitEntrySize(pEntry);
+
+  taosThreadMutexLock(&pCache->lock);
+  STqSubmitEntry** ppCached = taosHashGet(pCache->pEntries, &ver, sizeof(int64_t));
+  if (ppCached != NULL && !tqSubmitEntryMatch(*ppCached, term, cksum)) {
+    tqSubmitCacheRemove(pCache, *ppCached);
+    ppCached = NULL;
+  }
+
+  if (ppCached != NULL) {
+    // another reader has put the same msg, the entry is kept by this reader only
+    pEntry->evicted = true;
+  } else if ((pEntry->pNode = tdListAdd(pCache->pQueue, &pEntry)) == NULL) {
+    pEntry->evicted = true;
+  } else if (taosHashPut(pCache->pEntries, &ver, sizeof(int64_t), &pEntry, POINTER_BYTES) != 0) {
+    taosMemoryFree(tdListPopNode(pCache->pQueue, pEntry->pNode));
+    pEntry->pNode = NULL;
+    pEntry->evicted = true;
+  } else {
+    pCache->size += pEntry->size;
+    tqSubmitCacheEvict(pCache);
+  }
+  taosThreadMutexUnlock(&pCache->lock);
+
+  *ppEntry = pEntry;
+  return 0;
+}
+
+void tqSubmitCacheRelease(STqSubmitCache* pCache, STqSubmitEntry* pEntry) {
+  taosThreadMutexLock(&pCache->lock);
+  bool destroy = (--pEntry->ref == 0) && pEntry->evicted;
+  taosThreadMutexUnlock(&pCache->lock);
+
+  if (destroy) {
+    tqSubmitEntryDestroy(pEntry);
+  }
+}
+
+static void tqReaderClearSubmit(STqReader* pReader) {
+  if (pReader->pSubmitEntry != NULL) {
+    tqSubmitCacheRelease(pReader->pSubmitCache, pReader->pSubmitEntry);
+    pReader->pSubmitEntry = NULL;
+    pReader->submit.aSubmitTbData = NULL;
+  } else {
+    tDestroySubmitReq(&pReader->submit, TSDB_MSG_FLG_DECODE);
+  }
+}
+
+static int32_t tqReaderDecodeSubmit(STqReader* pReader, void* msgStr, int32_t msgLen, int64_t ver) {
+  tqReaderClearSubmit(pReader);
+
+  SDecoder decoder = {0};
+  tDecoderInit(&decoder, msgStr, msgLen);
+  if (tDecodeSubmitReq(&decoder, &pReader->submit) < 0) {
+    tDecoderClear(&decoder);
+    tqError("DecodeSSubmitReq2 error, msgLen:%d, ver:%" PRId64, msgLen, ver);
+    return -1;
+  }
+
+  tDecoderClear(&decoder);
+  return 0;
+}
+
 STqReader* tqReaderOpen(SVnode* pVnode) {
   STqReader* pReader = taosMemoryCalloc(1, sizeof(STqReader));
   if (pReader == NULL) {
@@ -257,6 +466,7 @@ STqReader* tqReaderOpen(SVnode* pVnode) {
   }
 
   pReader->pVnodeMeta = pVnode->pMeta;
+  pReader->pSubmitCache = pVnode->pSubmitCache;
   pReader->pColIdList = NULL;
   pReader->cachedSchemaVer = 0;
   pReader->cachedSchemaSuid = 0;
@@ -283,7 +493,7 @@ void tqReaderClose(STqReader* pReader) {
   // free hash
   blockDataDestroy(pReader->pResBlock);
   taosHashCleanup(pReader->tbIdHash);
-  tDestroySubmitReq(&pReader->submit, TSDB_MSG_FLG_DECODE);
+  tqReaderClearSubmit(pReader);
   taosMemoryFree(pReader);
 }
 
@@ -320,7 +530,11 @@ int32_t extractMsgFromWal(SWalReader* pReader, void** pItem, int64_t maxVer, con
     }
 
     memcpy(data, pBody, len);
-    SPackedData data1 = (SPackedData){.ver = ver, .msgLen = len, .msgStr = data};
+    SPackedData data1 = (SPackedData){.ver = ver,
+                                      .msgLen = len,
+                                      .msgStr = data,
+                                      .term = pReader->pHead->head.syncMeta.term,
+                                      .cksum = pReader->pHead->cksumBody};
 
     *pItem = (SStreamQueueItem*)streamDataSubmitNew(&data1, STREAM_INPUT__DATA_SUBMIT);
     if (*pItem == NULL) {
@@ -345,46 +559,72 @@ int32_t extractMsgFromWal(SWalReader* pReader, void** pItem, int64_t maxVer, con
   return 0;
 }
 
-// todo ignore the error in wal?
-bool tqNextBlockInWal(STqReader* pReader, const char* id) {
+// fetch the next submit msg in wal. The body is skipped if the msg has been fetched and decoded by another reader.
+static int32_t tqReaderFetchSubmitInWal(STqReader* pReader) {
   SWalReader* pWalReader = pReader->pWalReader;
+  int64_t     appliedVer = walGetAppliedVer(pWalReader->pWal);
 
-  while (1) {
-    SArray* pBlockList = pReader->submit.aSubmitTbData;
-    if (pBlockList == NULL || pReader->nextBlk >= taosArrayGetSize(pBlockList)) {
-      // try next message in wal file
-      // todo always retry to avoid read failure caused by wal file deletion
-      if (walNextValidMsg(pWalReader) < 0) {
-        return false;
-      }
+  while (pWalReader->curVersion <= appliedVer) {
+    if (walFetchHead(pWalReader, pWalReader->curVersion) < 0) {
+      return -1;
+    }
 
-      void*   pBody = POINTER_SHIFT(pWalReader->pHead->head.body, sizeof(SSubmitReq2Msg));
-      int32_t bodyLen = pWalReader->pHead->head.bodyLen - sizeof(SSubmitReq2Msg);
-      int64_t ver = pWalReader->pHead->head.version;
+    if (pWalReader->pHead->head.msgType != TDMT_VND_SUBMIT) {
+      if (walSkipFetchBody(pWalReader) < 0) {
+        return -1;
+      }
+      continue;
+    }
 
-      SDecoder decoder = {0};
-      tDecoderInit(&decoder, pBody, bodyLen);
+    int64_t  ver = pWalReader->pHead->head.version;
+    int64_t  term = pWalReader->pHead->head.syncMeta.term;
+    uint32_t cksum = pWalReader->pHead->cksumBody;
 
-      {
-        int32_t nSubmitTbData = taosArrayGetSize(pReader->submit.aSubmitTbData);
-        for (int32_t i = 0; i < nSubmitTbData; i++) {
-          SSubmitTbData* pData = taosArrayGet(pReader->submit.aSubmitTbData, i);
-          if (pData->pCreateTbReq != NULL) {
-            taosArrayDestroy(pData->pCreateTbReq->ctb.tagName);
-            taosMemoryFreeClear(pData->pCreateTbReq);
-          }
-          pData->aRowP = taosArrayDestroy(pData->aRowP);
-        }
-        pReader->submit.aSubmitTbData = taosArrayDestroy(pReader->submit.aSubmitTbData);
+    tqReaderClearSubmit(pReader);
+    if (pReader->pSubmitCache != NULL) {
+      pReader->pSubmitEntry = tqSubmitCacheGet(pReader->pSubmitCache, ver, term, cksum);
+      if (pReader->pSubmitEntry != NULL) {
+        pReader->submit = pReader->pSubmitEntry->submit;
+        return walSkipFetchBody(pWalReader);
       }
+    }
+
+    if (walFetchBody(pWalReader) < 0) {
+      return -1;
+    }
+
+    void*   pBody = POINTER_SHIFT(pWalReader->pHead->head.body, sizeof(SSubmitReq2Msg));
+    int32_t bodyLen = pWalReader->pHead->head.bodyLen - sizeof(SSubmitReq2Msg);
+
+    int32_t code = (pReader->pSubmitCache != NULL)
+                       ? tqSubmitCachePut(pReader->pSubmitCache, pBody, bodyLen, ver, term, cksum, &pReader->pSubmitEntry)
+                       : tqReaderDecodeSubmit(pReader, pBody, bodyLen, ver);
+    if (code < 0) {
+      tqError("decode wal file error, msgLen:%d, ver:%" PRId64, bodyLen, ver);
+      return -1;
+    }
+
+    if (pReader->pSubmitEntry != NULL) {
+      pReader->submit = pReader->pSubmitEntry->submit;
+    }
+    return 0;
+  }
 
-      if (tDecodeSubmitReq(&decoder, &pReader->submit) < 0) {
-        tDecoderClear(&decoder);
-        tqError("decode wal file error, msgLen:%d, ver:%" PRId64, bodyLen, ver);
+  terrno = TSDB_CODE_WAL_LOG_NOT_EXIST;
+  return -1;
+}
+
+// todo ignore the error in wal?
+bool tqNextBlockInWal(STqReader* pReader, const char* id) {
+  while (1) {
+    SArray* pBlockList = pReader->submit.aSubmitTbData;
+    if (pBlockList == NULL || pReader->nextBlk >= taosArrayGetSize(pBlockList)) {
+      // try next message in wal file
+      // todo always retry to avoid read failure caused by wal file deletion
+      if (tqReaderFetchSubmitInWal(pReader) < 0) {
         return false;
       }
 
-      tDecoderClear(&decoder);
       pReader->nextBlk = 0;
     }
 
@@ -419,28 +659,35 @@ bool tqNextBlockInWal(STqReader* pReader, const char* id) {
     }
 
     qTrace("stream scan return empty, all %d submit blocks consumed, %s", numOfBlocks, id);
-    tDestroySubmitReq(&pReader->submit, TSDB_MSG_FLG_DECODE);
+    tqReaderClearSubmit(pReader);
 
     pReader->msg.msgStr = NULL;
   }
 }
 
-int32_t tqReaderSetSubmitMsg(STqReader* pReader, void* msgStr, int32_t msgLen, int64_t ver) {
+// the msg read from wal is looked up in the shared cache by its wal head, and decoded into the cache on a miss
+int32_t tqReaderSetSubmitMsg(STqReader* pReader, void* msgStr, int32_t msgLen, int64_t ver, int64_t term,
+                             uint32_t cksum) {
   pReader->msg.msgStr = msgStr;
   pReader->msg.msgLen = msgLen;
   pReader->msg.ver = ver;
+  pReader->msg.term = term;
+  pReader->msg.cksum = cksum;
 
   tqDebug("tq reader set msg %p %d", msgStr, msgLen);
-  SDecoder decoder;
+  if (pReader->pSubmitCache == NULL || term <= 0) {
+    return tqReaderDecodeSubmit(pReader, msgStr, msgLen, ver);
+  }
 
-  tDecoderInit(&decoder, pReader->msg.msgStr, pReader->msg.msgLen);
-  if (tDecodeSubmitReq(&decoder, &pReader->submit) < 0) {
-    tDecoderClear(&decoder);
-    tqError("DecodeSSubmitReq2 error, msgLen:%d, ver:%" PRId64, msgLen, ver);
+  tqReaderClearSubmit(pReader);
+  pReader->pSubmitEntry = tqSubmitCacheGet(pReader->pSubmitCache, ver, term, cksum);
+  if (pReader->pSubmitEntry == NULL &&
+      tqSubmitCachePut(pReader->pSubmitCache, msgStr, msgLen, ver, term, cksum, &pReader->pSubmitEntry) < 0) {
+    tqError("tq reader failed to set msg, msgLen:%d, ver:%" PRId64, msgLen, ver);
     return -1;
   }
 
-  tDecoderClear(&decoder);
+  pReader->submit = pReader->pSubmitEntry->submit;
   return 0;
 }
 
@@ -479,7 +726,7 @@ bool tqNextBlockImpl(STqReader* pReader, const char* idstr) {
     pReader->nextBlk++;
   }
 
-  tDestroySubmitReq(&pReader->submit, TSDB_MSG_FLG_DECODE);
+  tqReaderClearSubmit(pReader);
   pReader->nextBlk = 0;
   pReader->msg.msgStr = NULL;
 
@@ -501,7 +748,7 @@ bool tqNextDataBlockFilterOut(STqReader* pReader, SHashObj* filterOutUids) {
     pReader->nextBlk++;
   }
 
-  tDestroySubmitReq(&pReader->submit, TSDB_MSG_FLG_DECODE);
+  tqReaderClearSubmit(pReader);
   pReader->nextBlk = 0;
   pReader->msg.msgStr = NULL;
 
@@ -209,7 +209,7 @@ int32_t tqTaosxScanLog(STQ* pTq, STqHandle* pHandle, SPackedData submit, STaosxR
 
   if (pExec->subType == TOPIC_SUB_TYPE__TABLE) {
     STqReader* pReader = pExec->pTqReader;
-    tqReaderSetSubmitMsg(pReader, submit.msgStr, submit.msgLen, submit.ver);
+    tqReaderSetSubmitMsg(pReader, submit.msgStr, submit.msgLen, submit.ver, submit.term, submit.cksum);
     while (tqNextBlockImpl(pReader, NULL)) {
       taosArrayClear(pBlocks);
       taosArrayClear(pSchemas);
@@ -273,7 +273,7 @@ int32_t tqTaosxScanLog(STQ* pTq, STqHandle* pHandle, SPackedData submit, STaosxR
     }
   } else if (pExec->subType == TOPIC_SUB_TYPE__DB) {
     STqReader* pReader = pExec->pTqReader;
-    tqReaderSetSubmitMsg(pReader, submit.msgStr, submit.msgLen, submit.ver);
+    tqReaderSetSubmitMsg(pReader, submit.msgStr, submit.msgLen, submit.ver, submit.term, submit.cksum);
     while (tqNextDataBlockFilterOut(pReader, pExec->execDb.pFilterOutTbUid)) {
       taosArrayClear(pBlocks);
       taosArrayClear(pSchemas);
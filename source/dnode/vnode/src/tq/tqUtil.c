@@ -260,6 +260,8 @@ static int32_t extractDataAndRspForDbStbSubscribe(STQ* pTq, STqHandle* pHandle,
           .msgStr = POINTER_SHIFT(pHead->body, sizeof(SSubmitReq2Msg)),
           .msgLen = pHead->bodyLen - sizeof(SSubmitReq2Msg),
           .ver = pHead->version,
+          .term = pHead->syncMeta.term,
+          .cksum = pHandle->pWalReader->pHead->cksumBody,
       };
 
       code = tqTaosxScanLog(pTq, pHandle, submit, &taosxRsp, &totalRows);
@@ -51,6 +51,47 @@ static void tsdbCloseBICache(STsdb *pTsdb) {
   }
 }
 
+static int32_t tsdbOpenPgCache(STsdb *pTsdb) {
+  int32_t code = 0;
+
+  pTsdb->pgCacheHit = 0;
+  pTsdb->pgCacheMiss = 0;
+  pTsdb->pgCacheVer = 0;
+  pTsdb->pgCache = NULL;
+
+  if (tsTsdbPageCacheSize <= 0) {
+    return code;
+  }
+
+  SLRUCache *pCache = taosLRUCacheInit((size_t)tsTsdbPageCacheSize * 1024 * 1024, -1, .5);
+  if (pCache == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _err;
+  }
+
+  taosLRUCacheSetStrictCapacity(pCache, false);
+
+  taosThreadMutexInit(&pTsdb->pgMutex, NULL);
+
+_err:
+  pTsdb->pgCache = pCache;
+  return code;
+}
+
+static void tsdbClosePgCache(STsdb *pTsdb) {
+  SLRUCache *pCache = pTsdb->pgCache;
+  if (pCache) {
+    tsdbDebug("vgId:%d, page cache hit:%" PRId64 " miss:%" PRId64 " elems:%d", TD_VID(pTsdb->pVnode),
+              pTsdb->pgCacheHit, pTsdb->pgCacheMiss, taosLRUCacheGetElems(pCache));
+
+    taosLRUCacheEraseUnrefEntries(pCache);
+    taosLRUCacheCleanup(pCache);
+    pTsdb->pgCache = NULL;
+
+    taosThreadMutexDestroy(&pTsdb->pgMutex);
+  }
+}
+
 #define ROCKS_KEY_LEN (sizeof(tb_uid_t) + sizeof(int16_t) + sizeof(int8_t))
 
 typedef struct {
@@ -1149,6 +1190,12 @@ int32_t tsdbOpenCache(STsdb *pTsdb) {
     goto _err;
   }
 
+  code = tsdbOpenPgCache(pTsdb);
+  if (code != TSDB_CODE_SUCCESS) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _err;
+  }
+
   code = tsdbOpenRocksCache(pTsdb);
   if (code != TSDB_CODE_SUCCESS) {
     code = TSDB_CODE_OUT_OF_MEMORY;
@@ -1178,6 +1225,7 @@ void tsdbCloseCache(STsdb *pTsdb) {
   }
 
   tsdbCloseBICache(pTsdb);
+  tsdbClosePgCache(pTsdb);
   tsdbCloseRocksCache(pTsdb);
 }
 
@@ -2987,3 +3035,91 @@ int32_t tsdbBICacheRelease(SLRUCache *pCache, LRUHandle *h) {
 
   return code;
 }
+
+// page cache ==============================================================================================
+// Pages are keyed by (pgno, page size, file path). Tsdb file names carry the fid and the commit id, so the path
+// identifies one file version; pages rewritten in place and truncated files are dropped by tsdbCacheDelPages once the
+// file is written. A reader may load a page from disk just before it is rewritten, so a page is only put if no page
+// was dropped since its lookup missed.
+static int32_t getPgCacheKey(const char *path, int64_t pgno, int32_t szPage, char *key) {
+  int32_t len = strlen(path);
+
+  memcpy(key, &pgno, sizeof(pgno));
+  memcpy(key + sizeof(pgno), &szPage, sizeof(szPage));
+  memcpy(key + sizeof(pgno) + sizeof(szPage), path, len);
+
+  return sizeof(pgno) + sizeof(szPage) + len;
+}
+
+static void deletePgCache(const void *key, size_t keyLen, void *value, void *ud) {
+  (void)ud;
+  taosMemoryFree(value);
+}
+
+bool tsdbCacheGetPage(STsdb *pTsdb, const char *path, int64_t pgno, uint8_t *pBuf, int32_t szPage, int64_t *ver) {
+  SLRUCache *pCache = pTsdb->pgCache;
+  char       key[sizeof(int64_t) + sizeof(int32_t) + TSDB_FILENAME_LEN];
+
+  if (pCache == NULL) return false;
+
+  *ver = atomic_load_64(&pTsdb->pgCacheVer);
+
+  int32_t    keyLen = getPgCacheKey(path, pgno, szPage, key);
+  LRUHandle *h = taosLRUCacheLookup(pCache, key, keyLen);
+  if (h == NULL) {
+    atomic_add_fetch_64(&pTsdb->pgCacheMiss, 1);
+    return false;
+  }
+
+  memcpy(pBuf, taosLRUCacheValue(pCache, h), szPage);
+  taosLRUCacheRelease(pCache, h, false);
+
+  atomic_add_fetch_64(&pTsdb->pgCacheHit, 1);
+  return true;
+}
+
+void tsdbCachePutPage(STsdb *pTsdb, const char *path, int64_t pgno, const uint8_t *pBuf, int32_t szPage, int64_t ver) {
+  SLRUCache *pCache = pTsdb->pgCache;
+  char       key[sizeof(int64_t) + sizeof(int32_t) + TSDB_FILENAME_LEN];
+
+  if (pCache == NULL) return;
+
+  uint8_t *pPage = taosMemoryMalloc(szPage);
+  if (pPage == NULL) return;
+  memcpy(pPage, pBuf, szPage);
+
+  int32_t keyLen = getPgCacheKey(path, pgno, szPage, key);
+
+  taosThreadMutexLock(&pTsdb->pgMutex);
+  if (pTsdb->pgCacheVer == ver) {
+    (void)taosLRUCacheInsert(pCache, key, keyLen, pPage, szPage, deletePgCache, NULL, TAOS_LRU_PRIORITY_LOW, NULL);
+    pPage = NULL;
+  }
+  taosThreadMutexUnlock(&pTsdb->pgMutex);
+
+  taosMemoryFree(pPage);
+}
+
+void tsdbCacheDelPages(STsdb *pTsdb, const char *path, int32_t szPage, int64_t pgnoFrom, int64_t pgnoTo) {
+  SLRUCache *pCache = pTsdb->pgCache;
+  char       key[sizeof(int64_t) + sizeof(int32_t) + TSDB_FILENAME_LEN];
+
+  if (pCache == NULL) return;
+
+  taosThreadMutexLock(&pTsdb->pgMutex);
+  atomic_add_fetch_64(&pTsdb->pgCacheVer, 1);
+  for (int64_t pgno = pgnoFrom; pgno <= pgnoTo; ++pgno) {
+    int32_t keyLen = getPgCacheKey(path, pgno, szPage, key);
+    taosLRUCacheErase(pCache, key, keyLen);
+  }
+  taosThreadMutexUnlock(&pTsdb->pgMutex);
+}
+
+void tsdbCacheGetPageStat(SVnode *pVnode, int64_t *hit, int64_t *miss) {
+  *hit = 0;
+  *miss = 0;
+  if (pVnode->pTsdb != NULL) {
+    *hit = atomic_load_64(&pVnode->pTsdb->pgCacheHit);
+    *miss = atomic_load_64(&pVnode->pTsdb->pgCacheMiss);
+  }
+}
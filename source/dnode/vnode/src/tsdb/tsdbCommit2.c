@@ -451,6 +451,179 @@ _exit:
   return code;
 }
 
+// file sets to commit, each of them is committed by one of the workers and its ops are kept aside
+// until all are done, so that the ops reach the file system in fid order
+typedef struct {
+  SCommitter2  *workers;
+  TARRAY2(int32_t) fidArr[1];
+  TFileOpArray *fopArrs;
+} SCommitJobs;
+
+static int32_t tsdbFidCmprFn(const int32_t *fid1, const int32_t *fid2) {
+  if (*fid1 < *fid2) return -1;
+  if (*fid1 > *fid2) return 1;
+  return 0;
+}
+
+// collect the fids of the file sets the memtable has data in, by seeking each table to the start of the next file set
+static int32_t tsdbCommitCollectFids(SCommitter2 *committer, SCommitJobs *jobs) {
+  int32_t     code = 0;
+  SRBTreeIter iter[1] = {tRBTreeIterCreate(committer->tsdb->imem->tbDataTree, 1)};
+
+  for (SRBTreeNode *node = tRBTreeIterNext(iter); node; node = tRBTreeIterNext(iter)) {
+    STbData    *tbData = TCONTAINER_OF(node, STbData, rbtn);
+    STbDataIter tbIter[1];
+    TSDBKEY     from = {.ts = committer->ctx->nextKey, .version = VERSION_MIN};
+
+    for (;;) {
+      tsdbTbDataIterOpen(tbData, &from, 0, tbIter);
+      TSDBROW *row = tsdbTbDataIterGet(tbIter);
+      if (row == NULL) break;
+
+      int32_t fid = tsdbKeyFid(TSDBROW_TS(row), committer->minutes, committer->precision);
+      if (TARRAY2_SEARCH(jobs->fidArr, &fid, tsdbFidCmprFn, TD_EQ) == NULL) {
+        code = TARRAY2_SORT_INSERT(jobs->fidArr, fid, tsdbFidCmprFn);
+        if (code) return code;
+      }
+
+      TSKEY minKey, maxKey;
+      tsdbFidKeyRange(fid, committer->minutes, committer->precision, &minKey, &maxKey);
+      if (maxKey == TSKEY_MAX) break;
+      from.ts = maxKey + 1;
+    }
+  }
+
+  return code;
+}
+
+static int32_t tsdbCommitFileSetJob(void *arg, int32_t iWorker, int32_t iJob, int64_t *size) {
+  SCommitJobs *jobs = (SCommitJobs *)arg;
+  SCommitter2 *committer = &jobs->workers[iWorker];
+  TSKEY        maxKey;
+
+  tsdbFidKeyRange(TARRAY2_GET(jobs->fidArr, iJob), committer->minutes, committer->precision,
+                  &committer->ctx->nextKey, &maxKey);
+
+  int32_t code = tsdbCommitFileSet(committer);
+  if (code) return code;
+
+  TFileOpArray fopArr = jobs->fopArrs[iJob];
+  jobs->fopArrs[iJob] = committer->fopArray[0];
+  committer->fopArray[0] = fopArr;
+
+  const STFileOp *op;
+  TARRAY2_FOREACH_PTR(&jobs->fopArrs[iJob], op) {
+    if (op->optype == TSDB_FOP_CREATE) {
+      *size += op->nf.size;
+    }
+  }
+  return 0;
+}
+
+// A worker starts from the committer state left by tsdbOpenCommitter. The tsdb and the file set snapshot are
+// shared and only read by the workers, the readers, iterators, writer and file ops are owned by each worker.
+static void tsdbCommitterInitWorker(const SCommitter2 *committer, SCommitter2 *worker) {
+  ASSERT(TARRAY2_SIZE(committer->fopArray) == 0);
+  ASSERT(committer->writer == NULL && committer->dataIterMerger == NULL && committer->tombIterMerger == NULL);
+
+  memset(worker, 0, sizeof(*worker));
+  worker->tsdb = committer->tsdb;
+  worker->fsetArr = committer->fsetArr;
+  worker->minutes = committer->minutes;
+  worker->precision = committer->precision;
+  worker->minRow = committer->minRow;
+  worker->maxRow = committer->maxRow;
+  worker->cmprAlg = committer->cmprAlg;
+  worker->sttTrigger = committer->sttTrigger;
+  worker->szPage = committer->szPage;
+  worker->compactVersion = committer->compactVersion;
+  worker->ctx->cid = committer->ctx->cid;
+  worker->ctx->now = committer->ctx->now;
+  worker->ctx->maxDelKey = committer->ctx->maxDelKey;
+}
+
+static void tsdbCommitterClear(SCommitter2 *committer) {
+  if (committer->writer) {
+    tsdbFSetWriterClose(&committer->writer, 1, committer->fopArray);
+  }
+  tsdbCommitCloseIter(committer);
+  tsdbCommitCloseReader(committer);
+  TARRAY2_DESTROY(committer->dataIterArray, NULL);
+  TARRAY2_DESTROY(committer->tombIterArray, NULL);
+  TARRAY2_DESTROY(committer->sttReaderArray, NULL);
+  TARRAY2_DESTROY(committer->fopArray, NULL);
+}
+
+// The file sets of a memtable without deletion are independent of each other, so they are committed by a pool
+// of workers. Deletion ranges may span file sets and decide the next one to visit, they are committed one by one.
+static int32_t tsdbCommitFileSets(SCommitter2 *committer) {
+  int32_t      code = 0;
+  int32_t      lino = 0;
+  SCommitJobs  jobs = {0};
+  SFSetJobPool pool = {0};
+
+  if (committer->tsdb->imem->nDel > 0) {
+    while (committer->ctx->nextKey != TSKEY_MAX) {
+      code = tsdbCommitFileSet(committer);
+      TSDB_CHECK_CODE(code, lino, _exit);
+    }
+    goto _exit;
+  }
+
+  code = tsdbCommitCollectFids(committer, &jobs);
+  TSDB_CHECK_CODE(code, lino, _exit);
+  if (TARRAY2_SIZE(jobs.fidArr) == 0) {
+    committer->ctx->nextKey = TSKEY_MAX;
+    goto _exit;
+  }
+
+  pool.tsdb = committer->tsdb;
+  pool.label = "tsdb-commit";
+  pool.numOfJobs = TARRAY2_SIZE(jobs.fidArr);
+  pool.numOfWorkers = tsdbFSetJobWorkerNum(pool.numOfJobs);
+  pool.ioBudget = tsTsdbFSetIoBudget;
+  pool.fn = tsdbCommitFileSetJob;
+  pool.arg = &jobs;
+
+  jobs.workers = taosMemoryCalloc(pool.numOfWorkers, sizeof(SCommitter2));
+  jobs.fopArrs = taosMemoryCalloc(pool.numOfJobs, sizeof(TFileOpArray));
+  if (jobs.workers == NULL || jobs.fopArrs == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    TSDB_CHECK_CODE(code, lino, _exit);
+  }
+  for (int32_t i = 0; i < pool.numOfWorkers; ++i) {
+    tsdbCommitterInitWorker(committer, &jobs.workers[i]);
+  }
+
+  code = tsdbFSetJobPoolRun(&pool);
+  TSDB_CHECK_CODE(code, lino, _exit);
+
+  for (int32_t i = 0; i < pool.numOfJobs; ++i) {
+    code = TARRAY2_APPEND_BATCH(committer->fopArray, TARRAY2_DATA(&jobs.fopArrs[i]), TARRAY2_SIZE(&jobs.fopArrs[i]));
+    TSDB_CHECK_CODE(code, lino, _exit);
+  }
+  committer->ctx->nextKey = TSKEY_MAX;
+
+_exit:
+  if (jobs.workers) {
+    for (int32_t i = 0; i < pool.numOfWorkers; ++i) {
+      tsdbCommitterClear(&jobs.workers[i]);
+    }
+    taosMemoryFree(jobs.workers);
+  }
+  if (jobs.fopArrs) {
+    for (int32_t i = 0; i < pool.numOfJobs; ++i) {
+      TARRAY2_DESTROY(&jobs.fopArrs[i], NULL);
+    }
+    taosMemoryFree(jobs.fopArrs);
+  }
+  TARRAY2_DESTROY(jobs.fidArr, NULL);
+  if (code) {
+    TSDB_ERROR_LOG(TD_VID(committer->tsdb->pVnode), lino, code);
+  }
+  return code;
+}
+
 static int32_t tsdbOpenCommitter(STsdb *tsdb, SCommitInfo *info, SCommitter2 *committer) {
   int32_t code = 0;
   int32_t lino = 0;
@@ -572,10 +745,8 @@ int32_t tsdbCommitBegin(STsdb *tsdb, SCommitInfo *info) {
     code = tsdbOpenCommitter(tsdb, info, committer);
     TSDB_CHECK_CODE(code, lino, _exit);
 
-    while (committer->ctx->nextKey != TSKEY_MAX) {
-      code = tsdbCommitFileSet(committer);
-      TSDB_CHECK_CODE(code, lino, _exit);
-    }
+    code = tsdbCommitFileSets(committer);
+    TSDB_CHECK_CODE(code, lino, _exit);
 
     code = tsdbCloseCommitter(committer, code);
     TSDB_CHECK_CODE(code, lino, _exit);
@@ -239,6 +239,63 @@ void *tsdbTbDataIterDestroy(STbDataIter *pIter) {
   return NULL;
 }
 
+static FORCE_INLINE TSDBKEY tsdbChunkKey(SMemChunk *pChunk, int32_t iRow) {
+  return (TSDBKEY){.version = pChunk->pBlockData->aVersion[iRow], .ts = pChunk->pBlockData->aTSKEY[iRow]};
+}
+
+// position the iterator at the first chunk row >= pFrom, or the last chunk row <= pFrom if backward
+static void tbDataIterSeekChunk(STbData *pTbData, TSDBKEY *pFrom, int8_t backward, STbDataIter *pIter) {
+  SMemChunk *pChunk;
+  TSDBKEY    key;
+
+  if (backward) {
+    pChunk = (SMemChunk *)atomic_load_ptr(&pTbData->pChunkTail);
+    while (pChunk) {
+      key = tsdbChunkKey(pChunk, 0);
+      if (tsdbKeyCmprFn(&key, pFrom) <= 0) break;
+      pChunk = pChunk->prev;
+    }
+    if (pChunk == NULL) goto _exit;
+
+    // the last row <= pFrom
+    int32_t lo = 0, hi = pChunk->pBlockData->nRow - 1;
+    while (lo < hi) {
+      int32_t mid = lo + (hi - lo + 1) / 2;
+      key = tsdbChunkKey(pChunk, mid);
+      if (tsdbKeyCmprFn(&key, pFrom) <= 0) {
+        lo = mid;
+      } else {
+        hi = mid - 1;
+      }
+    }
+    pIter->iChunkRow = lo;
+  } else {
+    pChunk = (SMemChunk *)atomic_load_ptr(&pTbData->pChunkHead);
+    while (pChunk) {
+      key = tsdbChunkKey(pChunk, pChunk->pBlockData->nRow - 1);
+      if (tsdbKeyCmprFn(&key, pFrom) >= 0) break;
+      pChunk = (SMemChunk *)atomic_load_ptr(&pChunk->next);
+    }
+    if (pChunk == NULL) goto _exit;
+
+    // the first row >= pFrom
+    int32_t lo = 0, hi = pChunk->pBlockData->nRow - 1;
+    while (lo < hi) {
+      int32_t mid = lo + (hi - lo) / 2;
+      key = tsdbChunkKey(pChunk, mid);
+      if (tsdbKeyCmprFn(&key, pFrom) >= 0) {
+        hi = mid;
+      } else {
+        lo = mid + 1;
+      }
+    }
+    pIter->iChunkRow = lo;
+  }
+
+_exit:
+  pIter->pChunk = pChunk;
+}
+
 void tsdbTbDataIterOpen(STbData *pTbData, TSDBKEY *pFrom, int8_t backward, STbDataIter *pIter) {
   SMemSkipListNode *pos[SL_MAX_LEVEL];
   SMemSkipListNode *pHead;
@@ -249,6 +306,20 @@ void tsdbTbDataIterOpen(STbData *pTbData, TSDBKEY *pFrom, int8_t backward, STbDa
   pIter->pTbData = pTbData;
   pIter->backward = backward;
   pIter->pRow = NULL;
+  pIter->pChunk = NULL;
+  pIter->iChunkRow = 0;
+  pIter->fromChunk = 0;
+  if (pFrom == NULL) {
+    if (backward) {
+      pIter->pChunk = (SMemChunk *)atomic_load_ptr(&pTbData->pChunkTail);
+      if (pIter->pChunk) pIter->iChunkRow = pIter->pChunk->pBlockData->nRow - 1;
+    } else {
+      pIter->pChunk = (SMemChunk *)atomic_load_ptr(&pTbData->pChunkHead);
+    }
+  } else {
+    tbDataIterSeekChunk(pTbData, pFrom, backward, pIter);
+  }
+
   if (pFrom == NULL) {
     // create from head or tail
     if (backward) {
@@ -269,37 +340,39 @@ void tsdbTbDataIterOpen(STbData *pTbData, TSDBKEY *pFrom, int8_t backward, STbDa
 }
 
 bool tsdbTbDataIterNext(STbDataIter *pIter) {
-  pIter->pRow = NULL;
-  if (pIter->backward) {
-    ASSERT(pIter->pNode != pIter->pTbData->sl.pTail);
+  // find out the source of the current row
+  if (tsdbTbDataIterGet(pIter) == NULL) {
+    return false;
+  }
 
-    if (pIter->pNode == pIter->pTbData->sl.pHead) {
-      return false;
+  pIter->pRow = NULL;
+  if (pIter->fromChunk) {
+    SMemChunk *pChunk = pIter->pChunk;
+    if (pIter->backward) {
+      if (--pIter->iChunkRow < 0) {
+        pIter->pChunk = pChunk->prev;
+        pIter->iChunkRow = pIter->pChunk ? pIter->pChunk->pBlockData->nRow - 1 : 0;
+      }
+    } else {
+      if (++pIter->iChunkRow >= pChunk->pBlockData->nRow) {
+        pIter->pChunk = (SMemChunk *)atomic_load_ptr(&pChunk->next);
+        pIter->iChunkRow = 0;
+      }
     }
-
+  } else if (pIter->backward) {
+    ASSERT(pIter->pNode != pIter->pTbData->sl.pTail);
     pIter->pNode = SL_GET_NODE_BACKWARD(pIter->pNode, 0);
-    if (pIter->pNode == pIter->pTbData->sl.pHead) {
-      return false;
-    }
   } else {
     ASSERT(pIter->pNode != pIter->pTbData->sl.pHead);
-
-    if (pIter->pNode == pIter->pTbData->sl.pTail) {
-      return false;
-    }
-
     pIter->pNode = SL_GET_NODE_FORWARD(pIter->pNode, 0);
-    if (pIter->pNode == pIter->pTbData->sl.pTail) {
-      return false;
-    }
   }
 
-  return true;
+  return tsdbTbDataIterGet(pIter) != NULL;
 }
 
 int64_t tsdbCountTbDataRows(STbData *pTbData) {
   SMemSkipListNode *pNode = pTbData->sl.pHead;
-  int64_t           rowsNum = 0;
+  int64_t           rowsNum = atomic_load_64(&pTbData->nChunkRow);
 
   while (NULL != pNode) {
     pNode = SL_GET_NODE_FORWARD(pNode, 0);
@@ -386,6 +459,9 @@ static int32_t tsdbGetOrCreateTbData(SMemTable *pMemTable, tb_uid_t suid, tb_uid
   pTbData->maxKey = TSKEY_MIN;
   pTbData->pHead = NULL;
   pTbData->pTail = NULL;
+  pTbData->pChunkHead = NULL;
+  pTbData->pChunkTail = NULL;
+  pTbData->nChunkRow = 0;
   pTbData->sl.seed = taosRand();
   pTbData->sl.size = 0;
   pTbData->sl.maxLevel = maxLevel;
@@ -599,6 +675,56 @@ _exit:
   return code;
 }
 
+static bool tsdbTbDataCanAppendChunk(STbData *pTbData, SBlockData *pBlockData) {
+  for (int32_t iRow = 1; iRow < pBlockData->nRow; iRow++) {
+    if (pBlockData->aTSKEY[iRow] <= pBlockData->aTSKEY[iRow - 1]) return false;
+  }
+
+  TSKEY firstKey = pBlockData->aTSKEY[0];
+  if (pTbData->pChunkTail) {
+    SBlockData *pLast = pTbData->pChunkTail->pBlockData;
+    if (firstKey <= pLast->aTSKEY[pLast->nRow - 1]) return false;
+  }
+
+  SMemSkipListNode *pNode = SL_NODE_BACKWARD(pTbData->sl.pTail, 0);
+  if (pNode != pTbData->sl.pHead) {
+    TSKEY lastKey;
+    if (pNode->flag == TSDBROW_ROW_FMT) {
+      lastKey = ((SRow *)pNode->pData)->ts;
+    } else {
+      lastKey = ((SBlockData *)pNode->pData)->aTSKEY[pNode->iRow];
+    }
+    if (firstKey <= lastKey) return false;
+  }
+
+  return true;
+}
+
+static int32_t tsdbTbDataAppendChunk(SMemTable *pMemTable, STbData *pTbData, SBlockData *pBlockData) {
+  SVBufPool *pPool = pMemTable->pTsdb->pVnode->inUse;
+
+  SMemChunk *pChunk = vnodeBufPoolMalloc(pPool, sizeof(*pChunk));
+  if (pChunk == NULL) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+  pChunk->pBlockData = pBlockData;
+  pChunk->next = NULL;
+  pChunk->prev = pTbData->pChunkTail;
+
+  // publish the chunk to the concurrent readers
+  if (pTbData->pChunkTail) {
+    atomic_store_ptr(&pTbData->pChunkTail->next, pChunk);
+  } else {
+    atomic_store_ptr(&pTbData->pChunkHead, pChunk);
+  }
+  atomic_store_ptr(&pTbData->pChunkTail, pChunk);
+  atomic_add_fetch_64(&pTbData->nChunkRow, pBlockData->nRow);
+
+  pTbData->minKey = TMIN(pTbData->minKey, pBlockData->aTSKEY[0]);
+  pTbData->maxKey = TMAX(pTbData->maxKey, pBlockData->aTSKEY[pBlockData->nRow - 1]);
+  return 0;
+}
+
 static int32_t tsdbInsertColDataToTable(SMemTable *pMemTable, STbData *pTbData, int64_t version,
                                         SSubmitTbData *pSubmitTbData, int32_t *affectedRows) {
   int32_t code = 0;
@@ -650,6 +776,13 @@ static int32_t tsdbInsertColDataToTable(SMemTable *pMemTable, STbData *pTbData,
     if (code) goto _exit;
   }
 
+  // append the block as a chunk if it is in order and after all the rows in the table
+  if (tsdbTbDataCanAppendChunk(pTbData, pBlockData)) {
+    code = tsdbTbDataAppendChunk(pMemTable, pTbData, pBlockData);
+    if (code) goto _exit;
+    goto _update;
+  }
+
   // loop to add each row to the skiplist
   SMemSkipListNode *pos[SL_MAX_LEVEL];
   TSDBROW           tRow = tsdbRowFromBlockData(pBlockData, 0);
@@ -687,6 +820,8 @@ static int32_t tsdbInsertColDataToTable(SMemTable *pMemTable, STbData *pTbData,
     pTbData->maxKey = key.ts;
   }
 
+_update:
+  lRow = tsdbRowFromBlockData(pBlockData, pBlockData->nRow - 1);
   if (!TSDB_CACHE_NO(pMemTable->pTsdb->pVnode->config)) {
     tsdbCacheUpdate(pMemTable->pTsdb, pTbData->suid, pTbData->uid, &lRow);
   }
@@ -765,7 +900,7 @@ _exit:
   return code;
 }
 
-int32_t tsdbGetNRowsInTbData(STbData *pTbData) { return pTbData->sl.size; }
+int32_t tsdbGetNRowsInTbData(STbData *pTbData) { return pTbData->sl.size + atomic_load_64(&pTbData->nChunkRow); }
 
 int32_t tsdbRefMemTable(SMemTable *pMemTable, SQueryNode *pQNode) {
   int32_t code = 0;
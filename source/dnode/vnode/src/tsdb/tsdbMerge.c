@@ -389,9 +389,80 @@ _exit:
   return code;
 }
 
+// file sets to merge, each of them is merged by one of the workers and its ops are kept aside
+// until all are done, so that the ops reach the file system in fid order
+typedef struct {
+  SMerger      *workers;
+  STFileSet   **fsetArr;
+  TFileOpArray *fopArrs;
+} SMergeJobs;
+
+// A worker starts from the merger state left by tsdbMergerOpen. The tsdb and the file set array are shared and
+// only read by the workers, the readers, iterators, writer and file ops are owned by each worker.
+static void tsdbMergerInitWorker(const SMerger *merger, SMerger *worker) {
+  ASSERT(TARRAY2_SIZE(merger->fopArr) == 0);
+  ASSERT(merger->writer == NULL && merger->dataIterMerger == NULL && merger->tombIterMerger == NULL);
+
+  memset(worker, 0, sizeof(*worker));
+  worker->tsdb = merger->tsdb;
+  worker->fsetArr = merger->fsetArr;
+  worker->sttTrigger = merger->sttTrigger;
+  worker->maxRow = merger->maxRow;
+  worker->minRow = merger->minRow;
+  worker->szPage = merger->szPage;
+  worker->cmprAlg = merger->cmprAlg;
+  worker->compactVersion = merger->compactVersion;
+  worker->cid = merger->cid;
+  worker->ctx->opened = merger->ctx->opened;
+  worker->ctx->now = merger->ctx->now;
+}
+
+static void tsdbMergerClear(SMerger *merger) {
+  if (merger->writer) {
+    tsdbFSetWriterClose(&merger->writer, 1, merger->fopArr);
+  }
+  tsdbMergeFileSetEndCloseIter(merger);
+  tsdbMergeFileSetEndCloseReader(merger);
+  TARRAY2_DESTROY(merger->tombIterArr, NULL);
+  TARRAY2_DESTROY(merger->dataIterArr, NULL);
+  TARRAY2_DESTROY(merger->sttReaderArr, NULL);
+  TARRAY2_DESTROY(merger->fopArr, NULL);
+}
+
+static int32_t tsdbMergeFileSetJob(void *arg, int32_t iWorker, int32_t iJob, int64_t *size) {
+  SMergeJobs *jobs = (SMergeJobs *)arg;
+  SMerger    *merger = &jobs->workers[iWorker];
+
+  int32_t code = tsdbMergeFileSet(merger, jobs->fsetArr[iJob]);
+  if (code) return code;
+
+  TFileOpArray fopArr = jobs->fopArrs[iJob];
+  jobs->fopArrs[iJob] = merger->fopArr[0];
+  merger->fopArr[0] = fopArr;
+
+  const STFileOp *op;
+  TARRAY2_FOREACH_PTR(&jobs->fopArrs[iJob], op) {
+    if (op->optype == TSDB_FOP_CREATE) {
+      *size += op->nf.size;
+    }
+  }
+  return 0;
+}
+
 static int32_t tsdbDoMerge(SMerger *merger) {
-  int32_t code = 0;
-  int32_t lino = 0;
+  int32_t      code = 0;
+  int32_t      lino = 0;
+  int32_t      numOfFSet = 0;
+  SMergeJobs   jobs = {0};
+  SFSetJobPool pool = {0};
+
+  if (TARRAY2_SIZE(merger->fsetArr) == 0) goto _exit;
+
+  jobs.fsetArr = taosMemoryCalloc(TARRAY2_SIZE(merger->fsetArr), sizeof(STFileSet *));
+  if (jobs.fsetArr == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    TSDB_CHECK_CODE(code, lino, _exit);
+  }
 
   STFileSet *fset;
   TARRAY2_FOREACH(merger->fsetArr, fset) {
@@ -401,22 +472,59 @@ static int32_t tsdbDoMerge(SMerger *merger) {
 
     if (lvl->level != 0 || TARRAY2_SIZE(lvl->fobjArr) < merger->sttTrigger) continue;
 
-    if (!merger->ctx->opened) {
-      code = tsdbMergerOpen(merger);
-      TSDB_CHECK_CODE(code, lino, _exit);
-    }
+    jobs.fsetArr[numOfFSet++] = fset;
+  }
+
+  if (numOfFSet == 0) goto _exit;
+
+  code = tsdbMergerOpen(merger);
+  TSDB_CHECK_CODE(code, lino, _exit);
 
-    code = tsdbMergeFileSet(merger, fset);
+  pool.tsdb = merger->tsdb;
+  pool.label = "tsdb-merge";
+  pool.numOfJobs = numOfFSet;
+  pool.numOfWorkers = tsdbFSetJobWorkerNum(numOfFSet);
+  pool.ioBudget = tsTsdbFSetIoBudget;
+  pool.fn = tsdbMergeFileSetJob;
+  pool.arg = &jobs;
+
+  jobs.workers = taosMemoryCalloc(pool.numOfWorkers, sizeof(SMerger));
+  jobs.fopArrs = taosMemoryCalloc(numOfFSet, sizeof(TFileOpArray));
+  if (jobs.workers == NULL || jobs.fopArrs == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
     TSDB_CHECK_CODE(code, lino, _exit);
   }
+  for (int32_t i = 0; i < pool.numOfWorkers; ++i) {
+    tsdbMergerInitWorker(merger, &jobs.workers[i]);
+  }
+
+  code = tsdbFSetJobPoolRun(&pool);
+  TSDB_CHECK_CODE(code, lino, _exit);
 
-  if (merger->ctx->opened) {
-    code = tsdbMergerClose(merger);
+  for (int32_t i = 0; i < numOfFSet; ++i) {
+    code = TARRAY2_APPEND_BATCH(merger->fopArr, TARRAY2_DATA(&jobs.fopArrs[i]), TARRAY2_SIZE(&jobs.fopArrs[i]));
     TSDB_CHECK_CODE(code, lino, _exit);
   }
 
+  code = tsdbMergerClose(merger);
+  TSDB_CHECK_CODE(code, lino, _exit);
+
 _exit:
+  if (jobs.workers) {
+    for (int32_t i = 0; i < pool.numOfWorkers; ++i) {
+      tsdbMergerClear(&jobs.workers[i]);
+    }
+    taosMemoryFree(jobs.workers);
+  }
+  if (jobs.fopArrs) {
+    for (int32_t i = 0; i < numOfFSet; ++i) {
+      TARRAY2_DESTROY(&jobs.fopArrs[i], NULL);
+    }
+    taosMemoryFree(jobs.fopArrs);
+  }
+  taosMemoryFree(jobs.fsetArr);
   if (code) {
+    TARRAY2_DESTROY(merger->fopArr, NULL);
     TSDB_ERROR_LOG(TD_VID(merger->tsdb->pVnode), lino, code);
   } else {
     tsdbDebug("vgId:%d %s done", TD_VID(merger->tsdb->pVnode), __func__);
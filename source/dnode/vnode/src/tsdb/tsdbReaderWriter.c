@@ -16,12 +16,18 @@
 #include "tsdb.h"
 
 // =============== PAGE-WISE FILE ===============
-int32_t tsdbOpenFile(const char *path, int32_t szPage, int32_t flag, STsdbFD **ppFD) {
+int32_t tsdbOpenFile(const char *path, STsdb *pTsdb, int32_t szPage, int32_t flag, STsdbFD **ppFD) {
   int32_t  code = 0;
+  int64_t  szOld = 0;
   STsdbFD *pFD = NULL;
 
   *ppFD = NULL;
 
+  // the pages cached from the file before the truncation are dropped once it is truncated
+  if ((flag & TD_FILE_TRUNC) && taosStatFile(path, &szOld, NULL) < 0) {
+    szOld = 0;
+  }
+
   pFD = (STsdbFD *)taosMemoryCalloc(1, sizeof(*pFD) + strlen(path) + 1);
   if (pFD == NULL) {
     code = TSDB_CODE_OUT_OF_MEMORY;
@@ -32,6 +38,8 @@ int32_t tsdbOpenFile(const char *path, int32_t szPage, int32_t flag, STsdbFD **p
   strcpy(pFD->path, path);
   pFD->szPage = szPage;
   pFD->flag = flag;
+  pFD->pTsdb = pTsdb;
+  (void)tfsGetDiskIdByPath(pTsdb->pVnode->pTfs, path, &pFD->did);
   pFD->pFD = taosOpenFile(path, flag);
   if (pFD->pFD == NULL) {
     code = TAOS_SYSTEM_ERROR(errno);
@@ -62,6 +70,10 @@ int32_t tsdbOpenFile(const char *path, int32_t szPage, int32_t flag, STsdbFD **p
     pFD->szFile = pFD->szFile / szPage;
   }
 
+  if (szOld > 0) {
+    tsdbCacheDelPages(pTsdb, path, szPage, 1, szOld / szPage);
+  }
+
   *ppFD = pFD;
 
 _exit:
@@ -90,11 +102,20 @@ static int32_t tsdbWriteFilePage(STsdbFD *pFD) {
 
     taosCalcChecksumAppend(0, pFD->pBuf, pFD->szPage);
 
+    int64_t stime = taosGetTimestampUs();
+    tfsIoBegin(pFD->pTsdb->pVnode->pTfs, pFD->did, TFS_IO_WRITE, pFD->szPage);
     n = taosWriteFile(pFD->pFD, pFD->pBuf, pFD->szPage);
+    tfsIoEnd(pFD->pTsdb->pVnode->pTfs, pFD->did, TFS_IO_WRITE, pFD->szPage, taosGetTimestampUs() - stime);
     if (n < 0) {
       code = TAOS_SYSTEM_ERROR(errno);
       goto _exit;
     }
+    pFD->szUnsynced += n;
+
+    // drop the page once it is on disk, so readers reload it
+    if (pFD->pgno <= pFD->szFile) {
+      tsdbCacheDelPages(pFD->pTsdb, pFD->path, pFD->szPage, pFD->pgno, pFD->pgno);
+    }
 
     if (pFD->szFile < pFD->pgno) {
       pFD->szFile = pFD->pgno;
@@ -111,6 +132,13 @@ static int32_t tsdbReadFilePage(STsdbFD *pFD, int64_t pgno) {
 
   // ASSERT(pgno <= pFD->szFile);
 
+  // page cache, shared by all fds of the vnode
+  int64_t cacheVer = 0;
+  if (tsdbCacheGetPage(pFD->pTsdb, pFD->path, pgno, pFD->pBuf, pFD->szPage, &cacheVer)) {
+    pFD->pgno = pgno;
+    goto _exit;
+  }
+
   // seek
   int64_t offset = PAGE_OFFSET(pgno, pFD->szPage);
   int64_t n = taosLSeekFile(pFD->pFD, offset, SEEK_SET);
@@ -120,7 +148,10 @@ static int32_t tsdbReadFilePage(STsdbFD *pFD, int64_t pgno) {
   }
 
   // read
+  int64_t stime = taosGetTimestampUs();
+  tfsIoBegin(pFD->pTsdb->pVnode->pTfs, pFD->did, TFS_IO_READ, pFD->szPage);
   n = taosReadFile(pFD->pFD, pFD->pBuf, pFD->szPage);
+  tfsIoEnd(pFD->pTsdb->pVnode->pTfs, pFD->did, TFS_IO_READ, pFD->szPage, taosGetTimestampUs() - stime);
   if (n < 0) {
     code = TAOS_SYSTEM_ERROR(errno);
     goto _exit;
@@ -135,6 +166,7 @@ static int32_t tsdbReadFilePage(STsdbFD *pFD, int64_t pgno) {
     goto _exit;
   }
 
+  tsdbCachePutPage(pFD->pTsdb, pFD->path, pgno, pFD->pBuf, pFD->szPage, cacheVer);
   pFD->pgno = pgno;
 
 _exit:
@@ -208,10 +240,17 @@ int32_t tsdbFsyncFile(STsdbFD *pFD) {
   code = tsdbWriteFilePage(pFD);
   if (code) goto _exit;
 
-  if (taosFsyncFile(pFD->pFD) < 0) {
+  // the fsync is as heavy as the pages it flushes
+  int64_t szSync = pFD->szUnsynced;
+  int64_t stime = taosGetTimestampUs();
+  tfsIoBegin(pFD->pTsdb->pVnode->pTfs, pFD->did, TFS_IO_SYNC, szSync);
+  int32_t ret = taosFsyncFile(pFD->pFD);
+  tfsIoEnd(pFD->pTsdb->pVnode->pTfs, pFD->did, TFS_IO_SYNC, szSync, taosGetTimestampUs() - stime);
+  if (ret < 0) {
     code = TAOS_SYSTEM_ERROR(errno);
     goto _exit;
   }
+  pFD->szUnsynced = 0;
 
 _exit:
   return code;
@@ -251,7 +290,7 @@ int32_t tsdbDataFWriterOpen(SDataFWriter **ppWriter, STsdb *pTsdb, SDFileSet *pS
   // head
   flag = TD_FILE_READ | TD_FILE_WRITE | TD_FILE_CREATE | TD_FILE_TRUNC;
   tsdbHeadFileName(pTsdb, pWriter->wSet.diskId, pWriter->wSet.fid, &pWriter->fHead, fname);
-  code = tsdbOpenFile(fname, szPage, flag, &pWriter->pHeadFD);
+  code = tsdbOpenFile(fname, pTsdb, szPage, flag, &pWriter->pHeadFD);
   if (code) goto _err;
 
   code = tsdbWriteFile(pWriter->pHeadFD, 0, hdr, TSDB_FHDR_SIZE);
@@ -265,7 +304,7 @@ int32_t tsdbDataFWriterOpen(SDataFWriter **ppWriter, STsdb *pTsdb, SDFileSet *pS
     flag = TD_FILE_READ | TD_FILE_WRITE;
   }
   tsdbDataFileName(pTsdb, pWriter->wSet.diskId, pWriter->wSet.fid, &pWriter->fData, fname);
-  code = tsdbOpenFile(fname, szPage, flag, &pWriter->pDataFD);
+  code = tsdbOpenFile(fname, pTsdb, szPage, flag, &pWriter->pDataFD);
   if (code) goto _err;
   if (pWriter->fData.size == 0) {
     code = tsdbWriteFile(pWriter->pDataFD, 0, hdr, TSDB_FHDR_SIZE);
@@ -280,7 +319,7 @@ int32_t tsdbDataFWriterOpen(SDataFWriter **ppWriter, STsdb *pTsdb, SDFileSet *pS
     flag = TD_FILE_READ | TD_FILE_WRITE;
   }
   tsdbSmaFileName(pTsdb, pWriter->wSet.diskId, pWriter->wSet.fid, &pWriter->fSma, fname);
-  code = tsdbOpenFile(fname, szPage, flag, &pWriter->pSmaFD);
+  code = tsdbOpenFile(fname, pTsdb, szPage, flag, &pWriter->pSmaFD);
   if (code) goto _err;
   if (pWriter->fSma.size == 0) {
     code = tsdbWriteFile(pWriter->pSmaFD, 0, hdr, TSDB_FHDR_SIZE);
@@ -293,7 +332,7 @@ int32_t tsdbDataFWriterOpen(SDataFWriter **ppWriter, STsdb *pTsdb, SDFileSet *pS
   ASSERT(pWriter->fStt[pSet->nSttF - 1].size == 0);
   flag = TD_FILE_READ | TD_FILE_WRITE | TD_FILE_CREATE | TD_FILE_TRUNC;
   tsdbSttFileName(pTsdb, pWriter->wSet.diskId, pWriter->wSet.fid, &pWriter->fStt[pSet->nSttF - 1], fname);
-  code = tsdbOpenFile(fname, szPage, flag, &pWriter->pSttFD);
+  code = tsdbOpenFile(fname, pTsdb, szPage, flag, &pWriter->pSttFD);
   if (code) goto _err;
   code = tsdbWriteFile(pWriter->pSttFD, 0, hdr, TSDB_FHDR_SIZE);
   if (code) goto _err;
@@ -865,23 +904,23 @@ int32_t tsdbDataFReaderOpen(SDataFReader **ppReader, STsdb *pTsdb, SDFileSet *pS
 
   // head
   tsdbHeadFileName(pTsdb, pSet->diskId, pSet->fid, pSet->pHeadF, fname);
-  code = tsdbOpenFile(fname, szPage, TD_FILE_READ, &pReader->pHeadFD);
+  code = tsdbOpenFile(fname, pTsdb, szPage, TD_FILE_READ, &pReader->pHeadFD);
   TSDB_CHECK_CODE(code, lino, _exit);
 
   // data
   tsdbDataFileName(pTsdb, pSet->diskId, pSet->fid, pSet->pDataF, fname);
-  code = tsdbOpenFile(fname, szPage, TD_FILE_READ, &pReader->pDataFD);
+  code = tsdbOpenFile(fname, pTsdb, szPage, TD_FILE_READ, &pReader->pDataFD);
   TSDB_CHECK_CODE(code, lino, _exit);
 
   // sma
   tsdbSmaFileName(pTsdb, pSet->diskId, pSet->fid, pSet->pSmaF, fname);
-  code = tsdbOpenFile(fname, szPage, TD_FILE_READ, &pReader->pSmaFD);
+  code = tsdbOpenFile(fname, pTsdb, szPage, TD_FILE_READ, &pReader->pSmaFD);
   TSDB_CHECK_CODE(code, lino, _exit);
 
   // stt
   for (int32_t iStt = 0; iStt < pSet->nSttF; iStt++) {
     tsdbSttFileName(pTsdb, pSet->diskId, pSet->fid, pSet->aSttF[iStt], fname);
-    code = tsdbOpenFile(fname, szPage, TD_FILE_READ, &pReader->aSttFD[iStt]);
+    code = tsdbOpenFile(fname, pTsdb, szPage, TD_FILE_READ, &pReader->aSttFD[iStt]);
     TSDB_CHECK_CODE(code, lino, _exit);
   }
 
@@ -1281,7 +1320,7 @@ int32_t tsdbDelFWriterOpen(SDelFWriter **ppWriter, SDelFile *pFile, STsdb *pTsdb
   pDelFWriter->fDel = *pFile;
 
   tsdbDelFileName(pTsdb, pFile, fname);
-  code = tsdbOpenFile(fname, pTsdb->pVnode->config.tsdbPageSize, TD_FILE_READ | TD_FILE_WRITE | TD_FILE_CREATE,
+  code = tsdbOpenFile(fname, pTsdb, pTsdb->pVnode->config.tsdbPageSize, TD_FILE_READ | TD_FILE_WRITE | TD_FILE_CREATE,
                       &pDelFWriter->pWriteH);
   TSDB_CHECK_CODE(code, lino, _exit);
 
@@ -1456,7 +1495,7 @@ int32_t tsdbDelFReaderOpen(SDelFReader **ppReader, SDelFile *pFile, STsdb *pTsdb
   pDelFReader->fDel = *pFile;
 
   tsdbDelFileName(pTsdb, pFile, fname);
-  code = tsdbOpenFile(fname, pTsdb->pVnode->config.tsdbPageSize, TD_FILE_READ, &pDelFReader->pReadH);
+  code = tsdbOpenFile(fname, pTsdb, pTsdb->pVnode->config.tsdbPageSize, TD_FILE_READ, &pDelFReader->pReadH);
   if (code) {
     taosMemoryFree(pDelFReader);
     goto _exit;
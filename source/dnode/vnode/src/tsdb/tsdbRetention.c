@@ -15,6 +15,11 @@
 
 #include "tsdb.h"
 #include "tsdbFS2.h"
+#include "tsdbFSetRW.h"
+#include "tsdbIter.h"
+
+#define TSDB_RECOMPRESS_ALG         TWO_STAGE_COMP  // the heaviest codec of the tsdb files
+#define TSDB_RECOMPRESS_ROWS_FACTOR 4               // the blocks of the rewritten files are this many times larger by default
 
 typedef struct {
   STsdb  *tsdb;
@@ -29,6 +34,15 @@ typedef struct {
     int32_t    fsetArrIdx;
     STFileSet *fset;
   } ctx[1];
+
+  // rewrite of a file set migrated to a cold tier
+  SDataFileReader    *dataReader;
+  TSttFileReaderArray sttReaderArr[1];
+  TTsdbIterArray      dataIterArr[1];
+  SIterMerger        *dataIterMerger;
+  TTsdbIterArray      tombIterArr[1];
+  SIterMerger        *tombIterMerger;
+  SFSetWriter        *writer;
 } SRTNer;
 
 static int32_t tsdbDoRemoveFileObject(SRTNer *rtner, const STFileObj *fobj) {
@@ -123,6 +137,281 @@ _exit:
   return code;
 }
 
+static int32_t tsdbRecompressOpenReader(SRTNer *rtner) {
+  int32_t code = 0;
+  int32_t lino = 0;
+
+  STFileSet *fset = rtner->ctx->fset;
+  STFileObj *fobj;
+
+  // data
+  SDataFileReaderConfig config = {
+      .tsdb = rtner->tsdb,
+      .szPage = rtner->szPage,
+  };
+  bool hasDataFile = false;
+  for (int32_t ftype = 0; ftype < TSDB_FTYPE_MAX; ftype++) {
+    if ((fobj = fset->farr[ftype]) == NULL) continue;
+
+    hasDataFile = true;
+    config.files[ftype].exist = true;
+    config.files[ftype].file = fobj->f[0];
+
+    code = tsdbDoRemoveFileObject(rtner, fobj);
+    TSDB_CHECK_CODE(code, lino, _exit);
+  }
+
+  if (hasDataFile) {
+    code = tsdbDataFileReaderOpen(NULL, &config, &rtner->dataReader);
+    TSDB_CHECK_CODE(code, lino, _exit);
+  }
+
+  // stt
+  SSttLvl *lvl;
+  TARRAY2_FOREACH(fset->lvlArr, lvl) {
+    TARRAY2_FOREACH(lvl->fobjArr, fobj) {
+      code = tsdbDoRemoveFileObject(rtner, fobj);
+      TSDB_CHECK_CODE(code, lino, _exit);
+
+      SSttFileReader      *sttReader;
+      SSttFileReaderConfig config = {
+          .tsdb = rtner->tsdb,
+          .szPage = rtner->szPage,
+          .file[0] = fobj->f[0],
+      };
+
+      code = tsdbSttFileReaderOpen(fobj->fname, &config, &sttReader);
+      TSDB_CHECK_CODE(code, lino, _exit);
+
+      code = TARRAY2_APPEND(rtner->sttReaderArr, sttReader);
+      TSDB_CHECK_CODE(code, lino, _exit);
+    }
+  }
+
+_exit:
+  if (code) {
+    TSDB_ERROR_LOG(TD_VID(rtner->tsdb->pVnode), lino, code);
+  }
+  return code;
+}
+
+static int32_t tsdbRecompressOpenIter(SRTNer *rtner) {
+  int32_t code = 0;
+  int32_t lino = 0;
+
+  STsdbIter      *iter;
+  STsdbIterConfig config = {0};
+
+  if (rtner->dataReader) {
+    config.type = TSDB_ITER_TYPE_DATA;
+    config.dataReader = rtner->dataReader;
+
+    code = tsdbIterOpen(&config, &iter);
+    TSDB_CHECK_CODE(code, lino, _exit);
+
+    code = TARRAY2_APPEND(rtner->dataIterArr, iter);
+    TSDB_CHECK_CODE(code, lino, _exit);
+
+    config.type = TSDB_ITER_TYPE_DATA_TOMB;
+    config.dataReader = rtner->dataReader;
+
+    code = tsdbIterOpen(&config, &iter);
+    TSDB_CHECK_CODE(code, lino, _exit);
+
+    code = TARRAY2_APPEND(rtner->tombIterArr, iter);
+    TSDB_CHECK_CODE(code, lino, _exit);
+  }
+
+  SSttFileReader *sttReader;
+  TARRAY2_FOREACH(rtner->sttReaderArr, sttReader) {
+    config.type = TSDB_ITER_TYPE_STT;
+    config.sttReader = sttReader;
+
+    code = tsdbIterOpen(&config, &iter);
+    TSDB_CHECK_CODE(code, lino, _exit);
+
+    code = TARRAY2_APPEND(rtner->dataIterArr, iter);
+    TSDB_CHECK_CODE(code, lino, _exit);
+
+    config.type = TSDB_ITER_TYPE_STT_TOMB;
+    config.sttReader = sttReader;
+
+    code = tsdbIterOpen(&config, &iter);
+    TSDB_CHECK_CODE(code, lino, _exit);
+
+    code = TARRAY2_APPEND(rtner->tombIterArr, iter);
+    TSDB_CHECK_CODE(code, lino, _exit);
+  }
+
+  code = tsdbIterMergerOpen(rtner->dataIterArr, &rtner->dataIterMerger, false);
+  TSDB_CHECK_CODE(code, lino, _exit);
+
+  code = tsdbIterMergerOpen(rtner->tombIterArr, &rtner->tombIterMerger, true);
+  TSDB_CHECK_CODE(code, lino, _exit);
+
+_exit:
+  if (code) {
+    TSDB_ERROR_LOG(TD_VID(rtner->tsdb->pVnode), lino, code);
+  }
+  return code;
+}
+
+// the codec and the block size of the file sets rewritten to a cold tier
+static void tsdbRecompressConfig(STsdb *tsdb, int8_t *cmprAlg, int32_t *maxRow) {
+  STsdbCfg *pCfg = &tsdb->pVnode->config.tsdbCfg;
+
+  *cmprAlg = TSDB_RECOMPRESS_ALG;
+  if (tsTsdbRecompressMaxRows > 0) {
+    *maxRow = tsTsdbRecompressMaxRows;
+  } else {
+    *maxRow = TMIN((int64_t)pCfg->maxRows * TSDB_RECOMPRESS_ROWS_FACTOR, TSDB_MAX_MAXROWS_FBLOCK);
+  }
+}
+
+static int32_t tsdbRecompressOpenWriter(SRTNer *rtner, const SDiskID *did) {
+  SVnodeCfg *pCfg = &rtner->tsdb->pVnode->config;
+  int8_t     cmprAlg;
+  int32_t    maxRow;
+
+  tsdbRecompressConfig(rtner->tsdb, &cmprAlg, &maxRow);
+
+  // the file set is written from scratch with the heavier codec, brin and sma are rebuilt by the writer
+  SFSetWriterConfig config = {
+      .tsdb = rtner->tsdb,
+      .toSttOnly = false,
+      .compactVersion = INT64_MAX,
+      .minRow = pCfg->tsdbCfg.minRows,
+      .maxRow = maxRow,
+      .szPage = rtner->szPage,
+      .cmprAlg = cmprAlg,
+      .fid = rtner->ctx->fset->fid,
+      .cid = rtner->cid,
+      .did = did[0],
+      .level = 0,
+  };
+
+  return tsdbFSetWriterOpen(&config, &rtner->writer);
+}
+
+static void tsdbRecompressClose(SRTNer *rtner) {
+  if (rtner->writer) {
+    tsdbFSetWriterClose(&rtner->writer, 1, NULL);
+  }
+  tsdbIterMergerClose(&rtner->tombIterMerger);
+  tsdbIterMergerClose(&rtner->dataIterMerger);
+  TARRAY2_DESTROY(rtner->tombIterArr, tsdbIterClose);
+  TARRAY2_DESTROY(rtner->dataIterArr, tsdbIterClose);
+  TARRAY2_DESTROY(rtner->sttReaderArr, tsdbSttFileReaderClose);
+  tsdbDataFileReaderClose(&rtner->dataReader);
+}
+
+// rewrite the whole file set to the disk instead of copying its files
+static int32_t tsdbDoRecompressFileSet(SRTNer *rtner, const SDiskID *did) {
+  int32_t code = 0;
+  int32_t lino = 0;
+
+  SMetaInfo info;
+  TABLEID   tbid[1] = {0};
+
+  code = tsdbRecompressOpenReader(rtner);
+  TSDB_CHECK_CODE(code, lino, _exit);
+
+  code = tsdbRecompressOpenIter(rtner);
+  TSDB_CHECK_CODE(code, lino, _exit);
+
+  code = tsdbRecompressOpenWriter(rtner, did);
+  TSDB_CHECK_CODE(code, lino, _exit);
+
+  // data
+  for (SRowInfo *row; (row = tsdbIterMergerGetData(rtner->dataIterMerger)) != NULL;) {
+    if (row->uid != tbid->uid) {
+      tbid->uid = row->uid;
+      tbid->suid = row->suid;
+
+      if (metaGetInfo(rtner->tsdb->pVnode->pMeta, row->uid, &info, NULL) != 0) {
+        code = tsdbIterMergerSkipTableData(rtner->dataIterMerger, tbid);
+        TSDB_CHECK_CODE(code, lino, _exit);
+        continue;
+      }
+    }
+
+    code = tsdbFSetWriteRow(rtner->writer, row);
+    TSDB_CHECK_CODE(code, lino, _exit);
+
+    code = tsdbIterMergerNext(rtner->dataIterMerger);
+    TSDB_CHECK_CODE(code, lino, _exit);
+  }
+
+  // tomb
+  tbid->suid = 0;
+  tbid->uid = 0;
+  for (STombRecord *record; (record = tsdbIterMergerGetTombRecord(rtner->tombIterMerger)) != NULL;) {
+    if (record->uid != tbid->uid) {
+      tbid->uid = record->uid;
+      tbid->suid = record->suid;
+
+      if (metaGetInfo(rtner->tsdb->pVnode->pMeta, record->uid, &info, NULL) != 0) {
+        code = tsdbIterMergerSkipTableData(rtner->tombIterMerger, tbid);
+        TSDB_CHECK_CODE(code, lino, _exit);
+        continue;
+      }
+    }
+
+    code = tsdbFSetWriteTombRecord(rtner->writer, record);
+    TSDB_CHECK_CODE(code, lino, _exit);
+
+    code = tsdbIterMergerNext(rtner->tombIterMerger);
+    TSDB_CHECK_CODE(code, lino, _exit);
+  }
+
+  code = tsdbFSetWriterClose(&rtner->writer, 0, rtner->fopArr);
+  TSDB_CHECK_CODE(code, lino, _exit);
+
+_exit:
+  if (code) {
+    TSDB_ERROR_LOG(TD_VID(rtner->tsdb->pVnode), lino, code);
+  } else {
+    tsdbInfo("vid:%d, fid:%d, rewritten to level %d", TD_VID(rtner->tsdb->pVnode), rtner->ctx->fset->fid, did->level);
+  }
+  tsdbRecompressClose(rtner);
+  return code;
+}
+
+int32_t tsdbRecompressFileSet(STsdb *tsdb, STFileSet *fset, const SDiskID *did, int64_t cid, TFileOpArray *fopArr) {
+  SRTNer rtner[1] = {0};
+  rtner->tsdb = tsdb;
+  rtner->szPage = tsdb->pVnode->config.tsdbPageSize;
+  rtner->cid = cid;
+  rtner->ctx->fset = fset;
+
+  int32_t code = tsdbDoRecompressFileSet(rtner, did);
+
+  const STFileOp *op;
+  TARRAY2_FOREACH_PTR(rtner->fopArr, op) {
+    if (code) break;
+    code = TARRAY2_APPEND(fopArr, *op);
+  }
+  TARRAY2_DESTROY(rtner->fopArr, NULL);
+  return code;
+}
+
+bool tsdbShouldRecompress(STsdb *tsdb, const STFileSet *fset, const SDiskID *did) {
+  if (tsTsdbRecompressLevel <= 0 || did->level < tsTsdbRecompressLevel) return false;
+
+  // the rewrite costs a merge of the file set, it is only done if the files get smaller. The codec of the vnode is
+  // never replaced by a lighter one, even for larger blocks.
+  STsdbCfg *pCfg = &tsdb->pVnode->config.tsdbCfg;
+  int8_t    cmprAlg;
+  int32_t   maxRow;
+  tsdbRecompressConfig(tsdb, &cmprAlg, &maxRow);
+  if (cmprAlg < pCfg->compression) return false;
+  if (cmprAlg == pCfg->compression && maxRow <= pCfg->maxRows) return false;
+
+  // the data file is already rewritten when the file set reached this level, newer stt files are just copied
+  const STFileObj *fobj = fset->farr[TSDB_FTYPE_DATA];
+  return fobj != NULL && fobj->f->did.level != did->level;
+}
+
 typedef struct {
   STsdb  *tsdb;
   int32_t sync;
@@ -223,6 +512,12 @@ static int32_t tsdbDoRetention2(void *arg) {
       }
       tfsMkdirRecurAt(rtner->tsdb->pVnode->pTfs, rtner->tsdb->path, did);
 
+      if (tsdbShouldRecompress(rtner->tsdb, rtner->ctx->fset, &did)) {
+        code = tsdbRecompressFileSet(rtner->tsdb, rtner->ctx->fset, &did, rtner->cid, rtner->fopArr);
+        TSDB_CHECK_CODE(code, lino, _exit);
+        continue;
+      }
+
       // data
       for (int32_t ftype = 0; ftype < TSDB_FTYPE_MAX && (fobj = rtner->ctx->fset->farr[ftype], 1); ++ftype) {
         if (fobj == NULL) continue;
@@ -188,4 +188,117 @@ int32_t tsdbUpdateSkmRow(STsdb *pTsdb, const TABLEID *tbid, int32_t sver, SSkmIn
   pSkmRow->uid = tbid->uid;
   tDestroyTSchema(pSkmRow->pTSchema);
   return metaGetTbTSchemaEx(pTsdb->pVnode->pMeta, tbid->suid, tbid->uid, sver, &pSkmRow->pTSchema);
-}
\ No newline at end of file
+}
+
+// SFSetJobPool ----------
+extern int vnodeScheduleTaskEx(int tpid, int (*execute)(void *), void *arg);
+extern int vnodeScheduleThreads(int tpid);
+
+typedef struct {
+  SFSetJobPool *pool;
+  int32_t       iWorker;
+} SFSetJobWorker;
+
+int32_t tsdbFSetJobWorkerNum(int32_t numOfJobs) { return TMAX(TMIN(tsTsdbFSetThreads, numOfJobs), 1); }
+
+// delay the next job until the bytes written so far fit in the budget
+static void tsdbFSetJobPoolThrottle(SFSetJobPool *pool) {
+  if (pool->ioBudget <= 0) return;
+
+  int64_t expectMs = atomic_load_64(&pool->numOfBytes) * 1000 / ((int64_t)pool->ioBudget * 1024 * 1024);
+  int64_t elapsedMs = taosGetTimestampMs() - pool->startMs;
+  if (expectMs > elapsedMs) {
+    taosMsleep((int32_t)(expectMs - elapsedMs));
+  }
+}
+
+static void tsdbFSetJobWorkerRun(SFSetJobWorker *worker) {
+  SFSetJobPool *pool = worker->pool;
+  SVStatis     *statis = &pool->tsdb->pVnode->statis;
+
+  while (atomic_load_32(&pool->code) == 0) {
+    int32_t iJob = atomic_fetch_add_32(&pool->nextJob, 1);
+    if (iJob >= pool->numOfJobs) break;
+
+    tsdbFSetJobPoolThrottle(pool);
+
+    int64_t size = 0;
+    int32_t code = pool->fn(pool->arg, worker->iWorker, iJob, &size);
+    if (code) {
+      atomic_val_compare_exchange_32(&pool->code, 0, code);
+      break;
+    }
+
+    int64_t numOfBytes = atomic_add_fetch_64(&pool->numOfBytes, size);
+    int32_t numOfDone = atomic_add_fetch_32(&pool->numOfDone, 1);
+    atomic_add_fetch_64(&statis->nFSetJobBytes, size);
+    atomic_add_fetch_64(&statis->nFSetJobsDone, 1);
+    tsdbDebug("vgId:%d %s progress, file sets:%d/%d written:%" PRId64 " bytes", TD_VID(pool->tsdb->pVnode),
+              pool->label, numOfDone, pool->numOfJobs, numOfBytes);
+  }
+}
+
+static int tsdbFSetJobHelperRun(void *arg) {
+  SFSetJobWorker *worker = (SFSetJobWorker *)arg;
+  SFSetJobPool   *pool = worker->pool;
+
+  tsdbFSetJobWorkerRun(worker);
+  if (atomic_sub_fetch_32(&pool->numOfHelpers, 1) == 0) {
+    tsem_post(&pool->helperDone);
+  }
+  return 0;
+}
+
+int32_t tsdbFSetJobPoolRun(SFSetJobPool *pool) {
+  ASSERT(pool->numOfWorkers > 0);
+
+  pool->startMs = taosGetTimestampMs();
+  pool->nextJob = 0;
+  pool->numOfDone = 0;
+  pool->numOfBytes = 0;
+  pool->code = 0;
+
+  if (pool->numOfJobs == 0) return 0;
+
+  SVStatis *statis = &pool->tsdb->pVnode->statis;
+  atomic_add_fetch_64(&statis->nFSetJobs, pool->numOfJobs);
+
+  // the first worker runs on the current thread, the others on the shared vnode helper threads
+  int32_t         numOfWorkers = TMIN(pool->numOfWorkers, vnodeScheduleThreads(2) + 1);
+  SFSetJobWorker *workers = taosMemoryCalloc(numOfWorkers, sizeof(SFSetJobWorker));
+  if (workers == NULL) {
+    atomic_sub_fetch_64(&statis->nFSetJobs, pool->numOfJobs);
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+
+  tsem_init(&pool->helperDone, 0, 0);
+  pool->numOfHelpers = 1;  // held by the current thread until all helpers are scheduled
+  for (int32_t i = 0; i < numOfWorkers; ++i) {
+    workers[i].pool = pool;
+    workers[i].iWorker = i;
+    if (i > 0) {
+      // a helper failing to be scheduled just leaves its share to the others
+      atomic_add_fetch_32(&pool->numOfHelpers, 1);
+      if (vnodeScheduleTaskEx(2, tsdbFSetJobHelperRun, &workers[i]) != 0) {
+        atomic_sub_fetch_32(&pool->numOfHelpers, 1);
+      }
+    }
+  }
+
+  tsdbFSetJobWorkerRun(&workers[0]);
+  if (atomic_sub_fetch_32(&pool->numOfHelpers, 1) > 0) {
+    tsem_wait(&pool->helperDone);
+  }
+  tsem_destroy(&pool->helperDone);
+  taosMemoryFree(workers);
+
+  if (pool->code == 0) {
+    tsdbInfo("vgId:%d %s done, file sets:%d workers:%d written:%" PRId64 " bytes elapsed:%" PRId64 "ms",
+             TD_VID(pool->tsdb->pVnode), pool->label, pool->numOfDone, numOfWorkers, pool->numOfBytes,
+             taosGetTimestampMs() - pool->startMs);
+  } else {
+    // the file sets left are not pending any more
+    atomic_sub_fetch_64(&statis->nFSetJobs, pool->numOfJobs - pool->numOfDone);
+  }
+  return pool->code;
+}
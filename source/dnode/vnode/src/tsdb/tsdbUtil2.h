@@ -186,6 +186,32 @@ int32_t tBrinBlockGet(SBrinBlock *brinBlock, int32_t idx, SBrinRecord *record);
 int32_t tsdbUpdateSkmTb(STsdb *pTsdb, const TABLEID *tbid, SSkmInfo *pSkmTb);
 int32_t tsdbUpdateSkmRow(STsdb *pTsdb, const TABLEID *tbid, int32_t sver, SSkmInfo *pSkmRow);
 
+// SFSetJobPool ----------
+// run a job for each file set on a bounded number of workers, the job returns the bytes it wrote in *size
+typedef int32_t (*FSetJobFn)(void *arg, int32_t iWorker, int32_t iJob, int64_t *size);
+
+typedef struct {
+  STsdb      *tsdb;
+  const char *label;
+  int32_t     numOfJobs;
+  int32_t     numOfWorkers;
+  int32_t     ioBudget;  // MB/s, 0 means no limit
+  FSetJobFn   fn;
+  void       *arg;
+
+  // progress
+  int64_t startMs;
+  int32_t nextJob;
+  int32_t numOfDone;
+  int64_t numOfBytes;
+  int32_t code;
+  int32_t numOfHelpers;  // helpers not done yet
+  tsem_t  helperDone;
+} SFSetJobPool;
+
+int32_t tsdbFSetJobWorkerNum(int32_t numOfJobs);
+int32_t tsdbFSetJobPoolRun(SFSetJobPool *pool);
+
 #ifdef __cplusplus
 }
 #endif
@@ -34,7 +34,7 @@ typedef struct {
 struct SVnodeGlobal {
   int8_t           init;
   int8_t           stop;
-  SVnodeThreadPool tp[2];
+  SVnodeThreadPool tp[3];  // commit, merge, and the helpers of the file set jobs of both
 };
 
 struct SVnodeGlobal vnodeGlobal;
@@ -62,15 +62,16 @@ int vnodeInit(int nthreads) {
 
     taosThreadMutexUnlock(&(vnodeGlobal.tp[i].mutex));
 
-    vnodeGlobal.tp[i].nthreads = nthreads;
-    vnodeGlobal.tp[i].threads = taosMemoryCalloc(nthreads, sizeof(TdThread));
+    // the thread committing or merging a vnode runs one of its file set jobs, the others are run by the helpers
+    vnodeGlobal.tp[i].nthreads = (i == 2) ? nthreads * (tsTsdbFSetThreads - 1) : nthreads;
+    vnodeGlobal.tp[i].threads = taosMemoryCalloc(TMAX(vnodeGlobal.tp[i].nthreads, 1), sizeof(TdThread));
     if (vnodeGlobal.tp[i].threads == NULL) {
       terrno = TSDB_CODE_OUT_OF_MEMORY;
       vError("failed to init vnode module since:%s", tstrerror(terrno));
       return -1;
     }
 
-    for (int j = 0; j < nthreads; j++) {
+    for (int j = 0; j < vnodeGlobal.tp[i].nthreads; j++) {
       taosThreadCreate(&(vnodeGlobal.tp[i].threads[j]), NULL, loop, &vnodeGlobal.tp[i]);
     }
   }
@@ -141,6 +142,8 @@ int vnodeScheduleTaskEx(int tpid, int (*execute)(void*), void* arg) {
 
 int vnodeScheduleTask(int (*execute)(void*), void* arg) { return vnodeScheduleTaskEx(0, execute, arg); }
 
+int vnodeScheduleThreads(int tpid) { return vnodeGlobal.init ? vnodeGlobal.tp[tpid].nthreads : 0; }
+
 /* ------------------------ STATIC METHODS ------------------------ */
 static void* loop(void* arg) {
   SVnodeThreadPool* tp = (SVnodeThreadPool*)arg;
@@ -151,6 +154,8 @@ static void* loop(void* arg) {
     setThreadName("vnode-commit");
   } else if (tp == &vnodeGlobal.tp[1]) {
     setThreadName("vnode-merge");
+  } else if (tp == &vnodeGlobal.tp[2]) {
+    setThreadName("vnode-fset");
   }
 
   for (;;) {
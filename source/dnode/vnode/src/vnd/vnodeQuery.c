@@ -383,6 +383,10 @@ int32_t vnodeGetLoad(SVnode *pVnode, SVnodeLoad *pLoad) {
   pLoad->syncCanRead = state.canRead;
   pLoad->cacheUsage = tsdbCacheGetUsage(pVnode);
   pLoad->numOfCachedTables = tsdbCacheGetElems(pVnode);
+  tsdbCacheGetPageStat(pVnode, &pLoad->pageCacheHit, &pLoad->pageCacheMiss);
+  pLoad->numOfFSetJobs = atomic_load_64(&pVnode->statis.nFSetJobs);
+  pLoad->numOfFSetJobsDone = atomic_load_64(&pVnode->statis.nFSetJobsDone);
+  pLoad->fsetJobBytes = atomic_load_64(&pVnode->statis.nFSetJobBytes);
   pLoad->numOfTables = metaGetTbNum(pVnode->pMeta);
   pLoad->numOfTimeSeries = metaGetTimeSeriesNum(pVnode->pMeta);
   pLoad->totalStorage = (int64_t)3 * 1073741824;
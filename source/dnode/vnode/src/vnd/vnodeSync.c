@@ -484,6 +484,9 @@ static void vnodeSnapshotStopRead(const SSyncFSM *pFsm, void *pReader) {
 
 static int32_t vnodeSnapshotDoRead(const SSyncFSM *pFsm, void *pReader, void **ppBuf, int32_t *len) {
   SVnode *pVnode = pFsm->data;
+  // the snapshot readers allocate their own data, the offered buffer is not used
+  taosMemoryFreeClear(*ppBuf);
+  *len = 0;
   int32_t code = vnodeSnapRead(pReader, (uint8_t **)ppBuf, len);
   return code;
 }
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "metaCacheTestUtil.h"
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsign-compare"
+
+namespace {
+
+const uint64_t kSuid = 100;
+const uint64_t kDigestA[2] = {1, 1};
+const uint64_t kDigestB[2] = {2, 2};
+
+typedef std::vector<uint64_t> SUidList;
+
+// the result of a cache lookup
+struct SCachedList {
+  bool     acquired = false;
+  int64_t  ver = -1;
+  SUidList uids;
+  SUidList changed;
+};
+
+class MetaCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override { ASSERT_EQ(tTestMetaCacheOpen(&pCache), 0); }
+  void TearDown() override { tTestMetaCacheClose(pCache); }
+
+  SCachedList get(const uint64_t *digest) {
+    SCachedList res;
+    SUidList    uids(1024), changed(1024);
+    int32_t     nUid = 0, nChanged = 0;
+    EXPECT_EQ(tTestMetaCacheGetUidList(pCache, kSuid, digest, uids.data(), &nUid, changed.data(), &nChanged,
+                                       uids.size(), &res.ver, &res.acquired),
+              0);
+    res.uids.assign(uids.begin(), uids.begin() + nUid);
+    res.changed.assign(changed.begin(), changed.begin() + nChanged);
+    return res;
+  }
+
+  void put(const uint64_t *digest, const SUidList &uids, int64_t ver) {
+    ASSERT_EQ(tTestMetaCachePutUidList(pCache, kSuid, digest, uids.data(), uids.size(), ver), 0);
+  }
+
+  void update(uint64_t uid) { ASSERT_EQ(tTestMetaCacheUpdate(pCache, kSuid, uid), 0); }
+
+  STestMetaCache *pCache = NULL;
+};
+
+}  // namespace
+
+// a cached list is handed back with the child tables changed since, and the refreshed list with none
+TEST_F(MetaCacheTest, changesSinceCached) {
+  SCachedList res = get(kDigestA);
+  ASSERT_FALSE(res.acquired);
+  put(kDigestA, {1, 2}, res.ver);
+
+  update(3);
+  res = get(kDigestA);
+  ASSERT_TRUE(res.acquired);
+  ASSERT_EQ(res.uids, SUidList({1, 2}));
+  ASSERT_EQ(res.changed, SUidList({3}));
+  put(kDigestA, {1, 2, 3}, res.ver);
+
+  res = get(kDigestA);
+  ASSERT_TRUE(res.acquired);
+  ASSERT_EQ(res.uids, SUidList({1, 2, 3}));
+  ASSERT_TRUE(res.changed.empty());
+}
+
+// a table changed while the list is evaluated is still handed back by the next lookup
+TEST_F(MetaCacheTest, changeBetweenGetAndPut) {
+  SCachedList res = get(kDigestA);
+  put(kDigestA, {1, 2}, res.ver);
+
+  update(3);
+  res = get(kDigestA);
+  ASSERT_EQ(res.changed, SUidList({3}));
+
+  update(4);  // not seen by the query that refreshes the list
+  put(kDigestA, {1, 2, 3}, res.ver);
+
+  res = get(kDigestA);
+  ASSERT_TRUE(res.acquired);
+  ASSERT_EQ(res.uids, SUidList({1, 2, 3}));
+  ASSERT_EQ(res.changed, SUidList({4}));
+}
+
+// a list evaluated from scratch misses the tables changed before it is put, when no change is recorded for it
+TEST_F(MetaCacheTest, changeBeforeFirstPut) {
+  SCachedList res = get(kDigestA);
+  ASSERT_FALSE(res.acquired);
+
+  update(5);
+  put(kDigestA, {1}, res.ver);
+  ASSERT_FALSE(get(kDigestA).acquired);
+
+  res = get(kDigestA);
+  put(kDigestA, {1, 5}, res.ver);
+  res = get(kDigestA);
+  ASSERT_TRUE(res.acquired);
+  ASSERT_EQ(res.uids, SUidList({1, 5}));
+  ASSERT_TRUE(res.changed.empty());
+}
+
+// the list evaluated before the cached lists of the super table are cleared is not put
+TEST_F(MetaCacheTest, clearBetweenGetAndPut) {
+  SCachedList res = get(kDigestA);
+  put(kDigestA, {1, 2}, res.ver);
+
+  res = get(kDigestA);
+  ASSERT_TRUE(res.acquired);
+  ASSERT_EQ(tTestMetaCacheClear(pCache, kSuid), 0);
+  put(kDigestA, {1, 2}, res.ver);
+  ASSERT_FALSE(get(kDigestA).acquired);
+}
+
+// the changes are kept until all the cached lists have applied them
+TEST_F(MetaCacheTest, changesOfSeveralLists) {
+  SCachedList resA = get(kDigestA);
+  SCachedList resB = get(kDigestB);
+  put(kDigestA, {1}, resA.ver);
+  put(kDigestB, {2}, resB.ver);
+
+  update(3);
+  resA = get(kDigestA);
+  ASSERT_EQ(resA.changed, SUidList({3}));
+  put(kDigestA, {1, 3}, resA.ver);
+
+  update(4);
+  resA = get(kDigestA);
+  resB = get(kDigestB);
+  ASSERT_EQ(resA.changed, SUidList({4}));
+  ASSERT_EQ(resB.changed, SUidList({3, 4}));
+
+  put(kDigestB, {2, 4}, resB.ver);
+  resB = get(kDigestB);
+  ASSERT_EQ(resB.uids, SUidList({2, 4}));
+  ASSERT_TRUE(resB.changed.empty());
+}
+
+#pragma GCC diagnostic pop
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "metaCacheTestUtil.h"
+#include "meta.h"
+#include "vnd.h"
+
+struct STestMetaCache {
+  SVnode *pVnode;
+  SMeta  *pMeta;
+};
+
+int32_t tTestMetaCacheOpen(STestMetaCache **ppCache) {
+  int32_t         code = 0;
+  STestMetaCache *pCache = taosMemoryCalloc(1, sizeof(*pCache));
+  if (pCache == NULL) return TSDB_CODE_OUT_OF_MEMORY;
+
+  pCache->pVnode = taosMemoryCalloc(1, sizeof(SVnode));
+  pCache->pMeta = taosMemoryCalloc(1, sizeof(SMeta));
+  if (pCache->pVnode == NULL || pCache->pMeta == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _err;
+  }
+
+  // no saved cache file is found in the path, and none is written on close
+  pCache->pMeta->path = "/nonexistent/meta";
+  pCache->pMeta->pVnode = pCache->pVnode;
+  pCache->pVnode->pMeta = pCache->pMeta;
+  code = metaCacheOpen(pCache->pMeta);
+  if (code) goto _err;
+
+  *ppCache = pCache;
+  return code;
+
+_err:
+  tTestMetaCacheClose(pCache);
+  *ppCache = NULL;
+  return code;
+}
+
+void tTestMetaCacheClose(STestMetaCache *pCache) {
+  if (pCache == NULL) return;
+
+  if (pCache->pMeta) {
+    metaCacheClose(pCache->pMeta);
+  }
+  taosMemoryFree(pCache->pMeta);
+  taosMemoryFree(pCache->pVnode);
+  taosMemoryFree(pCache);
+}
+
+int32_t tTestMetaCacheGetUidList(STestMetaCache *pCache, uint64_t suid, const uint64_t *digest, uint64_t *aUid,
+                                 int32_t *nUid, uint64_t *aChanged, int32_t *nChanged, int32_t maxUid, int64_t *ver,
+                                 bool *acquired) {
+  SArray *pList = taosArrayInit(8, sizeof(uint64_t));
+  SArray *pChanged = taosArrayInit(8, sizeof(uint64_t));
+  if (pList == NULL || pChanged == NULL) {
+    taosArrayDestroy(pList);
+    taosArrayDestroy(pChanged);
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+
+  int32_t code = metaGetCachedTableUidList(pCache->pVnode, suid, (const uint8_t *)digest, sizeof(uint64_t) * 2, pList,
+                                           pChanged, ver, acquired);
+
+  *nUid = TMIN(taosArrayGetSize(pList), maxUid);
+  *nChanged = TMIN(taosArrayGetSize(pChanged), maxUid);
+  for (int32_t i = 0; i < *nUid; i++) {
+    aUid[i] = *(uint64_t *)taosArrayGet(pList, i);
+  }
+  for (int32_t i = 0; i < *nChanged; i++) {
+    aChanged[i] = *(uint64_t *)taosArrayGet(pChanged, i);
+  }
+
+  taosArrayDestroy(pList);
+  taosArrayDestroy(pChanged);
+  return code;
+}
+
+int32_t tTestMetaCachePutUidList(STestMetaCache *pCache, uint64_t suid, const uint64_t *digest, const uint64_t *aUid,
+                                 int32_t nUid, int64_t ver) {
+  // the payload format of the executor: number of uids(4bytes) + uids
+  int32_t payloadLen = sizeof(int32_t) + nUid * sizeof(uint64_t);
+  char   *pPayload = taosMemoryMalloc(payloadLen);
+  if (pPayload == NULL) return TSDB_CODE_OUT_OF_MEMORY;
+
+  *(int32_t *)pPayload = nUid;
+  if (nUid > 0) {
+    memcpy(pPayload + sizeof(int32_t), aUid, nUid * sizeof(uint64_t));
+  }
+
+  return metaUidFilterCachePut(pCache->pVnode, suid, digest, sizeof(uint64_t) * 2, pPayload, payloadLen, 1, ver);
+}
+
+int32_t tTestMetaCacheUpdate(STestMetaCache *pCache, uint64_t suid, int64_t uid) {
+  return metaUidCacheUpdate(pCache->pMeta, suid, uid);
+}
+
+int32_t tTestMetaCacheClear(STestMetaCache *pCache, uint64_t suid) { return metaUidCacheClear(pCache->pMeta, suid); }
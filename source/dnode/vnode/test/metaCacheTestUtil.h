@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _TD_VNODE_META_CACHE_TEST_UTIL_H_
+#define _TD_VNODE_META_CACHE_TEST_UTIL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct STestMetaCache STestMetaCache;
+
+// the meta cache of a fake vnode, without the meta tables
+int32_t tTestMetaCacheOpen(STestMetaCache **ppCache);
+void    tTestMetaCacheClose(STestMetaCache *pCache);
+
+// look up the cached uid list of the tag filter digest (16 bytes). The uid list is returned in aUid and the changed
+// child tables in aChanged, at most maxUid of each.
+int32_t tTestMetaCacheGetUidList(STestMetaCache *pCache, uint64_t suid, const uint64_t *digest, uint64_t *aUid,
+                                 int32_t *nUid, uint64_t *aChanged, int32_t *nChanged, int32_t maxUid, int64_t *ver,
+                                 bool *acquired);
+int32_t tTestMetaCachePutUidList(STestMetaCache *pCache, uint64_t suid, const uint64_t *digest, const uint64_t *aUid,
+                                 int32_t nUid, int64_t ver);
+
+// a child table of the super table is created, altered or dropped
+int32_t tTestMetaCacheUpdate(STestMetaCache *pCache, uint64_t suid, int64_t uid);
+int32_t tTestMetaCacheClear(STestMetaCache *pCache, uint64_t suid);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*_TD_VNODE_META_CACHE_TEST_UTIL_H_*/
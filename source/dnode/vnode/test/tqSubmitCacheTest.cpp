@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "tqSubmitCacheTestUtil.h"
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsign-compare"
+
+namespace {
+
+const int32_t kNumOfTables = 4;
+const int32_t kNumOfRows = 16;
+
+// the encoded submit msg of a wal version
+struct SSubmitMsg {
+  void   *pMsg = NULL;
+  int32_t msgLen = 0;
+};
+
+class TqSubmitCacheTest : public ::testing::Test {
+ protected:
+  void TearDown() override {
+    tTestSubmitCacheClose(pCache);
+    for (auto &msg : msgs) {
+      tTestSubmitMsgFree(msg.pMsg);
+    }
+  }
+
+  void open(int64_t capacity) {
+    pCache = tTestSubmitCacheOpen(capacity);
+    ASSERT_TRUE(pCache != NULL);
+  }
+
+  void reopen(int64_t capacity) {
+    tTestSubmitCacheClose(pCache);
+    open(capacity);
+  }
+
+  SSubmitMsg build(int64_t uid) {
+    SSubmitMsg msg;
+    EXPECT_EQ(tTestSubmitMsgBuild(uid, kNumOfTables, kNumOfRows, &msg.pMsg, &msg.msgLen), 0);
+    msgs.push_back(msg);
+    return msg;
+  }
+
+  // look up the wal head first as the reader does, and decode the body on a miss
+  STqSubmitEntry *acquire(const SSubmitMsg &msg, int64_t ver, int64_t term = 1) {
+    STqSubmitEntry *pEntry = tTestSubmitCacheGet(pCache, ver, term, tTestSubmitMsgCksum(msg.pMsg, msg.msgLen));
+    if (pEntry == NULL) {
+      EXPECT_EQ(tTestSubmitCachePut(pCache, msg.pMsg, msg.msgLen, ver, term, &pEntry), 0);
+    }
+    return pEntry;
+  }
+
+  STqSubmitCache         *pCache = NULL;
+  std::vector<SSubmitMsg> msgs;
+};
+
+// the decoded submit holds the tables and rows of the msg it is decoded from
+bool checkEntry(STqSubmitEntry *pEntry, int64_t uid) {
+  if (tTestSubmitEntryNumOfTables(pEntry) != kNumOfTables) return false;
+  for (int32_t i = 0; i < kNumOfTables; i++) {
+    if (tTestSubmitEntryUid(pEntry, i) != uid + i) return false;
+    if (tTestSubmitEntryNumOfRows(pEntry, i) != kNumOfRows) return false;
+    for (int32_t j = 0; j < kNumOfRows; j++) {
+      if (tTestSubmitEntryRowTs(pEntry, i, j) != (uid + i) * 1000 + j) return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+// the readers of the same version share the decoded submit, which is charged with the decoded arrays
+TEST_F(TqSubmitCacheTest, sharedByReaders) {
+  open(1024 * 1024);
+  SSubmitMsg msg = build(100);
+
+  STqSubmitEntry *pEntry1 = acquire(msg, 1);
+  STqSubmitEntry *pEntry2 = acquire(msg, 1);
+  ASSERT_TRUE(pEntry1 != NULL);
+  ASSERT_EQ(pEntry1, pEntry2);
+  ASSERT_TRUE(checkEntry(pEntry1, 100));
+
+  int64_t decodedSize = kNumOfTables * kNumOfRows * sizeof(void *);
+  ASSERT_GT(tTestSubmitEntrySize(pEntry1), msg.msgLen + decodedSize);
+  ASSERT_EQ(tTestSubmitCacheSize(pCache), tTestSubmitEntrySize(pEntry1));
+
+  tTestSubmitCacheRelease(pCache, pEntry1);
+  tTestSubmitCacheRelease(pCache, pEntry2);
+  ASSERT_EQ(tTestSubmitCacheNumOfEntries(pCache), 1);
+}
+
+// an entry evicted while a reader holds it stays readable, and is freed once released
+TEST_F(TqSubmitCacheTest, evictWhileHeld) {
+  open(1);
+  SSubmitMsg msg1 = build(100);
+  SSubmitMsg msg2 = build(200);
+
+  STqSubmitEntry *pEntry1 = acquire(msg1, 1);
+  ASSERT_TRUE(tTestSubmitEntryEvicted(pEntry1));
+  ASSERT_EQ(tTestSubmitCacheNumOfEntries(pCache), 0);
+  ASSERT_EQ(tTestSubmitCacheSize(pCache), 0);
+
+  STqSubmitEntry *pEntry2 = acquire(msg2, 2);
+  ASSERT_TRUE(checkEntry(pEntry1, 100));
+  ASSERT_TRUE(checkEntry(pEntry2, 200));
+  tTestSubmitCacheRelease(pCache, pEntry1);
+  tTestSubmitCacheRelease(pCache, pEntry2);
+
+  // the entries are evicted in the order of insertion
+  reopen(1024 * 1024);
+  SSubmitMsg msg3 = build(300);
+  pEntry1 = acquire(msg1, 1);
+  tTestSubmitCacheRelease(pCache, pEntry1);
+  int64_t capacity = tTestSubmitCacheSize(pCache);
+
+  reopen(capacity * 2);
+  pEntry1 = acquire(msg1, 1);
+  pEntry2 = acquire(msg2, 2);
+  STqSubmitEntry *pEntry3 = acquire(msg3, 3);
+  ASSERT_TRUE(tTestSubmitEntryEvicted(pEntry1));
+  ASSERT_FALSE(tTestSubmitEntryEvicted(pEntry2));
+  ASSERT_FALSE(tTestSubmitEntryEvicted(pEntry3));
+  ASSERT_EQ(tTestSubmitCacheNumOfEntries(pCache), 2);
+  ASSERT_TRUE(checkEntry(pEntry1, 100));
+  tTestSubmitCacheRelease(pCache, pEntry1);
+  tTestSubmitCacheRelease(pCache, pEntry2);
+  tTestSubmitCacheRelease(pCache, pEntry3);
+}
+
+// the hit is decided by the wal head, the msg body is not needed
+TEST_F(TqSubmitCacheTest, hitByWalHead) {
+  open(1024 * 1024);
+  SSubmitMsg msg = build(100);
+  uint32_t   cksum = tTestSubmitMsgCksum(msg.pMsg, msg.msgLen);
+
+  ASSERT_TRUE(tTestSubmitCacheGet(pCache, 1, 1, cksum) == NULL);
+  STqSubmitEntry *pEntry = acquire(msg, 1);
+  STqSubmitEntry *pHit = tTestSubmitCacheGet(pCache, 1, 1, cksum);
+  ASSERT_EQ(pHit, pEntry);
+  ASSERT_TRUE(checkEntry(pHit, 100));
+
+  // a put of the same msg by a racing reader keeps the cached entry
+  STqSubmitEntry *pRace = NULL;
+  ASSERT_EQ(tTestSubmitCachePut(pCache, msg.pMsg, msg.msgLen, 1, 1, &pRace), 0);
+  ASSERT_NE(pRace, pEntry);
+  ASSERT_TRUE(tTestSubmitEntryEvicted(pRace));
+  ASSERT_FALSE(tTestSubmitEntryEvicted(pEntry));
+  ASSERT_EQ(tTestSubmitCacheNumOfEntries(pCache), 1);
+
+  tTestSubmitCacheRelease(pCache, pRace);
+  tTestSubmitCacheRelease(pCache, pHit);
+  tTestSubmitCacheRelease(pCache, pEntry);
+}
+
+// after the wal is rolled back, the version carries another msg, which replaces the cached one
+TEST_F(TqSubmitCacheTest, replaceAfterRollback) {
+  open(1024 * 1024);
+  SSubmitMsg msg1 = build(100);
+  SSubmitMsg msg2 = build(200);
+
+  // the same msg rewritten in a new term is not taken for the cached one either
+  STqSubmitEntry *pStale = acquire(msg1, 5, 1);
+  STqSubmitEntry *pRewritten = acquire(msg1, 5, 2);
+  ASSERT_NE(pStale, pRewritten);
+  ASSERT_TRUE(tTestSubmitEntryEvicted(pStale));
+  tTestSubmitCacheRelease(pCache, pStale);
+  tTestSubmitCacheRelease(pCache, pRewritten);
+  reopen(1024 * 1024);
+
+  STqSubmitEntry *pOld = acquire(msg1, 5);
+  STqSubmitEntry *pNew = acquire(msg2, 5);
+  ASSERT_NE(pOld, pNew);
+  ASSERT_TRUE(tTestSubmitEntryEvicted(pOld));
+  ASSERT_FALSE(tTestSubmitEntryEvicted(pNew));
+  ASSERT_TRUE(checkEntry(pOld, 100));
+  ASSERT_TRUE(checkEntry(pNew, 200));
+  ASSERT_EQ(tTestSubmitCacheNumOfEntries(pCache), 1);
+  ASSERT_EQ(tTestSubmitCacheSize(pCache), tTestSubmitEntrySize(pNew));
+
+  STqSubmitEntry *pHit = acquire(msg2, 5);
+  ASSERT_EQ(pHit, pNew);
+  tTestSubmitCacheRelease(pCache, pHit);
+  tTestSubmitCacheRelease(pCache, pOld);
+  tTestSubmitCacheRelease(pCache, pNew);
+}
+
+// the readers walk the same versions at once, while the small cache keeps evicting them
+TEST_F(TqSubmitCacheTest, concurrentReaders) {
+  const int32_t numOfVers = 64;
+  const int32_t numOfReaders = 8;
+  const int32_t numOfLoops = 20;
+  for (int32_t ver = 0; ver < numOfVers; ver++) {
+    build(ver * 100);
+  }
+
+  // the msgs are of the same size, and so are the entries
+  open(1024 * 1024);
+  tTestSubmitCacheRelease(pCache, acquire(msgs[0], 0));
+  int64_t entrySize = tTestSubmitCacheSize(pCache);
+  reopen(entrySize * 4);
+
+  std::vector<uint32_t> cksums;
+  for (auto &msg : msgs) {
+    cksums.push_back(tTestSubmitMsgCksum(msg.pMsg, msg.msgLen));
+  }
+
+  std::atomic<int32_t>     numOfErrors(0);
+  std::vector<std::thread> readers;
+  for (int32_t i = 0; i < numOfReaders; i++) {
+    readers.emplace_back([&, i]() {
+      for (int32_t loop = 0; loop < numOfLoops; loop++) {
+        for (int32_t j = 0; j < numOfVers; j++) {
+          // the readers are a few versions apart
+          int32_t         ver = (j + i * 3) % numOfVers;
+          STqSubmitEntry *pEntry = tTestSubmitCacheGet(pCache, ver, 1, cksums[ver]);
+          if (pEntry == NULL && tTestSubmitCachePut(pCache, msgs[ver].pMsg, msgs[ver].msgLen, ver, 1, &pEntry) != 0) {
+            numOfErrors++;
+            continue;
+          }
+          if (!checkEntry(pEntry, ver * 100)) {
+            numOfErrors++;
+          }
+          tTestSubmitCacheRelease(pCache, pEntry);
+        }
+      }
+    });
+  }
+  for (auto &reader : readers) {
+    reader.join();
+  }
+
+  ASSERT_EQ(numOfErrors, 0);
+  ASSERT_LE(tTestSubmitCacheSize(pCache), entrySize * 4);
+  ASSERT_LE(tTestSubmitCacheNumOfEntries(pCache), 4);
+}
+
+// the handles scanning the same submit msg share its decode, the msg without a wal head is decoded by the reader
+TEST_F(TqSubmitCacheTest, sharedByScanHandles) {
+  open(1024 * 1024);
+  SSubmitMsg msg = build(100);
+
+  STqReader *pReader1 = tTestReaderOpen(pCache);
+  STqReader *pReader2 = tTestReaderOpen(pCache);
+  ASSERT_TRUE(pReader1 != NULL && pReader2 != NULL);
+
+  ASSERT_EQ(tTestReaderSetSubmitMsg(pReader1, msg.pMsg, msg.msgLen, 1, 1), 0);
+  ASSERT_EQ(tTestSubmitCacheNumOfEntries(pCache), 1);
+  ASSERT_EQ(tTestReaderSetSubmitMsg(pReader2, msg.pMsg, msg.msgLen, 1, 1), 0);
+
+  STqSubmitEntry *pEntry = tTestReaderSubmitEntry(pReader1);
+  ASSERT_TRUE(pEntry != NULL);
+  ASSERT_EQ(tTestReaderSubmitEntry(pReader2), pEntry);
+  ASSERT_FALSE(tTestSubmitEntryEvicted(pEntry));
+  ASSERT_TRUE(checkEntry(pEntry, 100));
+  ASSERT_EQ(tTestReaderNumOfTables(pReader2), kNumOfTables);
+  ASSERT_EQ(tTestSubmitCacheNumOfEntries(pCache), 1);
+
+  ASSERT_EQ(tTestReaderSetSubmitMsg(pReader2, msg.pMsg, msg.msgLen, 2, 0), 0);
+  ASSERT_TRUE(tTestReaderSubmitEntry(pReader2) == NULL);
+  ASSERT_EQ(tTestReaderNumOfTables(pReader2), kNumOfTables);
+  ASSERT_EQ(tTestSubmitCacheNumOfEntries(pCache), 1);
+
+  tTestReaderClose(pReader1);
+  tTestReaderClose(pReader2);
+}
+
+#pragma GCC diagnostic pop
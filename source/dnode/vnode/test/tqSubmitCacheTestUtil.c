@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tqSubmitCacheTestUtil.h"
+#include "tchecksum.h"
+#include "tq.h"
+
+static void tTestSubmitReqDestroy(SSubmitReq2 *pReq) {
+  for (int32_t i = 0; i < taosArrayGetSize(pReq->aSubmitTbData); i++) {
+    SSubmitTbData *pTbData = taosArrayGet(pReq->aSubmitTbData, i);
+    taosArrayDestroyP(pTbData->aRowP, taosMemoryFree);
+  }
+  taosArrayDestroy(pReq->aSubmitTbData);
+}
+
+int32_t tTestSubmitMsgBuild(int64_t uid, int32_t numOfTables, int32_t numOfRows, void **ppMsg, int32_t *msgLen) {
+  int32_t     code = 0;
+  SSubmitReq2 req = {0};
+
+  req.aSubmitTbData = taosArrayInit(numOfTables, sizeof(SSubmitTbData));
+  if (req.aSubmitTbData == NULL) return TSDB_CODE_OUT_OF_MEMORY;
+
+  for (int32_t i = 0; i < numOfTables; i++) {
+    SSubmitTbData tbData = {.suid = 1, .uid = uid + i, .sver = 1};
+    tbData.aRowP = taosArrayInit(numOfRows, POINTER_BYTES);
+    if (tbData.aRowP == NULL || taosArrayPush(req.aSubmitTbData, &tbData) == NULL) {
+      taosArrayDestroy(tbData.aRowP);
+      code = TSDB_CODE_OUT_OF_MEMORY;
+      goto _exit;
+    }
+
+    // the rows only carry the timestamp, the decoder does not look into them
+    for (int32_t j = 0; j < numOfRows; j++) {
+      SRow *pRow = taosMemoryCalloc(1, sizeof(SRow));
+      if (pRow == NULL || taosArrayPush(tbData.aRowP, &pRow) == NULL) {
+        taosMemoryFree(pRow);
+        code = TSDB_CODE_OUT_OF_MEMORY;
+        goto _exit;
+      }
+      pRow->sver = 1;
+      pRow->len = sizeof(SRow);
+      pRow->ts = (uid + i) * 1000 + j;
+    }
+  }
+
+  int32_t len = 0;
+  tEncodeSize(tEncodeSubmitReq, &req, len, code);
+  if (code) goto _exit;
+
+  void *pMsg = taosMemoryMalloc(len);
+  if (pMsg == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _exit;
+  }
+
+  SEncoder encoder = {0};
+  tEncoderInit(&encoder, pMsg, len);
+  code = tEncodeSubmitReq(&encoder, &req);
+  tEncoderClear(&encoder);
+  if (code) {
+    taosMemoryFree(pMsg);
+    goto _exit;
+  }
+
+  *ppMsg = pMsg;
+  *msgLen = len;
+
+_exit:
+  tTestSubmitReqDestroy(&req);
+  return code;
+}
+
+void tTestSubmitMsgFree(void *pMsg) { taosMemoryFree(pMsg); }
+
+uint32_t tTestSubmitMsgCksum(void *pMsg, int32_t msgLen) { return taosCalcChecksum(0, pMsg, msgLen); }
+
+STqSubmitCache *tTestSubmitCacheOpen(int64_t capacity) { return tqSubmitCacheOpen(capacity); }
+
+void tTestSubmitCacheClose(STqSubmitCache *pCache) { tqSubmitCacheClose(pCache); }
+
+int64_t tTestSubmitCacheSize(STqSubmitCache *pCache) {
+  taosThreadMutexLock(&pCache->lock);
+  int64_t size = pCache->size;
+  taosThreadMutexUnlock(&pCache->lock);
+  return size;
+}
+
+int32_t tTestSubmitCacheNumOfEntries(STqSubmitCache *pCache) {
+  taosThreadMutexLock(&pCache->lock);
+  int32_t num = taosHashGetSize(pCache->pEntries);
+  taosThreadMutexUnlock(&pCache->lock);
+  return num;
+}
+
+STqSubmitEntry *tTestSubmitCacheGet(STqSubmitCache *pCache, int64_t ver, int64_t term, uint32_t cksum) {
+  return tqSubmitCacheGet(pCache, ver, term, cksum);
+}
+
+int32_t tTestSubmitCachePut(STqSubmitCache *pCache, void *pMsg, int32_t msgLen, int64_t ver, int64_t term,
+                            STqSubmitEntry **ppEntry) {
+  return tqSubmitCachePut(pCache, pMsg, msgLen, ver, term, tTestSubmitMsgCksum(pMsg, msgLen), ppEntry);
+}
+
+void tTestSubmitCacheRelease(STqSubmitCache *pCache, STqSubmitEntry *pEntry) { tqSubmitCacheRelease(pCache, pEntry); }
+
+STqReader *tTestReaderOpen(STqSubmitCache *pCache) {
+  STqReader *pReader = taosMemoryCalloc(1, sizeof(STqReader));
+  if (pReader != NULL) {
+    pReader->pSubmitCache = pCache;
+  }
+  return pReader;
+}
+
+void tTestReaderClose(STqReader *pReader) { tqReaderClose(pReader); }
+
+int32_t tTestReaderSetSubmitMsg(STqReader *pReader, void *pMsg, int32_t msgLen, int64_t ver, int64_t term) {
+  return tqReaderSetSubmitMsg(pReader, pMsg, msgLen, ver, term, tTestSubmitMsgCksum(pMsg, msgLen));
+}
+
+STqSubmitEntry *tTestReaderSubmitEntry(STqReader *pReader) { return pReader->pSubmitEntry; }
+
+int32_t tTestReaderNumOfTables(STqReader *pReader) { return taosArrayGetSize(pReader->submit.aSubmitTbData); }
+
+int64_t tTestSubmitEntrySize(STqSubmitEntry *pEntry) { return pEntry->size; }
+
+bool tTestSubmitEntryEvicted(STqSubmitEntry *pEntry) { return pEntry->evicted; }
+
+int32_t tTestSubmitEntryNumOfTables(STqSubmitEntry *pEntry) { return taosArrayGetSize(pEntry->submit.aSubmitTbData); }
+
+int64_t tTestSubmitEntryUid(STqSubmitEntry *pEntry, int32_t iTable) {
+  return ((SSubmitTbData *)taosArrayGet(pEntry->submit.aSubmitTbData, iTable))->uid;
+}
+
+int32_t tTestSubmitEntryNumOfRows(STqSubmitEntry *pEntry, int32_t iTable) {
+  return taosArrayGetSize(((SSubmitTbData *)taosArrayGet(pEntry->submit.aSubmitTbData, iTable))->aRowP);
+}
+
+int64_t tTestSubmitEntryRowTs(STqSubmitEntry *pEntry, int32_t iTable, int32_t iRow) {
+  SSubmitTbData *pTbData = taosArrayGet(pEntry->submit.aSubmitTbData, iTable);
+  return (*(SRow **)taosArrayGet(pTbData->aRowP, iRow))->ts;
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _TD_VNODE_TQ_SUBMIT_CACHE_TEST_UTIL_H_
+#define _TD_VNODE_TQ_SUBMIT_CACHE_TEST_UTIL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct STqSubmitCache STqSubmitCache;
+typedef struct STqSubmitEntry STqSubmitEntry;
+typedef struct STqReader      STqReader;
+
+// encode a submit msg of numOfTables tables, with uid, uid + 1, ... Each table has numOfRows rows, whose timestamps
+// are uid * 1000, uid * 1000 + 1, ... The msg is freed by taosMemoryFree.
+int32_t  tTestSubmitMsgBuild(int64_t uid, int32_t numOfTables, int32_t numOfRows, void **ppMsg, int32_t *msgLen);
+void     tTestSubmitMsgFree(void *pMsg);
+uint32_t tTestSubmitMsgCksum(void *pMsg, int32_t msgLen);
+
+// the submit cache shared by the readers of a vnode
+STqSubmitCache *tTestSubmitCacheOpen(int64_t capacity);
+void            tTestSubmitCacheClose(STqSubmitCache *pCache);
+int64_t         tTestSubmitCacheSize(STqSubmitCache *pCache);
+int32_t         tTestSubmitCacheNumOfEntries(STqSubmitCache *pCache);
+STqSubmitEntry *tTestSubmitCacheGet(STqSubmitCache *pCache, int64_t ver, int64_t term, uint32_t cksum);
+int32_t         tTestSubmitCachePut(STqSubmitCache *pCache, void *pMsg, int32_t msgLen, int64_t ver, int64_t term,
+                                    STqSubmitEntry **ppEntry);
+void    tTestSubmitCacheRelease(STqSubmitCache *pCache, STqSubmitEntry *pEntry);
+
+// the reader of a subscription handle, which is set with the submit msg of a wal version as tqScanData does
+STqReader      *tTestReaderOpen(STqSubmitCache *pCache);
+void            tTestReaderClose(STqReader *pReader);
+int32_t         tTestReaderSetSubmitMsg(STqReader *pReader, void *pMsg, int32_t msgLen, int64_t ver, int64_t term);
+STqSubmitEntry *tTestReaderSubmitEntry(STqReader *pReader);
+int32_t         tTestReaderNumOfTables(STqReader *pReader);
+
+// the decoded submit of the entry
+int64_t tTestSubmitEntrySize(STqSubmitEntry *pEntry);
+bool    tTestSubmitEntryEvicted(STqSubmitEntry *pEntry);
+int32_t tTestSubmitEntryNumOfTables(STqSubmitEntry *pEntry);
+int64_t tTestSubmitEntryUid(STqSubmitEntry *pEntry, int32_t iTable);
+int32_t tTestSubmitEntryNumOfRows(STqSubmitEntry *pEntry, int32_t iTable);
+int64_t tTestSubmitEntryRowTs(STqSubmitEntry *pEntry, int32_t iTable, int32_t iRow);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*_TD_VNODE_TQ_SUBMIT_CACHE_TEST_UTIL_H_*/
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "tsdbFSetJobPoolTestUtil.h"
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsign-compare"
+
+namespace {
+
+const int32_t kNumOfOpPerJob = 3;
+const int32_t kJobFailed = 0x7fff;
+
+// The jobs work like the commit and merge ones: each worker owns its state, the ops of a file set are swapped
+// into the slot of the job, and the slots are appended in job order once the pool is done.
+struct SJobs {
+  int32_t                           numOfWorkers;
+  int32_t                           failJob = -1;
+  int64_t                           jobSize = 1024;
+  std::vector<std::vector<int32_t>> workerOps;  // ops being built by each worker
+  std::vector<std::vector<int32_t>> jobOps;     // ops of each job, in the order of the jobs
+  std::vector<int32_t>              jobWorker;
+  std::atomic<int32_t>              numOfRun{0};
+  std::atomic<int32_t>              numOfRunning{0};
+  std::atomic<int32_t>              maxRunning{0};
+
+  SJobs(int32_t numOfJobs, int32_t numOfWorkers)
+      : numOfWorkers(numOfWorkers), workerOps(numOfWorkers), jobOps(numOfJobs), jobWorker(numOfJobs, -1) {}
+};
+
+int32_t fsetJob(void *arg, int32_t iWorker, int32_t iJob, int64_t *size) {
+  SJobs *jobs = (SJobs *)arg;
+
+  if (iWorker < 0 || iWorker >= jobs->numOfWorkers) return -1;
+  jobs->numOfRun++;
+  if (iJob == jobs->failJob) return kJobFailed;
+
+  int32_t running = ++jobs->numOfRunning;
+  for (int32_t max = jobs->maxRunning; running > max && !jobs->maxRunning.compare_exchange_weak(max, running);) {
+  }
+
+  std::vector<int32_t> &ops = jobs->workerOps[iWorker];
+  if (!ops.empty()) return -1;  // left over by the previous job of the worker
+  for (int32_t i = 0; i < kNumOfOpPerJob; ++i) {
+    ops.push_back(iJob * kNumOfOpPerJob + i);
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+  }
+  jobs->jobOps[iJob].swap(ops);
+  jobs->jobWorker[iJob] = iWorker;
+
+  --jobs->numOfRunning;
+  *size = jobs->jobSize;
+  return 0;
+}
+
+}  // namespace
+
+class TsdbFSetJobPoolTest : public ::testing::Test {
+ protected:
+  static void SetUpTestSuite() { ASSERT_EQ(tTestFSetJobPoolInit(8), 0); }
+  static void TearDownTestSuite() { tTestFSetJobPoolCleanup(); }
+};
+
+// every file set is handled once, by one of the workers, and the ops come out in file set order
+TEST_F(TsdbFSetJobPoolTest, allJobsDone) {
+  for (int32_t numOfWorkers : {1, 2, 4, 8}) {
+    const int32_t numOfJobs = 50;
+    SJobs         jobs(numOfJobs, numOfWorkers);
+    int32_t       numOfDone = 0;
+    int64_t       numOfBytes = 0;
+    int64_t       numOfPending = -1;
+
+    ASSERT_EQ(
+        tTestFSetJobPoolRun(numOfJobs, numOfWorkers, 0, fsetJob, &jobs, &numOfDone, &numOfBytes, &numOfPending), 0);
+    ASSERT_EQ(numOfDone, numOfJobs);
+    ASSERT_EQ(numOfBytes, numOfJobs * jobs.jobSize);
+    ASSERT_EQ(numOfPending, 0);
+    ASSERT_EQ(jobs.numOfRun, numOfJobs);
+    ASSERT_LE(jobs.maxRunning, numOfWorkers);
+    if (numOfWorkers > 1) {
+      ASSERT_GT(jobs.maxRunning, 1);
+    }
+
+    std::vector<int32_t> ops;
+    for (int32_t iJob = 0; iJob < numOfJobs; ++iJob) {
+      ASSERT_GE(jobs.jobWorker[iJob], 0);
+      ops.insert(ops.end(), jobs.jobOps[iJob].begin(), jobs.jobOps[iJob].end());
+    }
+    ASSERT_EQ(ops.size(), numOfJobs * kNumOfOpPerJob);
+    for (int32_t i = 0; i < ops.size(); ++i) {
+      ASSERT_EQ(ops[i], i);
+    }
+  }
+}
+
+// more workers than file sets, and no file set at all
+TEST_F(TsdbFSetJobPoolTest, fewJobs) {
+  for (int32_t numOfJobs : {0, 1, 3}) {
+    SJobs   jobs(numOfJobs, 8);
+    int32_t numOfDone = -1;
+    int64_t numOfBytes = -1;
+    int64_t numOfPending = -1;
+
+    ASSERT_EQ(tTestFSetJobPoolRun(numOfJobs, 8, 0, fsetJob, &jobs, &numOfDone, &numOfBytes, &numOfPending), 0);
+    ASSERT_EQ(numOfDone, numOfJobs);
+    ASSERT_EQ(numOfBytes, numOfJobs * jobs.jobSize);
+    ASSERT_EQ(jobs.numOfRun, numOfJobs);
+  }
+}
+
+// a failed file set fails the commit, and the workers stop taking new file sets
+TEST_F(TsdbFSetJobPoolTest, jobFailed) {
+  const int32_t numOfJobs = 200;
+  SJobs         jobs(numOfJobs, 4);
+  int32_t       numOfDone = 0;
+  int64_t       numOfBytes = 0;
+  int64_t       numOfPending = -1;
+
+  jobs.failJob = 10;
+  ASSERT_EQ(tTestFSetJobPoolRun(numOfJobs, 4, 0, fsetJob, &jobs, &numOfDone, &numOfBytes, &numOfPending),
+            kJobFailed);
+  ASSERT_LT(numOfDone, numOfJobs);
+  ASSERT_LT(jobs.numOfRun, numOfJobs);
+  ASSERT_EQ(numOfPending, 0);
+}
+
+// the write budget delays the file sets, so that the bytes written keep to it
+TEST_F(TsdbFSetJobPoolTest, ioBudget) {
+  const int32_t numOfJobs = 5;
+  SJobs         jobs(numOfJobs, 2);
+  int32_t       numOfDone = 0;
+  int64_t       numOfBytes = 0;
+  int64_t       numOfPending = -1;
+
+  jobs.jobSize = 256 * 1024;  // 1 MB in all after the first 4 file sets, the last one waits for it
+  auto start = std::chrono::steady_clock::now();
+  ASSERT_EQ(tTestFSetJobPoolRun(numOfJobs, 2, 1, fsetJob, &jobs, &numOfDone, &numOfBytes, &numOfPending), 0);
+  auto elapsedMs =
+      std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+  ASSERT_EQ(numOfDone, numOfJobs);
+  ASSERT_GE(elapsedMs, 700);
+}
+
+#pragma GCC diagnostic pop
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tsdbFSetJobPoolTestUtil.h"
+#include "tsdb.h"
+#include "tsdbUtil2.h"
+#include "vnd.h"
+
+int32_t tTestFSetJobPoolInit(int32_t numOfThreads) {
+  tsTsdbFSetThreads = numOfThreads;
+  return vnodeInit(1);
+}
+
+void tTestFSetJobPoolCleanup() { vnodeCleanup(); }
+
+int32_t tTestFSetJobPoolRun(int32_t numOfJobs, int32_t numOfWorkers, int32_t ioBudget, FTestFSetJob fn, void *arg,
+                            int32_t *numOfDone, int64_t *numOfBytes, int64_t *numOfPending) {
+  SVnode vnode = {0};
+  STsdb  tsdb = {.pVnode = &vnode};
+
+  SFSetJobPool pool = {
+      .tsdb = &tsdb,
+      .label = "tsdb-test",
+      .numOfJobs = numOfJobs,
+      .numOfWorkers = numOfWorkers,
+      .ioBudget = ioBudget,
+      .fn = fn,
+      .arg = arg,
+  };
+  int32_t code = tsdbFSetJobPoolRun(&pool);
+  *numOfDone = pool.numOfDone;
+  *numOfBytes = pool.numOfBytes;
+  *numOfPending = vnode.statis.nFSetJobs - vnode.statis.nFSetJobsDone;
+  return code;
+}
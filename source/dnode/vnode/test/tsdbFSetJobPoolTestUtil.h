@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _TD_VNODE_TSDB_FSET_JOB_POOL_TEST_UTIL_H_
+#define _TD_VNODE_TSDB_FSET_JOB_POOL_TEST_UTIL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// run the jobs on the file set job pool of the tsdb commit and merge
+typedef int32_t (*FTestFSetJob)(void *arg, int32_t iWorker, int32_t iJob, int64_t *size);
+
+// start and stop the vnode helper threads shared by the pools
+int32_t tTestFSetJobPoolInit(int32_t numOfThreads);
+void    tTestFSetJobPoolCleanup();
+
+// *numOfPending is the file sets still counted as pending in the vnode statistics once the pool is done
+int32_t tTestFSetJobPoolRun(int32_t numOfJobs, int32_t numOfWorkers, int32_t ioBudget, FTestFSetJob fn, void *arg,
+                            int32_t *numOfDone, int64_t *numOfBytes, int64_t *numOfPending);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*_TD_VNODE_TSDB_FSET_JOB_POOL_TEST_UTIL_H_*/
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "tsdbMemTableTestUtil.h"
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsign-compare"
+
+namespace {
+
+typedef std::pair<int64_t, int64_t> SKeyVer;  // (ts, version) of a row
+
+// the value column of each row keeps its key, so that the row can be checked against its source
+int32_t rowValue(int64_t ts, int64_t version) { return (int32_t)(ts * 1000 + version); }
+
+std::vector<int64_t> range(int64_t start, int64_t end, int64_t step = 1) {
+  std::vector<int64_t> keys;
+  for (int64_t ts = start; ts < end; ts += step) keys.push_back(ts);
+  return keys;
+}
+
+class TsdbMemTableTest : public ::testing::Test {
+ protected:
+  void SetUp() override { ASSERT_EQ(tTestMemTableOpen(&pMem), 0); }
+  void TearDown() override { tTestMemTableClose(pMem); }
+
+  void insert(int64_t version, const std::vector<int64_t> &keys, bool colFmt) {
+    std::vector<int32_t> vals;
+    for (int64_t ts : keys) {
+      vals.push_back(rowValue(ts, version));
+      expected.push_back(SKeyVer(ts, version));
+    }
+
+    if (colFmt) {
+      ASSERT_EQ(tTestMemTableInsertCol(pMem, version, keys.data(), vals.data(), keys.size()), 0);
+    } else {
+      ASSERT_EQ(tTestMemTableInsertRow(pMem, version, keys.data(), vals.data(), keys.size()), 0);
+    }
+  }
+
+  // iterate the table from pFrom, and check the rows are the expected ones in key order
+  void checkScan(const SKeyVer *pFrom, int8_t backward) {
+    std::vector<SKeyVer> keys = expected;
+    std::sort(keys.begin(), keys.end());
+    if (pFrom) {
+      if (backward) {
+        keys.erase(std::upper_bound(keys.begin(), keys.end(), *pFrom), keys.end());
+      } else {
+        keys.erase(keys.begin(), std::lower_bound(keys.begin(), keys.end(), *pFrom));
+      }
+    }
+    if (backward) std::reverse(keys.begin(), keys.end());
+
+    std::vector<STestMemRow> rows(expected.size() + 1);
+    int32_t nRow = tTestMemTableScan(pMem, pFrom != NULL, pFrom ? pFrom->first : 0, pFrom ? pFrom->second : 0,
+                                     backward, rows.data(), rows.size());
+    ASSERT_EQ(nRow, keys.size());
+    for (int32_t i = 0; i < nRow; ++i) {
+      ASSERT_EQ(rows[i].ts, keys[i].first);
+      ASSERT_EQ(rows[i].version, keys[i].second);
+      ASSERT_EQ(rows[i].val, rowValue(rows[i].ts, rows[i].version));
+    }
+  }
+
+  void checkAll() {
+    STestMemTableInfo info;
+    ASSERT_EQ(tTestMemTableGetInfo(pMem, &info), 0);
+    ASSERT_EQ(info.nRow, expected.size());
+
+    std::vector<SKeyVer> keys = expected;
+    std::sort(keys.begin(), keys.end());
+    ASSERT_EQ(info.minKey, keys.front().first);
+    ASSERT_EQ(info.maxKey, keys.back().first);
+
+    checkScan(NULL, 0);
+    checkScan(NULL, 1);
+
+    // seek from each key, and from the gaps around it
+    for (const SKeyVer &kv : keys) {
+      for (int64_t ts = kv.first - 1; ts <= kv.first + 1; ++ts) {
+        SKeyVer from(ts, kv.second);
+        checkScan(&from, 0);
+        checkScan(&from, 1);
+      }
+    }
+  }
+
+  STestMemTable       *pMem = NULL;
+  std::vector<SKeyVer> expected;  // keys of all the inserted rows
+};
+
+}  // namespace
+
+// in order column blocks are appended as chunks, and no row goes to the skiplist
+TEST_F(TsdbMemTableTest, orderedColInsert) {
+  insert(1, range(100, 200), true);
+  insert(2, range(200, 300, 3), true);
+  insert(3, {1000}, true);
+
+  STestMemTableInfo info;
+  ASSERT_EQ(tTestMemTableGetInfo(pMem, &info), 0);
+  ASSERT_EQ(info.nChunk, 3);
+  ASSERT_EQ(info.nSlRow, 0);
+
+  checkAll();
+}
+
+// out of order rows go to the skiplist, and the iterator merges them with the chunks
+TEST_F(TsdbMemTableTest, unorderedInsert) {
+  insert(1, range(100, 200, 2), true);
+  insert(2, {1, 3, 5, 7}, true);         // before the chunk rows
+  insert(3, range(151, 171, 2), true);   // in order, but before the last chunk row
+  insert(4, {50, 201, 10000}, false);
+  insert(5, range(10001, 10020), true);  // after all the rows, a chunk again
+  insert(6, {310, 320, 330}, false);
+
+  STestMemTableInfo info;
+  ASSERT_EQ(tTestMemTableGetInfo(pMem, &info), 0);
+  ASSERT_EQ(info.nChunk, 2);
+  ASSERT_EQ(info.nSlRow, 4 + 10 + 3 + 3);
+
+  checkAll();
+}
+
+// rows of the same timestamp from different versions are all kept, ordered by version
+TEST_F(TsdbMemTableTest, duplicateKeys) {
+  insert(1, range(100, 200), true);
+  insert(2, range(150, 160), true);  // same keys as the chunk rows of version 1
+  insert(3, {100, 199}, false);
+  insert(4, {199, 200}, true);  // the first key equals the last one in the table
+  insert(5, range(201, 210), true);
+
+  STestMemTableInfo info;
+  ASSERT_EQ(tTestMemTableGetInfo(pMem, &info), 0);
+  ASSERT_EQ(info.nChunk, 2);
+
+  checkAll();
+}
+
+// row format submits only use the skiplist
+TEST_F(TsdbMemTableTest, rowInsertOnly) {
+  insert(1, range(0, 50, 5), false);
+  insert(2, range(1, 50, 5), false);
+
+  STestMemTableInfo info;
+  ASSERT_EQ(tTestMemTableGetInfo(pMem, &info), 0);
+  ASSERT_EQ(info.nChunk, 0);
+
+  checkAll();
+}
+
+#pragma GCC diagnostic pop
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tsdbMemTableTestUtil.h"
+#include "tsdb.h"
+#include "vnd.h"
+
+#define TEST_MEM_SUID    0
+#define TEST_MEM_UID     1
+#define TEST_MEM_VAL_CID 2
+
+struct STestMemTable {
+  SVnode   *pVnode;
+  STsdb    *pTsdb;
+  STSchema *pTSchema;
+};
+
+int32_t tTestMemTableOpen(STestMemTable **ppMem) {
+  int32_t        code = 0;
+  STestMemTable *pMem = taosMemoryCalloc(1, sizeof(*pMem));
+  if (pMem == NULL) return TSDB_CODE_OUT_OF_MEMORY;
+
+  pMem->pVnode = taosMemoryCalloc(1, sizeof(SVnode));
+  pMem->pTsdb = taosMemoryCalloc(1, sizeof(STsdb));
+  if (pMem->pVnode == NULL || pMem->pTsdb == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _err;
+  }
+
+  SVnode *pVnode = pMem->pVnode;
+  pVnode->config.szBuf = VNODE_BUFPOOL_SEGMENTS * 1024 * 1024;
+  pVnode->config.tsdbCfg.slLevel = 5;
+  if (vnodeOpenBufPool(pVnode) != 0) {
+    code = terrno;
+    goto _err;
+  }
+  pVnode->inUse = pVnode->freeList;
+  pVnode->freeList = pVnode->inUse->freeNext;
+  pVnode->inUse->nRef = 1;
+
+  pMem->pTsdb->pVnode = pVnode;
+  code = tsdbMemTableCreate(pMem->pTsdb, &pMem->pTsdb->mem);
+  if (code) goto _err;
+
+  SSchema aSchema[] = {
+      {.type = TSDB_DATA_TYPE_TIMESTAMP, .colId = PRIMARYKEY_TIMESTAMP_COL_ID, .bytes = 8, .name = "ts"},
+      {.type = TSDB_DATA_TYPE_INT, .colId = TEST_MEM_VAL_CID, .bytes = 4, .name = "val"},
+  };
+  pMem->pTSchema = tBuildTSchema(aSchema, tListLen(aSchema), 1);
+  if (pMem->pTSchema == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _err;
+  }
+
+  *ppMem = pMem;
+  return code;
+
+_err:
+  tTestMemTableClose(pMem);
+  *ppMem = NULL;
+  return code;
+}
+
+void tTestMemTableClose(STestMemTable *pMem) {
+  if (pMem == NULL) return;
+
+  if (pMem->pTsdb && pMem->pTsdb->mem) {
+    // the buffer pool is released with the fake vnode below, not given back to the vnode free list
+    taosMemoryFree(pMem->pTsdb->mem->aBucket);
+    taosMemoryFree(pMem->pTsdb->mem);
+  }
+  if (pMem->pVnode) {
+    vnodeCloseBufPool(pMem->pVnode);
+  }
+  taosMemoryFree(pMem->pTSchema);
+  taosMemoryFree(pMem->pTsdb);
+  taosMemoryFree(pMem->pVnode);
+  taosMemoryFree(pMem);
+}
+
+int32_t tTestMemTableInsertCol(STestMemTable *pMem, int64_t version, const int64_t *aTs, const int32_t *aVal,
+                               int32_t nRow) {
+  int32_t       code = 0;
+  SSubmitTbData submitTbData = {.flags = SUBMIT_REQ_COLUMN_DATA_FORMAT, .suid = TEST_MEM_SUID, .uid = TEST_MEM_UID};
+
+  submitTbData.aCol = taosArrayInit(2, sizeof(SColData));
+  if (submitTbData.aCol == NULL) return TSDB_CODE_OUT_OF_MEMORY;
+
+  SColData *pTsCol = taosArrayReserve(submitTbData.aCol, 1);
+  SColData *pValCol = taosArrayReserve(submitTbData.aCol, 1);
+  tColDataInit(pTsCol, PRIMARYKEY_TIMESTAMP_COL_ID, TSDB_DATA_TYPE_TIMESTAMP, 0);
+  tColDataInit(pValCol, TEST_MEM_VAL_CID, TSDB_DATA_TYPE_INT, 0);
+  for (int32_t iRow = 0; iRow < nRow; iRow++) {
+    SColVal cv = COL_VAL_VALUE(PRIMARYKEY_TIMESTAMP_COL_ID, TSDB_DATA_TYPE_TIMESTAMP, (SValue){.val = aTs[iRow]});
+    code = tColDataAppendValue(pTsCol, &cv);
+    if (code) goto _exit;
+
+    cv = COL_VAL_VALUE(TEST_MEM_VAL_CID, TSDB_DATA_TYPE_INT, (SValue){.val = aVal[iRow]});
+    code = tColDataAppendValue(pValCol, &cv);
+    if (code) goto _exit;
+  }
+
+  int32_t affectedRows = 0;
+  code = tsdbInsertTableData(pMem->pTsdb, version, &submitTbData, &affectedRows);
+  if (code == 0 && affectedRows != nRow) code = TSDB_CODE_FAILED;
+
+_exit:
+  taosArrayDestroyEx(submitTbData.aCol, tColDataDestroy);
+  return code;
+}
+
+int32_t tTestMemTableInsertRow(STestMemTable *pMem, int64_t version, const int64_t *aTs, const int32_t *aVal,
+                               int32_t nRow) {
+  int32_t       code = 0;
+  SSubmitTbData submitTbData = {.suid = TEST_MEM_SUID, .uid = TEST_MEM_UID};
+  SArray       *aColVal = taosArrayInit(2, sizeof(SColVal));
+
+  submitTbData.aRowP = taosArrayInit(nRow, sizeof(SRow *));
+  if (aColVal == NULL || submitTbData.aRowP == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _exit;
+  }
+
+  for (int32_t iRow = 0; iRow < nRow; iRow++) {
+    taosArrayClear(aColVal);
+    SColVal cv = COL_VAL_VALUE(PRIMARYKEY_TIMESTAMP_COL_ID, TSDB_DATA_TYPE_TIMESTAMP, (SValue){.val = aTs[iRow]});
+    taosArrayPush(aColVal, &cv);
+    cv = COL_VAL_VALUE(TEST_MEM_VAL_CID, TSDB_DATA_TYPE_INT, (SValue){.val = aVal[iRow]});
+    taosArrayPush(aColVal, &cv);
+
+    SRow *pRow = NULL;
+    code = tRowBuild(aColVal, pMem->pTSchema, &pRow);
+    if (code) goto _exit;
+    taosArrayPush(submitTbData.aRowP, &pRow);
+  }
+
+  // the rows are copied into the memtable
+  int32_t affectedRows = 0;
+  code = tsdbInsertTableData(pMem->pTsdb, version, &submitTbData, &affectedRows);
+  if (code == 0 && affectedRows != nRow) code = TSDB_CODE_FAILED;
+
+_exit:
+  taosArrayDestroy(aColVal);
+  taosArrayDestroyP(submitTbData.aRowP, (FDelete)taosMemoryFree);
+  return code;
+}
+
+int32_t tTestMemTableGetInfo(STestMemTable *pMem, STestMemTableInfo *pInfo) {
+  STbData *pTbData = tsdbGetTbDataFromMemTable(pMem->pTsdb->mem, TEST_MEM_SUID, TEST_MEM_UID);
+  if (pTbData == NULL) return TSDB_CODE_NOT_FOUND;
+
+  pInfo->nChunk = 0;
+  for (SMemChunk *pChunk = pTbData->pChunkHead; pChunk; pChunk = pChunk->next) {
+    pInfo->nChunk++;
+  }
+  pInfo->nSlRow = pTbData->sl.size;
+  pInfo->nRow = tsdbGetNRowsInTbData(pTbData);
+  pInfo->minKey = pTbData->minKey;
+  pInfo->maxKey = pTbData->maxKey;
+  return 0;
+}
+
+int32_t tTestMemTableScan(STestMemTable *pMem, bool hasFrom, int64_t fromTs, int64_t fromVer, int8_t backward,
+                          STestMemRow *aRow, int32_t maxRow) {
+  STbData *pTbData = tsdbGetTbDataFromMemTable(pMem->pTsdb->mem, TEST_MEM_SUID, TEST_MEM_UID);
+  if (pTbData == NULL) return 0;
+
+  STbDataIter iter = {0};
+  TSDBKEY     from = {.version = fromVer, .ts = fromTs};
+  tsdbTbDataIterOpen(pTbData, hasFrom ? &from : NULL, backward, &iter);
+
+  int32_t nRow = 0;
+  for (TSDBROW *pRow = tsdbTbDataIterGet(&iter); pRow && nRow < maxRow; pRow = tsdbTbDataIterGet(&iter)) {
+    SColVal cv;
+    tsdbRowGetColVal(pRow, pMem->pTSchema, 1, &cv);
+
+    aRow[nRow].ts = TSDBROW_TS(pRow);
+    aRow[nRow].version = TSDBROW_VERSION(pRow);
+    aRow[nRow].val = COL_VAL_IS_VALUE(&cv) ? (int32_t)cv.value.val : INT32_MIN;
+    nRow++;
+
+    if (!tsdbTbDataIterNext(&iter)) break;
+  }
+
+  return nRow;
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _TD_VNODE_TSDB_MEM_TABLE_TEST_UTIL_H_
+#define _TD_VNODE_TSDB_MEM_TABLE_TEST_UTIL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct STestMemTable STestMemTable;
+
+typedef struct STestMemRow {
+  int64_t ts;
+  int64_t version;
+  int32_t val;
+} STestMemRow;
+
+typedef struct STestMemTableInfo {
+  int32_t nChunk;   // column blocks appended as chunks
+  int64_t nSlRow;   // rows in the skiplist
+  int64_t nRow;     // all the rows of the table
+  int64_t minKey;
+  int64_t maxKey;
+} STestMemTableInfo;
+
+// a memtable of one table (ts timestamp, val int), on the buffer pool of a fake vnode
+int32_t tTestMemTableOpen(STestMemTable **ppMem);
+void    tTestMemTableClose(STestMemTable *pMem);
+
+int32_t tTestMemTableInsertCol(STestMemTable *pMem, int64_t version, const int64_t *aTs, const int32_t *aVal,
+                               int32_t nRow);
+int32_t tTestMemTableInsertRow(STestMemTable *pMem, int64_t version, const int64_t *aTs, const int32_t *aVal,
+                               int32_t nRow);
+int32_t tTestMemTableGetInfo(STestMemTable *pMem, STestMemTableInfo *pInfo);
+
+// iterate the table from (fromTs, fromVer), or from the first/last row if hasFrom is false, and return the rows
+// read into aRow, at most maxRow
+int32_t tTestMemTableScan(STestMemTable *pMem, bool hasFrom, int64_t fromTs, int64_t fromVer, int8_t backward,
+                          STestMemRow *aRow, int32_t maxRow);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*_TD_VNODE_TSDB_MEM_TABLE_TEST_UTIL_H_*/
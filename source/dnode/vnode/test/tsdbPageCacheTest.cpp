@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "tsdbPageCacheTestUtil.h"
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsign-compare"
+
+namespace {
+
+const char   *kPath = "/tmp/tsdbPageCacheTest.data";
+const int32_t kPageSize = 4096;
+const int32_t kPageContentSize = kPageSize - 4;  // less the checksum
+const int32_t kNumOfPages = 4;
+
+class TsdbPageCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_EQ(tTestPgFileOpen(kPath, kPageSize, &pFile), 0);
+
+    data.resize(kPageContentSize * kNumOfPages);
+    for (int32_t i = 0; i < data.size(); i++) {
+      data[i] = i * 7 % 251;
+    }
+    ASSERT_EQ(tTestPgFileWrite(pFile, 0, data.data(), data.size()), 0);
+  }
+
+  void TearDown() override { tTestPgFileClose(pFile); }
+
+  void expectStat(int64_t hit, int64_t miss) {
+    int64_t nHit = 0, nMiss = 0;
+    tTestPgFileGetStat(pFile, &nHit, &nMiss);
+    EXPECT_EQ(nHit, hit);
+    EXPECT_EQ(nMiss, miss);
+  }
+
+  void expectData() {
+    std::vector<uint8_t> buf(data.size());
+    ASSERT_EQ(tTestPgFileRead(pFile, 0, buf.data(), buf.size()), 0);
+    ASSERT_EQ(buf, data);
+  }
+
+  // overwrite the bytes in place, in the file and in the expected data
+  std::vector<uint8_t> update(int64_t offset, int64_t size) {
+    std::vector<uint8_t> buf(size);
+    for (int32_t i = 0; i < size; i++) {
+      buf[i] = ~data[offset + i];
+      data[offset + i] = buf[i];
+    }
+    return buf;
+  }
+
+  STestPgFile         *pFile = NULL;
+  std::vector<uint8_t> data;
+};
+
+}  // namespace
+
+// a page is read from the file once, later reads of any fd are served by the cache
+TEST_F(TsdbPageCacheTest, hitAndMiss) {
+  expectStat(0, 0);
+
+  expectData();
+  expectStat(0, kNumOfPages);
+
+  expectData();
+  expectStat(kNumOfPages, kNumOfPages);
+
+  uint8_t buf[16];
+  ASSERT_EQ(tTestPgFileRead(pFile, kPageContentSize * 2 + 10, buf, sizeof(buf)), 0);
+  ASSERT_EQ(memcmp(buf, data.data() + kPageContentSize * 2 + 10, sizeof(buf)), 0);
+  expectStat(kNumOfPages + 1, kNumOfPages);
+}
+
+// a page rewritten in place is dropped from the cache, the other pages stay
+TEST_F(TsdbPageCacheTest, rewriteDropsPage) {
+  expectData();
+  expectStat(0, kNumOfPages);
+
+  // the writer loads the page from the cache before updating it
+  int64_t              offset = kPageContentSize * 2 + 10;
+  std::vector<uint8_t> buf = update(offset, 100);
+  ASSERT_EQ(tTestPgFileWrite(pFile, offset, buf.data(), buf.size()), 0);
+  expectStat(1, kNumOfPages);
+
+  expectData();
+  expectStat(1 + kNumOfPages - 1, kNumOfPages + 1);
+}
+
+// a reader that loaded a page before it was rewritten does not put the stale page back in the cache
+TEST_F(TsdbPageCacheTest, rewriteDropsRacingPage) {
+  // the write spans the pages 2 and 3, the reader loads the page 3
+  int64_t              offset = kPageContentSize * 2 - 50;
+  std::vector<uint8_t> buf = update(offset, 100);
+  ASSERT_EQ(tTestPgFileWriteRacing(pFile, offset, buf.data(), buf.size()), 0);
+  expectStat(1, 2);
+
+  expectData();
+  expectStat(1, 2 + kNumOfPages);
+}
+
+// a file truncated and written again under the same name drops the pages cached before
+TEST_F(TsdbPageCacheTest, truncateDropsPages) {
+  expectData();
+  expectStat(0, kNumOfPages);
+
+  std::vector<uint8_t> buf = update(0, data.size());
+  ASSERT_EQ(tTestPgFileRewrite(pFile, buf.data(), buf.size()), 0);
+  expectStat(0, kNumOfPages);
+
+  expectData();
+  expectStat(0, kNumOfPages * 2);
+}
+
+#pragma GCC diagnostic pop
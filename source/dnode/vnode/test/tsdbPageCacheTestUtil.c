@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tsdbPageCacheTestUtil.h"
+#include "tsdb.h"
+#include "vnd.h"
+
+struct STestPgFile {
+  SVnode *pVnode;
+  STsdb  *pTsdb;
+  int32_t szPage;
+  char    path[TSDB_FILENAME_LEN];
+};
+
+int32_t tTestPgFileOpen(const char *path, int32_t szPage, STestPgFile **ppFile) {
+  int32_t      code = 0;
+  STestPgFile *pFile = taosMemoryCalloc(1, sizeof(*pFile));
+  if (pFile == NULL) return TSDB_CODE_OUT_OF_MEMORY;
+
+  tstrncpy(pFile->path, path, sizeof(pFile->path));
+  pFile->szPage = szPage;
+  pFile->pVnode = taosMemoryCalloc(1, sizeof(SVnode));
+  pFile->pTsdb = taosMemoryCalloc(1, sizeof(STsdb));
+  if (pFile->pVnode == NULL || pFile->pTsdb == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _err;
+  }
+
+  pFile->pVnode->config.tsdbPageSize = szPage;
+  pFile->pVnode->pTsdb = pFile->pTsdb;
+  pFile->pTsdb->pVnode = pFile->pVnode;
+  pFile->pTsdb->pgCache = taosLRUCacheInit(1024 * 1024, -1, .5);
+  if (pFile->pTsdb->pgCache == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _err;
+  }
+  taosLRUCacheSetStrictCapacity(pFile->pTsdb->pgCache, false);
+  taosThreadMutexInit(&pFile->pTsdb->pgMutex, NULL);
+
+  (void)taosRemoveFile(path);
+  TdFilePtr pFD = taosOpenFile(path, TD_FILE_WRITE | TD_FILE_CREATE | TD_FILE_TRUNC);
+  if (pFD == NULL) {
+    code = TAOS_SYSTEM_ERROR(errno);
+    goto _err;
+  }
+  taosCloseFile(&pFD);
+
+  *ppFile = pFile;
+  return code;
+
+_err:
+  tTestPgFileClose(pFile);
+  *ppFile = NULL;
+  return code;
+}
+
+void tTestPgFileClose(STestPgFile *pFile) {
+  if (pFile == NULL) return;
+
+  if (pFile->pTsdb && pFile->pTsdb->pgCache) {
+    taosLRUCacheEraseUnrefEntries(pFile->pTsdb->pgCache);
+    taosLRUCacheCleanup(pFile->pTsdb->pgCache);
+    taosThreadMutexDestroy(&pFile->pTsdb->pgMutex);
+  }
+  (void)taosRemoveFile(pFile->path);
+  taosMemoryFree(pFile->pTsdb);
+  taosMemoryFree(pFile->pVnode);
+  taosMemoryFree(pFile);
+}
+
+int32_t tTestPgFileRead(STestPgFile *pFile, int64_t offset, uint8_t *pBuf, int64_t size) {
+  STsdbFD *pFD = NULL;
+  int32_t  code = tsdbOpenFile(pFile->path, pFile->pTsdb, pFile->szPage, TD_FILE_READ, &pFD);
+  if (code) return code;
+
+  code = tsdbReadFile(pFD, offset, pBuf, size);
+  tsdbCloseFile(&pFD);
+  return code;
+}
+
+static int32_t tTestPgFileDoWrite(STestPgFile *pFile, int32_t flag, int64_t offset, const uint8_t *pBuf,
+                                  int64_t size, bool racing) {
+  STsdbFD *pFD = NULL;
+  STsdbFD *pReadFD = NULL;
+  uint8_t  byte = 0;
+  int64_t  ver = atomic_load_64(&pFile->pTsdb->pgCacheVer);
+  int32_t  code = 0;
+
+  if (racing) {
+    code = tsdbOpenFile(pFile->path, pFile->pTsdb, pFile->szPage, TD_FILE_READ, &pReadFD);
+    if (code) goto _exit;
+
+    code = tsdbReadFile(pReadFD, offset + size - 1, &byte, 1);
+    if (code) goto _exit;
+  }
+
+  code = tsdbOpenFile(pFile->path, pFile->pTsdb, pFile->szPage, flag, &pFD);
+  if (code) goto _exit;
+
+  code = tsdbWriteFile(pFD, offset, pBuf, size);
+  if (code) goto _exit;
+
+  code = tsdbFsyncFile(pFD);
+  if (code) goto _exit;
+
+  if (racing) {
+    tsdbCachePutPage(pFile->pTsdb, pFile->path, pReadFD->pgno, pReadFD->pBuf, pReadFD->szPage, ver);
+  }
+
+_exit:
+  tsdbCloseFile(&pReadFD);
+  tsdbCloseFile(&pFD);
+  return code;
+}
+
+int32_t tTestPgFileWrite(STestPgFile *pFile, int64_t offset, const uint8_t *pBuf, int64_t size) {
+  return tTestPgFileDoWrite(pFile, TD_FILE_READ | TD_FILE_WRITE, offset, pBuf, size, false);
+}
+
+int32_t tTestPgFileWriteRacing(STestPgFile *pFile, int64_t offset, const uint8_t *pBuf, int64_t size) {
+  return tTestPgFileDoWrite(pFile, TD_FILE_READ | TD_FILE_WRITE, offset, pBuf, size, true);
+}
+
+int32_t tTestPgFileRewrite(STestPgFile *pFile, const uint8_t *pBuf, int64_t size) {
+  return tTestPgFileDoWrite(pFile, TD_FILE_READ | TD_FILE_WRITE | TD_FILE_CREATE | TD_FILE_TRUNC, 0, pBuf, size,
+                            false);
+}
+
+void tTestPgFileGetStat(STestPgFile *pFile, int64_t *hit, int64_t *miss) {
+  tsdbCacheGetPageStat(pFile->pVnode, hit, miss);
+}
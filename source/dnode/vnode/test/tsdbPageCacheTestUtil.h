@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _TD_VNODE_TSDB_PAGE_CACHE_TEST_UTIL_H_
+#define _TD_VNODE_TSDB_PAGE_CACHE_TEST_UTIL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// a tsdb file of szPage pages at path, read and written through the page cache of a fake vnode
+typedef struct STestPgFile STestPgFile;
+
+int32_t tTestPgFileOpen(const char *path, int32_t szPage, STestPgFile **ppFile);
+void    tTestPgFileClose(STestPgFile *pFile);
+
+// the offsets are logical ones, without the checksums of the pages
+int32_t tTestPgFileRead(STestPgFile *pFile, int64_t offset, uint8_t *pBuf, int64_t size);
+int32_t tTestPgFileWrite(STestPgFile *pFile, int64_t offset, const uint8_t *pBuf, int64_t size);
+
+// like tTestPgFileWrite, but a reader misses the last page written before the write and puts what it read in the
+// cache after the page is written and dropped, as a reader racing the writer would
+int32_t tTestPgFileWriteRacing(STestPgFile *pFile, int64_t offset, const uint8_t *pBuf, int64_t size);
+
+// truncate the file and write it again from the start
+int32_t tTestPgFileRewrite(STestPgFile *pFile, const uint8_t *pBuf, int64_t size);
+
+void tTestPgFileGetStat(STestPgFile *pFile, int64_t *hit, int64_t *miss);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*_TD_VNODE_TSDB_PAGE_CACHE_TEST_UTIL_H_*/
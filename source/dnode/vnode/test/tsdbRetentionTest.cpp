@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "stub.h"
+#include "tsdbRetentionTestUtil.h"
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsign-compare"
+
+// the meta of the fake vnode is stubbed, these declarations only give the stubs their addresses
+extern "C" {
+int32_t metaGetInfo(void *pMeta, int64_t uid, void *pInfo, void *pReader);
+int32_t metaGetTbTSchemaEx(void *pMeta, int64_t suid, int64_t uid, int32_t sver, void **ppTSchema);
+}
+
+namespace {
+
+const char   *kDir = "/tmp/tsdbRetentionTest";
+const int32_t kNumOfLevels = 3;
+const int32_t kMaxRows = 100;
+const int32_t kNumOfTables = 4;
+const int32_t kNumOfRows = 1000;
+const int8_t  kOneStageComp = 1;
+const int8_t  kTwoStageComp = 2;
+
+class TsdbRetentionTest : public ::testing::Test {
+ protected:
+  static void SetUpTestSuite() {
+    static Stub stub;
+    stub.set(metaGetInfo, tTestFSetMetaGetInfo);
+    stub.set(metaGetTbTSchemaEx, tTestFSetMetaGetTbTSchemaEx);
+  }
+
+  void TearDown() override { tTestFSetClose(pFSet); }
+
+  void open(int8_t cmprAlg) { ASSERT_EQ(tTestFSetOpen(kDir, kNumOfLevels, kMaxRows, cmprAlg, &pFSet), 0); }
+
+  // the data file holds kNumOfRows rows of each table at version 1, the stt file updates every 7th of them and adds
+  // rows in between at version 2
+  void write() {
+    std::vector<STestFSetRow> dataRows;
+    std::vector<STestFSetRow> sttRows;
+    for (int64_t uid = 1; uid <= kNumOfTables; uid++) {
+      for (int32_t i = 0; i < kNumOfRows; i++) {
+        int64_t ts = uid * 100000 + i * 10;
+        dataRows.push_back({uid, ts, 1, (int32_t)(uid * 10000 + i)});
+        if (i % 7 == 0) {
+          sttRows.push_back({uid, ts, 2, -i});
+        }
+        if (i % 20 == 0) {
+          sttRows.push_back({uid, ts + 5, 2, i * 2});
+        }
+      }
+    }
+    ASSERT_EQ(tTestFSetWrite(pFSet, false, dataRows.data(), dataRows.size(), dataTombs, 2), 0);
+    ASSERT_EQ(tTestFSetWrite(pFSet, true, sttRows.data(), sttRows.size(), sttTombs, 2), 0);
+
+    for (const auto &row : dataRows) put(row);
+    for (const auto &row : sttRows) put(row);
+  }
+
+  void put(const STestFSetRow &row) {
+    auto &expect = rows[std::make_pair(row.uid, row.ts)];
+    if (row.version >= expect.version) expect = row;
+  }
+
+  std::vector<STestFSetRow> scan() {
+    std::vector<STestFSetRow> aRow(kNumOfTables * kNumOfRows * 2);
+    int32_t                   nRow = 0;
+    EXPECT_EQ(tTestFSetScan(pFSet, aRow.data(), aRow.size(), &nRow), 0);
+    aRow.resize(nRow);
+    return aRow;
+  }
+
+  std::vector<STestTombRecord> scanTomb() {
+    std::vector<STestTombRecord> aTomb(16);
+    int32_t                      nTomb = 0;
+    EXPECT_EQ(tTestFSetScanTomb(pFSet, aTomb.data(), aTomb.size(), &nTomb), 0);
+    aTomb.resize(nTomb);
+    return aTomb;
+  }
+
+  STestFSet                                        *pFSet = NULL;
+  std::map<std::pair<int64_t, int64_t>, STestFSetRow> rows;  // the latest version of each key
+
+  STestTombRecord dataTombs[2] = {{2, 3, 200000, 200500}, {3, 3, 300100, 300200}};
+  STestTombRecord sttTombs[2] = {{3, 4, 300000, 300050}, {4, 4, 400000, 400900}};
+};
+
+bool sameRow(const STestFSetRow &row1, const STestFSetRow &row2) {
+  return row1.uid == row2.uid && row1.ts == row2.ts && row1.version == row2.version && row1.val == row2.val;
+}
+
+}  // namespace
+
+// the rewrite merges the stt files into larger blocks of the heavier codec, and the brin and sma match the blocks
+TEST_F(TsdbRetentionTest, recompressKeepsBrinAndSma) {
+  open(kOneStageComp);
+  write();
+
+  STestFSetInfo info;
+  ASSERT_EQ(tTestFSetGetInfo(pFSet, &info), 0);
+  ASSERT_EQ(info.level, 0);
+  ASSERT_EQ(info.numOfStt, 1);
+  ASSERT_EQ(info.maxBlockRows, kMaxRows);
+  ASSERT_EQ(info.cmprAlg, kOneStageComp);
+  ASSERT_EQ(info.numOfSma, info.numOfBlock);
+
+  ASSERT_EQ(tTestFSetRecompress(pFSet, 1, 0), 0);
+
+  ASSERT_EQ(tTestFSetGetInfo(pFSet, &info), 0);
+  ASSERT_EQ(info.level, 1);
+  ASSERT_EQ(info.numOfStt, 0);
+  ASSERT_EQ(info.maxBlockRows, kMaxRows * 4);
+  ASSERT_EQ(info.cmprAlg, kTwoStageComp);
+  ASSERT_GT(info.numOfBlock, 0);
+  ASSERT_EQ(info.numOfSma, info.numOfBlock);
+
+  // the stt updates replace the rows of the data file
+  std::vector<STestFSetRow> aRow = scan();
+  ASSERT_EQ(aRow.size(), rows.size());
+  auto it = rows.begin();
+  for (int32_t i = 0; i < aRow.size(); i++, it++) {
+    ASSERT_TRUE(sameRow(aRow[i], it->second)) << "uid:" << aRow[i].uid << " ts:" << aRow[i].ts;
+  }
+}
+
+// the rows and tomb records of the dropped tables are not rewritten
+TEST_F(TsdbRetentionTest, recompressRemovesDroppedTables) {
+  open(kOneStageComp);
+  write();
+
+  tTestFSetDropTable(pFSet, 2);
+  tTestFSetDropTable(pFSet, 4);
+  ASSERT_EQ(tTestFSetRecompress(pFSet, 2, 0), 0);
+
+  STestFSetInfo info;
+  ASSERT_EQ(tTestFSetGetInfo(pFSet, &info), 0);
+  ASSERT_EQ(info.level, 2);
+  ASSERT_EQ(info.numOfSma, info.numOfBlock);
+
+  std::vector<STestFSetRow> aRow = scan();
+  std::set<int64_t>         uids;
+  for (const auto &row : aRow) {
+    uids.insert(row.uid);
+  }
+  ASSERT_EQ(uids, std::set<int64_t>({1, 3}));
+
+  size_t numOfRows = 0;
+  for (const auto &row : rows) {
+    if (row.first.first == 1 || row.first.first == 3) numOfRows++;
+  }
+  ASSERT_EQ(aRow.size(), numOfRows);
+
+  std::vector<STestTombRecord> aTomb = scanTomb();
+  ASSERT_EQ(aTomb.size(), 2);
+  for (const auto &tomb : aTomb) {
+    ASSERT_EQ(tomb.uid, 3);
+  }
+}
+
+// the tomb records of the data and the stt files are carried over to the rewritten file set
+TEST_F(TsdbRetentionTest, recompressKeepsTombRecords) {
+  open(kOneStageComp);
+  write();
+  ASSERT_EQ(scanTomb().size(), 4);
+
+  ASSERT_EQ(tTestFSetRecompress(pFSet, 1, kMaxRows * 2), 0);
+
+  STestFSetInfo info;
+  ASSERT_EQ(tTestFSetGetInfo(pFSet, &info), 0);
+  ASSERT_EQ(info.maxBlockRows, kMaxRows * 2);
+
+  std::vector<STestTombRecord> expect = {dataTombs[0], dataTombs[1], sttTombs[0], sttTombs[1]};
+  std::vector<STestTombRecord> aTomb = scanTomb();
+  ASSERT_EQ(aTomb.size(), expect.size());
+  for (int32_t i = 0; i < aTomb.size(); i++) {
+    ASSERT_EQ(aTomb[i].uid, expect[i].uid);
+    ASSERT_EQ(aTomb[i].version, expect[i].version);
+    ASSERT_EQ(aTomb[i].skey, expect[i].skey);
+    ASSERT_EQ(aTomb[i].ekey, expect[i].ekey);
+  }
+}
+
+// the file set is only rewritten if the codec is heavier or the blocks larger than those of the vnode
+TEST_F(TsdbRetentionTest, recompressOnlyIfHeavier) {
+  open(kTwoStageComp);
+  write();
+
+  ASSERT_FALSE(tTestFSetShouldRecompress(pFSet, 0, 0));
+  ASSERT_FALSE(tTestFSetShouldRecompress(pFSet, 1, kMaxRows));
+  ASSERT_FALSE(tTestFSetShouldRecompress(pFSet, 1, kMaxRows / 2));
+  ASSERT_TRUE(tTestFSetShouldRecompress(pFSet, 1, 0));
+  ASSERT_TRUE(tTestFSetShouldRecompress(pFSet, 1, kMaxRows * 2));
+
+  // the data file is rewritten once, when the file set reaches the tier
+  ASSERT_EQ(tTestFSetRecompress(pFSet, 1, 0), 0);
+  ASSERT_FALSE(tTestFSetShouldRecompress(pFSet, 1, 0));
+  ASSERT_TRUE(tTestFSetShouldRecompress(pFSet, 2, 0));
+}
+
+// the heavier codec alone is worth the rewrite, even with smaller blocks
+TEST_F(TsdbRetentionTest, recompressToHeavierCodec) {
+  open(kOneStageComp);
+  write();
+
+  ASSERT_TRUE(tTestFSetShouldRecompress(pFSet, 1, kMaxRows / 2));
+  ASSERT_EQ(tTestFSetRecompress(pFSet, 1, kMaxRows / 2), 0);
+
+  STestFSetInfo info;
+  ASSERT_EQ(tTestFSetGetInfo(pFSet, &info), 0);
+  ASSERT_EQ(info.cmprAlg, kTwoStageComp);
+  ASSERT_EQ(info.maxBlockRows, kMaxRows / 2);
+  ASSERT_EQ(scan().size(), rows.size());
+}
+
+#pragma GCC diagnostic pop
@@ -0,0 +1,502 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tsdbRetentionTestUtil.h"
+#include "tsdb.h"
+#include "tsdbFSetRW.h"
+#include "tsdbIter.h"
+#include "vnd.h"
+
+#define TEST_FSET_VGID        2
+#define TEST_FSET_FID         1
+#define TEST_FSET_SUID        100
+#define TEST_FSET_VAL_CID     2
+#define TEST_FSET_MAX_DROPPED 16
+
+// the rewrite of a migrated file set is internal to tsdbRetention.c
+extern bool    tsdbShouldRecompress(STsdb *tsdb, const STFileSet *fset, const SDiskID *did);
+extern int32_t tsdbRecompressFileSet(STsdb *tsdb, STFileSet *fset, const SDiskID *did, int64_t cid,
+                                     TFileOpArray *fopArr);
+
+struct STestFSet {
+  char       dir[TSDB_FILENAME_LEN];
+  SVnode    *pVnode;
+  STsdb     *pTsdb;
+  STFileSet *fset;
+  int64_t    cid;
+  int32_t    numOfDropped;
+  int64_t    aDropped[TEST_FSET_MAX_DROPPED];
+};
+
+static STSchema *tTestFSetBuildSchema() {
+  SSchema aSchema[] = {
+      {.type = TSDB_DATA_TYPE_TIMESTAMP,
+       .flags = COL_SMA_ON,
+       .colId = PRIMARYKEY_TIMESTAMP_COL_ID,
+       .bytes = 8,
+       .name = "ts"},
+      {.type = TSDB_DATA_TYPE_INT, .flags = COL_SMA_ON, .colId = TEST_FSET_VAL_CID, .bytes = 4, .name = "val"},
+  };
+  return tBuildTSchema(aSchema, tListLen(aSchema), 1);
+}
+
+int32_t tTestFSetOpen(const char *dir, int32_t numOfLevels, int32_t maxRows, int8_t cmprAlg, STestFSet **ppFSet) {
+  int32_t    code = 0;
+  STestFSet *pFSet = taosMemoryCalloc(1, sizeof(*pFSet));
+  if (pFSet == NULL) return TSDB_CODE_OUT_OF_MEMORY;
+
+  tstrncpy(pFSet->dir, dir, sizeof(pFSet->dir));
+  pFSet->pVnode = taosMemoryCalloc(1, sizeof(SVnode));
+  pFSet->pTsdb = taosMemoryCalloc(1, sizeof(STsdb));
+  if (pFSet->pVnode == NULL || pFSet->pTsdb == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _err;
+  }
+
+  // a disk on each tier, the primary one on the hot tier
+  SDiskCfg aDiskCfg[TFS_MAX_TIERS] = {0};
+  for (int32_t level = 0; level < numOfLevels; level++) {
+    snprintf(aDiskCfg[level].dir, sizeof(aDiskCfg[level].dir), "%s%slevel%d", dir, TD_DIRSEP, level);
+    aDiskCfg[level].level = level;
+    aDiskCfg[level].primary = (level == 0);
+    if (taosMulMkDir(aDiskCfg[level].dir) != 0) {
+      code = TAOS_SYSTEM_ERROR(errno);
+      goto _err;
+    }
+  }
+
+  SVnode *pVnode = pFSet->pVnode;
+  pVnode->config.vgId = TEST_FSET_VGID;
+  pVnode->config.tsdbPageSize = 4096;
+  pVnode->config.tsdbCfg.minRows = 10;
+  pVnode->config.tsdbCfg.maxRows = maxRows;
+  pVnode->config.tsdbCfg.compression = cmprAlg;
+  pVnode->pTfs = tfsOpen(aDiskCfg, numOfLevels);
+  if (pVnode->pTfs == NULL) {
+    code = terrno;
+    goto _err;
+  }
+  // the meta is only passed back to the meta stubs of the tests
+  pVnode->pMeta = (SMeta *)pFSet;
+
+  STsdb *pTsdb = pFSet->pTsdb;
+  pTsdb->pVnode = pVnode;
+  pTsdb->path = taosStrdup("vnode2" TD_DIRSEP "tsdb");
+  if (pTsdb->path == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _err;
+  }
+  SDiskID did = {.level = 0, .id = 0};
+  code = tfsMkdirRecurAt(pVnode->pTfs, pTsdb->path, did);
+  if (code) goto _err;
+
+  code = tsdbTFileSetInit(TEST_FSET_FID, &pFSet->fset);
+  if (code) goto _err;
+
+  *ppFSet = pFSet;
+  return code;
+
+_err:
+  tTestFSetClose(pFSet);
+  *ppFSet = NULL;
+  return code;
+}
+
+void tTestFSetClose(STestFSet *pFSet) {
+  if (pFSet == NULL) return;
+
+  if (pFSet->fset) {
+    tsdbTFileSetClear(&pFSet->fset);
+  }
+  if (pFSet->pVnode) {
+    tfsClose(pFSet->pVnode->pTfs);
+  }
+  if (pFSet->pTsdb) {
+    taosMemoryFree(pFSet->pTsdb->path);
+  }
+  taosRemoveDir(pFSet->dir);
+  taosMemoryFree(pFSet->pTsdb);
+  taosMemoryFree(pFSet->pVnode);
+  taosMemoryFree(pFSet);
+}
+
+static int32_t tTestFSetEdit(STestFSet *pFSet, const TFileOpArray *fopArr) {
+  const STFileOp *op;
+  TARRAY2_FOREACH_PTR(fopArr, op) {
+    int32_t code = tsdbTFileSetEdit(pFSet->pTsdb, pFSet->fset, op);
+    if (code) return code;
+  }
+  return 0;
+}
+
+int32_t tTestFSetWrite(STestFSet *pFSet, bool toStt, const STestFSetRow *aRow, int32_t nRow,
+                       const STestTombRecord *aTomb, int32_t nTomb) {
+  if (!toStt && pFSet->fset->farr[TSDB_FTYPE_HEAD] != NULL) return TSDB_CODE_INVALID_PARA;
+
+  int32_t      code = 0;
+  SFSetWriter *writer = NULL;
+  TFileOpArray fopArr[1] = {0};
+  SArray      *aColVal = taosArrayInit(2, sizeof(SColVal));
+  STSchema    *pTSchema = tTestFSetBuildSchema();
+  SRow        *pRow = NULL;
+  if (aColVal == NULL || pTSchema == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _exit;
+  }
+
+  SVnodeCfg        *pCfg = &pFSet->pVnode->config;
+  SFSetWriterConfig config = {
+      .tsdb = pFSet->pTsdb,
+      .toSttOnly = toStt,
+      .compactVersion = INT64_MAX,
+      .minRow = pCfg->tsdbCfg.minRows,
+      .maxRow = pCfg->tsdbCfg.maxRows,
+      .szPage = pCfg->tsdbPageSize,
+      .cmprAlg = pCfg->tsdbCfg.compression,
+      .fid = TEST_FSET_FID,
+      .cid = ++pFSet->cid,
+      .did = {.level = 0, .id = 0},
+      .level = 0,
+  };
+  code = tsdbFSetWriterOpen(&config, &writer);
+  if (code) goto _exit;
+
+  for (int32_t iRow = 0; iRow < nRow; iRow++) {
+    taosArrayClear(aColVal);
+    SColVal cv = COL_VAL_VALUE(PRIMARYKEY_TIMESTAMP_COL_ID, TSDB_DATA_TYPE_TIMESTAMP, (SValue){.val = aRow[iRow].ts});
+    taosArrayPush(aColVal, &cv);
+    cv = COL_VAL_VALUE(TEST_FSET_VAL_CID, TSDB_DATA_TYPE_INT, (SValue){.val = aRow[iRow].val});
+    taosArrayPush(aColVal, &cv);
+
+    code = tRowBuild(aColVal, pTSchema, &pRow);
+    if (code) goto _exit;
+
+    SRowInfo row = {
+        .suid = TEST_FSET_SUID,
+        .uid = aRow[iRow].uid,
+        .row = tsdbRowFromTSRow(aRow[iRow].version, pRow),
+    };
+    code = tsdbFSetWriteRow(writer, &row);
+    if (code) goto _exit;
+
+    // the writer copies the row into its block data
+    taosMemoryFreeClear(pRow);
+  }
+
+  for (int32_t iTomb = 0; iTomb < nTomb; iTomb++) {
+    STombRecord record = {
+        .suid = TEST_FSET_SUID,
+        .uid = aTomb[iTomb].uid,
+        .version = aTomb[iTomb].version,
+        .skey = aTomb[iTomb].skey,
+        .ekey = aTomb[iTomb].ekey,
+    };
+    code = tsdbFSetWriteTombRecord(writer, &record);
+    if (code) goto _exit;
+  }
+
+  code = tsdbFSetWriterClose(&writer, 0, fopArr);
+  if (code) goto _exit;
+
+  code = tTestFSetEdit(pFSet, fopArr);
+
+_exit:
+  tsdbFSetWriterClose(&writer, 1, NULL);
+  TARRAY2_DESTROY(fopArr, NULL);
+  taosMemoryFree(pRow);
+  taosMemoryFree(pTSchema);
+  taosArrayDestroy(aColVal);
+  return code;
+}
+
+void tTestFSetDropTable(STestFSet *pFSet, int64_t uid) {
+  if (pFSet->numOfDropped < TEST_FSET_MAX_DROPPED) {
+    pFSet->aDropped[pFSet->numOfDropped++] = uid;
+  }
+}
+
+bool tTestFSetShouldRecompress(STestFSet *pFSet, int32_t level, int32_t maxRows) {
+  tsTsdbRecompressLevel = level;
+  tsTsdbRecompressMaxRows = maxRows;
+
+  SDiskID did = {.level = level, .id = 0};
+  return tsdbShouldRecompress(pFSet->pTsdb, pFSet->fset, &did);
+}
+
+int32_t tTestFSetRecompress(STestFSet *pFSet, int32_t level, int32_t maxRows) {
+  int32_t      code = 0;
+  STfs        *pTfs = pFSet->pVnode->pTfs;
+  SDiskID      did;
+  TFileOpArray fopArr[1] = {0};
+
+  tsTsdbRecompressLevel = level;
+  tsTsdbRecompressMaxRows = maxRows;
+
+  if (tfsAllocDisk(pTfs, level, &did) < 0) return terrno;
+  code = tfsMkdirRecurAt(pTfs, pFSet->pTsdb->path, did);
+  if (code) return code;
+
+  code = tsdbRecompressFileSet(pFSet->pTsdb, pFSet->fset, &did, ++pFSet->cid, fopArr);
+  if (code == 0) {
+    code = tTestFSetEdit(pFSet, fopArr);
+  }
+  TARRAY2_DESTROY(fopArr, NULL);
+  return code;
+}
+
+// the readers and the merged iterators of the data or the tomb records of the file set
+typedef struct {
+  SDataFileReader    *dataReader;
+  TSttFileReaderArray sttReaderArr[1];
+  TTsdbIterArray      iterArr[1];
+  SIterMerger        *merger;
+} STestFSetReader;
+
+static void tTestFSetReaderClose(STestFSetReader *pReader) {
+  tsdbIterMergerClose(&pReader->merger);
+  TARRAY2_DESTROY(pReader->iterArr, tsdbIterClose);
+  TARRAY2_DESTROY(pReader->sttReaderArr, tsdbSttFileReaderClose);
+  tsdbDataFileReaderClose(&pReader->dataReader);
+}
+
+static int32_t tTestFSetReaderOpen(STestFSet *pFSet, bool isTomb, STestFSetReader *pReader) {
+  int32_t         code = 0;
+  STsdbIter      *iter = NULL;
+  STsdbIterConfig iterConfig = {0};
+  STFileObj      *fobj;
+
+  SDataFileReaderConfig config = {.tsdb = pFSet->pTsdb, .szPage = pFSet->pVnode->config.tsdbPageSize};
+  for (int32_t ftype = 0; ftype < TSDB_FTYPE_MAX; ftype++) {
+    if ((fobj = pFSet->fset->farr[ftype]) == NULL) continue;
+    config.files[ftype].exist = true;
+    config.files[ftype].file = fobj->f[0];
+  }
+  if (config.files[TSDB_FTYPE_HEAD].exist || config.files[TSDB_FTYPE_TOMB].exist) {
+    code = tsdbDataFileReaderOpen(NULL, &config, &pReader->dataReader);
+    if (code) goto _exit;
+
+    iterConfig.type = isTomb ? TSDB_ITER_TYPE_DATA_TOMB : TSDB_ITER_TYPE_DATA;
+    iterConfig.dataReader = pReader->dataReader;
+    code = tsdbIterOpen(&iterConfig, &iter);
+    if (code) goto _exit;
+
+    code = TARRAY2_APPEND(pReader->iterArr, iter);
+    if (code) goto _exit;
+  }
+
+  SSttLvl *lvl;
+  TARRAY2_FOREACH(pFSet->fset->lvlArr, lvl) {
+    TARRAY2_FOREACH(lvl->fobjArr, fobj) {
+      SSttFileReader      *sttReader = NULL;
+      SSttFileReaderConfig sttConfig = {
+          .tsdb = pFSet->pTsdb,
+          .szPage = pFSet->pVnode->config.tsdbPageSize,
+          .file[0] = fobj->f[0],
+      };
+      code = tsdbSttFileReaderOpen(fobj->fname, &sttConfig, &sttReader);
+      if (code) goto _exit;
+
+      code = TARRAY2_APPEND(pReader->sttReaderArr, sttReader);
+      if (code) {
+        tsdbSttFileReaderClose(&sttReader);
+        goto _exit;
+      }
+
+      iterConfig.type = isTomb ? TSDB_ITER_TYPE_STT_TOMB : TSDB_ITER_TYPE_STT;
+      iterConfig.sttReader = sttReader;
+      code = tsdbIterOpen(&iterConfig, &iter);
+      if (code) goto _exit;
+
+      code = TARRAY2_APPEND(pReader->iterArr, iter);
+      if (code) goto _exit;
+    }
+  }
+
+  code = tsdbIterMergerOpen(pReader->iterArr, &pReader->merger, isTomb);
+
+_exit:
+  if (code) {
+    tTestFSetReaderClose(pReader);
+  }
+  return code;
+}
+
+int32_t tTestFSetScan(STestFSet *pFSet, STestFSetRow *aRow, int32_t maxRow, int32_t *nRow) {
+  STestFSetReader reader = {0};
+  STSchema       *pTSchema = tTestFSetBuildSchema();
+  if (pTSchema == NULL) return TSDB_CODE_OUT_OF_MEMORY;
+
+  *nRow = 0;
+  int32_t code = tTestFSetReaderOpen(pFSet, false, &reader);
+  if (code) goto _exit;
+
+  for (SRowInfo *row; *nRow < maxRow && (row = tsdbIterMergerGetData(reader.merger)) != NULL;) {
+    SColVal cv;
+    tsdbRowGetColVal(&row->row, pTSchema, 1, &cv);
+
+    aRow[*nRow].uid = row->uid;
+    aRow[*nRow].ts = TSDBROW_TS(&row->row);
+    aRow[*nRow].version = TSDBROW_VERSION(&row->row);
+    aRow[*nRow].val = COL_VAL_IS_VALUE(&cv) ? (int32_t)cv.value.val : INT32_MIN;
+    (*nRow)++;
+
+    code = tsdbIterMergerNext(reader.merger);
+    if (code) goto _exit;
+  }
+
+_exit:
+  tTestFSetReaderClose(&reader);
+  taosMemoryFree(pTSchema);
+  return code;
+}
+
+int32_t tTestFSetScanTomb(STestFSet *pFSet, STestTombRecord *aTomb, int32_t maxTomb, int32_t *nTomb) {
+  STestFSetReader reader = {0};
+
+  *nTomb = 0;
+  int32_t code = tTestFSetReaderOpen(pFSet, true, &reader);
+  if (code) goto _exit;
+
+  for (STombRecord *record; *nTomb < maxTomb && (record = tsdbIterMergerGetTombRecord(reader.merger)) != NULL;) {
+    aTomb[*nTomb].uid = record->uid;
+    aTomb[*nTomb].version = record->version;
+    aTomb[*nTomb].skey = record->skey;
+    aTomb[*nTomb].ekey = record->ekey;
+    (*nTomb)++;
+
+    code = tsdbIterMergerNext(reader.merger);
+    if (code) goto _exit;
+  }
+
+_exit:
+  tTestFSetReaderClose(&reader);
+  return code;
+}
+
+// the first and last keys of the brin record and the sma of the val column agree with the block data
+static bool tTestFSetCheckBlock(const SBrinRecord *record, SBlockData *bData, const TColumnDataAggArray *aggArr) {
+  if (bData->nRow != record->numRow || bData->nRow == 0) return false;
+  if (bData->aTSKEY[0] != record->firstKey || bData->aTSKEY[bData->nRow - 1] != record->lastKey) return false;
+
+  SColData *pColData = NULL;
+  tBlockDataGetColData(bData, TEST_FSET_VAL_CID, &pColData);
+  if (pColData == NULL) return false;
+
+  int64_t sum = 0;
+  int64_t min = INT64_MAX;
+  int64_t max = INT64_MIN;
+  for (int32_t iRow = 0; iRow < bData->nRow; iRow++) {
+    SColVal cv;
+    tColDataGetValue(pColData, iRow, &cv);
+    int64_t val = (int32_t)cv.value.val;
+    sum += val;
+    min = TMIN(min, val);
+    max = TMAX(max, val);
+  }
+
+  const SColumnDataAgg *agg;
+  TARRAY2_FOREACH_PTR(aggArr, agg) {
+    if (agg->colId == TEST_FSET_VAL_CID) {
+      return agg->sum == sum && agg->min == min && agg->max == max;
+    }
+  }
+  return false;
+}
+
+int32_t tTestFSetGetInfo(STestFSet *pFSet, STestFSetInfo *pInfo) {
+  int32_t             code = 0;
+  SDataFileReader    *reader = NULL;
+  SBrinBlock          brinBlock[1] = {0};
+  SBlockData          bData[1] = {0};
+  TColumnDataAggArray aggArr[1] = {0};
+
+  memset(pInfo, 0, sizeof(*pInfo));
+  pInfo->level = -1;
+
+  SSttLvl *lvl;
+  TARRAY2_FOREACH(pFSet->fset->lvlArr, lvl) { pInfo->numOfStt += TARRAY2_SIZE(lvl->fobjArr); }
+
+  STFileObj *fobj = pFSet->fset->farr[TSDB_FTYPE_HEAD];
+  if (fobj == NULL) return 0;
+  pInfo->level = fobj->f->did.level;
+
+  SDataFileReaderConfig config = {.tsdb = pFSet->pTsdb, .szPage = pFSet->pVnode->config.tsdbPageSize};
+  for (int32_t ftype = 0; ftype < TSDB_FTYPE_MAX; ftype++) {
+    if ((fobj = pFSet->fset->farr[ftype]) == NULL) continue;
+    config.files[ftype].exist = true;
+    config.files[ftype].file = fobj->f[0];
+  }
+
+  tBrinBlockInit(brinBlock);
+  tBlockDataCreate(bData);
+
+  code = tsdbDataFileReaderOpen(NULL, &config, &reader);
+  if (code) goto _exit;
+
+  const TBrinBlkArray *brinBlkArray = NULL;
+  code = tsdbDataFileReadBrinBlk(reader, &brinBlkArray);
+  if (code) goto _exit;
+
+  const SBrinBlk *brinBlk;
+  TARRAY2_FOREACH_PTR(brinBlkArray, brinBlk) {
+    pInfo->cmprAlg = brinBlk->cmprAlg;
+
+    code = tsdbDataFileReadBrinBlock(reader, brinBlk, brinBlock);
+    if (code) goto _exit;
+
+    for (int32_t i = 0; i < BRIN_BLOCK_SIZE(brinBlock); i++) {
+      SBrinRecord record;
+      tBrinBlockGet(brinBlock, i, &record);
+      pInfo->numOfBlock++;
+      pInfo->maxBlockRows = TMAX(pInfo->maxBlockRows, record.numRow);
+
+      code = tsdbDataFileReadBlockData(reader, &record, bData);
+      if (code) goto _exit;
+
+      code = tsdbDataFileReadBlockSma(reader, &record, aggArr);
+      if (code) goto _exit;
+
+      if (tTestFSetCheckBlock(&record, bData, aggArr)) {
+        pInfo->numOfSma++;
+      }
+    }
+  }
+
+_exit:
+  TARRAY2_DESTROY(aggArr, NULL);
+  tBlockDataDestroy(bData);
+  tBrinBlockDestroy(brinBlock);
+  tsdbDataFileReaderClose(&reader);
+  return code;
+}
+
+int32_t tTestFSetMetaGetInfo(void *pMeta, int64_t uid, void *pInfo, void *pReader) {
+  STestFSet *pFSet = pMeta;
+  for (int32_t i = 0; i < pFSet->numOfDropped; i++) {
+    if (pFSet->aDropped[i] == uid) return TSDB_CODE_NOT_FOUND;
+  }
+
+  SMetaInfo *pMetaInfo = pInfo;
+  pMetaInfo->uid = uid;
+  pMetaInfo->suid = TEST_FSET_SUID;
+  pMetaInfo->version = 1;
+  pMetaInfo->skmVer = 1;
+  return 0;
+}
+
+int32_t tTestFSetMetaGetTbTSchemaEx(void *pMeta, int64_t suid, int64_t uid, int32_t sver, void **ppTSchema) {
+  *ppTSchema = tTestFSetBuildSchema();
+  return *ppTSchema ? 0 : TSDB_CODE_OUT_OF_MEMORY;
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _TD_VNODE_TSDB_RETENTION_TEST_UTIL_H_
+#define _TD_VNODE_TSDB_RETENTION_TEST_UTIL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// a file set of the child tables of one super table (ts timestamp, val int), on a fake vnode with a disk on each of
+// the numOfLevels tiers under dir
+typedef struct STestFSet STestFSet;
+
+typedef struct STestFSetRow {
+  int64_t uid;
+  int64_t ts;
+  int64_t version;
+  int32_t val;
+} STestFSetRow;
+
+typedef struct STestTombRecord {
+  int64_t uid;
+  int64_t version;
+  int64_t skey;
+  int64_t ekey;
+} STestTombRecord;
+
+typedef struct STestFSetInfo {
+  int32_t level;         // tier of the data file
+  int32_t numOfStt;      // stt files
+  int32_t numOfBlock;    // brin records of the data file
+  int32_t numOfSma;      // brin records whose keys and sma agree with the block
+  int32_t maxBlockRows;  // rows of the largest block
+  int8_t  cmprAlg;       // compression of the brin blocks
+} STestFSetInfo;
+
+int32_t tTestFSetOpen(const char *dir, int32_t numOfLevels, int32_t maxRows, int8_t cmprAlg, STestFSet **ppFSet);
+void    tTestFSetClose(STestFSet *pFSet);
+
+// write the rows, sorted by uid, ts and version, and the tomb records, sorted by uid, to a new data file of the file
+// set, or to a new stt file
+int32_t tTestFSetWrite(STestFSet *pFSet, bool toStt, const STestFSetRow *aRow, int32_t nRow,
+                       const STestTombRecord *aTomb, int32_t nTomb);
+
+// the table is dropped from the meta
+void tTestFSetDropTable(STestFSet *pFSet, int64_t uid);
+
+// whether the file set migrated to the tier is rewritten with the block size, or its files copied
+bool tTestFSetShouldRecompress(STestFSet *pFSet, int32_t level, int32_t maxRows);
+
+// migrate the file set to the tier by rewriting it with the heaviest codec and the block size
+int32_t tTestFSetRecompress(STestFSet *pFSet, int32_t level, int32_t maxRows);
+
+int32_t tTestFSetGetInfo(STestFSet *pFSet, STestFSetInfo *pInfo);
+
+// merge the data and stt files, and return the rows and tomb records read, at most maxRow and maxTomb
+int32_t tTestFSetScan(STestFSet *pFSet, STestFSetRow *aRow, int32_t maxRow, int32_t *nRow);
+int32_t tTestFSetScanTomb(STestFSet *pFSet, STestTombRecord *aTomb, int32_t maxTomb, int32_t *nTomb);
+
+// the meta of the fake vnode, for the tests to stub metaGetInfo and metaGetTbTSchemaEx with
+int32_t tTestFSetMetaGetInfo(void *pMeta, int64_t uid, void *pInfo, void *pReader);
+int32_t tTestFSetMetaGetTbTSchemaEx(void *pMeta, int64_t suid, int64_t uid, int32_t sver, void **ppTSchema);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*_TD_VNODE_TSDB_RETENTION_TEST_UTIL_H_*/
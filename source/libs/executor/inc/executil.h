@@ -128,6 +128,8 @@ int32_t         tableListFind(const STableListInfo* pTableList, uint64_t uid, in
 void            tableListGetSourceTableInfo(const STableListInfo* pTableList, uint64_t* psuid, uint64_t* uid, int32_t* type);
 
 size_t getResultRowSize(struct SqlFunctionCtx* pCtx, int32_t numOfOutput);
+int32_t decodeLegacyResultRow(struct SqlFunctionCtx* pCtx, int32_t numOfOutput, const char* pSrc, int32_t srcLen,
+                              char* pDst, int32_t dstLen);
 void   initResultRowInfo(SResultRowInfo* pResultRowInfo);
 void   closeResultRow(SResultRow* pResultRow);
 void   resetResultRow(SResultRow* pResultRow, size_t entrySize);
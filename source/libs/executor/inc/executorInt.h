@@ -154,6 +154,8 @@ typedef struct SExchangeInfo {
   uint64_t            self;
   SLimitInfo          limitInfo;
   int64_t             openedTs;  // start exec time stamp, todo: move to SLoadRemoteDataInfo
+  TdThreadMutex       lock;           // protect the received responses of all sources
+  int64_t             bufferedBytes;  // bytes of received responses not consumed yet, the credit of prefetch
 } SExchangeInfo;
 
 typedef struct SScanInfo {
@@ -171,12 +173,18 @@ enum {
   TABLE_SCAN__BLOCK_ORDER = 2,
 };
 
+typedef struct SAggCleanupFunc {
+  int32_t      offset;  // the offset of the entry in the result row
+  FExecCleanUp fp;
+} SAggCleanupFunc;
+
 typedef struct SAggSupporter {
   SSHashObj*     pResultRowHashTable;  // quick locate the window object for each result
   char*          keyBuf;               // window key buffer
   SDiskbasedBuf* pResultBuf;           // query result buffer based on blocked-wised disk file
   int32_t        resultRowSize;  // the result buffer size for each result row, with the meta data size for each row
   int32_t        currentPageId;  // current write page id
+  SArray*        pCleanupFuncs;  // SAggCleanupFunc, the functions keeping memory out of the rows that are not finalized
 } SAggSupporter;
 
 typedef struct {
@@ -588,6 +596,7 @@ void cleanupBasicInfo(SOptrBasicInfo* pInfo);
 
 int32_t initExprSupp(SExprSupp* pSup, SExprInfo* pExprInfo, int32_t numOfExpr, SFunctionStateStore* pStore);
 void    cleanupExprSupp(SExprSupp* pSup);
+void    setStreamResultRowSize(SExprSupp* pSup);
 
 int32_t initAggSup(SExprSupp* pSup, SAggSupporter* pAggSup, SExprInfo* pExprInfo, int32_t numOfCols, size_t keyBufSize,
                    const char* pkey, void* pState, SFunctionStateStore* pStore);
@@ -45,8 +45,10 @@ typedef struct SSortSource {
     void* param;
     bool  onlyRef;
   };
-  int64_t fetchUs;
-  int64_t fetchNum;
+  int64_t   fetchUs;
+  int64_t   fetchNum;
+  uint64_t* pNormKey;  // order preserving encoding of the first sort key of each row in src.pBlock
+  int32_t   normKeyCap;
 } SSortSource;
 
 typedef struct SMsortComparParam {
@@ -60,6 +62,8 @@ typedef struct SMsortComparParam {
   int32_t tsSlotId;
   int32_t order;
   __compar_fn_t cmpFn;
+  // the first sort key is a fixed width integer, compare the normalized keys of the sources before the full compare
+  bool normKey;
 } SMsortComparParam;
 
 typedef struct SSortHandle  SSortHandle;
@@ -483,7 +483,7 @@ int32_t doInitAggInfoSup(SAggSupporter* pAggSup, SqlFunctionCtx* pCtx, int32_t n
     return code;
   }
 
-  code = createDiskbasedBuf(&pAggSup->pResultBuf, defaultPgsz, defaultBufsz, pKey, tsTempDir);
+  code = createDiskbasedBuf(&pAggSup->pResultBuf, defaultPgsz, defaultBufsz, pKey, tsTempDir, tsPagedBufCompress);
   if (code != TSDB_CODE_SUCCESS) {
     qError("Create agg result buf failed since %s, %s", tstrerror(code), pKey);
     return code;
@@ -492,7 +492,56 @@ int32_t doInitAggInfoSup(SAggSupporter* pAggSup, SqlFunctionCtx* pCtx, int32_t n
   return code;
 }
 
+static int32_t initAggCleanupFuncs(SAggSupporter* pAggSup, SExprSupp* pSup) {
+  for (int32_t i = 0; i < pSup->numOfExprs; ++i) {
+    if (pSup->pCtx[i].fpSet.cleanup == NULL) {
+      continue;
+    }
+
+    if (pAggSup->pCleanupFuncs == NULL) {
+      pAggSup->pCleanupFuncs = taosArrayInit(4, sizeof(SAggCleanupFunc));
+      if (pAggSup->pCleanupFuncs == NULL) {
+        return TSDB_CODE_OUT_OF_MEMORY;
+      }
+    }
+
+    SAggCleanupFunc func = {.offset = pSup->rowEntryInfoOffset[i], .fp = pSup->pCtx[i].fpSet.cleanup};
+    taosArrayPush(pAggSup->pCleanupFuncs, &func);
+  }
+
+  return TSDB_CODE_SUCCESS;
+}
+
+// release the memory kept out of the rows by the functions, if the rows are not finalized, e.g. the task is killed
+static void cleanupAggResultRows(SAggSupporter* pAggSup) {
+  if (pAggSup->pCleanupFuncs == NULL || pAggSup->pResultRowHashTable == NULL) {
+    return;
+  }
+
+  int32_t iter = 0;
+  void*   pIte = NULL;
+  while ((pIte = tSimpleHashIterate(pAggSup->pResultRowHashTable, pIte, &iter)) != NULL) {
+    SResultRowPosition* pPos = (SResultRowPosition*)pIte;
+    SFilePage*          pPage = getBufPage(pAggSup->pResultBuf, pPos->pageId);
+    if (pPage == NULL) {
+      continue;
+    }
+
+    SResultRow* pRow = (SResultRow*)((char*)pPage + pPos->offset);
+    for (int32_t i = 0; i < taosArrayGetSize(pAggSup->pCleanupFuncs); ++i) {
+      SAggCleanupFunc*     pFunc = taosArrayGet(pAggSup->pCleanupFuncs, i);
+      SResultRowEntryInfo* pEntry = (SResultRowEntryInfo*)((char*)pRow->pEntryInfo + pFunc->offset);
+      if (pEntry->initialized) {
+        pFunc->fp(pEntry);
+      }
+    }
+    releaseBufPage(pAggSup->pResultBuf, pPage);
+  }
+}
+
 void cleanupAggSup(SAggSupporter* pAggSup) {
+  cleanupAggResultRows(pAggSup);
+  taosArrayDestroy(pAggSup->pCleanupFuncs);
   taosMemoryFreeClear(pAggSup->keyBuf);
   tSimpleHashCleanup(pAggSup->pResultRowHashTable);
   destroyDiskbasedBuf(pAggSup->pResultBuf);
@@ -505,6 +554,15 @@ int32_t initAggSup(SExprSupp* pSup, SAggSupporter* pAggSup, SExprInfo* pExprInfo
     return code;
   }
 
+  if (pState) {
+    setStreamResultRowSize(pSup);
+  } else {
+    code = initAggCleanupFuncs(pAggSup, pSup);
+    if (code != TSDB_CODE_SUCCESS) {
+      return code;
+    }
+  }
+
   code = doInitAggInfoSup(pAggSup, pSup->pCtx, numOfCols, keyBufSize, pkey);
   if (code != TSDB_CODE_SUCCESS) {
     return code;
@@ -156,6 +156,46 @@ static void endPut(struct SDataSinkHandle* pHandle, uint64_t useconds) {
   taosThreadMutexUnlock(&pDispatcher->mutex);
 }
 
+// replace the cached block with the one compressed column by column, the raw block is kept if it fails or the
+// compressed one is not smaller
+static void compressDataCacheEntry(SDataDispatchHandle* pDispatcher, SDataDispatchBuf* pBuf) {
+  SDataCacheEntry* pEntry = (SDataCacheEntry*)pBuf->pData;
+  if (pEntry->compressed) {
+    return;
+  }
+
+  int32_t          allocSize = sizeof(SDataCacheEntry) + blockGetCompressBufSize(pEntry->data);
+  SDataCacheEntry* pNew = taosMemoryMalloc(allocSize);
+  if (pNew == NULL) {
+    return;
+  }
+
+  int32_t len = blockCompressEncodeBuf(pEntry->data, pNew->data);
+  if (len < 0) {
+    qWarn("failed to compress block in sink since %s, rows:%d", tstrerror(terrno), pEntry->numOfRows);
+    taosMemoryFree(pNew);
+    return;
+  }
+
+  if (!blockIsCompressed(pNew->data)) {  // not smaller than the raw block
+    taosMemoryFree(pNew);
+    return;
+  }
+
+  pNew->dataLen = len;
+  pNew->numOfRows = pEntry->numOfRows;
+  pNew->numOfCols = pEntry->numOfCols;
+  pNew->compressed = 1;
+
+  atomic_sub_fetch_64(&pDispatcher->cachedSize, pEntry->dataLen - len);
+  atomic_sub_fetch_64(&gDataSinkStat.cachedSize, pEntry->dataLen - len);
+
+  taosMemoryFree(pBuf->pData);
+  pBuf->pData = (char*)pNew;
+  pBuf->allocSize = allocSize;
+  pBuf->useSize = sizeof(SDataCacheEntry) + len;
+}
+
 static void getDataLength(SDataSinkHandle* pHandle, int64_t* pLen, bool* pQueryEnd) {
   SDataDispatchHandle* pDispatcher = (SDataDispatchHandle*)pHandle;
   if (taosQueueEmpty(pDispatcher->pDataBlocks)) {
@@ -171,6 +211,10 @@ static void getDataLength(SDataSinkHandle* pHandle, int64_t* pLen, bool* pQueryE
     taosFreeQitem(pBuf);
   }
 
+  if (pDispatcher->sink.compress) {
+    compressDataCacheEntry(pDispatcher, &pDispatcher->nextOutput);
+  }
+
   SDataCacheEntry* pEntry = (SDataCacheEntry*)pDispatcher->nextOutput.pData;
   *pLen = pEntry->dataLen;
 
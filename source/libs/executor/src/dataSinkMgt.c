@@ -73,6 +73,11 @@ void dsGetDataLength(DataSinkHandle handle, int64_t* pLen, bool* pQueryEnd) {
   pHandleImpl->fGetLen(pHandleImpl, pLen, pQueryEnd);
 }
 
+void dsSetCompress(DataSinkHandle handle, bool compress) {
+  SDataSinkHandle* pHandleImpl = (SDataSinkHandle*)handle;
+  pHandleImpl->compress = compress;
+}
+
 int32_t dsGetDataBlock(DataSinkHandle handle, SOutputData* pOutput) {
   SDataSinkHandle* pHandleImpl = (SDataSinkHandle*)handle;
   return pHandleImpl->fGetData(pHandleImpl, pOutput);
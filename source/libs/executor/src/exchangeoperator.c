@@ -22,6 +22,7 @@
 #include "query.h"
 #include "querytask.h"
 #include "tdatablock.h"
+#include "tglobal.h"
 #include "thash.h"
 #include "tmsg.h"
 #include "tname.h"
@@ -40,8 +41,13 @@ typedef struct SSourceDataInfo {
   int32_t            code;
   EX_SOURCE_STATUS   status;
   const char*        taskId;
+  SArray*            pPrefetchRsp;  // SRetrieveTableRsp*, received while the current response is not consumed yet
+  bool               fetching;      // a fetch request is in flight
+  bool               lastRspRecv;   // the last response has been received, no more fetch request is needed
 } SSourceDataInfo;
 
+#define EXCHANGE_RSP_SIZE(_rsp) ((int64_t)sizeof(SRetrieveTableRsp) + (_rsp)->compLen)
+
 static void  destroyExchangeOperatorInfo(void* param);
 static void  freeBlock(void* pParam);
 static void  freeSourceDataInfo(void* param);
@@ -56,6 +62,8 @@ static int32_t prepareLoadRemoteData(SOperatorInfo* pOperator);
 static int32_t handleLimitOffset(SOperatorInfo* pOperator, SLimitInfo* pLimitInfo, SSDataBlock* pBlock,
                                  bool holdDataInBuf);
 static int32_t doExtractResultBlocks(SExchangeInfo* pExchangeInfo, SSourceDataInfo* pDataInfo);
+static void    consumeSourceRsp(SExchangeInfo* pExchangeInfo, SSourceDataInfo* pDataInfo, bool exhausted);
+static int32_t prefetchSourceData(SExchangeInfo* pExchangeInfo, SExecTaskInfo* pTaskInfo, int32_t start, int32_t end);
 
 static void concurrentlyLoadRemoteDataImpl(SOperatorInfo* pOperator, SExchangeInfo* pExchangeInfo,
                                            SExecTaskInfo* pTaskInfo) {
@@ -101,7 +109,7 @@ static void concurrentlyLoadRemoteDataImpl(SOperatorInfo* pOperator, SExchangeIn
                ", totalRows:%" PRIu64 ", try next %d/%" PRIzu,
                GET_TASKID(pTaskInfo), pSource->addr.nodeId, pSource->taskId, pSource->execId, i, pDataInfo->totalRows,
                pExchangeInfo->loadInfo.totalRows, i + 1, totalSources);
-        taosMemoryFreeClear(pDataInfo->pRsp);
+        consumeSourceRsp(pExchangeInfo, pDataInfo, true);
         break;
       }
 
@@ -129,15 +137,10 @@ static void concurrentlyLoadRemoteDataImpl(SOperatorInfo* pOperator, SExchangeIn
                pRsp->numOfRows, pLoadInfo->totalRows, pLoadInfo->totalSize / 1024.0);
       }
 
-      taosMemoryFreeClear(pDataInfo->pRsp);
-
-      if (pDataInfo->status != EX_SOURCE_DATA_EXHAUSTED) {
-        pDataInfo->status = EX_SOURCE_DATA_NOT_READY;
-        code = doSendFetchDataRequest(pExchangeInfo, pTaskInfo, i);
-        if (code != TSDB_CODE_SUCCESS) {
-          taosMemoryFreeClear(pDataInfo->pRsp);
-          goto _error;
-        }
+      consumeSourceRsp(pExchangeInfo, pDataInfo, pRsp->completed == 1);
+      code = prefetchSourceData(pExchangeInfo, pTaskInfo, i, i + 1);
+      if (code != TSDB_CODE_SUCCESS) {
+        goto _error;
       }
       return;
     }  // end loop
@@ -172,6 +175,16 @@ static SSDataBlock* doLoadRemoteDataImpl(SOperatorInfo* pOperator) {
     return NULL;
   }
 
+  // keep the fetch requests in flight while the buffered blocks are consumed
+  if (pExchangeInfo->seqLoadData) {
+    pTaskInfo->code = prefetchSourceData(pExchangeInfo, pTaskInfo, pExchangeInfo->current, pExchangeInfo->current + 1);
+  } else {
+    pTaskInfo->code = prefetchSourceData(pExchangeInfo, pTaskInfo, 0, totalSources);
+  }
+  if (pTaskInfo->code != TSDB_CODE_SUCCESS) {
+    return NULL;
+  }
+
   // we have buffered retrieved datablock, return it directly
   SSDataBlock* p = NULL;
   if (taosArrayGetSize(pExchangeInfo->pResultBlockList) > 0) {
@@ -249,9 +262,15 @@ static int32_t initDataSource(int32_t numOfSources, SExchangeInfo* pInfo, const
     dataInfo.status = EX_SOURCE_DATA_NOT_READY;
     dataInfo.taskId = id;
     dataInfo.index = i;
+    dataInfo.pPrefetchRsp = taosArrayInit(tsExchangePrefetchDepth, POINTER_BYTES);
+    if (dataInfo.pPrefetchRsp == NULL) {
+      taosArrayDestroyEx(pInfo->pSourceDataInfo, freeSourceDataInfo);
+      return TSDB_CODE_OUT_OF_MEMORY;
+    }
     SSourceDataInfo* pDs = taosArrayPush(pInfo->pSourceDataInfo, &dataInfo);
     if (pDs == NULL) {
-      taosArrayDestroy(pInfo->pSourceDataInfo);
+      taosArrayDestroy(dataInfo.pPrefetchRsp);
+      taosArrayDestroyEx(pInfo->pSourceDataInfo, freeSourceDataInfo);
       return TSDB_CODE_OUT_OF_MEMORY;
     }
   }
@@ -278,6 +297,7 @@ static int32_t initExchangeOperator(SExchangePhysiNode* pExNode, SExchangeInfo*
   }
 
   initLimitInfo(pExNode->node.pLimit, pExNode->node.pSlimit, &pInfo->limitInfo);
+  taosThreadMutexInit(&pInfo->lock, NULL);
   pInfo->self = taosAddRef(exchangeObjRefPool, pInfo);
 
   return initDataSource(numOfSources, pInfo, id);
@@ -339,9 +359,12 @@ void freeBlock(void* pParam) {
   blockDataDestroy(pBlock);
 }
 
+static void freeRsp(void* p) { taosMemoryFree(*(void**)p); }
+
 void freeSourceDataInfo(void* p) {
   SSourceDataInfo* pInfo = (SSourceDataInfo*)p;
   taosMemoryFreeClear(pInfo->pRsp);
+  taosArrayDestroyEx(pInfo->pPrefetchRsp, freeRsp);
 }
 
 void doDestroyExchangeOperatorInfo(void* param) {
@@ -356,6 +379,7 @@ void doDestroyExchangeOperatorInfo(void* param) {
   blockDataDestroy(pExInfo->pDummyBlock);
 
   tsem_destroy(&pExInfo->ready);
+  taosThreadMutexDestroy(&pExInfo->lock);
   taosMemoryFreeClear(param);
 }
 
@@ -372,26 +396,44 @@ int32_t loadRemoteDataCallback(void* param, SDataBuf* pMsg, int32_t code) {
   int32_t          index = pWrapper->sourceIndex;
   SSourceDataInfo* pSourceDataInfo = taosArrayGet(pExchangeInfo->pSourceDataInfo, index);
 
-  if (code == TSDB_CODE_SUCCESS) {
-    pSourceDataInfo->pRsp = pMsg->pData;
+  taosThreadMutexLock(&pExchangeInfo->lock);
+  pSourceDataInfo->fetching = false;
 
-    SRetrieveTableRsp* pRsp = pSourceDataInfo->pRsp;
+  if (code == TSDB_CODE_SUCCESS) {
+    SRetrieveTableRsp* pRsp = pMsg->pData;
     pRsp->numOfRows = htobe64(pRsp->numOfRows);
     pRsp->compLen = htonl(pRsp->compLen);
     pRsp->numOfCols = htonl(pRsp->numOfCols);
     pRsp->useconds = htobe64(pRsp->useconds);
     pRsp->numOfBlocks = htonl(pRsp->numOfBlocks);
 
-    qDebug("%s fetch rsp received, index:%d, blocks:%d, rows:%" PRId64 ", %p", pSourceDataInfo->taskId, index, pRsp->numOfBlocks,
-           pRsp->numOfRows, pExchangeInfo);
+    pSourceDataInfo->lastRspRecv = (pRsp->completed == 1 || pRsp->numOfRows == 0);
+    pExchangeInfo->bufferedBytes += EXCHANGE_RSP_SIZE(pRsp);
+
+    // the previous response is still being consumed, keep this one until it is done
+    if (pSourceDataInfo->status == EX_SOURCE_DATA_READY) {
+      if (taosArrayPush(pSourceDataInfo->pPrefetchRsp, &pRsp) == NULL) {
+        taosMemoryFree(pRsp);
+        pSourceDataInfo->code = TSDB_CODE_OUT_OF_MEMORY;
+      }
+    } else {
+      pSourceDataInfo->pRsp = pRsp;
+    }
+
+    qDebug("%s fetch rsp received, index:%d, blocks:%d, rows:%" PRId64 ", prefetched:%d, %p", pSourceDataInfo->taskId,
+           index, pRsp->numOfBlocks, pRsp->numOfRows, (int32_t)taosArrayGetSize(pSourceDataInfo->pPrefetchRsp),
+           pExchangeInfo);
   } else {
     taosMemoryFree(pMsg->pData);
     pSourceDataInfo->code = code;
+    pSourceDataInfo->lastRspRecv = true;
     qDebug("%s fetch rsp received, index:%d, error:%s, %p", pSourceDataInfo->taskId, index, tstrerror(code),
            pExchangeInfo);
   }
 
   pSourceDataInfo->status = EX_SOURCE_DATA_READY;
+  taosThreadMutexUnlock(&pExchangeInfo->lock);
+
   code = tsem_post(&pExchangeInfo->ready);
   if (code != TSDB_CODE_SUCCESS) {
     code = TAOS_SYSTEM_ERROR(code);
@@ -409,7 +451,10 @@ int32_t doSendFetchDataRequest(SExchangeInfo* pExchangeInfo, SExecTaskInfo* pTas
   SSourceDataInfo*       pDataInfo = taosArrayGet(pExchangeInfo->pSourceDataInfo, sourceIndex);
   pDataInfo->startTime = taosGetTimestampUs();
 
-  ASSERT(pDataInfo->status == EX_SOURCE_DATA_NOT_READY);
+  taosThreadMutexLock(&pExchangeInfo->lock);
+  ASSERT(!pDataInfo->fetching && pDataInfo->status != EX_SOURCE_DATA_EXHAUSTED);
+  pDataInfo->fetching = true;
+  taosThreadMutexUnlock(&pExchangeInfo->lock);
 
   SFetchRspHandleWrapper* pWrapper = taosMemoryCalloc(1, sizeof(SFetchRspHandleWrapper));
   pWrapper->exchangeId = pExchangeInfo->self;
@@ -429,6 +474,7 @@ int32_t doSendFetchDataRequest(SExchangeInfo* pExchangeInfo, SExecTaskInfo* pTas
     req.taskId = pSource->taskId;
     req.queryId = pTaskInfo->id.queryId;
     req.execId = pSource->execId;
+    req.compress = (tsCompressColData >= 0);
 
     int32_t msgSize = tSerializeSResFetchReq(NULL, 0, &req);
     if (msgSize < 0) {
@@ -492,6 +538,9 @@ int32_t extractDataBlockFromFetchRsp(SSDataBlock* pRes, char* pData, SArray* pCo
   if (pColList == NULL) {  // data from other sources
     blockDataCleanup(pRes);
     *pNextStart = (char*)blockDecode(pRes, pData);
+    if (*pNextStart == NULL) {  // failed to decompress the block
+      return terrno;
+    }
   } else {  // extract data according to pColList
     char* pStart = pData;
 
@@ -514,7 +563,10 @@ int32_t extractDataBlockFromFetchRsp(SSDataBlock* pRes, char* pData, SArray* pCo
       blockDataAppendColInfo(pBlock, &idata);
     }
 
-    blockDecode(pBlock, pStart);
+    if (blockDecode(pBlock, pStart) == NULL) {
+      blockDataDestroy(pBlock);
+      return terrno;
+    }
     blockDataEnsureCapacity(pRes, pBlock->info.rows);
 
     // data from mnode
@@ -602,7 +654,8 @@ int32_t doExtractResultBlocks(SExchangeInfo* pExchangeInfo, SSourceDataInfo* pDa
 
     code = extractDataBlockFromFetchRsp(pb, pStart, NULL, &pStart);
     if (code != 0) {
-      taosMemoryFreeClear(pDataInfo->pRsp);
+      taosArrayPush(pExchangeInfo->pRecycledBlocks, &pb);
+      consumeSourceRsp(pExchangeInfo, pDataInfo, true);
       return code;
     }
 
@@ -612,6 +665,75 @@ int32_t doExtractResultBlocks(SExchangeInfo* pExchangeInfo, SSourceDataInfo* pDa
   return code;
 }
 
+void consumeSourceRsp(SExchangeInfo* pExchangeInfo, SSourceDataInfo* pDataInfo, bool exhausted) {
+  taosThreadMutexLock(&pExchangeInfo->lock);
+  if (pDataInfo->pRsp != NULL) {
+    pExchangeInfo->bufferedBytes -= EXCHANGE_RSP_SIZE(pDataInfo->pRsp);
+    taosMemoryFreeClear(pDataInfo->pRsp);
+  }
+
+  if (exhausted) {
+    pDataInfo->status = EX_SOURCE_DATA_EXHAUSTED;
+  } else if (taosArrayGetSize(pDataInfo->pPrefetchRsp) > 0) {
+    pDataInfo->pRsp = taosArrayGetP(pDataInfo->pPrefetchRsp, 0);
+    taosArrayRemove(pDataInfo->pPrefetchRsp, 0);
+    pDataInfo->status = EX_SOURCE_DATA_READY;
+  } else if (pDataInfo->code != TSDB_CODE_SUCCESS) {
+    // the prefetch request failed while the response was consumed, keep the error to be reported by the next load
+    pDataInfo->status = EX_SOURCE_DATA_READY;
+  } else {
+    pDataInfo->status = EX_SOURCE_DATA_NOT_READY;
+  }
+  taosThreadMutexUnlock(&pExchangeInfo->lock);
+}
+
+/*
+ * Only one fetch request of a source is in flight, since the source task serves fetch requests one by one. The
+ * request of the next response is sent as soon as the previous response arrives, until tsExchangePrefetchDepth
+ * responses of the source are received or in flight, or the bytes of all received responses exceed
+ * tsExchangeBufferSize. Once out of credit, the source task stops to be fetched and its data dispatcher queue fills
+ * up, which suspends the execution of the source task.
+ */
+static bool shouldFetchSource(SExchangeInfo* pExchangeInfo, SSourceDataInfo* pDataInfo, SDownstreamSourceNode* pSource) {
+  if (pDataInfo->fetching || pDataInfo->lastRspRecv || pDataInfo->status == EX_SOURCE_DATA_EXHAUSTED) {
+    return false;
+  }
+
+  int32_t received = taosArrayGetSize(pDataInfo->pPrefetchRsp) + (pDataInfo->status == EX_SOURCE_DATA_READY ? 1 : 0);
+  if (received == 0) {
+    return true;
+  }
+
+  // the local source is executed in the fetch call, nothing is gained to run it ahead
+  if (pSource->localExec) {
+    return false;
+  }
+
+  return received < tsExchangePrefetchDepth && pExchangeInfo->bufferedBytes < tsExchangeBufferSize * 1048576L;
+}
+
+int32_t prefetchSourceData(SExchangeInfo* pExchangeInfo, SExecTaskInfo* pTaskInfo, int32_t start, int32_t end) {
+  end = TMIN(end, taosArrayGetSize(pExchangeInfo->pSourceDataInfo));
+
+  for (int32_t i = start; i < end; ++i) {
+    SSourceDataInfo*       pDataInfo = taosArrayGet(pExchangeInfo->pSourceDataInfo, i);
+    SDownstreamSourceNode* pSource = taosArrayGet(pExchangeInfo->pSources, i);
+
+    taosThreadMutexLock(&pExchangeInfo->lock);
+    bool fetch = shouldFetchSource(pExchangeInfo, pDataInfo, pSource);
+    taosThreadMutexUnlock(&pExchangeInfo->lock);
+
+    if (fetch) {
+      int32_t code = doSendFetchDataRequest(pExchangeInfo, pTaskInfo, i);
+      if (code != TSDB_CODE_SUCCESS) {
+        return code;
+      }
+    }
+  }
+
+  return TSDB_CODE_SUCCESS;
+}
+
 int32_t seqLoadRemoteData(SOperatorInfo* pOperator) {
   SExchangeInfo* pExchangeInfo = pOperator->info;
   SExecTaskInfo* pTaskInfo = pOperator->pTaskInfo;
@@ -627,9 +749,13 @@ int32_t seqLoadRemoteData(SOperatorInfo* pOperator) {
     }
 
     SSourceDataInfo* pDataInfo = taosArrayGet(pExchangeInfo->pSourceDataInfo, pExchangeInfo->current);
-    pDataInfo->status = EX_SOURCE_DATA_NOT_READY;
 
-    doSendFetchDataRequest(pExchangeInfo, pTaskInfo, pExchangeInfo->current);
+    // the response may have been prefetched already, one post of the semaphore is made for each response
+    code = prefetchSourceData(pExchangeInfo, pTaskInfo, pExchangeInfo->current, pExchangeInfo->current + 1);
+    if (code != TSDB_CODE_SUCCESS) {
+      goto _error;
+    }
+
     tsem_wait(&pExchangeInfo->ready);
     if (isTaskKilled(pTaskInfo)) {
       T_LONG_JMP(pTaskInfo->env, pTaskInfo->code);
@@ -653,9 +779,8 @@ int32_t seqLoadRemoteData(SOperatorInfo* pOperator) {
              GET_TASKID(pTaskInfo), pSource->addr.nodeId, pSource->taskId, pSource->execId, pExchangeInfo->current + 1,
              pDataInfo->totalRows, pLoadInfo->totalRows);
 
-      pDataInfo->status = EX_SOURCE_DATA_EXHAUSTED;
+      consumeSourceRsp(pExchangeInfo, pDataInfo, true);
       pExchangeInfo->current += 1;
-      taosMemoryFreeClear(pDataInfo->pRsp);
       continue;
     }
 
@@ -671,9 +796,6 @@ int32_t seqLoadRemoteData(SOperatorInfo* pOperator) {
              GET_TASKID(pTaskInfo), pSource->addr.nodeId, pSource->taskId, pSource->execId, pRetrieveRsp->numOfRows,
              pDataInfo->totalRows, pLoadInfo->totalRows, pLoadInfo->totalSize, pExchangeInfo->current + 1,
              totalSources);
-
-      pDataInfo->status = EX_SOURCE_DATA_EXHAUSTED;
-      pExchangeInfo->current += 1;
     } else {
       qDebug("%s fetch msg rsp from vgId:%d, taskId:0x%" PRIx64 " execId:%d numOfRows:%" PRId64 ", totalRows:%" PRIu64
              ", totalBytes:%" PRIu64,
@@ -684,7 +806,17 @@ int32_t seqLoadRemoteData(SOperatorInfo* pOperator) {
     updateLoadRemoteInfo(pLoadInfo, pRetrieveRsp->numOfRows, pRetrieveRsp->compLen, startTs, pOperator);
     pDataInfo->totalRows += pRetrieveRsp->numOfRows;
 
-    taosMemoryFreeClear(pDataInfo->pRsp);
+    bool completed = (pRsp->completed == 1);
+    consumeSourceRsp(pExchangeInfo, pDataInfo, completed);
+    if (completed) {
+      pExchangeInfo->current += 1;
+    } else {
+      // send the next fetch request before the extracted blocks are consumed
+      code = prefetchSourceData(pExchangeInfo, pTaskInfo, pExchangeInfo->current, pExchangeInfo->current + 1);
+      if (code != TSDB_CODE_SUCCESS) {
+        goto _error;
+      }
+    }
     return TSDB_CODE_SUCCESS;
   }
 
@@ -88,6 +88,53 @@ size_t getResultRowSize(SqlFunctionCtx* pCtx, int32_t numOfOutput) {
   return rowSize;
 }
 
+// convert a result row saved by an older version, in which some functions kept a larger intermediate buffer
+int32_t decodeLegacyResultRow(SqlFunctionCtx* pCtx, int32_t numOfOutput, const char* pSrc, int32_t srcLen, char* pDst,
+                              int32_t dstLen) {
+  int32_t legacyLen = dstLen;
+  for (int32_t i = 0; i < numOfOutput; ++i) {
+    int32_t size = fmGetLegacyResBufSize(pCtx[i].functionId);
+    if (size > 0) {
+      legacyLen += size - pCtx[i].resDataInfo.interBufSize;
+    }
+  }
+  if (legacyLen != srcLen) {
+    return TSDB_CODE_INVALID_DATA_FMT;
+  }
+
+  memcpy(pDst, pSrc, sizeof(SResultRow));
+  pSrc += sizeof(SResultRow);
+  pDst += sizeof(SResultRow);
+  srcLen -= sizeof(SResultRow);
+
+  for (int32_t i = 0; i < numOfOutput; ++i) {
+    int32_t bufSize = pCtx[i].resDataInfo.interBufSize;
+    int32_t size = fmGetLegacyResBufSize(pCtx[i].functionId);
+
+    memcpy(pDst, pSrc, sizeof(SResultRowEntryInfo));
+    pSrc += sizeof(SResultRowEntryInfo);
+    pDst += sizeof(SResultRowEntryInfo);
+    srcLen -= sizeof(SResultRowEntryInfo);
+
+    if (size > 0) {
+      int32_t code = fmDecodeLegacyResBuf(pCtx[i].functionId, pSrc, pDst);
+      if (code != TSDB_CODE_SUCCESS) {
+        return code;
+      }
+    } else {
+      size = bufSize;
+      memcpy(pDst, pSrc, bufSize);
+    }
+    pSrc += size;
+    pDst += bufSize;
+    srcLen -= size;
+  }
+
+  // the null flags of the columns and the selectivity buffer follow the entries as they are
+  memcpy(pDst, pSrc, srcLen);
+  return TSDB_CODE_SUCCESS;
+}
+
 static void freeEx(void* p) { taosMemoryFree(*(void**)p); }
 
 void cleanupGroupResInfo(SGroupResInfo* pGroupResInfo) {
@@ -1059,6 +1106,99 @@ end:
   return code;
 }
 
+static bool isTbnameInCond(SNode* pTagCond) {
+  if (nodeType(pTagCond) == QUERY_NODE_OPERATOR) {
+    SOperatorNode* pNode = (SOperatorNode*)pTagCond;
+    return pNode->opType == OP_TYPE_IN && pNode->pLeft != NULL && nodeType(pNode->pLeft) == QUERY_NODE_COLUMN &&
+           ((SColumnNode*)pNode->pLeft)->colType == COLUMN_TYPE_TBNAME;
+  }
+
+  if (nodeType(pTagCond) == QUERY_NODE_LOGIC_CONDITION &&
+      ((SLogicConditionNode*)pTagCond)->condType == LOGIC_COND_TYPE_AND) {
+    SNode* pNode = NULL;
+    FOREACH(pNode, ((SLogicConditionNode*)pTagCond)->pParameterList) {
+      if (isTbnameInCond(pNode)) {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+// ver is the version of child table changes returned by the cache lookup, which the uid list has applied
+static void putTableListIntoCache(void* pVnode, uint64_t suid, T_MD5_CTX* pContext, SArray* pUidList, int64_t ver,
+                                  SStorageAPI* pStorageAPI) {
+  size_t numOfTables = taosArrayGetSize(pUidList);
+  size_t size = numOfTables * sizeof(uint64_t) + sizeof(int32_t);
+  char*  pPayload = taosMemoryMalloc(size);
+  if (pPayload == NULL) {
+    return;
+  }
+
+  *(int32_t*)pPayload = numOfTables;
+  if (numOfTables > 0) {
+    memcpy(pPayload + sizeof(int32_t), taosArrayGet(pUidList, 0), numOfTables * sizeof(uint64_t));
+  }
+
+  pStorageAPI->metaFn.putCachedTableList(pVnode, suid, pContext->digest, tListLen(pContext->digest), pPayload, size, 1,
+                                         ver);
+}
+
+// apply the child tables created, altered or dropped after the table list is cached: remove them from the cached list
+// and add back the ones that still exist and satisfy the tag filter condition.
+static int32_t applyCachedTableListChanges(STableListInfo* pListInfo, SArray* pUidList, SArray* pChanged,
+                                           SNode* pTagCond, void* pVnode, SStorageAPI* pStorageAPI) {
+  int32_t   code = TSDB_CODE_SUCCESS;
+  int32_t   numOfChanged = taosArrayGetSize(pChanged);
+  SArray*   pCheckList = taosArrayInit(numOfChanged, sizeof(uint64_t));
+  SHashObj* pChangedMap = taosHashInit(numOfChanged, taosGetDefaultHashFunction(TSDB_DATA_TYPE_UBIGINT), false,
+                                       HASH_NO_LOCK);
+  if (pCheckList == NULL || pChangedMap == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _end;
+  }
+
+  for (int32_t i = 0; i < numOfChanged; ++i) {
+    uint64_t* uid = taosArrayGet(pChanged, i);
+    if (taosHashGet(pChangedMap, uid, sizeof(uint64_t)) != NULL) {
+      continue;
+    }
+
+    taosHashPut(pChangedMap, uid, sizeof(uint64_t), NULL, 0);
+    if (pStorageAPI->metaFn.isTableExisted(pVnode, *uid)) {
+      taosArrayPush(pCheckList, uid);
+    }
+  }
+
+  int32_t numOfTables = taosArrayGetSize(pUidList);
+  int32_t numOfKept = 0;
+  for (int32_t i = 0; i < numOfTables; ++i) {
+    uint64_t* uid = taosArrayGet(pUidList, i);
+    if (taosHashGet(pChangedMap, uid, sizeof(uint64_t)) == NULL) {
+      *(uint64_t*)taosArrayGet(pUidList, numOfKept++) = *uid;
+    }
+  }
+  taosArrayPopTailBatch(pUidList, numOfTables - numOfKept);
+
+  // an empty list makes the filter run against all tables of the super table
+  if (taosArrayGetSize(pCheckList) > 0) {
+    code = doFilterByTagCond(pListInfo, pCheckList, pTagCond, pVnode, SFLT_ACCURATE_INDEX, pStorageAPI);
+    if (code != TSDB_CODE_SUCCESS) {
+      goto _end;
+    }
+  }
+
+  taosArrayAddAll(pUidList, pCheckList);
+  qDebug("apply %d changed tables to cached table list, %d tables qualified, numOfTables:%d", numOfChanged,
+         (int32_t)taosArrayGetSize(pCheckList), (int32_t)taosArrayGetSize(pUidList));
+
+_end:
+  taosArrayDestroy(pCheckList);
+  taosHashCleanup(pChangedMap);
+  return code;
+}
+
 int32_t getTableList(void* pVnode, SScanPhysiNode* pScanNode, SNode* pTagCond, SNode* pTagIndexCond,
                      STableListInfo* pListInfo, uint8_t* digest, const char* idstr, SStorageAPI* pStorageAPI) {
   int32_t code = TSDB_CODE_SUCCESS;
@@ -1081,14 +1221,33 @@ int32_t getTableList(void* pVnode, SScanPhysiNode* pScanNode, SNode* pTagCond, S
     }
   } else {
     T_MD5_CTX context = {0};
+    int64_t   ver = 0;
 
     if (tsTagFilterCache) {
       // try to retrieve the result from meta cache
       genTagFilterDigest(pTagCond, &context);
 
-      bool acquired = false;
+      bool    acquired = false;
+      SArray* pChanged = taosArrayInit(4, sizeof(uint64_t));
       pStorageAPI->metaFn.getCachedTableList(pVnode, pScanNode->suid, context.digest, tListLen(context.digest),
-                                             pUidList, &acquired);
+                                             pUidList, pChanged, &ver, &acquired);
+      if (acquired && taosArrayGetSize(pChanged) > 0) {
+        // the tbname in filter does not check the given tables against the condition, evaluate it from scratch
+        if (pTagCond != NULL && isTbnameInCond(pTagCond)) {
+          taosArrayClear(pUidList);
+          acquired = false;
+        } else {
+          code = applyCachedTableListChanges(pListInfo, pUidList, pChanged, pTagCond, pVnode, pStorageAPI);
+          if (code != TSDB_CODE_SUCCESS) {
+            taosArrayDestroy(pChanged);
+            goto _end;
+          }
+
+          putTableListIntoCache(pVnode, pScanNode->suid, &context, pUidList, ver, pStorageAPI);
+        }
+      }
+      taosArrayDestroy(pChanged);
+
       if (acquired) {
         digest[0] = 1;
         memcpy(digest + 1, context.digest, tListLen(context.digest));
@@ -1128,15 +1287,7 @@ int32_t getTableList(void* pVnode, SScanPhysiNode* pScanNode, SNode* pTagCond, S
     numOfTables = taosArrayGetSize(pUidList);
 
     if (tsTagFilterCache) {
-      size_t size = numOfTables * sizeof(uint64_t) + sizeof(int32_t);
-      char*  pPayload = taosMemoryMalloc(size);
-
-      *(int32_t*)pPayload = numOfTables;
-      if (numOfTables > 0) {
-        memcpy(pPayload + sizeof(int32_t), taosArrayGet(pUidList, 0), numOfTables * sizeof(uint64_t));
-      }
-
-      pStorageAPI->metaFn.putCachedTableList(pVnode, pScanNode->suid, context.digest, tListLen(context.digest), pPayload, size, 1);
+      putTableListIntoCache(pVnode, pScanNode->suid, &context, pUidList, ver, pStorageAPI);
       digest[0] = 1;
       memcpy(digest + 1, context.digest, tListLen(context.digest));
     }
@@ -878,6 +878,27 @@ int32_t initExprSupp(SExprSupp* pSup, SExprInfo* pExprInfo, int32_t numOfExpr, S
   return TSDB_CODE_SUCCESS;
 }
 
+// the stream states save the result rows as they are, so the whole intermediate results must be kept in the rows
+void setStreamResultRowSize(SExprSupp* pSup) {
+  SqlFunctionCtx* pCtx = pSup->pCtx;
+  for (int32_t i = 0; i < pSup->numOfExprs; ++i) {
+    if (pCtx[i].functionId < 0 || pCtx[i].fpSet.getEnv == NULL || fmIsUserDefinedFunc(pCtx[i].functionId)) {
+      continue;
+    }
+
+    SFuncExecEnv env = {0};
+    pCtx[i].fpSet.getEnv(pCtx[i].pExpr->pExpr->_function.pFunctNode, &env);
+    if (env.maxMemSize > pCtx[i].resDataInfo.interBufSize) {
+      pCtx[i].resDataInfo.interBufSize = env.maxMemSize;
+    }
+  }
+
+  for (int32_t i = 1; i < pSup->numOfExprs; ++i) {
+    pSup->rowEntryInfoOffset[i] = (int32_t)(pSup->rowEntryInfoOffset[i - 1] + sizeof(SResultRowEntryInfo) +
+                                            pCtx[i - 1].resDataInfo.interBufSize);
+  }
+}
+
 void cleanupExprSupp(SExprSupp* pSupp) {
   destroySqlFunctionCtx(pSupp->pCtx, pSupp->numOfExprs);
   if (pSupp->pExprInfo != NULL) {
@@ -28,16 +28,72 @@
 #include "thash.h"
 #include "ttypes.h"
 
+#define GROUPBY_SPILL_PARTITION_BITS 4
+#define GROUPBY_SPILL_PARTITIONS     (1 << GROUPBY_SPILL_PARTITION_BITS)
+#define GROUPBY_SPILL_BLOCK_ROWS     4096
+
+// rows of a block are gathered by group only if the number of result row lookups is reduced by this factor
+#define GROUPBY_GATHER_FACTOR 4
+
+typedef struct SGroupbySlot {
+  uint32_t hash;
+  int32_t  group;  // -1 if the slot is empty
+} SGroupbySlot;
+
+typedef struct SGroupbyBlockGroup {
+  int32_t  row;        // the first row of the group in current block
+  int32_t  numOfRows;  // number of rows of the group in current block
+  int32_t  start;      // start position in the gathered block
+  bool     spilled;    // not in the result buffer, rows are written to the spill partition
+  uint64_t id;         // calcGroupId of the result row key
+} SGroupbyBlockGroup;
+
+// group keys of all rows in current data block
+typedef struct SGroupbyBlockKeys {
+  char*         pBuf;
+  int32_t       bufSize;
+  int32_t       capacity;   // rows
+  int32_t*      pOffset;    // key offset of each row in pBuf
+  int32_t*      pLen;       // key length of each row
+  uint32_t*     pHash;      // key hash of each row
+  int32_t*      pRowGroup;  // group index of each row
+  int32_t*      pIndex;     // row index ordered by group
+  SGroupbySlot* pSlots;     // open addressing table of the groups in current block, cache line aligned
+  int32_t       numOfSlots;
+  SArray*       pGroups;  // SArray<SGroupbyBlockGroup>
+} SGroupbyBlockKeys;
+
+typedef struct SGroupbySpilledPage {
+  int32_t  pageId;
+  uint64_t groupId;
+} SGroupbySpilledPage;
+
+/*
+ * Once the result buffer begins to be flushed to disk, rows of new groups are radix partitioned by the group id and
+ * written into the spill buffer, while the groups that are already in the result buffer are still aggregated in place.
+ * Each partition is aggregated independently after the in-memory groups have been returned.
+ */
+typedef struct SGroupbySpillSup {
+  bool           spilling;
+  int32_t        partIndex;  // the next partition to be aggregated
+  SDiskbasedBuf* pBuf;
+  SSDataBlock*   pBlocks[GROUPBY_SPILL_PARTITIONS];  // rows not written into the spill buffer yet
+  SArray*        pPages[GROUPBY_SPILL_PARTITIONS];   // SArray<SGroupbySpilledPage>
+  SSDataBlock*   pLoadBlock;
+} SGroupbySpillSup;
+
 typedef struct SGroupbyOperatorInfo {
-  SOptrBasicInfo binfo;
-  SAggSupporter  aggSup;
-  SArray*        pGroupCols;     // group by columns, SArray<SColumn>
-  SArray*        pGroupColVals;  // current group column values, SArray<SGroupKeys>
-  bool           isInit;         // denote if current val is initialized or not
-  char*          keyBuf;         // group by keys for hash
-  int32_t        groupKeyLen;    // total group by column width
-  SGroupResInfo  groupResInfo;
-  SExprSupp      scalarSup;
+  SOptrBasicInfo    binfo;
+  SAggSupporter     aggSup;
+  SArray*           pGroupCols;     // group by columns, SArray<SColumn>
+  SArray*           pGroupColVals;  // current group column values, SArray<SGroupKeys>
+  char*             keyBuf;         // group by keys for hash
+  int32_t           groupKeyLen;    // total group by column width
+  SGroupResInfo     groupResInfo;
+  SExprSupp         scalarSup;
+  SGroupbyBlockKeys blockKeys;
+  SSDataBlock*      pGatherBlock;  // rows of current block ordered by group
+  SGroupbySpillSup  spillSup;
 } SGroupbyOperatorInfo;
 
 // The sort in partition may be needed later.
@@ -60,8 +116,6 @@ typedef struct SPartitionOperatorInfo {
 
 static void*    getCurrentDataGroupInfo(const SPartitionOperatorInfo* pInfo, SDataGroupInfo** pGroupInfo, int32_t len);
 static int32_t* setupColumnOffset(const SSDataBlock* pBlock, int32_t rowCapacity);
-static int32_t  setGroupResultOutputBuf(SOperatorInfo* pOperator, SOptrBasicInfo* binfo, int32_t numOfCols, char* pData,
-                                        int16_t bytes, uint64_t groupId, SDiskbasedBuf* pBuf, SAggSupporter* pAggSup);
 static SArray*  extractColumnInfo(SNodeList* pNodeList);
 
 static void freeGroupKey(void* param) {
@@ -69,6 +123,32 @@ static void freeGroupKey(void* param) {
   taosMemoryFree(pKey->pData);
 }
 
+static void cleanupGroupbyBlockKeys(SGroupbyBlockKeys* pKeys) {
+  taosMemoryFreeClear(pKeys->pBuf);
+  taosMemoryFreeClear(pKeys->pOffset);
+  taosMemoryFreeClear(pKeys->pLen);
+  taosMemoryFreeClear(pKeys->pHash);
+  taosMemoryFreeClear(pKeys->pRowGroup);
+  taosMemoryFreeClear(pKeys->pIndex);
+  taosMemoryFreeClear(pKeys->pSlots);
+  taosArrayDestroy(pKeys->pGroups);
+  pKeys->pGroups = NULL;
+}
+
+static void cleanupGroupbySpillSup(SGroupbySpillSup* pSup) {
+  for (int32_t i = 0; i < GROUPBY_SPILL_PARTITIONS; ++i) {
+    pSup->pBlocks[i] = blockDataDestroy(pSup->pBlocks[i]);
+    taosArrayDestroy(pSup->pPages[i]);
+    pSup->pPages[i] = NULL;
+  }
+
+  pSup->pLoadBlock = blockDataDestroy(pSup->pLoadBlock);
+  if (pSup->pBuf != NULL) {
+    destroyDiskbasedBuf(pSup->pBuf);
+    pSup->pBuf = NULL;
+  }
+}
+
 static void destroyGroupOperatorInfo(void* param) {
   SGroupbyOperatorInfo* pInfo = (SGroupbyOperatorInfo*)param;
   if (pInfo == NULL) {
@@ -80,6 +160,9 @@ static void destroyGroupOperatorInfo(void* param) {
   taosArrayDestroy(pInfo->pGroupCols);
   taosArrayDestroyEx(pInfo->pGroupColVals, freeGroupKey);
   cleanupExprSupp(&pInfo->scalarSup);
+  cleanupGroupbyBlockKeys(&pInfo->blockKeys);
+  cleanupGroupbySpillSup(&pInfo->spillSup);
+  blockDataDestroy(pInfo->pGatherBlock);
 
   cleanupGroupResInfo(&pInfo->groupResInfo);
   cleanupAggSup(&pInfo->aggSup);
@@ -120,54 +203,6 @@ static int32_t initGroupOptrInfo(SArray** pGroupColVals, int32_t* keyLen, char**
   return TSDB_CODE_SUCCESS;
 }
 
-static bool groupKeyCompare(SArray* pGroupCols, SArray* pGroupColVals, SSDataBlock* pBlock, int32_t rowIndex,
-                            int32_t numOfGroupCols) {
-  SColumnDataAgg* pColAgg = NULL;
-  for (int32_t i = 0; i < numOfGroupCols; ++i) {
-    SColumn*         pCol = taosArrayGet(pGroupCols, i);
-    SColumnInfoData* pColInfoData = taosArrayGet(pBlock->pDataBlock, pCol->slotId);
-    if (pBlock->pBlockAgg != NULL) {
-      pColAgg = pBlock->pBlockAgg[pCol->slotId];  // TODO is agg data matched?
-    }
-
-    bool isNull = colDataIsNull(pColInfoData, pBlock->info.rows, rowIndex, pColAgg);
-
-    SGroupKeys* pkey = taosArrayGet(pGroupColVals, i);
-    if (pkey->isNull && isNull) {
-      continue;
-    }
-
-    if (isNull || pkey->isNull) {
-      return false;
-    }
-
-    char* val = colDataGetData(pColInfoData, rowIndex);
-
-    if (pkey->type == TSDB_DATA_TYPE_JSON) {
-      int32_t dataLen = getJsonValueLen(val);
-
-      if (memcmp(pkey->pData, val, dataLen) == 0) {
-        continue;
-      } else {
-        return false;
-      }
-    } else if (IS_VAR_DATA_TYPE(pkey->type)) {
-      int32_t len = varDataLen(val);
-      if (len == varDataLen(pkey->pData) && memcmp(varDataVal(pkey->pData), varDataVal(val), len) == 0) {
-        continue;
-      } else {
-        return false;
-      }
-    } else {
-      if (memcmp(pkey->pData, val, pkey->bytes) != 0) {
-        return false;
-      }
-    }
-  }
-
-  return true;
-}
-
 static void recordNewGroupKeys(SArray* pGroupCols, SArray* pGroupColVals, SSDataBlock* pBlock, int32_t rowIndex) {
   SColumnDataAgg* pColAgg = NULL;
 
@@ -268,80 +303,645 @@ static void doAssignGroupKeys(SqlFunctionCtx* pCtx, int32_t numOfOutput, int32_t
   }
 }
 
-static void doHashGroupbyAgg(SOperatorInfo* pOperator, SSDataBlock* pBlock) {
-  SExecTaskInfo*        pTaskInfo = pOperator->pTaskInfo;
-  SGroupbyOperatorInfo* pInfo = pOperator->info;
+static int32_t ensureGroupbyBlockKeys(SGroupbyBlockKeys* pKeys, int32_t rows) {
+  if (pKeys->pGroups == NULL) {
+    pKeys->pGroups = taosArrayInit(rows, sizeof(SGroupbyBlockGroup));
+    if (pKeys->pGroups == NULL) {
+      return TSDB_CODE_OUT_OF_MEMORY;
+    }
+  }
+
+  if (rows > pKeys->capacity) {
+    void* p0 = taosMemoryRealloc(pKeys->pOffset, rows * sizeof(int32_t));
+    if (p0 != NULL) pKeys->pOffset = p0;
+    void* p1 = taosMemoryRealloc(pKeys->pLen, rows * sizeof(int32_t));
+    if (p1 != NULL) pKeys->pLen = p1;
+    void* p2 = taosMemoryRealloc(pKeys->pHash, rows * sizeof(uint32_t));
+    if (p2 != NULL) pKeys->pHash = p2;
+    void* p3 = taosMemoryRealloc(pKeys->pRowGroup, rows * sizeof(int32_t));
+    if (p3 != NULL) pKeys->pRowGroup = p3;
+    void* p4 = taosMemoryRealloc(pKeys->pIndex, rows * sizeof(int32_t));
+    if (p4 != NULL) pKeys->pIndex = p4;
+    if (p0 == NULL || p1 == NULL || p2 == NULL || p3 == NULL || p4 == NULL) {
+      return TSDB_CODE_OUT_OF_MEMORY;
+    }
+    pKeys->capacity = rows;
+  }
 
-  SqlFunctionCtx* pCtx = pOperator->exprSupp.pCtx;
-  int32_t         numOfGroupCols = taosArrayGetSize(pInfo->pGroupCols);
-  //  if (type == TSDB_DATA_TYPE_FLOAT || type == TSDB_DATA_TYPE_DOUBLE) {
-  // qError("QInfo:0x%"PRIx64" group by not supported on double/float columns, abort", GET_TASKID(pRuntimeEnv));
-  //    return;
-  //  }
+  // at least half of the slots are empty
+  int32_t numOfSlots = 16;
+  while (numOfSlots < rows * 2) {
+    numOfSlots <<= 1;
+  }
 
-  int32_t len = 0;
-  terrno = TSDB_CODE_SUCCESS;
+  if (numOfSlots > pKeys->numOfSlots) {
+    taosMemoryFreeClear(pKeys->pSlots);
+    pKeys->numOfSlots = 0;
+    pKeys->pSlots = taosMemoryMallocAlign(64, numOfSlots * sizeof(SGroupbySlot));
+    if (pKeys->pSlots == NULL) {
+      return TSDB_CODE_OUT_OF_MEMORY;
+    }
+    pKeys->numOfSlots = numOfSlots;
+  }
+
+  return TSDB_CODE_SUCCESS;
+}
+
+static int32_t ensureGroupbyKeyBuf(SGroupbyBlockKeys* pKeys, int32_t size) {
+  if (size <= pKeys->bufSize) {
+    return TSDB_CODE_SUCCESS;
+  }
+
+  int32_t newSize = TMAX(pKeys->bufSize, 1024);
+  while (newSize < size) {
+    newSize <<= 1;
+  }
+
+  char* p = taosMemoryRealloc(pKeys->pBuf, newSize);
+  if (p == NULL) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+
+  pKeys->pBuf = p;
+  pKeys->bufSize = newSize;
+  return TSDB_CODE_SUCCESS;
+}
+
+static FORCE_INLINE uint32_t groupKeyHash(const char* pKey, int32_t len) {
+  uint64_t h = 0x9E3779B97F4A7C15ull ^ (uint64_t)len;
+  int32_t  i = 0;
+  for (; i + (int32_t)sizeof(uint64_t) <= len; i += sizeof(uint64_t)) {
+    uint64_t v;
+    memcpy(&v, pKey + i, sizeof(uint64_t));
+    h = (h ^ v) * 0xBF58476D1CE4E5B9ull;
+    h ^= h >> 31;
+  }
+
+  if (i < len) {
+    uint64_t v = 0;
+    memcpy(&v, pKey + i, len - i);
+    h = (h ^ v) * 0xBF58476D1CE4E5B9ull;
+    h ^= h >> 31;
+  }
+
+  h *= 0x94D049BB133111EBull;
+  return (uint32_t)(h >> 32);
+}
+
+// all group by columns are fixed length and not null, the keys are built column by column
+static bool isFixedLenGroupKeys(const SArray* pGroupCols, const SSDataBlock* pBlock) {
+  if (pBlock->pBlockAgg != NULL) {
+    return false;
+  }
+
+  int32_t numOfGroupCols = taosArrayGetSize(pGroupCols);
+  for (int32_t i = 0; i < numOfGroupCols; ++i) {
+    SColumn*         pCol = taosArrayGet(pGroupCols, i);
+    SColumnInfoData* pColInfoData = taosArrayGet(pBlock->pDataBlock, pCol->slotId);
+    if (IS_VAR_DATA_TYPE(pColInfoData->info.type) || pColInfoData->hasNull || pColInfoData->info.bytes != pCol->bytes) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+#define COPY_FIXED_GROUP_KEY(_dst, _src, _rows, _keyLen, _bytes)         \
+  do {                                                                   \
+    for (int32_t j = 0; j < (_rows); ++j) {                              \
+      memcpy((_dst) + j * (_keyLen), (_src) + j * (_bytes), (_bytes)); \
+    }                                                                    \
+  } while (0)
+
+static int32_t buildFixedLenGroupKeys(SGroupbyOperatorInfo* pInfo, const SSDataBlock* pBlock) {
+  SGroupbyBlockKeys* pKeys = &pInfo->blockKeys;
+  int32_t            numOfGroupCols = taosArrayGetSize(pInfo->pGroupCols);
+  int32_t            rows = pBlock->info.rows;
+  int32_t            keyLen = pInfo->groupKeyLen;
+
+  int32_t code = ensureGroupbyKeyBuf(pKeys, rows * keyLen);
+  if (code != TSDB_CODE_SUCCESS) {
+    return code;
+  }
+
+  // the same layout with buildGroupKeys: null flags followed by the values
+  for (int32_t j = 0; j < rows; ++j) {
+    pKeys->pOffset[j] = j * keyLen;
+    pKeys->pLen[j] = keyLen;
+    memset(pKeys->pBuf + j * keyLen, 0, numOfGroupCols);
+  }
+
+  int32_t offset = numOfGroupCols * sizeof(int8_t);
+  for (int32_t i = 0; i < numOfGroupCols; ++i) {
+    SColumn*         pCol = taosArrayGet(pInfo->pGroupCols, i);
+    SColumnInfoData* pColInfoData = taosArrayGet(pBlock->pDataBlock, pCol->slotId);
+    char*            pDst = pKeys->pBuf + offset;
+    const char*      pSrc = pColInfoData->pData;
+
+    switch (pCol->bytes) {
+      case sizeof(int8_t):
+        COPY_FIXED_GROUP_KEY(pDst, pSrc, rows, keyLen, sizeof(int8_t));
+        break;
+      case sizeof(int16_t):
+        COPY_FIXED_GROUP_KEY(pDst, pSrc, rows, keyLen, sizeof(int16_t));
+        break;
+      case sizeof(int32_t):
+        COPY_FIXED_GROUP_KEY(pDst, pSrc, rows, keyLen, sizeof(int32_t));
+        break;
+      case sizeof(int64_t):
+        COPY_FIXED_GROUP_KEY(pDst, pSrc, rows, keyLen, sizeof(int64_t));
+        break;
+      default:
+        COPY_FIXED_GROUP_KEY(pDst, pSrc, rows, keyLen, pCol->bytes);
+        break;
+    }
+
+    offset += pCol->bytes;
+  }
+
+  for (int32_t j = 0; j < rows; ++j) {
+    pKeys->pHash[j] = groupKeyHash(pKeys->pBuf + j * keyLen, keyLen);
+  }
+
+  return TSDB_CODE_SUCCESS;
+}
+
+static int32_t buildVarLenGroupKeys(SGroupbyOperatorInfo* pInfo, SSDataBlock* pBlock) {
+  SGroupbyBlockKeys* pKeys = &pInfo->blockKeys;
+  int32_t            offset = 0;
 
-  int32_t num = 0;
-  uint64_t groupId = 0;
   for (int32_t j = 0; j < pBlock->info.rows; ++j) {
-    // Compare with the previous row of this column, and do not set the output buffer again if they are identical.
-    if (!pInfo->isInit) {
-      recordNewGroupKeys(pInfo->pGroupCols, pInfo->pGroupColVals, pBlock, j);
-      if (terrno != TSDB_CODE_SUCCESS) {  // group by json error
-        T_LONG_JMP(pTaskInfo->env, terrno);
-      }
-      pInfo->isInit = true;
-      num++;
-      continue;
+    recordNewGroupKeys(pInfo->pGroupCols, pInfo->pGroupColVals, pBlock, j);
+    if (terrno != TSDB_CODE_SUCCESS) {  // group by json error
+      return terrno;
     }
 
-    bool equal = groupKeyCompare(pInfo->pGroupCols, pInfo->pGroupColVals, pBlock, j, numOfGroupCols);
-    if (equal) {
-      num++;
-      continue;
+    int32_t len = buildGroupKeys(pInfo->keyBuf, pInfo->pGroupColVals);
+    int32_t code = ensureGroupbyKeyBuf(pKeys, offset + len);
+    if (code != TSDB_CODE_SUCCESS) {
+      return code;
     }
 
-    // The first row of a new block does not belongs to the previous existed group
-    if (j == 0) {
-      num++;
-      recordNewGroupKeys(pInfo->pGroupCols, pInfo->pGroupColVals, pBlock, j);
-      if (terrno != TSDB_CODE_SUCCESS) {  // group by json error
-        T_LONG_JMP(pTaskInfo->env, terrno);
+    memcpy(pKeys->pBuf + offset, pInfo->keyBuf, len);
+    pKeys->pOffset[j] = offset;
+    pKeys->pLen[j] = len;
+    pKeys->pHash[j] = groupKeyHash(pInfo->keyBuf, len);
+    offset += len;
+  }
+
+  return TSDB_CODE_SUCCESS;
+}
+
+static FORCE_INLINE bool isSameGroupKey(const SGroupbyBlockKeys* pKeys, int32_t row1, int32_t row2) {
+  return pKeys->pHash[row1] == pKeys->pHash[row2] && pKeys->pLen[row1] == pKeys->pLen[row2] &&
+         memcmp(pKeys->pBuf + pKeys->pOffset[row1], pKeys->pBuf + pKeys->pOffset[row2], pKeys->pLen[row1]) == 0;
+}
+
+// assign each row to a group of current block, return the number of runs of identical keys
+static int32_t assignBlockGroups(SGroupbyBlockKeys* pKeys, int32_t rows) {
+  SGroupbySlot* pSlots = pKeys->pSlots;
+  int32_t       mask = pKeys->numOfSlots - 1;
+  int32_t       numOfRuns = 0;
+
+  for (int32_t i = 0; i < pKeys->numOfSlots; ++i) {
+    pSlots[i].group = -1;
+  }
+  taosArrayClear(pKeys->pGroups);
+
+  for (int32_t j = 0; j < rows; ++j) {
+    int32_t group = -1;
+    if (j > 0 && isSameGroupKey(pKeys, j - 1, j)) {
+      group = pKeys->pRowGroup[j - 1];
+    } else {
+      numOfRuns += 1;
+
+      uint32_t hash = pKeys->pHash[j];
+      for (int32_t s = hash & mask;; s = (s + 1) & mask) {
+        SGroupbySlot* pSlot = &pSlots[s];
+        if (pSlot->group == -1) {
+          SGroupbyBlockGroup g = {.row = j};
+          taosArrayPush(pKeys->pGroups, &g);
+
+          pSlot->hash = hash;
+          pSlot->group = taosArrayGetSize(pKeys->pGroups) - 1;
+          group = pSlot->group;
+          break;
+        }
+
+        if (pSlot->hash == hash) {
+          SGroupbyBlockGroup* pGroup = TARRAY_GET_ELEM(pKeys->pGroups, pSlot->group);
+          if (isSameGroupKey(pKeys, pGroup->row, j)) {
+            group = pSlot->group;
+            break;
+          }
+        }
       }
+    }
+
+    pKeys->pRowGroup[j] = group;
+    ((SGroupbyBlockGroup*)TARRAY_GET_ELEM(pKeys->pGroups, group))->numOfRows += 1;
+  }
+
+  return numOfRuns;
+}
+
+// append the rows of pSrc in the order of pIndex to pDst
+static int32_t appendRowsByIndex(SSDataBlock* pDst, const SSDataBlock* pSrc, const int32_t* pIndex, int32_t num) {
+  int32_t start = pDst->info.rows;
+  int32_t code = blockDataEnsureCapacity(pDst, start + num);
+  if (code != TSDB_CODE_SUCCESS) {
+    return code;
+  }
+
+  size_t numOfCols = taosArrayGetSize(pSrc->pDataBlock);
+  for (int32_t i = 0; i < numOfCols; ++i) {
+    SColumnInfoData* pSrcCol = taosArrayGet(pSrc->pDataBlock, i);
+    SColumnInfoData* pDstCol = taosArrayGet(pDst->pDataBlock, i);
+    SColumnDataAgg*  pColAgg = (pSrc->pBlockAgg != NULL) ? pSrc->pBlockAgg[i] : NULL;
+
+    for (int32_t k = 0; k < num; ++k) {
+      int32_t row = pIndex[k];
+      if (colDataIsNull(pSrcCol, pSrc->info.rows, row, pColAgg)) {
+        colDataSetNULL(pDstCol, start + k);
+        continue;
+      }
+
+      code = colDataSetVal(pDstCol, start + k, colDataGetData(pSrcCol, row), false);
+      if (code != TSDB_CODE_SUCCESS) {
+        return code;
+      }
+    }
+  }
+
+  pDst->info.rows += num;
+  return TSDB_CODE_SUCCESS;
+}
+
+static int32_t flushSpilledPartition(SGroupbySpillSup* pSup, int32_t index) {
+  SSDataBlock* pBlock = pSup->pBlocks[index];
+  if (pBlock == NULL || pBlock->info.rows == 0) {
+    return TSDB_CODE_SUCCESS;
+  }
+
+  int32_t start = 0;
+  while (start < pBlock->info.rows) {
+    int32_t stop = 0;
+    blockDataSplitRows(pBlock, pBlock->info.hasVarCol, start, &stop, getBufPageSize(pSup->pBuf));
+    SSDataBlock* p = blockDataExtractBlock(pBlock, start, stop - start + 1);
+    if (p == NULL) {
+      return terrno;
+    }
+
+    SGroupbySpilledPage page = {.pageId = -1, .groupId = pBlock->info.id.groupId};
+    void*               pPage = getNewBufPage(pSup->pBuf, &page.pageId);
+    if (pPage == NULL) {
+      blockDataDestroy(p);
+      return terrno;
+    }
+
+    blockDataToBuf(pPage, p);
+    setBufPageDirty(pPage, true);
+    releaseBufPage(pSup->pBuf, pPage);
+    blockDataDestroy(p);
+
+    taosArrayPush(pSup->pPages[index], &page);
+    start = stop + 1;
+  }
+
+  blockDataCleanup(pBlock);
+  return TSDB_CODE_SUCCESS;
+}
+
+static int32_t appendSpilledRows(SGroupbySpillSup* pSup, int32_t index, const SSDataBlock* pSrc, const int32_t* pIndex,
+                                 int32_t num, const char* id) {
+  int32_t code = TSDB_CODE_SUCCESS;
+
+  if (pSup->pBuf == NULL) {
+    uint32_t pageSize = 0;
+    uint32_t bufSize = 0;
+    code = getBufferPgSize(blockDataGetRowSize((SSDataBlock*)pSrc), &pageSize, &bufSize);
+    if (code != TSDB_CODE_SUCCESS) {
+      return code;
+    }
+
+    if (!osTempSpaceAvailable()) {
+      qError("failed to spill group by results since %s, tempDir:%s, %s", terrstr(TSDB_CODE_NO_DISKSPACE), tsTempDir,
+             id);
+      return TSDB_CODE_NO_DISKSPACE;
+    }
+
+    code = createDiskbasedBuf(&pSup->pBuf, pageSize, bufSize, "groupbySpillBuf", tsTempDir, tsPagedBufCompress);
+    if (code != TSDB_CODE_SUCCESS) {
+      return code;
+    }
+    qDebug("group by results begin to be spilled, pageSize:%u, %s", pageSize, id);
+  }
+
+  if (pSup->pBlocks[index] == NULL) {
+    pSup->pBlocks[index] = createOneDataBlock(pSrc, false);
+    pSup->pPages[index] = taosArrayInit(4, sizeof(SGroupbySpilledPage));
+    if (pSup->pBlocks[index] == NULL || pSup->pPages[index] == NULL) {
+      return TSDB_CODE_OUT_OF_MEMORY;
+    }
+  }
+
+  SSDataBlock* pBlock = pSup->pBlocks[index];
+  if (pBlock->info.rows > 0 && pBlock->info.id.groupId != pSrc->info.id.groupId) {
+    code = flushSpilledPartition(pSup, index);
+    if (code != TSDB_CODE_SUCCESS) {
+      return code;
+    }
+  }
+
+  pBlock->info.id.groupId = pSrc->info.id.groupId;
+  code = appendRowsByIndex(pBlock, pSrc, pIndex, num);
+  if (code != TSDB_CODE_SUCCESS) {
+    return code;
+  }
+
+  if (pBlock->info.rows >= GROUPBY_SPILL_BLOCK_ROWS) {
+    code = flushSpilledPartition(pSup, index);
+  }
+
+  return code;
+}
+
+static int32_t spillNewGroups(SOperatorInfo* pOperator, SSDataBlock* pBlock) {
+  SGroupbyOperatorInfo* pInfo = pOperator->info;
+  SGroupbyBlockKeys*    pKeys = &pInfo->blockKeys;
+  int32_t               numOfGroups = taosArrayGetSize(pKeys->pGroups);
+  int32_t               count[GROUPBY_SPILL_PARTITIONS] = {0};
+  int32_t               offset[GROUPBY_SPILL_PARTITIONS] = {0};
+  int32_t               numOfSpilled = 0;
+
+  for (int32_t i = 0; i < numOfGroups; ++i) {
+    SGroupbyBlockGroup* pGroup = TARRAY_GET_ELEM(pKeys->pGroups, i);
+    char*               pKey = pKeys->pBuf + pKeys->pOffset[pGroup->row];
+    int32_t             len = pKeys->pLen[pGroup->row];
+
+    SET_RES_WINDOW_KEY(pInfo->aggSup.keyBuf, pKey, len, pGroup->id);
+    if (tSimpleHashGet(pInfo->aggSup.pResultRowHashTable, pInfo->aggSup.keyBuf, GET_RES_WINDOW_KEY_LEN(len)) == NULL) {
+      pGroup->spilled = true;
+      count[pGroup->id >> (64 - GROUPBY_SPILL_PARTITION_BITS)] += pGroup->numOfRows;
+      numOfSpilled += pGroup->numOfRows;
+    }
+  }
+
+  if (numOfSpilled == 0) {
+    return TSDB_CODE_SUCCESS;
+  }
+
+  for (int32_t i = 1; i < GROUPBY_SPILL_PARTITIONS; ++i) {
+    offset[i] = offset[i - 1] + count[i - 1];
+  }
+
+  for (int32_t j = 0; j < pBlock->info.rows; ++j) {
+    SGroupbyBlockGroup* pGroup = TARRAY_GET_ELEM(pKeys->pGroups, pKeys->pRowGroup[j]);
+    if (pGroup->spilled) {
+      pKeys->pIndex[offset[pGroup->id >> (64 - GROUPBY_SPILL_PARTITION_BITS)]++] = j;
+      pKeys->pRowGroup[j] = -1;
+    }
+  }
+
+  for (int32_t i = 0, start = 0; i < GROUPBY_SPILL_PARTITIONS; start += count[i], ++i) {
+    if (count[i] == 0) {
       continue;
     }
 
-    len = buildGroupKeys(pInfo->keyBuf, pInfo->pGroupColVals);
-    int32_t ret = setGroupResultOutputBuf(pOperator, &(pInfo->binfo), pOperator->exprSupp.numOfExprs, pInfo->keyBuf,
-                                          len, pBlock->info.id.groupId, pInfo->aggSup.pResultBuf, &pInfo->aggSup);
-    if (ret != TSDB_CODE_SUCCESS) {  // null data, too many state code
-      T_LONG_JMP(pTaskInfo->env, TSDB_CODE_APP_ERROR);
+    int32_t code = appendSpilledRows(&pInfo->spillSup, i, pBlock, pKeys->pIndex + start, count[i],
+                                     GET_TASKID(pOperator->pTaskInfo));
+    if (code != TSDB_CODE_SUCCESS) {
+      return code;
     }
+  }
 
-    int32_t rowIndex = j - num;
-    applyAggFunctionOnPartialTuples(pTaskInfo, pCtx, NULL, rowIndex, num, pBlock->info.rows,
-                                    pOperator->exprSupp.numOfExprs);
+  return TSDB_CODE_SUCCESS;
+}
 
-    // assign the group keys or user input constant values if required
-    doAssignGroupKeys(pCtx, pOperator->exprSupp.numOfExprs, pBlock->info.rows, rowIndex);
-    recordNewGroupKeys(pInfo->pGroupCols, pInfo->pGroupColVals, pBlock, j);
-    num = 1;
+static void setGroupResultRow(SOperatorInfo* pOperator, const SGroupbyBlockGroup* pGroup) {
+  SGroupbyOperatorInfo* pInfo = pOperator->info;
+  SGroupbyBlockKeys*    pKeys = &pInfo->blockKeys;
+
+  // the group id has been calculated, keep it
+  char*       pKey = pKeys->pBuf + pKeys->pOffset[pGroup->row];
+  SResultRow* pResultRow = doSetResultOutBufByKey(pInfo->aggSup.pResultBuf, &pInfo->binfo.resultRowInfo, pKey,
+                                                  pKeys->pLen[pGroup->row], true, pGroup->id, pOperator->pTaskInfo,
+                                                  false, &pInfo->aggSup, true);
+  setResultRowInitCtx(pResultRow, pOperator->exprSupp.pCtx, pOperator->exprSupp.numOfExprs,
+                      pOperator->exprSupp.rowEntryInfoOffset);
+}
+
+static int32_t doGatherGroupbyAgg(SOperatorInfo* pOperator, SSDataBlock* pBlock) {
+  SGroupbyOperatorInfo* pInfo = pOperator->info;
+  SGroupbyBlockKeys*    pKeys = &pInfo->blockKeys;
+  SExecTaskInfo*        pTaskInfo = pOperator->pTaskInfo;
+  SqlFunctionCtx*       pCtx = pOperator->exprSupp.pCtx;
+  int32_t               numOfGroups = taosArrayGetSize(pKeys->pGroups);
+
+  if (pInfo->pGatherBlock != NULL &&
+      taosArrayGetSize(pInfo->pGatherBlock->pDataBlock) != taosArrayGetSize(pBlock->pDataBlock)) {
+    pInfo->pGatherBlock = blockDataDestroy(pInfo->pGatherBlock);
   }
 
-  if (num > 0) {
-    len = buildGroupKeys(pInfo->keyBuf, pInfo->pGroupColVals);
-    int32_t ret = setGroupResultOutputBuf(pOperator, &(pInfo->binfo), pOperator->exprSupp.numOfExprs, pInfo->keyBuf,
-                                          len, pBlock->info.id.groupId, pInfo->aggSup.pResultBuf, &pInfo->aggSup);
-    if (ret != TSDB_CODE_SUCCESS) {
-      T_LONG_JMP(pTaskInfo->env, TSDB_CODE_APP_ERROR);
+  if (pInfo->pGatherBlock == NULL) {
+    pInfo->pGatherBlock = createOneDataBlock(pBlock, false);
+    if (pInfo->pGatherBlock == NULL) {
+      return TSDB_CODE_OUT_OF_MEMORY;
     }
+  }
 
-    int32_t rowIndex = pBlock->info.rows - num;
-    applyAggFunctionOnPartialTuples(pTaskInfo, pCtx, NULL, rowIndex, num, pBlock->info.rows,
+  int32_t total = 0;
+  for (int32_t i = 0; i < numOfGroups; ++i) {
+    SGroupbyBlockGroup* pGroup = TARRAY_GET_ELEM(pKeys->pGroups, i);
+    pGroup->start = total;
+    if (!pGroup->spilled) {
+      total += pGroup->numOfRows;
+    }
+  }
+
+  // stable, the rows of each group are kept in the original order
+  for (int32_t j = 0; j < pBlock->info.rows; ++j) {
+    if (pKeys->pRowGroup[j] >= 0) {
+      SGroupbyBlockGroup* pGroup = TARRAY_GET_ELEM(pKeys->pGroups, pKeys->pRowGroup[j]);
+      pKeys->pIndex[pGroup->start++] = j;
+    }
+  }
+
+  if (total == 0) {
+    return TSDB_CODE_SUCCESS;
+  }
+
+  SSDataBlock* pGather = pInfo->pGatherBlock;
+  blockDataCleanup(pGather);
+  pGather->info.id.groupId = pBlock->info.id.groupId;
+  pGather->info.scanFlag = pBlock->info.scanFlag;
+
+  int32_t code = appendRowsByIndex(pGather, pBlock, pKeys->pIndex, total);
+  if (code != TSDB_CODE_SUCCESS) {
+    return code;
+  }
+
+  setInputDataBlock(&pOperator->exprSupp, pGather, pInfo->binfo.inputTsOrder, pBlock->info.scanFlag, true);
+  for (int32_t i = 0; i < numOfGroups; ++i) {
+    SGroupbyBlockGroup* pGroup = TARRAY_GET_ELEM(pKeys->pGroups, i);
+    if (pGroup->spilled) {
+      continue;
+    }
+
+    int32_t rowIndex = pGroup->start - pGroup->numOfRows;
+    setGroupResultRow(pOperator, pGroup);
+    applyAggFunctionOnPartialTuples(pTaskInfo, pCtx, NULL, rowIndex, pGroup->numOfRows, total,
                                     pOperator->exprSupp.numOfExprs);
-    doAssignGroupKeys(pCtx, pOperator->exprSupp.numOfExprs, pBlock->info.rows, rowIndex);
+    doAssignGroupKeys(pCtx, pOperator->exprSupp.numOfExprs, total, rowIndex);
+  }
+
+  return TSDB_CODE_SUCCESS;
+}
+
+static void doHashGroupbyAgg(SOperatorInfo* pOperator, SSDataBlock* pBlock) {
+  SExecTaskInfo*        pTaskInfo = pOperator->pTaskInfo;
+  SGroupbyOperatorInfo* pInfo = pOperator->info;
+  SGroupbyBlockKeys*    pKeys = &pInfo->blockKeys;
+  SqlFunctionCtx*       pCtx = pOperator->exprSupp.pCtx;
+  int32_t               rows = pBlock->info.rows;
+
+  if (rows == 0) {
+    return;
+  }
+
+  terrno = TSDB_CODE_SUCCESS;
+  int32_t code = ensureGroupbyBlockKeys(pKeys, rows);
+  if (code != TSDB_CODE_SUCCESS) {
+    T_LONG_JMP(pTaskInfo->env, code);
+  }
+
+  // build and hash the keys of the whole block
+  if (isFixedLenGroupKeys(pInfo->pGroupCols, pBlock)) {
+    code = buildFixedLenGroupKeys(pInfo, pBlock);
+  } else {
+    code = buildVarLenGroupKeys(pInfo, pBlock);
+  }
+  if (code != TSDB_CODE_SUCCESS) {
+    T_LONG_JMP(pTaskInfo->env, code);
+  }
+
+  int32_t numOfRuns = assignBlockGroups(pKeys, rows);
+  int32_t numOfGroups = taosArrayGetSize(pKeys->pGroups);
+
+  // calculate the id of result row once for each group of the block
+  for (int32_t i = 0; i < numOfGroups; ++i) {
+    SGroupbyBlockGroup* pGroup = TARRAY_GET_ELEM(pKeys->pGroups, i);
+    int32_t             len = pKeys->pLen[pGroup->row];
+
+    SET_RES_WINDOW_KEY(pInfo->aggSup.keyBuf, pKeys->pBuf + pKeys->pOffset[pGroup->row], len, pBlock->info.id.groupId);
+    pGroup->id = calcGroupId(pInfo->aggSup.keyBuf, GET_RES_WINDOW_KEY_LEN(len));
+  }
+
+  // the data of the block may not be loaded if there is block sma, the rows of new groups can not be spilled then
+  bool hasSma = (pBlock->pBlockAgg != NULL);
+  if (pInfo->spillSup.spilling) {
+    if (hasSma) {
+      qError("group by block sma received while spilling, %s", GET_TASKID(pTaskInfo));
+      T_LONG_JMP(pTaskInfo->env, TSDB_CODE_QRY_SYS_ERROR);
+    }
+
+    code = spillNewGroups(pOperator, pBlock);
+    if (code != TSDB_CODE_SUCCESS) {
+      T_LONG_JMP(pTaskInfo->env, code);
+    }
   }
+
+  if (!hasSma && numOfGroups * GROUPBY_GATHER_FACTOR <= numOfRuns) {
+    code = doGatherGroupbyAgg(pOperator, pBlock);
+    if (code != TSDB_CODE_SUCCESS) {
+      T_LONG_JMP(pTaskInfo->env, code);
+    }
+    return;
+  }
+
+  for (int32_t j = 0; j < rows;) {
+    int32_t group = pKeys->pRowGroup[j];
+    int32_t end = j + 1;
+    while (end < rows && pKeys->pRowGroup[end] == group) {
+      end += 1;
+    }
+
+    if (group >= 0) {
+      setGroupResultRow(pOperator, TARRAY_GET_ELEM(pKeys->pGroups, group));
+      applyAggFunctionOnPartialTuples(pTaskInfo, pCtx, NULL, j, end - j, rows, pOperator->exprSupp.numOfExprs);
+
+      // assign the group keys or user input constant values if required
+      doAssignGroupKeys(pCtx, pOperator->exprSupp.numOfExprs, rows, j);
+    }
+
+    j = end;
+  }
+}
+
+static bool hasRemainSpilledPartition(SGroupbyOperatorInfo* pInfo) {
+  SGroupbySpillSup* pSup = &pInfo->spillSup;
+  for (; pSup->partIndex < GROUPBY_SPILL_PARTITIONS; ++pSup->partIndex) {
+    if (pSup->pPages[pSup->partIndex] != NULL && taosArrayGetSize(pSup->pPages[pSup->partIndex]) > 0) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// aggregate the rows of next spilled partition with an empty result buffer
+static int32_t aggregateSpilledPartition(SOperatorInfo* pOperator) {
+  SGroupbyOperatorInfo* pInfo = pOperator->info;
+  SGroupbySpillSup*     pSup = &pInfo->spillSup;
+  SArray*               pPages = pSup->pPages[pSup->partIndex];
+
+  tSimpleHashClear(pInfo->aggSup.pResultRowHashTable);
+  clearDiskbasedBuf(pInfo->aggSup.pResultBuf);
+  initResultRowInfo(&pInfo->binfo.resultRowInfo);
+  pInfo->aggSup.currentPageId = -1;
+
+  if (pSup->pLoadBlock == NULL) {
+    pSup->pLoadBlock = createOneDataBlock(pSup->pBlocks[pSup->partIndex], false);
+    if (pSup->pLoadBlock == NULL) {
+      return TSDB_CODE_OUT_OF_MEMORY;
+    }
+  }
+
+  SSDataBlock* pBlock = pSup->pLoadBlock;
+  for (int32_t i = 0; i < taosArrayGetSize(pPages); ++i) {
+    SGroupbySpilledPage* pSpilled = taosArrayGet(pPages, i);
+
+    void* pPage = getBufPage(pSup->pBuf, pSpilled->pageId);
+    if (pPage == NULL) {
+      return terrno;
+    }
+
+    blockDataCleanup(pBlock);
+    int32_t code = blockDataFromBuf(pBlock, pPage);
+    releaseBufPage(pSup->pBuf, pPage);
+    if (code != TSDB_CODE_SUCCESS) {
+      return code;
+    }
+
+    for (int32_t j = 0; j < taosArrayGetSize(pBlock->pDataBlock); ++j) {
+      SColumnInfoData* pCol = taosArrayGet(pBlock->pDataBlock, j);
+      pCol->hasNull = true;
+    }
+
+    pBlock->info.id.groupId = pSpilled->groupId;
+    setInputDataBlock(&pOperator->exprSupp, pBlock, pInfo->binfo.inputTsOrder, pBlock->info.scanFlag, true);
+    doHashGroupbyAgg(pOperator, pBlock);
+  }
+
+  qDebug("group by spilled partition:%d aggregated, pages:%d, groups:%d, %s", pSup->partIndex,
+         (int32_t)taosArrayGetSize(pPages), tSimpleHashGetSize(pInfo->aggSup.pResultRowHashTable),
+         GET_TASKID(pOperator->pTaskInfo));
+
+  taosArrayClear(pPages);
+  pSup->partIndex += 1;
+
+  initGroupedResultInfo(&pInfo->groupResInfo, pInfo->aggSup.pResultRowHashTable, 0);
+  return TSDB_CODE_SUCCESS;
 }
 
 static SSDataBlock* buildGroupResultDataBlock(SOperatorInfo* pOperator) {
@@ -353,8 +953,15 @@ static SSDataBlock* buildGroupResultDataBlock(SOperatorInfo* pOperator) {
     doFilter(pRes, pOperator->exprSupp.pFilterInfo, NULL);
 
     if (!hasRemainResults(&pInfo->groupResInfo)) {
-      setOperatorCompleted(pOperator);
-      break;
+      if (!hasRemainSpilledPartition(pInfo)) {
+        setOperatorCompleted(pOperator);
+        break;
+      }
+
+      int32_t code = aggregateSpilledPartition(pOperator);
+      if (code != TSDB_CODE_SUCCESS) {
+        T_LONG_JMP(pOperator->pTaskInfo->env, code);
+      }
     }
 
     if (pRes->info.rows > 0) {
@@ -403,10 +1010,29 @@ static SSDataBlock* hashGroupbyAggregate(SOperatorInfo* pOperator) {
     }
 
     doHashGroupbyAgg(pOperator, pBlock);
+
+    // the result buffer exceeds the memory limit, stop adding new groups into it. The rows of a group spilled are
+    // needed from then on, a block sma of the group would be aggregated in memory as another group.
+    if (!pInfo->spillSup.spilling && !isAllDataInMemBuf(pInfo->aggSup.pResultBuf)) {
+      pInfo->spillSup.spilling = true;
+      disableTableScanBlockSma(downstream, GET_TASKID(pTaskInfo));
+      qDebug("group by result buffer is full, groups:%d, new groups will be spilled, %s",
+             tSimpleHashGetSize(pInfo->aggSup.pResultRowHashTable), GET_TASKID(pTaskInfo));
+    }
   }
 
   pOperator->status = OP_RES_TO_RETURN;
 
+  if (pInfo->spillSup.spilling) {
+    pInfo->spillSup.spilling = false;
+    for (int32_t i = 0; i < GROUPBY_SPILL_PARTITIONS; ++i) {
+      int32_t code = flushSpilledPartition(&pInfo->spillSup, i);
+      if (code != TSDB_CODE_SUCCESS) {
+        T_LONG_JMP(pTaskInfo->env, code);
+      }
+    }
+  }
+
 #if 0
   if(pOperator->fpSet.encodeResultRow){
     char *result = NULL;
@@ -883,7 +1509,7 @@ SOperatorInfo* createPartitionOperatorInfo(SOperatorInfo* downstream, SPartition
     goto _error;
   }
 
-  code = createDiskbasedBuf(&pInfo->pBuf, defaultPgsz, defaultBufsz, pTaskInfo->id.str, tsTempDir);
+  code = createDiskbasedBuf(&pInfo->pBuf, defaultPgsz, defaultBufsz, pTaskInfo->id.str, tsTempDir, tsPagedBufCompress);
   if (code != TSDB_CODE_SUCCESS) {
     terrno = code;
     pTaskInfo->code = code;
@@ -925,19 +1551,6 @@ _error:
   return NULL;
 }
 
-int32_t setGroupResultOutputBuf(SOperatorInfo* pOperator, SOptrBasicInfo* binfo, int32_t numOfCols, char* pData,
-                                int16_t bytes, uint64_t groupId, SDiskbasedBuf* pBuf, SAggSupporter* pAggSup) {
-  SExecTaskInfo*  pTaskInfo = pOperator->pTaskInfo;
-  SResultRowInfo* pResultRowInfo = &binfo->resultRowInfo;
-  SqlFunctionCtx* pCtx = pOperator->exprSupp.pCtx;
-
-  SResultRow* pResultRow =
-      doSetResultOutBufByKey(pBuf, pResultRowInfo, (char*)pData, bytes, true, groupId, pTaskInfo, false, pAggSup, false);
-
-  setResultRowInitCtx(pResultRow, pCtx, numOfCols, pOperator->exprSupp.rowEntryInfoOffset);
-  return TSDB_CODE_SUCCESS;
-}
-
 uint64_t calGroupIdByData(SPartitionBySupporter* pParSup, SExprSupp* pExprSup, SSDataBlock* pBlock, int32_t rowId) {
   if (pExprSup->pExprInfo != NULL) {
     int32_t code =
@@ -716,3 +716,425 @@ SSDataBlock* doMergeJoin(struct SOperatorInfo* pOperator) {
   }
   return (pRes->info.rows > 0) ? pRes : NULL;
 }
+
+typedef struct SHJoinRowPos {
+  int32_t pageId;
+  int32_t offset;
+} SHJoinRowPos;
+
+typedef struct SHJoinColMap {
+  int32_t srcSlot;
+  int32_t dstSlot;
+  int16_t type;
+  int32_t bytes;
+} SHJoinColMap;
+
+/*
+ * The right child is the build side, the left child is the probe side, so that the unmatched rows of left join can be
+ * output while probing. The build rows are saved row by row in the paged buffer, which is flushed to disk when the
+ * build side exceeds the in-memory pages. Each row is prefixed by the position of the previous row of the same key,
+ * and the hash table only keeps the position of the last row of each key.
+ */
+typedef struct SHJoinOperatorInfo {
+  SSDataBlock*   pRes;
+  int32_t        joinType;
+  SArray*        pProbeKeyCols;  // SColumn
+  SArray*        pBuildKeyCols;  // SColumn
+  char*          keyBuf;
+  int32_t        keyLen;
+  SArray*        pProbeCols;  // SHJoinColMap
+  SArray*        pBuildCols;  // SHJoinColMap
+  SNode*         pCondAfterJoin;
+  SSHashObj*     pBuildTable;  // key -> SHJoinRowPos
+  SDiskbasedBuf* pBuildBuf;
+  int32_t        pageSize;
+  void*          pWritePage;
+  SHJoinRowPos   writePos;
+  bool           built;
+  bool           probeDone;
+  SSDataBlock*   pProbeBlock;
+  int32_t        probeRow;
+  SHJoinRowPos   nextPos;  // the next build row matched by the current probe row
+} SHJoinOperatorInfo;
+
+static int32_t hJoinGetValueLen(int16_t type, int32_t bytes, const char* val) {
+  if (TSDB_DATA_TYPE_JSON == type) {
+    return getJsonValueLen(val);
+  } else if (IS_VAR_DATA_TYPE(type)) {
+    return varDataTLen(val);
+  }
+  return bytes;
+}
+
+static bool hJoinKeyHasNull(const char* pKey, int32_t numOfKeys) {
+  for (int32_t i = 0; i < numOfKeys; ++i) {
+    if (pKey[i]) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static int32_t hJoinAppendBuildRow(SHJoinOperatorInfo* pInfo, SSDataBlock* pBlock, int32_t row, SHJoinRowPos* pHead) {
+  int32_t numOfCols = taosArrayGetSize(pInfo->pBuildCols);
+  int32_t rowLen = sizeof(SHJoinRowPos);
+  for (int32_t i = 0; i < numOfCols; ++i) {
+    SHJoinColMap*    pCol = taosArrayGet(pInfo->pBuildCols, i);
+    SColumnInfoData* pSrc = taosArrayGet(pBlock->pDataBlock, pCol->srcSlot);
+    rowLen += sizeof(int8_t);
+    if (!colDataIsNull_s(pSrc, row)) {
+      rowLen += hJoinGetValueLen(pCol->type, pCol->bytes, colDataGetData(pSrc, row));
+    }
+  }
+
+  if (NULL == pInfo->pWritePage || pInfo->writePos.offset + rowLen > pInfo->pageSize) {
+    if (NULL != pInfo->pWritePage) {
+      releaseBufPage(pInfo->pBuildBuf, pInfo->pWritePage);
+    }
+    pInfo->pWritePage = getNewBufPage(pInfo->pBuildBuf, &pInfo->writePos.pageId);
+    if (NULL == pInfo->pWritePage) {
+      return terrno;
+    }
+    pInfo->writePos.offset = 0;
+  }
+
+  char* p = (char*)pInfo->pWritePage + pInfo->writePos.offset;
+  memcpy(p, pHead, sizeof(SHJoinRowPos));
+  p += sizeof(SHJoinRowPos);
+  for (int32_t i = 0; i < numOfCols; ++i) {
+    SHJoinColMap*    pCol = taosArrayGet(pInfo->pBuildCols, i);
+    SColumnInfoData* pSrc = taosArrayGet(pBlock->pDataBlock, pCol->srcSlot);
+    if (colDataIsNull_s(pSrc, row)) {
+      *(int8_t*)p = 1;
+      p += sizeof(int8_t);
+      continue;
+    }
+    *(int8_t*)p = 0;
+    p += sizeof(int8_t);
+    char*   val = colDataGetData(pSrc, row);
+    int32_t len = hJoinGetValueLen(pCol->type, pCol->bytes, val);
+    memcpy(p, val, len);
+    p += len;
+  }
+  setBufPageDirty(pInfo->pWritePage, true);
+
+  *pHead = pInfo->writePos;
+  pInfo->writePos.offset += rowLen;
+  return TSDB_CODE_SUCCESS;
+}
+
+static int32_t hJoinBuildHashTable(SOperatorInfo* pOperator) {
+  SHJoinOperatorInfo* pInfo = pOperator->info;
+  SOperatorInfo*      pBuildDownstream = pOperator->pDownstream[1];
+  int32_t             numOfKeys = taosArrayGetSize(pInfo->pBuildKeyCols);
+  int32_t             code = TSDB_CODE_SUCCESS;
+
+  while (TSDB_CODE_SUCCESS == code) {
+    SSDataBlock* pBlock = pBuildDownstream->fpSet.getNextFn(pBuildDownstream);
+    if (NULL == pBlock) {
+      break;
+    }
+
+    for (int32_t i = 0; i < pBlock->info.rows; ++i) {
+      int32_t keyLen = fillKeyBufFromTagCols(pInfo->pBuildKeyCols, pBlock, i, pInfo->keyBuf);
+      // null is not equal to any value
+      if (hJoinKeyHasNull(pInfo->keyBuf, numOfKeys)) {
+        continue;
+      }
+
+      SHJoinRowPos* pHead = tSimpleHashGet(pInfo->pBuildTable, pInfo->keyBuf, keyLen);
+      if (NULL != pHead) {
+        code = hJoinAppendBuildRow(pInfo, pBlock, i, pHead);
+      } else {
+        SHJoinRowPos head = {.pageId = -1, .offset = 0};
+        code = hJoinAppendBuildRow(pInfo, pBlock, i, &head);
+        if (TSDB_CODE_SUCCESS == code &&
+            0 != tSimpleHashPut(pInfo->pBuildTable, pInfo->keyBuf, keyLen, &head, sizeof(SHJoinRowPos))) {
+          code = TSDB_CODE_OUT_OF_MEMORY;
+        }
+      }
+      if (TSDB_CODE_SUCCESS != code) {
+        break;
+      }
+    }
+  }
+
+  if (NULL != pInfo->pWritePage) {
+    releaseBufPage(pInfo->pBuildBuf, pInfo->pWritePage);
+    pInfo->pWritePage = NULL;
+  }
+  return code;
+}
+
+static void hJoinAppendResRow(SHJoinOperatorInfo* pInfo, SSDataBlock* pRes, const char* pBuildRow) {
+  int32_t row = pRes->info.rows;
+
+  for (int32_t i = 0; i < taosArrayGetSize(pInfo->pProbeCols); ++i) {
+    SHJoinColMap*    pCol = taosArrayGet(pInfo->pProbeCols, i);
+    SColumnInfoData* pSrc = taosArrayGet(pInfo->pProbeBlock->pDataBlock, pCol->srcSlot);
+    SColumnInfoData* pDst = taosArrayGet(pRes->pDataBlock, pCol->dstSlot);
+    if (colDataIsNull_s(pSrc, pInfo->probeRow)) {
+      colDataSetNULL(pDst, row);
+    } else {
+      colDataSetVal(pDst, row, colDataGetData(pSrc, pInfo->probeRow), false);
+    }
+  }
+
+  // the row of left join is null extended if nothing matched
+  const char* p = (NULL != pBuildRow) ? pBuildRow + sizeof(SHJoinRowPos) : NULL;
+  for (int32_t i = 0; i < taosArrayGetSize(pInfo->pBuildCols); ++i) {
+    SHJoinColMap*    pCol = taosArrayGet(pInfo->pBuildCols, i);
+    SColumnInfoData* pDst = taosArrayGet(pRes->pDataBlock, pCol->dstSlot);
+    if (NULL == p || *(int8_t*)p) {
+      colDataSetNULL(pDst, row);
+      p = (NULL != p) ? p + sizeof(int8_t) : NULL;
+      continue;
+    }
+    p += sizeof(int8_t);
+    colDataSetVal(pDst, row, p, false);
+    p += hJoinGetValueLen(pCol->type, pCol->bytes, p);
+  }
+
+  pRes->info.rows += 1;
+}
+
+static int32_t hJoinProbe(SOperatorInfo* pOperator, SSDataBlock* pRes) {
+  SHJoinOperatorInfo* pInfo = pOperator->info;
+  int32_t             numOfKeys = taosArrayGetSize(pInfo->pProbeKeyCols);
+
+  while (!pInfo->probeDone && pRes->info.rows < pOperator->resultInfo.threshold) {
+    if (pInfo->nextPos.pageId >= 0) {
+      char* pPage = getBufPage(pInfo->pBuildBuf, pInfo->nextPos.pageId);
+      if (NULL == pPage) {
+        return terrno;
+      }
+      char* pRow = pPage + pInfo->nextPos.offset;
+      hJoinAppendResRow(pInfo, pRes, pRow);
+      memcpy(&pInfo->nextPos, pRow, sizeof(SHJoinRowPos));
+      releaseBufPage(pInfo->pBuildBuf, pPage);
+      continue;
+    }
+
+    if (NULL == pInfo->pProbeBlock || pInfo->probeRow + 1 >= pInfo->pProbeBlock->info.rows) {
+      SOperatorInfo* pProbeDownstream = pOperator->pDownstream[0];
+      pInfo->pProbeBlock = pProbeDownstream->fpSet.getNextFn(pProbeDownstream);
+      pInfo->probeRow = -1;
+      if (NULL == pInfo->pProbeBlock) {
+        pInfo->probeDone = true;
+      }
+      continue;
+    }
+
+    pInfo->probeRow += 1;
+    int32_t       keyLen = fillKeyBufFromTagCols(pInfo->pProbeKeyCols, pInfo->pProbeBlock, pInfo->probeRow, pInfo->keyBuf);
+    SHJoinRowPos* pHead =
+        hJoinKeyHasNull(pInfo->keyBuf, numOfKeys) ? NULL : tSimpleHashGet(pInfo->pBuildTable, pInfo->keyBuf, keyLen);
+    if (NULL != pHead) {
+      pInfo->nextPos = *pHead;
+    } else if (JOIN_TYPE_LEFT == pInfo->joinType) {
+      hJoinAppendResRow(pInfo, pRes, NULL);
+    }
+  }
+
+  pRes->info.dataLoad = 1;
+  pRes->info.scanFlag = MAIN_SCAN;
+  return TSDB_CODE_SUCCESS;
+}
+
+static SSDataBlock* doHashJoin(SOperatorInfo* pOperator) {
+  SHJoinOperatorInfo* pInfo = pOperator->info;
+  SExecTaskInfo*      pTaskInfo = pOperator->pTaskInfo;
+  SSDataBlock*        pRes = pInfo->pRes;
+
+  if (pOperator->status == OP_EXEC_DONE) {
+    return NULL;
+  }
+
+  int32_t code = TSDB_CODE_SUCCESS;
+  if (!pInfo->built) {
+    code = hJoinBuildHashTable(pOperator);
+    if (TSDB_CODE_SUCCESS != code) {
+      pTaskInfo->code = code;
+      T_LONG_JMP(pTaskInfo->env, code);
+    }
+    pInfo->built = true;
+    qDebug("hash join build %d keys, in memory:%d, %s", tSimpleHashGetSize(pInfo->pBuildTable),
+           isAllDataInMemBuf(pInfo->pBuildBuf), GET_TASKID(pTaskInfo));
+
+    if (0 == tSimpleHashGetSize(pInfo->pBuildTable) && JOIN_TYPE_INNER == pInfo->joinType) {
+      setOperatorCompleted(pOperator);
+      return NULL;
+    }
+  }
+
+  blockDataCleanup(pRes);
+  while (true) {
+    code = hJoinProbe(pOperator, pRes);
+    if (TSDB_CODE_SUCCESS != code) {
+      pTaskInfo->code = code;
+      T_LONG_JMP(pTaskInfo->env, code);
+    }
+    if (pOperator->exprSupp.pFilterInfo != NULL) {
+      doFilter(pRes, pOperator->exprSupp.pFilterInfo, NULL);
+    }
+    if (pRes->info.rows > 0 || pInfo->probeDone) {
+      break;
+    }
+  }
+
+  if (0 == pRes->info.rows) {
+    setOperatorCompleted(pOperator);
+    return NULL;
+  }
+  return pRes;
+}
+
+static void destroyHashJoinOperator(void* param) {
+  SHJoinOperatorInfo* pInfo = (SHJoinOperatorInfo*)param;
+  taosArrayDestroy(pInfo->pProbeKeyCols);
+  taosArrayDestroy(pInfo->pBuildKeyCols);
+  taosArrayDestroy(pInfo->pProbeCols);
+  taosArrayDestroy(pInfo->pBuildCols);
+  taosMemoryFreeClear(pInfo->keyBuf);
+  nodesDestroyNode(pInfo->pCondAfterJoin);
+  tSimpleHashCleanup(pInfo->pBuildTable);
+  if (NULL != pInfo->pBuildBuf) {
+    destroyDiskbasedBuf(pInfo->pBuildBuf);
+  }
+
+  pInfo->pRes = blockDataDestroy(pInfo->pRes);
+  taosMemoryFreeClear(param);
+}
+
+static int32_t hJoinInitColMaps(SHJoinOperatorInfo* pInfo, SOperatorInfo** pDownstream, SExprSupp* pExprSupp,
+                                int32_t* pBuildRowSize) {
+  pInfo->pProbeCols = taosArrayInit(pExprSupp->numOfExprs, sizeof(SHJoinColMap));
+  pInfo->pBuildCols = taosArrayInit(pExprSupp->numOfExprs, sizeof(SHJoinColMap));
+  if (NULL == pInfo->pProbeCols || NULL == pInfo->pBuildCols) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+
+  *pBuildRowSize = sizeof(SHJoinRowPos);
+  for (int32_t i = 0; i < pExprSupp->numOfExprs; ++i) {
+    SColumn*     pCol = pExprSupp->pExprInfo[i].base.pParam[0].pCol;
+    SHJoinColMap col = {.srcSlot = pCol->slotId, .dstSlot = i, .type = pCol->type, .bytes = pCol->bytes};
+    if (pCol->dataBlockId == pDownstream[0]->resultDataBlockId) {
+      taosArrayPush(pInfo->pProbeCols, &col);
+    } else {
+      taosArrayPush(pInfo->pBuildCols, &col);
+      *pBuildRowSize += sizeof(int8_t) + pCol->bytes;
+    }
+  }
+  return TSDB_CODE_SUCCESS;
+}
+
+SOperatorInfo* createHashJoinOperatorInfo(SOperatorInfo** pDownstream, int32_t numOfDownstream,
+                                          SHashJoinPhysiNode* pJoinNode, SExecTaskInfo* pTaskInfo) {
+  SHJoinOperatorInfo* pInfo = taosMemoryCalloc(1, sizeof(SHJoinOperatorInfo));
+  SOperatorInfo*      pOperator = taosMemoryCalloc(1, sizeof(SOperatorInfo));
+
+  int32_t code = TSDB_CODE_SUCCESS;
+  if (pOperator == NULL || pInfo == NULL) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _error;
+  }
+
+  int32_t numOfCols = 0;
+  pInfo->pRes = createDataBlockFromDescNode(pJoinNode->node.pOutputDataBlockDesc);
+  pInfo->joinType = pJoinNode->joinType;
+  pInfo->nextPos.pageId = -1;
+  pInfo->probeRow = -1;
+
+  SExprInfo* pExprInfo = createExprInfo(pJoinNode->pTargets, NULL, &numOfCols);
+  initResultSizeInfo(&pOperator->resultInfo, 4096);
+  blockDataEnsureCapacity(pInfo->pRes, pOperator->resultInfo.capacity);
+
+  setOperatorInfo(pOperator, "HashJoinOperator", QUERY_NODE_PHYSICAL_PLAN_HASH_JOIN, false, OP_NOT_OPENED, pInfo,
+                  pTaskInfo);
+  pOperator->exprSupp.pExprInfo = pExprInfo;
+  pOperator->exprSupp.numOfExprs = numOfCols;
+
+  if (pJoinNode->pOnConditions != NULL && pJoinNode->node.pConditions != NULL) {
+    SNodeList* pConds = NULL;
+    nodesListMakeAppend(&pConds, nodesCloneNode(pJoinNode->pOnConditions));
+    nodesListMakeAppend(&pConds, nodesCloneNode(pJoinNode->node.pConditions));
+    code = nodesMergeConds(&pInfo->pCondAfterJoin, &pConds);
+    if (code != TSDB_CODE_SUCCESS) {
+      nodesDestroyList(pConds);
+      goto _error;
+    }
+  } else if (pJoinNode->pOnConditions != NULL) {
+    pInfo->pCondAfterJoin = nodesCloneNode(pJoinNode->pOnConditions);
+  } else if (pJoinNode->node.pConditions != NULL) {
+    pInfo->pCondAfterJoin = nodesCloneNode(pJoinNode->node.pConditions);
+  }
+
+  code = filterInitFromNode(pInfo->pCondAfterJoin, &pOperator->exprSupp.pFilterInfo, 0);
+  if (code != TSDB_CODE_SUCCESS) {
+    goto _error;
+  }
+
+  pInfo->pProbeKeyCols = taosArrayInit(4, sizeof(SColumn));
+  pInfo->pBuildKeyCols = taosArrayInit(4, sizeof(SColumn));
+  if (NULL == pInfo->pProbeKeyCols || NULL == pInfo->pBuildKeyCols) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _error;
+  }
+  extractEqualOnCondCols(NULL, pDownstream, pJoinNode->pColEqualOnConditions, pInfo->pProbeKeyCols,
+                         pInfo->pBuildKeyCols);
+  // the keys of both sides are of the same types, so the key buffer is shared
+  code = initTagColskeyBuf(&pInfo->keyLen, &pInfo->keyBuf, pInfo->pBuildKeyCols);
+  if (code != TSDB_CODE_SUCCESS) {
+    goto _error;
+  }
+
+  pInfo->pBuildTable = tSimpleHashInit(1024, taosGetDefaultHashFunction(TSDB_DATA_TYPE_BINARY));
+  if (NULL == pInfo->pBuildTable) {
+    code = TSDB_CODE_OUT_OF_MEMORY;
+    goto _error;
+  }
+
+  int32_t buildRowSize = 0;
+  code = hJoinInitColMaps(pInfo, pDownstream, &pOperator->exprSupp, &buildRowSize);
+  if (code != TSDB_CODE_SUCCESS) {
+    goto _error;
+  }
+
+  uint32_t defaultPgsz = 0;
+  uint32_t defaultBufsz = 0;
+  code = getBufferPgSize(buildRowSize, &defaultPgsz, &defaultBufsz);
+  if (code != TSDB_CODE_SUCCESS) {
+    goto _error;
+  }
+
+  if (!osTempSpaceAvailable()) {
+    code = TSDB_CODE_NO_DISKSPACE;
+    qError("Create hash join operator info failed since %s, tempDir:%s", tstrerror(code), tsTempDir);
+    goto _error;
+  }
+
+  code = createDiskbasedBuf(&pInfo->pBuildBuf, defaultPgsz, defaultBufsz, pTaskInfo->id.str, tsTempDir,
+                            tsPagedBufCompress);
+  if (code != TSDB_CODE_SUCCESS) {
+    goto _error;
+  }
+  pInfo->pageSize = getBufPageSize(pInfo->pBuildBuf);
+
+  pOperator->fpSet =
+      createOperatorFpSet(optrDummyOpenFn, doHashJoin, NULL, destroyHashJoinOperator, optrDefaultBufFn, NULL);
+  code = appendDownstream(pOperator, pDownstream, numOfDownstream);
+  if (code != TSDB_CODE_SUCCESS) {
+    goto _error;
+  }
+
+  return pOperator;
+
+_error:
+  if (pInfo != NULL) {
+    destroyHashJoinOperator(pInfo);
+  }
+
+  taosMemoryFree(pOperator);
+  pTaskInfo->code = code;
+  return NULL;
+}
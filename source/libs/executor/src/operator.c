@@ -15,6 +15,7 @@
 
 #include "filter.h"
 #include "function.h"
+#include "functionMgt.h"
 #include "os.h"
 #include "tname.h"
 
@@ -271,6 +272,29 @@ int32_t stopTableScanOperator(SOperatorInfo* pOperator, const char* pIdStr, SSto
   return p.code;
 }
 
+static ERetType doDisableBlockSma(SOperatorInfo* pOperator, STraverParam* pParam, const char* pIdStr) {
+  STableScanBase* pBase = NULL;
+  if (pOperator->operatorType == QUERY_NODE_PHYSICAL_PLAN_TABLE_SCAN) {
+    pBase = &((STableScanInfo*)pOperator->info)->base;
+  } else if (pOperator->operatorType == QUERY_NODE_PHYSICAL_PLAN_TABLE_MERGE_SCAN) {
+    pBase = &((STableMergeScanInfo*)pOperator->info)->base;
+  } else {
+    return OPTR_FN_RET_CONTINUE;
+  }
+
+  if (pBase->dataBlockLoadFlag != FUNC_DATA_REQUIRED_DATA_LOAD) {
+    qDebug("table scan loads data blocks instead of block sma from now on, %s", pIdStr);
+    pBase->dataBlockLoadFlag = FUNC_DATA_REQUIRED_DATA_LOAD;
+  }
+  return OPTR_FN_RET_ABORT;
+}
+
+int32_t disableTableScanBlockSma(SOperatorInfo* pOperator, const char* pIdStr) {
+  STraverParam p = {0};
+  traverseOperatorTree(pOperator, doDisableBlockSma, &p, pIdStr);
+  return p.code;
+}
+
 SOperatorInfo* createOperator(SPhysiNode* pPhyNode, SExecTaskInfo* pTaskInfo, SReadHandle* pHandle, SNode* pTagCond,
                               SNode* pTagIndexCond, const char* pUser, const char* dbname) {
   int32_t     type = nodeType(pPhyNode);
@@ -510,6 +534,8 @@ SOperatorInfo* createOperator(SPhysiNode* pPhyNode, SExecTaskInfo* pTaskInfo, SR
     pOptr = createStreamStateAggOperatorInfo(ops[0], pPhyNode, pTaskInfo, pHandle);
   } else if (QUERY_NODE_PHYSICAL_PLAN_MERGE_JOIN == type) {
     pOptr = createMergeJoinOperatorInfo(ops, size, (SSortMergeJoinPhysiNode*)pPhyNode, pTaskInfo);
+  } else if (QUERY_NODE_PHYSICAL_PLAN_HASH_JOIN == type) {
+    pOptr = createHashJoinOperatorInfo(ops, size, (SHashJoinPhysiNode*)pPhyNode, pTaskInfo);
   } else if (QUERY_NODE_PHYSICAL_PLAN_FILL == type) {
     pOptr = createFillOperatorInfo(ops[0], (SFillPhysiNode*)pPhyNode, pTaskInfo);
   } else if (QUERY_NODE_PHYSICAL_PLAN_STREAM_FILL == type) {
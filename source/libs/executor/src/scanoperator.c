@@ -2161,7 +2161,8 @@ FETCH_NEXT_BLOCK:
         SPackedData* pSubmit = taosArrayGet(pInfo->pBlockLists, current);
 
         qDebug("set %d/%d as the input submit block, %s", current, totalBlocks, id);
-        if (pAPI->tqReaderFn.tqReaderSetSubmitMsg(pInfo->tqReader, pSubmit->msgStr, pSubmit->msgLen, pSubmit->ver) < 0) {
+        if (pAPI->tqReaderFn.tqReaderSetSubmitMsg(pInfo->tqReader, pSubmit->msgStr, pSubmit->msgLen, pSubmit->ver,
+                                                  pSubmit->term, pSubmit->cksum) < 0) {
           qError("submit msg messed up when initializing stream submit block %p, current %d/%d, %s", pSubmit, current, totalBlocks, id);
           continue;
         }
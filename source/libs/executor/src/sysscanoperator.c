@@ -1680,8 +1680,10 @@ static SSDataBlock* sysTableScanFromMNode(SOperatorInfo* pOperator, SSysTableSca
       return NULL;
     }
 
-    int32_t msgType = (strcasecmp(name, TSDB_INS_TABLE_DNODE_VARIABLES) == 0) ? TDMT_DND_SYSTABLE_RETRIEVE
-                                                                              : TDMT_MND_SYSTABLE_RETRIEVE;
+    int32_t msgType =
+        (strcasecmp(name, TSDB_INS_TABLE_DNODE_VARIABLES) == 0 || strcasecmp(name, TSDB_INS_TABLE_DISKS) == 0)
+            ? TDMT_DND_SYSTABLE_RETRIEVE
+            : TDMT_MND_SYSTABLE_RETRIEVE;
 
     pMsgSendInfo->param = pOperator;
     pMsgSendInfo->msgInfo.pData = buf1;
@@ -1716,7 +1718,13 @@ static SSDataBlock* sysTableScanFromMNode(SOperatorInfo* pOperator, SSysTableSca
     }
 
     char* pStart = pRsp->data;
-    extractDataBlockFromFetchRsp(pInfo->pRes, pRsp->data, pInfo->matchInfo.pList, &pStart);
+    code = extractDataBlockFromFetchRsp(pInfo->pRes, pRsp->data, pInfo->matchInfo.pList, &pStart);
+    if (code != TSDB_CODE_SUCCESS) {
+      qError("%s extract meta data from mnode failed, code:%s", GET_TASKID(pTaskInfo), tstrerror(code));
+      taosMemoryFree(pRsp);
+      pTaskInfo->code = code;
+      return NULL;
+    }
     updateLoadRemoteInfo(&pInfo->loadInfo, pRsp->numOfRows, pRsp->compLen, startTs, pOperator);
 
     // todo log the filter info
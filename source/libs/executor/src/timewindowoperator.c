@@ -876,6 +876,202 @@ bool needDeleteWindowBuf(STimeWindow* pWin, STimeWindowAggSupp* pTwSup) {
   return pTwSup->maxTs != INT64_MIN && pWin->ekey < pTwSup->maxTs - pTwSup->deleteMark;
 }
 
+// tumbling window of fixed length on ascending timestamps, the window of each row can be calculated directly
+static bool isSortedTumblingInterval(const SIntervalAggOperatorInfo* pInfo, const TSKEY* tsCols) {
+  const SInterval* pInterval = &pInfo->interval;
+  return tsCols != NULL && pInfo->binfo.inputTsOrder == TSDB_ORDER_ASC && !pInfo->timeWindowInterpo &&
+         pInterval->interval == pInterval->sliding && !IS_CALENDAR_TIME_DURATION(pInterval->intervalUnit) &&
+         !IS_CALENDAR_TIME_DURATION(pInterval->slidingUnit);
+}
+
+#define SORTED_INTERVAL_BATCH_SIZE 128
+
+// the windows of which the aggregation is deferred, all of their result rows are on the same, pinned, page
+typedef struct SIntervalWindowBatch {
+  int32_t     num;
+  int32_t     pageId;
+  SFilePage*  pPage;
+  SResultRow* pRows[SORTED_INTERVAL_BATCH_SIZE];
+  int32_t     startPos[SORTED_INTERVAL_BATCH_SIZE];
+  int32_t     numOfRows[SORTED_INTERVAL_BATCH_SIZE];
+} SIntervalWindowBatch;
+
+static bool isWindowBatchSupported(const SExprSupp* pSup, int32_t scanFlag) {
+  if (scanFlag != MAIN_SCAN) {
+    return false;
+  }
+
+  for (int32_t k = 0; k < pSup->numOfExprs; ++k) {
+    const SqlFunctionCtx* pCtx = &pSup->pCtx[k];
+    if (pCtx->isPseudoFunc || pCtx->functionId == -1) {
+      continue;
+    }
+
+    // the tuple of selectivity functions is saved into the result buffer, which may take the page of the batch away
+    if (pCtx->fpSet.processBatch == NULL || pCtx->subsidiaries.num > 0) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// only the page of the current result row is pinned, the batch must be applied before another page is touched
+static bool isWindowRowOnBatchPage(SAggSupporter* pAggSup, const SIntervalWindowBatch* pBatch, const STimeWindow* pWin,
+                                   uint64_t groupId, bool* newRow) {
+  SET_RES_WINDOW_KEY(pAggSup->keyBuf, (char*)&pWin->skey, TSDB_KEYSIZE, groupId);
+  SResultRowPosition* p1 = (SResultRowPosition*)tSimpleHashGet(pAggSup->pResultRowHashTable, pAggSup->keyBuf,
+                                                               GET_RES_WINDOW_KEY_LEN(TSDB_KEYSIZE));
+
+  *newRow = (p1 == NULL);
+  if (p1 != NULL) {
+    return p1->pageId == pBatch->pageId;
+  }
+
+  return pAggSup->currentPageId == pBatch->pageId &&
+         pBatch->pPage->num + pAggSup->resultRowSize <= getBufPageSize(pAggSup->pResultBuf);
+}
+
+static void doApplyAggFunctionOnWindowBatch(SExecTaskInfo* pTaskInfo, SExprSupp* pSup, SColumnInfoData* pTimeWindowData,
+                                            SIntervalWindowBatch* pBatch) {
+  SFuncRowSegment segs[SORTED_INTERVAL_BATCH_SIZE];
+
+  for (int32_t k = 0; k < pSup->numOfExprs; ++k) {
+    SqlFunctionCtx* pCtx = &pSup->pCtx[k];
+
+    if (pCtx->isPseudoFunc) {
+      for (int32_t i = 0; i < pBatch->num; ++i) {
+        SResultRowEntryInfo* pEntryInfo = getResultEntryInfo(pBatch->pRows[i], k, pSup->rowEntryInfoOffset);
+
+        SColumnInfoData idata = {0};
+        idata.info.type = TSDB_DATA_TYPE_BIGINT;
+        idata.info.bytes = tDataTypes[TSDB_DATA_TYPE_BIGINT].bytes;
+        idata.pData = GET_ROWCELL_INTERBUF(pEntryInfo);
+
+        updateTimeWindowInfo(pTimeWindowData, &pBatch->pRows[i]->win, 1);
+        SScalarParam out = {.columnData = &idata};
+        SScalarParam tw = {.numOfRows = 5, .columnData = pTimeWindowData};
+        pCtx->sfp.process(&tw, 1, &out);
+        pEntryInfo->numOfRes = 1;
+      }
+      continue;
+    }
+
+    if (pCtx->functionId == -1) {
+      continue;
+    }
+
+    int32_t numOfSegs = 0;
+    for (int32_t i = 0; i < pBatch->num; ++i) {
+      SResultRowEntryInfo* pResInfo = getResultEntryInfo(pBatch->pRows[i], k, pSup->rowEntryInfoOffset);
+      if (isRowEntryCompleted(pResInfo)) {
+        continue;
+      }
+
+      segs[numOfSegs++] = (SFuncRowSegment){
+          .startRowIndex = pBatch->startPos[i], .numOfRows = pBatch->numOfRows[i], .pResInfo = pResInfo};
+    }
+
+    int32_t code = pCtx->fpSet.processBatch(pCtx, segs, numOfSegs);
+    if (code != TSDB_CODE_SUCCESS) {
+      qError("%s apply functions error, code: %s", GET_TASKID(pTaskInfo), tstrerror(code));
+      pTaskInfo->code = code;
+      T_LONG_JMP(pTaskInfo->env, code);
+    }
+  }
+
+  pBatch->num = 0;
+}
+
+/*
+ * The rows from startPos are split into windows in one pass, the window is located arithmetically from the previous
+ * one, instead of searching the block for the boundary of each window. Small windows, e.g., millisecond data in 1s
+ * windows, are dominated by the cost to locate the window and to dispatch the aggregate functions, rather than the
+ * aggregation itself. So the row ranges of consecutive windows are collected with their result rows, and each function
+ * accumulates all of them in one call, as long as every function has a batch entry.
+ */
+static void doHashSortedIntervalAgg(SOperatorInfo* pOperatorInfo, SResultRowInfo* pResultRowInfo, SSDataBlock* pBlock,
+                                    int32_t scanFlag, const TSKEY* tsCols, int32_t startPos, STimeWindow win) {
+  SIntervalAggOperatorInfo* pInfo = (SIntervalAggOperatorInfo*)pOperatorInfo->info;
+  SExecTaskInfo*            pTaskInfo = pOperatorInfo->pTaskInfo;
+  SExprSupp*                pSup = &pOperatorInfo->exprSupp;
+  SAggSupporter*            pAggSup = &pInfo->aggSup;
+
+  int64_t     interval = pInfo->interval.interval;
+  int32_t     numOfRows = pBlock->info.rows;
+  uint64_t    tableGroupId = pBlock->info.id.groupId;
+  SResultRow* pResult = NULL;
+  bool        batchAgg = isWindowBatchSupported(pSup, scanFlag);
+
+  SIntervalWindowBatch batch = {0};
+
+  while (startPos < numOfRows) {
+    win.skey += ((tsCols[startPos] - win.skey) / interval) * interval;
+    win.ekey = win.skey + interval - 1;
+    if (win.ekey < win.skey) {
+      win.ekey = INT64_MAX;
+    }
+
+    int32_t endPos = numOfRows;
+    if (tsCols[numOfRows - 1] > win.ekey) {
+      endPos = startPos + 1;
+      while (tsCols[endPos] <= win.ekey) {
+        endPos += 1;
+      }
+    }
+
+    if (!batchAgg) {
+      int32_t code = setTimeWindowOutputBuf(pResultRowInfo, &win, (scanFlag == MAIN_SCAN), &pResult, tableGroupId,
+                                            pSup->pCtx, pSup->numOfExprs, pSup->rowEntryInfoOffset, pAggSup,
+                                            pTaskInfo);
+      if (code != TSDB_CODE_SUCCESS || pResult == NULL) {
+        T_LONG_JMP(pTaskInfo->env, TSDB_CODE_OUT_OF_MEMORY);
+      }
+
+      updateTimeWindowInfo(&pInfo->twAggSup.timeWindowData, &win, 1);
+      applyAggFunctionOnPartialTuples(pTaskInfo, pSup->pCtx, &pInfo->twAggSup.timeWindowData, startPos,
+                                      endPos - startPos, numOfRows, pSup->numOfExprs);
+      startPos = endPos;
+      continue;
+    }
+
+    bool newRow = false;
+    bool samePage = batch.num > 0 && isWindowRowOnBatchPage(pAggSup, &batch, &win, tableGroupId, &newRow);
+    if (batch.num > 0 && (!samePage || batch.num == SORTED_INTERVAL_BATCH_SIZE)) {
+      doApplyAggFunctionOnWindowBatch(pTaskInfo, pSup, &pInfo->twAggSup.timeWindowData, &batch);
+    }
+
+    pResult = doSetResultOutBufByKey(pAggSup->pResultBuf, pResultRowInfo, (char*)&win.skey, TSDB_KEYSIZE, true,
+                                     tableGroupId, pTaskInfo, true, pAggSup, true);
+    if (pResult == NULL) {
+      T_LONG_JMP(pTaskInfo->env, TSDB_CODE_OUT_OF_MEMORY);
+    }
+
+    // a new row is only recognized by the page check, the first row of a batch is set up anyway
+    pResult->win = win;
+    if (newRow || batch.num == 0) {
+      setResultRowInitCtx(pResult, pSup->pCtx, pSup->numOfExprs, pSup->rowEntryInfoOffset);
+    }
+
+    if (batch.num == 0) {
+      batch.pageId = pResult->pageId;
+      batch.pPage = (SFilePage*)((char*)pResult - pResult->offset);
+    }
+
+    batch.pRows[batch.num] = pResult;
+    batch.startPos[batch.num] = startPos;
+    batch.numOfRows[batch.num] = endPos - startPos;
+    batch.num += 1;
+
+    startPos = endPos;
+  }
+
+  if (batch.num > 0) {
+    doApplyAggFunctionOnWindowBatch(pTaskInfo, pSup, &pInfo->twAggSup.timeWindowData, &batch);
+    setResultRowInitCtx(pResult, pSup->pCtx, pSup->numOfExprs, pSup->rowEntryInfoOffset);
+  }
+}
+
 static void hashIntervalAgg(SOperatorInfo* pOperatorInfo, SResultRowInfo* pResultRowInfo, SSDataBlock* pBlock,
                             int32_t scanFlag) {
   SIntervalAggOperatorInfo* pInfo = (SIntervalAggOperatorInfo*)pOperatorInfo->info;
@@ -925,6 +1121,11 @@ static void hashIntervalAgg(SOperatorInfo* pOperatorInfo, SResultRowInfo* pResul
 
   doCloseWindow(pResultRowInfo, pInfo, pResult);
 
+  if (isSortedTumblingInterval(pInfo, tsCols)) {
+    doHashSortedIntervalAgg(pOperatorInfo, pResultRowInfo, pBlock, scanFlag, tsCols, startPos + forwardRows, win);
+    return;
+  }
+
   STimeWindow nextWin = win;
   while (1) {
     int32_t prevEndPos = forwardRows - 1 + startPos;
@@ -2048,12 +2249,16 @@ int32_t setIntervalOutputBuf(void* pState, STimeWindow* win, SRowBuffPos** pResu
   char*   value = NULL;
   int32_t size = pAggSup->resultRowSize;
 
-  if (pStore->streamStateAddIfNotExist(pState, &key, (void**)&value, &size) < 0) {
-    return TSDB_CODE_OUT_OF_MEMORY;
+  int32_t code = pStore->streamStateAddIfNotExist(pState, &key, (void**)&value, &size);
+  if (code != TSDB_CODE_SUCCESS) {
+    return code;
   }
 
   *pResult = (SRowBuffPos*)value;
   SResultRow* res = (SResultRow*)((*pResult)->pRowBuff);
+  if (res == NULL) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
 
   // set time window for current result
   res->win = (*win);
@@ -2404,10 +2609,10 @@ static void doStreamIntervalAggImpl(SOperatorInfo* pOperatorInfo, SSDataBlock* p
 
     int32_t code = setIntervalOutputBuf(pInfo->pState, &nextWin, &pResPos, groupId, pSup->pCtx, numOfOutput,
                                         pSup->rowEntryInfoOffset, &pInfo->aggSup, &pInfo->statestore);
-    pResult = (SResultRow*)pResPos->pRowBuff;
-    if (code != TSDB_CODE_SUCCESS || pResult == NULL) {
-      T_LONG_JMP(pTaskInfo->env, TSDB_CODE_OUT_OF_MEMORY);
+    if (code != TSDB_CODE_SUCCESS) {
+      T_LONG_JMP(pTaskInfo->env, code);
     }
+    pResult = (SResultRow*)pResPos->pRowBuff;
     if (IS_FINAL_OP(pInfo)) {
       forwardRows = 1;
     } else {
@@ -2710,6 +2915,11 @@ TSKEY compareTs(void* pKey) {
   return pWinKey->ts;
 }
 
+static int32_t decodeStreamIntervalRow(void* param, const void* pSrc, int32_t srcLen, void* pDst, int32_t dstLen) {
+  SExprSupp* pSup = (SExprSupp*)param;
+  return decodeLegacyResultRow(pSup->pCtx, pSup->numOfExprs, pSrc, srcLen, pDst, dstLen);
+}
+
 int32_t getSelectivityBufSize(SqlFunctionCtx* pCtx) {
   if (pCtx->subsidiaries.rowLen == 0) {
     int32_t rowLen = 0;
@@ -2862,8 +3072,13 @@ SOperatorInfo* createStreamFinalIntervalOperatorInfo(SOperatorInfo* downstream,
   pInfo->pUpdated = NULL;
   pInfo->pUpdatedMap = NULL;
   int32_t funResSize= getMaxFunResSize(&pOperator->exprSupp, numOfCols);
-  pInfo->pState->pFileState = pAPI->stateStore.streamFileStateInit(tsStreamBufferSize, sizeof(SWinKey), pInfo->aggSup.resultRowSize, funResSize,
-                                                  compareTs, pInfo->pState, pInfo->twAggSup.deleteMark, GET_TASKID(pTaskInfo));
+  pInfo->pState->pFileState = pAPI->stateStore.streamFileStateInit(
+      tsStreamBufferSize, sizeof(SWinKey), pInfo->aggSup.resultRowSize, funResSize, compareTs, decodeStreamIntervalRow,
+      &pOperator->exprSupp, pInfo->pState, pInfo->twAggSup.deleteMark, GET_TASKID(pTaskInfo));
+  if (pInfo->pState->pFileState == NULL) {
+    code = terrno;
+    goto _error;
+  }
   pInfo->dataVersion = 0;
   pInfo->statestore = pTaskInfo->storageAPI.stateStore;
   pInfo->recvGetAll = false;
@@ -2935,6 +3150,7 @@ int32_t initBasicInfoEx(SOptrBasicInfo* pBasicInfo, SExprSupp* pSup, SExprInfo*
     return code;
   }
 
+  setStreamResultRowSize(pSup);
   initStreamFunciton(pSup->pCtx, pSup->numOfExprs);
   for (int32_t i = 0; i < numOfCols; ++i) {
     pSup->pCtx[i].saveHandle.pBuf = NULL;
@@ -3010,7 +3226,7 @@ int32_t initStreamAggSupporter(SStreamAggSupporter* pSup, SqlFunctionCtx* pCtx,
     return terrno;
   }
 
-  int32_t code = createDiskbasedBuf(&pSup->pResultBuf, pageSize, bufSize, "function", tsTempDir);
+  int32_t code = createDiskbasedBuf(&pSup->pResultBuf, pageSize, bufSize, "function", tsTempDir, tsPagedBufCompress);
   for (int32_t i = 0; i < numOfOutput; ++i) {
     pCtx[i].saveHandle.pBuf = pSup->pResultBuf;
   }
@@ -5412,8 +5628,12 @@ SOperatorInfo* createStreamIntervalOperatorInfo(SOperatorInfo* downstream, SPhys
   int32_t funResSize= getMaxFunResSize(pSup, numOfCols);
 
   pInfo->pState->pFileState = pTaskInfo->storageAPI.stateStore.streamFileStateInit(
-      tsStreamBufferSize, sizeof(SWinKey), pInfo->aggSup.resultRowSize, funResSize, compareTs, pInfo->pState,
-      pInfo->twAggSup.deleteMark, GET_TASKID(pTaskInfo));
+      tsStreamBufferSize, sizeof(SWinKey), pInfo->aggSup.resultRowSize, funResSize, compareTs, decodeStreamIntervalRow,
+      pSup, pInfo->pState, pInfo->twAggSup.deleteMark, GET_TASKID(pTaskInfo));
+  if (pInfo->pState->pFileState == NULL) {
+    code = terrno;
+    goto _error;
+  }
 
   setOperatorInfo(pOperator, "StreamIntervalOperator", QUERY_NODE_PHYSICAL_PLAN_STREAM_INTERVAL, true, OP_NOT_OPENED,
                   pInfo, pTaskInfo);
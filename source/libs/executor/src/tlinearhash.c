@@ -254,16 +254,13 @@ SLHashObj* tHashInit(int32_t inMemPages, int32_t pageSize, _hash_fn_t fn, int32_
     return NULL;
   }
 
-  int32_t code = createDiskbasedBuf(&pHashObj->pBuf, pageSize, inMemPages * pageSize, "", tsTempDir);
+  int32_t code = createDiskbasedBuf(&pHashObj->pBuf, pageSize, inMemPages * pageSize, "", tsTempDir, false);
   if (code != 0) {
     taosMemoryFree(pHashObj);
     terrno = code;
     return NULL;
   }
 
-  // disable compress when flushing to disk
-  setBufPageCompressOnDisk(pHashObj->pBuf, false);
-
   /**
    * The number of bits in the hash value, which is used to decide the exact bucket where the object should be located
    * in. The initial value is 0.
@@ -19,12 +19,14 @@
 #include "tcompare.h"
 #include "tdatablock.h"
 #include "tdef.h"
+#include "tglobal.h"
 #include "theap.h"
 #include "tlosertree.h"
 #include "tpagedbuf.h"
 #include "tsort.h"
 #include "tutil.h"
 #include "tsimplehash.h"
+#include "tsched.h"
 
 struct STupleHandle {
   SSDataBlock* pBlock;
@@ -227,6 +229,7 @@ static int32_t sortComparCleanup(SMsortComparParam* cmpParam) {
     if (pSource->pageIdList) {
       taosArrayDestroy(pSource->pageIdList);
     }
+    taosMemoryFreeClear(pSource->pNormKey);
     taosMemoryFreeClear(pSource);
     cmpParam->pSources[i] = NULL;
   }
@@ -262,6 +265,7 @@ void tsortClearOrderdSource(SArray* pOrderedSource, int64_t *fetchUs, int64_t *f
       (*pSource)->src.pBlock = NULL;
     }
 
+    taosMemoryFreeClear((*pSource)->pNormKey);
     taosMemoryFreeClear(*pSource);
   }
 
@@ -330,7 +334,7 @@ static int32_t doAddToBuf(SSDataBlock* pDataBlock, SSortHandle* pHandle) {
     }
 
     int32_t code = createDiskbasedBuf(&pHandle->pBuf, pHandle->pageSize, pHandle->numOfPages * pHandle->pageSize,
-                                      "sortExternalBuf", tsTempDir);
+                                      "sortExternalBuf", tsTempDir, tsPagedBufCompress);
     dBufSetPrintInfo(pHandle->pBuf);
     if (code != TSDB_CODE_SUCCESS) {
       return code;
@@ -380,6 +384,99 @@ static void setCurrentSourceDone(SSortSource* pSource, SSortHandle* pHandle) {
   ++pHandle->numOfCompletedSources;
 }
 
+static bool isNormKeyApplicable(SMsortComparParam* pParam) {
+  if (pParam->sortType == SORT_BLOCK_TS_MERGE || pParam->cmpGroupId || taosArrayGetSize(pParam->orderInfo) == 0) {
+    return false;
+  }
+
+  SBlockOrderInfo* pOrder = TARRAY_GET_ELEM(pParam->orderInfo, 0);
+  for (int32_t i = 0; i < pParam->numOfSources; ++i) {
+    SSortSource* pSource = pParam->pSources[i];
+    if (pSource->src.pBlock == NULL) {
+      continue;
+    }
+
+    SColumnInfoData* pCol = TARRAY_GET_ELEM(pSource->src.pBlock->pDataBlock, pOrder->slotId);
+    int32_t          type = pCol->info.type;
+    return IS_INTEGER_TYPE(type) || type == TSDB_DATA_TYPE_BOOL || type == TSDB_DATA_TYPE_TIMESTAMP;
+  }
+
+  return false;
+}
+
+/*
+ * Encode the first sort key of each row in the current block of the source into an unsigned integer with the same
+ * order, so the loser tree can compare most of the tuples without the per-column type dispatch. Tuples with equal
+ * encoded keys are compared by all the order columns.
+ */
+static int32_t buildSourceNormKey(SMsortComparParam* pParam, SSortSource* pSource) {
+  SSDataBlock* pBlock = pSource->src.pBlock;
+  if (!pParam->normKey || pBlock == NULL || pBlock->info.rows == 0) {
+    return TSDB_CODE_SUCCESS;
+  }
+
+  int32_t rows = pBlock->info.rows;
+  if (pSource->normKeyCap < rows) {
+    uint64_t* p = taosMemoryRealloc(pSource->pNormKey, rows * sizeof(uint64_t));
+    if (p == NULL) {
+      return TSDB_CODE_OUT_OF_MEMORY;
+    }
+    pSource->pNormKey = p;
+    pSource->normKeyCap = rows;
+  }
+
+  SBlockOrderInfo* pOrder = TARRAY_GET_ELEM(pParam->orderInfo, 0);
+  SColumnInfoData* pCol = TARRAY_GET_ELEM(pBlock->pDataBlock, pOrder->slotId);
+  uint64_t*        pKey = pSource->pNormKey;
+  const uint64_t   signBit = 1ULL << 63;
+
+  for (int32_t j = 0; j < rows; ++j) {
+    uint64_t k = 0;
+    switch (pCol->info.type) {
+      case TSDB_DATA_TYPE_BOOL:
+      case TSDB_DATA_TYPE_UTINYINT:
+        k = ((uint8_t*)pCol->pData)[j];
+        break;
+      case TSDB_DATA_TYPE_TINYINT:
+        k = (uint64_t)(int64_t)((int8_t*)pCol->pData)[j] ^ signBit;
+        break;
+      case TSDB_DATA_TYPE_SMALLINT:
+        k = (uint64_t)(int64_t)((int16_t*)pCol->pData)[j] ^ signBit;
+        break;
+      case TSDB_DATA_TYPE_USMALLINT:
+        k = ((uint16_t*)pCol->pData)[j];
+        break;
+      case TSDB_DATA_TYPE_INT:
+        k = (uint64_t)(int64_t)((int32_t*)pCol->pData)[j] ^ signBit;
+        break;
+      case TSDB_DATA_TYPE_UINT:
+        k = ((uint32_t*)pCol->pData)[j];
+        break;
+      case TSDB_DATA_TYPE_BIGINT:
+      case TSDB_DATA_TYPE_TIMESTAMP:
+        k = (uint64_t)((int64_t*)pCol->pData)[j] ^ signBit;
+        break;
+      case TSDB_DATA_TYPE_UBIGINT:
+        k = ((uint64_t*)pCol->pData)[j];
+        break;
+      default:
+        break;
+    }
+
+    if (pOrder->order == TSDB_ORDER_DESC) {
+      k = ~k;
+    }
+
+    if (pCol->hasNull && colDataIsNull_f(pCol->nullbitmap, j)) {
+      k = pOrder->nullFirst ? 0 : UINT64_MAX;
+    }
+
+    pKey[j] = k;
+  }
+
+  return TSDB_CODE_SUCCESS;
+}
+
 static int32_t sortComparInit(SMsortComparParam* pParam, SArray* pSources, int32_t startIndex, int32_t endIndex,
                               SSortHandle* pHandle) {
   pParam->pSources = taosArrayGet(pSources, startIndex);
@@ -396,7 +493,7 @@ static int32_t sortComparInit(SMsortComparParam* pParam, SArray* pSources, int32
     }
 
     code = createDiskbasedBuf(&pHandle->pBuf, pHandle->pageSize, pHandle->numOfPages * pHandle->pageSize,
-                              "sortComparInit", tsTempDir);
+                              "sortComparInit", tsTempDir, tsPagedBufCompress);
     dBufSetPrintInfo(pHandle->pBuf);
     if (code != TSDB_CODE_SUCCESS) {
       terrno = code;
@@ -447,6 +544,15 @@ static int32_t sortComparInit(SMsortComparParam* pParam, SArray* pSources, int32
     qDebug("init for merge sort completed, elapsed time:%.2f ms, %s", (et - st) / 1000.0, pHandle->idStr);
   }
 
+  pParam->normKey = (pHandle->comparFn == msortComparFn) && isNormKeyApplicable(pParam);
+  for (int32_t i = 0; i < pParam->numOfSources; ++i) {
+    code = buildSourceNormKey(pParam, pParam->pSources[i]);
+    if (code != TSDB_CODE_SUCCESS) {
+      terrno = code;
+      return code;
+    }
+  }
+
   return code;
 }
 
@@ -502,6 +608,11 @@ static int32_t adjustMergeTreeForNextTuple(SSortSource* pSource, SMultiwayMergeT
           return code;
         }
         releaseBufPage(pHandle->pBuf, pPage);
+
+        code = buildSourceNormKey(&pHandle->cmpParam, pSource);
+        if (code != TSDB_CODE_SUCCESS) {
+          return code;
+        }
       }
     } else {
       int64_t st = taosGetTimestampUs();      
@@ -512,6 +623,11 @@ static int32_t adjustMergeTreeForNextTuple(SSortSource* pSource, SMultiwayMergeT
         (*numOfCompleted) += 1;
         pSource->src.rowIndex = -1;
         qDebug("adjust merge tree. %d source completed", *numOfCompleted);
+      } else {
+        int32_t code = buildSourceNormKey(&pHandle->cmpParam, pSource);
+        if (code != TSDB_CODE_SUCCESS) {
+          return code;
+        }
       }
     }
   }
@@ -583,6 +699,14 @@ int32_t msortComparFn(const void* pLeft, const void* pRight, void* param) {
     return -1;
   }
 
+  if (pParam->normKey) {
+    uint64_t leftKey = pLeftSource->pNormKey[pLeftSource->src.rowIndex];
+    uint64_t rightKey = pRightSource->pNormKey[pRightSource->src.rowIndex];
+    if (leftKey != rightKey) {
+      return leftKey < rightKey ? -1 : 1;
+    }
+  }
+
   SSDataBlock* pLeftBlock = pLeftSource->src.pBlock;
   SSDataBlock* pRightBlock = pRightSource->src.pBlock;
 
@@ -810,7 +934,7 @@ static int32_t createPageBuf(SSortHandle* pHandle) {
     }
 
     int32_t code = createDiskbasedBuf(&pHandle->pBuf, pHandle->pageSize, pHandle->numOfPages * pHandle->pageSize,
-                                      "tableBlocksBuf", tsTempDir);
+                                      "tableBlocksBuf", tsTempDir, tsPagedBufCompress);
     dBufSetPrintInfo(pHandle->pBuf);
     if (code != TSDB_CODE_SUCCESS) {
       return code;
@@ -1078,6 +1202,155 @@ static int32_t createBlocksMergeSortInitialSources(SSortHandle* pHandle) {
   return TSDB_CODE_SUCCESS;
 }
 
+#define SORT_MAX_RUN_WORKERS         4
+#define SORT_MIN_ROWS_PER_RUN_WORKER 4096
+#define SORT_RUN_QUEUE_SIZE          256
+
+typedef struct SSortRunTask {
+  SSDataBlock* pBlock;
+  SArray*      pOrderInfo;  // private copy, blockDataSort writes the column pointer into it
+  uint64_t     pqMaxRows;
+  int32_t      code;
+  tsem_t       done;
+  bool         scheduled;
+} SSortRunTask;
+
+// the chunks of all sort handles are sorted by one bounded worker pool shared by the whole process
+static TdThreadOnce sortRunWorkersInit = PTHREAD_ONCE_INIT;
+static void*        sortRunWorkers = NULL;
+
+static int32_t getMaxSortRunWorkers() { return TMIN(TMAX((int32_t)tsNumOfCores / 2, 1), SORT_MAX_RUN_WORKERS); }
+
+static void cleanupSortRunWorkers() {
+  void* pWorkers = atomic_exchange_ptr(&sortRunWorkers, NULL);
+  if (pWorkers != NULL) {
+    taosCleanUpScheduler(pWorkers);
+    taosMemoryFree(pWorkers);
+  }
+}
+
+static void initSortRunWorkers() {
+  // the caller sorts one chunk itself, so the pool needs one thread less than the chunks of a spill
+  int32_t numOfThreads = getMaxSortRunWorkers() - 1;
+  if (numOfThreads > 0) {
+    sortRunWorkers = taosInitScheduler(SORT_RUN_QUEUE_SIZE, numOfThreads, "sort", NULL);
+    atexit(cleanupSortRunWorkers);
+  }
+}
+
+static void doSortRunTask(SSortRunTask* pTask) {
+  pTask->code = blockDataSort(pTask->pBlock, pTask->pOrderInfo);
+  if (pTask->code == TSDB_CODE_SUCCESS && pTask->pqMaxRows > 0) {
+    blockDataKeepFirstNRows(pTask->pBlock, pTask->pqMaxRows);
+  }
+}
+
+static void doSortRunTaskInPool(SSchedMsg* pMsg) {
+  SSortRunTask* pTask = pMsg->ahandle;
+  doSortRunTask(pTask);
+  tsem_post(&pTask->done);
+}
+
+static int32_t getNumOfSortRunWorkers(const SSDataBlock* pDataBlock) {
+  return TMAX(TMIN(getMaxSortRunWorkers(), pDataBlock->info.rows / SORT_MIN_ROWS_PER_RUN_WORKER), 1);
+}
+
+/*
+ * Sort the rows in pDataBlock and flush them into the external buffer. The rows are split into several chunks which
+ * are sorted concurrently, and each chunk is added as a separated run for the following multiway merge. The disk
+ * based buffer is not thread safe, so the flush is always done in the caller's thread.
+ */
+static int32_t doSortAndAddToBuf(SSortHandle* pHandle, SSDataBlock* pDataBlock) {
+  int32_t code = 0;
+  int64_t p = taosGetTimestampUs();
+
+  int32_t numOfWorkers = getNumOfSortRunWorkers(pDataBlock);
+  if (numOfWorkers <= 1) {
+    code = blockDataSort(pDataBlock, pHandle->pSortInfo);
+    if (code != TSDB_CODE_SUCCESS) {
+      return code;
+    }
+
+    pHandle->sortElapsed += taosGetTimestampUs() - p;
+    if (pHandle->pqMaxRows > 0) blockDataKeepFirstNRows(pDataBlock, pHandle->pqMaxRows);
+    return doAddToBuf(pDataBlock, pHandle);
+  }
+
+  SSortRunTask* pTasks = taosMemoryCalloc(numOfWorkers, sizeof(SSortRunTask));
+  if (pTasks == NULL) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+
+  int32_t numOfRows = pDataBlock->info.rows;
+  int32_t step = numOfRows / numOfWorkers;
+  for (int32_t i = 0; i < numOfWorkers; ++i) {
+    SSortRunTask* pTask = &pTasks[i];
+    int32_t       start = i * step;
+    int32_t       rows = (i == numOfWorkers - 1) ? (numOfRows - start) : step;
+
+    pTask->pqMaxRows = pHandle->pqMaxRows;
+    pTask->pBlock = blockDataExtractBlock(pDataBlock, start, rows);
+    pTask->pOrderInfo = taosArrayDup(pHandle->pSortInfo, NULL);
+    if (pTask->pBlock == NULL || pTask->pOrderInfo == NULL) {
+      code = TSDB_CODE_OUT_OF_MEMORY;
+      goto _end;
+    }
+  }
+
+  // the rows have been copied into the chunks, release the memory of the merged block ahead
+  blockDataCleanup(pDataBlock);
+
+  taosThreadOnce(&sortRunWorkersInit, initSortRunWorkers);
+
+  // the first chunk is sorted by the current thread, and so are the chunks the worker pool fails to accept
+  for (int32_t i = 1; i < numOfWorkers; ++i) {
+    SSortRunTask* pTask = &pTasks[i];
+    if (tsem_init(&pTask->done, 0, 0) != 0) {
+      continue;
+    }
+
+    SSchedMsg msg = {.fp = doSortRunTaskInPool, .ahandle = pTask};
+    pTask->scheduled = (taosScheduleTask(atomic_load_ptr(&sortRunWorkers), &msg) == 0);
+    if (!pTask->scheduled) {
+      tsem_destroy(&pTask->done);
+    }
+  }
+
+  for (int32_t i = 0; i < numOfWorkers; ++i) {
+    SSortRunTask* pTask = &pTasks[i];
+    if (pTask->scheduled) {
+      tsem_wait(&pTask->done);
+      tsem_destroy(&pTask->done);
+    } else {
+      doSortRunTask(pTask);
+    }
+  }
+
+  pHandle->sortElapsed += taosGetTimestampUs() - p;
+
+  for (int32_t i = 0; i < numOfWorkers; ++i) {
+    code = pTasks[i].code;
+    if (code != TSDB_CODE_SUCCESS) {
+      goto _end;
+    }
+
+    code = doAddToBuf(pTasks[i].pBlock, pHandle);
+    if (code != TSDB_CODE_SUCCESS) {
+      goto _end;
+    }
+  }
+
+  qDebug("%d sorted runs are generated concurrently, rows:%d, %s", numOfWorkers, numOfRows, pHandle->idStr);
+
+_end:
+  for (int32_t i = 0; i < numOfWorkers; ++i) {
+    blockDataDestroy(pTasks[i].pBlock);
+    taosArrayDestroy(pTasks[i].pOrderInfo);
+  }
+  taosMemoryFree(pTasks);
+  return code;
+}
+
 static int32_t createBlocksQuickSortInitialSources(SSortHandle* pHandle) {
   int32_t code = 0;
   size_t  sortBufSize = pHandle->numOfPages * pHandle->pageSize;
@@ -1124,8 +1397,7 @@ static int32_t createBlocksQuickSortInitialSources(SSortHandle* pHandle) {
     size_t size = blockDataGetSize(pHandle->pDataBlock);
     if (size > sortBufSize) {
       // Perform the in-memory sort and then flush data in the buffer into disk.
-      int64_t p = taosGetTimestampUs();
-      code = blockDataSort(pHandle->pDataBlock, pHandle->pSortInfo);
+      code = doSortAndAddToBuf(pHandle, pHandle->pDataBlock);
       if (code != 0) {
         if (source->param && !source->onlyRef) {
           taosMemoryFree(source->param);
@@ -1138,14 +1410,6 @@ static int32_t createBlocksQuickSortInitialSources(SSortHandle* pHandle) {
         taosMemoryFree(source);
         return code;
       }
-
-      int64_t el = taosGetTimestampUs() - p;
-      pHandle->sortElapsed += el;
-      if (pHandle->pqMaxRows > 0) blockDataKeepFirstNRows(pHandle->pDataBlock, pHandle->pqMaxRows);
-      code = doAddToBuf(pHandle->pDataBlock, pHandle);
-      if (code != TSDB_CODE_SUCCESS) {
-        return code;
-      }
     }
   }
 
@@ -1158,20 +1422,19 @@ static int32_t createBlocksQuickSortInitialSources(SSortHandle* pHandle) {
   if (pHandle->pDataBlock != NULL && pHandle->pDataBlock->info.rows > 0) {
     size_t size = blockDataGetSize(pHandle->pDataBlock);
 
-    // Perform the in-memory sort and then flush data in the buffer into disk.
-    int64_t p = taosGetTimestampUs();
+    // All sorted data can fit in memory, external memory sort is not needed. Return to directly
+    if (size <= sortBufSize && pHandle->pBuf == NULL) {
+      int64_t p = taosGetTimestampUs();
 
-    code = blockDataSort(pHandle->pDataBlock, pHandle->pSortInfo);
-    if (code != 0) {
-      return code;
-    }
+      code = blockDataSort(pHandle->pDataBlock, pHandle->pSortInfo);
+      if (code != 0) {
+        return code;
+      }
 
-    if (pHandle->pqMaxRows > 0) blockDataKeepFirstNRows(pHandle->pDataBlock, pHandle->pqMaxRows);
-    int64_t el = taosGetTimestampUs() - p;
-    pHandle->sortElapsed += el;
+      if (pHandle->pqMaxRows > 0) blockDataKeepFirstNRows(pHandle->pDataBlock, pHandle->pqMaxRows);
+      int64_t el = taosGetTimestampUs() - p;
+      pHandle->sortElapsed += el;
 
-    // All sorted data can fit in memory, external memory sort is not needed. Return to directly
-    if (size <= sortBufSize && pHandle->pBuf == NULL) {
       pHandle->cmpParam.numOfSources = 1;
       pHandle->inMemSort = true;
 
@@ -1180,7 +1443,8 @@ static int32_t createBlocksQuickSortInitialSources(SSortHandle* pHandle) {
       pHandle->tupleHandle.pBlock = pHandle->pDataBlock;
       return 0;
     } else {
-      code = doAddToBuf(pHandle->pDataBlock, pHandle);
+      // Perform the in-memory sort and then flush data in the buffer into disk.
+      code = doSortAndAddToBuf(pHandle, pHandle->pDataBlock);
     }
   }
   return code;
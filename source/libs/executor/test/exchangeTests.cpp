@@ -0,0 +1,420 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#include <addr_any.h>
+
+#include "executorInt.h"
+#include "operator.h"
+#include "query.h"
+#include "querytask.h"
+#include "stub.h"
+#include "tdatablock.h"
+#include "tglobal.h"
+#include "tref.h"
+
+namespace {
+
+const int16_t kExchangeBlockId = 1;
+const int64_t kSourceRange = 1000000;  // the values of source i are in [i * kSourceRange, (i + 1) * kSourceRange)
+const int32_t kFetchError = TSDB_CODE_RPC_BROKEN_LINK;
+
+// the responses of a source, in the order they are fetched
+struct STestSource {
+  std::vector<int32_t> rsps;  // rows of each response, the last one completes the source
+  int32_t              failedReq = -1;
+  int32_t              numOfReq = 0;
+  int64_t              numOfRows = 0;
+};
+
+// answers the fetch requests sent to the sources, either in the send call or from a thread
+struct STestServer {
+  std::vector<STestSource> sources;
+  bool                     async = false;
+  bool                     stop = false;
+  std::deque<SMsgSendInfo*> pending;
+  std::mutex               lock;
+  std::condition_variable  cond;
+  std::thread              responder;
+};
+
+STestServer* gServer = NULL;
+
+SRetrieveTableRsp* buildRetrieveRsp(int64_t firstVal, int32_t rows, bool completed, int32_t* pLen) {
+  SSDataBlock*    pBlock = createDataBlock();
+  SColumnInfoData col = createColumnInfoData(TSDB_DATA_TYPE_BIGINT, tDataTypes[TSDB_DATA_TYPE_BIGINT].bytes, 1);
+  blockDataAppendColInfo(pBlock, &col);
+  blockDataEnsureCapacity(pBlock, TMAX(rows, 1));
+
+  SColumnInfoData* pCol = (SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, 0);
+  for (int32_t i = 0; i < rows; ++i) {
+    int64_t val = firstVal + i;
+    colDataSetVal(pCol, i, (const char*)&val, false);
+  }
+  pBlock->info.rows = rows;
+
+  int32_t            dataLen = blockGetEncodeSize(pBlock);
+  SRetrieveTableRsp* pRsp = (SRetrieveTableRsp*)taosMemoryCalloc(1, sizeof(SRetrieveTableRsp) + dataLen);
+  dataLen = (rows > 0) ? blockEncode(pBlock, pRsp->data, 1) : 0;
+  blockDataDestroy(pBlock);
+
+  // in the byte order of the rpc message
+  pRsp->completed = completed;
+  pRsp->compLen = htonl(dataLen);
+  pRsp->numOfBlocks = htonl(rows > 0 ? 1 : 0);
+  pRsp->numOfRows = htobe64(rows);
+  pRsp->numOfCols = htonl(1);
+  *pLen = sizeof(SRetrieveTableRsp) + dataLen;
+  return pRsp;
+}
+
+void sendFetchRsp(SMsgSendInfo* pInfo) {
+  SResFetchReq req = {0};
+  tDeserializeSResFetchReq(pInfo->msgInfo.pData, pInfo->msgInfo.len, &req);
+
+  STestSource* pSource = &gServer->sources[req.taskId];
+  int32_t      index = pSource->numOfReq++;
+  SDataBuf     buf = {0};
+  int32_t      code = TSDB_CODE_SUCCESS;
+  if (index == pSource->failedReq || index >= pSource->rsps.size()) {
+    EXPECT_EQ(index, pSource->failedReq) << "source " << req.taskId << " is fetched after completed";
+    code = kFetchError;
+  } else {
+    int32_t rows = pSource->rsps[index];
+    buf.pData = buildRetrieveRsp(req.taskId * kSourceRange + pSource->numOfRows, rows,
+                                 index == pSource->rsps.size() - 1, (int32_t*)&buf.len);
+    pSource->numOfRows += rows;
+  }
+
+  (*pInfo->fp)(pInfo->param, &buf, code);
+  destroySendMsgInfo(pInfo);
+}
+
+void responderThreadFp() {
+  std::unique_lock<std::mutex> guard(gServer->lock);
+  while (true) {
+    gServer->cond.wait(guard, [] { return gServer->stop || !gServer->pending.empty(); });
+    if (gServer->stop) {
+      break;
+    }
+
+    SMsgSendInfo* pInfo = gServer->pending.front();
+    gServer->pending.pop_front();
+    guard.unlock();
+    taosUsleep(taosRand() % 200);
+    sendFetchRsp(pInfo);
+    guard.lock();
+  }
+}
+
+int32_t testAsyncSendMsgToServer(void* pTransporter, SEpSet* epSet, int64_t* pTransporterId, SMsgSendInfo* pInfo) {
+  if (!gServer->async) {
+    sendFetchRsp(pInfo);
+    return TSDB_CODE_SUCCESS;
+  }
+
+  std::lock_guard<std::mutex> guard(gServer->lock);
+  gServer->pending.push_back(pInfo);
+  gServer->cond.notify_one();
+  return TSDB_CODE_SUCCESS;
+}
+
+void setAsyncSendMsgToServer() {
+  static Stub stub;
+  stub.set(asyncSendMsgToServer, testAsyncSendMsgToServer);
+  {
+#ifdef WINDOWS
+    AddrAny                       any;
+    std::map<std::string, void *> result;
+    any.get_func_addr("asyncSendMsgToServer", result);
+#endif
+#ifdef LINUX
+    AddrAny                       any("libqcom.so");
+    std::map<std::string, void *> result;
+    any.get_global_func_addr_dynsym("^asyncSendMsgToServer$", result);
+#endif
+    for (const auto &f : result) {
+      stub.set(f.second, testAsyncSendMsgToServer);
+    }
+  }
+}
+
+SExchangePhysiNode* createExchangeNode(int32_t numOfSources, bool seqRecvData) {
+  SExchangePhysiNode* pExNode = (SExchangePhysiNode*)nodesMakeNode(QUERY_NODE_PHYSICAL_PLAN_EXCHANGE);
+  SDataBlockDescNode* pDesc = (SDataBlockDescNode*)nodesMakeNode(QUERY_NODE_DATABLOCK_DESC);
+  pDesc->dataBlockId = kExchangeBlockId;
+
+  SSlotDescNode* pSlot = (SSlotDescNode*)nodesMakeNode(QUERY_NODE_SLOT_DESC);
+  pSlot->slotId = 0;
+  pSlot->dataType.type = TSDB_DATA_TYPE_BIGINT;
+  pSlot->dataType.bytes = tDataTypes[TSDB_DATA_TYPE_BIGINT].bytes;
+  pSlot->output = true;
+  nodesListMakeAppend(&pDesc->pSlots, (SNode*)pSlot);
+  pDesc->totalRowSize = pSlot->dataType.bytes;
+  pDesc->outputRowSize = pDesc->totalRowSize;
+  pExNode->node.pOutputDataBlockDesc = pDesc;
+
+  for (int32_t i = 0; i < numOfSources; ++i) {
+    SDownstreamSourceNode* pSource = (SDownstreamSourceNode*)nodesMakeNode(QUERY_NODE_DOWNSTREAM_SOURCE);
+    pSource->addr.nodeId = i + 2;
+    pSource->taskId = i;  // the server finds the source of a fetch request by it
+    pSource->fetchMsgType = TDMT_SCH_FETCH;
+    nodesListMakeAppend(&pExNode->pSrcEndPoints, (SNode*)pSource);
+  }
+  pExNode->seqRecvData = seqRecvData;
+  return pExNode;
+}
+
+class ExchangeTest : public ::testing::Test {
+ protected:
+  static void SetUpTestSuite() {
+    if (exchangeObjRefPool < 0) {
+      exchangeObjRefPool = taosOpenRef(1024, doDestroyExchangeOperatorInfo);
+    }
+    setAsyncSendMsgToServer();
+  }
+
+  void SetUp() override {
+    prefetchDepth = tsExchangePrefetchDepth;
+    bufferSize = tsExchangeBufferSize;
+    gServer = &server;
+  }
+
+  void TearDown() override {
+    if (server.responder.joinable()) {
+      {
+        std::lock_guard<std::mutex> guard(server.lock);
+        server.stop = true;
+        server.cond.notify_one();
+      }
+      server.responder.join();
+    }
+    for (SMsgSendInfo* pInfo : server.pending) {
+      destroySendMsgInfo(pInfo);
+    }
+
+    if (pTaskInfo != NULL) {
+      doDestroyTask(pTaskInfo);
+    }
+    nodesDestroyNode((SNode*)pExNode);
+    gServer = NULL;
+    tsExchangePrefetchDepth = prefetchDepth;
+    tsExchangeBufferSize = bufferSize;
+  }
+
+  void addSource(const std::vector<int32_t>& rsps, int32_t failedReq = -1) {
+    STestSource source;
+    source.rsps = rsps;
+    source.failedReq = failedReq;
+    server.sources.push_back(source);
+  }
+
+  void createExchange(bool seqRecvData) {
+    if (server.async) {
+      server.responder = std::thread(responderThreadFp);
+    }
+
+    SStorageAPI api = {0};
+    pTaskInfo = doCreateTask(1, 1, 1, OPTR_EXEC_MODEL_BATCH, &api);
+    pExNode = createExchangeNode(server.sources.size(), seqRecvData);
+    pTaskInfo->pRoot = createExchangeOperatorInfo(NULL, pExNode, pTaskInfo);
+    ASSERT_NE(pTaskInfo->pRoot, nullptr);
+  }
+
+  // rows of the next block are added to the rows received of their sources, NULL once all are received or failed
+  SSDataBlock* getNext() {
+    SOperatorInfo* pOperator = pTaskInfo->pRoot;
+    SSDataBlock*   pBlock = pOperator->fpSet.getNextFn(pOperator);
+    if (pBlock == NULL) {
+      return NULL;
+    }
+
+    SColumnInfoData* pCol = (SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, 0);
+    for (int32_t i = 0; i < pBlock->info.rows; ++i) {
+      int64_t val = *(int64_t*)colDataGetData(pCol, i);
+      received[val / kSourceRange].push_back(val);
+      order.push_back(val / kSourceRange);
+    }
+    return pBlock;
+  }
+
+  // every row of every source is received once, in the order of the source
+  void checkAllReceived() {
+    for (int32_t i = 0; i < server.sources.size(); ++i) {
+      const STestSource& source = server.sources[i];
+      int64_t            numOfRows = 0;
+      for (int32_t rows : source.rsps) {
+        numOfRows += rows;
+      }
+
+      ASSERT_EQ(received[i].size(), numOfRows) << "source " << i;
+      for (int64_t j = 0; j < numOfRows; ++j) {
+        ASSERT_EQ(received[i][j], i * kSourceRange + j) << "source " << i;
+      }
+      ASSERT_EQ(source.numOfReq, source.rsps.size()) << "source " << i;
+    }
+  }
+
+  int32_t                               prefetchDepth = 0;
+  int32_t                               bufferSize = 0;
+  STestServer                           server;
+  SExecTaskInfo*                        pTaskInfo = NULL;
+  SExchangePhysiNode*                   pExNode = NULL;
+  std::map<int64_t, std::vector<int64_t>> received;
+  std::vector<int64_t>                  order;
+};
+
+}  // namespace
+
+// the next response of every source is fetched while the current ones are consumed
+TEST_F(ExchangeTest, multiSourcePrefetch) {
+  tsExchangePrefetchDepth = 3;
+  addSource({100, 100, 100, 100});
+  addSource({100, 100, 100, 100});
+  addSource({100, 100, 100, 0});  // the last response of a source may be empty
+  createExchange(false);
+
+  int32_t code = setjmp(pTaskInfo->env);
+  ASSERT_EQ(code, 0);
+
+  ASSERT_NE(getNext(), nullptr);
+  ASSERT_EQ(server.sources[0].numOfReq, 3);
+  ASSERT_EQ(server.sources[1].numOfReq, 2);
+  ASSERT_EQ(server.sources[2].numOfReq, 2);
+
+  while (getNext() != NULL) {
+  }
+  ASSERT_EQ(pTaskInfo->code, TSDB_CODE_SUCCESS);
+  checkAllReceived();
+}
+
+// the sources are not fetched ahead once the buffered responses are out of the credit of the operator
+TEST_F(ExchangeTest, outOfCredit) {
+  tsExchangePrefetchDepth = 8;
+  tsExchangeBufferSize = 1;  // 3 of the 320 KB responses of the 4 sources
+  for (int32_t i = 0; i < 4; ++i) {
+    addSource({40000, 40000, 40000});
+  }
+  createExchange(false);
+
+  int32_t code = setjmp(pTaskInfo->env);
+  ASSERT_EQ(code, 0);
+
+  ASSERT_NE(getNext(), nullptr);
+  SExchangeInfo* pExchangeInfo = (SExchangeInfo*)pTaskInfo->pRoot->info;
+  ASSERT_GT(pExchangeInfo->bufferedBytes, tsExchangeBufferSize * 1048576L);
+  ASSERT_EQ(server.sources[0].numOfReq, 2);  // the response consumed is fetched again
+  for (int32_t i = 1; i < 4; ++i) {
+    ASSERT_EQ(server.sources[i].numOfReq, 1) << "source " << i;
+  }
+
+  while (getNext() != NULL) {
+    ASSERT_LE(pExchangeInfo->bufferedBytes, (tsExchangeBufferSize + 2) * 1048576L);
+  }
+  ASSERT_EQ(pTaskInfo->code, TSDB_CODE_SUCCESS);
+  ASSERT_EQ(pExchangeInfo->bufferedBytes, 0);
+  checkAllReceived();
+}
+
+// the error of a prefetch request fails the operator, even if the responses fetched before it are not consumed yet
+TEST_F(ExchangeTest, errorWithPrefetchedRsp) {
+  tsExchangePrefetchDepth = 3;
+  addSource({10, 10, 10, 10, 10, 10}, 3);
+  addSource({10, 10});
+  createExchange(false);
+
+  int32_t code = setjmp(pTaskInfo->env);
+  ASSERT_EQ(code, 0);
+
+  ASSERT_NE(getNext(), nullptr);
+  ASSERT_EQ(received[0].size(), 10);
+  ASSERT_EQ(server.sources[0].numOfReq, 3);
+
+  // the failed request is sent with the 2 responses received before it not consumed yet
+  while (getNext() != NULL) {
+  }
+  ASSERT_EQ(server.sources[0].numOfReq, 4);
+  ASSERT_EQ(pTaskInfo->code, kFetchError);
+  ASSERT_LT(received[0].size(), 30);
+}
+
+// the sources are loaded one by one, and the next response of the current source is fetched ahead
+TEST_F(ExchangeTest, seqLoad) {
+  tsExchangePrefetchDepth = 2;
+  addSource({100, 100, 100});
+  addSource({100, 100, 100});
+  createExchange(true);
+
+  int32_t code = setjmp(pTaskInfo->env);
+  ASSERT_EQ(code, 0);
+
+  ASSERT_NE(getNext(), nullptr);
+  ASSERT_EQ(server.sources[0].numOfReq, 3);
+  ASSERT_EQ(server.sources[1].numOfReq, 0);
+
+  while (getNext() != NULL) {
+  }
+  ASSERT_EQ(pTaskInfo->code, TSDB_CODE_SUCCESS);
+  checkAllReceived();
+  for (int32_t i = 1; i < order.size(); ++i) {
+    ASSERT_LE(order[i - 1], order[i]);
+  }
+}
+
+// the responses arrive in another thread, in any order of the sources
+TEST_F(ExchangeTest, asyncRsp) {
+  tsExchangePrefetchDepth = 4;
+  server.async = true;
+  for (int32_t i = 0; i < 8; ++i) {
+    addSource(std::vector<int32_t>(20, 50));
+  }
+  createExchange(false);
+
+  int32_t code = setjmp(pTaskInfo->env);
+  ASSERT_EQ(code, 0);
+
+  while (getNext() != NULL) {
+  }
+  ASSERT_EQ(pTaskInfo->code, TSDB_CODE_SUCCESS);
+  checkAllReceived();
+}
+
+// the error may arrive at any time while the responses are consumed, it is never lost
+TEST_F(ExchangeTest, asyncError) {
+  tsExchangePrefetchDepth = 4;
+  server.async = true;
+  for (int32_t i = 0; i < 8; ++i) {
+    addSource(std::vector<int32_t>(20, 50), (i == 5) ? 12 : -1);
+  }
+  createExchange(false);
+
+  int32_t code = setjmp(pTaskInfo->env);
+  ASSERT_EQ(code, 0);
+
+  while (getNext() != NULL) {
+  }
+  ASSERT_EQ(pTaskInfo->code, kFetchError);
+}
+
+#pragma GCC diagnostic pop
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "executorInt.h"
+#include "functionMgt.h"
+#include "operator.h"
+#include "querytask.h"
+#include "tdatablock.h"
+#include "tglobal.h"
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsign-compare"
+
+namespace {
+
+const int32_t kBlockRows = 4096;
+const int64_t kNotLoaded = 1000000;  // the values of a block that is returned as block sma are not loaded
+
+// rows of (key, val) returned by the table scan below, a block of one key is returned as block sma if the scan
+// loads sma
+struct STestBlock {
+  std::vector<int64_t> keys;
+  std::vector<int64_t> vals;
+};
+
+struct STestScanInfo {
+  STableScanInfo          scan;  // keep the first, the group by operator switches its data load flag
+  std::vector<STestBlock> blocks;
+  size_t                  next;
+  SSDataBlock*            pRes;
+  SColumnDataAgg          valAgg;
+  int32_t                 numOfSmaBlocks;
+};
+
+SSDataBlock* testScanNext(SOperatorInfo* pOperator) {
+  STestScanInfo* pInfo = (STestScanInfo*)pOperator->info;
+  if (pInfo->next >= pInfo->blocks.size()) {
+    return NULL;
+  }
+
+  const STestBlock& block = pInfo->blocks[pInfo->next++];
+  SSDataBlock*      pRes = pInfo->pRes;
+  int32_t           rows = block.keys.size();
+
+  blockDataCleanup(pRes);
+  taosMemoryFreeClear(pRes->pBlockAgg);
+  blockDataEnsureCapacity(pRes, rows);
+
+  bool oneKey = true;
+  for (int32_t i = 0; i < rows; ++i) {
+    oneKey = oneKey && block.keys[i] == block.keys[0];
+  }
+  bool loadSma = oneKey && pInfo->scan.base.dataBlockLoadFlag == FUNC_DATA_REQUIRED_SMA_LOAD;
+
+  SColumnInfoData* pKeyCol = (SColumnInfoData*)taosArrayGet(pRes->pDataBlock, 0);
+  SColumnInfoData* pValCol = (SColumnInfoData*)taosArrayGet(pRes->pDataBlock, 1);
+  for (int32_t i = 0; i < rows; ++i) {
+    colDataSetVal(pKeyCol, i, (const char*)&block.keys[i], false);
+    colDataSetVal(pValCol, i, (const char*)(loadSma ? &kNotLoaded : &block.vals[i]), false);
+  }
+
+  if (loadSma) {
+    pInfo->valAgg.colId = 2;
+    pInfo->valAgg.numOfNull = 0;
+    pInfo->valAgg.sum = 0;
+    pInfo->valAgg.max = INT64_MIN;
+    pInfo->valAgg.min = INT64_MAX;
+    for (int64_t v : block.vals) {
+      pInfo->valAgg.sum += v;
+      pInfo->valAgg.max = TMAX(pInfo->valAgg.max, v);
+      pInfo->valAgg.min = TMIN(pInfo->valAgg.min, v);
+    }
+    pRes->pBlockAgg = (SColumnDataAgg**)taosMemoryCalloc(2, POINTER_BYTES);
+    pRes->pBlockAgg[1] = &pInfo->valAgg;
+    pInfo->numOfSmaBlocks++;
+  }
+
+  pRes->info.rows = rows;
+  return pRes;
+}
+
+void destroyTestScanInfo(void* param) {
+  STestScanInfo* pInfo = (STestScanInfo*)param;
+  blockDataDestroy(pInfo->pRes);
+  delete pInfo;
+}
+
+SNode* createColumn(int16_t dataBlockId, int16_t slotId) {
+  SColumnNode* pCol = (SColumnNode*)nodesMakeNode(QUERY_NODE_COLUMN);
+  pCol->node.resType.type = TSDB_DATA_TYPE_BIGINT;
+  pCol->node.resType.bytes = tDataTypes[TSDB_DATA_TYPE_BIGINT].bytes;
+  pCol->dataBlockId = dataBlockId;
+  pCol->slotId = slotId;
+  pCol->colId = slotId + 1;
+  pCol->colType = COLUMN_TYPE_COLUMN;
+  return (SNode*)pCol;
+}
+
+SNode* createTarget(int16_t slotId, SNode* pExpr) {
+  STargetNode* pTarget = (STargetNode*)nodesMakeNode(QUERY_NODE_TARGET);
+  pTarget->dataBlockId = 1;
+  pTarget->slotId = slotId;
+  pTarget->pExpr = pExpr;
+  return (SNode*)pTarget;
+}
+
+SNode* createFunction(const char* name, SNode* pParam) {
+  SFunctionNode* pFunc = (SFunctionNode*)nodesMakeNode(QUERY_NODE_FUNCTION);
+  strcpy(pFunc->functionName, name);
+  nodesListMakeAppend(&pFunc->pParameterList, pParam);
+  int32_t code = fmGetFuncInfo(pFunc, NULL, 0);
+  EXPECT_EQ(code, 0);
+  return (SNode*)pFunc;
+}
+
+// select count(val), sum(val), key from t group by key, the input block is (key bigint, val bigint)
+SAggPhysiNode* createGroupbyNode() {
+  SAggPhysiNode*      pAggNode = (SAggPhysiNode*)nodesMakeNode(QUERY_NODE_PHYSICAL_PLAN_HASH_AGG);
+  SDataBlockDescNode* pDesc = (SDataBlockDescNode*)nodesMakeNode(QUERY_NODE_DATABLOCK_DESC);
+  pDesc->dataBlockId = 1;
+  for (int16_t i = 0; i < 3; ++i) {
+    SSlotDescNode* pSlot = (SSlotDescNode*)nodesMakeNode(QUERY_NODE_SLOT_DESC);
+    pSlot->slotId = i;
+    pSlot->dataType.type = TSDB_DATA_TYPE_BIGINT;
+    pSlot->dataType.bytes = tDataTypes[TSDB_DATA_TYPE_BIGINT].bytes;
+    pSlot->output = true;
+    nodesListMakeAppend(&pDesc->pSlots, (SNode*)pSlot);
+    pDesc->totalRowSize += pSlot->dataType.bytes;
+  }
+  pDesc->outputRowSize = pDesc->totalRowSize;
+  pAggNode->node.pOutputDataBlockDesc = pDesc;
+
+  nodesListMakeAppend(&pAggNode->pAggFuncs, createTarget(0, createFunction("count", createColumn(0, 1))));
+  nodesListMakeAppend(&pAggNode->pAggFuncs, createTarget(1, createFunction("sum", createColumn(0, 1))));
+  nodesListMakeAppend(&pAggNode->pGroupKeys, createTarget(2, createColumn(0, 0)));
+  pAggNode->node.inputTsOrder = ORDER_ASC;
+  pAggNode->node.outputTsOrder = ORDER_ASC;
+  return pAggNode;
+}
+
+class GroupbyTest : public ::testing::Test {
+ protected:
+  static void SetUpTestSuite() {
+    tstrncpy(tsTempDir, TD_TMP_DIR_PATH, PATH_MAX);
+    osUpdate();
+    fmFuncMgtInit();
+  }
+
+  void SetUp() override {
+    pTaskInfo = (SExecTaskInfo*)taosMemoryCalloc(1, sizeof(SExecTaskInfo));
+    pTaskInfo->id.str = taosStrdup("groupbyTest");
+
+    pScanInfo = new STestScanInfo();
+    pScanInfo->scan.base.dataBlockLoadFlag = FUNC_DATA_REQUIRED_SMA_LOAD;
+    pScanInfo->pRes = createDataBlock();
+    for (int16_t i = 0; i < 2; ++i) {
+      SColumnInfoData col = createColumnInfoData(TSDB_DATA_TYPE_BIGINT, tDataTypes[TSDB_DATA_TYPE_BIGINT].bytes, i + 1);
+      blockDataAppendColInfo(pScanInfo->pRes, &col);
+    }
+  }
+
+  void TearDown() override {
+    if (pOperator != NULL) {
+      destroyOperator(pOperator);
+    } else {
+      destroyTestScanInfo(pScanInfo);
+    }
+    nodesDestroyNode((SNode*)pAggNode);
+    taosMemoryFree(pTaskInfo->id.str);
+    taosMemoryFree(pTaskInfo);
+  }
+
+  void addBlocks(int64_t firstKey, int64_t numOfKeys, int64_t val) {
+    STestBlock block;
+    for (int64_t key = firstKey; key < firstKey + numOfKeys; ++key) {
+      block.keys.push_back(key);
+      block.vals.push_back(val);
+      expected[key].first += 1;
+      expected[key].second += val;
+      if (block.keys.size() == kBlockRows) {
+        pScanInfo->blocks.push_back(block);
+        block = STestBlock();
+      }
+    }
+    if (!block.keys.empty()) {
+      pScanInfo->blocks.push_back(block);
+    }
+  }
+
+  void addOneKeyBlock(int64_t key, int32_t rows, int64_t val) {
+    STestBlock block;
+    block.keys.assign(rows, key);
+    block.vals.assign(rows, val);
+    expected[key].first += rows;
+    expected[key].second += val * rows;
+    pScanInfo->blocks.push_back(block);
+  }
+
+  // run the group by on the blocks added, and check each group is returned once with the aggregated values
+  void run() {
+    SOperatorInfo* pScan = (SOperatorInfo*)taosMemoryCalloc(1, sizeof(SOperatorInfo));
+    setOperatorInfo(pScan, "TestTableScan", QUERY_NODE_PHYSICAL_PLAN_TABLE_SCAN, false, OP_NOT_OPENED, pScanInfo,
+                    pTaskInfo);
+    pScan->fpSet =
+        createOperatorFpSet(optrDummyOpenFn, testScanNext, NULL, destroyTestScanInfo, optrDefaultBufFn, NULL);
+
+    pAggNode = createGroupbyNode();
+    pOperator = createGroupOperatorInfo(pScan, pAggNode, pTaskInfo);
+    ASSERT_NE(pOperator, nullptr);
+
+    int32_t code = setjmp(pTaskInfo->env);
+    ASSERT_EQ(code, 0);
+
+    std::map<int64_t, std::pair<int64_t, int64_t>> results;
+    for (SSDataBlock* pBlock = pOperator->fpSet.getNextFn(pOperator); pBlock != NULL;
+         pBlock = pOperator->fpSet.getNextFn(pOperator)) {
+      SColumnInfoData* pCount = (SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, 0);
+      SColumnInfoData* pSum = (SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, 1);
+      SColumnInfoData* pKey = (SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, 2);
+      for (int32_t i = 0; i < pBlock->info.rows; ++i) {
+        int64_t key = *(int64_t*)colDataGetData(pKey, i);
+        ASSERT_EQ(results.count(key), 0) << "group " << key << " returned twice";
+        results[key] = std::make_pair(*(int64_t*)colDataGetData(pCount, i), *(int64_t*)colDataGetData(pSum, i));
+      }
+    }
+
+    ASSERT_EQ(results.size(), expected.size());
+    for (const auto& e : expected) {
+      ASSERT_EQ(results.count(e.first), 1) << "group " << e.first << " missing";
+      ASSERT_EQ(results[e.first], e.second) << "group " << e.first;
+    }
+  }
+
+  SExecTaskInfo*                                 pTaskInfo = NULL;
+  STestScanInfo*                                 pScanInfo = NULL;
+  SAggPhysiNode*                                 pAggNode = NULL;
+  SOperatorInfo*                                 pOperator = NULL;
+  std::map<int64_t, std::pair<int64_t, int64_t>> expected;  // (count, sum) of each group
+};
+
+}  // namespace
+
+// all groups fit in the result buffer, and the blocks of one key are aggregated by their block sma
+TEST_F(GroupbyTest, smaWithoutSpill) {
+  addBlocks(0, 1000, 1);
+  addOneKeyBlock(10, 100, 2);
+  addOneKeyBlock(2000, 100, 3);
+  run();
+
+  ASSERT_EQ(pScanInfo->scan.base.dataBlockLoadFlag, FUNC_DATA_REQUIRED_SMA_LOAD);
+  ASSERT_EQ(pScanInfo->numOfSmaBlocks, 2);
+}
+
+// the groups that do not fit in the result buffer are spilled, and aggregated from the spilled rows at the end
+TEST_F(GroupbyTest, spill) {
+  addBlocks(0, 400000, 1);
+  addBlocks(0, 400000, 2);  // rows of the groups both in memory and spilled
+  addBlocks(390000, 20000, 3);
+  run();
+
+  ASSERT_EQ(pScanInfo->scan.base.dataBlockLoadFlag, FUNC_DATA_REQUIRED_DATA_LOAD);
+}
+
+// once the groups are spilled the scan loads the rows instead of the block sma, so the rows of a spilled group
+// that come in a block of one key are spilled with the others of the group
+TEST_F(GroupbyTest, smaAfterSpill) {
+  addBlocks(0, 400000, 1);
+  addOneKeyBlock(0, 100, 2);       // a group in memory
+  addOneKeyBlock(399999, 100, 3);  // a group spilled
+  addOneKeyBlock(500000, 100, 4);  // a new group, spilled too
+  addBlocks(399990, 20, 5);
+  run();
+
+  ASSERT_EQ(pScanInfo->scan.base.dataBlockLoadFlag, FUNC_DATA_REQUIRED_DATA_LOAD);
+  ASSERT_EQ(pScanInfo->numOfSmaBlocks, 0);
+}
+
+#pragma GCC diagnostic pop
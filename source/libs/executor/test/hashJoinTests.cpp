@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "executorInt.h"
+#include "operator.h"
+#include "querytask.h"
+#include "tdatablock.h"
+#include "tglobal.h"
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsign-compare"
+
+namespace {
+
+const int32_t kBlockRows = 4096;
+const int64_t kNullKey = INT64_MIN;  // the key of the row is null
+const int16_t kProbeBlockId = 1;
+const int16_t kBuildBlockId = 2;
+const int16_t kJoinBlockId = 3;
+
+typedef std::pair<int64_t, int64_t> SKeyVal;
+
+// returns the (key bigint, val bigint) rows of one side of the join
+struct STestSourceInfo {
+  std::vector<SKeyVal> rows;
+  size_t               next;
+  SSDataBlock*         pRes;
+};
+
+SSDataBlock* testSourceNext(SOperatorInfo* pOperator) {
+  STestSourceInfo* pInfo = (STestSourceInfo*)pOperator->info;
+  if (pInfo->next >= pInfo->rows.size()) {
+    return NULL;
+  }
+
+  SSDataBlock* pRes = pInfo->pRes;
+  int32_t      rows = TMIN(kBlockRows, pInfo->rows.size() - pInfo->next);
+  blockDataCleanup(pRes);
+  blockDataEnsureCapacity(pRes, rows);
+
+  SColumnInfoData* pKeyCol = (SColumnInfoData*)taosArrayGet(pRes->pDataBlock, 0);
+  SColumnInfoData* pValCol = (SColumnInfoData*)taosArrayGet(pRes->pDataBlock, 1);
+  for (int32_t i = 0; i < rows; ++i) {
+    const SKeyVal& row = pInfo->rows[pInfo->next++];
+    if (row.first == kNullKey) {
+      colDataSetNULL(pKeyCol, i);
+    } else {
+      colDataSetVal(pKeyCol, i, (const char*)&row.first, false);
+    }
+    colDataSetVal(pValCol, i, (const char*)&row.second, false);
+  }
+
+  pRes->info.rows = rows;
+  return pRes;
+}
+
+void destroyTestSourceInfo(void* param) {
+  STestSourceInfo* pInfo = (STestSourceInfo*)param;
+  blockDataDestroy(pInfo->pRes);
+  delete pInfo;
+}
+
+SOperatorInfo* createTestSource(const std::vector<SKeyVal>& rows, int16_t dataBlockId, SExecTaskInfo* pTaskInfo) {
+  STestSourceInfo* pInfo = new STestSourceInfo();
+  pInfo->rows = rows;
+  pInfo->pRes = createDataBlock();
+  for (int16_t i = 0; i < 2; ++i) {
+    SColumnInfoData col = createColumnInfoData(TSDB_DATA_TYPE_BIGINT, tDataTypes[TSDB_DATA_TYPE_BIGINT].bytes, i + 1);
+    blockDataAppendColInfo(pInfo->pRes, &col);
+  }
+
+  SOperatorInfo* pOperator = (SOperatorInfo*)taosMemoryCalloc(1, sizeof(SOperatorInfo));
+  setOperatorInfo(pOperator, "TestSource", QUERY_NODE_PHYSICAL_PLAN_EXCHANGE, false, OP_NOT_OPENED, pInfo, pTaskInfo);
+  pOperator->resultDataBlockId = dataBlockId;
+  pOperator->fpSet =
+      createOperatorFpSet(optrDummyOpenFn, testSourceNext, NULL, destroyTestSourceInfo, optrDefaultBufFn, NULL);
+  return pOperator;
+}
+
+SNode* createColumn(int16_t dataBlockId, int16_t slotId) {
+  SColumnNode* pCol = (SColumnNode*)nodesMakeNode(QUERY_NODE_COLUMN);
+  pCol->node.resType.type = TSDB_DATA_TYPE_BIGINT;
+  pCol->node.resType.bytes = tDataTypes[TSDB_DATA_TYPE_BIGINT].bytes;
+  pCol->dataBlockId = dataBlockId;
+  pCol->slotId = slotId;
+  pCol->colId = slotId + 1;
+  pCol->colType = COLUMN_TYPE_COLUMN;
+  return (SNode*)pCol;
+}
+
+SNode* createOperatorNode(EOperatorType opType, SNode* pLeft, SNode* pRight) {
+  SOperatorNode* pOper = (SOperatorNode*)nodesMakeNode(QUERY_NODE_OPERATOR);
+  pOper->node.resType.type = TSDB_DATA_TYPE_BOOL;
+  pOper->node.resType.bytes = tDataTypes[TSDB_DATA_TYPE_BOOL].bytes;
+  pOper->opType = opType;
+  pOper->pLeft = pLeft;
+  pOper->pRight = pRight;
+  return (SNode*)pOper;
+}
+
+// select l.key, l.val, r.key, r.val from l [left] join r on l.key = r.key [and l.val < r.val] [where r.val is null]
+SHashJoinPhysiNode* createHashJoinNode(EJoinType joinType, bool otherOnCond, bool buildValIsNull) {
+  SHashJoinPhysiNode* pJoinNode = (SHashJoinPhysiNode*)nodesMakeNode(QUERY_NODE_PHYSICAL_PLAN_HASH_JOIN);
+  SDataBlockDescNode* pDesc = (SDataBlockDescNode*)nodesMakeNode(QUERY_NODE_DATABLOCK_DESC);
+  pDesc->dataBlockId = kJoinBlockId;
+  for (int16_t i = 0; i < 4; ++i) {
+    SSlotDescNode* pSlot = (SSlotDescNode*)nodesMakeNode(QUERY_NODE_SLOT_DESC);
+    pSlot->slotId = i;
+    pSlot->dataType.type = TSDB_DATA_TYPE_BIGINT;
+    pSlot->dataType.bytes = tDataTypes[TSDB_DATA_TYPE_BIGINT].bytes;
+    pSlot->output = true;
+    nodesListMakeAppend(&pDesc->pSlots, (SNode*)pSlot);
+    pDesc->totalRowSize += pSlot->dataType.bytes;
+
+    STargetNode* pTarget = (STargetNode*)nodesMakeNode(QUERY_NODE_TARGET);
+    pTarget->dataBlockId = kJoinBlockId;
+    pTarget->slotId = i;
+    pTarget->pExpr = createColumn(i < 2 ? kProbeBlockId : kBuildBlockId, i % 2);
+    nodesListMakeAppend(&pJoinNode->pTargets, (SNode*)pTarget);
+  }
+  pDesc->outputRowSize = pDesc->totalRowSize;
+  pJoinNode->node.pOutputDataBlockDesc = pDesc;
+
+  pJoinNode->joinType = joinType;
+  pJoinNode->pColEqualOnConditions =
+      createOperatorNode(OP_TYPE_EQUAL, createColumn(kProbeBlockId, 0), createColumn(kBuildBlockId, 0));
+  if (otherOnCond) {
+    pJoinNode->pOnConditions =
+        createOperatorNode(OP_TYPE_LOWER_THAN, createColumn(kJoinBlockId, 1), createColumn(kJoinBlockId, 3));
+  }
+  if (buildValIsNull) {
+    pJoinNode->node.pConditions = createOperatorNode(OP_TYPE_IS_NULL, createColumn(kJoinBlockId, 3), NULL);
+  }
+  return pJoinNode;
+}
+
+class HashJoinTest : public ::testing::Test {
+ protected:
+  static void SetUpTestSuite() {
+    tstrncpy(tsTempDir, TD_TMP_DIR_PATH, PATH_MAX);
+    osUpdate();
+  }
+
+  void SetUp() override {
+    pTaskInfo = (SExecTaskInfo*)taosMemoryCalloc(1, sizeof(SExecTaskInfo));
+    pTaskInfo->id.str = taosStrdup("hashJoinTest");
+  }
+
+  void TearDown() override {
+    destroyOperator(pOperator);
+    nodesDestroyNode((SNode*)pJoinNode);
+    taosMemoryFree(pTaskInfo->id.str);
+    taosMemoryFree(pTaskInfo);
+  }
+
+  // run the join, and check the rows joined are the ones of a nested loop join, the probe rows of left join that
+  // match nothing are output once with the build columns null
+  void run(bool otherOnCond) {
+    std::multimap<int64_t, int64_t> buildRows;
+    for (const SKeyVal& row : build) {
+      if (row.first != kNullKey) {
+        buildRows.insert(row);
+      }
+    }
+    std::map<SKeyVal, std::pair<int64_t, int64_t>> expected;  // probe row -> (count, sum of build vals) matched
+    std::map<SKeyVal, int64_t>                     expectedNullExtended;
+    for (const SKeyVal& row : probe) {
+      bool matched = false;
+      auto range = buildRows.equal_range(row.first);
+      for (auto it = range.first; it != range.second; ++it) {
+        if (!otherOnCond || row.second < it->second) {
+          matched = true;
+          if (!buildValIsNull) {
+            expected[row].first += 1;
+            expected[row].second += it->second;
+          }
+        }
+      }
+      if (!matched && JOIN_TYPE_LEFT == joinType) {
+        expectedNullExtended[row] += 1;
+      }
+    }
+
+    SOperatorInfo* pDownstream[2] = {createTestSource(probe, kProbeBlockId, pTaskInfo),
+                                     createTestSource(build, kBuildBlockId, pTaskInfo)};
+    pJoinNode = createHashJoinNode(joinType, otherOnCond, buildValIsNull);
+    pOperator = createHashJoinOperatorInfo(pDownstream, 2, pJoinNode, pTaskInfo);
+    ASSERT_NE(pOperator, nullptr);
+
+    int32_t code = setjmp(pTaskInfo->env);
+    ASSERT_EQ(code, 0);
+
+    std::map<SKeyVal, std::pair<int64_t, int64_t>> results;
+    std::map<SKeyVal, int64_t>                     resultsNullExtended;
+    for (SSDataBlock* pBlock = pOperator->fpSet.getNextFn(pOperator); pBlock != NULL;
+         pBlock = pOperator->fpSet.getNextFn(pOperator)) {
+      SColumnInfoData* pCols[4];
+      for (int32_t i = 0; i < 4; ++i) {
+        pCols[i] = (SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, i);
+      }
+      for (int32_t i = 0; i < pBlock->info.rows; ++i) {
+        ASSERT_FALSE(colDataIsNull_s(pCols[1], i));
+        SKeyVal probeRow(colDataIsNull_s(pCols[0], i) ? kNullKey : *(int64_t*)colDataGetData(pCols[0], i),
+                         *(int64_t*)colDataGetData(pCols[1], i));
+        if (colDataIsNull_s(pCols[2], i)) {
+          ASSERT_TRUE(colDataIsNull_s(pCols[3], i));
+          resultsNullExtended[probeRow] += 1;
+          continue;
+        }
+        ASSERT_FALSE(colDataIsNull_s(pCols[3], i));
+        ASSERT_EQ(*(int64_t*)colDataGetData(pCols[2], i), probeRow.first);
+        results[probeRow].first += 1;
+        results[probeRow].second += *(int64_t*)colDataGetData(pCols[3], i);
+      }
+    }
+
+    ASSERT_EQ(results.size(), expected.size());
+    for (const auto& e : expected) {
+      ASSERT_EQ(results[e.first], e.second) << "probe row " << e.first.first << ", " << e.first.second;
+    }
+    ASSERT_EQ(resultsNullExtended, expectedNullExtended);
+  }
+
+  SExecTaskInfo*       pTaskInfo = NULL;
+  SHashJoinPhysiNode*  pJoinNode = NULL;
+  SOperatorInfo*       pOperator = NULL;
+  std::vector<SKeyVal> probe;
+  std::vector<SKeyVal> build;
+  EJoinType            joinType = JOIN_TYPE_INNER;
+  bool                 buildValIsNull = false;
+};
+
+// 600000 build rows of 26 bytes do not fit in the 10 MB build buffer, so the chains of the keys go through pages
+// flushed to disk
+void addBuildRows(std::vector<SKeyVal>& build, int32_t numOfRows, int32_t numOfKeys) {
+  for (int32_t i = 0; i < numOfRows; ++i) {
+    build.push_back(SKeyVal(i % numOfKeys, i));
+  }
+}
+
+void addProbeRows(std::vector<SKeyVal>& probe, int64_t firstKey, int64_t endKey, int64_t valFactor) {
+  for (int64_t key = firstKey; key < endKey; ++key) {
+    probe.push_back(SKeyVal(key, key * valFactor));
+  }
+}
+
+}  // namespace
+
+TEST_F(HashJoinTest, smallBuild) {
+  addBuildRows(build, 1000, 100);
+  addProbeRows(probe, -10, 110, 0);
+  addProbeRows(probe, 0, 50, 1);  // a key probed twice
+  run(false);
+}
+
+// null keys are not equal to any key, on both sides
+TEST_F(HashJoinTest, spillWithNullKeys) {
+  addBuildRows(build, 600000, 6000);
+  for (int32_t i = 0; i < 100; ++i) {
+    build.insert(build.begin() + i * 5000, SKeyVal(kNullKey, i));
+    probe.push_back(SKeyVal(kNullKey, i));
+  }
+  addProbeRows(probe, 0, 7000, 0);
+  run(false);
+}
+
+// the on conditions besides the equal keys are applied to the rows joined
+TEST_F(HashJoinTest, spillWithOtherOnCond) {
+  addBuildRows(build, 600000, 6000);
+  addProbeRows(probe, -100, 6100, 50);
+  run(true);
+}
+
+TEST_F(HashJoinTest, emptyBuild) {
+  build.push_back(SKeyVal(kNullKey, 1));
+  addProbeRows(probe, 0, 100, 0);
+  probe.push_back(SKeyVal(kNullKey, 1));
+  run(false);
+}
+
+TEST_F(HashJoinTest, leftJoin) {
+  joinType = JOIN_TYPE_LEFT;
+  addBuildRows(build, 1000, 100);
+  addProbeRows(probe, -10, 110, 0);
+  addProbeRows(probe, 0, 50, 1);
+  probe.push_back(SKeyVal(kNullKey, 1));
+  run(false);
+}
+
+// the probe rows of null keys and of keys not built are null extended, also after the chains on disk
+TEST_F(HashJoinTest, leftJoinSpillWithNullKeys) {
+  joinType = JOIN_TYPE_LEFT;
+  addBuildRows(build, 600000, 6000);
+  for (int32_t i = 0; i < 100; ++i) {
+    build.insert(build.begin() + i * 5000, SKeyVal(kNullKey, i));
+    probe.push_back(SKeyVal(kNullKey, i));
+  }
+  addProbeRows(probe, -100, 7000, 1);
+  run(false);
+}
+
+// the where conditions are applied after the null extension, so only the unmatched probe rows are left
+TEST_F(HashJoinTest, leftJoinWhereBuildIsNull) {
+  joinType = JOIN_TYPE_LEFT;
+  buildValIsNull = true;
+  addBuildRows(build, 600000, 6000);
+  addProbeRows(probe, -100, 7000, 1);
+  run(false);
+}
+
+TEST_F(HashJoinTest, leftJoinEmptyBuild) {
+  joinType = JOIN_TYPE_LEFT;
+  build.push_back(SKeyVal(kNullKey, 1));
+  addProbeRows(probe, 0, 100, 0);
+  probe.push_back(SKeyVal(kNullKey, 1));
+  run(false);
+}
+
+#pragma GCC diagnostic pop
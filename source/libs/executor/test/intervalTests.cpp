@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include "executorInt.h"
+#include "functionMgt.h"
+#include "operator.h"
+#include "querytask.h"
+#include "tdatablock.h"
+#include "tglobal.h"
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsign-compare"
+
+namespace {
+
+const int32_t kNumOfFuncs = 5;
+
+// the aggregated values of a window: count(val), sum(val), min(val), max(val)
+struct SWinRes {
+  int64_t count = 0;
+  int64_t sum = 0;
+  int64_t min = INT64_MAX;
+  int64_t max = INT64_MIN;
+
+  bool operator==(const SWinRes& o) const { return count == o.count && sum == o.sum && min == o.min && max == o.max; }
+};
+
+typedef std::map<int64_t, SWinRes> SWinResMap;  // window start -> aggregated values
+
+// rows of (ts timestamp, val bigint), the timestamps of each block are in the order of the scan
+struct STestScanInfo {
+  std::vector<std::vector<int64_t>> blocks;
+  size_t                            next;
+  SSDataBlock*                      pRes;
+};
+
+int64_t valOfTs(int64_t ts) { return ts % 1009; }
+
+SSDataBlock* testScanNext(SOperatorInfo* pOperator) {
+  STestScanInfo* pInfo = (STestScanInfo*)pOperator->info;
+  if (pInfo->next >= pInfo->blocks.size()) {
+    return NULL;
+  }
+
+  const std::vector<int64_t>& block = pInfo->blocks[pInfo->next++];
+  SSDataBlock*                pRes = pInfo->pRes;
+  int32_t                     rows = block.size();
+  blockDataCleanup(pRes);
+  blockDataEnsureCapacity(pRes, rows);
+
+  SColumnInfoData* pTsCol = (SColumnInfoData*)taosArrayGet(pRes->pDataBlock, 0);
+  SColumnInfoData* pValCol = (SColumnInfoData*)taosArrayGet(pRes->pDataBlock, 1);
+  for (int32_t i = 0; i < rows; ++i) {
+    int64_t val = valOfTs(block[i]);
+    colDataSetVal(pTsCol, i, (const char*)&block[i], false);
+    colDataSetVal(pValCol, i, (const char*)&val, false);
+  }
+
+  pRes->info.rows = rows;
+  pRes->info.dataLoad = 1;
+  pRes->info.scanFlag = MAIN_SCAN;
+  pRes->info.window.skey = TMIN(block.front(), block.back());
+  pRes->info.window.ekey = TMAX(block.front(), block.back());
+  return pRes;
+}
+
+void destroyTestScanInfo(void* param) {
+  STestScanInfo* pInfo = (STestScanInfo*)param;
+  blockDataDestroy(pInfo->pRes);
+  delete pInfo;
+}
+
+SNode* createColumn(int16_t slotId, int8_t type) {
+  SColumnNode* pCol = (SColumnNode*)nodesMakeNode(QUERY_NODE_COLUMN);
+  pCol->node.resType.type = type;
+  pCol->node.resType.bytes = tDataTypes[type].bytes;
+  pCol->node.resType.precision = TSDB_TIME_PRECISION_MILLI;
+  pCol->dataBlockId = 0;
+  pCol->slotId = slotId;
+  pCol->colId = slotId + 1;
+  pCol->colType = COLUMN_TYPE_COLUMN;
+  return (SNode*)pCol;
+}
+
+SNode* createFunction(const char* name, SNode* pParam) {
+  SFunctionNode* pFunc = (SFunctionNode*)nodesMakeNode(QUERY_NODE_FUNCTION);
+  strcpy(pFunc->functionName, name);
+  if (pParam != NULL) {
+    nodesListMakeAppend(&pFunc->pParameterList, pParam);
+  }
+  int32_t code = fmGetFuncInfo(pFunc, NULL, 0);
+  EXPECT_EQ(code, 0);
+  return (SNode*)pFunc;
+}
+
+SNode* createTarget(int16_t slotId, SNode* pExpr) {
+  STargetNode* pTarget = (STargetNode*)nodesMakeNode(QUERY_NODE_TARGET);
+  pTarget->dataBlockId = 1;
+  pTarget->slotId = slotId;
+  pTarget->pExpr = pExpr;
+  return (SNode*)pTarget;
+}
+
+// select _wstart, count(val), sum(val), min(val), max(val) from t interval(interval) [offset]
+SIntervalPhysiNode* createIntervalNode(int64_t interval, int64_t offset, EOrder order) {
+  SIntervalPhysiNode* pIntervalNode = (SIntervalPhysiNode*)nodesMakeNode(QUERY_NODE_PHYSICAL_PLAN_HASH_INTERVAL);
+  SDataBlockDescNode* pDesc = (SDataBlockDescNode*)nodesMakeNode(QUERY_NODE_DATABLOCK_DESC);
+  pDesc->dataBlockId = 1;
+  for (int16_t i = 0; i < kNumOfFuncs; ++i) {
+    SSlotDescNode* pSlot = (SSlotDescNode*)nodesMakeNode(QUERY_NODE_SLOT_DESC);
+    pSlot->slotId = i;
+    pSlot->dataType.type = (i == 0) ? TSDB_DATA_TYPE_TIMESTAMP : TSDB_DATA_TYPE_BIGINT;
+    pSlot->dataType.bytes = tDataTypes[pSlot->dataType.type].bytes;
+    pSlot->output = true;
+    nodesListMakeAppend(&pDesc->pSlots, (SNode*)pSlot);
+    pDesc->totalRowSize += pSlot->dataType.bytes;
+  }
+  pDesc->outputRowSize = pDesc->totalRowSize;
+
+  SWindowPhysiNode* pWindow = &pIntervalNode->window;
+  pWindow->node.pOutputDataBlockDesc = pDesc;
+  pWindow->node.inputTsOrder = order;
+  pWindow->node.outputTsOrder = order;
+  pWindow->pTspk = createColumn(0, TSDB_DATA_TYPE_TIMESTAMP);
+  nodesListMakeAppend(&pWindow->pFuncs, createTarget(0, createFunction("_wstart", NULL)));
+  const char* aggFuncs[] = {"count", "sum", "min", "max"};
+  for (int16_t i = 1; i < kNumOfFuncs; ++i) {
+    nodesListMakeAppend(&pWindow->pFuncs,
+                        createTarget(i, createFunction(aggFuncs[i - 1], createColumn(1, TSDB_DATA_TYPE_BIGINT))));
+  }
+
+  pIntervalNode->interval = interval;
+  pIntervalNode->sliding = interval;
+  pIntervalNode->offset = offset;
+  pIntervalNode->intervalUnit = 'a';
+  pIntervalNode->slidingUnit = 'a';
+  return pIntervalNode;
+}
+
+class IntervalTest : public ::testing::Test {
+ protected:
+  static void SetUpTestSuite() {
+    tstrncpy(tsTempDir, TD_TMP_DIR_PATH, PATH_MAX);
+    osUpdate();
+    fmFuncMgtInit();
+  }
+
+  // add the rows of ts from start with the step to a block of their own
+  void addBlock(int64_t start, int32_t rows, int64_t step) {
+    std::vector<int64_t> block;
+    for (int32_t i = 0; i < rows; ++i) {
+      block.push_back(start + i * step);
+    }
+    blocks.push_back(block);
+  }
+
+  // the windows of the rows, located by the window of each row one by one
+  SWinResMap expectedWindows(int64_t interval, int64_t offset) {
+    SWinResMap expected;
+    for (const auto& block : blocks) {
+      for (int64_t ts : block) {
+        int64_t  rem = (ts - offset) % interval;
+        int64_t  skey = ts - ((rem < 0) ? rem + interval : rem);
+        SWinRes& res = expected[skey];
+        res.count += 1;
+        res.sum += valOfTs(ts);
+        res.min = TMIN(res.min, valOfTs(ts));
+        res.max = TMAX(res.max, valOfTs(ts));
+      }
+    }
+    return expected;
+  }
+
+  // run the interval on the blocks in the order of the scan. The sorted tumbling windows are located arithmetically
+  // for the ascending scan, while the descending scan locates each window by searching the block as before
+  void run(int64_t interval, int64_t offset, EOrder order, SWinResMap* pResults) {
+    SExecTaskInfo* pTaskInfo = (SExecTaskInfo*)taosMemoryCalloc(1, sizeof(SExecTaskInfo));
+    pTaskInfo->id.str = taosStrdup("intervalTest");
+
+    STestScanInfo* pScanInfo = new STestScanInfo();
+    pScanInfo->blocks = blocks;
+    if (order == ORDER_DESC) {
+      std::reverse(pScanInfo->blocks.begin(), pScanInfo->blocks.end());
+      for (auto& block : pScanInfo->blocks) {
+        std::reverse(block.begin(), block.end());
+      }
+    }
+    pScanInfo->pRes = createDataBlock();
+    SColumnInfoData tsCol = createColumnInfoData(TSDB_DATA_TYPE_TIMESTAMP, sizeof(int64_t), 1);
+    SColumnInfoData valCol = createColumnInfoData(TSDB_DATA_TYPE_BIGINT, sizeof(int64_t), 2);
+    blockDataAppendColInfo(pScanInfo->pRes, &tsCol);
+    blockDataAppendColInfo(pScanInfo->pRes, &valCol);
+
+    SOperatorInfo* pScan = (SOperatorInfo*)taosMemoryCalloc(1, sizeof(SOperatorInfo));
+    setOperatorInfo(pScan, "TestTableScan", QUERY_NODE_PHYSICAL_PLAN_TABLE_SCAN, false, OP_NOT_OPENED, pScanInfo,
+                    pTaskInfo);
+    pScan->fpSet =
+        createOperatorFpSet(optrDummyOpenFn, testScanNext, NULL, destroyTestScanInfo, optrDefaultBufFn, NULL);
+
+    SIntervalPhysiNode* pIntervalNode = createIntervalNode(interval, offset, order);
+    SOperatorInfo*      pOperator = createIntervalOperatorInfo(pScan, pIntervalNode, pTaskInfo);
+    ASSERT_NE(pOperator, nullptr);
+
+    if (setjmp(pTaskInfo->env) == 0) {
+      for (SSDataBlock* pBlock = pOperator->fpSet.getNextFn(pOperator); pBlock != NULL;
+           pBlock = pOperator->fpSet.getNextFn(pOperator)) {
+        SColumnInfoData* pCols[kNumOfFuncs];
+        for (int32_t i = 0; i < kNumOfFuncs; ++i) {
+          pCols[i] = (SColumnInfoData*)taosArrayGet(pBlock->pDataBlock, i);
+        }
+        for (int32_t i = 0; i < pBlock->info.rows; ++i) {
+          int64_t skey = *(int64_t*)colDataGetData(pCols[0], i);
+          EXPECT_EQ(pResults->count(skey), 0) << "window " << skey << " returned twice";
+          SWinRes& res = (*pResults)[skey];
+          res.count = *(int64_t*)colDataGetData(pCols[1], i);
+          res.sum = *(int64_t*)colDataGetData(pCols[2], i);
+          res.min = *(int64_t*)colDataGetData(pCols[3], i);
+          res.max = *(int64_t*)colDataGetData(pCols[4], i);
+        }
+      }
+    }
+    EXPECT_EQ(pTaskInfo->code, TSDB_CODE_SUCCESS);
+
+    destroyOperator(pOperator);
+    nodesDestroyNode((SNode*)pIntervalNode);
+    taosMemoryFree(pTaskInfo->id.str);
+    taosMemoryFree(pTaskInfo);
+  }
+
+  // the windows of the ascending scan are the same as the ones of the descending scan, and of the rows one by one
+  void check(int64_t interval, int64_t offset) {
+    SWinResMap expected = expectedWindows(interval, offset);
+    SWinResMap ascResults;
+    SWinResMap descResults;
+    run(interval, offset, ORDER_ASC, &ascResults);
+    run(interval, offset, ORDER_DESC, &descResults);
+
+    ASSERT_EQ(ascResults.size(), descResults.size());
+    for (const auto& e : descResults) {
+      ASSERT_EQ(ascResults.count(e.first), 1) << "window " << e.first << " missing";
+      ASSERT_TRUE(ascResults[e.first] == e.second) << "window " << e.first;
+    }
+
+    ASSERT_EQ(ascResults.size(), expected.size());
+    for (const auto& e : expected) {
+      ASSERT_EQ(ascResults.count(e.first), 1) << "window " << e.first << " missing";
+      ASSERT_TRUE(ascResults[e.first] == e.second) << "window " << e.first;
+    }
+  }
+
+  std::vector<std::vector<int64_t>> blocks;
+};
+
+}  // namespace
+
+// many small windows in a block, e.g., millisecond data in 1 second windows
+TEST_F(IntervalTest, smallWindows) {
+  const int64_t start = 1700000000000L;
+  addBlock(start, 4096, 1);
+  addBlock(start + 4096, 4096, 3);
+  check(1000, 0);
+}
+
+// the windows are shifted by the offset
+TEST_F(IntervalTest, offset) {
+  const int64_t start = 1700000000000L;
+  addBlock(start, 4096, 7);
+  addBlock(start + 4096 * 7, 4096, 7);
+  check(1000, 300);
+  check(1000, 999);
+}
+
+// the window of the last rows of a block goes on in the next blocks
+TEST_F(IntervalTest, windowsSpanBlocks) {
+  const int64_t start = 1700000000000L;
+  addBlock(start, 100, 1);
+  addBlock(start + 100, 100, 1);   // in the same window as the previous block
+  addBlock(start + 200, 4000, 1);  // ends the window of the previous blocks, and starts the next ones
+  addBlock(start + 5000, 1, 1);    // a block of one row
+  addBlock(start + 5001, 2000, 1);
+  check(1000, 0);
+  check(3000, 500);
+}
+
+// the windows without rows are skipped, both in a block and between the blocks
+TEST_F(IntervalTest, emptyGaps) {
+  const int64_t start = 1700000000000L;
+  addBlock(start, 1000, 10000);            // a row in every 10 windows
+  addBlock(start + 10000000L, 1000, 1);    // rows in the same window
+  addBlock(start + 900000000L, 100, 999);  // far away from the previous block
+  std::vector<int64_t> block;
+  for (int64_t i = 0; i < 1000; ++i) {
+    block.push_back(start + 1000000000L + i * i * 37);  // growing gaps
+  }
+  blocks.push_back(block);
+  check(1000, 0);
+  check(1000, 250);
+}
+
+// the windows of the rows before 1970 start at the timestamp of the window boundary below them
+TEST_F(IntervalTest, negativeTimestamps) {
+  addBlock(-5000123, 3000, 7);
+  addBlock(-5000123 + 3000 * 7, 1000, 3);
+  addBlock(-3000, 2000, 3);  // rows on both sides of 0, in windows crossing 0 if there is an offset
+  check(1000, 0);
+  check(1000, 400);
+}
+
+#pragma GCC diagnostic pop
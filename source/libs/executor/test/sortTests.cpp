@@ -193,8 +193,134 @@ int32_t docomp(const void* p1, const void* p2, void* param) {
 
   return 0;
 }
+
+typedef struct {
+  SSDataBlock* pBlock;
+  int32_t      numOfBlocks;
+  int32_t      rows;
+  uint64_t     seed;
+  int64_t      sum;
+  int64_t      numOfNull;
+} SSpillSortParam;
+
+SSDataBlock* getRandIntBlock(void* param) {
+  SSpillSortParam* p = (SSpillSortParam*)param;
+  if (--p->numOfBlocks < 0) {
+    return NULL;
+  }
+
+  blockDataCleanup(p->pBlock);
+  blockDataEnsureCapacity(p->pBlock, p->rows);
+
+  SColumnInfoData* pCol = (SColumnInfoData*)taosArrayGet(p->pBlock->pDataBlock, 0);
+  for (int32_t i = 0; i < p->rows; ++i) {
+    p->seed = p->seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    if ((p->seed >> 60) == 0) {
+      colDataSetNULL(pCol, i);
+      p->numOfNull += 1;
+    } else {
+      int32_t v = (int32_t)(p->seed >> 33) - (1 << 30);
+      colDataSetVal(pCol, i, (const char*)&v, false);
+      p->sum += v;
+    }
+  }
+
+  p->pBlock->info.rows = p->rows;
+  return p->pBlock;
+}
+
+// sort the rows of one source through the external sort buffer, and check the result is in order and complete
+void doSpillSortTest(int32_t numOfBlocks, int32_t rows, uint64_t seed, bool spill) {
+  SBlockOrderInfo oi = {0};
+  oi.order = TSDB_ORDER_ASC;
+  oi.slotId = 0;
+  oi.nullFirst = true;
+  SArray* orderInfo = taosArrayInit(1, sizeof(SBlockOrderInfo));
+  taosArrayPush(orderInfo, &oi);
+
+  SSpillSortParam param = {0};
+  param.pBlock = createDataBlock();
+  param.numOfBlocks = numOfBlocks;
+  param.rows = rows;
+  param.seed = seed;
+  SColumnInfoData colInfo = createColumnInfoData(TSDB_DATA_TYPE_INT, sizeof(int32_t), 1);
+  blockDataAppendColInfo(param.pBlock, &colInfo);
+
+  SSortHandle* phandle =
+      tsortCreateSortHandle(orderInfo, SORT_SINGLESOURCE_SORT, 1024, 5, NULL, "spill_sort_test", 0, 0, 0);
+  tsortSetFetchRawDataFp(phandle, getRandIntBlock, NULL, NULL);
+
+  SSortSource* ps = static_cast<SSortSource*>(taosMemoryCalloc(1, sizeof(SSortSource)));
+  ps->param = &param;
+  ps->onlyRef = true;
+  tsortAddSource(phandle, ps);
+
+  ASSERT_EQ(tsortOpen(phandle), 0);
+
+  int64_t numOfRows = 0;
+  int64_t numOfNull = 0;
+  int64_t sum = 0;
+  int32_t prev = INT32_MIN;
+  while (1) {
+    STupleHandle* pTupleHandle = tsortNextTuple(phandle);
+    if (pTupleHandle == NULL) {
+      break;
+    }
+
+    numOfRows += 1;
+    if (tsortIsNullVal(pTupleHandle, 0)) {
+      ASSERT_EQ(numOfNull + 1, numOfRows);  // null first
+      numOfNull += 1;
+      continue;
+    }
+
+    int32_t v = *(int32_t*)tsortGetValue(pTupleHandle, 0);
+    ASSERT_LE(prev, v);
+    prev = v;
+    sum += v;
+  }
+
+  ASSERT_EQ(numOfRows, (int64_t)numOfBlocks * rows);
+  ASSERT_EQ(numOfNull, param.numOfNull);
+  ASSERT_EQ(sum, param.sum);
+
+  SSortExecInfo info = tsortGetSortExecInfo(phandle);
+  ASSERT_EQ(info.sortMethod, spill ? SORT_SPILLED_MERGE_SORT_T : SORT_QSORT_T);
+
+  tsortDestroySortHandle(phandle);
+  taosArrayDestroy(orderInfo);
+  blockDataDestroy(param.pBlock);
+}
 }  // namespace
 
+// each spill of the sort buffer is split into chunks which are sorted by the shared worker pool
+TEST(testCase, parallel_run_sort_Test) {
+  tsNumOfCores = TMAX(tsNumOfCores, 8);
+  tstrncpy(tsTempDir, TD_TMP_DIR_PATH, PATH_MAX);
+  osUpdate();
+  doSpillSortTest(40, 50000, 1, true);
+  doSpillSortTest(3, 9000, 2, false);  // fits in the sort buffer, no run is generated
+}
+
+// sort handles of concurrent queries share the bounded worker pool
+TEST(testCase, concurrent_parallel_run_sort_Test) {
+  tsNumOfCores = TMAX(tsNumOfCores, 8);
+  tstrncpy(tsTempDir, TD_TMP_DIR_PATH, PATH_MAX);
+  osUpdate();
+
+  TdThread threads[6];
+  for (int32_t i = 0; i < tListLen(threads); ++i) {
+    auto fn = [](void* param) -> void* {
+      doSpillSortTest(30, 50000, (uint64_t)(intptr_t)param, true);
+      return NULL;
+    };
+    ASSERT_EQ(taosThreadCreate(&threads[i], NULL, fn, (void*)(intptr_t)(i + 10)), 0);
+  }
+  for (int32_t i = 0; i < tListLen(threads); ++i) {
+    taosThreadJoin(threads[i], NULL);
+  }
+}
+
 #if 0
 TEST(testCase, inMem_sort_Test) {
   SBlockOrderInfo oi = {0};
@@ -46,6 +46,10 @@ typedef struct SBuiltinFuncDefinition {
   const char*                pMergeFunc;
   FCreateMergeFuncParameters createMergeParaFuc;
   FEstimateReturnRows        estimateReturnRowsFunc;
+  FExecCleanUp               cleanupFunc;
+  int32_t                    legacyResSize;  // the intermediate buffer saved by the older versions, 0 if unchanged
+  FExecDecodeLegacy          decodeLegacyFunc;
+  FExecProcessBatch          processBatchFunc;
 } SBuiltinFuncDefinition;
 
 extern const SBuiltinFuncDefinition funcMgtBuiltins[];
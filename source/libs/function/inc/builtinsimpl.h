@@ -23,6 +23,8 @@ extern "C" {
 #include "function.h"
 #include "functionMgt.h"
 
+#define HLL_LEGACY_INFO_SIZE (sizeof(uint64_t) * 2 + (1 << 14))  // the older versions kept one byte for each register
+
 typedef struct SSumRes {
   union {
     int64_t  isum;
@@ -46,6 +48,7 @@ typedef struct SMinmaxResInfo {
 } SMinmaxResInfo;
 
 int32_t doMinMaxHelper(SqlFunctionCtx* pCtx, int32_t isMinFunc, int32_t* nElems);
+int32_t doMinMaxBatchHelper(SqlFunctionCtx* pCtx, const SFuncRowSegment* pSegs, int32_t numOfSegs, int32_t isMinFunc);
 
 int32_t     saveTupleData(SqlFunctionCtx* pCtx, int32_t rowIndex, const SSDataBlock* pSrcBlock, STuplePos* pPos);
 int32_t     updateTupleData(SqlFunctionCtx* pCtx, int32_t rowIndex, const SSDataBlock* pSrcBlock, STuplePos* pPos);
@@ -54,16 +57,19 @@ const char* loadTupleData(SqlFunctionCtx* pCtx, const STuplePos* pPos);
 bool    functionSetup(SqlFunctionCtx* pCtx, SResultRowEntryInfo* pResultInfo);
 int32_t functionFinalize(SqlFunctionCtx* pCtx, SSDataBlock* pBlock);
 int32_t functionFinalizeWithResultBuf(SqlFunctionCtx* pCtx, SSDataBlock* pBlock, char* finalResult);
+int32_t functionProcessSegments(SqlFunctionCtx* pCtx, const SFuncRowSegment* pSegs, int32_t numOfSegs, FExecProcess fp);
 int32_t combineFunction(SqlFunctionCtx* pDestCtx, SqlFunctionCtx* pSourceCtx);
 
 EFuncDataRequired countDataRequired(SFunctionNode* pFunc, STimeWindow* pTimeWindow);
 bool              getCountFuncEnv(struct SFunctionNode* pFunc, SFuncExecEnv* pEnv);
 int32_t           countFunction(SqlFunctionCtx* pCtx);
+int32_t           countFunctionBatch(SqlFunctionCtx* pCtx, const SFuncRowSegment* pSegs, int32_t numOfSegs);
 int32_t           countInvertFunction(SqlFunctionCtx* pCtx);
 
 EFuncDataRequired statisDataRequired(SFunctionNode* pFunc, STimeWindow* pTimeWindow);
 bool              getSumFuncEnv(struct SFunctionNode* pFunc, SFuncExecEnv* pEnv);
 int32_t           sumFunction(SqlFunctionCtx* pCtx);
+int32_t           sumFunctionBatch(SqlFunctionCtx* pCtx, const SFuncRowSegment* pSegs, int32_t numOfSegs);
 int32_t           sumInvertFunction(SqlFunctionCtx* pCtx);
 int32_t           sumCombine(SqlFunctionCtx* pDestCtx, SqlFunctionCtx* pSourceCtx);
 
@@ -71,6 +77,8 @@ bool    minmaxFunctionSetup(SqlFunctionCtx* pCtx, SResultRowEntryInfo* pResultIn
 bool    getMinmaxFuncEnv(struct SFunctionNode* pFunc, SFuncExecEnv* pEnv);
 int32_t minFunction(SqlFunctionCtx* pCtx);
 int32_t maxFunction(SqlFunctionCtx* pCtx);
+int32_t minFunctionBatch(SqlFunctionCtx* pCtx, const SFuncRowSegment* pSegs, int32_t numOfSegs);
+int32_t maxFunctionBatch(SqlFunctionCtx* pCtx, const SFuncRowSegment* pSegs, int32_t numOfSegs);
 int32_t minmaxFunctionFinalize(SqlFunctionCtx* pCtx, SSDataBlock* pBlock);
 int32_t minCombine(SqlFunctionCtx* pDestCtx, SqlFunctionCtx* pSourceCtx);
 int32_t maxCombine(SqlFunctionCtx* pDestCtx, SqlFunctionCtx* pSourceCtx);
@@ -78,6 +86,7 @@ int32_t maxCombine(SqlFunctionCtx* pDestCtx, SqlFunctionCtx* pSourceCtx);
 bool    getAvgFuncEnv(struct SFunctionNode* pFunc, SFuncExecEnv* pEnv);
 bool    avgFunctionSetup(SqlFunctionCtx* pCtx, SResultRowEntryInfo* pResultInfo);
 int32_t avgFunction(SqlFunctionCtx* pCtx);
+int32_t avgFunctionBatch(SqlFunctionCtx* pCtx, const SFuncRowSegment* pSegs, int32_t numOfSegs);
 int32_t avgFunctionMerge(SqlFunctionCtx* pCtx);
 int32_t avgFinalize(SqlFunctionCtx* pCtx, SSDataBlock* pBlock);
 int32_t avgPartialFinalize(SqlFunctionCtx* pCtx, SSDataBlock* pBlock);
@@ -105,7 +114,11 @@ int32_t leastSQRCombine(SqlFunctionCtx* pDestCtx, SqlFunctionCtx* pSourceCtx);
 bool    getPercentileFuncEnv(struct SFunctionNode* pFunc, SFuncExecEnv* pEnv);
 bool    percentileFunctionSetup(SqlFunctionCtx* pCtx, SResultRowEntryInfo* pResultInfo);
 int32_t percentileFunction(SqlFunctionCtx* pCtx);
+int32_t percentileFunctionMerge(SqlFunctionCtx* pCtx);
 int32_t percentileFinalize(SqlFunctionCtx* pCtx, SSDataBlock* pBlock);
+int32_t percentilePartialFinalize(SqlFunctionCtx* pCtx, SSDataBlock* pBlock);
+int32_t percentileCombine(SqlFunctionCtx* pDestCtx, SqlFunctionCtx* pSourceCtx);
+int32_t getPercentileMaxSize();
 
 bool    getApercentileFuncEnv(struct SFunctionNode* pFunc, SFuncExecEnv* pEnv);
 bool    apercentileFunctionSetup(SqlFunctionCtx* pCtx, SResultRowEntryInfo* pResultInfo);
@@ -190,6 +203,9 @@ int32_t hllFinalize(SqlFunctionCtx* pCtx, SSDataBlock* pBlock);
 int32_t hllPartialFinalize(SqlFunctionCtx* pCtx, SSDataBlock* pBlock);
 int32_t getHLLInfoSize();
 int32_t hllCombine(SqlFunctionCtx* pDestCtx, SqlFunctionCtx* pSourceCtx);
+bool    hllFunctionSetup(SqlFunctionCtx* pCtx, SResultRowEntryInfo* pResultInfo);
+void    hllCleanup(SResultRowEntryInfo* pResultInfo);
+int32_t hllDecodeLegacyInfo(const char* pLegacy, char* pBuf);
 
 bool    getStateFuncEnv(struct SFunctionNode* pFunc, SFuncExecEnv* pEnv);
 bool    stateFunctionSetup(SqlFunctionCtx* pCtx, SResultRowEntryInfo* pResultInfo);
@@ -550,6 +550,40 @@ static int32_t translatePercentile(SFunctionNode* pFunc, char* pErrBuf, int32_t
   return TSDB_CODE_SUCCESS;
 }
 
+static int32_t translatePercentilePartial(SFunctionNode* pFunc, char* pErrBuf, int32_t len) {
+  int32_t code = translatePercentile(pFunc, pErrBuf, len);
+  if (TSDB_CODE_SUCCESS == code) {
+    pFunc->node.resType =
+        (SDataType){.bytes = getPercentileMaxSize() + VARSTR_HEADER_SIZE, .type = TSDB_DATA_TYPE_BINARY};
+  }
+  return code;
+}
+
+static int32_t translatePercentileMerge(SFunctionNode* pFunc, char* pErrBuf, int32_t len) {
+  // original percent params are reserved
+  int32_t numOfParams = LIST_LENGTH(pFunc->pParameterList);
+  if (numOfParams < 2 || numOfParams > 11) {
+    return invaildFuncParaNumErrMsg(pErrBuf, len, pFunc->functionName);
+  }
+
+  if (TSDB_DATA_TYPE_BINARY != ((SExprNode*)nodesListGetNode(pFunc->pParameterList, 0))->resType.type) {
+    return invaildFuncParaTypeErrMsg(pErrBuf, len, pFunc->functionName);
+  }
+
+  for (int32_t i = 1; i < numOfParams; ++i) {
+    if (!IS_NUMERIC_TYPE(((SExprNode*)nodesListGetNode(pFunc->pParameterList, i))->resType.type)) {
+      return invaildFuncParaTypeErrMsg(pErrBuf, len, pFunc->functionName);
+    }
+  }
+
+  if (numOfParams > 2) {
+    pFunc->node.resType = (SDataType){.bytes = 512, .type = TSDB_DATA_TYPE_VARCHAR};
+  } else {
+    pFunc->node.resType = (SDataType){.bytes = tDataTypes[TSDB_DATA_TYPE_DOUBLE].bytes, .type = TSDB_DATA_TYPE_DOUBLE};
+  }
+  return TSDB_CODE_SUCCESS;
+}
+
 static bool validateApercentileAlgo(const SValueNode* pVal) {
   if (TSDB_DATA_TYPE_BINARY != pVal->node.resType.type) {
     return false;
@@ -732,6 +766,14 @@ int32_t apercentileCreateMergeParam(SNodeList* pRawParameters, SNode* pPartialRe
   return reserveFirstMergeParam(pRawParameters, pPartialRes, pParameters);
 }
 
+int32_t percentileCreateMergeParam(SNodeList* pRawParameters, SNode* pPartialRes, SNodeList** pParameters) {
+  int32_t code = nodesListMakeAppend(pParameters, pPartialRes);
+  for (int32_t i = 1; TSDB_CODE_SUCCESS == code && i < LIST_LENGTH(pRawParameters); ++i) {
+    code = nodesListStrictAppend(*pParameters, nodesCloneNode(nodesListGetNode(pRawParameters, i)));
+  }
+  return code;
+}
+
 static int32_t translateSpread(SFunctionNode* pFunc, char* pErrBuf, int32_t len) {
   if (1 != LIST_LENGTH(pFunc->pParameterList)) {
     return invaildFuncParaNumErrMsg(pErrBuf, len, pFunc->functionName);
@@ -1241,7 +1283,7 @@ static int32_t translateHLLImpl(SFunctionNode* pFunc, char* pErrBuf, int32_t len
 
   if (isPartial) {
     pFunc->node.resType =
-        (SDataType){.bytes = getHistogramInfoSize() + VARSTR_HEADER_SIZE, .type = TSDB_DATA_TYPE_BINARY};
+        (SDataType){.bytes = getHLLInfoSize() + VARSTR_HEADER_SIZE, .type = TSDB_DATA_TYPE_BINARY};
   } else {
     pFunc->node.resType = (SDataType){.bytes = tDataTypes[TSDB_DATA_TYPE_BIGINT].bytes, .type = TSDB_DATA_TYPE_BIGINT};
   }
@@ -2255,6 +2297,7 @@ const SBuiltinFuncDefinition funcMgtBuiltins[] = {
     .getEnvFunc   = getCountFuncEnv,
     .initFunc     = functionSetup,
     .processFunc  = countFunction,
+    .processBatchFunc = countFunctionBatch,
     .sprocessFunc = countScalarFunction,
     .finalizeFunc = functionFinalize,
     .invertFunc   = countInvertFunction,
@@ -2271,6 +2314,7 @@ const SBuiltinFuncDefinition funcMgtBuiltins[] = {
     .getEnvFunc   = getSumFuncEnv,
     .initFunc     = functionSetup,
     .processFunc  = sumFunction,
+    .processBatchFunc = sumFunctionBatch,
     .sprocessFunc = sumScalarFunction,
     .finalizeFunc = functionFinalize,
     .invertFunc   = sumInvertFunction,
@@ -2287,6 +2331,7 @@ const SBuiltinFuncDefinition funcMgtBuiltins[] = {
     .getEnvFunc   = getMinmaxFuncEnv,
     .initFunc     = minmaxFunctionSetup,
     .processFunc  = minFunction,
+    .processBatchFunc = minFunctionBatch,
     .sprocessFunc = minScalarFunction,
     .finalizeFunc = minmaxFunctionFinalize,
     .combineFunc  = minCombine,
@@ -2302,6 +2347,7 @@ const SBuiltinFuncDefinition funcMgtBuiltins[] = {
     .getEnvFunc   = getMinmaxFuncEnv,
     .initFunc     = minmaxFunctionSetup,
     .processFunc  = maxFunction,
+    .processBatchFunc = maxFunctionBatch,
     .sprocessFunc = maxScalarFunction,
     .finalizeFunc = minmaxFunctionFinalize,
     .combineFunc  = maxCombine,
@@ -2369,6 +2415,7 @@ const SBuiltinFuncDefinition funcMgtBuiltins[] = {
     .getEnvFunc   = getAvgFuncEnv,
     .initFunc     = avgFunctionSetup,
     .processFunc  = avgFunction,
+    .processBatchFunc = avgFunctionBatch,
     .sprocessFunc = avgScalarFunction,
     .finalizeFunc = avgFinalize,
     .invertFunc   = avgInvertFunction,
@@ -2385,6 +2432,7 @@ const SBuiltinFuncDefinition funcMgtBuiltins[] = {
     .getEnvFunc   = getAvgFuncEnv,
     .initFunc     = avgFunctionSetup,
     .processFunc  = avgFunction,
+    .processBatchFunc = avgFunctionBatch,
     .finalizeFunc = avgPartialFinalize,
     .invertFunc   = avgInvertFunction,
     .combineFunc  = avgCombine,
@@ -2404,16 +2452,18 @@ const SBuiltinFuncDefinition funcMgtBuiltins[] = {
   {
     .name = "percentile",
     .type = FUNCTION_TYPE_PERCENTILE,
-    .classification = FUNC_MGT_AGG_FUNC | FUNC_MGT_REPEAT_SCAN_FUNC | FUNC_MGT_SPECIAL_DATA_REQUIRED | FUNC_MGT_FORBID_STREAM_FUNC,
+    .classification = FUNC_MGT_AGG_FUNC | FUNC_MGT_FORBID_STREAM_FUNC,
     .translateFunc = translatePercentile,
-    .dataRequiredFunc = statisDataRequired,
     .getEnvFunc   = getPercentileFuncEnv,
     .initFunc     = percentileFunctionSetup,
     .processFunc  = percentileFunction,
     .sprocessFunc = percentileScalarFunction,
     .finalizeFunc = percentileFinalize,
     .invertFunc   = NULL,
-    .combineFunc  = NULL,
+    .combineFunc  = percentileCombine,
+    .pPartialFunc = "_percentile_partial",
+    .pMergeFunc   = "_percentile_merge",
+    .createMergeParaFuc = percentileCreateMergeParam
   },
   {
     .name = "apercentile",
@@ -2806,12 +2856,15 @@ const SBuiltinFuncDefinition funcMgtBuiltins[] = {
     .classification = FUNC_MGT_AGG_FUNC,
     .translateFunc = translateHLL,
     .getEnvFunc   = getHLLFuncEnv,
-    .initFunc     = functionSetup,
+    .initFunc     = hllFunctionSetup,
     .processFunc  = hllFunction,
     .sprocessFunc = hllScalarFunction,
     .finalizeFunc = hllFinalize,
     .invertFunc   = NULL,
     .combineFunc  = hllCombine,
+    .cleanupFunc  = hllCleanup,
+    .legacyResSize = HLL_LEGACY_INFO_SIZE,
+    .decodeLegacyFunc = hllDecodeLegacyInfo,
     .pPartialFunc = "_hyperloglog_partial",
     .pMergeFunc   = "_hyperloglog_merge"
   },
@@ -2821,11 +2874,14 @@ const SBuiltinFuncDefinition funcMgtBuiltins[] = {
     .classification = FUNC_MGT_AGG_FUNC,
     .translateFunc = translateHLLPartial,
     .getEnvFunc   = getHLLFuncEnv,
-    .initFunc     = functionSetup,
+    .initFunc     = hllFunctionSetup,
     .processFunc  = hllFunction,
     .finalizeFunc = hllPartialFinalize,
     .invertFunc   = NULL,
     .combineFunc  = hllCombine,
+    .cleanupFunc  = hllCleanup,
+    .legacyResSize = HLL_LEGACY_INFO_SIZE,
+    .decodeLegacyFunc = hllDecodeLegacyInfo,
   },
   {
     .name = "_hyperloglog_merge",
@@ -2833,11 +2889,14 @@ const SBuiltinFuncDefinition funcMgtBuiltins[] = {
     .classification = FUNC_MGT_AGG_FUNC,
     .translateFunc = translateHLLMerge,
     .getEnvFunc   = getHLLFuncEnv,
-    .initFunc     = functionSetup,
+    .initFunc     = hllFunctionSetup,
     .processFunc  = hllFunctionMerge,
     .finalizeFunc = hllFinalize,
     .invertFunc   = NULL,
     .combineFunc  = hllCombine,
+    .cleanupFunc  = hllCleanup,
+    .legacyResSize = HLL_LEGACY_INFO_SIZE,
+    .decodeLegacyFunc = hllDecodeLegacyInfo,
   },
   {
     .name = "diff",
@@ -3535,6 +3594,30 @@ const SBuiltinFuncDefinition funcMgtBuiltins[] = {
     .sprocessFunc = containsProperlyFunction,
     .finalizeFunc = NULL
   },
+  {
+    .name = "_percentile_partial",
+    .type = FUNCTION_TYPE_PERCENTILE_PARTIAL,
+    .classification = FUNC_MGT_AGG_FUNC | FUNC_MGT_FORBID_STREAM_FUNC,
+    .translateFunc = translatePercentilePartial,
+    .getEnvFunc   = getPercentileFuncEnv,
+    .initFunc     = percentileFunctionSetup,
+    .processFunc  = percentileFunction,
+    .finalizeFunc = percentilePartialFinalize,
+    .invertFunc   = NULL,
+    .combineFunc  = percentileCombine,
+  },
+  {
+    .name = "_percentile_merge",
+    .type = FUNCTION_TYPE_PERCENTILE_MERGE,
+    .classification = FUNC_MGT_AGG_FUNC | FUNC_MGT_FORBID_STREAM_FUNC,
+    .translateFunc = translatePercentileMerge,
+    .getEnvFunc   = getPercentileFuncEnv,
+    .initFunc     = percentileFunctionSetup,
+    .processFunc  = percentileFunctionMerge,
+    .finalizeFunc = percentileFinalize,
+    .invertFunc   = NULL,
+    .combineFunc  = percentileCombine,
+  },
 };
 // clang-format on
 
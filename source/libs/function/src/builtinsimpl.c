@@ -24,19 +24,33 @@
 #include "tfunctionInt.h"
 #include "tglobal.h"
 #include "thistogram.h"
-#include "tpercentile.h"
 
 #define HISTOGRAM_MAX_BINS_NUM 1000
 #define MAVG_MAX_POINTS_NUM    1000
 #define TAIL_MAX_POINTS_NUM    100
 #define TAIL_MAX_OFFSET        100
 
+#define PERCENTILE_MAX_PERCENT_NUM 10
+// values of a group kept as they are in the room of its t-digest, the result is exact up to this number of values
+#define PERCENTILE_EXACT_MAX_NUM ((int32_t)(TDIGEST_SIZE(tsPercentileCompression) / sizeof(double)))
+
 #define HLL_BUCKET_BITS 14  // The bits of the bucket
 #define HLL_DATA_BITS   (64 - HLL_BUCKET_BITS)
 #define HLL_BUCKETS     (1 << HLL_BUCKET_BITS)
 #define HLL_BUCKET_MASK (HLL_BUCKETS - 1)
 #define HLL_ALPHA_INF   0.721347520444481703680  // constant for 0.5/ln(2)
 
+// the registers are packed with 6 bits each, which is enough for the max count HLL_DATA_BITS + 1
+#define HLL_REGISTER_BITS 6
+#define HLL_REGISTER_MAX  ((1 << HLL_REGISTER_BITS) - 1)
+#define HLL_DENSE_BYTES   (HLL_BUCKETS * HLL_REGISTER_BITS / 8)
+
+// the format of the intermediate result
+#define HLL_FMT_DENSE  0
+#define HLL_FMT_SPARSE 1
+#define HLL_SPARSE_MAX (HLL_DENSE_BYTES / sizeof(uint32_t))  // switch to dense beyond it
+#define HLL_SPARSE_ROW_MAX 256  // the sparse registers kept in a row without the room for the dense ones
+
 // typedef struct SMinmaxResInfo {
 //   bool      assign;  // assign the first value or not
 //   int64_t   v;
@@ -86,13 +100,13 @@ typedef struct SLeastSQRInfo {
   int64_t num;
 } SLeastSQRInfo;
 
+// The values of a group are kept as they are in the result row while they fit in the room of a t-digest, and are moved
+// into the t-digest after that. The row stays bounded, and is the partial result merged from the vnodes.
 typedef struct SPercentileInfo {
-  double      result;
-  tMemBucket* pMemBucket;
-  int32_t     stage;
-  double      minval;
-  double      maxval;
-  int64_t     numOfElems;
+  double  result;
+  int64_t numOfElems;
+  bool    sketch;  // the values are in the t-digest
+  double  buf[];   // the values, or the t-digest
 } SPercentileInfo;
 
 typedef struct SAPercentileInfo {
@@ -159,12 +173,23 @@ typedef struct SHistoFuncInfo {
 
 typedef enum { UNKNOWN_BIN = 0, USER_INPUT_BIN, LINEAR_BIN, LOG_BIN } EHistoBinType;
 
+// Only the rows of the stream states, which are saved as they are, have the room for the packed registers. The other
+// rows keep up to HLL_SPARSE_ROW_MAX sparse registers, and the packed ones are allocated out of the row beyond that.
 typedef struct SHLLFuncInfo {
   uint64_t result;
   uint64_t totalCount;
-  uint8_t  buckets[HLL_BUCKETS];
+  bool     dense;        // the registers are packed, otherwise the non-zero ones are kept in sparse
+  int32_t  numOfSparse;
+  int32_t  maxSparse;    // HLL_SPARSE_MAX if the row has the room for the packed registers, HLL_SPARSE_ROW_MAX if not
+  uint8_t* pBuckets;     // the packed registers out of the row, NULL if they are kept in buckets
+  union {
+    uint32_t sparse[HLL_SPARSE_MAX];        // (index << HLL_REGISTER_BITS) | count, in the order of the index
+    uint8_t  buckets[HLL_DENSE_BYTES + 1];  // the last byte is padding for the register across the end
+  };
 } SHLLInfo;
 
+#define HLL_ROW_SIZE (offsetof(SHLLInfo, sparse) + HLL_SPARSE_ROW_MAX * sizeof(uint32_t))
+
 typedef struct SStateInfo {
   union {
     int64_t count;
@@ -463,6 +488,26 @@ int32_t firstCombine(SqlFunctionCtx* pDestCtx, SqlFunctionCtx* pSourceCtx) {
   return TSDB_CODE_SUCCESS;
 }
 
+int32_t functionProcessSegments(SqlFunctionCtx* pCtx, const SFuncRowSegment* pSegs, int32_t numOfSegs,
+                                FExecProcess fp) {
+  int32_t              code = TSDB_CODE_SUCCESS;
+  SResultRowEntryInfo* pResInfo = pCtx->resultInfo;
+  int32_t              startRowIndex = pCtx->input.startRowIndex;
+  int64_t              numOfRows = pCtx->input.numOfRows;
+
+  for (int32_t s = 0; s < numOfSegs && code == TSDB_CODE_SUCCESS; ++s) {
+    pCtx->resultInfo = pSegs[s].pResInfo;
+    pCtx->input.startRowIndex = pSegs[s].startRowIndex;
+    pCtx->input.numOfRows = pSegs[s].numOfRows;
+    code = fp(pCtx);
+  }
+
+  pCtx->resultInfo = pResInfo;
+  pCtx->input.startRowIndex = startRowIndex;
+  pCtx->input.numOfRows = numOfRows;
+  return code;
+}
+
 int32_t functionFinalizeWithResultBuf(SqlFunctionCtx* pCtx, SSDataBlock* pBlock, char* finalResult) {
   int32_t          slotId = pCtx->pExpr->base.resSchema.slotId;
   SColumnInfoData* pCol = taosArrayGet(pBlock->pDataBlock, slotId);
@@ -549,6 +594,40 @@ int32_t countFunction(SqlFunctionCtx* pCtx) {
   return TSDB_CODE_SUCCESS;
 }
 
+int32_t countFunctionBatch(SqlFunctionCtx* pCtx, const SFuncRowSegment* pSegs, int32_t numOfSegs) {
+  SInputColumnInfoData* pInput = &pCtx->input;
+  SColumnInfoData*      pInputCol = pInput->pData[0];
+  bool                  isNullType = IS_NULL_TYPE(pInputCol->info.type);
+
+  for (int32_t s = 0; s < numOfSegs; ++s) {
+    SResultRowEntryInfo* pResInfo = pSegs[s].pResInfo;
+    int64_t*             buf = GET_ROWCELL_INTERBUF(pResInfo);
+
+    // select count(NULL) returns 0
+    if (!isNullType) {
+      int32_t start = pSegs[s].startRowIndex;
+      int64_t numOfElem = pSegs[s].numOfRows;
+      if (pInputCol->hasNull) {
+        numOfElem = 0;
+        for (int32_t i = start; i < start + pSegs[s].numOfRows; ++i) {
+          if (!colDataIsNull(pInputCol, pInput->totalRows, i, NULL)) {
+            numOfElem += 1;
+          }
+        }
+      }
+      *buf += numOfElem;
+    }
+
+    if (tsCountAlwaysReturnValue) {
+      pResInfo->numOfRes = 1;
+    } else {
+      SET_VAL(pResInfo, *buf, 1);
+    }
+  }
+
+  return TSDB_CODE_SUCCESS;
+}
+
 int32_t countInvertFunction(SqlFunctionCtx* pCtx) {
   int64_t numOfElem = getNumOfElems(pCtx);
 
@@ -642,6 +721,64 @@ _sum_over:
   return TSDB_CODE_SUCCESS;
 }
 
+#define LIST_ADD_SEGMENTS(_res, _t)                                                                  \
+  do {                                                                                               \
+    for (int32_t s = 0; s < numOfSegs; ++s) {                                                        \
+      SSumRes* pSumRes = GET_ROWCELL_INTERBUF(pSegs[s].pResInfo);                                    \
+      int32_t  numOfElem = 0;                                                                        \
+      pSumRes->type = type;                                                                          \
+      LIST_ADD_N(pSumRes->_res, pCol, pSegs[s].startRowIndex, pSegs[s].numOfRows, _t, numOfElem);    \
+      if (IS_FLOAT_TYPE(type) && (isinf(pSumRes->dsum) || isnan(pSumRes->dsum))) {                   \
+        numOfElem = 0;                                                                               \
+      }                                                                                              \
+      SET_VAL(pSegs[s].pResInfo, numOfElem, 1);                                                      \
+    }                                                                                                \
+  } while (0)
+
+int32_t sumFunctionBatch(SqlFunctionCtx* pCtx, const SFuncRowSegment* pSegs, int32_t numOfSegs) {
+  SColumnInfoData* pCol = pCtx->input.pData[0];
+  int32_t          type = pCol->info.type;
+
+  // the type is dispatched once for all the segments
+  switch (type) {
+    case TSDB_DATA_TYPE_BOOL:
+    case TSDB_DATA_TYPE_TINYINT:
+      LIST_ADD_SEGMENTS(isum, int8_t);
+      break;
+    case TSDB_DATA_TYPE_SMALLINT:
+      LIST_ADD_SEGMENTS(isum, int16_t);
+      break;
+    case TSDB_DATA_TYPE_INT:
+      LIST_ADD_SEGMENTS(isum, int32_t);
+      break;
+    case TSDB_DATA_TYPE_BIGINT:
+      LIST_ADD_SEGMENTS(isum, int64_t);
+      break;
+    case TSDB_DATA_TYPE_UTINYINT:
+      LIST_ADD_SEGMENTS(usum, uint8_t);
+      break;
+    case TSDB_DATA_TYPE_USMALLINT:
+      LIST_ADD_SEGMENTS(usum, uint16_t);
+      break;
+    case TSDB_DATA_TYPE_UINT:
+      LIST_ADD_SEGMENTS(usum, uint32_t);
+      break;
+    case TSDB_DATA_TYPE_UBIGINT:
+      LIST_ADD_SEGMENTS(usum, uint64_t);
+      break;
+    case TSDB_DATA_TYPE_FLOAT:
+      LIST_ADD_SEGMENTS(dsum, float);
+      break;
+    case TSDB_DATA_TYPE_DOUBLE:
+      LIST_ADD_SEGMENTS(dsum, double);
+      break;
+    default:
+      return functionProcessSegments(pCtx, pSegs, numOfSegs, sumFunction);
+  }
+
+  return TSDB_CODE_SUCCESS;
+}
+
 int32_t sumInvertFunction(SqlFunctionCtx* pCtx) {
   int32_t numOfElem = 0;
 
@@ -768,6 +905,14 @@ int32_t maxFunction(SqlFunctionCtx* pCtx) {
   return TSDB_CODE_SUCCESS;
 }
 
+int32_t minFunctionBatch(SqlFunctionCtx* pCtx, const SFuncRowSegment* pSegs, int32_t numOfSegs) {
+  return doMinMaxBatchHelper(pCtx, pSegs, numOfSegs, 1);
+}
+
+int32_t maxFunctionBatch(SqlFunctionCtx* pCtx, const SFuncRowSegment* pSegs, int32_t numOfSegs) {
+  return doMinMaxBatchHelper(pCtx, pSegs, numOfSegs, 0);
+}
+
 static int32_t setNullSelectivityValue(SqlFunctionCtx* pCtx, SSDataBlock* pBlock, int32_t rowIndex);
 static int32_t setSelectivityValue(SqlFunctionCtx* pCtx, SSDataBlock* pBlock, const STuplePos* pTuplePos,
                                    int32_t rowIndex);
@@ -1606,174 +1751,273 @@ int32_t leastSQRCombine(SqlFunctionCtx* pDestCtx, SqlFunctionCtx* pSourceCtx) {
 }
 
 bool getPercentileFuncEnv(SFunctionNode* pFunc, SFuncExecEnv* pEnv) {
-  pEnv->calcMemSize = sizeof(SPercentileInfo);
+  pEnv->calcMemSize = (int32_t)(sizeof(SPercentileInfo) + TDIGEST_SIZE(tsPercentileCompression));
   return true;
 }
 
+// | result | numOfElems | sketch | the values, or the t-digest of any allowed compression |
+int32_t getPercentileMaxSize() {
+  return (int32_t)(sizeof(SPercentileInfo) + TDIGEST_SIZE(TSDB_MAX_PERCENTILE_COMPRESSION));
+}
+
 bool percentileFunctionSetup(SqlFunctionCtx* pCtx, SResultRowEntryInfo* pResultInfo) {
   if (!functionSetup(pCtx, pResultInfo)) {
     return false;
   }
 
-  // in the first round, get the min-max value of all involved data
   SPercentileInfo* pInfo = GET_ROWCELL_INTERBUF(pResultInfo);
-  SET_DOUBLE_VAL(&pInfo->minval, DBL_MAX);
-  SET_DOUBLE_VAL(&pInfo->maxval, -DBL_MAX);
   pInfo->numOfElems = 0;
+  pInfo->sketch = false;
 
   return true;
 }
 
-int32_t percentileFunction(SqlFunctionCtx* pCtx) {
-  int32_t              numOfElems = 0;
-  SResultRowEntryInfo* pResInfo = GET_RES_INFO(pCtx);
+// The result row may be moved with its page, so the t-digest is filled again every time it is used. A t-digest comes
+// with its own compression, which may differ from the local one when it is the partial result of another dnode.
+static TDigest* percentileFillTDigest(SPercentileInfo* pInfo) {
+  TDigest* pTDigest = (TDigest*)pInfo->buf;
+  tdigestAutoFill(pTDigest, (int32_t)pTDigest->compression);
+  return pTDigest;
+}
 
-  SInputColumnInfoData* pInput = &pCtx->input;
-  SColumnDataAgg*       pAgg = pInput->pColumnDataAgg[0];
+// move the values kept as they are into the t-digest that takes their room
+static int32_t percentileToSketch(SPercentileInfo* pInfo) {
+  int32_t num = (int32_t)pInfo->numOfElems;
+  double* pVal = NULL;
+  if (num > 0) {
+    pVal = taosMemoryMalloc(num * sizeof(double));
+    if (pVal == NULL) {
+      return TSDB_CODE_OUT_OF_MEMORY;
+    }
+    memcpy(pVal, pInfo->buf, num * sizeof(double));
+  }
 
-  SColumnInfoData* pCol = pInput->pData[0];
-  int32_t          type = pCol->info.type;
+  TDigest* pTDigest = tdigestNewFrom(pInfo->buf, tsPercentileCompression);
+  for (int32_t i = 0; i < num; ++i) {
+    tdigestAdd(pTDigest, pVal[i], 1);
+  }
 
-  SPercentileInfo* pInfo = GET_ROWCELL_INTERBUF(pResInfo);
-  if (pCtx->scanFlag == MAIN_SCAN && pInfo->stage == 0) {
-    pInfo->stage += 1;
+  taosMemoryFree(pVal);
+  pInfo->sketch = true;
+  return TSDB_CODE_SUCCESS;
+}
 
-    // all data are null, set it completed
-    if (pInfo->numOfElems == 0) {
-      pResInfo->complete = true;
-      return TSDB_CODE_SUCCESS;
-    } else {
-      pInfo->pMemBucket = tMemBucketCreate(pCol->info.bytes, type, pInfo->minval, pInfo->maxval);
+static int32_t percentileAddValues(SPercentileInfo* pInfo, const double* pVal, int32_t num) {
+  if (!pInfo->sketch && pInfo->numOfElems + num <= PERCENTILE_EXACT_MAX_NUM) {
+    memcpy(pInfo->buf + pInfo->numOfElems, pVal, num * sizeof(double));
+    pInfo->numOfElems += num;
+    return TSDB_CODE_SUCCESS;
+  }
+
+  if (!pInfo->sketch) {
+    int32_t code = percentileToSketch(pInfo);
+    if (code != TSDB_CODE_SUCCESS) {
+      return code;
     }
   }
 
-  // the first stage, only acquire the min/max value
-  if (pInfo->stage == 0) {
-    if (pCtx->input.colDataSMAIsSet) {
-      double tmin = 0.0, tmax = 0.0;
-      if (IS_SIGNED_NUMERIC_TYPE(type)) {
-        tmin = (double)GET_INT64_VAL(&pAgg->min);
-        tmax = (double)GET_INT64_VAL(&pAgg->max);
-      } else if (IS_FLOAT_TYPE(type)) {
-        tmin = GET_DOUBLE_VAL(&pAgg->min);
-        tmax = GET_DOUBLE_VAL(&pAgg->max);
-      } else if (IS_UNSIGNED_NUMERIC_TYPE(type)) {
-        tmin = (double)GET_UINT64_VAL(&pAgg->min);
-        tmax = (double)GET_UINT64_VAL(&pAgg->max);
-      }
+  TDigest* pTDigest = percentileFillTDigest(pInfo);
+  for (int32_t i = 0; i < num; ++i) {
+    tdigestAdd(pTDigest, pVal[i], 1);
+  }
 
-      if (GET_DOUBLE_VAL(&pInfo->minval) > tmin) {
-        SET_DOUBLE_VAL(&pInfo->minval, tmin);
-      }
+  pInfo->numOfElems += num;
+  return TSDB_CODE_SUCCESS;
+}
 
-      if (GET_DOUBLE_VAL(&pInfo->maxval) < tmax) {
-        SET_DOUBLE_VAL(&pInfo->maxval, tmax);
-      }
+// add the values of pSrc, kept as they are or in its t-digest, to pDst
+static int32_t percentileAddInfo(SPercentileInfo* pDst, SPercentileInfo* pSrc) {
+  if (!pSrc->sketch) {
+    return percentileAddValues(pDst, pSrc->buf, (int32_t)pSrc->numOfElems);
+  }
 
-      pInfo->numOfElems += (pInput->numOfRows - pAgg->numOfNull);
-    } else {
-      // check the valid data one by one
-      int32_t start = pInput->startRowIndex;
-      for (int32_t i = start; i < pInput->numOfRows + start; ++i) {
-        if (colDataIsNull_f(pCol->nullbitmap, i)) {
-          continue;
-        }
+  if (!pDst->sketch) {
+    int32_t code = percentileToSketch(pDst);
+    if (code != TSDB_CODE_SUCCESS) {
+      return code;
+    }
+  }
 
-        char* data = colDataGetData(pCol, i);
+  tdigestMerge(percentileFillTDigest(pDst), percentileFillTDigest(pSrc));
+  pDst->numOfElems += pSrc->numOfElems;
+  return TSDB_CODE_SUCCESS;
+}
 
-        double v = 0;
-        GET_TYPED_DATA(v, double, type, data);
-        if (v < GET_DOUBLE_VAL(&pInfo->minval)) {
-          SET_DOUBLE_VAL(&pInfo->minval, v);
-        }
+int32_t percentileFunction(SqlFunctionCtx* pCtx) {
+  int32_t              numOfElems = 0;
+  SResultRowEntryInfo* pResInfo = GET_RES_INFO(pCtx);
 
-        if (v > GET_DOUBLE_VAL(&pInfo->maxval)) {
-          SET_DOUBLE_VAL(&pInfo->maxval, v);
-        }
+  SInputColumnInfoData* pInput = &pCtx->input;
+  SColumnInfoData*      pCol = pInput->pData[0];
+  int32_t               type = pCol->info.type;
 
-        pInfo->numOfElems += 1;
-      }
+  SPercentileInfo* pInfo = GET_ROWCELL_INTERBUF(pResInfo);
+
+  double  buf[256];
+  int32_t num = 0;
+  int32_t start = pInput->startRowIndex;
+  for (int32_t i = start; i < pInput->numOfRows + start; ++i) {
+    if (colDataIsNull_f(pCol->nullbitmap, i)) {
+      continue;
     }
-  } else {
-    // the second stage, calculate the true percentile value
-    int32_t start = pInput->startRowIndex;
-    for (int32_t i = start; i < pInput->numOfRows + start; ++i) {
-      if (colDataIsNull_f(pCol->nullbitmap, i)) {
-        continue;
-      }
 
-      char* data = colDataGetData(pCol, i);
-      numOfElems += 1;
-      int32_t code = tMemBucketPut(pInfo->pMemBucket, data, 1);
+    char* data = colDataGetData(pCol, i);
+    GET_TYPED_DATA(buf[num], double, type, data);
+    numOfElems += 1;
+
+    if (++num == tListLen(buf)) {
+      int32_t code = percentileAddValues(pInfo, buf, num);
       if (code != TSDB_CODE_SUCCESS) {
-        tMemBucketDestroy(pInfo->pMemBucket);
         return code;
       }
+      num = 0;
     }
+  }
+
+  int32_t code = percentileAddValues(pInfo, buf, num);
+  if (code != TSDB_CODE_SUCCESS) {
+    return code;
+  }
+
+  SET_VAL(pResInfo, numOfElems, 1);
+  return TSDB_CODE_SUCCESS;
+}
 
-    SET_VAL(pResInfo, numOfElems, 1);
+int32_t percentileFunctionMerge(SqlFunctionCtx* pCtx) {
+  SResultRowEntryInfo*  pResInfo = GET_RES_INFO(pCtx);
+  SInputColumnInfoData* pInput = &pCtx->input;
+
+  SColumnInfoData* pCol = pInput->pData[0];
+  if (pCol->info.type != TSDB_DATA_TYPE_BINARY) {
+    return TSDB_CODE_FUNC_FUNTION_PARA_TYPE;
+  }
+
+  SPercentileInfo* pInfo = GET_ROWCELL_INTERBUF(pResInfo);
+
+  int32_t start = pInput->startRowIndex;
+  for (int32_t i = start; i < start + pInput->numOfRows; ++i) {
+    if (colDataIsNull_s(pCol, i)) {
+      continue;
+    }
+
+    SPercentileInfo* pInputInfo = (SPercentileInfo*)varDataVal(colDataGetData(pCol, i));
+    int32_t          code = percentileAddInfo(pInfo, pInputInfo);
+    if (code != TSDB_CODE_SUCCESS) {
+      return code;
+    }
   }
 
+  SET_VAL(pResInfo, pInfo->numOfElems, 1);
   return TSDB_CODE_SUCCESS;
 }
 
+// interpolate between the two closest of the sorted values, the same as getPercentile
+static double percentileInterpolate(const double* pVal, int32_t num, double percent) {
+  double  pos = fabs(percent) * (num - 1) / 100.0;
+  int32_t lower = TMIN((int32_t)pos, num - 1);
+  int32_t upper = TMIN(lower + 1, num - 1);
+  return (1 - (pos - lower)) * pVal[lower] + (pos - lower) * pVal[upper];
+}
+
 int32_t percentileFinalize(SqlFunctionCtx* pCtx, SSDataBlock* pBlock) {
   SResultRowEntryInfo* pResInfo = GET_RES_INFO(pCtx);
   SPercentileInfo*     ppInfo = (SPercentileInfo*)GET_ROWCELL_INTERBUF(pResInfo);
 
-  int32_t code = 0;
-  double  v = 0;
+  int32_t          slotId = pCtx->pExpr->base.resSchema.slotId;
+  SColumnInfoData* pCol = taosArrayGet(pBlock->pDataBlock, slotId);
+  double           result[PERCENTILE_MAX_PERCENT_NUM] = {0};
+  TDigest*         pTDigest = NULL;
+  double           v = 0;
 
-  tMemBucket* pMemBucket = ppInfo->pMemBucket;
-  if (pMemBucket != NULL && pMemBucket->total > 0) {  // check for null
+  if (ppInfo->numOfElems == 0) {
     if (pCtx->numOfParams > 2) {
-      char   buf[512] = {0};
-      size_t len = 1;
-
-      varDataVal(buf)[0] = '[';
-      for (int32_t i = 1; i < pCtx->numOfParams; ++i) {
-        SVariant* pVal = &pCtx->param[i].param;
+      colDataSetNULL(pCol, pBlock->info.rows);
+      return pResInfo->numOfRes;
+    }
+    return functionFinalize(pCtx, pBlock);
+  }
 
-        GET_TYPED_DATA(v, double, pVal->nType, &pVal->i);
+  // one t-digest, or one sort of the values, answers all the percents
+  if (ppInfo->sketch) {
+    pTDigest = percentileFillTDigest(ppInfo);
+  } else {
+    taosSort(ppInfo->buf, ppInfo->numOfElems, sizeof(double), compareDoubleVal);
+  }
 
-        code = getPercentile(pMemBucket, v, &ppInfo->result);
-        if (code != TSDB_CODE_SUCCESS) {
-          goto _fin_error;
-        }
+  for (int32_t i = 1; i < pCtx->numOfParams; ++i) {
+    SVariant* pVal = &pCtx->param[i].param;
 
-        if (i == pCtx->numOfParams - 1) {
-          len += snprintf(varDataVal(buf) + len, sizeof(buf) - VARSTR_HEADER_SIZE - len, "%.6lf]", ppInfo->result);
-        } else {
-          len += snprintf(varDataVal(buf) + len, sizeof(buf) - VARSTR_HEADER_SIZE - len, "%.6lf, ", ppInfo->result);
-        }
-      }
+    GET_TYPED_DATA(v, double, pVal->nType, &pVal->i);
+    if (pTDigest != NULL) {
+      result[i - 1] = tdigestQuantile(pTDigest, v / 100);
+    } else {
+      result[i - 1] = percentileInterpolate(ppInfo->buf, (int32_t)ppInfo->numOfElems, v);
+    }
+  }
 
-      int32_t          slotId = pCtx->pExpr->base.resSchema.slotId;
-      SColumnInfoData* pCol = taosArrayGet(pBlock->pDataBlock, slotId);
+  ppInfo->result = result[0];
+  if (pCtx->numOfParams <= 2) {
+    return functionFinalize(pCtx, pBlock);
+  }
 
-      varDataSetLen(buf, len);
-      colDataSetVal(pCol, pBlock->info.rows, buf, false);
+  char   buf[512] = {0};
+  size_t len = 1;
 
-      tMemBucketDestroy(pMemBucket);
-      return pResInfo->numOfRes;
+  varDataVal(buf)[0] = '[';
+  for (int32_t i = 1; i < pCtx->numOfParams; ++i) {
+    if (i == pCtx->numOfParams - 1) {
+      len += snprintf(varDataVal(buf) + len, sizeof(buf) - VARSTR_HEADER_SIZE - len, "%.6lf]", result[i - 1]);
     } else {
-      SVariant* pVal = &pCtx->param[1].param;
+      len += snprintf(varDataVal(buf) + len, sizeof(buf) - VARSTR_HEADER_SIZE - len, "%.6lf, ", result[i - 1]);
+    }
+  }
 
-      GET_TYPED_DATA(v, double, pVal->nType, &pVal->i);
+  varDataSetLen(buf, len);
+  colDataSetVal(pCol, pBlock->info.rows, buf, false);
+  return pResInfo->numOfRes;
+}
 
-      code = getPercentile(pMemBucket, v, &ppInfo->result);
-      if (code != TSDB_CODE_SUCCESS) {
-        goto _fin_error;
-      }
+// the partial result is the result row, of only the values in use while they are kept as they are
+int32_t percentilePartialFinalize(SqlFunctionCtx* pCtx, SSDataBlock* pBlock) {
+  SResultRowEntryInfo* pResInfo = GET_RES_INFO(pCtx);
+  SPercentileInfo*     pInfo = (SPercentileInfo*)GET_ROWCELL_INTERBUF(pResInfo);
 
-      tMemBucketDestroy(pMemBucket);
-      return functionFinalize(pCtx, pBlock);
-    }
+  int32_t resultBytes = 0;
+  if (pInfo->sketch) {
+    TDigest* pTDigest = percentileFillTDigest(pInfo);
+    resultBytes = (int32_t)(sizeof(SPercentileInfo) + TDIGEST_SIZE(pTDigest->compression));
+  } else {
+    resultBytes = (int32_t)(sizeof(SPercentileInfo) + pInfo->numOfElems * sizeof(double));
+  }
+
+  char* res = taosMemoryCalloc(resultBytes + VARSTR_HEADER_SIZE, sizeof(char));
+  if (res == NULL) {
+    return TSDB_CODE_OUT_OF_MEMORY;
   }
 
-_fin_error:
+  memcpy(varDataVal(res), pInfo, resultBytes);
+  varDataSetLen(res, resultBytes);
+
+  int32_t          slotId = pCtx->pExpr->base.resSchema.slotId;
+  SColumnInfoData* pCol = taosArrayGet(pBlock->pDataBlock, slotId);
+
+  colDataSetVal(pCol, pBlock->info.rows, res, false);
+
+  taosMemoryFree(res);
+  return pResInfo->numOfRes;
+}
+
+int32_t percentileCombine(SqlFunctionCtx* pDestCtx, SqlFunctionCtx* pSourceCtx) {
+  SResultRowEntryInfo* pDResInfo = GET_RES_INFO(pDestCtx);
+  SPercentileInfo*     pDBuf = GET_ROWCELL_INTERBUF(pDResInfo);
+
+  SResultRowEntryInfo* pSResInfo = GET_RES_INFO(pSourceCtx);
+  SPercentileInfo*     pSBuf = GET_ROWCELL_INTERBUF(pSResInfo);
+
+  int32_t code = percentileAddInfo(pDBuf, pSBuf);
 
-  tMemBucketDestroy(pMemBucket);
+  pDResInfo->numOfRes = TMAX(pDResInfo->numOfRes, pSResInfo->numOfRes);
+  pDResInfo->isNullRes &= pSResInfo->isNullRes;
   return code;
 }
 
@@ -4003,13 +4247,66 @@ int32_t histogramCombine(SqlFunctionCtx* pDestCtx, SqlFunctionCtx* pSourceCtx) {
   return TSDB_CODE_SUCCESS;
 }
 
-int32_t getHLLInfoSize() { return (int32_t)sizeof(SHLLInfo); }
+// | format | total count | packed registers (dense) or the non-zero registers (sparse) |
+int32_t getHLLInfoSize() { return (int32_t)(sizeof(int8_t) + sizeof(uint64_t) + HLL_DENSE_BYTES); }
 
 bool getHLLFuncEnv(SFunctionNode* UNUSED_PARAM(pFunc), SFuncExecEnv* pEnv) {
-  pEnv->calcMemSize = sizeof(SHLLInfo);
+  pEnv->calcMemSize = HLL_ROW_SIZE;
+  pEnv->maxMemSize = sizeof(SHLLInfo);
+  return true;
+}
+
+bool hllFunctionSetup(SqlFunctionCtx* pCtx, SResultRowEntryInfo* pResultInfo) {
+  if (!functionSetup(pCtx, pResultInfo)) {
+    return false;
+  }
+
+  SHLLInfo* pInfo = GET_ROWCELL_INTERBUF(pResultInfo);
+  pInfo->maxSparse = (pCtx->resDataInfo.interBufSize >= sizeof(SHLLInfo)) ? HLL_SPARSE_MAX : HLL_SPARSE_ROW_MAX;
   return true;
 }
 
+static FORCE_INLINE uint8_t* hllGetBuckets(const SHLLInfo* pInfo) {
+  return (pInfo->pBuckets != NULL) ? pInfo->pBuckets : (uint8_t*)pInfo->buckets;
+}
+
+// the group is done once its result is taken, the registers out of the row are released
+static void hllDestroyBuckets(SHLLInfo* pInfo) {
+  if (pInfo->pBuckets == NULL) {
+    return;
+  }
+
+  taosMemoryFreeClear(pInfo->pBuckets);
+  pInfo->dense = false;
+  pInfo->numOfSparse = 0;
+}
+
+void hllCleanup(SResultRowEntryInfo* pResultInfo) { hllDestroyBuckets(GET_ROWCELL_INTERBUF(pResultInfo)); }
+
+static FORCE_INLINE uint8_t hllGetRegister(const uint8_t* buckets, int32_t index) {
+  int32_t  bit = index * HLL_REGISTER_BITS;
+  int32_t  shift = bit & 7;
+  uint32_t v = buckets[bit >> 3] | ((uint32_t)buckets[(bit >> 3) + 1] << 8);
+  return (v >> shift) & HLL_REGISTER_MAX;
+}
+
+static FORCE_INLINE void hllSetRegister(uint8_t* buckets, int32_t index, uint8_t val) {
+  int32_t bit = index * HLL_REGISTER_BITS;
+  int32_t shift = bit & 7;
+  uint8_t* p = buckets + (bit >> 3);
+
+  p[0] &= ~(HLL_REGISTER_MAX << shift);
+  p[0] |= val << shift;
+  p[1] &= ~(HLL_REGISTER_MAX >> (8 - shift));
+  p[1] |= val >> (8 - shift);
+}
+
+static FORCE_INLINE void hllUpdateRegister(uint8_t* buckets, int32_t index, uint8_t count) {
+  if (count > hllGetRegister(buckets, index)) {
+    hllSetRegister(buckets, index, count);
+  }
+}
+
 static uint8_t hllCountNum(void* data, int32_t bytes, int32_t* buk) {
   uint64_t hash = MurmurHash3_64(data, bytes);
   int32_t  index = hash & HLL_BUCKET_MASK;
@@ -4025,27 +4322,114 @@ static uint8_t hllCountNum(void* data, int32_t bytes, int32_t* buk) {
   return count;
 }
 
-static void hllBucketHisto(uint8_t* buckets, int32_t* bucketHisto) {
-  uint64_t* word = (uint64_t*)buckets;
-  uint8_t*  bytes;
+// move the sparse registers to the packed ones, once there are more of them than the row holds
+static int32_t hllToDense(SHLLInfo* pInfo) {
+  uint32_t sparse[HLL_SPARSE_MAX];
+  int32_t  num = pInfo->numOfSparse;
+  memcpy(sparse, pInfo->sparse, num * sizeof(uint32_t));
 
-  for (int32_t j = 0; j < HLL_BUCKETS >> 3; j++) {
-    if (*word == 0) {
-      bucketHisto[0] += 8;
+  if (pInfo->maxSparse < HLL_SPARSE_MAX) {
+    pInfo->pBuckets = taosMemoryCalloc(1, sizeof(pInfo->buckets));
+    if (pInfo->pBuckets == NULL) {
+      return TSDB_CODE_OUT_OF_MEMORY;
+    }
+  } else {
+    memset(pInfo->buckets, 0, sizeof(pInfo->buckets));
+  }
+
+  uint8_t* buckets = hllGetBuckets(pInfo);
+  for (int32_t k = 0; k < num; ++k) {
+    hllSetRegister(buckets, sparse[k] >> HLL_REGISTER_BITS, sparse[k] & HLL_REGISTER_MAX);
+  }
+
+  pInfo->dense = true;
+  pInfo->numOfSparse = 0;
+  return TSDB_CODE_SUCCESS;
+}
+
+static int32_t hllUpdateInfo(SHLLInfo* pInfo, int32_t index, uint8_t count) {
+  if (pInfo->dense) {
+    hllUpdateRegister(hllGetBuckets(pInfo), index, count);
+    return TSDB_CODE_SUCCESS;
+  }
+
+  uint32_t* sparse = pInfo->sparse;
+  int32_t   num = pInfo->numOfSparse;
+  int32_t   lo = 0, hi = num;
+  while (lo < hi) {
+    int32_t mid = (lo + hi) >> 1;
+    if ((int32_t)(sparse[mid] >> HLL_REGISTER_BITS) < index) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  if (lo < num && (int32_t)(sparse[lo] >> HLL_REGISTER_BITS) == index) {
+    if (count > (sparse[lo] & HLL_REGISTER_MAX)) {
+      sparse[lo] = ((uint32_t)index << HLL_REGISTER_BITS) | count;
+    }
+    return TSDB_CODE_SUCCESS;
+  }
+
+  if (num >= pInfo->maxSparse) {
+    int32_t code = hllToDense(pInfo);
+    if (code != TSDB_CODE_SUCCESS) {
+      return code;
+    }
+    hllUpdateRegister(hllGetBuckets(pInfo), index, count);
+    return TSDB_CODE_SUCCESS;
+  }
+
+  memmove(sparse + lo + 1, sparse + lo, (num - lo) * sizeof(uint32_t));
+  sparse[lo] = ((uint32_t)index << HLL_REGISTER_BITS) | count;
+  pInfo->numOfSparse++;
+  return TSDB_CODE_SUCCESS;
+}
+
+static void hllBucketHisto(const SHLLInfo* pInfo, int32_t* bucketHisto) {
+  if (!pInfo->dense) {
+    bucketHisto[0] = HLL_BUCKETS - pInfo->numOfSparse;
+    for (int32_t k = 0; k < pInfo->numOfSparse; ++k) {
+      bucketHisto[pInfo->sparse[k] & HLL_REGISTER_MAX]++;
+    }
+    return;
+  }
+
+  // every 3 bytes hold 4 registers
+  const uint8_t* buckets = hllGetBuckets(pInfo);
+  for (int32_t j = 0; j < HLL_DENSE_BYTES; j += 3) {
+    uint32_t v = buckets[j] | ((uint32_t)buckets[j + 1] << 8) | ((uint32_t)buckets[j + 2] << 16);
+    if (v == 0) {
+      bucketHisto[0] += 4;
     } else {
-      bytes = (uint8_t*)word;
-      bucketHisto[bytes[0]]++;
-      bucketHisto[bytes[1]]++;
-      bucketHisto[bytes[2]]++;
-      bucketHisto[bytes[3]]++;
-      bucketHisto[bytes[4]]++;
-      bucketHisto[bytes[5]]++;
-      bucketHisto[bytes[6]]++;
-      bucketHisto[bytes[7]]++;
+      bucketHisto[v & HLL_REGISTER_MAX]++;
+      bucketHisto[(v >> 6) & HLL_REGISTER_MAX]++;
+      bucketHisto[(v >> 12) & HLL_REGISTER_MAX]++;
+      bucketHisto[(v >> 18) & HLL_REGISTER_MAX]++;
     }
-    word++;
   }
 }
+
+static void hllMergeBuckets(uint8_t* pOutput, const uint8_t* pInput) {
+  for (int32_t j = 0; j < HLL_DENSE_BYTES; j += 3) {
+    uint32_t in = pInput[j] | ((uint32_t)pInput[j + 1] << 8) | ((uint32_t)pInput[j + 2] << 16);
+    if (in == 0) {
+      continue;
+    }
+
+    uint32_t out = pOutput[j] | ((uint32_t)pOutput[j + 1] << 8) | ((uint32_t)pOutput[j + 2] << 16);
+    uint32_t res = 0;
+    for (int32_t k = 0; k < 24; k += HLL_REGISTER_BITS) {
+      res |= TMAX((in >> k) & HLL_REGISTER_MAX, (out >> k) & HLL_REGISTER_MAX) << k;
+    }
+
+    pOutput[j] = res & 0xFF;
+    pOutput[j + 1] = (res >> 8) & 0xFF;
+    pOutput[j + 2] = (res >> 16) & 0xFF;
+  }
+}
+
 static double hllTau(double x) {
   if (x == 0. || x == 1.) return 0.;
   double zPrime;
@@ -4076,10 +4460,10 @@ static double hllSigma(double x) {
 
 // estimate the cardinality, the algorithm refer this paper: "New cardinality estimation algorithms for HyperLogLog
 // sketches"
-static uint64_t hllCountCnt(uint8_t* buckets) {
+static uint64_t hllCountCnt(const SHLLInfo* pInfo) {
   double  m = HLL_BUCKETS;
   int32_t buckethisto[64] = {0};
-  hllBucketHisto(buckets, buckethisto);
+  hllBucketHisto(pInfo, buckethisto);
 
   double z = m * hllTau((m - buckethisto[HLL_DATA_BITS + 1]) / (double)m);
   for (int j = HLL_DATA_BITS; j >= 1; --j) {
@@ -4125,9 +4509,9 @@ int32_t hllFunction(SqlFunctionCtx* pCtx) {
 
     int32_t index = 0;
     uint8_t count = hllCountNum(data, bytes, &index);
-    uint8_t oldcount = pInfo->buckets[index];
-    if (count > oldcount) {
-      pInfo->buckets[index] = count;
+    int32_t code = hllUpdateInfo(pInfo, index, count);
+    if (code != TSDB_CODE_SUCCESS) {
+      return code;
     }
   }
 
@@ -4143,13 +4527,77 @@ _hll_over:
   return TSDB_CODE_SUCCESS;
 }
 
-static void hllTransferInfo(SHLLInfo* pInput, SHLLInfo* pOutput) {
-  for (int32_t k = 0; k < HLL_BUCKETS; ++k) {
-    if (pOutput->buckets[k] < pInput->buckets[k]) {
-      pOutput->buckets[k] = pInput->buckets[k];
+static int32_t hllMergeDense(SHLLInfo* pOutput, const uint8_t* buckets) {
+  if (!pOutput->dense) {
+    int32_t code = hllToDense(pOutput);
+    if (code != TSDB_CODE_SUCCESS) {
+      return code;
+    }
+  }
+  hllMergeBuckets(hllGetBuckets(pOutput), buckets);
+  return TSDB_CODE_SUCCESS;
+}
+
+static int32_t hllTransferInfo(SHLLInfo* pInput, SHLLInfo* pOutput) {
+  int32_t code = TSDB_CODE_SUCCESS;
+  if (pInput->dense) {
+    code = hllMergeDense(pOutput, hllGetBuckets(pInput));
+  } else {
+    for (int32_t k = 0; k < pInput->numOfSparse && code == TSDB_CODE_SUCCESS; ++k) {
+      uint32_t v = pInput->sparse[k];
+      code = hllUpdateInfo(pOutput, v >> HLL_REGISTER_BITS, v & HLL_REGISTER_MAX);
     }
   }
   pOutput->totalCount += pInput->totalCount;
+  return code;
+}
+
+// merge the intermediate result in any of the dense, sparse and the legacy one byte per register formats
+static int32_t hllTransferSerialized(const char* data, int32_t len, SHLLInfo* pOutput) {
+  int32_t code = TSDB_CODE_SUCCESS;
+  if (len == HLL_LEGACY_INFO_SIZE) {
+    const uint8_t* buckets = (const uint8_t*)data + sizeof(uint64_t) * 2;
+    for (int32_t k = 0; k < HLL_BUCKETS && code == TSDB_CODE_SUCCESS; ++k) {
+      if (buckets[k] != 0) {
+        code = hllUpdateInfo(pOutput, k, buckets[k]);
+      }
+    }
+    pOutput->totalCount += *(uint64_t*)(data + sizeof(uint64_t));
+    return code;
+  }
+
+  int8_t fmt = *(int8_t*)data;
+  data += sizeof(int8_t);
+  pOutput->totalCount += *(uint64_t*)data;
+  data += sizeof(uint64_t);
+
+  if (fmt == HLL_FMT_DENSE) {
+    code = hllMergeDense(pOutput, (const uint8_t*)data);
+  } else {
+    int32_t num = (len - sizeof(int8_t) - sizeof(uint64_t)) / sizeof(uint32_t);
+    for (int32_t k = 0; k < num && code == TSDB_CODE_SUCCESS; ++k) {
+      uint32_t v = *(uint32_t*)(data + k * sizeof(uint32_t));
+      code = hllUpdateInfo(pOutput, v >> HLL_REGISTER_BITS, v & HLL_REGISTER_MAX);
+    }
+  }
+  return code;
+}
+
+// the registers are written in the form they are kept in, the sparse one is never larger than the dense one
+static int32_t hllSerialize(const SHLLInfo* pInfo, char* buf) {
+  char* p = buf + sizeof(int8_t);
+  *(uint64_t*)p = pInfo->totalCount;
+  p += sizeof(uint64_t);
+
+  if (!pInfo->dense) {
+    *(int8_t*)buf = HLL_FMT_SPARSE;
+    memcpy(p, pInfo->sparse, pInfo->numOfSparse * sizeof(uint32_t));
+    return sizeof(int8_t) + sizeof(uint64_t) + pInfo->numOfSparse * sizeof(uint32_t);
+  }
+
+  *(int8_t*)buf = HLL_FMT_DENSE;
+  memcpy(p, hllGetBuckets(pInfo), HLL_DENSE_BYTES);
+  return getHLLInfoSize();
 }
 
 int32_t hllFunctionMerge(SqlFunctionCtx* pCtx) {
@@ -4165,9 +4613,11 @@ int32_t hllFunctionMerge(SqlFunctionCtx* pCtx) {
   int32_t start = pInput->startRowIndex;
 
   for (int32_t i = start; i < start + pInput->numOfRows; ++i) {
-    char*     data = colDataGetData(pCol, i);
-    SHLLInfo* pInputInfo = (SHLLInfo*)varDataVal(data);
-    hllTransferInfo(pInputInfo, pInfo);
+    char*   data = colDataGetData(pCol, i);
+    int32_t code = hllTransferSerialized(varDataVal(data), varDataLen(data), pInfo);
+    if (code != TSDB_CODE_SUCCESS) {
+      return code;
+    }
   }
 
   if (pInfo->totalCount == 0 && !tsCountAlwaysReturnValue) {
@@ -4183,7 +4633,8 @@ int32_t hllFinalize(SqlFunctionCtx* pCtx, SSDataBlock* pBlock) {
   SResultRowEntryInfo* pInfo = GET_RES_INFO(pCtx);
 
   SHLLInfo* pHllInfo = GET_ROWCELL_INTERBUF(GET_RES_INFO(pCtx));
-  pHllInfo->result = hllCountCnt(pHllInfo->buckets);
+  pHllInfo->result = hllCountCnt(pHllInfo);
+  hllDestroyBuckets(pHllInfo);
   if (tsCountAlwaysReturnValue && pHllInfo->result == 0) {
     pInfo->numOfRes = 1;
   }
@@ -4197,8 +4648,9 @@ int32_t hllPartialFinalize(SqlFunctionCtx* pCtx, SSDataBlock* pBlock) {
   int32_t              resultBytes = getHLLInfoSize();
   char*                res = taosMemoryCalloc(resultBytes + VARSTR_HEADER_SIZE, sizeof(char));
 
-  memcpy(varDataVal(res), pInfo, resultBytes);
-  varDataSetLen(res, resultBytes);
+  int32_t len = hllSerialize(pInfo, varDataVal(res));
+  varDataSetLen(res, len);
+  hllDestroyBuckets(pInfo);
 
   int32_t          slotId = pCtx->pExpr->base.resSchema.slotId;
   SColumnInfoData* pCol = taosArrayGet(pBlock->pDataBlock, slotId);
@@ -4216,10 +4668,19 @@ int32_t hllCombine(SqlFunctionCtx* pDestCtx, SqlFunctionCtx* pSourceCtx) {
   SResultRowEntryInfo* pSResInfo = GET_RES_INFO(pSourceCtx);
   SHLLInfo*            pSBuf = GET_ROWCELL_INTERBUF(pSResInfo);
 
-  hllTransferInfo(pSBuf, pDBuf);
+  int32_t code = hllTransferInfo(pSBuf, pDBuf);
   pDResInfo->numOfRes = TMAX(pDResInfo->numOfRes, pSResInfo->numOfRes);
   pDResInfo->isNullRes &= pSResInfo->isNullRes;
-  return TSDB_CODE_SUCCESS;
+  return code;
+}
+
+// restore the buffer saved by the older versions, which kept one byte for each register, in a stream state row
+int32_t hllDecodeLegacyInfo(const char* pLegacy, char* pBuf) {
+  SHLLInfo* pInfo = (SHLLInfo*)pBuf;
+  memset(pInfo, 0, sizeof(SHLLInfo));
+  pInfo->maxSparse = HLL_SPARSE_MAX;
+  pInfo->result = *(uint64_t*)pLegacy;
+  return hllTransferSerialized(pLegacy, HLL_LEGACY_INFO_SIZE, pInfo);
 }
 
 bool getStateFuncEnv(SFunctionNode* UNUSED_PARAM(pFunc), SFuncExecEnv* pEnv) {
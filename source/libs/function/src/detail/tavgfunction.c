@@ -683,6 +683,74 @@ _over:
   return TSDB_CODE_SUCCESS;
 }
 
+#define AVG_ADD_DSUM(out, val) (out)->sum.dsum += (val);
+
+#define AVG_ADD_SEGMENTS(_t, _add)                                            \
+  do {                                                                        \
+    const _t* plist = (const _t*)pCol->pData;                                 \
+    for (int32_t s = 0; s < numOfSegs; ++s) {                                 \
+      SAvgRes* pAvgRes = GET_ROWCELL_INTERBUF(pSegs[s].pResInfo);             \
+      int32_t  start = pSegs[s].startRowIndex;                                \
+      int32_t  numOfElem = 0;                                                 \
+                                                                              \
+      pAvgRes->type = type;                                                   \
+      for (int32_t i = start; i < start + pSegs[s].numOfRows; ++i) {          \
+        if (pCol->hasNull && colDataIsNull_f(pCol->nullbitmap, i)) {          \
+          continue;                                                           \
+        }                                                                     \
+                                                                              \
+        numOfElem += 1;                                                       \
+        pAvgRes->count += 1;                                                  \
+        _add(pAvgRes, plist[i])                                               \
+      }                                                                       \
+      SET_VAL(pSegs[s].pResInfo, numOfElem, 1);                               \
+    }                                                                         \
+  } while (0)
+
+int32_t avgFunctionBatch(SqlFunctionCtx* pCtx, const SFuncRowSegment* pSegs, int32_t numOfSegs) {
+  SColumnInfoData* pCol = pCtx->input.pData[0];
+  int32_t          type = pCol->info.type;
+
+  switch (type) {
+    case TSDB_DATA_TYPE_NULL:
+      break;
+    case TSDB_DATA_TYPE_TINYINT:
+      AVG_ADD_SEGMENTS(int8_t, CHECK_OVERFLOW_SUM_SIGNED);
+      break;
+    case TSDB_DATA_TYPE_SMALLINT:
+      AVG_ADD_SEGMENTS(int16_t, CHECK_OVERFLOW_SUM_SIGNED);
+      break;
+    case TSDB_DATA_TYPE_INT:
+      AVG_ADD_SEGMENTS(int32_t, CHECK_OVERFLOW_SUM_SIGNED);
+      break;
+    case TSDB_DATA_TYPE_BIGINT:
+      AVG_ADD_SEGMENTS(int64_t, CHECK_OVERFLOW_SUM_SIGNED);
+      break;
+    case TSDB_DATA_TYPE_UTINYINT:
+      AVG_ADD_SEGMENTS(uint8_t, CHECK_OVERFLOW_SUM_UNSIGNED);
+      break;
+    case TSDB_DATA_TYPE_USMALLINT:
+      AVG_ADD_SEGMENTS(uint16_t, CHECK_OVERFLOW_SUM_UNSIGNED);
+      break;
+    case TSDB_DATA_TYPE_UINT:
+      AVG_ADD_SEGMENTS(uint32_t, CHECK_OVERFLOW_SUM_UNSIGNED);
+      break;
+    case TSDB_DATA_TYPE_UBIGINT:
+      AVG_ADD_SEGMENTS(uint64_t, CHECK_OVERFLOW_SUM_UNSIGNED);
+      break;
+    case TSDB_DATA_TYPE_FLOAT:
+      AVG_ADD_SEGMENTS(float, AVG_ADD_DSUM);
+      break;
+    case TSDB_DATA_TYPE_DOUBLE:
+      AVG_ADD_SEGMENTS(double, AVG_ADD_DSUM);
+      break;
+    default:
+      return functionProcessSegments(pCtx, pSegs, numOfSegs, avgFunction);
+  }
+
+  return TSDB_CODE_SUCCESS;
+}
+
 static void avgTransferInfo(SAvgRes* pInput, SAvgRes* pOutput) {
   if (IS_NULL_TYPE(pInput->type)) {
     return;
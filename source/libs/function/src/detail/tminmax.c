@@ -929,3 +929,89 @@ _over:
   *nElems = numOfElems;
   return code;
 }
+
+#define __COMPARE_EXTRACT_SEGMENTS(_t, _op)                                               \
+  do {                                                                                    \
+    const _t* d = (const _t*)pCol->pData;                                                 \
+    for (int32_t s = 0; s < numOfSegs; ++s) {                                             \
+      SMinmaxResInfo* pBuf = GET_ROWCELL_INTERBUF(pSegs[s].pResInfo);                     \
+      _t*             v = (_t*)&pBuf->v;                                                  \
+      int32_t         start = pSegs[s].startRowIndex;                                     \
+      int32_t         numOfElems = 0;                                                     \
+                                                                                          \
+      pBuf->type = type;                                                                  \
+      for (int32_t i = start; i < start + pSegs[s].numOfRows; ++i) {                      \
+        if (pCol->hasNull && colDataIsNull_f(pCol->nullbitmap, i)) {                      \
+          continue;                                                                       \
+        }                                                                                 \
+        if (!pBuf->assign) {                                                              \
+          *v = d[i];                                                                      \
+          pBuf->assign = true;                                                            \
+        } else if (d[i] _op *v) {                                                         \
+          *v = d[i];                                                                      \
+        }                                                                                 \
+        numOfElems += 1;                                                                  \
+      }                                                                                   \
+                                                                                          \
+      if (numOfElems > 0) {                                                               \
+        pSegs[s].pResInfo->numOfRes = 1;                                                  \
+      }                                                                                   \
+    }                                                                                     \
+  } while (0)
+
+#define __COMPARE_EXTRACT_SEGMENTS_T(_t)         \
+  do {                                           \
+    if (isMinFunc) {                             \
+      __COMPARE_EXTRACT_SEGMENTS(_t, <);         \
+    } else {                                     \
+      __COMPARE_EXTRACT_SEGMENTS(_t, >);         \
+    }                                            \
+  } while (0)
+
+// the selectivity functions need the row of each extreme value, so they are left to the row-range version
+int32_t doMinMaxBatchHelper(SqlFunctionCtx* pCtx, const SFuncRowSegment* pSegs, int32_t numOfSegs, int32_t isMinFunc) {
+  SColumnInfoData* pCol = pCtx->input.pData[0];
+  int32_t          type = pCol->info.type;
+
+  if (pCtx->subsidiaries.num > 0) {
+    return functionProcessSegments(pCtx, pSegs, numOfSegs, isMinFunc ? minFunction : maxFunction);
+  }
+
+  switch (type) {
+    case TSDB_DATA_TYPE_BOOL:
+    case TSDB_DATA_TYPE_TINYINT:
+      __COMPARE_EXTRACT_SEGMENTS_T(int8_t);
+      break;
+    case TSDB_DATA_TYPE_SMALLINT:
+      __COMPARE_EXTRACT_SEGMENTS_T(int16_t);
+      break;
+    case TSDB_DATA_TYPE_INT:
+      __COMPARE_EXTRACT_SEGMENTS_T(int32_t);
+      break;
+    case TSDB_DATA_TYPE_BIGINT:
+      __COMPARE_EXTRACT_SEGMENTS_T(int64_t);
+      break;
+    case TSDB_DATA_TYPE_UTINYINT:
+      __COMPARE_EXTRACT_SEGMENTS_T(uint8_t);
+      break;
+    case TSDB_DATA_TYPE_USMALLINT:
+      __COMPARE_EXTRACT_SEGMENTS_T(uint16_t);
+      break;
+    case TSDB_DATA_TYPE_UINT:
+      __COMPARE_EXTRACT_SEGMENTS_T(uint32_t);
+      break;
+    case TSDB_DATA_TYPE_UBIGINT:
+      __COMPARE_EXTRACT_SEGMENTS_T(uint64_t);
+      break;
+    case TSDB_DATA_TYPE_FLOAT:
+      __COMPARE_EXTRACT_SEGMENTS_T(float);
+      break;
+    case TSDB_DATA_TYPE_DOUBLE:
+      __COMPARE_EXTRACT_SEGMENTS_T(double);
+      break;
+    default:
+      return functionProcessSegments(pCtx, pSegs, numOfSegs, isMinFunc ? minFunction : maxFunction);
+  }
+
+  return TSDB_CODE_SUCCESS;
+}
@@ -141,6 +141,8 @@ int32_t fmGetFuncExecFuncs(int32_t funcId, SFuncExecFuncs* pFpSet) {
   pFpSet->process = funcMgtBuiltins[funcId].processFunc;
   pFpSet->finalize = funcMgtBuiltins[funcId].finalizeFunc;
   pFpSet->combine = funcMgtBuiltins[funcId].combineFunc;
+  pFpSet->cleanup = funcMgtBuiltins[funcId].cleanupFunc;
+  pFpSet->processBatch = funcMgtBuiltins[funcId].processBatchFunc;
   return TSDB_CODE_SUCCESS;
 }
 
@@ -297,6 +299,21 @@ int32_t fmSetNormalFunc(int32_t funcId, SFuncExecFuncs* pFpSet) {
   return TSDB_CODE_SUCCESS;
 }
 
+// the size of the intermediate buffer in the result rows saved by the older versions, 0 if it is not changed since
+int32_t fmGetLegacyResBufSize(int32_t funcId) {
+  if (fmIsUserDefinedFunc(funcId) || funcId < 0 || funcId >= funcMgtBuiltinsNum) {
+    return 0;
+  }
+  return funcMgtBuiltins[funcId].legacyResSize;
+}
+
+int32_t fmDecodeLegacyResBuf(int32_t funcId, const char* pLegacy, char* pBuf) {
+  if (fmGetLegacyResBufSize(funcId) == 0 || NULL == funcMgtBuiltins[funcId].decodeLegacyFunc) {
+    return TSDB_CODE_FAILED;
+  }
+  return funcMgtBuiltins[funcId].decodeLegacyFunc(pLegacy, pBuf);
+}
+
 bool fmIsInvertible(int32_t funcId) {
   bool res = false;
   switch (funcMgtBuiltins[funcId].type) {
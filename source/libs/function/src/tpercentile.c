@@ -285,7 +285,8 @@ tMemBucket *tMemBucketCreate(int32_t nElemSize, int16_t dataType, double minval,
     return NULL;
   }
 
-  int32_t ret = createDiskbasedBuf(&pBucket->pBuffer, pBucket->bufPageSize, pBucket->bufPageSize * 1024, "1", tsTempDir);
+  int32_t ret = createDiskbasedBuf(&pBucket->pBuffer, pBucket->bufPageSize, pBucket->bufPageSize * 1024, "1", tsTempDir,
+                                   tsPagedBufCompress);
   if (ret != 0) {
     tMemBucketDestroy(pBucket);
     return NULL;
@@ -0,0 +1,708 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "builtinsimpl.h"
+#include "tdatablock.h"
+#include "tdigest.h"
+#include "tglobal.h"
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+
+namespace {
+
+// the result row and the context of one aggregate function on one group
+class SFuncTester {
+ public:
+  SFuncTester(int32_t interBufSize) {
+    pResInfo = (SResultRowEntryInfo *)taosMemoryCalloc(1, sizeof(SResultRowEntryInfo) + interBufSize);
+    expr.base.resSchema.slotId = 0;
+    ctx.resultInfo = pResInfo;
+    ctx.resDataInfo.interBufSize = interBufSize;
+    ctx.pExpr = &expr;
+  }
+  ~SFuncTester() { taosMemoryFree(pResInfo); }
+
+  SqlFunctionCtx      ctx = {0};
+  SExprInfo           expr = {0};
+  SResultRowEntryInfo *pResInfo = NULL;
+};
+
+SColumnInfoData *createBigintCol(const std::vector<int64_t> &vals) {
+  SColumnInfoData *pCol = (SColumnInfoData *)taosMemoryCalloc(1, sizeof(SColumnInfoData));
+  *pCol = createColumnInfoData(TSDB_DATA_TYPE_BIGINT, sizeof(int64_t), 1);
+  colInfoDataEnsureCapacity(pCol, vals.size(), false);
+  for (int32_t i = 0; i < vals.size(); ++i) {
+    colDataSetVal(pCol, i, (const char *)&vals[i], false);
+  }
+  return pCol;
+}
+
+void destroyCol(SColumnInfoData *pCol) {
+  colDataDestroy(pCol);
+  taosMemoryFree(pCol);
+}
+
+// a block of one column to hold the results
+SSDataBlock *createResBlock(int32_t type, int32_t bytes, int32_t rows) {
+  SSDataBlock    *pBlock = createDataBlock();
+  SColumnInfoData colInfo = createColumnInfoData(type, bytes, 1);
+  blockDataAppendColInfo(pBlock, &colInfo);
+  blockDataEnsureCapacity(pBlock, rows);
+  return pBlock;
+}
+
+// hyperloglog ---------------------------------------------------------------------------------------------------
+
+// the rows of the stream states are full, the others keep the packed registers out of the row
+class SHllTester : public SFuncTester {
+ public:
+  SHllTester(bool fullRow = false) : SFuncTester(hllInterBufSize(fullRow)) {
+    ctx.input.pData = aCol;
+    hllFunctionSetup(&ctx, pResInfo);
+  }
+  ~SHllTester() { hllCleanup(pResInfo); }
+
+  static int32_t hllInterBufSize(bool fullRow) {
+    SFuncExecEnv env = {0};
+    getHLLFuncEnv(NULL, &env);
+    return fullRow ? env.maxMemSize : env.calcMemSize;
+  }
+
+  void add(const std::vector<int64_t> &vals, int32_t blockRows = 4096) {
+    SColumnInfoData *pCol = createBigintCol(vals);
+    aCol[0] = pCol;
+    for (int32_t start = 0; start == 0 || start < vals.size(); start += blockRows) {
+      ctx.input.startRowIndex = start;
+      ctx.input.numOfRows = TMIN(blockRows, (int32_t)vals.size() - start);
+      ASSERT_EQ(hllFunction(&ctx), TSDB_CODE_SUCCESS);
+    }
+    destroyCol(pCol);
+    aCol[0] = NULL;
+  }
+
+  // the partial results of the testers, merged into this one
+  void merge(const std::vector<SHllTester *> &partials, std::vector<int32_t> *pLens = NULL) {
+    SSDataBlock *pBlock = createResBlock(TSDB_DATA_TYPE_BINARY, getHLLInfoSize() + VARSTR_HEADER_SIZE, partials.size());
+    for (SHllTester *pPartial : partials) {
+      ASSERT_EQ(hllPartialFinalize(&pPartial->ctx, pBlock), 1);
+      pBlock->info.rows++;
+    }
+
+    SColumnInfoData *pCol = (SColumnInfoData *)taosArrayGet(pBlock->pDataBlock, 0);
+    if (pLens) {
+      for (int32_t i = 0; i < pBlock->info.rows; ++i) {
+        pLens->push_back(varDataLen(colDataGetData(pCol, i)));
+      }
+    }
+
+    aCol[0] = pCol;
+    ctx.input.startRowIndex = 0;
+    ctx.input.numOfRows = pBlock->info.rows;
+    ASSERT_EQ(hllFunctionMerge(&ctx), TSDB_CODE_SUCCESS);
+    aCol[0] = NULL;
+    blockDataDestroy(pBlock);
+  }
+
+  // the partial result of this one
+  std::string partial() {
+    SSDataBlock *pBlock = createResBlock(TSDB_DATA_TYPE_BINARY, getHLLInfoSize() + VARSTR_HEADER_SIZE, 1);
+    EXPECT_EQ(hllPartialFinalize(&ctx, pBlock), 1);
+    char       *p = colDataGetData((SColumnInfoData *)taosArrayGet(pBlock->pDataBlock, 0), 0);
+    std::string res(varDataVal(p), varDataLen(p));
+    blockDataDestroy(pBlock);
+    return res;
+  }
+
+  int64_t estimate() {
+    SSDataBlock *pBlock = createResBlock(TSDB_DATA_TYPE_BIGINT, sizeof(int64_t), 1);
+    EXPECT_EQ(hllFinalize(&ctx, pBlock), 1);
+    int64_t res = *(int64_t *)colDataGetData((SColumnInfoData *)taosArrayGet(pBlock->pDataBlock, 0), 0);
+    blockDataDestroy(pBlock);
+    return res;
+  }
+
+  SColumnInfoData *aCol[1] = {NULL};
+};
+
+std::vector<int64_t> seq(int64_t start, int64_t n, int64_t step = 1) {
+  std::vector<int64_t> vals;
+  for (int64_t i = 0; i < n; ++i) vals.push_back(start + i * step);
+  return vals;
+}
+
+// the buffer of the older versions, with one byte for each register, made from a partial result
+std::vector<char> toLegacyInfo(const std::string &partial) {
+  const int32_t     headSize = sizeof(int8_t) + sizeof(uint64_t);
+  const int32_t     numOfBuckets = 1 << 14;
+  std::vector<char> legacy(HLL_LEGACY_INFO_SIZE);
+  uint8_t          *buckets = (uint8_t *)legacy.data() + sizeof(uint64_t) * 2;
+  *(uint64_t *)(legacy.data() + sizeof(uint64_t)) = *(uint64_t *)(partial.data() + sizeof(int8_t));
+
+  const uint8_t *p = (const uint8_t *)partial.data() + headSize;
+  if (partial[0] == 0) {  // dense, 6 bits for each register
+    for (int32_t k = 0; k < numOfBuckets; ++k) {
+      int32_t bit = k * 6;
+      buckets[k] = ((p[bit >> 3] | (p[(bit >> 3) + 1] << 8)) >> (bit & 7)) & 0x3F;
+    }
+  } else {  // sparse, (index << 6) | count
+    for (int32_t k = 0; k < (partial.size() - headSize) / sizeof(uint32_t); ++k) {
+      uint32_t v = *(uint32_t *)(p + k * sizeof(uint32_t));
+      buckets[v >> 6] = v & 0x3F;
+    }
+  }
+  return legacy;
+}
+
+void checkHllRoundTrip(const std::vector<std::vector<int64_t>> &groups, int64_t numOfDistinct, bool dense) {
+  std::vector<SHllTester *> partials;
+  SHllTester                all;
+  for (const std::vector<int64_t> &vals : groups) {
+    partials.push_back(new SHllTester());
+    partials.back()->add(vals);
+    all.add(vals);
+  }
+
+  SHllTester           merged;
+  std::vector<int32_t> lens;
+  merged.merge(partials, &lens);
+
+  // sparse partial results are smaller than the packed registers
+  for (int32_t len : lens) {
+    if (dense) {
+      ASSERT_EQ(len, getHLLInfoSize());
+    } else {
+      ASSERT_LT(len, getHLLInfoSize());
+    }
+  }
+
+  // merging the registers loses nothing, the estimate is the one of all the rows on one node
+  int64_t estimate = merged.estimate();
+  ASSERT_EQ(estimate, all.estimate());
+  ASSERT_LE(std::abs(estimate - numOfDistinct), numOfDistinct * 0.03 + 2);
+
+  for (SHllTester *pPartial : partials) delete pPartial;
+}
+
+// percentile ----------------------------------------------------------------------------------------------------
+
+class SPercentileTester : public SFuncTester {
+ public:
+  SPercentileTester(const std::vector<double> &percents) : SFuncTester(percentileInterBufSize()) {
+    params.resize(percents.size() + 1);
+    for (int32_t i = 0; i < percents.size(); ++i) {
+      params[i + 1].type = FUNC_PARAM_TYPE_VALUE;
+      params[i + 1].param.nType = TSDB_DATA_TYPE_DOUBLE;
+      params[i + 1].param.d = percents[i];
+    }
+    ctx.param = params.data();
+    ctx.numOfParams = params.size();
+    ctx.input.pData = aCol;
+    percentileFunctionSetup(&ctx, pResInfo);
+  }
+
+  static int32_t percentileInterBufSize() {
+    SFuncExecEnv env = {0};
+    getPercentileFuncEnv(NULL, &env);
+    return env.calcMemSize;
+  }
+
+  void add(const std::vector<int64_t> &vals, int32_t blockRows = 4096) {
+    SColumnInfoData *pCol = createBigintCol(vals);
+    aCol[0] = pCol;
+    for (int32_t start = 0; start == 0 || start < vals.size(); start += blockRows) {
+      ctx.input.startRowIndex = start;
+      ctx.input.numOfRows = TMIN(blockRows, (int32_t)vals.size() - start);
+      ASSERT_EQ(percentileFunction(&ctx), TSDB_CODE_SUCCESS);
+    }
+    destroyCol(pCol);
+    aCol[0] = NULL;
+  }
+
+  void combine(SPercentileTester *pSource) { ASSERT_EQ(percentileCombine(&ctx, &pSource->ctx), TSDB_CODE_SUCCESS); }
+
+  // the partial results of the testers, merged into this one
+  void merge(const std::vector<SPercentileTester *> &partials, std::vector<int32_t> *pLens = NULL) {
+    SSDataBlock *pBlock =
+        createResBlock(TSDB_DATA_TYPE_BINARY, getPercentileMaxSize() + VARSTR_HEADER_SIZE, partials.size());
+    for (SPercentileTester *pPartial : partials) {
+      ASSERT_EQ(percentilePartialFinalize(&pPartial->ctx, pBlock), 1);
+      pBlock->info.rows++;
+    }
+
+    SColumnInfoData *pCol = (SColumnInfoData *)taosArrayGet(pBlock->pDataBlock, 0);
+    if (pLens) {
+      for (int32_t i = 0; i < pBlock->info.rows; ++i) {
+        pLens->push_back(varDataLen(colDataGetData(pCol, i)));
+      }
+    }
+
+    aCol[0] = pCol;
+    ctx.input.startRowIndex = 0;
+    ctx.input.numOfRows = pBlock->info.rows;
+    ASSERT_EQ(percentileFunctionMerge(&ctx), TSDB_CODE_SUCCESS);
+    aCol[0] = NULL;
+    blockDataDestroy(pBlock);
+  }
+
+  // the result of one percent, NAN for a NULL result
+  double result() {
+    SSDataBlock *pBlock = createResBlock(TSDB_DATA_TYPE_DOUBLE, sizeof(double), 1);
+    EXPECT_GE(percentileFinalize(&ctx, pBlock), 0);
+    SColumnInfoData *pCol = (SColumnInfoData *)taosArrayGet(pBlock->pDataBlock, 0);
+    double           res = colDataIsNull_s(pCol, 0) ? NAN : *(double *)colDataGetData(pCol, 0);
+    blockDataDestroy(pBlock);
+    return res;
+  }
+
+  // the result of several percents
+  std::string results() {
+    SSDataBlock *pBlock = createResBlock(TSDB_DATA_TYPE_VARCHAR, 512 + VARSTR_HEADER_SIZE, 1);
+    EXPECT_GE(percentileFinalize(&ctx, pBlock), 0);
+    SColumnInfoData *pCol = (SColumnInfoData *)taosArrayGet(pBlock->pDataBlock, 0);
+    std::string      res;
+    if (!colDataIsNull_s(pCol, 0)) {
+      char *p = colDataGetData(pCol, 0);
+      res.assign(varDataVal(p), varDataLen(p));
+    }
+    blockDataDestroy(pBlock);
+    return res;
+  }
+
+  std::vector<SFunctParam> params;
+  SColumnInfoData         *aCol[1] = {NULL};
+};
+
+// the exact percentile of the values, interpolated between the two closest ones
+double exactPercentile(std::vector<int64_t> vals, double percent) {
+  std::sort(vals.begin(), vals.end());
+  double  pos = percent * (vals.size() - 1) / 100.0;
+  int32_t lower = (int32_t)pos;
+  int32_t upper = TMIN(lower + 1, (int32_t)vals.size() - 1);
+  return (1 - (pos - lower)) * vals[lower] + (pos - lower) * vals[upper];
+}
+
+// values in [-range, range), with duplicates and in no order
+std::vector<int64_t> randomVals(int64_t n, int64_t range, uint32_t seed) {
+  std::vector<int64_t> vals;
+  for (int64_t i = 0; i < n; ++i) {
+    seed = seed * 1103515245 + 12345;
+    vals.push_back((int64_t)(seed >> 8) % (2 * range) - range);
+  }
+  return vals;
+}
+
+void checkPercentiles(SPercentileTester *pTester, const std::vector<int64_t> &vals, double percent) {
+  double expected = exactPercentile(vals, percent);
+  ASSERT_NEAR(pTester->result(), expected, std::fabs(expected) * 1e-12);
+}
+
+// the result of the t-digest is the exact one of a percent off by at most 1 / compression
+void checkApproxPercentiles(SPercentileTester *pTester, const std::vector<int64_t> &vals, double percent) {
+  double error = 100.0 / tsPercentileCompression;
+  double result = pTester->result();
+  ASSERT_GE(result, exactPercentile(vals, TMAX(percent - error, 0.0)));
+  ASSERT_LE(result, exactPercentile(vals, TMIN(percent + error, 100.0)));
+}
+
+// the values of one group of the t-digest compression, kept as they are
+int32_t exactMaxNum(int32_t compression) { return (int32_t)(TDIGEST_SIZE(compression) / sizeof(double)); }
+
+class BuiltinsImplPercentileTest : public ::testing::Test {
+ protected:
+  void TearDown() override { tsPercentileCompression = 300; }
+};
+
+// batched aggregation ------------------------------------------------------------------------------------------
+
+struct SAggFuncs {
+  FExecGetEnv       getEnv;
+  FExecInit         init;
+  FExecProcess      process;
+  FExecProcessBatch processBatch;
+  FExecFinalize     finalize;
+};
+
+const std::vector<SAggFuncs> batchAggFuncs = {
+    {getCountFuncEnv, functionSetup, countFunction, countFunctionBatch, functionFinalize},
+    {getSumFuncEnv, functionSetup, sumFunction, sumFunctionBatch, functionFinalize},
+    {getMinmaxFuncEnv, minmaxFunctionSetup, minFunction, minFunctionBatch, minmaxFunctionFinalize},
+    {getMinmaxFuncEnv, minmaxFunctionSetup, maxFunction, maxFunctionBatch, minmaxFunctionFinalize},
+    {getAvgFuncEnv, avgFunctionSetup, avgFunction, avgFunctionBatch, avgFinalize},
+};
+
+// every nullStep-th row is NULL, none if it is 0
+template <typename T>
+SColumnInfoData *createNumericCol(int32_t type, const std::vector<T> &vals, int32_t nullStep) {
+  SColumnInfoData *pCol = (SColumnInfoData *)taosMemoryCalloc(1, sizeof(SColumnInfoData));
+  *pCol = createColumnInfoData(type, sizeof(T), 1);
+  colInfoDataEnsureCapacity(pCol, vals.size(), false);
+  for (int32_t i = 0; i < vals.size(); ++i) {
+    if (nullStep > 0 && i % nullStep == 0) {
+      colDataSetNULL(pCol, i);
+    } else {
+      colDataSetVal(pCol, i, (const char *)&vals[i], false);
+    }
+  }
+  return pCol;
+}
+
+// the row ranges between the bounds, accumulated one at a time and all of them in one batch, give the same results
+void checkBatchAgg(const SAggFuncs &funcs, SColumnInfoData *pCol, int32_t totalRows, const std::vector<int32_t> &bounds) {
+  SFuncExecEnv env = {0};
+  funcs.getEnv(NULL, &env);
+
+  int32_t                                   numOfSegs = bounds.size() - 1;
+  SColumnInfoData                          *aCol[1] = {pCol};
+  std::vector<std::unique_ptr<SFuncTester>> single;
+  std::vector<std::unique_ptr<SFuncTester>> batch;
+  std::vector<SFuncRowSegment>              segs;
+
+  for (int32_t i = 0; i < numOfSegs; ++i) {
+    single.emplace_back(new SFuncTester(env.calcMemSize));
+    batch.emplace_back(new SFuncTester(env.calcMemSize));
+    for (SFuncTester *pTester : {single.back().get(), batch.back().get()}) {
+      pTester->ctx.input.pData = aCol;
+      pTester->ctx.input.totalRows = totalRows;
+      funcs.init(&pTester->ctx, pTester->pResInfo);
+    }
+
+    SqlFunctionCtx *pCtx = &single.back()->ctx;
+    pCtx->input.startRowIndex = bounds[i];
+    pCtx->input.numOfRows = bounds[i + 1] - bounds[i];
+    ASSERT_EQ(funcs.process(pCtx), TSDB_CODE_SUCCESS);
+    segs.push_back({bounds[i], bounds[i + 1] - bounds[i], batch.back()->pResInfo});
+  }
+  ASSERT_EQ(funcs.processBatch(&batch[0]->ctx, segs.data(), numOfSegs), TSDB_CODE_SUCCESS);
+
+  // min and max keep the input type, the others are of 8 bytes
+  bool         minmax = (funcs.finalize == minmaxFunctionFinalize);
+  int32_t      resType = minmax ? pCol->info.type : TSDB_DATA_TYPE_BIGINT;
+  int32_t      resBytes = minmax ? pCol->info.bytes : sizeof(int64_t);
+  SSDataBlock *pSingle = createResBlock(resType, resBytes, numOfSegs);
+  SSDataBlock *pBatch = createResBlock(resType, resBytes, numOfSegs);
+  for (int32_t i = 0; i < numOfSegs; ++i) {
+    funcs.finalize(&single[i]->ctx, pSingle);
+    pSingle->info.rows++;
+    funcs.finalize(&batch[i]->ctx, pBatch);
+    pBatch->info.rows++;
+  }
+
+  SColumnInfoData *pSingleCol = (SColumnInfoData *)taosArrayGet(pSingle->pDataBlock, 0);
+  SColumnInfoData *pBatchCol = (SColumnInfoData *)taosArrayGet(pBatch->pDataBlock, 0);
+  for (int32_t i = 0; i < numOfSegs; ++i) {
+    ASSERT_EQ(single[i]->pResInfo->numOfRes, batch[i]->pResInfo->numOfRes);
+    ASSERT_EQ(colDataIsNull_s(pSingleCol, i), colDataIsNull_s(pBatchCol, i));
+    if (!colDataIsNull_s(pSingleCol, i)) {
+      ASSERT_EQ(memcmp(colDataGetData(pSingleCol, i), colDataGetData(pBatchCol, i), resBytes), 0);
+    }
+  }
+
+  blockDataDestroy(pSingle);
+  blockDataDestroy(pBatch);
+}
+
+// the bounds of consecutive windows of 1 to maxLen rows
+std::vector<int32_t> windowBounds(int32_t numOfRows, int32_t maxLen) {
+  std::vector<int32_t> bounds = {0, 1};
+  for (int32_t i = 0; bounds.back() < numOfRows; ++i) {
+    bounds.push_back(TMIN(bounds.back() + 1 + i % maxLen, numOfRows));
+  }
+  return bounds;
+}
+
+class BuiltinsImplBatchTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    simdBuiltins = tsSIMDBuiltins;
+    tsSIMDBuiltins = false;
+  }
+  void TearDown() override { tsSIMDBuiltins = simdBuiltins; }
+
+  bool simdBuiltins = false;
+};
+
+}  // namespace
+
+TEST(BuiltinsImplTest, hllSparseRoundTrip) {
+  checkHllRoundTrip({seq(0, 10), seq(5, 10), seq(100, 1)}, 16, false);
+  checkHllRoundTrip({seq(0, 1000), seq(500, 1000)}, 1500, false);
+}
+
+TEST(BuiltinsImplTest, hllDenseRoundTrip) {
+  checkHllRoundTrip({seq(0, 100000), seq(50000, 100000), seq(1000000, 20000, 7)}, 170000, true);
+}
+
+// a small group merged with large ones, and partial results merged again
+TEST(BuiltinsImplTest, hllMixedRoundTrip) {
+  SHllTester small, large, all;
+  small.add(seq(-50, 100));
+  large.add(seq(0, 200000));
+  all.add(seq(-50, 100));
+  all.add(seq(0, 200000));
+
+  std::vector<int32_t> lens;
+  SHllTester           merged1;
+  merged1.merge({&small}, &lens);
+  SHllTester merged2;
+  merged2.merge({&merged1, &large}, &lens);
+
+  ASSERT_EQ(lens.size(), 3);
+  ASSERT_LT(lens[0], getHLLInfoSize());
+  ASSERT_EQ(lens[1], lens[0]);
+  ASSERT_EQ(lens[2], getHLLInfoSize());
+
+  int64_t estimate = merged2.estimate();
+  ASSERT_EQ(estimate, all.estimate());
+  ASSERT_LE(std::abs(estimate - 200050), 200050 * 0.03);
+}
+
+// an empty group gives an empty sparse result, which merges to nothing
+TEST(BuiltinsImplTest, hllEmptyRoundTrip) {
+  SHllTester           empty, merged;
+  std::vector<int32_t> lens;
+  empty.add({});
+  merged.merge({&empty}, &lens);
+  ASSERT_EQ(lens[0], sizeof(int8_t) + sizeof(uint64_t));
+  ASSERT_EQ(merged.estimate(), 0);
+}
+
+// the row is small, the registers beyond it are kept out of the row until the result is taken
+TEST(BuiltinsImplTest, hllOutOfRowRegisters) {
+  ASSERT_LE(SHllTester::hllInterBufSize(false), 1100);
+
+  for (int64_t n : {100, 1000, 100000}) {
+    SHllTester small, full(true);
+    small.add(seq(0, n));
+    full.add(seq(0, n));
+    ASSERT_EQ(small.partial(), full.partial());
+  }
+
+  SHllTester small, full(true);
+  small.add(seq(0, 100000));
+  full.add(seq(0, 100000));
+  ASSERT_EQ(small.estimate(), full.estimate());
+
+  // a group not finalized is released by the cleanup
+  SHllTester unfinished;
+  unfinished.add(seq(0, 100000));
+}
+
+// the buffer saved by an older version is restored to the same registers of a stream state row, the group goes on
+TEST(BuiltinsImplTest, hllLegacyInfo) {
+  for (int64_t n : {100, 100000}) {
+    SHllTester tester(true), restored(true);
+    tester.add(seq(0, n));
+
+    std::vector<char> legacy = toLegacyInfo(tester.partial());
+    ASSERT_EQ(hllDecodeLegacyInfo(legacy.data(), (char *)GET_ROWCELL_INTERBUF(restored.pResInfo)), TSDB_CODE_SUCCESS);
+    restored.pResInfo->numOfRes = tester.pResInfo->numOfRes;  // the entry info is restored as it is
+    ASSERT_EQ(restored.partial(), tester.partial());
+    ASSERT_EQ(restored.estimate(), tester.estimate());
+
+    tester.add(seq(n, 5000));
+    restored.add(seq(n, 5000));
+    ASSERT_EQ(restored.estimate(), tester.estimate());
+  }
+}
+
+// a group kept in the row as it is, the result is the one of the sorted values
+TEST_F(BuiltinsImplPercentileTest, smallGroup) {
+  std::vector<int64_t> vals = randomVals(exactMaxNum(tsPercentileCompression), 500, 1);
+  for (double percent : {0.0, 1.0, 33.3, 50.0, 99.9, 100.0}) {
+    SPercentileTester tester({percent});
+    tester.add(vals, 100);
+    checkPercentiles(&tester, vals, percent);
+  }
+
+  SPercentileTester one({50});
+  one.add({42});
+  ASSERT_EQ(one.result(), 42);
+
+  SPercentileTester several({0, 50, 100});
+  several.add({4, 1, 3, 2});
+  ASSERT_EQ(several.results(), "[1.000000, 2.500000, 4.000000]");
+}
+
+// a group moved into the t-digest, the smallest and the largest values stay exact
+TEST_F(BuiltinsImplPercentileTest, largeGroup) {
+  std::vector<int64_t> vals = randomVals(100000, 1000000, 2);
+  for (double percent : {10.0, 50.0, 77.7, 99.0}) {
+    SPercentileTester tester({percent});
+    tester.add(vals);
+    checkApproxPercentiles(&tester, vals, percent);
+  }
+
+  SPercentileTester extremes({0, 100});
+  extremes.add(vals);
+  int64_t minVal = *std::min_element(vals.begin(), vals.end());
+  int64_t maxVal = *std::max_element(vals.begin(), vals.end());
+  char    expected[64] = {0};
+  snprintf(expected, sizeof(expected), "[%.6lf, %.6lf]", (double)minVal, (double)maxVal);
+  ASSERT_EQ(extremes.results(), expected);
+}
+
+// a larger compression keeps more values exactly, and gives a smaller error after that
+TEST_F(BuiltinsImplPercentileTest, compression) {
+  for (int32_t compression : {TSDB_MIN_PERCENTILE_COMPRESSION, TSDB_MAX_PERCENTILE_COMPRESSION}) {
+    tsPercentileCompression = compression;
+
+    std::vector<int64_t> small = randomVals(exactMaxNum(compression), 100000, 7);
+    SPercentileTester    exact({50});
+    exact.add(small);
+    checkPercentiles(&exact, small, 50);
+
+    std::vector<int64_t> large = randomVals(200000, 100000, 8);
+    for (double percent : {1.0, 25.0, 50.0, 90.0}) {
+      SPercentileTester tester({percent});
+      tester.add(large);
+      checkApproxPercentiles(&tester, large, percent);
+    }
+  }
+
+  ASSERT_LT(exactMaxNum(TSDB_MIN_PERCENTILE_COMPRESSION), exactMaxNum(TSDB_MAX_PERCENTILE_COMPRESSION));
+}
+
+TEST_F(BuiltinsImplPercentileTest, emptyGroup) {
+  SPercentileTester empty({50});
+  empty.add({});
+  ASSERT_TRUE(std::isnan(empty.result()));
+
+  SPercentileTester several({10, 90});
+  several.add({});
+  ASSERT_EQ(several.results(), "");
+}
+
+// combined groups, small and large ones
+TEST_F(BuiltinsImplPercentileTest, combine) {
+  std::vector<int64_t> vals1 = randomVals(50000, 100000, 4);
+  std::vector<int64_t> vals2 = randomVals(500, 100000, 5);
+  std::vector<int64_t> vals3 = randomVals(20000, 1000, 6);
+  std::vector<int64_t> all;
+  all.insert(all.end(), vals1.begin(), vals1.end());
+  all.insert(all.end(), vals2.begin(), vals2.end());
+  all.insert(all.end(), vals3.begin(), vals3.end());
+
+  SPercentileTester dst({90}), src1({90}), src2({90});
+  dst.add(vals2);
+  src1.add(vals1);
+  src2.add(vals3);
+  dst.combine(&src1);
+  dst.combine(&src2);
+  checkApproxPercentiles(&dst, all, 90);
+
+  // small groups combined stay exact
+  SPercentileTester small1({50}), small2({50});
+  small1.add({5, 1, 3});
+  small2.add({2, 4});
+  small1.combine(&small2);
+  ASSERT_EQ(small1.result(), 3);
+}
+
+// the partial results of the vnodes carry only the values in use while they are exact, and merge to the result
+TEST_F(BuiltinsImplPercentileTest, partialMerge) {
+  std::vector<int64_t> vals1 = randomVals(300, 10000, 9);
+  std::vector<int64_t> vals2 = randomVals(200, 10000, 10);
+  std::vector<int64_t> all;
+  all.insert(all.end(), vals1.begin(), vals1.end());
+  all.insert(all.end(), vals2.begin(), vals2.end());
+
+  SPercentileTester    part1({33.3}), part2({33.3}), merged({33.3});
+  std::vector<int32_t> lens;
+  part1.add(vals1);
+  part2.add(vals2);
+  merged.merge({&part1, &part2}, &lens);
+  ASSERT_EQ(lens.size(), 2);
+  ASSERT_EQ(lens[1] - lens[0], (200 - 300) * (int32_t)sizeof(double));
+  ASSERT_LT(lens[0], getPercentileMaxSize());
+  checkPercentiles(&merged, all, 33.3);
+
+  // large partial results of vnodes of another compression, and a small one
+  tsPercentileCompression = TSDB_MAX_PERCENTILE_COMPRESSION;
+  std::vector<int64_t> vals3 = randomVals(100000, 1000000, 11);
+  std::vector<int64_t> vals4 = randomVals(60000, 500000, 12);
+  SPercentileTester    part3({95}), part4({95}), part5({95});
+  part3.add(vals3);
+  part4.add(vals4);
+  part5.add(vals1);
+
+  tsPercentileCompression = TSDB_MIN_PERCENTILE_COMPRESSION;
+  SPercentileTester large({95});
+  lens.clear();
+  large.merge({&part3, &part4, &part5}, &lens);
+  ASSERT_EQ(lens[0], getPercentileMaxSize());
+  ASSERT_EQ(lens[1], getPercentileMaxSize());
+
+  all = vals3;
+  all.insert(all.end(), vals4.begin(), vals4.end());
+  all.insert(all.end(), vals1.begin(), vals1.end());
+  checkApproxPercentiles(&large, all, 95);
+}
+
+// the windows are accumulated one at a time and in one batch, with and without NULL values
+TEST_F(BuiltinsImplBatchTest, bigintWindows) {
+  std::vector<int64_t> vals = randomVals(1000, INT32_MAX, 7);
+  std::vector<int32_t> bounds = windowBounds(vals.size(), 17);
+
+  for (int32_t nullStep : {0, 1, 3}) {
+    SColumnInfoData *pCol = createNumericCol(TSDB_DATA_TYPE_BIGINT, vals, nullStep);
+    for (const SAggFuncs &funcs : batchAggFuncs) {
+      checkBatchAgg(funcs, pCol, vals.size(), bounds);
+    }
+    destroyCol(pCol);
+  }
+}
+
+TEST_F(BuiltinsImplBatchTest, numericWindows) {
+  std::vector<int64_t> vals = randomVals(500, 100, 11);
+  std::vector<int32_t> bounds = windowBounds(vals.size(), 9);
+
+  std::vector<int8_t>   i8(vals.begin(), vals.end());
+  std::vector<uint16_t> u16(vals.size());
+  std::vector<int32_t>  i32(vals.begin(), vals.end());
+  std::vector<float>    f32(vals.begin(), vals.end());
+  std::vector<double>   f64(vals.size());
+  for (int32_t i = 0; i < vals.size(); ++i) {
+    u16[i] = (uint16_t)(vals[i] + 100);
+    f64[i] = vals[i] / 7.0;
+  }
+
+  for (int32_t nullStep : {0, 4}) {
+    std::vector<SColumnInfoData *> cols = {
+        createNumericCol(TSDB_DATA_TYPE_TINYINT, i8, nullStep),
+        createNumericCol(TSDB_DATA_TYPE_USMALLINT, u16, nullStep),
+        createNumericCol(TSDB_DATA_TYPE_INT, i32, nullStep),
+        createNumericCol(TSDB_DATA_TYPE_FLOAT, f32, nullStep),
+        createNumericCol(TSDB_DATA_TYPE_DOUBLE, f64, nullStep),
+    };
+    for (SColumnInfoData *pCol : cols) {
+      for (const SAggFuncs &funcs : batchAggFuncs) {
+        checkBatchAgg(funcs, pCol, vals.size(), bounds);
+      }
+      destroyCol(pCol);
+    }
+  }
+}
+
+#pragma GCC diagnostic pop
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _TD_INDEX_BITMAP_H_
+#define _TD_INDEX_BITMAP_H_
+
+#include "tarray.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * compressed uid set, roaring style
+ * the uid is split into the high 48 bits, which is the key of container, and the low 16 bits stored in the container.
+ * a container is a sorted uint16 array when it holds no more than IDX_BM_ARRAY_MAX uids, otherwise a 65536 bits
+ * bitmap. The uids made by tGenIdPI64 are adjacent only if they are made in the same 256ms, so the tables created
+ * over time are scattered over the containers. The set keeps the uids in a sorted array until they are at least
+ * IDX_BM_DENSE_MIN for each container on average.
+ */
+#define IDX_BM_ARRAY_MAX 4096
+#define IDX_BM_DENSE_MIN 16
+
+typedef struct SIdxBitmap {
+  bool    dense;  // the uids are in conts, otherwise in uids
+  SArray *uids;   // uint64_t, sorted
+  SArray *conts;  // SIdxBmContainer, sorted by key
+} SIdxBitmap;
+
+SIdxBitmap *idxBitmapCreate();
+void        idxBitmapDestroy(SIdxBitmap *bm);
+void        idxBitmapClear(SIdxBitmap *bm);
+
+int32_t idxBitmapAdd(SIdxBitmap *bm, uint64_t uid);
+int32_t idxBitmapAddBatch(SIdxBitmap *bm, const uint64_t *uids, int32_t num);
+bool    idxBitmapContains(const SIdxBitmap *bm, uint64_t uid);
+int64_t idxBitmapGetCard(const SIdxBitmap *bm);
+
+/*
+ * set operations, the result is saved in dst
+ */
+int32_t idxBitmapAnd(SIdxBitmap *dst, const SIdxBitmap *src);
+int32_t idxBitmapOr(SIdxBitmap *dst, const SIdxBitmap *src);
+int32_t idxBitmapAndNot(SIdxBitmap *dst, const SIdxBitmap *src);
+
+/*
+ * append all uids in ascending order
+ */
+int32_t idxBitmapToArray(const SIdxBitmap *bm, SArray *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
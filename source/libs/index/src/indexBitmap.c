@@ -0,0 +1,848 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "indexBitmap.h"
+#include "taoserror.h"
+
+#define IDX_BM_ARRAY  0
+#define IDX_BM_BITMAP 1
+#define IDX_BM_WORDS  1024  // 65536 bits
+
+#define IDX_BM_KEY(uid) ((uid) >> 16)
+#define IDX_BM_LOW(uid) ((uint16_t)((uid)&0xFFFF))
+
+typedef enum { BM_OP_AND = 0, BM_OP_OR, BM_OP_ANDNOT } EBmOpType;
+
+typedef struct SIdxBmContainer {
+  uint64_t key;   // high 48 bits of uid
+  int8_t   type;  // IDX_BM_ARRAY or IDX_BM_BITMAP
+  int32_t  card;  // number of uids
+  int32_t  cap;   // capacity of array container
+  void    *data;  // sorted uint16_t array, or IDX_BM_WORDS uint64_t words
+} SIdxBmContainer;
+
+static FORCE_INLINE int32_t bmPopcount(uint64_t w) {
+#ifdef WINDOWS
+  return (int32_t)__popcnt64(w);
+#else
+  return __builtin_popcountll(w);
+#endif
+}
+
+// first position in [s, e) of which the value is not less than v
+static FORCE_INLINE int32_t bmArrayLowerBound(const uint16_t *arr, int32_t s, int32_t e, uint16_t v) {
+  while (s < e) {
+    int32_t m = s + ((e - s) >> 1);
+    if (arr[m] < v) {
+      s = m + 1;
+    } else {
+      e = m;
+    }
+  }
+  return s;
+}
+
+static FORCE_INLINE int32_t bmUidLowerBound(const uint64_t *arr, int32_t s, int32_t e, uint64_t v) {
+  while (s < e) {
+    int32_t m = s + ((e - s) >> 1);
+    if (arr[m] < v) {
+      s = m + 1;
+    } else {
+      e = m;
+    }
+  }
+  return s;
+}
+
+static int32_t bmWordsCard(const uint64_t *words) {
+  int32_t card = 0;
+  for (int32_t i = 0; i < IDX_BM_WORDS; i++) {
+    card += bmPopcount(words[i]);
+  }
+  return card;
+}
+
+// combine two bitmap containers word by word, return the cardinality of result
+static int32_t bmWordsOp(uint64_t *dst, const uint64_t *src, EBmOpType op) {
+#if __AVX2__
+  if (tsAVX2Enable && tsSIMDBuiltins) {
+    for (int32_t i = 0; i < IDX_BM_WORDS; i += 4) {
+      __m256i a = _mm256_loadu_si256((const __m256i *)(dst + i));
+      __m256i b = _mm256_loadu_si256((const __m256i *)(src + i));
+      if (op == BM_OP_AND) {
+        a = _mm256_and_si256(a, b);
+      } else if (op == BM_OP_OR) {
+        a = _mm256_or_si256(a, b);
+      } else {
+        a = _mm256_andnot_si256(b, a);
+      }
+      _mm256_storeu_si256((__m256i *)(dst + i), a);
+    }
+    return bmWordsCard(dst);
+  }
+#endif
+
+  for (int32_t i = 0; i < IDX_BM_WORDS; i++) {
+    if (op == BM_OP_AND) {
+      dst[i] &= src[i];
+    } else if (op == BM_OP_OR) {
+      dst[i] |= src[i];
+    } else {
+      dst[i] &= ~src[i];
+    }
+  }
+  return bmWordsCard(dst);
+}
+
+static FORCE_INLINE bool bmWordsTest(const uint64_t *words, uint16_t v) {
+  return (words[v >> 6] & (1ULL << (v & 63))) != 0;
+}
+
+static FORCE_INLINE void bmContDestroy(SIdxBmContainer *c) { taosMemoryFreeClear(c->data); }
+
+static void bmContReplace(SIdxBmContainer *c, int8_t type, void *data, int32_t card, int32_t cap) {
+  taosMemoryFree(c->data);
+  c->type = type;
+  c->data = data;
+  c->card = card;
+  c->cap = cap;
+}
+
+static int32_t bmContClone(SIdxBmContainer *dst, const SIdxBmContainer *src) {
+  int32_t size = (src->type == IDX_BM_ARRAY) ? TMAX(src->card, 1) * sizeof(uint16_t) : IDX_BM_WORDS * sizeof(uint64_t);
+
+  *dst = *src;
+  dst->data = taosMemoryMalloc(size);
+  if (dst->data == NULL) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+
+  memcpy(dst->data, src->data, (src->type == IDX_BM_ARRAY) ? src->card * sizeof(uint16_t) : size);
+  dst->cap = (src->type == IDX_BM_ARRAY) ? TMAX(src->card, 1) : 0;
+  return 0;
+}
+
+static int32_t bmArrayToBitmap(SIdxBmContainer *c) {
+  uint64_t *words = taosMemoryCalloc(IDX_BM_WORDS, sizeof(uint64_t));
+  if (words == NULL) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+
+  const uint16_t *arr = c->data;
+  for (int32_t i = 0; i < c->card; i++) {
+    words[arr[i] >> 6] |= (1ULL << (arr[i] & 63));
+  }
+
+  bmContReplace(c, IDX_BM_BITMAP, words, c->card, 0);
+  return 0;
+}
+
+static int32_t bmBitmapToArray(SIdxBmContainer *c) {
+  uint16_t *arr = taosMemoryMalloc(TMAX(c->card, 1) * sizeof(uint16_t));
+  if (arr == NULL) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+
+  const uint64_t *words = c->data;
+  int32_t         n = 0;
+  for (int32_t i = 0; i < IDX_BM_WORDS; i++) {
+    uint64_t w = words[i];
+    while (w != 0) {
+      arr[n++] = (uint16_t)((i << 6) + BUILDIN_CTZL(w));
+      w &= (w - 1);
+    }
+  }
+
+  bmContReplace(c, IDX_BM_ARRAY, arr, n, TMAX(n, 1));
+  return 0;
+}
+
+// keep the bitmap container only if it is too large to be an array container
+static FORCE_INLINE int32_t bmBitmapShrink(SIdxBmContainer *c) {
+  return (c->card <= IDX_BM_ARRAY_MAX) ? bmBitmapToArray(c) : 0;
+}
+
+static int32_t bmContAdd(SIdxBmContainer *c, uint16_t v) {
+  if (c->type == IDX_BM_BITMAP) {
+    uint64_t *words = c->data;
+    if (!bmWordsTest(words, v)) {
+      words[v >> 6] |= (1ULL << (v & 63));
+      c->card += 1;
+    }
+    return 0;
+  }
+
+  uint16_t *arr = c->data;
+  int32_t   pos = bmArrayLowerBound(arr, 0, c->card, v);
+  if (pos < c->card && arr[pos] == v) {
+    return 0;
+  }
+
+  if (c->card >= IDX_BM_ARRAY_MAX) {
+    int32_t code = bmArrayToBitmap(c);
+    if (code != 0) {
+      return code;
+    }
+    return bmContAdd(c, v);
+  }
+
+  if (c->card >= c->cap) {
+    int32_t cap = TMIN(c->cap * 2, IDX_BM_ARRAY_MAX);
+    void   *p = taosMemoryRealloc(c->data, cap * sizeof(uint16_t));
+    if (p == NULL) {
+      return TSDB_CODE_OUT_OF_MEMORY;
+    }
+    c->data = p;
+    c->cap = cap;
+    arr = p;
+  }
+
+  memmove(arr + pos + 1, arr + pos, (c->card - pos) * sizeof(uint16_t));
+  arr[pos] = v;
+  c->card += 1;
+  return 0;
+}
+
+static bool bmContContains(const SIdxBmContainer *c, uint16_t v) {
+  if (c->type == IDX_BM_BITMAP) {
+    return bmWordsTest(c->data, v);
+  }
+
+  const uint16_t *arr = c->data;
+  int32_t         pos = bmArrayLowerBound(arr, 0, c->card, v);
+  return pos < c->card && arr[pos] == v;
+}
+
+static int32_t bmContAnd(SIdxBmContainer *a, const SIdxBmContainer *b) {
+  if (a->type == IDX_BM_ARRAY && b->type == IDX_BM_ARRAY) {
+    uint16_t       *pa = a->data;
+    const uint16_t *pb = b->data;
+    int32_t         n = 0, j = 0;
+    for (int32_t i = 0; i < a->card && j < b->card; i++) {
+      // search the rest of b from the last matched position
+      j = bmArrayLowerBound(pb, j, b->card, pa[i]);
+      if (j < b->card && pb[j] == pa[i]) {
+        pa[n++] = pa[i];
+      }
+    }
+    a->card = n;
+    return 0;
+  }
+
+  if (a->type == IDX_BM_ARRAY) {
+    uint16_t *pa = a->data;
+    int32_t   n = 0;
+    for (int32_t i = 0; i < a->card; i++) {
+      if (bmWordsTest(b->data, pa[i])) {
+        pa[n++] = pa[i];
+      }
+    }
+    a->card = n;
+    return 0;
+  }
+
+  if (b->type == IDX_BM_ARRAY) {
+    uint16_t *arr = taosMemoryMalloc(TMAX(b->card, 1) * sizeof(uint16_t));
+    if (arr == NULL) {
+      return TSDB_CODE_OUT_OF_MEMORY;
+    }
+
+    const uint16_t *pb = b->data;
+    int32_t         n = 0;
+    for (int32_t i = 0; i < b->card; i++) {
+      if (bmWordsTest(a->data, pb[i])) {
+        arr[n++] = pb[i];
+      }
+    }
+    bmContReplace(a, IDX_BM_ARRAY, arr, n, TMAX(b->card, 1));
+    return 0;
+  }
+
+  a->card = bmWordsOp(a->data, b->data, BM_OP_AND);
+  return bmBitmapShrink(a);
+}
+
+static int32_t bmContOr(SIdxBmContainer *a, const SIdxBmContainer *b) {
+  int32_t code = 0;
+  if (a->type == IDX_BM_ARRAY && b->type == IDX_BM_ARRAY) {
+    int32_t   cap = TMAX(a->card + b->card, 1);
+    uint16_t *arr = taosMemoryMalloc(cap * sizeof(uint16_t));
+    if (arr == NULL) {
+      return TSDB_CODE_OUT_OF_MEMORY;
+    }
+
+    const uint16_t *pa = a->data;
+    const uint16_t *pb = b->data;
+    int32_t         i = 0, j = 0, n = 0;
+    while (i < a->card && j < b->card) {
+      if (pa[i] < pb[j]) {
+        arr[n++] = pa[i++];
+      } else if (pa[i] > pb[j]) {
+        arr[n++] = pb[j++];
+      } else {
+        arr[n++] = pa[i++];
+        j++;
+      }
+    }
+    while (i < a->card) arr[n++] = pa[i++];
+    while (j < b->card) arr[n++] = pb[j++];
+
+    bmContReplace(a, IDX_BM_ARRAY, arr, n, cap);
+    return (n > IDX_BM_ARRAY_MAX) ? bmArrayToBitmap(a) : 0;
+  }
+
+  if (a->type == IDX_BM_ARRAY) {
+    SIdxBmContainer t = {0};
+    code = bmContClone(&t, b);
+    if (code != 0) {
+      return code;
+    }
+
+    const uint16_t *pa = a->data;
+    for (int32_t i = 0; i < a->card; i++) {
+      bmContAdd(&t, pa[i]);
+    }
+    bmContReplace(a, IDX_BM_BITMAP, t.data, t.card, 0);
+    return 0;
+  }
+
+  if (b->type == IDX_BM_ARRAY) {
+    const uint16_t *pb = b->data;
+    for (int32_t i = 0; i < b->card; i++) {
+      bmContAdd(a, pb[i]);
+    }
+    return 0;
+  }
+
+  a->card = bmWordsOp(a->data, b->data, BM_OP_OR);
+  return 0;
+}
+
+static int32_t bmContAndNot(SIdxBmContainer *a, const SIdxBmContainer *b) {
+  if (a->type == IDX_BM_ARRAY) {
+    uint16_t *pa = a->data;
+    int32_t   n = 0, j = 0;
+    for (int32_t i = 0; i < a->card; i++) {
+      bool found = false;
+      if (b->type == IDX_BM_BITMAP) {
+        found = bmWordsTest(b->data, pa[i]);
+      } else {
+        j = bmArrayLowerBound(b->data, j, b->card, pa[i]);
+        found = (j < b->card && ((const uint16_t *)b->data)[j] == pa[i]);
+      }
+      if (!found) {
+        pa[n++] = pa[i];
+      }
+    }
+    a->card = n;
+    return 0;
+  }
+
+  if (b->type == IDX_BM_ARRAY) {
+    uint64_t       *words = a->data;
+    const uint16_t *pb = b->data;
+    for (int32_t i = 0; i < b->card; i++) {
+      if (bmWordsTest(words, pb[i])) {
+        words[pb[i] >> 6] &= ~(1ULL << (pb[i] & 63));
+        a->card -= 1;
+      }
+    }
+  } else {
+    a->card = bmWordsOp(a->data, b->data, BM_OP_ANDNOT);
+  }
+  return bmBitmapShrink(a);
+}
+
+static int32_t bmContRemove(SIdxBmContainer *c, uint16_t v) {
+  if (c->type == IDX_BM_BITMAP) {
+    uint64_t *words = c->data;
+    if (bmWordsTest(words, v)) {
+      words[v >> 6] &= ~(1ULL << (v & 63));
+      c->card -= 1;
+    }
+    return bmBitmapShrink(c);
+  }
+
+  uint16_t *arr = c->data;
+  int32_t   pos = bmArrayLowerBound(arr, 0, c->card, v);
+  if (pos < c->card && arr[pos] == v) {
+    memmove(arr + pos, arr + pos + 1, (c->card - pos - 1) * sizeof(uint16_t));
+    c->card -= 1;
+  }
+  return 0;
+}
+
+// position of the container with the given key, or the position to insert it
+static int32_t bmFindCont(const SIdxBitmap *bm, uint64_t key, bool *found) {
+  int32_t s = 0, e = (int32_t)taosArrayGetSize(bm->conts);
+  while (s < e) {
+    int32_t          m = s + ((e - s) >> 1);
+    SIdxBmContainer *c = taosArrayGet(bm->conts, m);
+    if (c->key < key) {
+      s = m + 1;
+    } else {
+      e = m;
+    }
+  }
+
+  *found = (s < taosArrayGetSize(bm->conts) && ((SIdxBmContainer *)taosArrayGet(bm->conts, s))->key == key);
+  return s;
+}
+
+static void bmContsClear(SIdxBitmap *bm) {
+  for (int32_t i = 0; i < taosArrayGetSize(bm->conts); i++) {
+    bmContDestroy(taosArrayGet(bm->conts, i));
+  }
+  taosArrayClear(bm->conts);
+}
+
+static int32_t bmContsAdd(SIdxBitmap *bm, uint64_t uid) {
+  uint64_t         key = IDX_BM_KEY(uid);
+  SIdxBmContainer *c = taosArrayGetLast(bm->conts);
+
+  // uids are usually added in ascending order
+  if (c == NULL || c->key != key) {
+    bool    found = false;
+    int32_t pos = (c == NULL || c->key < key) ? (int32_t)taosArrayGetSize(bm->conts) : bmFindCont(bm, key, &found);
+    if (!found) {
+      SIdxBmContainer nc = {.key = key, .type = IDX_BM_ARRAY, .card = 0, .cap = 4};
+      nc.data = taosMemoryMalloc(nc.cap * sizeof(uint16_t));
+      if (nc.data == NULL || taosArrayInsert(bm->conts, pos, &nc) == NULL) {
+        taosMemoryFree(nc.data);
+        return TSDB_CODE_OUT_OF_MEMORY;
+      }
+    }
+    c = taosArrayGet(bm->conts, pos);
+  }
+
+  return bmContAdd(c, IDX_BM_LOW(uid));
+}
+
+static bool bmContsContains(const SIdxBitmap *bm, uint64_t uid) {
+  bool    found = false;
+  int32_t pos = bmFindCont(bm, IDX_BM_KEY(uid), &found);
+  return found && bmContContains(taosArrayGet(bm->conts, pos), IDX_BM_LOW(uid));
+}
+
+static int64_t bmContsCard(const SIdxBitmap *bm) {
+  int64_t card = 0;
+  for (int32_t i = 0; i < taosArrayGetSize(bm->conts); i++) {
+    card += ((SIdxBmContainer *)taosArrayGet(bm->conts, i))->card;
+  }
+  return card;
+}
+
+static int32_t bmContsToArray(const SIdxBitmap *bm, SArray *out) {
+  int64_t card = bmContsCard(bm);
+  if (card == 0) {
+    return 0;
+  }
+
+  uint64_t *p = taosArrayReserve(out, (int32_t)card);
+  if (p == NULL) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+
+  for (int32_t i = 0; i < taosArrayGetSize(bm->conts); i++) {
+    const SIdxBmContainer *c = taosArrayGet(bm->conts, i);
+    uint64_t               base = c->key << 16;
+    if (c->type == IDX_BM_ARRAY) {
+      const uint16_t *arr = c->data;
+      for (int32_t k = 0; k < c->card; k++) {
+        *p++ = base | arr[k];
+      }
+    } else {
+      const uint64_t *words = c->data;
+      for (int32_t k = 0; k < IDX_BM_WORDS; k++) {
+        uint64_t w = words[k];
+        while (w != 0) {
+          *p++ = base | (uint64_t)((k << 6) + BUILDIN_CTZL(w));
+          w &= (w - 1);
+        }
+      }
+    }
+  }
+  return 0;
+}
+
+// move the sorted uids to the containers, if they are dense enough in the containers
+static int32_t bmTryDense(SIdxBitmap *bm) {
+  int32_t n = (int32_t)taosArrayGetSize(bm->uids);
+  if (bm->dense || n < IDX_BM_ARRAY_MAX) {
+    return 0;
+  }
+
+  const uint64_t *uids = TARRAY_DATA(bm->uids);
+  int32_t         numOfKeys = 1;
+  for (int32_t i = 1; i < n; i++) {
+    numOfKeys += (IDX_BM_KEY(uids[i]) != IDX_BM_KEY(uids[i - 1]));
+  }
+  if (n < (int64_t)numOfKeys * IDX_BM_DENSE_MIN) {
+    return 0;
+  }
+
+  for (int32_t i = 0; i < n; i++) {
+    int32_t code = bmContsAdd(bm, uids[i]);
+    if (code != 0) {
+      bmContsClear(bm);
+      return code;
+    }
+  }
+  taosArrayClear(bm->uids);
+  bm->dense = true;
+  return 0;
+}
+
+// move the uids in the containers back to the sorted array, if they are too few for the containers
+static int32_t bmTrySparse(SIdxBitmap *bm) {
+  if (!bm->dense || bmContsCard(bm) >= (int64_t)taosArrayGetSize(bm->conts) * IDX_BM_DENSE_MIN) {
+    return 0;
+  }
+
+  taosArrayClear(bm->uids);
+  int32_t code = bmContsToArray(bm, bm->uids);
+  if (code != 0) {
+    taosArrayClear(bm->uids);
+    return code;
+  }
+  bmContsClear(bm);
+  bm->dense = false;
+  return 0;
+}
+
+SIdxBitmap *idxBitmapCreate() {
+  SIdxBitmap *bm = taosMemoryCalloc(1, sizeof(SIdxBitmap));
+  if (bm == NULL) {
+    return NULL;
+  }
+
+  bm->uids = taosArrayInit(4, sizeof(uint64_t));
+  bm->conts = taosArrayInit(4, sizeof(SIdxBmContainer));
+  if (bm->uids == NULL || bm->conts == NULL) {
+    taosArrayDestroy(bm->uids);
+    taosArrayDestroy(bm->conts);
+    taosMemoryFree(bm);
+    return NULL;
+  }
+  return bm;
+}
+
+void idxBitmapClear(SIdxBitmap *bm) {
+  if (bm == NULL) {
+    return;
+  }
+  taosArrayClear(bm->uids);
+  bmContsClear(bm);
+  bm->dense = false;
+}
+
+void idxBitmapDestroy(SIdxBitmap *bm) {
+  if (bm == NULL) {
+    return;
+  }
+  idxBitmapClear(bm);
+  taosArrayDestroy(bm->uids);
+  taosArrayDestroy(bm->conts);
+  taosMemoryFree(bm);
+}
+
+int32_t idxBitmapAdd(SIdxBitmap *bm, uint64_t uid) {
+  if (bm->dense) {
+    return bmContsAdd(bm, uid);
+  }
+
+  int32_t   n = (int32_t)taosArrayGetSize(bm->uids);
+  uint64_t *last = taosArrayGetLast(bm->uids);
+  if (last == NULL || *last < uid) {
+    if (taosArrayPush(bm->uids, &uid) == NULL) {
+      return TSDB_CODE_OUT_OF_MEMORY;
+    }
+  } else {
+    int32_t pos = bmUidLowerBound(TARRAY_DATA(bm->uids), 0, n, uid);
+    if (((uint64_t *)TARRAY_DATA(bm->uids))[pos] == uid) {
+      return 0;
+    }
+    if (taosArrayInsert(bm->uids, pos, &uid) == NULL) {
+      return TSDB_CODE_OUT_OF_MEMORY;
+    }
+  }
+
+  // check the density once the array doubles
+  n += 1;
+  return ((n & (n - 1)) == 0) ? bmTryDense(bm) : 0;
+}
+
+int32_t idxBitmapAddBatch(SIdxBitmap *bm, const uint64_t *uids, int32_t num) {
+  for (int32_t i = 0; i < num; i++) {
+    int32_t code = idxBitmapAdd(bm, uids[i]);
+    if (code != 0) {
+      return code;
+    }
+  }
+  return 0;
+}
+
+bool idxBitmapContains(const SIdxBitmap *bm, uint64_t uid) {
+  if (bm->dense) {
+    return bmContsContains(bm, uid);
+  }
+
+  int32_t         n = (int32_t)taosArrayGetSize(bm->uids);
+  const uint64_t *uids = TARRAY_DATA(bm->uids);
+  int32_t         pos = bmUidLowerBound(uids, 0, n, uid);
+  return pos < n && uids[pos] == uid;
+}
+
+int64_t idxBitmapGetCard(const SIdxBitmap *bm) {
+  return bm->dense ? bmContsCard(bm) : (int64_t)taosArrayGetSize(bm->uids);
+}
+
+// keep the sorted uids of dst which are (or are not) in src
+static void bmUidsFilter(SIdxBitmap *dst, const SIdxBitmap *src, bool keepFound) {
+  uint64_t *uids = TARRAY_DATA(dst->uids);
+  int32_t   nd = (int32_t)taosArrayGetSize(dst->uids);
+  int32_t   n = 0;
+
+  if (src->dense) {
+    for (int32_t i = 0; i < nd; i++) {
+      if (bmContsContains(src, uids[i]) == keepFound) {
+        uids[n++] = uids[i];
+      }
+    }
+  } else {
+    const uint64_t *pb = TARRAY_DATA(src->uids);
+    int32_t         ns = (int32_t)taosArrayGetSize(src->uids);
+    int32_t         j = 0;
+    for (int32_t i = 0; i < nd; i++) {
+      // search the rest of src from the last position
+      j = bmUidLowerBound(pb, j, ns, uids[i]);
+      if ((j < ns && pb[j] == uids[i]) == keepFound) {
+        uids[n++] = uids[i];
+      }
+    }
+  }
+
+  taosArrayPopTailBatch(dst->uids, nd - n);
+}
+
+// combine the containers with the same key, drop the empty ones, and drop the ones only in dst if required
+static int32_t bmIntersectConts(SIdxBitmap *dst, const SIdxBitmap *src, EBmOpType op) {
+  int32_t code = 0;
+  int32_t nd = (int32_t)taosArrayGetSize(dst->conts);
+  int32_t ns = (int32_t)taosArrayGetSize(src->conts);
+  int32_t j = 0, n = 0;
+
+  for (int32_t i = 0; i < nd; i++) {
+    SIdxBmContainer *c = taosArrayGet(dst->conts, i);
+    while (j < ns && ((SIdxBmContainer *)taosArrayGet(src->conts, j))->key < c->key) {
+      j++;
+    }
+
+    bool match = (j < ns && ((SIdxBmContainer *)taosArrayGet(src->conts, j))->key == c->key);
+    if (code == 0 && match) {
+      code = (op == BM_OP_AND) ? bmContAnd(c, taosArrayGet(src->conts, j)) : bmContAndNot(c, taosArrayGet(src->conts, j));
+    } else if (code == 0 && op == BM_OP_AND) {
+      c->card = 0;
+    }
+
+    if (c->card == 0) {
+      bmContDestroy(c);
+    } else {
+      *(SIdxBmContainer *)taosArrayGet(dst->conts, n++) = *c;
+    }
+  }
+
+  taosArrayPopTailBatch(dst->conts, nd - n);
+  return code;
+}
+
+// drop the containers emptied by the removal
+static void bmDropEmptyConts(SIdxBitmap *bm) {
+  int32_t nd = (int32_t)taosArrayGetSize(bm->conts);
+  int32_t n = 0;
+  for (int32_t i = 0; i < nd; i++) {
+    SIdxBmContainer *c = taosArrayGet(bm->conts, i);
+    if (c->card == 0) {
+      bmContDestroy(c);
+    } else {
+      *(SIdxBmContainer *)taosArrayGet(bm->conts, n++) = *c;
+    }
+  }
+  taosArrayPopTailBatch(bm->conts, nd - n);
+}
+
+int32_t idxBitmapAnd(SIdxBitmap *dst, const SIdxBitmap *src) {
+  if (!dst->dense) {
+    bmUidsFilter(dst, src, true);
+    return 0;
+  }
+
+  if (!src->dense) {
+    // the result is no larger than src, which is sparse
+    taosArrayClear(dst->uids);
+    const uint64_t *uids = TARRAY_DATA(src->uids);
+    for (int32_t i = 0; i < taosArrayGetSize(src->uids); i++) {
+      if (bmContsContains(dst, uids[i]) && taosArrayPush(dst->uids, &uids[i]) == NULL) {
+        return TSDB_CODE_OUT_OF_MEMORY;
+      }
+    }
+    bmContsClear(dst);
+    dst->dense = false;
+    return 0;
+  }
+
+  int32_t code = bmIntersectConts(dst, src, BM_OP_AND);
+  return (code == 0) ? bmTrySparse(dst) : code;
+}
+
+int32_t idxBitmapAndNot(SIdxBitmap *dst, const SIdxBitmap *src) {
+  if (!dst->dense) {
+    bmUidsFilter(dst, src, false);
+    return 0;
+  }
+
+  int32_t code = 0;
+  if (src->dense) {
+    code = bmIntersectConts(dst, src, BM_OP_ANDNOT);
+  } else {
+    const uint64_t *uids = TARRAY_DATA(src->uids);
+    for (int32_t i = 0; i < taosArrayGetSize(src->uids) && code == 0; i++) {
+      bool    found = false;
+      int32_t pos = bmFindCont(dst, IDX_BM_KEY(uids[i]), &found);
+      if (found) {
+        code = bmContRemove(taosArrayGet(dst->conts, pos), IDX_BM_LOW(uids[i]));
+      }
+    }
+    bmDropEmptyConts(dst);
+  }
+  return (code == 0) ? bmTrySparse(dst) : code;
+}
+
+static int32_t bmUidsOr(SIdxBitmap *dst, const SIdxBitmap *src) {
+  int32_t nd = (int32_t)taosArrayGetSize(dst->uids);
+  int32_t ns = (int32_t)taosArrayGetSize(src->uids);
+  if (ns == 0) {
+    return 0;
+  }
+
+  SArray *merged = taosArrayInit(nd + ns, sizeof(uint64_t));
+  if (merged == NULL) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+
+  const uint64_t *pa = TARRAY_DATA(dst->uids);
+  const uint64_t *pb = TARRAY_DATA(src->uids);
+  uint64_t       *p = TARRAY_DATA(merged);
+  int32_t         i = 0, j = 0, n = 0;
+  while (i < nd && j < ns) {
+    if (pa[i] < pb[j]) {
+      p[n++] = pa[i++];
+    } else if (pa[i] > pb[j]) {
+      p[n++] = pb[j++];
+    } else {
+      p[n++] = pa[i++];
+      j++;
+    }
+  }
+  while (i < nd) p[n++] = pa[i++];
+  while (j < ns) p[n++] = pb[j++];
+  TARRAY_SIZE(merged) = n;
+
+  taosArrayDestroy(dst->uids);
+  dst->uids = merged;
+  return bmTryDense(dst);
+}
+
+static int32_t bmContsOr(SIdxBitmap *dst, const SIdxBitmap *src) {
+  int32_t nd = (int32_t)taosArrayGetSize(dst->conts);
+  int32_t ns = (int32_t)taosArrayGetSize(src->conts);
+  if (ns == 0) {
+    return 0;
+  }
+
+  SArray *merged = taosArrayInit(nd + ns, sizeof(SIdxBmContainer));
+  if (merged == NULL) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+
+  int32_t code = 0;
+  int32_t i = 0, j = 0;
+  while (i < nd || j < ns) {
+    SIdxBmContainer *a = (i < nd) ? taosArrayGet(dst->conts, i) : NULL;
+    SIdxBmContainer *b = (j < ns) ? taosArrayGet(src->conts, j) : NULL;
+
+    if (b == NULL || (a != NULL && a->key < b->key)) {
+      taosArrayPush(merged, a);
+      i++;
+    } else if (a == NULL || b->key < a->key) {
+      SIdxBmContainer t = {0};
+      // keep dst a valid set if failed
+      if (code == 0 && (code = bmContClone(&t, b)) == 0) {
+        taosArrayPush(merged, &t);
+      }
+      j++;
+    } else {
+      if (code == 0) {
+        code = bmContOr(a, b);
+      }
+      taosArrayPush(merged, a);
+      i++;
+      j++;
+    }
+  }
+
+  taosArrayDestroy(dst->conts);
+  dst->conts = merged;
+  return code;
+}
+
+int32_t idxBitmapOr(SIdxBitmap *dst, const SIdxBitmap *src) {
+  if (!dst->dense && !src->dense) {
+    return bmUidsOr(dst, src);
+  }
+
+  int32_t code = 0;
+  if (!dst->dense) {
+    // the dense src is the larger part of the result, the sorted uids of dst are added to its containers
+    code = bmContsOr(dst, src);
+    dst->dense = true;
+
+    const uint64_t *uids = TARRAY_DATA(dst->uids);
+    for (int32_t i = 0; i < taosArrayGetSize(dst->uids) && code == 0; i++) {
+      code = bmContsAdd(dst, uids[i]);
+    }
+    taosArrayClear(dst->uids);
+  } else if (!src->dense) {
+    const uint64_t *uids = TARRAY_DATA(src->uids);
+    for (int32_t i = 0; i < taosArrayGetSize(src->uids) && code == 0; i++) {
+      code = bmContsAdd(dst, uids[i]);
+    }
+  } else {
+    code = bmContsOr(dst, src);
+  }
+  return (code == 0) ? bmTrySparse(dst) : code;
+}
+
+int32_t idxBitmapToArray(const SIdxBitmap *bm, SArray *out) {
+  if (bm->dense) {
+    return bmContsToArray(bm, out);
+  }
+
+  if (taosArrayGetSize(bm->uids) > 0 &&
+      taosArrayAddBatch(out, TARRAY_DATA(bm->uids), (int32_t)taosArrayGetSize(bm->uids)) == NULL) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+  return 0;
+}
@@ -15,6 +15,7 @@
 
 #include "filter.h"
 #include "index.h"
+#include "indexBitmap.h"
 #include "indexComm.h"
 #include "indexInt.h"
 #include "nodes.h"
@@ -66,9 +67,10 @@ typedef union {
   } while (0);
 
 typedef struct SIFParam {
-  SHashObj *pFilter;
-  SArray   *result;
-  char     *condValue;
+  SHashObj   *pFilter;
+  SArray     *result;
+  SIdxBitmap *pBitmap;  // result of a logic condition, converted to the array only at the end of the filter
+  char       *condValue;
 
   SIdxFltStatus status;
   uint8_t       colValType;
@@ -117,6 +119,8 @@ static FORCE_INLINE void sifFreeParam(SIFParam *param) {
   if (param == NULL) return;
 
   taosArrayDestroy(param->result);
+  idxBitmapDestroy(param->pBitmap);
+  param->pBitmap = NULL;
   taosMemoryFree(param->condValue);
   param->condValue = NULL;
   taosHashCleanup(param->pFilter);
@@ -854,6 +858,70 @@ _return:
   return code;
 }
 
+/*
+ * the result of each parameter is a superset of the tables satisfying it, so is the intersection of them for AND.
+ * parameters not covered by index are skipped for AND, since they do not narrow the result.
+ * the merged result is kept as bitmap, so that nested logic conditions merge it with no conversion.
+ */
+static int32_t sifMergeLogicResult(ELogicConditionType type, SIFParam *params, int32_t nParam, SIFParam *output) {
+  int32_t     code = TSDB_CODE_SUCCESS;
+  SIdxBitmap *rslt = NULL;
+  SIdxBitmap *t = NULL;
+
+  if (type != LOGIC_COND_TYPE_AND && type != LOGIC_COND_TYPE_OR) {
+    return code;
+  }
+
+  for (int32_t m = 0; m < nParam; m++) {
+    if (type == LOGIC_COND_TYPE_AND && params[m].status == SFLT_NOT_INDEX) {
+      continue;
+    }
+
+    const SIdxBitmap *src = params[m].pBitmap;
+    if (src == NULL) {
+      t = idxBitmapCreate();
+      if (t == NULL) {
+        SIF_ERR_JRET(TSDB_CODE_OUT_OF_MEMORY);
+      }
+      int32_t sz = (int32_t)taosArrayGetSize(params[m].result);
+      if (sz > 0) {
+        SIF_ERR_JRET(idxBitmapAddBatch(t, taosArrayGet(params[m].result, 0), sz));
+      }
+      if (rslt == NULL) {
+        rslt = t;
+        t = NULL;
+        continue;
+      }
+      src = t;
+    }
+
+    if (rslt == NULL) {
+      // the bitmap of a nested logic condition still belongs to its own param
+      rslt = idxBitmapCreate();
+      if (rslt == NULL) {
+        SIF_ERR_JRET(TSDB_CODE_OUT_OF_MEMORY);
+      }
+      SIF_ERR_JRET(idxBitmapOr(rslt, src));
+    } else {
+      SIF_ERR_JRET(type == LOGIC_COND_TYPE_AND ? idxBitmapAnd(rslt, src) : idxBitmapOr(rslt, src));
+    }
+    idxBitmapDestroy(t);
+    t = NULL;
+  }
+
+  if (rslt == NULL) {
+    output->status = SFLT_NOT_INDEX;
+  } else {
+    output->pBitmap = rslt;
+    rslt = NULL;
+  }
+
+_return:
+  idxBitmapDestroy(rslt);
+  idxBitmapDestroy(t);
+  return code;
+}
+
 static int32_t sifExecLogic(SLogicConditionNode *node, SIFCtx *ctx, SIFParam *output) {
   if (NULL == node->pParameterList || node->pParameterList->length <= 0) {
     indexError("invalid logic parameter list, list:%p, paramNum:%d", node->pParameterList,
@@ -866,17 +934,7 @@ static int32_t sifExecLogic(SLogicConditionNode *node, SIFCtx *ctx, SIFParam *ou
   SIF_ERR_RET(sifInitParamList(&params, node->pParameterList, ctx));
 
   if (ctx->noExec == false) {
-    for (int32_t m = 0; m < node->pParameterList->length; m++) {
-      if (node->condType == LOGIC_COND_TYPE_AND) {
-        taosArrayAddAll(output->result, params[m].result);
-      } else if (node->condType == LOGIC_COND_TYPE_OR) {
-        taosArrayAddAll(output->result, params[m].result);
-      } else if (node->condType == LOGIC_COND_TYPE_NOT) {
-        // taosArrayAddAll(output->result, params[m].result);
-      }
-      taosArraySort(output->result, idxUidCompare);
-      taosArrayRemoveDuplicate(output->result, idxUidCompare, NULL);
-    }
+    code = sifMergeLogicResult(node->condType, params, node->pParameterList->length, output);
   } else {
     for (int32_t m = 0; m < node->pParameterList->length; m++) {
       output->status = sifMergeCond(node->condType, output->status, params[m].status);
@@ -1003,7 +1061,9 @@ static int32_t sifCalculate(SNode *pNode, SIFParam *pDst) {
       indexError("no valid res in hash, node:(%p), type(%d)", (void *)&pNode, nodeType(pNode));
       SIF_ERR_RET(TSDB_CODE_APP_ERROR);
     }
-    if (res->result != NULL) {
+    if (res->pBitmap != NULL) {
+      code = idxBitmapToArray(res->pBitmap, pDst->result);
+    } else if (res->result != NULL) {
       taosArrayAddAll(pDst->result, res->result);
     }
     pDst->status = res->status;
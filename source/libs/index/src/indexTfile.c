@@ -240,7 +240,7 @@ static int32_t tfSearchTerm(void* reader, SIndexTerm* tem, SIdxTRslt* tr) {
               tem->colName, tem->colVal, cost);
   }
   fstSliceDestroy(&key);
-  return 0;
+  return ret;
 }
 
 static int32_t tfSearchPrefix(void* reader, SIndexTerm* tem, SIdxTRslt* tr) {
@@ -326,7 +326,12 @@ static int32_t tfSearchCompareFunc(void* reader, SIndexTerm* tem, SIdxTRslt* tr,
 
     TExeCond cond = cmpFn(ch, p, tem->colType);
     if (MATCH == cond) {
-      tfileReaderLoadTableIds((TFileReader*)reader, rt->out.out, tr->total);
+      // a missing posting list would make the result no longer a superset of the matched tables
+      ret = tfileReaderLoadTableIds((TFileReader*)reader, rt->out.out, tr->total);
+      if (ret != 0) {
+        swsResultDestroy(rt);
+        break;
+      }
     } else if (CONTINUE == cond) {
     } else if (BREAK == cond) {
       swsResultDestroy(rt);
@@ -337,7 +342,7 @@ static int32_t tfSearchCompareFunc(void* reader, SIndexTerm* tem, SIdxTRslt* tr,
   stmStDestroy(st);
   stmBuilderDestroy(sb);
   taosArrayDestroy(offsets);
-  return TSDB_CODE_SUCCESS;
+  return ret;
 }
 static int32_t tfSearchLessThan(void* reader, SIndexTerm* tem, SIdxTRslt* tr) {
   return tfSearchCompareFunc(reader, tem, tr, LT);
@@ -382,7 +387,7 @@ static int32_t tfSearchTerm_JSON(void* reader, SIndexTerm* tem, SIdxTRslt* tr) {
   }
   taosMemoryFree(p);
   fstSliceDestroy(&key);
-  return 0;
+  return ret;
 }
 static int32_t tfSearchEqual_JSON(void* reader, SIndexTerm* tem, SIdxTRslt* tr) {
   return tfSearchCompareFunc_JSON(reader, tem, tr, EQ);
@@ -463,7 +468,11 @@ static int32_t tfSearchCompareFunc_JSON(void* reader, SIndexTerm* tem, SIdxTRslt
       taosMemoryFree(tBuf);
     }
     if (MATCH == cond) {
-      tfileReaderLoadTableIds((TFileReader*)reader, rt->out.out, tr->total);
+      ret = tfileReaderLoadTableIds((TFileReader*)reader, rt->out.out, tr->total);
+      if (ret != 0) {
+        swsResultDestroy(rt);
+        break;
+      }
     } else if (CONTINUE == cond) {
     } else if (BREAK == cond) {
       swsResultDestroy(rt);
@@ -476,7 +485,7 @@ static int32_t tfSearchCompareFunc_JSON(void* reader, SIndexTerm* tem, SIdxTRslt
   taosArrayDestroy(offsets);
   taosMemoryFree(p);
 
-  return TSDB_CODE_SUCCESS;
+  return ret;
 }
 int tfileReaderSearch(TFileReader* reader, SIndexTermQuery* query, SIdxTRslt* tr) {
   SIndexTerm*     term = query->term;
@@ -925,35 +934,30 @@ static int tfileReaderLoadFst(TFileReader* reader) {
   return reader->fst != NULL ? 0 : -1;
 }
 static int tfileReaderLoadTableIds(TFileReader* reader, int32_t offset, SArray* result) {
-  // TODO(yihao): opt later
   IFileCtx* ctx = reader->ctx;
-  // add block cache
-  char    block[4096] = {0};
-  int32_t nread = ctx->readFrom(ctx, block, sizeof(block), offset);
-  ASSERT(nread >= sizeof(uint32_t));
-
-  char*   p = block;
-  int32_t nid = *(int32_t*)p;
-  p += sizeof(nid);
-
-  while (nid > 0) {
-    int32_t left = block + sizeof(block) - p;
-    if (left >= sizeof(uint64_t)) {
-      taosArrayPush(result, (uint64_t*)p);
-      p += sizeof(uint64_t);
-    } else {
-      char buf[sizeof(uint64_t)] = {0};
-      memcpy(buf, p, left);
 
-      memset(block, 0, sizeof(block));
-      offset += sizeof(block);
-      nread = ctx->readFrom(ctx, block, sizeof(block), offset);
-      memcpy(buf + left, block, sizeof(uint64_t) - left);
+  int32_t nid = 0;
+  int32_t nread = ctx->readFrom(ctx, (uint8_t*)&nid, sizeof(nid), offset);
+  if (nread != sizeof(nid)) {
+    indexError("failed to load the number of table ids, file:%s, offset:%d, read:%d", ctx->file.buf, offset, nread);
+    return TSDB_CODE_INDEX_INVALID_FILE;
+  }
+  if (nid <= 0) {
+    return 0;
+  }
+
+  // the posting list is read into the result directly, which is cached by block in file ctx
+  uint64_t* p = taosArrayReserve(result, nid);
+  if (p == NULL) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
 
-      taosArrayPush(result, (uint64_t*)buf);
-      p = block + sizeof(uint64_t) - left;
-    }
-    nid -= 1;
+  int32_t len = nid * (int32_t)sizeof(uint64_t);
+  nread = ctx->readFrom(ctx, (uint8_t*)p, len, offset + sizeof(nid));
+  if (nread != len) {
+    indexError("failed to load table ids, file:%s, expect:%d, actual:%d", ctx->file.buf, len, nread);
+    taosArrayPopTailBatch(result, nid);
+    return TSDB_CODE_INDEX_INVALID_FILE;
   }
   return 0;
 }
@@ -14,8 +14,12 @@
  */
 #include "indexUtil.h"
 #include "index.h"
+#include "indexBitmap.h"
 #include "tcompare.h"
 
+// the unsorted results are merged by bitmap, with no sort, if there are at least so many uids
+#define INDEX_BITMAP_MERGE_NUM 1024
+
 typedef struct MergeIndex {
   int idx;
   int len;
@@ -36,6 +40,18 @@ static FORCE_INLINE int iBinarySearch(SArray *arr, int s, int e, uint64_t k) {
   return s;
 }
 
+static SIdxBitmap *iBitmapCreateFrom(SArray *uids) {
+  SIdxBitmap *bm = idxBitmapCreate();
+  if (bm == NULL) {
+    return NULL;
+  }
+  if (taosArrayGetSize(uids) > 0 && idxBitmapAddBatch(bm, TARRAY_GET_ELEM(uids, 0), taosArrayGetSize(uids)) != 0) {
+    idxBitmapDestroy(bm);
+    return NULL;
+  }
+  return bm;
+}
+
 void iIntersection(SArray *in, SArray *out) {
   int32_t sz = (int32_t)taosArrayGetSize(in);
   if (sz <= 0) {
@@ -183,7 +199,37 @@ void idxTRsltDestroy(SIdxTRslt *tr) {
   taosArrayDestroy(tr->del);
   taosMemoryFree(tr);
 }
+// (total | add) & ~del, no sort needed
+static int32_t idxTRsltMergeByBitmap(SIdxTRslt *tr, SArray *result) {
+  int32_t     code = TSDB_CODE_OUT_OF_MEMORY;
+  SIdxBitmap *total = iBitmapCreateFrom(tr->total);
+  SIdxBitmap *add = iBitmapCreateFrom(tr->add);
+  SIdxBitmap *del = iBitmapCreateFrom(tr->del);
+  if (total == NULL || add == NULL || del == NULL) {
+    goto _exception;
+  }
+
+  code = idxBitmapOr(total, add);
+  if (code == 0) {
+    code = idxBitmapAndNot(total, del);
+  }
+  if (code == 0) {
+    code = idxBitmapToArray(total, result);
+  }
+
+_exception:
+  idxBitmapDestroy(total);
+  idxBitmapDestroy(add);
+  idxBitmapDestroy(del);
+  return code;
+}
+
 void idxTRsltMergeTo(SIdxTRslt *tr, SArray *result) {
+  int64_t sz = taosArrayGetSize(tr->total) + taosArrayGetSize(tr->add) + taosArrayGetSize(tr->del);
+  if (sz >= INDEX_BITMAP_MERGE_NUM && taosArrayGetSize(result) == 0 && idxTRsltMergeByBitmap(tr, result) == 0) {
+    return;
+  }
+
   taosArraySort(tr->total, uidCompare);
   taosArraySort(tr->add, uidCompare);
   taosArraySort(tr->del, uidCompare);
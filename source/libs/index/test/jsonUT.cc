@@ -5,6 +5,7 @@
 #include <thread>
 #include <vector>
 #include "index.h"
+#include "indexBitmap.h"
 #include "indexCache.h"
 #include "indexFst.h"
 #include "indexFstUtil.h"
@@ -644,3 +645,64 @@ TEST_F(JsonEnv, testWriteJsonTfileAndCache_DOUBLE) {
     EXPECT_EQ(1000, taosArrayGetSize(res));
   }
 }
+
+static bool cmpByQueryType(int v, int t, int8_t type) {
+  switch (type) {
+    case QUERY_TERM:
+      return v == t;
+    case QUERY_GREATER_THAN:
+      return v > t;
+    case QUERY_GREATER_EQUAL:
+      return v >= t;
+    case QUERY_LESS_THAN:
+      return v < t;
+    default:
+      return v <= t;
+  }
+}
+
+static SIdxBitmap* SearchBitmap(SIndexJson* index, const std::string& colName, int val, int8_t type) {
+  SArray* res = NULL;
+  Search(index, colName, TSDB_DATA_TYPE_INT, &val, sizeof(val), type, &res);
+  SIdxBitmap* bm = idxBitmapCreate();
+  if (taosArrayGetSize(res) > 0) {
+    idxBitmapAddBatch(bm, (const uint64_t*)taosArrayGet(res, 0), taosArrayGetSize(res));
+  }
+  taosArrayDestroy(res);
+  return bm;
+}
+
+// the tag filter intersects the results of the indexed conditions of AND, which is safe only if the result of each
+// condition holds every table satisfying it
+TEST_F(JsonEnv, testSearchSuperset) {
+  const int        numOfTables = 3000;
+  std::vector<int> va(numOfTables), vb(numOfTables);
+  for (int i = 0; i < numOfTables; i++) {
+    va[i] = (i * 7919) % 100;
+    vb[i] = (i * 104729) % 50;
+    WriteData(index, "a", TSDB_DATA_TYPE_INT, &va[i], sizeof(int), i);
+    WriteData(index, "b", TSDB_DATA_TYPE_INT, &vb[i], sizeof(int), i);
+  }
+
+  int8_t types[] = {QUERY_TERM, QUERY_GREATER_THAN, QUERY_GREATER_EQUAL, QUERY_LESS_THAN, QUERY_LESS_EQUAL};
+  for (int8_t ta : types) {
+    for (int8_t tb : types) {
+      SIdxBitmap* ra = SearchBitmap(index, "a", 30, ta);
+      SIdxBitmap* rb = SearchBitmap(index, "b", 20, tb);
+      for (int i = 0; i < numOfTables; i++) {
+        bool ma = cmpByQueryType(va[i], 30, ta), mb = cmpByQueryType(vb[i], 20, tb);
+        if (ma) EXPECT_TRUE(idxBitmapContains(ra, i));
+        if (mb) EXPECT_TRUE(idxBitmapContains(rb, i));
+      }
+
+      EXPECT_EQ(idxBitmapAnd(ra, rb), 0);
+      for (int i = 0; i < numOfTables; i++) {
+        if (cmpByQueryType(va[i], 30, ta) && cmpByQueryType(vb[i], 20, tb)) {
+          EXPECT_TRUE(idxBitmapContains(ra, i));
+        }
+      }
+      idxBitmapDestroy(ra);
+      idxBitmapDestroy(rb);
+    }
+  }
+}
@@ -5,6 +5,7 @@
 #include <thread>
 #include <vector>
 #include "index.h"
+#include "indexBitmap.h"
 #include "indexCache.h"
 #include "indexComm.h"
 #include "indexFst.h"
@@ -365,3 +366,116 @@ TEST_F(UtilEnv, testDictComm) {
     EXPECT_EQ(COMMON_INPUTS[v], i);
   }
 }
+
+TEST_F(UtilEnv, bitmapSetOp) {
+  SIdxBitmap *a = idxBitmapCreate();
+  SIdxBitmap *b = idxBitmapCreate();
+
+  // dense container on a, sparse containers on b
+  uint64_t base = (uint64_t)1 << 40;
+  for (uint64_t i = 0; i < 10000; i++) {
+    EXPECT_EQ(idxBitmapAdd(a, base + i), 0);
+  }
+  for (uint64_t i = 0; i < 10000; i += 3) {
+    EXPECT_EQ(idxBitmapAdd(b, base + i), 0);
+  }
+  uint64_t far = UINT64_MAX;
+  EXPECT_EQ(idxBitmapAdd(b, far), 0);
+  EXPECT_EQ(idxBitmapGetCard(a), 10000);
+  EXPECT_EQ(idxBitmapGetCard(b), 3335);
+  EXPECT_TRUE(idxBitmapContains(b, far));
+  EXPECT_FALSE(idxBitmapContains(b, base + 1));
+  EXPECT_TRUE(a->dense);
+  EXPECT_FALSE(b->dense);
+
+  SIdxBitmap *c = idxBitmapCreate();
+  EXPECT_EQ(idxBitmapOr(c, a), 0);
+  EXPECT_EQ(idxBitmapAnd(c, b), 0);
+  EXPECT_EQ(idxBitmapGetCard(c), 3334);
+
+  EXPECT_EQ(idxBitmapAndNot(a, b), 0);
+  EXPECT_EQ(idxBitmapGetCard(a), 10000 - 3334);
+  EXPECT_EQ(idxBitmapOr(a, b), 0);
+  EXPECT_EQ(idxBitmapGetCard(a), 10001);
+
+  SArray *out = taosArrayInit(16, sizeof(uint64_t));
+  EXPECT_EQ(idxBitmapToArray(a, out), 0);
+  EXPECT_EQ(taosArrayGetSize(out), 10001);
+  for (int i = 0; i < 10000; i++) {
+    EXPECT_EQ(*(uint64_t *)taosArrayGet(out, i), base + i);
+  }
+  EXPECT_EQ(*(uint64_t *)taosArrayGet(out, 10000), far);
+
+  taosArrayDestroy(out);
+  idxBitmapDestroy(a);
+  idxBitmapDestroy(b);
+  idxBitmapDestroy(c);
+}
+
+TEST_F(UtilEnv, bitmapScatteredUids) {
+  SIdxBitmap *a = idxBitmapCreate();
+  SIdxBitmap *b = idxBitmapCreate();
+  SIdxBitmap *d = idxBitmapCreate();
+
+  // tables created over time, each in a container of its own
+  for (uint64_t i = 0; i < 20000; i++) {
+    EXPECT_EQ(idxBitmapAdd(a, ((i + 1) << 20) | 5), 0);
+    if (i % 2 == 0) {
+      EXPECT_EQ(idxBitmapAdd(b, ((i + 1) << 20) | 5), 0);
+    }
+  }
+  uint64_t base = (uint64_t)1 << 50;
+  for (uint64_t i = 0; i < 10000; i++) {
+    EXPECT_EQ(idxBitmapAdd(d, base + i), 0);
+  }
+  EXPECT_FALSE(a->dense);
+  EXPECT_FALSE(b->dense);
+  EXPECT_TRUE(d->dense);
+
+  EXPECT_EQ(idxBitmapAnd(a, b), 0);
+  EXPECT_EQ(idxBitmapGetCard(a), 10000);
+  EXPECT_FALSE(a->dense);
+
+  // the few dense uids do not make the scattered ones worth the containers
+  EXPECT_EQ(idxBitmapOr(a, d), 0);
+  EXPECT_EQ(idxBitmapGetCard(a), 20000);
+  EXPECT_FALSE(a->dense);
+  EXPECT_TRUE(idxBitmapContains(a, base + 9999));
+  EXPECT_TRUE(idxBitmapContains(a, (1 << 20) | 5));
+  EXPECT_FALSE(idxBitmapContains(a, (2 << 20) | 5));
+
+  EXPECT_EQ(idxBitmapAndNot(d, a), 0);
+  EXPECT_EQ(idxBitmapGetCard(d), 0);
+
+  idxBitmapDestroy(a);
+  idxBitmapDestroy(b);
+  idxBitmapDestroy(d);
+}
+
+TEST_F(UtilEnv, largeIntersectUnion) {
+  // overlapping inputs of thousands of uids
+  for (int i = 0; i < taosArrayGetSize(src); i++) {
+    SArray *f = (SArray *)taosArrayGetP(src, i);
+    for (uint64_t v = i * 1000; v < 5000 + i * 1000; v++) {
+      taosArrayPush(f, &v);
+    }
+  }
+  iIntersection(src, rslt);
+  EXPECT_EQ(taosArrayGetSize(rslt), 3000);
+  EXPECT_EQ(*(uint64_t *)taosArrayGet(rslt, 0), 2000);
+  clearFinalArray(rslt);
+
+  iUnion(src, rslt);
+  EXPECT_EQ(taosArrayGetSize(rslt), 7000);
+  for (int i = 0; i < taosArrayGetSize(rslt); i++) {
+    EXPECT_EQ(*(uint64_t *)taosArrayGet(rslt, i), i);
+  }
+  clearFinalArray(rslt);
+
+  SArray *total = taosArrayDup((SArray *)taosArrayGetP(src, 0), NULL);
+  iExcept(total, (SArray *)taosArrayGetP(src, 1));
+  EXPECT_EQ(taosArrayGetSize(total), 1000);
+  taosArrayDestroy(total);
+
+  clearSourceArray(src);
+}
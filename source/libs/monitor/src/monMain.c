@@ -406,6 +406,18 @@ static void monGenDnodeJson(SMonInfo *pMonitor) {
   tjsonAddDoubleToObject(pJson, "has_snode", pInfo->has_snode);
 }
 
+static void monGenDiskIoJson(SJson *pJson, const char *type, const SMonDiskIo *pIo) {
+  char key[32] = {0};
+  snprintf(key, sizeof(key), "%s_ops", type);
+  tjsonAddDoubleToObject(pJson, key, pIo->ops);
+  snprintf(key, sizeof(key), "%s_bytes", type);
+  tjsonAddDoubleToObject(pJson, key, pIo->bytes);
+  snprintf(key, sizeof(key), "%s_inflight_bytes", type);
+  tjsonAddDoubleToObject(pJson, key, pIo->inflightBytes);
+  snprintf(key, sizeof(key), "%s_latency", type);
+  tjsonAddDoubleToObject(pJson, key, pIo->latency);
+}
+
 static void monGenDiskJson(SMonInfo *pMonitor) {
   SMonDiskInfo *pInfo = &pMonitor->vmInfo.tfs;
   SMonDiskDesc *pLogDesc = &pMonitor->dmInfo.dnode.logdir;
@@ -431,6 +443,9 @@ static void monGenDiskJson(SMonInfo *pMonitor) {
     if (tjsonAddDoubleToObject(pDatadirJson, "avail", pDatadirDesc->size.avail) != 0) tjsonDelete(pDatadirJson);
     if (tjsonAddDoubleToObject(pDatadirJson, "used", pDatadirDesc->size.used) != 0) tjsonDelete(pDatadirJson);
     if (tjsonAddDoubleToObject(pDatadirJson, "total", pDatadirDesc->size.total) != 0) tjsonDelete(pDatadirJson);
+    monGenDiskIoJson(pDatadirJson, "read", &pDatadirDesc->read);
+    monGenDiskIoJson(pDatadirJson, "write", &pDatadirDesc->write);
+    monGenDiskIoJson(pDatadirJson, "sync", &pDatadirDesc->sync);
 
     if (tjsonAddItemToArray(pDatadirsJson, pDatadirJson) != 0) tjsonDelete(pDatadirJson);
   }
@@ -1006,6 +1006,8 @@ joined_table(A) ::=
 %destructor join_type                                                             { }
 join_type(A) ::= .                                                                { A = JOIN_TYPE_INNER; }
 join_type(A) ::= INNER.                                                           { A = JOIN_TYPE_INNER; }
+join_type(A) ::= LEFT.                                                            { A = JOIN_TYPE_LEFT; }
+join_type(A) ::= LEFT OUTER.                                                      { A = JOIN_TYPE_LEFT; }
 
 /************************************************ query_specification *************************************************/
 query_specification(A) ::=
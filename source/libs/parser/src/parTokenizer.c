@@ -129,6 +129,7 @@ static SKeyword keywordTable[] = {
     {"LAST",                 TK_LAST},
     {"LAST_ROW",             TK_LAST_ROW},
     {"LEADER",               TK_LEADER},
+    {"LEFT",                 TK_LEFT},
     {"LICENCES",             TK_LICENCES},
     {"LIKE",                 TK_LIKE},
     {"LIMIT",                TK_LIMIT},
@@ -160,6 +161,7 @@ static SKeyword keywordTable[] = {
     {"ON",                   TK_ON},
     {"OR",                   TK_OR},
     {"ORDER",                TK_ORDER},
+    {"OUTER",                TK_OUTER},
     {"OUTPUTTYPE",           TK_OUTPUTTYPE},
     {"PAGES",                TK_PAGES},
     {"PAGESIZE",             TK_PAGESIZE},
@@ -2457,7 +2457,9 @@ static bool sysTableFromVnode(const char* pTable) {
           (0 == strcmp(pTable, TSDB_INS_TABLE_COLS)));
 }
 
-static bool sysTableFromDnode(const char* pTable) { return 0 == strcmp(pTable, TSDB_INS_TABLE_DNODE_VARIABLES); }
+static bool sysTableFromDnode(const char* pTable) {
+  return (0 == strcmp(pTable, TSDB_INS_TABLE_DNODE_VARIABLES)) || (0 == strcmp(pTable, TSDB_INS_TABLE_DISKS));
+}
 
 static int32_t getVnodeSysTableVgroupListImpl(STranslateContext* pCxt, SName* pTargetName, SName* pName,
                                               SArray** pVgroupList) {
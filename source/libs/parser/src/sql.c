@@ -104,27 +104,27 @@
 #endif
 /************* Begin control #defines *****************************************/
 #define YYCODETYPE unsigned short int
-#define YYNOCODE 487
+#define YYNOCODE 489
 #define YYACTIONTYPE unsigned short int
 #define ParseTOKENTYPE  SToken 
 typedef union {
   int yyinit;
   ParseTOKENTYPE yy0;
-  EJoinType yy140;
-  SDataType yy310;
-  STokenPair yy347;
-  EOperatorType yy354;
-  SAlterOption yy365;
-  SToken yy371;
-  ENullOrder yy399;
-  int32_t yy416;
-  SNode* yy452;
-  int8_t yy475;
-  bool yy667;
-  EOrder yy690;
-  int64_t yy729;
-  SNodeList* yy812;
-  EFillMode yy844;
+  SAlterOption yy23;
+  EJoinType yy24;
+  EOrder yy44;
+  bool yy83;
+  SNodeList* yy88;
+  int64_t yy159;
+  STokenPair yy303;
+  SDataType yy394;
+  ENullOrder yy409;
+  EOperatorType yy464;
+  EFillMode yy498;
+  SNode* yy698;
+  int32_t yy724;
+  SToken yy731;
+  int8_t yy821;
 } YYMINORTYPE;
 #ifndef YYSTACKDEPTH
 #define YYSTACKDEPTH 100
@@ -140,18 +140,18 @@ typedef union {
 #define ParseCTX_FETCH
 #define ParseCTX_STORE
 #define YYFALLBACK 1
-#define YYNSTATE             800
-#define YYNRULE              600
-#define YYNRULE_WITH_ACTION  600
-#define YYNTOKEN             338
-#define YY_MAX_SHIFT         799
-#define YY_MIN_SHIFTREDUCE   1180
-#define YY_MAX_SHIFTREDUCE   1779
-#define YY_ERROR_ACTION      1780
-#define YY_ACCEPT_ACTION     1781
-#define YY_NO_ACTION         1782
-#define YY_MIN_REDUCE        1783
-#define YY_MAX_REDUCE        2382
+#define YYNSTATE             801
+#define YYNRULE              602
+#define YYNRULE_WITH_ACTION  602
+#define YYNTOKEN             340
+#define YY_MAX_SHIFT         800
+#define YY_MIN_SHIFTREDUCE   1182
+#define YY_MAX_SHIFTREDUCE   1783
+#define YY_ERROR_ACTION      1784
+#define YY_ACCEPT_ACTION     1785
+#define YY_NO_ACTION         1786
+#define YY_MIN_REDUCE        1787
+#define YY_MAX_REDUCE        2388
 /************* End control #defines *******************************************/
 #define YY_NLOOKAHEAD ((int)(sizeof(yy_lookahead)/sizeof(yy_lookahead[0])))
 
@@ -218,821 +218,817 @@ typedef union {
 **  yy_default[]       Default action for each state.
 **
 *********** Begin parsing tables **********************************************/
-#define YY_ACTTAB_COUNT (2858)
+#define YY_ACTTAB_COUNT (2823)
 static const YYACTIONTYPE yy_action[] = {
- /*     0 */  2126, 2193, 2171, 2082,  221,  690, 1960, 2154,  537, 1949,
- /*    10 */  1826,  670,   48,   46, 1706,  394, 2179, 1213, 2079,  677,
- /*    20 */   401, 2358, 1555,   41,   40,  135, 2175,   47,   45,   44,
- /*    30 */    43,   42,  574, 1636,  453, 1553, 2171,  539, 1582, 2211,
- /*    40 */    41,   40, 1781,  536,   47,   45,   44,   43,   42,  254,
- /*    50 */  1951, 2161, 1945,  706,  630,  531, 1215, 2353, 1218, 1219,
- /*    60 */  2175,  181, 1631,  529, 2177,  398,  525,  521,   19, 1238,
- /*    70 */    66, 1237, 2359,  188,  700, 1561,   30, 2354,  656,  348,
- /*    80 */   689,  369, 2065,  361,  140,  690, 1960, 2192, 1580, 2228,
- /*    90 */   667,  144,  112, 2194,  710, 2196, 2197,  705, 2177,  700,
- /*   100 */   796,  168, 1239,   15,  185,  135, 2281,  103,  700, 1901,
- /*   110 */   397, 2277,  579,  497, 2082,  416,   48,   46,  690, 1960,
- /*   120 */   415,  689, 1769,  190,  401,  264, 1555, 1665, 1371, 2080,
- /*   130 */   677, 2307, 1953, 1580,   38,  306, 1746, 1636,  193, 1553,
- /*   140 */  1638, 1639, 1806, 1362,  735,  734,  733, 1366,  732, 1368,
- /*   150 */  1369,  731,  728, 1805, 1377,  725, 1379, 1380,  722,  719,
- /*   160 */   716,  184,  630,   51,  655, 2353, 1631, 2353,   94,   62,
- /*   170 */  1611, 1621,   19, 2000,  212,  211, 1637, 1640,  675, 1561,
- /*   180 */  2359,  188,  654,  188, 1666, 2354,  656, 2354,  656, 2296,
- /*   190 */   288, 1556, 2161, 1554,  286, 2289,  666,  496,  136,  665,
- /*   200 */   169, 2353, 1795, 2161,  796,   41,   40,   15, 2193,   47,
- /*   210 */    45,   44,   43,   42,   62, 2293,  654,  188,  707, 1315,
- /*   220 */   435, 2354,  656, 1559, 1560, 1783, 1610, 1613, 1614, 1615,
- /*   230 */  1616, 1617, 1618, 1619, 1620,  702,  698, 1629, 1630, 1632,
- /*   240 */  1633, 1634, 1635,    2, 1638, 1639, 2211,  437,  433,  134,
- /*   250 */   133,  132,  131,  130,  129,  128,  127,  126, 2161, 1317,
- /*   260 */   706, 1784,   37,  399, 1660, 1661, 1662, 1663, 1664, 1668,
- /*   270 */  1669, 1670, 1671,  534, 1611, 1621,  535, 1819,  551, 1580,
- /*   280 */  1637, 1640,  125, 1464, 1465,  124,  123,  122,  121,  120,
- /*   290 */   119,  118,  117,  116, 2192, 1556, 2228, 1554,  645,  112,
- /*   300 */  2194,  710, 2196, 2197,  705,  650,  700, 2044,  395,  147,
- /*   310 */  1580,  151, 2252, 2281, 1581, 2193,  166,  397, 2277, 1238,
- /*   320 */   191, 1237,  667,  144, 1962,  670,  191, 1559, 1560, 1703,
- /*   330 */  1610, 1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620,  702,
- /*   340 */   698, 1629, 1630, 1632, 1633, 1634, 1635,    2,   12,   48,
- /*   350 */    46,  745, 1239, 2211, 2013,  410,  409,  401, 2182, 1555,
- /*   360 */  2358,  367,   62, 2353,  181, 2161, 1582,  706,  615, 2011,
- /*   370 */  1636,  191, 1553,  592,  591,  590,  690, 1960, 1562, 2357,
- /*   380 */   582,  141,  586, 2354, 2356, 2066,  585,  649,  651,  646,
- /*   390 */   639,  584,  589,  377,  376,  146,   56,  583, 2252, 1631,
- /*   400 */   252, 2192,  629, 2228,  251,   19,  112, 2194,  710, 2196,
- /*   410 */  2197,  705, 1561,  700, 2184, 2211,  297,  298,  185,  542,
- /*   420 */  2281,  296,  535, 1819,  397, 2277,  187, 2289, 2290, 2193,
- /*   430 */   142, 2294, 1221,  655, 1406, 1407, 2353,  796, 1579,  707,
- /*   440 */    15, 1828,   41,   40, 1272, 2308,   47,   45,   44,   43,
- /*   450 */    42,  654,  188,   48,   46, 1641, 2354,  656,  223, 2193,
- /*   460 */  1612,  401,  537, 1555, 1826,   93,  475, 2211,  356,  707,
- /*   470 */   648,  381,  166,  608, 1636,  474, 1553, 1638, 1639, 2161,
- /*   480 */  1963,  706, 2358,  125, 1273, 2353,  124,  123,  122,  121,
- /*   490 */   120,  119,  118,  117,  116, 2013,   62, 2211, 1804,  667,
- /*   500 */   144, 2357,  382, 1631,   12, 2354, 2355, 1611, 1621, 2161,
- /*   510 */  2011,  706,  109, 1637, 1640, 2192, 1561, 2228,  288,  191,
- /*   520 */   112, 2194,  710, 2196, 2197,  705,   60,  700, 1556,  145,
- /*   530 */  1554,  578, 2373,  627, 2281,  577, 1565, 1952,  397, 2277,
- /*   540 */  1710,  796,  690, 1960,   49, 2192, 1580, 2228, 2161, 2193,
- /*   550 */   170, 2194,  710, 2196, 2197,  705,   12,  700,   10,  707,
- /*   560 */  1559, 1560,  451, 1610, 1613, 1614, 1615, 1616, 1617, 1618,
- /*   570 */  1619, 1620,  702,  698, 1629, 1630, 1632, 1633, 1634, 1635,
- /*   580 */     2, 1638, 1639,  445, 1326,  444, 1702, 2211,   41,   40,
- /*   590 */   631, 2318,   47,   45,   44,   43,   42, 1325, 2296, 2161,
- /*   600 */  1583,  706,  669,  186, 2289, 2290,  165,  142, 2294, 1561,
- /*   610 */  1803, 1611, 1621,  690, 1960,  443,  406, 1637, 1640, 2006,
- /*   620 */  2008,   41,   40,  404, 2292,   47,   45,   44,   43,   42,
- /*   630 */  2296,  163, 1556,  452, 1554, 2192,  676, 2228,  383, 1962,
- /*   640 */   112, 2194,  710, 2196, 2197,  705, 2011,  700,  253,  689,
- /*   650 */   447, 2193, 2256,  191, 2281,  446, 2291, 2155,  397, 2277,
- /*   660 */  2161,  707,  506, 2315, 1559, 1560,  154, 1610, 1613, 1614,
- /*   670 */  1615, 1616, 1617, 1618, 1619, 1620,  702,  698, 1629, 1630,
- /*   680 */  1632, 1633, 1634, 1635,    2,   48,   46, 1937,  549, 2211,
- /*   690 */  2075,  457, 2061,  401,  755, 1555, 1612,  630,  667,  144,
- /*   700 */  2353, 2161, 2013,  706,  630, 1936, 1636, 2353, 1553,  391,
- /*   710 */    47,   45,   44,   43,   42, 2359,  188, 2011, 1526, 1527,
- /*   720 */  2354,  656, 2359,  188,  463, 2061,   55, 2354,  656,   14,
- /*   730 */    13, 1734,   51,  690, 1960, 1631, 1947, 2192,  202, 2228,
- /*   740 */   597,  676,  112, 2194,  710, 2196, 2197,  705, 1561,  700,
- /*   750 */   690, 1960,  266,  465, 2373,  607, 2281, 1862,   41,   40,
- /*   760 */   397, 2277,   47,   45,   44,   43,   42, 2193, 1802,  250,
- /*   770 */   480,  205,  745,  796,  690, 1960,   49,  704,  642,  641,
- /*   780 */  1732, 1733, 1735, 1736, 1737,  600,  490, 2061, 2357,   48,
- /*   790 */    46, 1935,  594,  674,  481, 2075, 1776,  401,  249, 1555,
- /*   800 */   404, 1581,  189, 2289, 2290, 2211,  142, 2294,  166,  692,
- /*   810 */  1636, 2253, 1553, 1638, 1639, 1846, 1962, 2161, 2161,  706,
- /*   820 */   743,  156,  155,  740,  739,  738,  153,  592,  591,  590,
- /*   830 */  2007, 2008, 1679,  210,  582,  141,  586,  593,   70, 1631,
- /*   840 */   585,   69,   52, 1611, 1621,  584,  589,  377,  376, 1637,
- /*   850 */  1640,  583, 1561, 2192, 1745, 2228, 1241, 1242,  342, 2194,
- /*   860 */   710, 2196, 2197,  705, 1556,  700, 1554, 2247,   41,   40,
- /*   870 */  1801, 1943,   47,   45,   44,   43,   42,  796,  570,  569,
- /*   880 */    15, 2193,  743,  156,  155,  740,  739,  738,  153, 1800,
- /*   890 */   613,  707,  207, 2328, 1799, 1964, 1559, 1560, 1775, 1610,
- /*   900 */  1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620,  702,  698,
- /*   910 */  1629, 1630, 1632, 1633, 1634, 1635,    2, 1638, 1639, 2211,
- /*   920 */  2161, 1481, 1482,  606,  743,  156,  155,  740,  739,  738,
- /*   930 */   153, 2161,   86,  706, 2013,   85,  604,  630,  602, 2161,
- /*   940 */  2353,  396,  690, 1960, 2161,  690, 1960, 1611, 1621, 2011,
- /*   950 */   736,  690, 1960, 1637, 1640, 2359,  188, 1480, 1483,  259,
- /*   960 */  2354,  656,  550,  737, 1722, 1957, 2004, 2192, 1556, 2228,
- /*   970 */  1554,  255,  112, 2194,  710, 2196, 2197,  705,    9,  700,
- /*   980 */   588,  587,   34, 2147, 2373, 1330, 2281,  676,   41,   40,
- /*   990 */   397, 2277,   47,   45,   44,   43,   42, 1798, 1329,  191,
- /*  1000 */  1559, 1560, 1859, 1610, 1613, 1614, 1615, 1616, 1617, 1618,
- /*  1010 */  1619, 1620,  702,  698, 1629, 1630, 1632, 1633, 1634, 1635,
- /*  1020 */     2, 1646,  352,  167, 1578,  690, 1960, 1580,  327,  690,
- /*  1030 */  1960,  488,  423,   90,  504,  572,  571,  503, 2171,  685,
- /*  1040 */   407, 2075,  324,   73, 2144,  263,   72, 2161,  166,  673,
- /*  1050 */   371, 2013, 2180,  471,  671,  505, 1962,  349,  405, 1955,
- /*  1060 */   473,  701, 2175,  508, 1797,  658, 2011, 1794,  219,  516,
- /*  1070 */   514,  511,  773,  772,  771,  770,  413, 1938,  769,  768,
- /*  1080 */   148,  763,  762,  761,  760,  759,  758,  757,  158,  753,
- /*  1090 */   752,  751,  412,  411,  748,  747,  746,  176,  175, 1583,
- /*  1100 */  2177,  630,  690, 1960, 2353, 1583,  370,  237,   62,  374,
- /*  1110 */   700,   44,   43,   42, 2161,  690, 1960, 2161,  459, 2359,
- /*  1120 */   188,  149,  301,  173, 2354,  656,  690, 1960,  262,  690,
- /*  1130 */  1960,  568,  564,  560,  556,  687,  236, 1793,  662,  694,
- /*  1140 */  1667, 2253,  767,  765, 1792, 1791,  688,  111,  501,  307,
- /*  1150 */  1790,  495,  494,  493,  492,  487,  486,  485,  484,  483,
- /*  1160 */   479,  478,  477,  476,  351,  468,  467,  466,  659,  461,
- /*  1170 */   460,  368,  690, 1960, 2301, 1699,   91, 1612,  375,  234,
- /*  1180 */   373,  372, 1837,  576,   90, 1789, 1788, 2161,   81,   80,
- /*  1190 */   450, 2193,  408,  200, 2161, 2161, 1787, 2013, 1699,  741,
- /*  1200 */  2161,  707, 2004,  637,  595,  578,  442,  440, 1786,  577,
- /*  1210 */  1956,  742, 2012,  320, 2004, 1902, 1990,  350,   35,   54,
- /*  1220 */   431,    3, 2193,  429,  425,  421,  418,  443, 1672, 2211,
- /*  1230 */   756,  454,  707, 1922, 2346, 2161, 2161, 1218, 1219,  154,
- /*  1240 */    83, 2161,  137,  706,  455,   74, 2161,  233,  227,  580,
- /*  1250 */   242,  203, 2193,  240,  232,  547,  244,  265, 2161,  243,
- /*  1260 */  2211,  430,  707,  246, 2300,  191,  245,  248,  154,  581,
- /*  1270 */   247, 1313, 2161,  225,  706, 1835,   50, 2192,  610, 2228,
- /*  1280 */   609,   50,  112, 2194,  710, 2196, 2197,  705,  697,  700,
- /*  1290 */  2211, 1311, 1778, 1779, 2373,   84, 2281,  598, 1796, 1521,
- /*  1300 */   397, 2277, 2161,  643,  706, 1564,  270,  154, 2192,  108,
- /*  1310 */  2228, 2321,  283,  112, 2194,  710, 2196, 2197,  705,  105,
- /*  1320 */   700,   50,  294, 1563, 1555, 2373,   71, 2281, 1524,  152,
- /*  1330 */   154,  397, 2277,   14,   13,   64, 1731, 1553, 2192,   50,
- /*  1340 */  2228, 1730, 2193,  112, 2194,  710, 2196, 2197,  705,   50,
- /*  1350 */   700, 1829,  707,  410,  409, 2373,  277, 2281,   36,  714,
- /*  1360 */   139,  397, 2277, 1569,   41,   40,  272,  672,   47,   45,
- /*  1370 */    44,   43,   42, 2193, 1636, 1900, 1562, 1561,  663,  152,
- /*  1380 */  2211, 1478,  299,  707,  154,  749,  682, 1899, 2212,  303,
- /*  1390 */  1356,  750, 2161,  138,  706, 1673,  384,  152, 2070, 1622,
- /*  1400 */   414,  791,  796, 1631, 1820, 1825,  660, 1291, 2001,  319,
- /*  1410 */  2193, 2211, 2311, 1289,  668,  285, 1561,  282,  422, 1384,
- /*  1420 */   707,    1,  417, 2161,    5,  706,  365, 1586, 2192,  438,
- /*  1430 */  2228, 1502,  196,  112, 2194,  710, 2196, 2197,  705, 1388,
- /*  1440 */   700,  696,  439, 1657, 1395, 2254,  441, 2281, 2211,  195,
- /*  1450 */   198,  397, 2277, 1393,  314, 1579,  456,  157,  209, 2192,
- /*  1460 */  2161, 2228,  706, 1567,  112, 2194,  710, 2196, 2197,  705,
- /*  1470 */  1583,  700,  462,  458,  469,  499,  693, 2071, 2281,  464,
- /*  1480 */  1578, 1566,  397, 2277,  482,  491,  489, 2063,  498,  500,
- /*  1490 */   509,  510,  507, 1556,  213, 1554, 2192,  214, 2228, 2193,
- /*  1500 */   512,  113, 2194,  710, 2196, 2197,  705,  513,  700,  707,
- /*  1510 */  1584,  216,  532,  515,  517, 2281,    4,  533,  540, 2280,
- /*  1520 */  2277,  541,  543, 1581,  224, 1559, 1560,  226, 1585,  544,
- /*  1530 */   545, 1587, 1570,  546, 1565,  229,  548, 2211,  231,   88,
- /*  1540 */    89,  552,  235,  573,  355,  575, 1950,  114, 2193, 2161,
- /*  1550 */   239,  706, 1946,  612,  614,   92,  150,  618,  707,  315,
- /*  1560 */   256,  619,  617, 2135, 1573, 1575,  241,  159,  160, 1948,
- /*  1570 */   258,  260, 1944,  161, 2193,  162, 2132,  698, 1629, 1630,
- /*  1580 */  1632, 1633, 1634, 1635,  704, 2192, 2211, 2228,  625, 1509,
- /*  1590 */   113, 2194,  710, 2196, 2197,  705, 2131,  700, 2161,  644,
- /*  1600 */   706,  622,  634,    8, 2281, 2312, 2327,  680,  695, 2277,
- /*  1610 */   640, 2322, 2211,  387,  624, 2326,  647,  623,  268,  271,
- /*  1620 */  2303,  653,  276,  635, 2161, 2193,  706,  632,  633,  281,
- /*  1630 */  2376,  388, 1699,  661,  708,  707, 2228,  664, 2193,  113,
- /*  1640 */  2194,  710, 2196, 2197,  705,  143,  700, 1582,  707,  289,
- /*  1650 */   178, 1588,  278, 2281, 2076,  316,   98,  360, 2277, 2297,
- /*  1660 */  2192,  317, 2228, 2211,  678,  342, 2194,  710, 2196, 2197,
- /*  1670 */   705,  703,  700,  691, 2246, 2161, 2211,  706,  679,  683,
- /*  1680 */  2090,  279,  174,  684, 2089,  280,  100, 2193, 2161,  318,
- /*  1690 */   706, 2088,  393,  102,   61, 2262,  104,  707, 2352, 1961,
- /*  1700 */   712, 2005, 1923,  792, 2193,  284,  793,  321,  795, 2153,
- /*  1710 */   357, 2192,  310, 2228,  707,  358,  171, 2194,  710, 2196,
- /*  1720 */  2197,  705,   53,  700, 2192, 2211, 2228,  325,  323,  113,
- /*  1730 */  2194,  710, 2196, 2197,  705,  345,  700, 2161, 2152,  706,
- /*  1740 */   330,  344, 2211, 2281,  334, 2151,   78,  385, 2278, 2148,
- /*  1750 */   419,  420, 1546, 2193, 2161, 1547,  706,  194,  424, 2146,
- /*  1760 */   426,  427,  428,  707, 2145,  366, 2143,  657, 2374,  432,
- /*  1770 */  2142, 2141,  434, 2192,  436, 2228, 1537, 2193,  170, 2194,
- /*  1780 */   710, 2196, 2197,  705, 2122,  700,  197,  707, 2121,  199,
- /*  1790 */  2192, 2211, 2228, 1505,   79,  343, 2194,  710, 2196, 2197,
- /*  1800 */   705, 1504,  700, 2161, 2193,  706, 2103, 2102, 2101,  448,
- /*  1810 */   449, 2100, 2099, 2054,  707, 2211, 1455, 2053, 2050, 2319,
- /*  1820 */   386,  201, 2049,   82, 2193, 2048, 2047, 2161, 2052,  706,
- /*  1830 */   204, 2051, 2046, 2045,  707, 2043, 2042, 2041,  206, 2192,
- /*  1840 */   470, 2228, 2211, 2040,  336, 2194,  710, 2196, 2197,  705,
- /*  1850 */   472,  700, 2056, 2039, 2161, 2038,  706, 2037, 2036, 2035,
- /*  1860 */  2034, 2033, 2211, 2192, 2032, 2228, 2031,  392,  343, 2194,
- /*  1870 */   710, 2196, 2197,  705, 2161,  700,  706,  208, 2024, 2023,
- /*  1880 */    87, 2022, 2021, 2055, 2020, 2019,  215,  652, 2030, 2029,
- /*  1890 */  2192, 2193, 2228, 2028, 2027,  171, 2194,  710, 2196, 2197,
- /*  1900 */   705,  707,  700, 2026, 2025, 2018, 2017, 2016, 1457, 2015,
- /*  1910 */  2192,  502, 2228, 2014, 1327,  343, 2194,  710, 2196, 2197,
- /*  1920 */   705, 2193,  700,  353,  354, 1865, 1323, 1864, 1863, 2211,
- /*  1930 */  1331,  707,  217,  218,  400, 1861, 1858,  520, 1857,  519,
- /*  1940 */   524, 2161, 1850,  706,  523,  518,  522, 2375,  527,  526,
- /*  1950 */  1839,  528,  530, 1815, 1220,   76, 1814,  220, 2120, 2211,
- /*  1960 */  2110,   77,  182,  222,  402, 2098, 2181,  183,  538,  228,
- /*  1970 */  2097, 2161,  230,  706,  553,  554,  555, 2192, 2074, 2228,
- /*  1980 */  2193, 1939,  343, 2194,  710, 2196, 2197,  705,  616,  700,
- /*  1990 */   707, 1860, 1856, 1265, 1854,  558,  557, 1852,  559,  561,
- /*  2000 */   562,  563, 1849,  565,  566,  567,  799, 2192, 1834, 2228,
- /*  2010 */  1832, 1833,  343, 2194,  710, 2196, 2197,  705, 2211,  700,
- /*  2020 */   313, 1831, 1811, 1941, 1940, 1400, 1399,  764, 1314,  766,
- /*  2030 */  2161, 1312,  706, 1310, 1309, 1308,  180, 1847, 1307, 1301,
- /*  2040 */  1306,   63,  238, 1838,  789,  785,  781,  777, 1303,  311,
- /*  2050 */  1302, 1300,  378, 2193,  379, 1836,  380,  596, 1810, 1809,
- /*  2060 */   599,  601,  603,  707, 1808, 2119,  611,  605, 2228,  115,
- /*  2070 */  1531,  338, 2194,  710, 2196, 2197,  705, 1533,  700, 1530,
- /*  2080 */  1535, 1511,   29,   67, 2193, 1515, 2109, 2096, 1513,  110,
- /*  2090 */   164, 2211,  304,  620,  707, 2095, 2358,   20,   17, 1748,
- /*  2100 */     6,   21,   65, 2161,   31,  706,   57,  261,    7,  626,
- /*  2110 */   275,  638,  267,  621,   22, 1490, 1489,  274,  269, 2193,
- /*  2120 */   636,  172, 2211,  628, 1729,  686, 2182,   33,   24,  707,
- /*  2130 */    58,  273,   32,   23, 2161, 1721,  706, 1768,   18, 2192,
- /*  2140 */  1769, 2228,   95, 1763,  328, 2194,  710, 2196, 2197,  705,
- /*  2150 */  1762,  700,  389, 1767, 1766,  390, 2193, 2211,  287,  177,
- /*  2160 */   291, 2094, 2073,  292,   97, 1696,  707,  290,   59, 2161,
- /*  2170 */  2192,  706, 2228, 1695, 2072,  326, 2194,  710, 2196, 2197,
- /*  2180 */   705, 2193,  700,   96,   25,  295,  257,   99,  105,  293,
- /*  2190 */   305,  707, 1727,  300, 2211,   68,   26,  101, 1648,   11,
- /*  2200 */    13, 1647, 1571,  179, 2231, 2192, 2161, 2228,  706, 1658,
- /*  2210 */   329, 2194,  710, 2196, 2197,  705,  681,  700, 2193, 2211,
- /*  2220 */   302, 1603,  192,  711,  713, 1626, 1624,  403,  707,  699,
- /*  2230 */    39, 2161, 1623,  706,   16,   27,  717, 1595,   28,  720,
- /*  2240 */  1385,  715, 2192, 2193, 2228, 1382, 1381,  335, 2194,  710,
- /*  2250 */  2196, 2197,  705,  707,  700, 1378, 2211,  718,  721,  723,
- /*  2260 */   724,  726, 1372,  709, 1370,  729,  727, 2192, 2161, 2228,
- /*  2270 */   706,  730,  339, 2194,  710, 2196, 2197,  705, 1376,  700,
- /*  2280 */   106, 2211,  308, 1394, 1375, 1390,  107,   75, 1263, 1374,
- /*  2290 */  1373,  744, 1295, 2161, 1294,  706, 1293, 1292,  309, 1290,
- /*  2300 */  1288, 1287, 1286, 1321, 2192,  754, 2228, 1284, 1283,  331,
- /*  2310 */  2194,  710, 2196, 2197,  705, 2193,  700, 1282, 1281, 1280,
- /*  2320 */  1279, 1278, 1318, 1316, 1275,  707, 1274, 1271, 1270, 2192,
- /*  2330 */  2193, 2228, 1269, 1268,  340, 2194,  710, 2196, 2197,  705,
- /*  2340 */   707,  700, 1855,  774,  775,  776, 1853,  778, 2193,  779,
- /*  2350 */  1851,  782,  780, 2211,  783, 1848,  784,  786,  707,  788,
- /*  2360 */  1830,  790, 1210,  787, 1807, 2161,  312,  706, 2211,  794,
- /*  2370 */  1782, 1557,  798,  322,  797, 1782, 1782, 1782, 1782, 1782,
- /*  2380 */  2161, 1782,  706, 1782, 1782, 1782, 2211, 1782, 1782, 1782,
- /*  2390 */  1782, 1782, 1782, 1782, 1782, 2193, 1782, 1782, 2161, 1782,
- /*  2400 */   706, 2192, 1782, 2228, 1782,  707,  332, 2194,  710, 2196,
- /*  2410 */  2197,  705, 1782,  700, 1782, 1782, 2192, 2193, 2228, 1782,
- /*  2420 */  1782,  341, 2194,  710, 2196, 2197,  705,  707,  700, 1782,
- /*  2430 */  1782, 1782, 1782, 2211, 2192, 1782, 2228, 1782, 1782,  333,
- /*  2440 */  2194,  710, 2196, 2197,  705, 2161,  700,  706, 1782, 1782,
- /*  2450 */  1782, 1782, 1782, 1782, 1782, 2211, 1782, 1782, 1782, 1782,
- /*  2460 */  1782, 1782, 1782, 1782, 2193, 1782, 1782, 2161, 1782,  706,
- /*  2470 */  1782, 1782, 1782, 1782,  707, 1782, 1782, 1782, 1782, 1782,
- /*  2480 */  1782, 2192, 1782, 2228, 1782, 1782,  346, 2194,  710, 2196,
- /*  2490 */  2197,  705, 1782,  700, 1782, 1782, 1782, 1782, 1782, 1782,
- /*  2500 */  1782, 1782, 2211, 2192, 1782, 2228, 1782, 1782,  347, 2194,
- /*  2510 */   710, 2196, 2197,  705, 2161,  700,  706, 1782, 1782, 1782,
- /*  2520 */  1782, 1782, 1782, 2193, 1782, 1782, 1782, 1782, 1782, 1782,
- /*  2530 */  1782, 1782, 1782,  707, 1782, 1782, 2193, 1782, 1782, 1782,
- /*  2540 */  1782, 1782, 1782, 1782, 1782, 1782,  707, 1782, 1782, 1782,
- /*  2550 */  2192, 1782, 2228, 2193, 1782, 2205, 2194,  710, 2196, 2197,
- /*  2560 */   705, 2211,  700,  707, 1782, 1782, 1782, 1782, 1782, 1782,
- /*  2570 */  1782, 1782, 1782, 2161, 2211,  706, 1782, 1782, 1782, 1782,
- /*  2580 */  1782, 1782, 1782, 1782, 1782, 2193, 2161, 1782,  706, 1782,
- /*  2590 */  1782, 2211, 1782, 1782, 1782,  707, 1782, 1782, 1782, 1782,
- /*  2600 */  1782, 1782, 1782, 2161, 1782,  706, 1782, 1782, 1782, 2192,
- /*  2610 */  1782, 2228, 1782, 1782, 2204, 2194,  710, 2196, 2197,  705,
- /*  2620 */  1782,  700, 2192, 2211, 2228, 1782, 1782, 2203, 2194,  710,
- /*  2630 */  2196, 2197,  705, 1782,  700, 2161, 1782,  706, 1782, 2192,
- /*  2640 */  1782, 2228, 1782, 1782,  362, 2194,  710, 2196, 2197,  705,
- /*  2650 */  1782,  700, 2193, 1782, 1782, 1782, 1782, 1782, 1782, 1782,
- /*  2660 */  1782, 1782,  707, 1782, 1782, 1782, 1782, 1782, 1782, 1782,
- /*  2670 */  1782, 2192, 2193, 2228, 1782, 1782,  363, 2194,  710, 2196,
- /*  2680 */  2197,  705,  707,  700, 1782, 1782, 1782, 1782, 1782, 1782,
- /*  2690 */  2211, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782,
- /*  2700 */  1782, 1782, 2161, 1782,  706, 1782, 1782, 1782, 1782, 1782,
- /*  2710 */  2211, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782,
- /*  2720 */  1782, 1782, 2161, 1782,  706, 1782, 1782, 1782, 1782, 1782,
- /*  2730 */  1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 2192, 1782,
- /*  2740 */  2228, 1782, 2193,  359, 2194,  710, 2196, 2197,  705, 1782,
- /*  2750 */   700, 1782,  707, 1782, 1782, 1782, 1782, 1782, 2192, 2193,
- /*  2760 */  2228, 1782, 1782,  364, 2194,  710, 2196, 2197,  705,  707,
- /*  2770 */   700, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782,
- /*  2780 */  2211, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782,
- /*  2790 */  1782, 1782, 2161, 1782,  706, 1782, 1782, 2211, 1782, 1782,
- /*  2800 */  1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 2161,
- /*  2810 */  1782,  706, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782,
- /*  2820 */  1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782,  708, 1782,
- /*  2830 */  2228, 1782, 1782,  338, 2194,  710, 2196, 2197,  705, 1782,
- /*  2840 */   700, 1782, 1782, 1782, 1782, 2192, 1782, 2228, 1782, 1782,
- /*  2850 */   337, 2194,  710, 2196, 2197,  705, 1782,  700,
+ /*     0 */  1953, 2197, 2175, 2086,  222,  691, 1964, 2158,  537, 1949,
+ /*    10 */  1830,  671,   48,   46, 1710,  394, 2183, 1215, 2083,  678,
+ /*    20 */   401, 2364, 1557,   41,   40,  135, 2179,   47,   45,   44,
+ /*    30 */    43,   42,  574, 1638,  453, 1555, 2175,  539, 1584, 2215,
+ /*    40 */    41,   40, 1785,  536,   47,   45,   44,   43,   42,  184,
+ /*    50 */  1955, 2165, 1951,  707,  630,  531, 1217, 2359, 1220, 1221,
+ /*    60 */  2179,  184, 1633,  529, 2181,  398,  525,  521,   19, 1240,
+ /*    70 */  2070, 1239, 2365,  189,  701, 1563,  187, 2360,  656,  348,
+ /*    80 */   690,  369, 2069,  361,  140,  691, 1964, 2196, 2004, 2232,
+ /*    90 */   668,  144,  112, 2198,  711, 2200, 2201,  706, 2181,  701,
+ /*   100 */   797,  168, 1241,   15,  188,  135, 2285, 1584,  701, 1905,
+ /*   110 */   397, 2281,  579,  497, 2086,  416,   48,   46,  691, 1964,
+ /*   120 */   415,   66, 1773,  191,  401,  265, 1557, 1667, 1373, 2084,
+ /*   130 */   678, 2313,  534,  691, 1964,  535, 1823, 1638,  194, 1555,
+ /*   140 */  1640, 1641, 1810, 1364,  736,  735,  734, 1368,  733, 1370,
+ /*   150 */  1371,  732,  729,   56, 1379,  726, 1381, 1382,  723,  720,
+ /*   160 */   717, 1582,  630,   51,  655, 2359, 1633, 2359,   94, 1809,
+ /*   170 */  1613, 1623,   19, 1582,  213,  212, 1639, 1642,  690, 1563,
+ /*   180 */  2365,  189,  654,  189, 1668, 2360,  656, 2360,  656,  103,
+ /*   190 */   288, 1558, 2165, 1556,  190, 2293,  667,  496,  136,  666,
+ /*   200 */  1583, 2359,   38,  306,  797,   41,   40,   15, 2197,   47,
+ /*   210 */    45,   44,   43,   42, 1957, 1780,  654,  189,  708, 2165,
+ /*   220 */    62, 2360,  656, 1561, 1562, 1787, 1612, 1615, 1616, 1617,
+ /*   230 */  1618, 1619, 1620, 1621, 1622,  703,  699, 1631, 1632, 1634,
+ /*   240 */  1635, 1636, 1637,    2, 1640, 1641, 2215, 2363, 1808,  134,
+ /*   250 */   133,  132,  131,  130,  129,  128,  127,  126, 2165,  288,
+ /*   260 */   707, 1788,   37,  399, 1662, 1663, 1664, 1665, 1666, 1670,
+ /*   270 */  1671, 1672, 1673,  542, 1613, 1623,  535, 1823,  297,  298,
+ /*   280 */  1639, 1642,  125,  296,  645,  124,  123,  122,  121,  120,
+ /*   290 */   119,  118,  117,  116, 2196, 1558, 2232, 1556, 2165,  112,
+ /*   300 */  2198,  711, 2200, 2201,  706, 1582,  701, 2011, 2012,  147,
+ /*   310 */   224,  151, 2256, 2285,  537, 2197, 1830,  397, 2281, 1779,
+ /*   320 */  1408, 1409,  192, 1466, 1467,  671, 2300, 1561, 1562,  676,
+ /*   330 */  1612, 1615, 1616, 1617, 1618, 1619, 1620, 1621, 1622,  703,
+ /*   340 */   699, 1631, 1632, 1634, 1635, 1636, 1637,    2,   12,   48,
+ /*   350 */    46,  406, 2297, 2215, 2010, 2012,  169,  401, 1799, 1557,
+ /*   360 */    47,   45,   44,   43,   42, 2165,   12,  707,   10,  165,
+ /*   370 */  1638,  551, 1555,  592,  591,  590,  651,  646,  639,  192,
+ /*   380 */   582,  141,  586, 2017,   14,   13,  585,  606,   62,   62,
+ /*   390 */   367,  584,  589,  377,  376,  691, 1964,  583, 2015, 1633,
+ /*   400 */   604, 2196,  602, 2232,  154,   19,  112, 2198,  711, 2200,
+ /*   410 */  2201,  706, 1563,  701,  693,  451, 2257, 1738,  188,  146,
+ /*   420 */  2285,  677, 2256,  125,  397, 2281,  124,  123,  122,  121,
+ /*   430 */   120,  119,  118,  117,  116,  457, 2065,  797,  691, 1964,
+ /*   440 */    15, 2197,   41,   40,   52, 2314,   47,   45,   44,   43,
+ /*   450 */    42,  708,  746,   48,   46, 1643,  435, 1240,  452, 1239,
+ /*   460 */   649,  401,  655, 1557,   55, 2359,  642,  641, 1736, 1737,
+ /*   470 */  1739, 1740, 1741,  549, 1638, 2079, 1555, 1640, 1641, 2215,
+ /*   480 */   654,  189,  203,  437,  433, 2360,  656, 1681, 2215,  404,
+ /*   490 */  1241, 2165,  578,  707,   41,   40,  577,  163,   47,   45,
+ /*   500 */    44,   43,   42, 1633,  383, 1966, 1585, 1613, 1623,  463,
+ /*   510 */  2065,  690, 2015, 1639, 1642,  650, 1563,   41,   40,  668,
+ /*   520 */   144,   47,   45,   44,   43,   42,  658, 2196, 1558, 2232,
+ /*   530 */  1556,    9,  113, 2198,  711, 2200, 2201,  706, 1749,  701,
+ /*   540 */    12,  797, 2017,  648,   49,  254, 2285,  192,  192,  382,
+ /*   550 */  2284, 2281, 2197,   30,  490, 2065,  206, 2015,  615, 1807,
+ /*   560 */  1561, 1562,  708, 1612, 1615, 1616, 1617, 1618, 1619, 1620,
+ /*   570 */  1621, 1622,  703,  699, 1631, 1632, 1634, 1635, 1636, 1637,
+ /*   580 */     2, 1640, 1641,  744,  156,  155,  741,  740,  739,  153,
+ /*   590 */  2215,   41,   40, 2017,   51,   47,   45,   44,   43,   42,
+ /*   600 */   391,  211, 2165,  192,  707,  668,  144, 2364, 2015, 2165,
+ /*   610 */  2359, 1613, 1623, 1750, 2017, 1528, 1529, 1639, 1642,  410,
+ /*   620 */   409,  396,  670,  177, 2293, 2294, 2363,  142, 2298, 2015,
+ /*   630 */  2360, 2362, 1558, 1941, 1556, 2175,  738,   90, 2196, 2008,
+ /*   640 */  2232, 1563, 1564,  112, 2198,  711, 2200, 2201,  706, 2184,
+ /*   650 */   701,  447, 1243, 1244,  371, 2260,  446, 2285,  267, 2179,
+ /*   660 */  1317,  397, 2281, 1959, 1561, 1562, 1866, 1612, 1615, 1616,
+ /*   670 */  1617, 1618, 1619, 1620, 1621, 1622,  703,  699, 1631, 1632,
+ /*   680 */  1634, 1635, 1636, 1637,    2,   48,   46, 1726,  677, 2197,
+ /*   690 */  2305, 1701,  665,  401,  695, 1557, 2257, 2181,  630,  708,
+ /*   700 */  1319, 2359,  742,  691, 1964, 2008, 1638,  701, 1555,  178,
+ /*   710 */  2293, 2294,  395,  142, 2298,  743, 2365,  189, 2008,   34,
+ /*   720 */   166, 2360,  656,  465,  737,   41,   40, 2215, 1966,   47,
+ /*   730 */    45,   44,   43,   42, 1939, 1633,  592,  591,  590, 2165,
+ /*   740 */   675,  707, 2079,  582,  141,  586, 2017, 2130, 1563,  585,
+ /*   750 */  1557, 1701,  665,  405,  584,  589,  377,  376,  756,  597,
+ /*   760 */   583, 2015, 1940, 1555,  677, 1806,  744,  156,  155,  741,
+ /*   770 */   740,  739,  153,  797,  607, 2196,   49, 2232,  691, 1964,
+ /*   780 */   170, 2198,  711, 2200, 2201,  706,  404,  701,  251,   48,
+ /*   790 */    46, 1805,  570,  569,  166, 2197,  255,  401,  480, 1557,
+ /*   800 */  1567, 1804, 1966, 1563,  600,  708, 1803,  691, 1964, 1585,
+ /*   810 */  1638,  594, 1555, 1640, 1641, 2165,  686,  250, 2079,  263,
+ /*   820 */   631, 2324,  691, 1964,   36,  668,  144,  481,  797,  746,
+ /*   830 */    41,   40,  407, 2215,   47,   45,   44,   43,   42, 1633,
+ /*   840 */   166, 2165,  550, 1613, 1623, 2165, 1947,  707, 1966, 1639,
+ /*   850 */  1642, 2165, 1563,  572,  571, 2364, 2165,   70, 2359,  109,
+ /*   860 */    69, 1800,  691, 1964, 1558,  629, 1556,  744,  156,  155,
+ /*   870 */   741,  740,  739,  153, 2363, 2159,  145,  797, 2360, 2361,
+ /*   880 */    15, 2196, 1961, 2232, 1956, 2197,  170, 2198,  711, 2200,
+ /*   890 */  2201,  706,  613,  701, 1802,  708, 1561, 1562,   90, 1612,
+ /*   900 */  1615, 1616, 1617, 1618, 1619, 1620, 1621, 1622,  703,  699,
+ /*   910 */  1631, 1632, 1634, 1635, 1636, 1637,    2, 1640, 1641, 1558,
+ /*   920 */  1223, 1556,  630, 2215, 1960, 2359, 1581, 2325,  166,  179,
+ /*   930 */  2293, 2294, 1801,  142, 2298, 2165, 1967,  707, 2300,  630,
+ /*   940 */  2365,  189, 2359,   62, 2165, 2360,  656, 1613, 1623,  691,
+ /*   950 */  1964, 1561, 1562, 1639, 1642,  691, 1964, 2365,  189,  588,
+ /*   960 */   587,  204, 2360,  656, 2296,  691, 1964,  374, 1558,  256,
+ /*   970 */  1556, 2196, 2300, 2232, 1328,  264,  112, 2198,  711, 2200,
+ /*   980 */  2201,  706, 2165,  701, 1583,  674, 1714, 1327, 2258,   60,
+ /*   990 */  2285, 1585, 1582,  253,  397, 2281,  627,  252, 2295, 1707,
+ /*  1000 */  1561, 1562, 1863, 1612, 1615, 1616, 1617, 1618, 1619, 1620,
+ /*  1010 */  1621, 1622,  703,  699, 1631, 1632, 1634, 1635, 1636, 1637,
+ /*  1020 */     2, 2148,  352,  167, 1580,  768,  766, 1648,  327, 1669,
+ /*  1030 */   445,  488,  444, 1582,  504,  108,  375,  503,  373,  372,
+ /*  1040 */  1968,  576,  324,   73, 2048,  105,   72,   44,   43,   42,
+ /*  1050 */  1798, 1797,  506,  471, 2151,  505,  320,  349,   93, 1994,
+ /*  1060 */   473,  356,  443,  578,  381, 2327,  608,  577,  220,  516,
+ /*  1070 */   514,  511,  774,  773,  772,  771,  413,  260,  770,  769,
+ /*  1080 */   148,  764,  763,  762,  761,  760,  759,  758,  158,  754,
+ /*  1090 */   753,  752,  412,  411,  749,  748,  747,  176,  175, 1796,
+ /*  1100 */  2165, 2165,  192,  423, 1483, 1484,  370,   35,   62,  238,
+ /*  1110 */   691, 1964,  691, 1964, 2017,   41,   40, 1674,  459,   47,
+ /*  1120 */    45,   44,   43,   42, 1795,  173,  691, 1964, 1582, 2016,
+ /*  1130 */   301,  659,  688,  568,  564,  560,  556,   54,  237,    3,
+ /*  1140 */  1482, 1485, 1614,  266,  208,  672,  689,  111,  501, 2165,
+ /*  1150 */  1794,  495,  494,  493,  492,  487,  486,  485,  484,  483,
+ /*  1160 */   479,  478,  477,  476,  351,  468,  467,  466, 1793,  461,
+ /*  1170 */   460,  368, 1792,   83, 2165,  137,  691, 1964,   91,  691,
+ /*  1180 */  1964,  235,  662, 1614,   86, 1332, 1791,   85,   81,   80,
+ /*  1190 */   450, 1942,  630,  201, 2197, 2359,  307,   74, 1331,  408,
+ /*  1200 */  2165,  698, 1790,  475,  708,  757,  442,  440, 1926,  154,
+ /*  1210 */  2365,  189,  474, 1220, 1221, 2360,  656,  350, 2165, 1566,
+ /*  1220 */   431, 2197, 2165,  429,  425,  421,  418,  443, 1701,  665,
+ /*  1230 */   454,  708, 2215, 1832,  243,  149, 2165,  241,  430, 1565,
+ /*  1240 */   154, 2197,  245,  455, 2165,  244,  707,   84,  580,  234,
+ /*  1250 */   228,  708, 2165, 2321, 1850,  581,  233,  547, 1706, 2215,
+ /*  1260 */    50,  247,  249,  508,  246,  248,  610,  192,  609, 1523,
+ /*  1270 */  1315, 2165, 1841,  707, 1839,  226,  593, 1313, 1614, 2215,
+ /*  1280 */  2196,   50, 2232,  271,  702,  112, 2198,  711, 2200, 2201,
+ /*  1290 */   706, 2165,  701,  707,  595,  154,  598,  694, 1906, 2285,
+ /*  1300 */  1526, 1782, 1783,  397, 2281,   50,  294, 2196,   71, 2232,
+ /*  1310 */   152,  643,  112, 2198,  711, 2200, 2201,  706, 2186,  701,
+ /*  1320 */  1735,  154,   14,   13, 2379,   64, 2285, 2196,  284, 2232,
+ /*  1330 */   397, 2281,  112, 2198,  711, 2200, 2201,  706,   50,  701,
+ /*  1340 */    50, 1734,  715,  273, 2379,  152, 2285,  154,  138, 2197,
+ /*  1350 */   397, 2281,  152,  750,  751,  673, 1659,  139,  278,  708,
+ /*  1360 */  1833, 2334, 1904, 1274, 2216, 1480,  299, 1903,  683,  669,
+ /*  1370 */   303,  660,  384,  414, 2188, 1293, 1291, 1569, 2197, 2074,
+ /*  1380 */  1824, 1358, 2005, 1829, 2317, 1675,    1, 2215,  708,  286,
+ /*  1390 */   637,  283,    5,  417,  422,  365, 1588, 1568, 1624, 2165,
+ /*  1400 */   319,  707, 1386, 1275,  438, 1390,  196, 1397, 1395,  439,
+ /*  1410 */   792,  197,  157, 2197,  441, 1504, 2215,  199, 1581,  314,
+ /*  1420 */   456,  210,  458,  708,  663, 2352, 1585, 2075, 2165,  499,
+ /*  1430 */   707,  462,  464, 1580,  469, 2196,  482, 2232,  489,  491,
+ /*  1440 */   112, 2198,  711, 2200, 2201,  706, 2067,  701,  509,  498,
+ /*  1450 */   500, 2215, 2379,  510, 2285,  507,  214,  215,  397, 2281,
+ /*  1460 */   512,  513,  217, 2165, 2196,  707, 2232,  515,  517,  112,
+ /*  1470 */  2198,  711, 2200, 2201,  706, 1586,  701,  532,    4,  533,
+ /*  1480 */   543, 2379,  540, 2285,  225,  541, 1583,  397, 2281, 1587,
+ /*  1490 */   227,  544, 1589,  545,  546,  230,  548,  552,  573, 2196,
+ /*  1500 */  2197, 2232,  232,  575,  112, 2198,  711, 2200, 2201,  706,
+ /*  1510 */   708,  701, 2304,   88,  410,  409, 2379,   89, 2285,  236,
+ /*  1520 */   355, 1954,  397, 2281, 1571,  240,  114, 1950,  242,  159,
+ /*  1530 */   160, 1952, 2197,  612,   92, 1638, 2139, 1564, 2215,  614,
+ /*  1540 */  1948,  161,  708,  162, 2136,  150,  257,  315,  618,  617,
+ /*  1550 */  2165,  261,  707, 1511,  625,  644,  681, 2135, 2333, 2332,
+ /*  1560 */   653, 2197,    8, 2309, 1633,  622,  634,  279,  277,  640,
+ /*  1570 */  2215,  708,  387,  647, 2318, 2328,  635, 1563,  174,  633,
+ /*  1580 */   280,  632, 2165,  624,  707,  281, 2196,  259, 2232,  619,
+ /*  1590 */   269,  112, 2198,  711, 2200, 2201,  706,  623,  701, 2215,
+ /*  1600 */   282,  272,  697, 2379,  664, 2285,  388, 2358,  661,  397,
+ /*  1610 */  2281, 2165,  143,  707, 2382, 1584, 2301,  181, 2196, 1590,
+ /*  1620 */  2232, 2080,  316,  113, 2198,  711, 2200, 2201,  706,  289,
+ /*  1630 */   701,  679,   98,  680, 2094,  317, 2197, 2285, 2093, 2092,
+ /*  1640 */   393,  696, 2281, 1965,  684,  318,  705,  709,  685, 2232,
+ /*  1650 */   100,  102,  113, 2198,  711, 2200, 2201,  706,   61,  701,
+ /*  1660 */  2266,  104,  285, 2197,  713,  321, 2285,  793, 2009,  310,
+ /*  1670 */   360, 2281,  794,  708, 2215,  796, 1927,  345,  357,  325,
+ /*  1680 */  2157,  330,   53, 2156,  344,  358, 2165,  334,  707,  323,
+ /*  1690 */  2155,   78, 2152, 1572,  419, 1567,  420, 1548, 1549,  195,
+ /*  1700 */   424, 2215,  426,  427,  428, 2149,  366, 2147,  432, 2146,
+ /*  1710 */   434, 2145,  436, 2165, 2150,  707, 1539, 2126,  198, 2125,
+ /*  1720 */   200, 1507, 2196,   79, 2232, 1575, 1577,  342, 2198,  711,
+ /*  1730 */  2200, 2201,  706,  704,  701,  692, 2250, 1506,  699, 1631,
+ /*  1740 */  1632, 1634, 1635, 1636, 1637, 2107, 2106, 2105,  448, 2196,
+ /*  1750 */   449, 2232, 2104, 2103,  171, 2198,  711, 2200, 2201,  706,
+ /*  1760 */  2197,  701, 1457, 2058, 2057, 2054, 2053,  202,   82, 2052,
+ /*  1770 */   708, 2051, 2056, 2055,  205, 2050, 2049, 2047, 2046, 2045,
+ /*  1780 */   207, 2197, 2044,  470, 2060,  472, 2043, 2042, 2041, 2040,
+ /*  1790 */  2039,  708, 2038, 2037, 2036, 2035, 2034, 2033, 2215, 2032,
+ /*  1800 */  2031, 2030, 2029,  209, 2028,  657, 2380, 2197, 2027,   87,
+ /*  1810 */  2165, 2026,  707, 2025, 2059, 2024, 2023,  708, 2022, 2215,
+ /*  1820 */  1459, 2021, 2020, 2019,  385,  502, 2018, 1329,  353, 1333,
+ /*  1830 */  1869, 2165,  216,  707, 1868, 1867,  218, 1865, 1325,  354,
+ /*  1840 */  1862,  518, 1861,  219,  522, 2215, 2196, 1854, 2232,  520,
+ /*  1850 */   386,  113, 2198,  711, 2200, 2201,  706, 2165,  701,  707,
+ /*  1860 */   526,  519, 1843,  524,  530, 2285,  523, 2196, 2197, 2232,
+ /*  1870 */  2282,  528,  343, 2198,  711, 2200, 2201,  706,  708,  701,
+ /*  1880 */   527, 2197, 1819,  221,   76, 2185,  186,  185, 1222, 1818,
+ /*  1890 */   223,  708,   77, 2196, 2197, 2232,  538, 2124,  343, 2198,
+ /*  1900 */   711, 2200, 2201,  706,  708,  701, 2215, 2114, 2102,  229,
+ /*  1910 */   231, 2101, 2078, 1943, 1864, 1267, 1860,  555, 2165, 2215,
+ /*  1920 */   707,  553,  554, 1858,  558,  557,  559, 1856,  561,  562,
+ /*  1930 */   563, 2165, 2215,  707, 1853,  567,  565,  392, 1838, 1836,
+ /*  1940 */  1837,  566, 1835, 2197, 2165, 1815,  707, 1945,   63, 1944,
+ /*  1950 */  1402, 1401, 1316,  705, 2196, 1314, 2232, 1312,  239,  336,
+ /*  1960 */  2198,  711, 2200, 2201,  706, 1311,  701, 2196, 2197, 2232,
+ /*  1970 */  1310, 1309,  171, 2198,  711, 2200, 2201,  706,  708,  701,
+ /*  1980 */  2196, 2215, 2232, 1308, 1851,  343, 2198,  711, 2200, 2201,
+ /*  1990 */   706, 1305,  701, 2165,  765,  707,  767, 1304, 1303, 1302,
+ /*  2000 */   378, 1842,  652,  379,  596, 1840, 2215,  380,  599, 1814,
+ /*  2010 */   601,  400, 1813, 1812,  603, 2197,  605,  115, 2165, 2364,
+ /*  2020 */   707, 1533, 1537, 1535, 2381,  708, 1532,   29, 2123, 2196,
+ /*  2030 */    57, 2232, 1515, 1513,  342, 2198,  711, 2200, 2201,  706,
+ /*  2040 */    67,  701, 1517, 2251, 2113, 2197,  164,  620,  621, 2100,
+ /*  2050 */  2099,  262,   20, 2215, 2196,  708, 2232, 1492,  402,  343,
+ /*  2060 */  2198,  711, 2200, 2201,  706, 2165,  701,  707,  616,   31,
+ /*  2070 */  1491, 1752,  626,  628,  268,    6,  270,    7,  636,  638,
+ /*  2080 */   276,   21, 2197, 2215,   22,   17,  800, 1733, 2186,  275,
+ /*  2090 */    33,   65,  708,  172,   23, 2165,  274,  707,   32,   95,
+ /*  2100 */   313, 2196,   24, 2232, 2197, 1767,  343, 2198,  711, 2200,
+ /*  2110 */  2201,  706, 1766,  701,  708, 1725,  183,  389, 1772, 1773,
+ /*  2120 */  2215,   18, 1703,  287,  790,  786,  782,  778, 1771,  311,
+ /*  2130 */  1770,  611, 2165, 2232,  707,  390,  338, 2198,  711, 2200,
+ /*  2140 */  2201,  706, 2215,  701,  180,   59, 1698, 1697, 2098, 2077,
+ /*  2150 */    96,   97,  292, 2076, 2165,   25,  707,   58,  293, 1731,
+ /*  2160 */   295,   99,  300,   68,  682,  302,  101,  305, 2196,  110,
+ /*  2170 */  2232,   26,  304,  328, 2198,  711, 2200, 2201,  706,  105,
+ /*  2180 */   701, 1650, 1649,   13, 1573,  182,   11, 2235, 1660, 1628,
+ /*  2190 */  2196,  193, 2232,  700, 2197,  326, 2198,  711, 2200, 2201,
+ /*  2200 */   706, 1605,  701, 1626,  708,  687,   39,  710, 1625,   16,
+ /*  2210 */    27, 2197, 1597,   28, 1378, 1387,  712,  714,  403,  716,
+ /*  2220 */   718,  708, 1384, 1383,  719,  721,  722,  724, 1380,  725,
+ /*  2230 */   727,  728, 2215, 1374, 1372,  730,  731,  106, 1377, 1376,
+ /*  2240 */   291,  308, 1375, 2197, 2165,  107,  707,  290, 1396, 2215,
+ /*  2250 */    75, 1392,  745,  708, 1297, 1265, 1296, 1295, 1294, 1292,
+ /*  2260 */  1290, 2165, 2197,  707, 1323, 1289,  258, 1288,  755, 1286,
+ /*  2270 */   309, 1285,  708, 1284, 1283, 1282, 1281, 1280, 1320, 1318,
+ /*  2280 */  2196, 2215, 2232, 1277, 1276,  329, 2198,  711, 2200, 2201,
+ /*  2290 */   706, 1273,  701, 2165, 1272,  707, 1271, 2196, 1270, 2232,
+ /*  2300 */  2215, 1859,  335, 2198,  711, 2200, 2201,  706,  775,  701,
+ /*  2310 */   776, 2197, 2165,  779,  707,  777, 1857,  780,  781, 1855,
+ /*  2320 */   783,  708,  785, 1852,  784,  787,  788,  789, 1834, 2196,
+ /*  2330 */  2197, 2232,  791, 1212,  339, 2198,  711, 2200, 2201,  706,
+ /*  2340 */   708,  701, 1811,  312, 1559,  795,  799,  322, 2196, 2215,
+ /*  2350 */  2232,  798, 1786,  331, 2198,  711, 2200, 2201,  706, 1786,
+ /*  2360 */   701, 2165, 2197,  707, 1786, 1786, 1786, 1786, 2215, 1786,
+ /*  2370 */  1786, 1786,  708, 1786, 1786, 1786, 1786, 1786, 1786, 2197,
+ /*  2380 */  2165, 1786,  707, 1786, 1786, 1786, 1786, 1786, 1786,  708,
+ /*  2390 */  1786, 1786, 1786, 1786, 1786, 1786, 1786, 2196, 1786, 2232,
+ /*  2400 */  2215, 1786,  340, 2198,  711, 2200, 2201,  706, 1786,  701,
+ /*  2410 */  1786, 1786, 2165, 1786,  707, 1786, 2196, 2215, 2232, 1786,
+ /*  2420 */  1786,  332, 2198,  711, 2200, 2201,  706, 1786,  701, 2165,
+ /*  2430 */  2197,  707, 1786, 1786, 1786, 1786, 1786, 1786, 1786, 1786,
+ /*  2440 */   708, 2197, 1786, 1786, 1786, 1786, 1786, 1786, 2196, 1786,
+ /*  2450 */  2232,  708, 2197,  341, 2198,  711, 2200, 2201,  706, 1786,
+ /*  2460 */   701, 1786,  708, 1786, 1786, 2196, 1786, 2232, 2215, 1786,
+ /*  2470 */   333, 2198,  711, 2200, 2201,  706, 1786,  701, 1786, 2215,
+ /*  2480 */  2165, 1786,  707, 1786, 1786, 1786, 1786, 1786, 1786, 1786,
+ /*  2490 */  2215, 2165, 1786,  707, 1786, 1786, 1786, 1786, 1786, 1786,
+ /*  2500 */  1786, 1786, 2165, 1786,  707, 1786, 1786, 1786, 1786, 1786,
+ /*  2510 */  1786, 1786, 1786, 1786, 1786, 1786, 2196, 1786, 2232, 1786,
+ /*  2520 */  2197,  346, 2198,  711, 2200, 2201,  706, 2196,  701, 2232,
+ /*  2530 */   708, 1786,  347, 2198,  711, 2200, 2201,  706, 2196,  701,
+ /*  2540 */  2232, 2197, 1786, 2209, 2198,  711, 2200, 2201,  706, 1786,
+ /*  2550 */   701,  708, 1786, 1786, 1786, 1786, 1786, 1786, 2215, 1786,
+ /*  2560 */  1786, 1786, 1786, 1786, 1786, 1786, 1786, 1786, 1786, 1786,
+ /*  2570 */  2165, 1786,  707, 1786, 1786, 1786, 1786, 1786, 1786, 2215,
+ /*  2580 */  1786, 1786, 1786, 1786, 1786, 1786, 1786, 1786, 2197, 1786,
+ /*  2590 */  1786, 2165, 1786,  707, 1786, 1786, 1786, 1786,  708, 1786,
+ /*  2600 */  1786, 1786, 1786, 1786, 1786, 1786, 2196, 2197, 2232, 1786,
+ /*  2610 */  1786, 2208, 2198,  711, 2200, 2201,  706,  708,  701, 1786,
+ /*  2620 */  1786, 1786, 1786, 1786, 1786, 1786, 2215, 2196, 1786, 2232,
+ /*  2630 */  1786, 1786, 2207, 2198,  711, 2200, 2201,  706, 2165,  701,
+ /*  2640 */   707, 1786, 1786, 1786, 1786, 2215, 1786, 1786, 1786, 1786,
+ /*  2650 */  1786, 1786, 1786, 1786, 1786, 1786, 2197, 2165, 1786,  707,
+ /*  2660 */  1786, 1786, 1786, 1786, 1786, 1786,  708, 1786, 1786, 1786,
+ /*  2670 */  1786, 1786, 1786, 1786, 2196, 2197, 2232, 1786, 1786,  362,
+ /*  2680 */  2198,  711, 2200, 2201,  706,  708,  701, 1786, 1786, 1786,
+ /*  2690 */  1786, 1786, 1786, 2196, 2215, 2232, 1786, 1786,  363, 2198,
+ /*  2700 */   711, 2200, 2201,  706, 1786,  701, 2165, 2197,  707, 1786,
+ /*  2710 */  1786, 1786, 1786, 2215, 1786, 1786, 1786,  708, 1786, 1786,
+ /*  2720 */  1786, 1786, 1786, 1786, 2197, 2165, 1786,  707, 1786, 1786,
+ /*  2730 */  1786, 1786, 1786, 1786,  708, 1786, 1786, 1786, 1786, 1786,
+ /*  2740 */  1786, 1786, 2196, 1786, 2232, 2215, 1786,  359, 2198,  711,
+ /*  2750 */  2200, 2201,  706, 1786,  701, 1786, 1786, 2165, 1786,  707,
+ /*  2760 */  1786, 2196, 2215, 2232, 1786, 1786,  364, 2198,  711, 2200,
+ /*  2770 */  2201,  706, 1786,  701, 2165, 1786,  707, 1786, 1786, 1786,
+ /*  2780 */  1786, 1786, 1786, 1786, 1786, 1786, 1786, 1786, 1786, 1786,
+ /*  2790 */  1786, 1786, 1786,  709, 1786, 2232, 1786, 1786,  338, 2198,
+ /*  2800 */   711, 2200, 2201,  706, 1786,  701, 1786, 1786, 1786, 1786,
+ /*  2810 */  2196, 1786, 2232, 1786, 1786,  337, 2198,  711, 2200, 2201,
+ /*  2820 */   706, 1786,  701,
 };
 static const YYCODETYPE yy_lookahead[] = {
- /*     0 */   375,  341,  367,  393,  346,  350,  351,  411,  350,  380,
- /*    10 */   352,  351,   12,   13,   14,  405,  381,    4,  408,  409,
- /*    20 */    20,    3,   22,    8,    9,  370,  391,   12,   13,   14,
- /*    30 */    15,   16,  377,   33,  350,   35,  367,   14,   20,  379,
- /*    40 */     8,    9,  338,   20,   12,   13,   14,   15,   16,  424,
- /*    50 */   381,  391,  380,  393,  458,   49,   43,  461,   45,   46,
- /*    60 */   391,  379,   62,   57,  429,  430,   60,   61,   68,   20,
- /*    70 */     4,   22,  476,  477,  439,   75,   44,  481,  482,  395,
- /*    80 */    20,  399,  400,   68,   35,  350,  351,  427,   20,  429,
- /*    90 */   350,  351,  432,  433,  434,  435,  436,  437,  429,  439,
- /*   100 */   100,  360,   53,  103,  444,  370,  446,  357,  439,  368,
- /*   110 */   450,  451,  377,   84,  393,  411,   12,   13,  350,  351,
- /*   120 */   416,   20,  104,  463,   20,   62,   22,  112,  100,  408,
- /*   130 */   409,  471,  382,   20,  447,  448,  104,   33,  370,   35,
- /*   140 */   140,  141,  341,  115,  116,  117,  118,  119,  120,  121,
- /*   150 */   122,  123,  124,  341,  126,  127,  128,  129,  130,  131,
- /*   160 */   132,  378,  458,  103,  458,  461,   62,  461,  105,  103,
- /*   170 */   170,  171,   68,  390,  145,  146,  176,  177,   20,   75,
- /*   180 */   476,  477,  476,  477,  169,  481,  482,  481,  482,  431,
- /*   190 */   172,  191,  391,  193,  454,  455,  456,  168,  458,  459,
- /*   200 */   340,  461,  342,  391,  100,    8,    9,  103,  341,   12,
- /*   210 */    13,   14,   15,   16,  103,  457,  476,  477,  351,   35,
- /*   220 */   186,  481,  482,  223,  224,    0,  226,  227,  228,  229,
+ /*     0 */   382,  343,  369,  395,  348,  352,  353,  413,  352,  382,
+ /*    10 */   354,  353,   12,   13,   14,  407,  383,    4,  410,  411,
+ /*    20 */    20,    3,   22,    8,    9,  372,  393,   12,   13,   14,
+ /*    30 */    15,   16,  379,   33,  352,   35,  369,   14,   20,  381,
+ /*    40 */     8,    9,  340,   20,   12,   13,   14,   15,   16,  381,
+ /*    50 */   383,  393,  382,  395,  460,   49,   43,  463,   45,   46,
+ /*    60 */   393,  381,   62,   57,  431,  432,   60,   61,   68,   20,
+ /*    70 */   402,   22,  478,  479,  441,   75,  380,  483,  484,  397,
+ /*    80 */    20,  401,  402,   68,   35,  352,  353,  429,  392,  431,
+ /*    90 */   352,  353,  434,  435,  436,  437,  438,  439,  431,  441,
+ /*   100 */   100,  362,   53,  103,  446,  372,  448,   20,  441,  370,
+ /*   110 */   452,  453,  379,   84,  395,  413,   12,   13,  352,  353,
+ /*   120 */   418,    4,  104,  465,   20,   62,   22,  112,  100,  410,
+ /*   130 */   411,  473,  347,  352,  353,  350,  351,   33,  372,   35,
+ /*   140 */   140,  141,  343,  115,  116,  117,  118,  119,  120,  121,
+ /*   150 */   122,  123,  124,  372,  126,  127,  128,  129,  130,  131,
+ /*   160 */   132,   20,  460,  103,  460,  463,   62,  463,  105,  343,
+ /*   170 */   170,  171,   68,   20,  145,  146,  176,  177,   20,   75,
+ /*   180 */   478,  479,  478,  479,  169,  483,  484,  483,  484,  359,
+ /*   190 */   172,  191,  393,  193,  456,  457,  458,  168,  460,  461,
+ /*   200 */    20,  463,  449,  450,  100,    8,    9,  103,  343,   12,
+ /*   210 */    13,   14,   15,   16,  384,  183,  478,  479,  353,  393,
+ /*   220 */   103,  483,  484,  223,  224,    0,  226,  227,  228,  229,
  /*   230 */   230,  231,  232,  233,  234,  235,  236,  237,  238,  239,
- /*   240 */   240,  241,  242,  243,  140,  141,  379,  213,  214,   24,
- /*   250 */    25,   26,   27,   28,   29,   30,   31,   32,  391,   75,
- /*   260 */   393,    0,  247,  248,  249,  250,  251,  252,  253,  254,
- /*   270 */   255,  256,  257,  345,  170,  171,  348,  349,   67,   20,
- /*   280 */   176,  177,   21,  170,  171,   24,   25,   26,   27,   28,
- /*   290 */    29,   30,   31,   32,  427,  191,  429,  193,  175,  432,
- /*   300 */   433,  434,  435,  436,  437,   20,  439,    0,  371,  442,
- /*   310 */    20,  444,  445,  446,   20,  341,  379,  450,  451,   20,
- /*   320 */   260,   22,  350,  351,  387,  351,  260,  223,  224,    4,
+ /*   240 */   240,  241,  242,  243,  140,  141,  381,    3,  343,   24,
+ /*   250 */    25,   26,   27,   28,   29,   30,   31,   32,  393,  172,
+ /*   260 */   395,    0,  247,  248,  249,  250,  251,  252,  253,  254,
+ /*   270 */   255,  256,  257,  347,  170,  171,  350,  351,  134,  135,
+ /*   280 */   176,  177,   21,  139,  175,   24,   25,   26,   27,   28,
+ /*   290 */    29,   30,   31,   32,  429,  191,  431,  193,  393,  434,
+ /*   300 */   435,  436,  437,  438,  439,   20,  441,  394,  395,  444,
+ /*   310 */   348,  446,  447,  448,  352,  343,  354,  452,  453,  287,
+ /*   320 */   140,  141,  262,  170,  171,  353,  433,  223,  224,   20,
  /*   330 */   226,  227,  228,  229,  230,  231,  232,  233,  234,  235,
  /*   340 */   236,  237,  238,  239,  240,  241,  242,  243,  244,   12,
- /*   350 */    13,   67,   53,  379,  379,   12,   13,   20,   47,   22,
- /*   360 */   458,  386,  103,  461,  379,  391,   20,  393,  114,  394,
- /*   370 */    33,  260,   35,   70,   71,   72,  350,  351,   35,  477,
- /*   380 */    77,   78,   79,  481,  482,  400,   83,  351,  265,  266,
- /*   390 */   267,   88,   89,   90,   91,  442,  370,   94,  445,   62,
- /*   400 */   135,  427,   48,  429,  139,   68,  432,  433,  434,  435,
- /*   410 */   436,  437,   75,  439,  103,  379,  134,  135,  444,  345,
- /*   420 */   446,  139,  348,  349,  450,  451,  454,  455,  456,  341,
- /*   430 */   458,  459,   14,  458,  140,  141,  461,  100,   20,  351,
- /*   440 */   103,  353,    8,    9,   35,  471,   12,   13,   14,   15,
- /*   450 */    16,  476,  477,   12,   13,   14,  481,  482,  346,  341,
- /*   460 */   170,   20,  350,   22,  352,  200,  159,  379,  203,  351,
- /*   470 */   434,  206,  379,  208,   33,  168,   35,  140,  141,  391,
- /*   480 */   387,  393,  458,   21,   75,  461,   24,   25,   26,   27,
- /*   490 */    28,   29,   30,   31,   32,  379,  103,  379,  341,  350,
- /*   500 */   351,  477,  386,   62,  244,  481,  482,  170,  171,  391,
- /*   510 */   394,  393,  357,  176,  177,  427,   75,  429,  172,  260,
- /*   520 */   432,  433,  434,  435,  436,  437,  172,  439,  191,  374,
- /*   530 */   193,  133,  444,  179,  446,  137,  193,  382,  450,  451,
- /*   540 */    14,  100,  350,  351,  103,  427,   20,  429,  391,  341,
- /*   550 */   432,  433,  434,  435,  436,  437,  244,  439,  246,  351,
- /*   560 */   223,  224,  370,  226,  227,  228,  229,  230,  231,  232,
+ /*   350 */    13,  391,  459,  381,  394,  395,  342,   20,  344,   22,
+ /*   360 */    12,   13,   14,   15,   16,  393,  244,  395,  246,  172,
+ /*   370 */    33,   67,   35,   70,   71,   72,  267,  268,  269,  262,
+ /*   380 */    77,   78,   79,  381,    1,    2,   83,   21,  103,  103,
+ /*   390 */   388,   88,   89,   90,   91,  352,  353,   94,  396,   62,
+ /*   400 */    34,  429,   36,  431,   44,   68,  434,  435,  436,  437,
+ /*   410 */   438,  439,   75,  441,  445,  372,  447,  223,  446,  444,
+ /*   420 */   448,  352,  447,   21,  452,  453,   24,   25,   26,   27,
+ /*   430 */    28,   29,   30,   31,   32,  352,  353,  100,  352,  353,
+ /*   440 */   103,  343,    8,    9,  103,  473,   12,   13,   14,   15,
+ /*   450 */    16,  353,   67,   12,   13,   14,  186,   20,  372,   22,
+ /*   460 */   353,   20,  460,   22,  104,  463,  272,  273,  274,  275,
+ /*   470 */   276,  277,  278,  404,   33,  406,   35,  140,  141,  381,
+ /*   480 */   478,  479,  399,  213,  214,  483,  484,  104,  381,  373,
+ /*   490 */    53,  393,  133,  395,    8,    9,  137,  381,   12,   13,
+ /*   500 */    14,   15,   16,   62,  388,  389,   20,  170,  171,  352,
+ /*   510 */   353,   20,  396,  176,  177,   20,   75,    8,    9,  352,
+ /*   520 */   353,   12,   13,   14,   15,   16,  282,  429,  191,  431,
+ /*   530 */   193,   39,  434,  435,  436,  437,  438,  439,  104,  441,
+ /*   540 */   244,  100,  381,  436,  103,  134,  448,  262,  262,  388,
+ /*   550 */   452,  453,  343,   44,  352,  353,  399,  396,  114,  343,
+ /*   560 */   223,  224,  353,  226,  227,  228,  229,  230,  231,  232,
  /*   570 */   233,  234,  235,  236,  237,  238,  239,  240,  241,  242,
- /*   580 */   243,  140,  141,  190,   22,  192,  261,  379,    8,    9,
- /*   590 */   472,  473,   12,   13,   14,   15,   16,   35,  431,  391,
- /*   600 */    20,  393,  453,  454,  455,  456,  172,  458,  459,   75,
- /*   610 */   341,  170,  171,  350,  351,  222,  389,  176,  177,  392,
- /*   620 */   393,    8,    9,  371,  457,   12,   13,   14,   15,   16,
- /*   630 */   431,  379,  191,  370,  193,  427,  350,  429,  386,  387,
- /*   640 */   432,  433,  434,  435,  436,  437,  394,  439,  134,   20,
- /*   650 */   411,  341,  444,  260,  446,  416,  457,  411,  450,  451,
- /*   660 */   391,  351,  100,  353,  223,  224,   44,  226,  227,  228,
+ /*   580 */   243,  140,  141,  133,  134,  135,  136,  137,  138,  139,
+ /*   590 */   381,    8,    9,  381,  103,   12,   13,   14,   15,   16,
+ /*   600 */   388,  399,  393,  262,  395,  352,  353,  460,  396,  393,
+ /*   610 */   463,  170,  171,  104,  381,  204,  205,  176,  177,   12,
+ /*   620 */    13,  388,  455,  456,  457,  458,  479,  460,  461,  396,
+ /*   630 */   483,  484,  191,    0,  193,  369,  390,  361,  429,  393,
+ /*   640 */   431,   75,   35,  434,  435,  436,  437,  438,  439,  383,
+ /*   650 */   441,  413,   54,   55,  378,  446,  418,  448,  172,  393,
+ /*   660 */    35,  452,  453,  387,  223,  224,    0,  226,  227,  228,
  /*   670 */   229,  230,  231,  232,  233,  234,  235,  236,  237,  238,
- /*   680 */   239,  240,  241,  242,  243,   12,   13,    0,  402,  379,
- /*   690 */   404,  350,  351,   20,   75,   22,  170,  458,  350,  351,
- /*   700 */   461,  391,  379,  393,  458,    0,   33,  461,   35,  386,
- /*   710 */    12,   13,   14,   15,   16,  476,  477,  394,  204,  205,
- /*   720 */   481,  482,  476,  477,  350,  351,  104,  481,  482,    1,
- /*   730 */     2,  223,  103,  350,  351,   62,  380,  427,  397,  429,
- /*   740 */     4,  350,  432,  433,  434,  435,  436,  437,   75,  439,
- /*   750 */   350,  351,  172,  370,  444,   19,  446,    0,    8,    9,
- /*   760 */   450,  451,   12,   13,   14,   15,   16,  341,  341,   33,
- /*   770 */   370,  397,   67,  100,  350,  351,  103,  351,  270,  271,
- /*   780 */   272,  273,  274,  275,  276,   49,  350,  351,    3,   12,
- /*   790 */    13,    0,   56,  402,  370,  404,  183,   20,   62,   22,
- /*   800 */   371,   20,  454,  455,  456,  379,  458,  459,  379,  443,
- /*   810 */    33,  445,   35,  140,  141,    0,  387,  391,  391,  393,
- /*   820 */   133,  134,  135,  136,  137,  138,  139,   70,   71,   72,
- /*   830 */   392,  393,  104,  397,   77,   78,   79,   22,  102,   62,
- /*   840 */    83,  105,  103,  170,  171,   88,   89,   90,   91,  176,
- /*   850 */   177,   94,   75,  427,  104,  429,   54,   55,  432,  433,
- /*   860 */   434,  435,  436,  437,  191,  439,  193,  441,    8,    9,
- /*   870 */   341,  380,   12,   13,   14,   15,   16,  100,  355,  356,
- /*   880 */   103,  341,  133,  134,  135,  136,  137,  138,  139,  341,
- /*   890 */   411,  351,   62,  353,  341,  380,  223,  224,  285,  226,
+ /*   680 */   239,  240,  241,  242,  243,   12,   13,  104,  352,  343,
+ /*   690 */   258,  259,  260,   20,  445,   22,  447,  431,  460,  353,
+ /*   700 */    75,  463,  390,  352,  353,  393,   33,  441,   35,  456,
+ /*   710 */   457,  458,  373,  460,  461,  390,  478,  479,  393,    2,
+ /*   720 */   381,  483,  484,  372,  114,    8,    9,  381,  389,   12,
+ /*   730 */    13,   14,   15,   16,    0,   62,   70,   71,   72,  393,
+ /*   740 */   404,  395,  406,   77,   78,   79,  381,  377,   75,   83,
+ /*   750 */    22,  259,  260,  388,   88,   89,   90,   91,   75,    4,
+ /*   760 */    94,  396,    0,   35,  352,  343,  133,  134,  135,  136,
+ /*   770 */   137,  138,  139,  100,   19,  429,  103,  431,  352,  353,
+ /*   780 */   434,  435,  436,  437,  438,  439,  373,  441,   33,   12,
+ /*   790 */    13,  343,  357,  358,  381,  343,  426,   20,  372,   22,
+ /*   800 */   193,  343,  389,   75,   49,  353,  343,  352,  353,   20,
+ /*   810 */    33,   56,   35,  140,  141,  393,  404,   62,  406,  419,
+ /*   820 */   474,  475,  352,  353,    2,  352,  353,  372,  100,   67,
+ /*   830 */     8,    9,  373,  381,   12,   13,   14,   15,   16,   62,
+ /*   840 */   381,  393,  372,  170,  171,  393,  382,  395,  389,  176,
+ /*   850 */   177,  393,   75,  357,  358,  460,  393,  102,  463,  359,
+ /*   860 */   105,  344,  352,  353,  191,   48,  193,  133,  134,  135,
+ /*   870 */   136,  137,  138,  139,  479,  413,  376,  100,  483,  484,
+ /*   880 */   103,  429,  372,  431,  384,  343,  434,  435,  436,  437,
+ /*   890 */   438,  439,  413,  441,  343,  353,  223,  224,  361,  226,
  /*   900 */   227,  228,  229,  230,  231,  232,  233,  234,  235,  236,
- /*   910 */   237,  238,  239,  240,  241,  242,  243,  140,  141,  379,
- /*   920 */   391,  140,  141,   21,  133,  134,  135,  136,  137,  138,
- /*   930 */   139,  391,  102,  393,  379,  105,   34,  458,   36,  391,
- /*   940 */   461,  386,  350,  351,  391,  350,  351,  170,  171,  394,
- /*   950 */   114,  350,  351,  176,  177,  476,  477,  176,  177,  380,
- /*   960 */   481,  482,  370,  388,  104,  370,  391,  427,  191,  429,
- /*   970 */   193,  370,  432,  433,  434,  435,  436,  437,   39,  439,
- /*   980 */   364,  365,    2,    0,  444,   22,  446,  350,    8,    9,
- /*   990 */   450,  451,   12,   13,   14,   15,   16,  341,   35,  260,
+ /*   910 */   237,  238,  239,  240,  241,  242,  243,  140,  141,  191,
+ /*   920 */    14,  193,  460,  381,  387,  463,   20,  475,  381,  456,
+ /*   930 */   457,  458,  343,  460,  461,  393,  389,  395,  433,  460,
+ /*   940 */   478,  479,  463,  103,  393,  483,  484,  170,  171,  352,
+ /*   950 */   353,  223,  224,  176,  177,  352,  353,  478,  479,  366,
+ /*   960 */   367,  172,  483,  484,  459,  352,  353,   37,  191,  372,
+ /*   970 */   193,  429,  433,  431,   22,  372,  434,  435,  436,  437,
+ /*   980 */   438,  439,  393,  441,   20,  372,   14,   35,  446,  172,
+ /*   990 */   448,   20,   20,  135,  452,  453,  179,  139,  459,    4,
  /*  1000 */   223,  224,    0,  226,  227,  228,  229,  230,  231,  232,
  /*  1010 */   233,  234,  235,  236,  237,  238,  239,  240,  241,  242,
- /*  1020 */   243,   14,   18,   18,   20,  350,  351,   20,   23,  350,
- /*  1030 */   351,   27,   49,  359,   30,  355,  356,   33,  367,  402,
- /*  1040 */   371,  404,   37,   38,    0,  370,   41,  391,  379,  370,
- /*  1050 */   376,  379,  381,   49,  411,   51,  387,   52,  386,  385,
- /*  1060 */    56,  380,  391,  100,  341,  280,  394,  341,   63,   64,
- /*  1070 */    65,   66,   70,   71,   72,   73,   74,    0,   76,   77,
+ /*  1020 */   243,    0,   18,   18,   20,  366,  367,   14,   23,  169,
+ /*  1030 */   190,   27,  192,   20,   30,  103,  106,   33,  108,  109,
+ /*  1040 */   382,  111,   37,   38,    0,  113,   41,   14,   15,   16,
+ /*  1050 */   343,  343,  100,   49,    0,   51,  374,   52,  200,  377,
+ /*  1060 */    56,  203,  222,  133,  206,  403,  208,  137,   63,   64,
+ /*  1070 */    65,   66,   70,   71,   72,   73,   74,  382,   76,   77,
  /*  1080 */    78,   79,   80,   81,   82,   83,   84,   85,   86,   87,
- /*  1090 */    88,   89,   90,   91,   92,   93,   94,   95,   96,   20,
- /*  1100 */   429,  458,  350,  351,  461,   20,  102,   33,  103,   37,
- /*  1110 */   439,   14,   15,   16,  391,  350,  351,  391,  114,  476,
- /*  1120 */   477,   44,  370,   49,  481,  482,  350,  351,  417,  350,
- /*  1130 */   351,   57,   58,   59,   60,  370,   62,  341,   44,  443,
- /*  1140 */   169,  445,  364,  365,  341,  341,  370,  142,  144,  370,
- /*  1150 */   341,  147,  148,  149,  150,  151,  152,  153,  154,  155,
- /*  1160 */   156,  157,  158,  159,  160,  161,  162,  163,   44,  165,
- /*  1170 */   166,  167,  350,  351,  258,  259,  102,  170,  106,  105,
- /*  1180 */   108,  109,    0,  111,  359,  341,  341,  391,  183,  184,
- /*  1190 */   185,  341,  370,  188,  391,  391,  341,  379,  259,  388,
- /*  1200 */   391,  351,  391,  353,   22,  133,  201,  202,  341,  137,
- /*  1210 */   385,  388,  394,  372,  391,  368,  375,  212,  247,   42,
- /*  1220 */   215,   44,  341,  218,  219,  220,  221,  222,  257,  379,
- /*  1230 */   366,   22,  351,  369,  353,  391,  391,   45,   46,   44,
- /*  1240 */    42,  391,   44,  393,   35,  114,  391,  173,  174,   13,
- /*  1250 */   107,  172,  341,  110,  180,  181,  107,  172,  391,  110,
- /*  1260 */   379,  217,  351,  107,  353,  260,  110,  107,   44,   13,
- /*  1270 */   110,   35,  391,  199,  393,    0,   44,  427,  207,  429,
- /*  1280 */   209,   44,  432,  433,  434,  435,  436,  437,   68,  439,
- /*  1290 */   379,   35,  140,  141,  444,  164,  446,   22,  342,  104,
- /*  1300 */   450,  451,  391,  474,  393,   35,   44,   44,  427,  103,
- /*  1310 */   429,  401,  485,  432,  433,  434,  435,  436,  437,  113,
- /*  1320 */   439,   44,   44,   35,   22,  444,   44,  446,  104,   44,
- /*  1330 */    44,  450,  451,    1,    2,   44,  104,   35,  427,   44,
- /*  1340 */   429,  104,  341,  432,  433,  434,  435,  436,  437,   44,
- /*  1350 */   439,    0,  351,   12,   13,  444,  468,  446,    2,   44,
- /*  1360 */   354,  450,  451,   22,    8,    9,  104,  104,   12,   13,
- /*  1370 */    14,   15,   16,  341,   33,  367,   35,   75,  284,   44,
- /*  1380 */   379,  104,  104,  351,   44,   13,  104,  367,  379,  104,
- /*  1390 */   104,   13,  391,   44,  393,  104,  410,   44,  401,  104,
- /*  1400 */   354,   50,  100,   62,  349,  351,  282,   35,  390,  104,
- /*  1410 */   341,  379,  401,   35,  460,  478,   75,  452,   49,  104,
- /*  1420 */   351,  462,  412,  391,  262,  393,  428,   20,  427,  206,
- /*  1430 */   429,  189,  359,  432,  433,  434,  435,  436,  437,  104,
- /*  1440 */   439,  100,  421,  223,  104,  444,  421,  446,  379,  426,
- /*  1450 */   359,  450,  451,  104,  414,   20,  351,  104,   42,  427,
- /*  1460 */   391,  429,  393,  193,  432,  433,  434,  435,  436,  437,
- /*  1470 */    20,  439,  351,  398,  396,  169,  444,  401,  446,  398,
- /*  1480 */    20,  193,  450,  451,  350,  398,  351,  350,  396,  396,
- /*  1490 */   101,  363,   99,  191,  362,  193,  427,  350,  429,  341,
- /*  1500 */    98,  432,  433,  434,  435,  436,  437,  361,  439,  351,
- /*  1510 */    20,  350,  343,  350,  350,  446,   48,  347,  343,  450,
- /*  1520 */   451,  347,  421,   20,  359,  223,  224,  359,   20,  393,
- /*  1530 */   352,   20,  191,  413,  193,  359,  352,  379,  359,  359,
- /*  1540 */   359,  350,  359,  343,  343,  379,  379,  350,  341,  391,
- /*  1550 */   379,  393,  379,  210,  425,  103,  423,  197,  351,  421,
- /*  1560 */   357,  420,  196,  391,  223,  224,  379,  379,  379,  379,
- /*  1570 */   419,  357,  379,  379,  341,  379,  391,  236,  237,  238,
- /*  1580 */   239,  240,  241,  242,  351,  427,  379,  429,  350,  195,
- /*  1590 */   432,  433,  434,  435,  436,  437,  391,  439,  391,  269,
- /*  1600 */   393,  393,  391,  277,  446,  401,  467,  268,  450,  451,
- /*  1610 */   391,  401,  379,  391,  412,  467,  391,  418,  406,  406,
- /*  1620 */   470,  182,  469,  279,  391,  341,  393,  263,  278,  412,
- /*  1630 */   486,  286,  259,  281,  427,  351,  429,  283,  341,  432,
- /*  1640 */   433,  434,  435,  436,  437,  351,  439,   20,  351,  357,
- /*  1650 */   352,   20,  466,  446,  404,  406,  357,  450,  451,  431,
- /*  1660 */   427,  406,  429,  379,  391,  432,  433,  434,  435,  436,
- /*  1670 */   437,  438,  439,  440,  441,  391,  379,  393,  391,  174,
- /*  1680 */   391,  465,  467,  403,  391,  464,  357,  341,  391,  375,
- /*  1690 */   393,  391,  391,  357,  103,  449,  103,  351,  480,  351,
- /*  1700 */   383,  391,  369,   36,  341,  479,  344,  350,  343,    0,
- /*  1710 */   407,  427,  357,  429,  351,  407,  432,  433,  434,  435,
- /*  1720 */   436,  437,  415,  439,  427,  379,  429,  339,  358,  432,
- /*  1730 */   433,  434,  435,  436,  437,  422,  439,  391,    0,  393,
- /*  1740 */   373,  373,  379,  446,  373,    0,   42,  384,  451,    0,
- /*  1750 */    35,  216,   35,  341,  391,   35,  393,   35,  216,    0,
- /*  1760 */    35,   35,  216,  351,    0,  216,    0,  483,  484,   35,
- /*  1770 */     0,    0,   22,  427,   35,  429,  211,  341,  432,  433,
- /*  1780 */   434,  435,  436,  437,    0,  439,  199,  351,    0,  199,
- /*  1790 */   427,  379,  429,  193,  200,  432,  433,  434,  435,  436,
- /*  1800 */   437,  191,  439,  391,  341,  393,    0,    0,    0,  187,
- /*  1810 */   186,    0,    0,    0,  351,  379,   47,    0,    0,  473,
- /*  1820 */   384,   47,    0,   42,  341,    0,    0,  391,    0,  393,
- /*  1830 */    47,    0,    0,    0,  351,    0,    0,    0,  159,  427,
- /*  1840 */    35,  429,  379,    0,  432,  433,  434,  435,  436,  437,
- /*  1850 */   159,  439,    0,    0,  391,    0,  393,    0,    0,    0,
- /*  1860 */     0,    0,  379,  427,    0,  429,    0,  384,  432,  433,
- /*  1870 */   434,  435,  436,  437,  391,  439,  393,   47,    0,    0,
- /*  1880 */    42,    0,    0,    0,    0,    0,   62,  475,    0,    0,
- /*  1890 */   427,  341,  429,    0,    0,  432,  433,  434,  435,  436,
- /*  1900 */   437,  351,  439,    0,    0,    0,    0,    0,   22,    0,
- /*  1910 */   427,  143,  429,    0,   22,  432,  433,  434,  435,  436,
- /*  1920 */   437,  341,  439,   48,   48,    0,   35,    0,    0,  379,
- /*  1930 */    22,  351,   62,   62,  384,    0,    0,   39,    0,   49,
- /*  1940 */    39,  391,    0,  393,   49,   35,   35,  484,   49,   35,
- /*  1950 */     0,   39,   35,    0,   14,   39,    0,   42,    0,  379,
- /*  1960 */     0,   39,   44,   40,  384,    0,   47,   47,   47,   39,
- /*  1970 */     0,  391,  182,  393,   35,   49,   39,  427,    0,  429,
- /*  1980 */   341,    0,  432,  433,  434,  435,  436,  437,    1,  439,
- /*  1990 */   351,    0,    0,   69,    0,   49,   35,    0,   39,   35,
- /*  2000 */    49,   39,    0,   35,   49,   39,   19,  427,    0,  429,
- /*  2010 */     0,    0,  432,  433,  434,  435,  436,  437,  379,  439,
- /*  2020 */    33,    0,    0,    0,    0,   35,   22,   44,   35,   44,
- /*  2030 */   391,   35,  393,   35,   35,   35,   49,    0,   35,   22,
- /*  2040 */    35,  112,  110,    0,   57,   58,   59,   60,   35,   62,
- /*  2050 */    35,   35,   22,  341,   22,    0,   22,   51,    0,    0,
- /*  2060 */    35,   35,   35,  351,    0,    0,  427,   22,  429,   20,
- /*  2070 */    35,  432,  433,  434,  435,  436,  437,   35,  439,   35,
- /*  2080 */   104,   35,  103,  103,  341,  198,    0,    0,   22,  102,
- /*  2090 */   194,  379,  105,   22,  351,    0,    3,   44,  264,  104,
- /*  2100 */    48,   44,    3,  391,  103,  393,  172,  174,   48,  178,
- /*  2110 */    47,   99,  103,  172,   44,  172,  172,   44,  104,  341,
- /*  2120 */   101,  103,  379,  178,  104,  138,   47,   44,   44,  351,
- /*  2130 */   258,  103,  103,  264,  391,  104,  393,  104,  264,  427,
- /*  2140 */   104,  429,  103,   35,  432,  433,  434,  435,  436,  437,
- /*  2150 */    35,  439,   35,   35,   35,   35,  341,  379,   47,   47,
- /*  2160 */   173,    0,    0,   47,   39,  104,  351,  180,   44,  391,
- /*  2170 */   427,  393,  429,  104,    0,  432,  433,  434,  435,  436,
- /*  2180 */   437,  341,  439,  103,  103,  103,  199,   39,  113,  104,
- /*  2190 */    47,  351,  104,  103,  379,  103,   44,  103,  101,  245,
- /*  2200 */     2,  101,   22,   47,  103,  427,  391,  429,  393,  223,
- /*  2210 */   432,  433,  434,  435,  436,  437,  175,  439,  341,  379,
- /*  2220 */   173,   22,   47,  114,   35,  104,  104,   35,  351,  103,
- /*  2230 */   103,  391,  104,  393,  103,  103,   35,  104,  103,   35,
- /*  2240 */   104,  103,  427,  341,  429,  104,  104,  432,  433,  434,
- /*  2250 */   435,  436,  437,  351,  439,  104,  379,  103,  103,   35,
- /*  2260 */   103,   35,  104,  225,  104,   35,  103,  427,  391,  429,
- /*  2270 */   393,  103,  432,  433,  434,  435,  436,  437,  125,  439,
- /*  2280 */   103,  379,   44,   35,  125,   22,  103,  103,   69,  125,
- /*  2290 */   125,   68,   35,  391,   35,  393,   35,   35,   44,   35,
- /*  2300 */    35,   35,   35,   75,  427,   97,  429,   35,   35,  432,
- /*  2310 */   433,  434,  435,  436,  437,  341,  439,   35,   22,   35,
- /*  2320 */    35,   35,   75,   35,   35,  351,   35,   35,   35,  427,
- /*  2330 */   341,  429,   22,   35,  432,  433,  434,  435,  436,  437,
- /*  2340 */   351,  439,    0,   35,   49,   39,    0,   35,  341,   49,
- /*  2350 */     0,   35,   39,  379,   49,    0,   39,   35,  351,   39,
- /*  2360 */     0,   35,   35,   49,    0,  391,   22,  393,  379,   21,
- /*  2370 */   487,   22,   20,   22,   21,  487,  487,  487,  487,  487,
- /*  2380 */   391,  487,  393,  487,  487,  487,  379,  487,  487,  487,
- /*  2390 */   487,  487,  487,  487,  487,  341,  487,  487,  391,  487,
- /*  2400 */   393,  427,  487,  429,  487,  351,  432,  433,  434,  435,
- /*  2410 */   436,  437,  487,  439,  487,  487,  427,  341,  429,  487,
- /*  2420 */   487,  432,  433,  434,  435,  436,  437,  351,  439,  487,
- /*  2430 */   487,  487,  487,  379,  427,  487,  429,  487,  487,  432,
- /*  2440 */   433,  434,  435,  436,  437,  391,  439,  393,  487,  487,
- /*  2450 */   487,  487,  487,  487,  487,  379,  487,  487,  487,  487,
- /*  2460 */   487,  487,  487,  487,  341,  487,  487,  391,  487,  393,
- /*  2470 */   487,  487,  487,  487,  351,  487,  487,  487,  487,  487,
- /*  2480 */   487,  427,  487,  429,  487,  487,  432,  433,  434,  435,
- /*  2490 */   436,  437,  487,  439,  487,  487,  487,  487,  487,  487,
- /*  2500 */   487,  487,  379,  427,  487,  429,  487,  487,  432,  433,
- /*  2510 */   434,  435,  436,  437,  391,  439,  393,  487,  487,  487,
- /*  2520 */   487,  487,  487,  341,  487,  487,  487,  487,  487,  487,
- /*  2530 */   487,  487,  487,  351,  487,  487,  341,  487,  487,  487,
- /*  2540 */   487,  487,  487,  487,  487,  487,  351,  487,  487,  487,
- /*  2550 */   427,  487,  429,  341,  487,  432,  433,  434,  435,  436,
- /*  2560 */   437,  379,  439,  351,  487,  487,  487,  487,  487,  487,
- /*  2570 */   487,  487,  487,  391,  379,  393,  487,  487,  487,  487,
- /*  2580 */   487,  487,  487,  487,  487,  341,  391,  487,  393,  487,
- /*  2590 */   487,  379,  487,  487,  487,  351,  487,  487,  487,  487,
- /*  2600 */   487,  487,  487,  391,  487,  393,  487,  487,  487,  427,
- /*  2610 */   487,  429,  487,  487,  432,  433,  434,  435,  436,  437,
- /*  2620 */   487,  439,  427,  379,  429,  487,  487,  432,  433,  434,
- /*  2630 */   435,  436,  437,  487,  439,  391,  487,  393,  487,  427,
- /*  2640 */   487,  429,  487,  487,  432,  433,  434,  435,  436,  437,
- /*  2650 */   487,  439,  341,  487,  487,  487,  487,  487,  487,  487,
- /*  2660 */   487,  487,  351,  487,  487,  487,  487,  487,  487,  487,
- /*  2670 */   487,  427,  341,  429,  487,  487,  432,  433,  434,  435,
- /*  2680 */   436,  437,  351,  439,  487,  487,  487,  487,  487,  487,
- /*  2690 */   379,  487,  487,  487,  487,  487,  487,  487,  487,  487,
- /*  2700 */   487,  487,  391,  487,  393,  487,  487,  487,  487,  487,
- /*  2710 */   379,  487,  487,  487,  487,  487,  487,  487,  487,  487,
- /*  2720 */   487,  487,  391,  487,  393,  487,  487,  487,  487,  487,
- /*  2730 */   487,  487,  487,  487,  487,  487,  487,  487,  427,  487,
- /*  2740 */   429,  487,  341,  432,  433,  434,  435,  436,  437,  487,
- /*  2750 */   439,  487,  351,  487,  487,  487,  487,  487,  427,  341,
- /*  2760 */   429,  487,  487,  432,  433,  434,  435,  436,  437,  351,
- /*  2770 */   439,  487,  487,  487,  487,  487,  487,  487,  487,  487,
- /*  2780 */   379,  487,  487,  487,  487,  487,  487,  487,  487,  487,
- /*  2790 */   487,  487,  391,  487,  393,  487,  487,  379,  487,  487,
- /*  2800 */   487,  487,  487,  487,  487,  487,  487,  487,  487,  391,
- /*  2810 */   487,  393,  487,  487,  487,  487,  487,  487,  487,  487,
- /*  2820 */   487,  487,  487,  487,  487,  487,  487,  487,  427,  487,
- /*  2830 */   429,  487,  487,  432,  433,  434,  435,  436,  437,  487,
- /*  2840 */   439,  487,  487,  487,  487,  427,  487,  429,  487,  487,
- /*  2850 */   432,  433,  434,  435,  436,  437,  487,  439,  338,  338,
- /*  2860 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  2870 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  2880 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  2890 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  2900 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  2910 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  2920 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  2930 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  2940 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  2950 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  2960 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  2970 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  2980 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  2990 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  3000 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  3010 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  3020 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  3030 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  3040 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  3050 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  3060 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  3070 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  3080 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  3090 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  3100 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  3110 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  3120 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  3130 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  3140 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  3150 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  3160 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  3170 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  3180 */   338,  338,  338,  338,  338,  338,  338,  338,  338,  338,
- /*  3190 */   338,  338,  338,  338,  338,  338,
+ /*  1090 */    88,   89,   90,   91,   92,   93,   94,   95,   96,  343,
+ /*  1100 */   393,  393,  262,   49,  140,  141,  102,  247,  103,   33,
+ /*  1110 */   352,  353,  352,  353,  381,    8,    9,  257,  114,   12,
+ /*  1120 */    13,   14,   15,   16,  343,   49,  352,  353,   20,  396,
+ /*  1130 */   372,   44,  372,   57,   58,   59,   60,   42,   62,   44,
+ /*  1140 */   176,  177,  170,  172,   62,  413,  372,  142,  144,  393,
+ /*  1150 */   343,  147,  148,  149,  150,  151,  152,  153,  154,  155,
+ /*  1160 */   156,  157,  158,  159,  160,  161,  162,  163,  343,  165,
+ /*  1170 */   166,  167,  343,   42,  393,   44,  352,  353,  102,  352,
+ /*  1180 */   353,  105,   44,  170,  102,   22,  343,  105,  183,  184,
+ /*  1190 */   185,    0,  460,  188,  343,  463,  372,  114,   35,  372,
+ /*  1200 */   393,   68,  343,  159,  353,  368,  201,  202,  371,   44,
+ /*  1210 */   478,  479,  168,   45,   46,  483,  484,  212,  393,   35,
+ /*  1220 */   215,  343,  393,  218,  219,  220,  221,  222,  259,  260,
+ /*  1230 */    22,  353,  381,  355,  107,   44,  393,  110,  217,   35,
+ /*  1240 */    44,  343,  107,   35,  393,  110,  395,  164,   13,  173,
+ /*  1250 */   174,  353,  393,  355,    0,   13,  180,  181,  263,  381,
+ /*  1260 */    44,  107,  107,  100,  110,  110,  207,  262,  209,  104,
+ /*  1270 */    35,  393,    0,  395,    0,  199,   22,   35,  170,  381,
+ /*  1280 */   429,   44,  431,   44,  382,  434,  435,  436,  437,  438,
+ /*  1290 */   439,  393,  441,  395,   22,   44,   22,  446,  370,  448,
+ /*  1300 */   104,  140,  141,  452,  453,   44,   44,  429,   44,  431,
+ /*  1310 */    44,  476,  434,  435,  436,  437,  438,  439,   47,  441,
+ /*  1320 */   104,   44,    1,    2,  446,   44,  448,  429,  487,  431,
+ /*  1330 */   452,  453,  434,  435,  436,  437,  438,  439,   44,  441,
+ /*  1340 */    44,  104,   44,  104,  446,   44,  448,   44,   44,  343,
+ /*  1350 */   452,  453,   44,   13,   13,  104,  223,  356,  470,  353,
+ /*  1360 */     0,  355,  369,   35,  381,  104,  104,  369,  104,  462,
+ /*  1370 */   104,  284,  412,  356,  103,   35,   35,  193,  343,  403,
+ /*  1380 */   351,  104,  392,  353,  403,  104,  464,  381,  353,  480,
+ /*  1390 */   355,  454,  264,  414,   49,  430,   20,  193,  104,  393,
+ /*  1400 */   104,  395,  104,   75,  206,  104,  428,  104,  104,  423,
+ /*  1410 */    50,  361,  104,  343,  423,  189,  381,  361,   20,  416,
+ /*  1420 */   353,   42,  400,  353,  286,  355,   20,  403,  393,  169,
+ /*  1430 */   395,  353,  400,   20,  398,  429,  352,  431,  353,  400,
+ /*  1440 */   434,  435,  436,  437,  438,  439,  352,  441,  101,  398,
+ /*  1450 */   398,  381,  446,  365,  448,   99,  364,  352,  452,  453,
+ /*  1460 */    98,  363,  352,  393,  429,  395,  431,  352,  352,  434,
+ /*  1470 */   435,  436,  437,  438,  439,   20,  441,  345,   48,  349,
+ /*  1480 */   423,  446,  345,  448,  361,  349,   20,  452,  453,   20,
+ /*  1490 */   361,  395,   20,  354,  415,  361,  354,  352,  345,  429,
+ /*  1500 */   343,  431,  361,  381,  434,  435,  436,  437,  438,  439,
+ /*  1510 */   353,  441,  355,  361,   12,   13,  446,  361,  448,  361,
+ /*  1520 */   345,  381,  452,  453,   22,  381,  352,  381,  381,  381,
+ /*  1530 */   381,  381,  343,  210,  103,   33,  393,   35,  381,  427,
+ /*  1540 */   381,  381,  353,  381,  393,  425,  359,  423,  197,  196,
+ /*  1550 */   393,  359,  395,  195,  352,  271,  270,  393,  469,  469,
+ /*  1560 */   182,  343,  279,  472,   62,  395,  393,  468,  471,  393,
+ /*  1570 */   381,  353,  393,  393,  403,  403,  281,   75,  469,  280,
+ /*  1580 */   467,  265,  393,  414,  395,  466,  429,  421,  431,  422,
+ /*  1590 */   408,  434,  435,  436,  437,  438,  439,  420,  441,  381,
+ /*  1600 */   414,  408,  100,  446,  285,  448,  288,  482,  283,  452,
+ /*  1610 */   453,  393,  353,  395,  488,   20,  433,  354,  429,   20,
+ /*  1620 */   431,  406,  408,  434,  435,  436,  437,  438,  439,  359,
+ /*  1630 */   441,  393,  359,  393,  393,  408,  343,  448,  393,  393,
+ /*  1640 */   393,  452,  453,  353,  174,  377,  353,  429,  405,  431,
+ /*  1650 */   359,  359,  434,  435,  436,  437,  438,  439,  103,  441,
+ /*  1660 */   451,  103,  481,  343,  385,  352,  448,   36,  393,  359,
+ /*  1670 */   452,  453,  346,  353,  381,  345,  371,  424,  409,  341,
+ /*  1680 */     0,  375,  417,    0,  375,  409,  393,  375,  395,  360,
+ /*  1690 */     0,   42,    0,  191,   35,  193,  216,   35,   35,   35,
+ /*  1700 */   216,  381,   35,   35,  216,    0,  216,    0,   35,    0,
+ /*  1710 */    22,    0,   35,  393,    0,  395,  211,    0,  199,    0,
+ /*  1720 */   199,  193,  429,  200,  431,  223,  224,  434,  435,  436,
+ /*  1730 */   437,  438,  439,  440,  441,  442,  443,  191,  236,  237,
+ /*  1740 */   238,  239,  240,  241,  242,    0,    0,    0,  187,  429,
+ /*  1750 */   186,  431,    0,    0,  434,  435,  436,  437,  438,  439,
+ /*  1760 */   343,  441,   47,    0,    0,    0,    0,   47,   42,    0,
+ /*  1770 */   353,    0,    0,    0,   47,    0,    0,    0,    0,    0,
+ /*  1780 */   159,  343,    0,   35,    0,  159,    0,    0,    0,    0,
+ /*  1790 */     0,  353,    0,    0,    0,    0,    0,    0,  381,    0,
+ /*  1800 */     0,    0,    0,   47,    0,  485,  486,  343,    0,   42,
+ /*  1810 */   393,    0,  395,    0,    0,    0,    0,  353,    0,  381,
+ /*  1820 */    22,    0,    0,    0,  386,  143,    0,   22,   48,   22,
+ /*  1830 */     0,  393,   62,  395,    0,    0,   62,    0,   35,   48,
+ /*  1840 */     0,   35,    0,   62,   35,  381,  429,    0,  431,   39,
+ /*  1850 */   386,  434,  435,  436,  437,  438,  439,  393,  441,  395,
+ /*  1860 */    35,   49,    0,   39,   35,  448,   49,  429,  343,  431,
+ /*  1870 */   453,   39,  434,  435,  436,  437,  438,  439,  353,  441,
+ /*  1880 */    49,  343,    0,   42,   39,   47,   47,   44,   14,    0,
+ /*  1890 */    40,  353,   39,  429,  343,  431,   47,    0,  434,  435,
+ /*  1900 */   436,  437,  438,  439,  353,  441,  381,    0,    0,   39,
+ /*  1910 */   182,    0,    0,    0,    0,   69,    0,   39,  393,  381,
+ /*  1920 */   395,   35,   49,    0,   49,   35,   39,    0,   35,   49,
+ /*  1930 */    39,  393,  381,  395,    0,   39,   35,  386,    0,    0,
+ /*  1940 */     0,   49,    0,  343,  393,    0,  395,    0,  112,    0,
+ /*  1950 */    35,   22,   35,  353,  429,   35,  431,   35,  110,  434,
+ /*  1960 */   435,  436,  437,  438,  439,   35,  441,  429,  343,  431,
+ /*  1970 */    35,   35,  434,  435,  436,  437,  438,  439,  353,  441,
+ /*  1980 */   429,  381,  431,   35,    0,  434,  435,  436,  437,  438,
+ /*  1990 */   439,   35,  441,  393,   44,  395,   44,   35,   22,   35,
+ /*  2000 */    22,    0,  477,   22,   51,    0,  381,   22,   35,    0,
+ /*  2010 */    35,  386,    0,    0,   35,  343,   22,   20,  393,    3,
+ /*  2020 */   395,   35,  104,   35,  486,  353,   35,  103,    0,  429,
+ /*  2030 */   172,  431,   22,   35,  434,  435,  436,  437,  438,  439,
+ /*  2040 */   103,  441,  198,  443,    0,  343,  194,   22,  172,    0,
+ /*  2050 */     0,  174,   44,  381,  429,  353,  431,  172,  386,  434,
+ /*  2060 */   435,  436,  437,  438,  439,  393,  441,  395,    1,  103,
+ /*  2070 */   172,  104,  178,  178,  103,   48,  104,   48,  101,   99,
+ /*  2080 */    47,   44,  343,  381,   44,  266,   19,  104,   47,   44,
+ /*  2090 */    44,    3,  353,  103,  266,  393,  103,  395,  103,  103,
+ /*  2100 */    33,  429,   44,  431,  343,   35,  434,  435,  436,  437,
+ /*  2110 */   438,  439,   35,  441,  353,  104,   49,   35,  104,  104,
+ /*  2120 */   381,  266,  261,   47,   57,   58,   59,   60,   35,   62,
+ /*  2130 */    35,  429,  393,  431,  395,   35,  434,  435,  436,  437,
+ /*  2140 */   438,  439,  381,  441,   47,   44,  104,  104,    0,    0,
+ /*  2150 */   103,   39,   47,    0,  393,  103,  395,  258,  104,  104,
+ /*  2160 */   103,   39,  103,  103,  175,  173,  103,   47,  429,  102,
+ /*  2170 */   431,   44,  105,  434,  435,  436,  437,  438,  439,  113,
+ /*  2180 */   441,  101,  101,    2,   22,   47,  245,  103,  223,  104,
+ /*  2190 */   429,   47,  431,  103,  343,  434,  435,  436,  437,  438,
+ /*  2200 */   439,   22,  441,  104,  353,  138,  103,  225,  104,  103,
+ /*  2210 */   103,  343,  104,  103,  125,  104,  114,   35,   35,  103,
+ /*  2220 */    35,  353,  104,  104,  103,   35,  103,   35,  104,  103,
+ /*  2230 */    35,  103,  381,  104,  104,   35,  103,  103,  125,  125,
+ /*  2240 */   173,   44,  125,  343,  393,  103,  395,  180,   35,  381,
+ /*  2250 */   103,   22,   68,  353,   35,   69,   35,   35,   35,   35,
+ /*  2260 */    35,  393,  343,  395,   75,   35,  199,   35,   97,   35,
+ /*  2270 */    44,   35,  353,   35,   22,   35,   35,   35,   75,   35,
+ /*  2280 */   429,  381,  431,   35,   35,  434,  435,  436,  437,  438,
+ /*  2290 */   439,   35,  441,  393,   35,  395,   22,  429,   35,  431,
+ /*  2300 */   381,    0,  434,  435,  436,  437,  438,  439,   35,  441,
+ /*  2310 */    49,  343,  393,   35,  395,   39,    0,   49,   39,    0,
+ /*  2320 */    35,  353,   39,    0,   49,   35,   49,   39,    0,  429,
+ /*  2330 */   343,  431,   35,   35,  434,  435,  436,  437,  438,  439,
+ /*  2340 */   353,  441,    0,   22,   22,   21,   20,   22,  429,  381,
+ /*  2350 */   431,   21,  489,  434,  435,  436,  437,  438,  439,  489,
+ /*  2360 */   441,  393,  343,  395,  489,  489,  489,  489,  381,  489,
+ /*  2370 */   489,  489,  353,  489,  489,  489,  489,  489,  489,  343,
+ /*  2380 */   393,  489,  395,  489,  489,  489,  489,  489,  489,  353,
+ /*  2390 */   489,  489,  489,  489,  489,  489,  489,  429,  489,  431,
+ /*  2400 */   381,  489,  434,  435,  436,  437,  438,  439,  489,  441,
+ /*  2410 */   489,  489,  393,  489,  395,  489,  429,  381,  431,  489,
+ /*  2420 */   489,  434,  435,  436,  437,  438,  439,  489,  441,  393,
+ /*  2430 */   343,  395,  489,  489,  489,  489,  489,  489,  489,  489,
+ /*  2440 */   353,  343,  489,  489,  489,  489,  489,  489,  429,  489,
+ /*  2450 */   431,  353,  343,  434,  435,  436,  437,  438,  439,  489,
+ /*  2460 */   441,  489,  353,  489,  489,  429,  489,  431,  381,  489,
+ /*  2470 */   434,  435,  436,  437,  438,  439,  489,  441,  489,  381,
+ /*  2480 */   393,  489,  395,  489,  489,  489,  489,  489,  489,  489,
+ /*  2490 */   381,  393,  489,  395,  489,  489,  489,  489,  489,  489,
+ /*  2500 */   489,  489,  393,  489,  395,  489,  489,  489,  489,  489,
+ /*  2510 */   489,  489,  489,  489,  489,  489,  429,  489,  431,  489,
+ /*  2520 */   343,  434,  435,  436,  437,  438,  439,  429,  441,  431,
+ /*  2530 */   353,  489,  434,  435,  436,  437,  438,  439,  429,  441,
+ /*  2540 */   431,  343,  489,  434,  435,  436,  437,  438,  439,  489,
+ /*  2550 */   441,  353,  489,  489,  489,  489,  489,  489,  381,  489,
+ /*  2560 */   489,  489,  489,  489,  489,  489,  489,  489,  489,  489,
+ /*  2570 */   393,  489,  395,  489,  489,  489,  489,  489,  489,  381,
+ /*  2580 */   489,  489,  489,  489,  489,  489,  489,  489,  343,  489,
+ /*  2590 */   489,  393,  489,  395,  489,  489,  489,  489,  353,  489,
+ /*  2600 */   489,  489,  489,  489,  489,  489,  429,  343,  431,  489,
+ /*  2610 */   489,  434,  435,  436,  437,  438,  439,  353,  441,  489,
+ /*  2620 */   489,  489,  489,  489,  489,  489,  381,  429,  489,  431,
+ /*  2630 */   489,  489,  434,  435,  436,  437,  438,  439,  393,  441,
+ /*  2640 */   395,  489,  489,  489,  489,  381,  489,  489,  489,  489,
+ /*  2650 */   489,  489,  489,  489,  489,  489,  343,  393,  489,  395,
+ /*  2660 */   489,  489,  489,  489,  489,  489,  353,  489,  489,  489,
+ /*  2670 */   489,  489,  489,  489,  429,  343,  431,  489,  489,  434,
+ /*  2680 */   435,  436,  437,  438,  439,  353,  441,  489,  489,  489,
+ /*  2690 */   489,  489,  489,  429,  381,  431,  489,  489,  434,  435,
+ /*  2700 */   436,  437,  438,  439,  489,  441,  393,  343,  395,  489,
+ /*  2710 */   489,  489,  489,  381,  489,  489,  489,  353,  489,  489,
+ /*  2720 */   489,  489,  489,  489,  343,  393,  489,  395,  489,  489,
+ /*  2730 */   489,  489,  489,  489,  353,  489,  489,  489,  489,  489,
+ /*  2740 */   489,  489,  429,  489,  431,  381,  489,  434,  435,  436,
+ /*  2750 */   437,  438,  439,  489,  441,  489,  489,  393,  489,  395,
+ /*  2760 */   489,  429,  381,  431,  489,  489,  434,  435,  436,  437,
+ /*  2770 */   438,  439,  489,  441,  393,  489,  395,  489,  489,  489,
+ /*  2780 */   489,  489,  489,  489,  489,  489,  489,  489,  489,  489,
+ /*  2790 */   489,  489,  489,  429,  489,  431,  489,  489,  434,  435,
+ /*  2800 */   436,  437,  438,  439,  489,  441,  489,  489,  489,  489,
+ /*  2810 */   429,  489,  431,  489,  489,  434,  435,  436,  437,  438,
+ /*  2820 */   439,  489,  441,  340,  340,  340,  340,  340,  340,  340,
+ /*  2830 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  2840 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  2850 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  2860 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  2870 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  2880 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  2890 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  2900 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  2910 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  2920 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  2930 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  2940 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  2950 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  2960 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  2970 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  2980 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  2990 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  3000 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  3010 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  3020 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  3030 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  3040 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  3050 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  3060 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  3070 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  3080 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  3090 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  3100 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  3110 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  3120 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  3130 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  3140 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  3150 */   340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+ /*  3160 */   340,  340,  340,
 };
-#define YY_SHIFT_COUNT    (799)
+#define YY_SHIFT_COUNT    (800)
 #define YY_SHIFT_MIN      (0)
-#define YY_SHIFT_MAX      (2364)
+#define YY_SHIFT_MAX      (2342)
 static const unsigned short int yy_shift_ofst[] = {
  /*     0 */  1005,    0,  104,    0,  337,  337,  337,  337,  337,  337,
  /*    10 */   337,  337,  337,  337,  337,  337,  441,  673,  673,  777,
  /*    20 */   673,  673,  673,  673,  673,  673,  673,  673,  673,  673,
  /*    30 */   673,  673,  673,  673,  673,  673,  673,  673,  673,  673,
  /*    40 */   673,  673,  673,  673,  673,  673,  673,  673,  673,  673,
- /*    50 */   673,   60,  259,  393,  629,  111,  739,  111,  629,  629,
- /*    60 */   111, 1341,  111, 1341, 1341,   66,  111,   68,  781,  101,
- /*    70 */   101,  781,   13,   13,  113,  294,   23,   23,  101,  101,
- /*    80 */   101,  101,  101,  101,  101,  101,  101,  101,  158,  101,
- /*    90 */   101,  211,   68,  101,  101,  285,   68,  101,  158,  101,
- /*   100 */   158,   68,  101,  101,   68,  101,   68,   68,   68,  101,
- /*   110 */   284, 1004,   15,   15,  303,  462, 1302, 1302, 1302, 1302,
- /*   120 */  1302, 1302, 1302, 1302, 1302, 1302, 1302, 1302, 1302, 1302,
- /*   130 */  1302, 1302, 1302, 1302, 1302, 1072,   18,  113,  294,  802,
- /*   140 */   802,  184,  346,  346,  346,  705,  312,  312,  184,  211,
- /*   150 */   254,  260,   68,  534,   68,  534,  534,  836,  619,   28,
- /*   160 */    28,   28,   28,   28,   28,   28,   28, 1987,  757,  261,
- /*   170 */   580,  613,  508,   49,  123,  343,  343,  526,  354, 1007,
- /*   180 */   299, 1079, 1192,  418,  398, 1085,  916,  939,  785,  916,
- /*   190 */  1177,  325,  290, 1162, 1369, 1407, 1223,  211, 1407,  211,
- /*   200 */  1242, 1435, 1416, 1450, 1435, 1416, 1306, 1460, 1435, 1460,
- /*   210 */  1416, 1306, 1306, 1389, 1393, 1460, 1402, 1460, 1460, 1460,
- /*   220 */  1490, 1468, 1490, 1468, 1407,  211, 1503,  211, 1508, 1511,
- /*   230 */   211, 1508,  211,  211,  211, 1460,  211, 1490,   68,   68,
- /*   240 */    68,   68,   68,   68,   68,   68,   68,   68,   68, 1460,
- /*   250 */  1490,  534,  534,  534, 1343, 1452, 1407,  284, 1360, 1366,
- /*   260 */  1503,  284, 1394, 1162, 1460, 1450, 1450,  534, 1330, 1339,
- /*   270 */   534, 1330, 1339,  534,  534,   68, 1326, 1439, 1330, 1344,
- /*   280 */  1350, 1364, 1162, 1345, 1354, 1352, 1373, 1435, 1627, 1508,
- /*   290 */   284,  284, 1631, 1339,  534,  534,  534,  534,  534, 1339,
- /*   300 */   534, 1505,  284,  836,  284, 1435, 1591, 1593,  534,  619,
- /*   310 */  1460,  284, 1667, 1490, 2858, 2858, 2858, 2858, 2858, 2858,
- /*   320 */  2858, 2858, 2858, 1002, 1074,  225,   32,  736,  750,  860,
- /*   330 */   687,  980, 1356,  434,  791,  197,  197,  197,  197,  197,
- /*   340 */   197,  197,  197,  197,  749,  265,  698,  698,   29,    6,
- /*   350 */    34,  307,  830,  562,  963,  902,  514,  282,  282, 1097,
- /*   360 */   728,  971, 1097, 1097, 1097,  983, 1044,  622, 1209, 1198,
- /*   370 */  1131, 1077, 1143, 1149, 1156, 1160, 1236, 1256,  815, 1182,
- /*   380 */  1275, 1071, 1195, 1224,   63, 1232, 1237, 1262, 1152, 1124,
- /*   390 */  1094, 1263, 1277, 1278, 1282, 1285, 1286, 1332, 1291, 1220,
- /*   400 */  1295,  311, 1305, 1315, 1335, 1340, 1349, 1353, 1206, 1270,
- /*   410 */  1288, 1372, 1378,  409, 1351, 1709, 1738, 1745, 1704, 1749,
- /*   420 */  1715, 1535, 1717, 1720, 1722, 1542, 1759, 1725, 1726, 1546,
- /*   430 */  1764, 1549, 1766, 1734, 1770, 1750, 1771, 1739, 1565, 1784,
- /*   440 */  1587, 1788, 1590, 1594, 1600, 1610, 1806, 1807, 1808, 1622,
- /*   450 */  1624, 1811, 1812, 1769, 1813, 1817, 1818, 1774, 1822, 1781,
- /*   460 */  1825, 1826, 1828, 1783, 1831, 1832, 1833, 1835, 1836, 1837,
- /*   470 */  1679, 1805, 1843, 1691, 1852, 1853, 1855, 1857, 1858, 1859,
- /*   480 */  1860, 1861, 1864, 1866, 1888, 1889, 1893, 1894, 1903, 1904,
- /*   490 */  1830, 1878, 1838, 1879, 1881, 1882, 1883, 1884, 1885, 1886,
- /*   500 */  1905, 1906, 1907, 1768, 1909, 1913, 1892, 1875, 1908, 1876,
- /*   510 */  1925, 1824, 1891, 1927, 1870, 1928, 1871, 1935, 1936, 1910,
- /*   520 */  1890, 1898, 1938, 1911, 1895, 1901, 1942, 1914, 1899, 1912,
- /*   530 */  1950, 1917, 1953, 1915, 1916, 1918, 1919, 1920, 1940, 1921,
- /*   540 */  1956, 1923, 1922, 1958, 1960, 1965, 1930, 1790, 1970, 1978,
- /*   550 */  1981, 1924, 1991, 1992, 1939, 1926, 1937, 1994, 1961, 1946,
- /*   560 */  1959, 1997, 1964, 1951, 1962, 2002, 1968, 1955, 1966, 2008,
- /*   570 */  2010, 2011, 2021, 2022, 2023, 1929, 1932, 1990, 2004, 2024,
- /*   580 */  1993, 1996, 1998, 1999, 2000, 2003, 2005, 1983, 1985, 2013,
- /*   590 */  2015, 2017, 2016, 2037, 2030, 2043, 2032, 2006, 2055, 2034,
- /*   600 */  2025, 2058, 2026, 2059, 2027, 2064, 2045, 2049, 2035, 2042,
- /*   610 */  2044, 1976, 1979, 2065, 1934, 1980, 1887, 2046, 2066, 2086,
- /*   620 */  1896, 2071, 1941, 1933, 2087, 2095, 1943, 1931, 1944, 1945,
- /*   630 */  2093, 2053, 1834, 2001, 1995, 2009, 2052, 2019, 2060, 2012,
- /*   640 */  2014, 2057, 2070, 2020, 2018, 2028, 2029, 2031, 2073, 2063,
- /*   650 */  2079, 2039, 2083, 1869, 2033, 2036, 2099, 2084, 1874, 2108,
- /*   660 */  2115, 2117, 2118, 2119, 2120, 2061, 2069, 2111, 1872, 2124,
- /*   670 */  2112, 2161, 2162, 2080, 2125, 1919, 2116, 2081, 2085, 2088,
- /*   680 */  2082, 2090, 2041, 2092, 2174, 2148, 2047, 2094, 2075, 1919,
- /*   690 */  2143, 2152, 2097, 1954, 2100, 2198, 2180, 1986, 2101, 2121,
- /*   700 */  2126, 2122, 2127, 2128, 2156, 2131, 2132, 2175, 2133, 2199,
- /*   710 */  2038, 2135, 2109, 2136, 2189, 2192, 2138, 2141, 2201, 2154,
- /*   720 */  2142, 2204, 2155, 2151, 2224, 2157, 2158, 2226, 2163, 2160,
- /*   730 */  2230, 2168, 2153, 2159, 2164, 2165, 2177, 2238, 2183, 2248,
- /*   740 */  2184, 2238, 2238, 2263, 2219, 2223, 2257, 2259, 2261, 2262,
- /*   750 */  2264, 2265, 2266, 2267, 2228, 2208, 2254, 2272, 2273, 2282,
- /*   760 */  2296, 2284, 2285, 2286, 2247, 1983, 2288, 1985, 2289, 2291,
- /*   770 */  2292, 2293, 2310, 2298, 2342, 2308, 2295, 2306, 2346, 2312,
- /*   780 */  2300, 2313, 2350, 2316, 2305, 2317, 2355, 2322, 2314, 2320,
- /*   790 */  2360, 2326, 2327, 2364, 2344, 2348, 2349, 2351, 2353, 2352,
+ /*    50 */   673,   60,  285,  840,  491,  286,  341,  286,  491,  491,
+ /*    60 */   286, 1502,  286, 1502, 1502,  117,  286,  141,  964,  158,
+ /*    70 */   158,  964,   13,   13,  153,  180,   23,   23,  158,  158,
+ /*    80 */   158,  158,  158,  158,  158,  158,  158,  158,  309,  158,
+ /*    90 */   158,  304,  141,  158,  158,  495,  141,  158,  309,  158,
+ /*   100 */   309,  141,  158,  158,  141,  158,  141,  141,  141,  158,
+ /*   110 */   385, 1004,   15,   15,  303,  402,  728,  728,  728,  728,
+ /*   120 */   728,  728,  728,  728,  728,  728,  728,  728,  728,  728,
+ /*   130 */   728,  728,  728,  728,  728,  930,   18,  153,  180,  598,
+ /*   140 */   598,  625,   87,   87,   87,  762,  122,  122,  625,  304,
+ /*   150 */   444,  296,  141,  566,  141,  566,  566,  610,  683,   28,
+ /*   160 */    28,   28,   28,   28,   28,   28,   28, 2067,  666,  261,
+ /*   170 */   486,   32,  194,   49,  109,  607,  607,  432,  492,  432,
+ /*   180 */   972,  817, 1013,  437,  789, 1168,  906,  359,  971,  244,
+ /*   190 */   969, 1095,  995, 1108, 1128, 1345, 1376, 1198,  304, 1376,
+ /*   200 */   304, 1226, 1398, 1379, 1406, 1398, 1379, 1260, 1413, 1398,
+ /*   210 */  1413, 1379, 1260, 1260, 1347, 1356, 1413, 1362, 1413, 1413,
+ /*   220 */  1413, 1455, 1430, 1455, 1430, 1376,  304, 1466,  304, 1469,
+ /*   230 */  1472,  304, 1469,  304,  304,  304, 1413,  304, 1455,  141,
+ /*   240 */   141,  141,  141,  141,  141,  141,  141,  141,  141,  141,
+ /*   250 */  1413, 1455,  566,  566,  566, 1323, 1431, 1376,  385, 1351,
+ /*   260 */  1353, 1466,  385, 1358, 1128, 1413, 1406, 1406,  566, 1284,
+ /*   270 */  1286,  566, 1284, 1286,  566,  566,  141, 1283, 1378, 1284,
+ /*   280 */  1295, 1299, 1316, 1128, 1318, 1319, 1325, 1398, 1595, 1469,
+ /*   290 */   385,  385, 1599, 1286,  566,  566,  566,  566,  566, 1286,
+ /*   300 */   566, 1470,  385,  610,  385, 1398, 1555, 1558,  566,  683,
+ /*   310 */  1413,  385, 1631, 1455, 2823, 2823, 2823, 2823, 2823, 2823,
+ /*   320 */  2823, 2823, 2823, 1002, 1076,  225,  509,  755,  434,  583,
+ /*   330 */   633,  717,  822,  197,  734, 1107, 1107, 1107, 1107, 1107,
+ /*   340 */  1107, 1107, 1107, 1107,  450,  858,  348,  348,   29,    6,
+ /*   350 */   270, 1044, 1082,  952, 1163,  366,  411,  144,  144, 1033,
+ /*   360 */   383,  860, 1033, 1033, 1033, 1054, 1021,  360, 1208, 1131,
+ /*   370 */  1083, 1191, 1127, 1135, 1154, 1155, 1235, 1242, 1254, 1272,
+ /*   380 */  1274, 1059, 1165, 1196,   63, 1216, 1237, 1239, 1161, 1087,
+ /*   390 */  1138, 1251, 1261, 1262, 1264, 1266, 1277, 1321, 1281, 1133,
+ /*   400 */  1294, 1271, 1296, 1298, 1301, 1303, 1304, 1308,  932, 1184,
+ /*   410 */  1204, 1340, 1341, 1328, 1360, 1680, 1683, 1690, 1649, 1692,
+ /*   420 */  1659, 1480, 1662, 1663, 1664, 1484, 1714, 1667, 1668, 1488,
+ /*   430 */  1705, 1490, 1707, 1673, 1709, 1688, 1711, 1677, 1505, 1717,
+ /*   440 */  1519, 1719, 1521, 1523, 1528, 1546, 1745, 1746, 1747, 1561,
+ /*   450 */  1564, 1752, 1753, 1715, 1763, 1764, 1765, 1720, 1766, 1726,
+ /*   460 */  1769, 1771, 1772, 1727, 1773, 1775, 1776, 1777, 1778, 1779,
+ /*   470 */  1621, 1748, 1782, 1626, 1784, 1786, 1787, 1788, 1789, 1790,
+ /*   480 */  1792, 1793, 1794, 1795, 1796, 1797, 1799, 1800, 1801, 1802,
+ /*   490 */  1756, 1804, 1767, 1808, 1811, 1813, 1814, 1815, 1816, 1798,
+ /*   500 */  1818, 1821, 1822, 1682, 1823, 1826, 1805, 1780, 1807, 1791,
+ /*   510 */  1830, 1770, 1803, 1834, 1774, 1835, 1781, 1837, 1840, 1806,
+ /*   520 */  1812, 1810, 1842, 1809, 1817, 1824, 1847, 1825, 1831, 1832,
+ /*   530 */  1862, 1829, 1882, 1841, 1845, 1843, 1838, 1839, 1874, 1849,
+ /*   540 */  1889, 1850, 1853, 1897, 1907, 1908, 1870, 1728, 1911, 1912,
+ /*   550 */  1913, 1846, 1914, 1916, 1886, 1873, 1878, 1923, 1890, 1875,
+ /*   560 */  1887, 1927, 1893, 1880, 1891, 1934, 1901, 1892, 1896, 1938,
+ /*   570 */  1939, 1940, 1942, 1945, 1947, 1836, 1848, 1915, 1929, 1949,
+ /*   580 */  1917, 1920, 1922, 1930, 1935, 1936, 1948, 1950, 1952, 1956,
+ /*   590 */  1962, 1976, 1964, 1984, 1978, 2001, 1981, 1953, 2005, 1985,
+ /*   600 */  1973, 2009, 1975, 2012, 1979, 2013, 1994, 1997, 1986, 1988,
+ /*   610 */  1991, 1918, 1924, 2028, 1858, 1937, 1844, 1998, 2010, 2044,
+ /*   620 */  1852, 2025, 1876, 1877, 2049, 2050, 1885, 1894, 1898, 1895,
+ /*   630 */  2016, 2008, 1819, 1966, 1967, 1971, 2027, 1977, 2029, 1980,
+ /*   640 */  1972, 2037, 2040, 1983, 1990, 1993, 1995, 2011, 2045, 2033,
+ /*   650 */  2041, 1996, 2046, 1828, 2014, 2015, 2088, 2058, 1855, 2070,
+ /*   660 */  2077, 2082, 2093, 2095, 2100, 1861, 2042, 2043, 2076, 1899,
+ /*   670 */  2101, 2097, 2148, 2149, 2047, 2112, 1838, 2105, 2052, 2054,
+ /*   680 */  2055, 2057, 2059, 1989, 2060, 2153, 2122, 1992, 2063, 2066,
+ /*   690 */  1838, 2120, 2127, 2080, 1941, 2081, 2181, 2162, 1965, 2084,
+ /*   700 */  2085, 2090, 2099, 2103, 2104, 2138, 2106, 2107, 2144, 2108,
+ /*   710 */  2179, 1982, 2110, 2102, 2111, 2182, 2183, 2116, 2118, 2185,
+ /*   720 */  2121, 2119, 2190, 2123, 2124, 2192, 2126, 2129, 2195, 2128,
+ /*   730 */  2130, 2200, 2133, 2089, 2113, 2114, 2117, 2134, 2197, 2142,
+ /*   740 */  2213, 2147, 2197, 2197, 2229, 2186, 2184, 2219, 2221, 2222,
+ /*   750 */  2223, 2224, 2225, 2230, 2232, 2189, 2171, 2226, 2234, 2236,
+ /*   760 */  2238, 2252, 2240, 2241, 2242, 2203, 1950, 2244, 1952, 2248,
+ /*   770 */  2249, 2256, 2259, 2274, 2263, 2301, 2273, 2261, 2276, 2316,
+ /*   780 */  2278, 2268, 2279, 2319, 2285, 2275, 2283, 2323, 2290, 2277,
+ /*   790 */  2288, 2328, 2297, 2298, 2342, 2321, 2324, 2322, 2325, 2330,
+ /*   800 */  2326,
 };
 #define YY_REDUCE_COUNT (322)
-#define YY_REDUCE_MIN   (-404)
-#define YY_REDUCE_MAX   (2418)
+#define YY_REDUCE_MIN   (-406)
+#define YY_REDUCE_MAX   (2381)
 static const short yy_reduce_ofst[] = {
- /*     0 */  -296, -340, -133,  -26,   88,  310,  540,  850,  881,  911,
- /*    10 */   208, 1001, 1032, 1069, 1158, 1207, 1233,  118, 1284, 1297,
- /*    20 */  1346, 1363, 1436, 1412, 1463, 1483,  426, 1550, 1580, 1639,
- /*    30 */  1712, 1743, 1778, 1815, 1840, 1877, 1902, 1974, 1989, 2007,
- /*    40 */  2054, 2076, 2123, 2182, 2195, 2212, 2244, 2311, 2331, 2401,
- /*    50 */  2418, -260,  -25,  239,  149, -404,  246,  479,  -28,  348,
- /*    60 */   643, -365, -294, -331,  671,  -98,   24,  252, -390, -345,
- /*    70 */  -265, -279,  -72,   74, -318,  227, -342,  112, -232,   26,
- /*    80 */   192,  263,  341,  374,  383,  400,  424,  436,  286,  592,
- /*    90 */   595,  674,  116,  601,  675,   36,  323,  679,  391,  752,
- /*   100 */   637,  -63,  765,  776,  555,  779,  429,  672,  669,  822,
- /*   110 */   155, -316, -313, -313, -259, -140, -199, -188,  157,  269,
- /*   120 */   427,  529,  548,  553,  656,  723,  726,  796,  803,  804,
- /*   130 */   809,  844,  845,  855,  867, -217, -242,  -15,  438,  523,
- /*   140 */   680,  616, -242,  167,  199, -250,  366,  696,  778,  825,
- /*   150 */  -375,  -47,   93,  575,  818,  811,  823,  841,  864, -371,
- /*   160 */  -328,  356,  491,  515,  579,  681,  515,  711,  847,  956,
- /*   170 */   910,  827,  829, 1006,  888, 1008, 1020, 1009,  986, 1009,
- /*   180 */  1046,  997, 1055, 1054, 1018, 1011,  954,  954,  937,  954,
- /*   190 */   965,  959, 1009, 1010,  998, 1021, 1023, 1073, 1025, 1091,
- /*   200 */  1040, 1105, 1075, 1076, 1121, 1081, 1078, 1134, 1135, 1137,
- /*   210 */  1087, 1092, 1093, 1128, 1132, 1147, 1146, 1161, 1163, 1164,
- /*   220 */  1169, 1170, 1175, 1174, 1101, 1165, 1136, 1168, 1178, 1120,
- /*   230 */  1176, 1184, 1179, 1180, 1181, 1191, 1183, 1200, 1166, 1167,
- /*   240 */  1171, 1173, 1187, 1188, 1189, 1190, 1193, 1194, 1196, 1197,
- /*   250 */  1201, 1172, 1185, 1205, 1129, 1133, 1138, 1203, 1141, 1151,
- /*   260 */  1208, 1214, 1199, 1202, 1238, 1204, 1210, 1211, 1139, 1212,
- /*   270 */  1219, 1148, 1213, 1222, 1225, 1009, 1150, 1153, 1215, 1186,
- /*   280 */  1216, 1221, 1217, 1144, 1218, 1226,  954, 1294, 1228, 1298,
- /*   290 */  1292, 1299, 1250, 1249, 1273, 1287, 1289, 1293, 1300, 1255,
- /*   300 */  1301, 1280, 1329, 1314, 1336, 1348, 1246, 1317, 1310, 1333,
- /*   310 */  1357, 1355, 1362, 1365, 1307, 1313, 1303, 1308, 1367, 1368,
- /*   320 */  1371, 1370, 1388,
+ /*     0 */  -298, -342, -135,  -28,  878,  898, 1006, 1035, 1070, 1157,
+ /*    10 */   209,  542,  851,   98, 1189, 1218, 1293,  346, 1320, 1417,
+ /*    20 */   452, 1438, 1464, 1525, 1538, 1551, 1600, 1625, 1672, 1702,
+ /*    30 */  1739, 1761, 1851, 1868, 1900, 1919, 1968, 1987, 2019, 2036,
+ /*    40 */  2087, 2098, 2109, 2177, 2198, 2245, 2264, 2313, 2332, 2364,
+ /*    50 */  2381, -262,    2,  238,  167, -406,  462,  479,  253,  473,
+ /*    60 */   732, -367, -296, -333,  266,  147,  395,  116, -392, -347,
+ /*    70 */  -267, -281, -215,  -74, -320,  -40, -344,  -38, -234, -219,
+ /*    80 */    43,   86,   83,  157,  351,  426,  455,  202,   69,  470,
+ /*    90 */   510,  276,  161,  597,  603,  107,  212,  613,  336,  758,
+ /*   100 */   412,  339,  760,  774,  233,  824,  413,  365,  459,  827,
+ /*   110 */   500, -318, -247, -247, -261,   14, -201, -174,  -95,  216,
+ /*   120 */   422,  448,  458,  463,  551,  589,  707,  708,  756,  781,
+ /*   130 */   807,  825,  829,  843,  859, -304, -107, -332,  -87,  435,
+ /*   140 */   496,  593, -107,  505,  539, -170,  -31,  249,  659,  537,
+ /*   150 */   370,  -25,  547,  246,  733,  312,  325,  682,  837, -382,
+ /*   160 */  -373, -330,  464,  658,  695,  902,  658,  400,  928,  517,
+ /*   170 */   662,  841,  835, 1001,  888,  993,  998,  907,  907,  907,
+ /*   180 */   983,  960,  983, 1017,  976, 1029, 1030,  990,  981,  909,
+ /*   190 */   907,  937,  922,  983,  979,  965,  986,  978, 1050,  991,
+ /*   200 */  1056, 1003, 1067, 1022, 1024, 1078, 1032, 1036, 1084, 1085,
+ /*   210 */  1094, 1039, 1051, 1052, 1088, 1092, 1105, 1098, 1110, 1115,
+ /*   220 */  1116, 1132, 1130, 1137, 1136, 1057, 1123, 1096, 1129, 1139,
+ /*   230 */  1079, 1134, 1142, 1141, 1152, 1156, 1145, 1158, 1153, 1122,
+ /*   240 */  1140, 1144, 1146, 1147, 1148, 1149, 1150, 1159, 1160, 1162,
+ /*   250 */  1174, 1175, 1143, 1151, 1164, 1112, 1120, 1124, 1187, 1167,
+ /*   260 */  1166, 1170, 1192, 1177, 1169, 1202, 1171, 1172, 1173, 1089,
+ /*   270 */  1182, 1176, 1090, 1193, 1179, 1180,  983, 1091, 1097, 1109,
+ /*   280 */  1099, 1113, 1119, 1186, 1126, 1125, 1181, 1259, 1183, 1263,
+ /*   290 */  1270, 1273, 1215, 1214, 1238, 1240, 1241, 1245, 1246, 1227,
+ /*   300 */  1247, 1243, 1291, 1268, 1292, 1290, 1209, 1279, 1275, 1305,
+ /*   310 */  1313, 1310, 1326, 1330, 1265, 1253, 1269, 1276, 1306, 1309,
+ /*   320 */  1312, 1329, 1338,
 };
 static const YYACTIONTYPE yy_default[] = {
- /*     0 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*    10 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*    20 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*    30 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*    40 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*    50 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*    60 */  2091, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*    70 */  1780, 1780, 1780, 1780, 2064, 1780, 1780, 1780, 1780, 1780,
- /*    80 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*    90 */  1780, 1869, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   100 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   110 */  1867, 2057, 2283, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   120 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   130 */  1780, 1780, 1780, 1780, 1780, 1780, 2295, 1780, 1780, 1843,
- /*   140 */  1843, 1780, 2295, 2295, 2295, 1867, 2255, 2255, 1780, 1869,
- /*   150 */  2125, 1780, 1780, 1780, 1780, 1780, 1780, 1989, 1780, 1780,
- /*   160 */  1780, 1780, 1780, 2013, 1780, 1780, 1780, 2117, 1780, 1780,
- /*   170 */  2320, 2377, 1780, 1780, 2323, 1780, 1780, 1780, 1780, 1780,
- /*   180 */  1780, 2069, 1780, 1780, 1942, 2310, 2287, 2301, 2361, 2288,
- /*   190 */  2285, 2304, 1780, 2314, 1780, 1780, 2139, 1869, 1780, 1869,
- /*   200 */  2104, 1780, 2062, 1780, 1780, 2062, 2059, 1780, 1780, 1780,
- /*   210 */  2062, 2059, 2059, 1931, 1927, 1780, 1925, 1780, 1780, 1780,
- /*   220 */  1780, 1827, 1780, 1827, 1780, 1869, 1780, 1869, 1780, 1780,
- /*   230 */  1869, 1780, 1869, 1869, 1869, 1780, 1869, 1780, 1780, 1780,
- /*   240 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   250 */  1780, 1780, 1780, 1780, 2137, 2123, 1780, 1867, 2115, 2113,
- /*   260 */  1780, 1867, 2111, 2314, 1780, 1780, 1780, 1780, 2331, 2329,
- /*   270 */  1780, 2331, 2329, 1780, 1780, 1780, 2345, 2341, 2331, 2350,
- /*   280 */  2347, 2316, 2314, 2380, 2367, 2363, 2301, 1780, 1780, 1780,
- /*   290 */  1867, 1867, 1780, 2329, 1780, 1780, 1780, 1780, 1780, 2329,
- /*   300 */  1780, 1780, 1867, 1780, 1867, 1780, 1780, 1958, 1780, 1780,
- /*   310 */  1780, 1867, 1812, 1780, 2106, 2128, 2087, 2087, 1992, 1992,
- /*   320 */  1992, 1870, 1785, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   330 */  1780, 1780, 1780, 1780, 1780, 2344, 2343, 2210, 1780, 2259,
- /*   340 */  2258, 2257, 2248, 2209, 1954, 1780, 2208, 2207, 1780, 1780,
- /*   350 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 2078, 2077, 2201,
- /*   360 */  1780, 1780, 2202, 2200, 2199, 1780, 1780, 1780, 1780, 1780,
- /*   370 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   380 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 2364,
- /*   390 */  2368, 1780, 1780, 1780, 1780, 1780, 1780, 2284, 1780, 1780,
- /*   400 */  1780, 2183, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   410 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   420 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   430 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   440 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   450 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   460 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   470 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   480 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   490 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   500 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   510 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   520 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   530 */  1780, 1780, 1780, 1780, 1780, 1817, 2188, 1780, 1780, 1780,
- /*   540 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   550 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   560 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   570 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   580 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1908, 1907, 1780,
- /*   590 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   600 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   610 */  1780, 2192, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   620 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   630 */  2360, 2317, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   640 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   650 */  2183, 1780, 2342, 1780, 1780, 2358, 1780, 2362, 1780, 1780,
- /*   660 */  1780, 1780, 1780, 1780, 1780, 2294, 2290, 1780, 1780, 2286,
- /*   670 */  1780, 1780, 1780, 1780, 1780, 2191, 1780, 1780, 1780, 1780,
- /*   680 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 2182,
- /*   690 */  1780, 2245, 1780, 1780, 1780, 2279, 1780, 1780, 2230, 1780,
- /*   700 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 2192, 1780,
- /*   710 */  2195, 1780, 1780, 1780, 1780, 1780, 1986, 1780, 1780, 1780,
- /*   720 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   730 */  1780, 1780, 1970, 1968, 1967, 1966, 1780, 1999, 1780, 1780,
- /*   740 */  1780, 1995, 1994, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   750 */  1780, 1780, 1780, 1780, 1780, 1780, 1888, 1780, 1780, 1780,
- /*   760 */  1780, 1780, 1780, 1780, 1780, 1880, 1780, 1879, 1780, 1780,
- /*   770 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   780 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
- /*   790 */  1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
+ /*     0 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*    10 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*    20 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*    30 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*    40 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*    50 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*    60 */  2095, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*    70 */  1784, 1784, 1784, 1784, 2068, 1784, 1784, 1784, 1784, 1784,
+ /*    80 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*    90 */  1784, 1873, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   100 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   110 */  1871, 2061, 2287, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   120 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   130 */  1784, 1784, 1784, 1784, 1784, 1784, 2299, 1784, 1784, 1847,
+ /*   140 */  1847, 1784, 2299, 2299, 2299, 1871, 2259, 2259, 1784, 1873,
+ /*   150 */  2129, 1784, 1784, 1784, 1784, 1784, 1784, 1993, 1784, 1784,
+ /*   160 */  1784, 1784, 1784, 2017, 1784, 1784, 1784, 2121, 1784, 1784,
+ /*   170 */  2326, 2383, 1784, 1784, 2329, 1784, 1784, 2291, 2305, 2292,
+ /*   180 */  1784, 1784, 1784, 1784, 2073, 1784, 1784, 1946, 2316, 2367,
+ /*   190 */  2305, 2289, 2310, 1784, 2320, 1784, 1784, 2143, 1873, 1784,
+ /*   200 */  1873, 2108, 1784, 2066, 1784, 1784, 2066, 2063, 1784, 1784,
+ /*   210 */  1784, 2066, 2063, 2063, 1935, 1931, 1784, 1929, 1784, 1784,
+ /*   220 */  1784, 1784, 1831, 1784, 1831, 1784, 1873, 1784, 1873, 1784,
+ /*   230 */  1784, 1873, 1784, 1873, 1873, 1873, 1784, 1873, 1784, 1784,
+ /*   240 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   250 */  1784, 1784, 1784, 1784, 1784, 2141, 2127, 1784, 1871, 2119,
+ /*   260 */  2117, 1784, 1871, 2115, 2320, 1784, 1784, 1784, 1784, 2337,
+ /*   270 */  2335, 1784, 2337, 2335, 1784, 1784, 1784, 2351, 2347, 2337,
+ /*   280 */  2356, 2353, 2322, 2320, 2386, 2373, 2369, 1784, 1784, 1784,
+ /*   290 */  1871, 1871, 1784, 2335, 1784, 1784, 1784, 1784, 1784, 2335,
+ /*   300 */  1784, 1784, 1871, 1784, 1871, 1784, 1784, 1962, 1784, 1784,
+ /*   310 */  1784, 1871, 1816, 1784, 2110, 2132, 2091, 2091, 1996, 1996,
+ /*   320 */  1996, 1874, 1789, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   330 */  1784, 1784, 1784, 1784, 1784, 2350, 2349, 2214, 1784, 2263,
+ /*   340 */  2262, 2261, 2252, 2213, 1958, 1784, 2212, 2211, 1784, 1784,
+ /*   350 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 2082, 2081, 2205,
+ /*   360 */  1784, 1784, 2206, 2204, 2203, 1784, 1784, 1784, 1784, 1784,
+ /*   370 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   380 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 2370,
+ /*   390 */  2374, 1784, 1784, 1784, 1784, 1784, 1784, 2288, 1784, 1784,
+ /*   400 */  1784, 2187, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   410 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   420 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   430 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   440 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   450 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   460 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   470 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   480 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   490 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   500 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   510 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   520 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   530 */  1784, 1784, 1784, 1784, 1784, 1821, 2192, 1784, 1784, 1784,
+ /*   540 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   550 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   560 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   570 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   580 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1912, 1911, 1784,
+ /*   590 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   600 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   610 */  1784, 2196, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   620 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   630 */  2366, 2323, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   640 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   650 */  2187, 1784, 2348, 1784, 1784, 2364, 1784, 2368, 1784, 1784,
+ /*   660 */  1784, 1784, 1784, 1784, 1784, 2307, 2298, 2294, 1784, 1784,
+ /*   670 */  2290, 1784, 1784, 1784, 1784, 1784, 2195, 1784, 1784, 1784,
+ /*   680 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   690 */  2186, 1784, 2249, 1784, 1784, 1784, 2283, 1784, 1784, 2234,
+ /*   700 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 2196,
+ /*   710 */  1784, 2199, 1784, 1784, 1784, 1784, 1784, 1990, 1784, 1784,
+ /*   720 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   730 */  1784, 1784, 1784, 1974, 1972, 1971, 1970, 1784, 2003, 1784,
+ /*   740 */  1784, 1784, 1999, 1998, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   750 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1892, 1784, 1784,
+ /*   760 */  1784, 1784, 1784, 1784, 1784, 1784, 1884, 1784, 1883, 1784,
+ /*   770 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   780 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   790 */  1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+ /*   800 */  1784,
 };
 /********** End of lemon-generated parsing tables *****************************/
 
@@ -1153,7 +1149,7 @@ static const YYCODETYPE yyFallback[] = {
     0,  /*  MAX_SPEED => nothing */
     0,  /*      START => nothing */
     0,  /*  TIMESTAMP => nothing */
-  287,  /*        END => ABORT */
+  289,  /*        END => ABORT */
     0,  /*      TABLE => nothing */
     0,  /*      NK_LP => nothing */
     0,  /*      NK_RP => nothing */
@@ -1312,6 +1308,8 @@ static const YYCODETYPE yyFallback[] = {
     0,  /*         IN => nothing */
     0,  /*       JOIN => nothing */
     0,  /*      INNER => nothing */
+    0,  /*       LEFT => nothing */
+    0,  /*      OUTER => nothing */
     0,  /*     SELECT => nothing */
     0,  /*   DISTINCT => nothing */
     0,  /*      WHERE => nothing */
@@ -1340,56 +1338,56 @@ static const YYCODETYPE yyFallback[] = {
     0,  /*        ASC => nothing */
     0,  /*      NULLS => nothing */
     0,  /*      ABORT => nothing */
-  287,  /*      AFTER => ABORT */
-  287,  /*     ATTACH => ABORT */
-  287,  /*     BEFORE => ABORT */
-  287,  /*      BEGIN => ABORT */
-  287,  /*     BITAND => ABORT */
-  287,  /*     BITNOT => ABORT */
-  287,  /*      BITOR => ABORT */
-  287,  /*     BLOCKS => ABORT */
-  287,  /*     CHANGE => ABORT */
-  287,  /*      COMMA => ABORT */
-  287,  /*     CONCAT => ABORT */
-  287,  /*   CONFLICT => ABORT */
-  287,  /*       COPY => ABORT */
-  287,  /*   DEFERRED => ABORT */
-  287,  /* DELIMITERS => ABORT */
-  287,  /*     DETACH => ABORT */
-  287,  /*     DIVIDE => ABORT */
-  287,  /*        DOT => ABORT */
-  287,  /*       EACH => ABORT */
-  287,  /*       FAIL => ABORT */
-  287,  /*       FILE => ABORT */
-  287,  /*        FOR => ABORT */
-  287,  /*       GLOB => ABORT */
-  287,  /*         ID => ABORT */
-  287,  /*  IMMEDIATE => ABORT */
-  287,  /*     IMPORT => ABORT */
-  287,  /*  INITIALLY => ABORT */
-  287,  /*    INSTEAD => ABORT */
-  287,  /*     ISNULL => ABORT */
-  287,  /*        KEY => ABORT */
-  287,  /*    MODULES => ABORT */
-  287,  /*  NK_BITNOT => ABORT */
-  287,  /*    NK_SEMI => ABORT */
-  287,  /*    NOTNULL => ABORT */
-  287,  /*         OF => ABORT */
-  287,  /*       PLUS => ABORT */
-  287,  /*  PRIVILEGE => ABORT */
-  287,  /*      RAISE => ABORT */
-  287,  /*   RESTRICT => ABORT */
-  287,  /*        ROW => ABORT */
-  287,  /*       SEMI => ABORT */
-  287,  /*       STAR => ABORT */
-  287,  /*  STATEMENT => ABORT */
-  287,  /*     STRICT => ABORT */
-  287,  /*     STRING => ABORT */
-  287,  /*      TIMES => ABORT */
-  287,  /*     VALUES => ABORT */
-  287,  /*   VARIABLE => ABORT */
-  287,  /*       VIEW => ABORT */
-  287,  /*        WAL => ABORT */
+  289,  /*      AFTER => ABORT */
+  289,  /*     ATTACH => ABORT */
+  289,  /*     BEFORE => ABORT */
+  289,  /*      BEGIN => ABORT */
+  289,  /*     BITAND => ABORT */
+  289,  /*     BITNOT => ABORT */
+  289,  /*      BITOR => ABORT */
+  289,  /*     BLOCKS => ABORT */
+  289,  /*     CHANGE => ABORT */
+  289,  /*      COMMA => ABORT */
+  289,  /*     CONCAT => ABORT */
+  289,  /*   CONFLICT => ABORT */
+  289,  /*       COPY => ABORT */
+  289,  /*   DEFERRED => ABORT */
+  289,  /* DELIMITERS => ABORT */
+  289,  /*     DETACH => ABORT */
+  289,  /*     DIVIDE => ABORT */
+  289,  /*        DOT => ABORT */
+  289,  /*       EACH => ABORT */
+  289,  /*       FAIL => ABORT */
+  289,  /*       FILE => ABORT */
+  289,  /*        FOR => ABORT */
+  289,  /*       GLOB => ABORT */
+  289,  /*         ID => ABORT */
+  289,  /*  IMMEDIATE => ABORT */
+  289,  /*     IMPORT => ABORT */
+  289,  /*  INITIALLY => ABORT */
+  289,  /*    INSTEAD => ABORT */
+  289,  /*     ISNULL => ABORT */
+  289,  /*        KEY => ABORT */
+  289,  /*    MODULES => ABORT */
+  289,  /*  NK_BITNOT => ABORT */
+  289,  /*    NK_SEMI => ABORT */
+  289,  /*    NOTNULL => ABORT */
+  289,  /*         OF => ABORT */
+  289,  /*       PLUS => ABORT */
+  289,  /*  PRIVILEGE => ABORT */
+  289,  /*      RAISE => ABORT */
+  289,  /*   RESTRICT => ABORT */
+  289,  /*        ROW => ABORT */
+  289,  /*       SEMI => ABORT */
+  289,  /*       STAR => ABORT */
+  289,  /*  STATEMENT => ABORT */
+  289,  /*     STRICT => ABORT */
+  289,  /*     STRING => ABORT */
+  289,  /*      TIMES => ABORT */
+  289,  /*     VALUES => ABORT */
+  289,  /*   VARIABLE => ABORT */
+  289,  /*       VIEW => ABORT */
+  289,  /*        WAL => ABORT */
 };
 #endif /* YYFALLBACK */
 
@@ -1737,233 +1735,235 @@ static const char *const yyTokenName[] = {
   /*  257 */ "IN",
   /*  258 */ "JOIN",
   /*  259 */ "INNER",
-  /*  260 */ "SELECT",
-  /*  261 */ "DISTINCT",
-  /*  262 */ "WHERE",
-  /*  263 */ "PARTITION",
-  /*  264 */ "BY",
-  /*  265 */ "SESSION",
-  /*  266 */ "STATE_WINDOW",
-  /*  267 */ "EVENT_WINDOW",
-  /*  268 */ "SLIDING",
-  /*  269 */ "FILL",
-  /*  270 */ "VALUE",
-  /*  271 */ "VALUE_F",
-  /*  272 */ "NONE",
-  /*  273 */ "PREV",
-  /*  274 */ "NULL_F",
-  /*  275 */ "LINEAR",
-  /*  276 */ "NEXT",
-  /*  277 */ "HAVING",
-  /*  278 */ "RANGE",
-  /*  279 */ "EVERY",
-  /*  280 */ "ORDER",
-  /*  281 */ "SLIMIT",
-  /*  282 */ "SOFFSET",
-  /*  283 */ "LIMIT",
-  /*  284 */ "OFFSET",
-  /*  285 */ "ASC",
-  /*  286 */ "NULLS",
-  /*  287 */ "ABORT",
-  /*  288 */ "AFTER",
-  /*  289 */ "ATTACH",
-  /*  290 */ "BEFORE",
-  /*  291 */ "BEGIN",
-  /*  292 */ "BITAND",
-  /*  293 */ "BITNOT",
-  /*  294 */ "BITOR",
-  /*  295 */ "BLOCKS",
-  /*  296 */ "CHANGE",
-  /*  297 */ "COMMA",
-  /*  298 */ "CONCAT",
-  /*  299 */ "CONFLICT",
-  /*  300 */ "COPY",
-  /*  301 */ "DEFERRED",
-  /*  302 */ "DELIMITERS",
-  /*  303 */ "DETACH",
-  /*  304 */ "DIVIDE",
-  /*  305 */ "DOT",
-  /*  306 */ "EACH",
-  /*  307 */ "FAIL",
-  /*  308 */ "FILE",
-  /*  309 */ "FOR",
-  /*  310 */ "GLOB",
-  /*  311 */ "ID",
-  /*  312 */ "IMMEDIATE",
-  /*  313 */ "IMPORT",
-  /*  314 */ "INITIALLY",
-  /*  315 */ "INSTEAD",
-  /*  316 */ "ISNULL",
-  /*  317 */ "KEY",
-  /*  318 */ "MODULES",
-  /*  319 */ "NK_BITNOT",
-  /*  320 */ "NK_SEMI",
-  /*  321 */ "NOTNULL",
-  /*  322 */ "OF",
-  /*  323 */ "PLUS",
-  /*  324 */ "PRIVILEGE",
-  /*  325 */ "RAISE",
-  /*  326 */ "RESTRICT",
-  /*  327 */ "ROW",
-  /*  328 */ "SEMI",
-  /*  329 */ "STAR",
-  /*  330 */ "STATEMENT",
-  /*  331 */ "STRICT",
-  /*  332 */ "STRING",
-  /*  333 */ "TIMES",
-  /*  334 */ "VALUES",
-  /*  335 */ "VARIABLE",
-  /*  336 */ "VIEW",
-  /*  337 */ "WAL",
-  /*  338 */ "cmd",
-  /*  339 */ "account_options",
-  /*  340 */ "alter_account_options",
-  /*  341 */ "literal",
-  /*  342 */ "alter_account_option",
-  /*  343 */ "user_name",
-  /*  344 */ "sysinfo_opt",
-  /*  345 */ "privileges",
-  /*  346 */ "priv_level",
-  /*  347 */ "with_opt",
-  /*  348 */ "priv_type_list",
-  /*  349 */ "priv_type",
-  /*  350 */ "db_name",
-  /*  351 */ "table_name",
-  /*  352 */ "topic_name",
-  /*  353 */ "search_condition",
-  /*  354 */ "dnode_endpoint",
-  /*  355 */ "force_opt",
-  /*  356 */ "unsafe_opt",
-  /*  357 */ "not_exists_opt",
-  /*  358 */ "db_options",
-  /*  359 */ "exists_opt",
-  /*  360 */ "alter_db_options",
-  /*  361 */ "speed_opt",
-  /*  362 */ "start_opt",
-  /*  363 */ "end_opt",
-  /*  364 */ "integer_list",
-  /*  365 */ "variable_list",
-  /*  366 */ "retention_list",
-  /*  367 */ "signed",
-  /*  368 */ "alter_db_option",
-  /*  369 */ "retention",
-  /*  370 */ "full_table_name",
-  /*  371 */ "column_def_list",
-  /*  372 */ "tags_def_opt",
-  /*  373 */ "table_options",
-  /*  374 */ "multi_create_clause",
-  /*  375 */ "tags_def",
-  /*  376 */ "multi_drop_clause",
-  /*  377 */ "alter_table_clause",
-  /*  378 */ "alter_table_options",
-  /*  379 */ "column_name",
-  /*  380 */ "type_name",
-  /*  381 */ "signed_literal",
-  /*  382 */ "create_subtable_clause",
-  /*  383 */ "specific_cols_opt",
-  /*  384 */ "expression_list",
-  /*  385 */ "drop_table_clause",
-  /*  386 */ "col_name_list",
-  /*  387 */ "column_def",
-  /*  388 */ "duration_list",
-  /*  389 */ "rollup_func_list",
-  /*  390 */ "alter_table_option",
-  /*  391 */ "duration_literal",
-  /*  392 */ "rollup_func_name",
-  /*  393 */ "function_name",
-  /*  394 */ "col_name",
-  /*  395 */ "db_name_cond_opt",
-  /*  396 */ "like_pattern_opt",
-  /*  397 */ "table_name_cond",
-  /*  398 */ "from_db_opt",
-  /*  399 */ "tag_list_opt",
-  /*  400 */ "tag_item",
-  /*  401 */ "column_alias",
-  /*  402 */ "full_index_name",
-  /*  403 */ "index_options",
-  /*  404 */ "index_name",
-  /*  405 */ "func_list",
-  /*  406 */ "sliding_opt",
-  /*  407 */ "sma_stream_opt",
-  /*  408 */ "func",
-  /*  409 */ "sma_func_name",
-  /*  410 */ "with_meta",
-  /*  411 */ "query_or_subquery",
-  /*  412 */ "where_clause_opt",
-  /*  413 */ "cgroup_name",
-  /*  414 */ "analyze_opt",
-  /*  415 */ "explain_options",
-  /*  416 */ "insert_query",
-  /*  417 */ "or_replace_opt",
-  /*  418 */ "agg_func_opt",
-  /*  419 */ "bufsize_opt",
-  /*  420 */ "language_opt",
-  /*  421 */ "stream_name",
-  /*  422 */ "stream_options",
-  /*  423 */ "col_list_opt",
-  /*  424 */ "tag_def_or_ref_opt",
-  /*  425 */ "subtable_opt",
-  /*  426 */ "ignore_opt",
-  /*  427 */ "expression",
-  /*  428 */ "dnode_list",
-  /*  429 */ "literal_func",
-  /*  430 */ "literal_list",
-  /*  431 */ "table_alias",
-  /*  432 */ "expr_or_subquery",
-  /*  433 */ "pseudo_column",
-  /*  434 */ "column_reference",
-  /*  435 */ "function_expression",
-  /*  436 */ "case_when_expression",
-  /*  437 */ "star_func",
-  /*  438 */ "star_func_para_list",
-  /*  439 */ "noarg_func",
-  /*  440 */ "other_para_list",
-  /*  441 */ "star_func_para",
-  /*  442 */ "when_then_list",
-  /*  443 */ "case_when_else_opt",
-  /*  444 */ "common_expression",
-  /*  445 */ "when_then_expr",
-  /*  446 */ "predicate",
-  /*  447 */ "compare_op",
-  /*  448 */ "in_op",
-  /*  449 */ "in_predicate_value",
-  /*  450 */ "boolean_value_expression",
-  /*  451 */ "boolean_primary",
-  /*  452 */ "from_clause_opt",
-  /*  453 */ "table_reference_list",
-  /*  454 */ "table_reference",
-  /*  455 */ "table_primary",
-  /*  456 */ "joined_table",
-  /*  457 */ "alias_opt",
-  /*  458 */ "subquery",
-  /*  459 */ "parenthesized_joined_table",
-  /*  460 */ "join_type",
-  /*  461 */ "query_specification",
-  /*  462 */ "set_quantifier_opt",
-  /*  463 */ "select_list",
-  /*  464 */ "partition_by_clause_opt",
-  /*  465 */ "range_opt",
-  /*  466 */ "every_opt",
-  /*  467 */ "fill_opt",
-  /*  468 */ "twindow_clause_opt",
-  /*  469 */ "group_by_clause_opt",
-  /*  470 */ "having_clause_opt",
-  /*  471 */ "select_item",
-  /*  472 */ "partition_list",
-  /*  473 */ "partition_item",
-  /*  474 */ "fill_mode",
-  /*  475 */ "group_by_list",
-  /*  476 */ "query_expression",
-  /*  477 */ "query_simple",
-  /*  478 */ "order_by_clause_opt",
-  /*  479 */ "slimit_clause_opt",
-  /*  480 */ "limit_clause_opt",
-  /*  481 */ "union_query_expression",
-  /*  482 */ "query_simple_or_subquery",
-  /*  483 */ "sort_specification_list",
-  /*  484 */ "sort_specification",
-  /*  485 */ "ordering_specification_opt",
-  /*  486 */ "null_ordering_opt",
+  /*  260 */ "LEFT",
+  /*  261 */ "OUTER",
+  /*  262 */ "SELECT",
+  /*  263 */ "DISTINCT",
+  /*  264 */ "WHERE",
+  /*  265 */ "PARTITION",
+  /*  266 */ "BY",
+  /*  267 */ "SESSION",
+  /*  268 */ "STATE_WINDOW",
+  /*  269 */ "EVENT_WINDOW",
+  /*  270 */ "SLIDING",
+  /*  271 */ "FILL",
+  /*  272 */ "VALUE",
+  /*  273 */ "VALUE_F",
+  /*  274 */ "NONE",
+  /*  275 */ "PREV",
+  /*  276 */ "NULL_F",
+  /*  277 */ "LINEAR",
+  /*  278 */ "NEXT",
+  /*  279 */ "HAVING",
+  /*  280 */ "RANGE",
+  /*  281 */ "EVERY",
+  /*  282 */ "ORDER",
+  /*  283 */ "SLIMIT",
+  /*  284 */ "SOFFSET",
+  /*  285 */ "LIMIT",
+  /*  286 */ "OFFSET",
+  /*  287 */ "ASC",
+  /*  288 */ "NULLS",
+  /*  289 */ "ABORT",
+  /*  290 */ "AFTER",
+  /*  291 */ "ATTACH",
+  /*  292 */ "BEFORE",
+  /*  293 */ "BEGIN",
+  /*  294 */ "BITAND",
+  /*  295 */ "BITNOT",
+  /*  296 */ "BITOR",
+  /*  297 */ "BLOCKS",
+  /*  298 */ "CHANGE",
+  /*  299 */ "COMMA",
+  /*  300 */ "CONCAT",
+  /*  301 */ "CONFLICT",
+  /*  302 */ "COPY",
+  /*  303 */ "DEFERRED",
+  /*  304 */ "DELIMITERS",
+  /*  305 */ "DETACH",
+  /*  306 */ "DIVIDE",
+  /*  307 */ "DOT",
+  /*  308 */ "EACH",
+  /*  309 */ "FAIL",
+  /*  310 */ "FILE",
+  /*  311 */ "FOR",
+  /*  312 */ "GLOB",
+  /*  313 */ "ID",
+  /*  314 */ "IMMEDIATE",
+  /*  315 */ "IMPORT",
+  /*  316 */ "INITIALLY",
+  /*  317 */ "INSTEAD",
+  /*  318 */ "ISNULL",
+  /*  319 */ "KEY",
+  /*  320 */ "MODULES",
+  /*  321 */ "NK_BITNOT",
+  /*  322 */ "NK_SEMI",
+  /*  323 */ "NOTNULL",
+  /*  324 */ "OF",
+  /*  325 */ "PLUS",
+  /*  326 */ "PRIVILEGE",
+  /*  327 */ "RAISE",
+  /*  328 */ "RESTRICT",
+  /*  329 */ "ROW",
+  /*  330 */ "SEMI",
+  /*  331 */ "STAR",
+  /*  332 */ "STATEMENT",
+  /*  333 */ "STRICT",
+  /*  334 */ "STRING",
+  /*  335 */ "TIMES",
+  /*  336 */ "VALUES",
+  /*  337 */ "VARIABLE",
+  /*  338 */ "VIEW",
+  /*  339 */ "WAL",
+  /*  340 */ "cmd",
+  /*  341 */ "account_options",
+  /*  342 */ "alter_account_options",
+  /*  343 */ "literal",
+  /*  344 */ "alter_account_option",
+  /*  345 */ "user_name",
+  /*  346 */ "sysinfo_opt",
+  /*  347 */ "privileges",
+  /*  348 */ "priv_level",
+  /*  349 */ "with_opt",
+  /*  350 */ "priv_type_list",
+  /*  351 */ "priv_type",
+  /*  352 */ "db_name",
+  /*  353 */ "table_name",
+  /*  354 */ "topic_name",
+  /*  355 */ "search_condition",
+  /*  356 */ "dnode_endpoint",
+  /*  357 */ "force_opt",
+  /*  358 */ "unsafe_opt",
+  /*  359 */ "not_exists_opt",
+  /*  360 */ "db_options",
+  /*  361 */ "exists_opt",
+  /*  362 */ "alter_db_options",
+  /*  363 */ "speed_opt",
+  /*  364 */ "start_opt",
+  /*  365 */ "end_opt",
+  /*  366 */ "integer_list",
+  /*  367 */ "variable_list",
+  /*  368 */ "retention_list",
+  /*  369 */ "signed",
+  /*  370 */ "alter_db_option",
+  /*  371 */ "retention",
+  /*  372 */ "full_table_name",
+  /*  373 */ "column_def_list",
+  /*  374 */ "tags_def_opt",
+  /*  375 */ "table_options",
+  /*  376 */ "multi_create_clause",
+  /*  377 */ "tags_def",
+  /*  378 */ "multi_drop_clause",
+  /*  379 */ "alter_table_clause",
+  /*  380 */ "alter_table_options",
+  /*  381 */ "column_name",
+  /*  382 */ "type_name",
+  /*  383 */ "signed_literal",
+  /*  384 */ "create_subtable_clause",
+  /*  385 */ "specific_cols_opt",
+  /*  386 */ "expression_list",
+  /*  387 */ "drop_table_clause",
+  /*  388 */ "col_name_list",
+  /*  389 */ "column_def",
+  /*  390 */ "duration_list",
+  /*  391 */ "rollup_func_list",
+  /*  392 */ "alter_table_option",
+  /*  393 */ "duration_literal",
+  /*  394 */ "rollup_func_name",
+  /*  395 */ "function_name",
+  /*  396 */ "col_name",
+  /*  397 */ "db_name_cond_opt",
+  /*  398 */ "like_pattern_opt",
+  /*  399 */ "table_name_cond",
+  /*  400 */ "from_db_opt",
+  /*  401 */ "tag_list_opt",
+  /*  402 */ "tag_item",
+  /*  403 */ "column_alias",
+  /*  404 */ "full_index_name",
+  /*  405 */ "index_options",
+  /*  406 */ "index_name",
+  /*  407 */ "func_list",
+  /*  408 */ "sliding_opt",
+  /*  409 */ "sma_stream_opt",
+  /*  410 */ "func",
+  /*  411 */ "sma_func_name",
+  /*  412 */ "with_meta",
+  /*  413 */ "query_or_subquery",
+  /*  414 */ "where_clause_opt",
+  /*  415 */ "cgroup_name",
+  /*  416 */ "analyze_opt",
+  /*  417 */ "explain_options",
+  /*  418 */ "insert_query",
+  /*  419 */ "or_replace_opt",
+  /*  420 */ "agg_func_opt",
+  /*  421 */ "bufsize_opt",
+  /*  422 */ "language_opt",
+  /*  423 */ "stream_name",
+  /*  424 */ "stream_options",
+  /*  425 */ "col_list_opt",
+  /*  426 */ "tag_def_or_ref_opt",
+  /*  427 */ "subtable_opt",
+  /*  428 */ "ignore_opt",
+  /*  429 */ "expression",
+  /*  430 */ "dnode_list",
+  /*  431 */ "literal_func",
+  /*  432 */ "literal_list",
+  /*  433 */ "table_alias",
+  /*  434 */ "expr_or_subquery",
+  /*  435 */ "pseudo_column",
+  /*  436 */ "column_reference",
+  /*  437 */ "function_expression",
+  /*  438 */ "case_when_expression",
+  /*  439 */ "star_func",
+  /*  440 */ "star_func_para_list",
+  /*  441 */ "noarg_func",
+  /*  442 */ "other_para_list",
+  /*  443 */ "star_func_para",
+  /*  444 */ "when_then_list",
+  /*  445 */ "case_when_else_opt",
+  /*  446 */ "common_expression",
+  /*  447 */ "when_then_expr",
+  /*  448 */ "predicate",
+  /*  449 */ "compare_op",
+  /*  450 */ "in_op",
+  /*  451 */ "in_predicate_value",
+  /*  452 */ "boolean_value_expression",
+  /*  453 */ "boolean_primary",
+  /*  454 */ "from_clause_opt",
+  /*  455 */ "table_reference_list",
+  /*  456 */ "table_reference",
+  /*  457 */ "table_primary",
+  /*  458 */ "joined_table",
+  /*  459 */ "alias_opt",
+  /*  460 */ "subquery",
+  /*  461 */ "parenthesized_joined_table",
+  /*  462 */ "join_type",
+  /*  463 */ "query_specification",
+  /*  464 */ "set_quantifier_opt",
+  /*  465 */ "select_list",
+  /*  466 */ "partition_by_clause_opt",
+  /*  467 */ "range_opt",
+  /*  468 */ "every_opt",
+  /*  469 */ "fill_opt",
+  /*  470 */ "twindow_clause_opt",
+  /*  471 */ "group_by_clause_opt",
+  /*  472 */ "having_clause_opt",
+  /*  473 */ "select_item",
+  /*  474 */ "partition_list",
+  /*  475 */ "partition_item",
+  /*  476 */ "fill_mode",
+  /*  477 */ "group_by_list",
+  /*  478 */ "query_expression",
+  /*  479 */ "query_simple",
+  /*  480 */ "order_by_clause_opt",
+  /*  481 */ "slimit_clause_opt",
+  /*  482 */ "limit_clause_opt",
+  /*  483 */ "union_query_expression",
+  /*  484 */ "query_simple_or_subquery",
+  /*  485 */ "sort_specification_list",
+  /*  486 */ "sort_specification",
+  /*  487 */ "ordering_specification_opt",
+  /*  488 */ "null_ordering_opt",
 };
 #endif /* defined(YYCOVERAGE) || !defined(NDEBUG) */
 
@@ -2491,86 +2491,88 @@ static const char *const yyRuleName[] = {
  /* 517 */ "joined_table ::= table_reference join_type JOIN table_reference ON search_condition",
  /* 518 */ "join_type ::=",
  /* 519 */ "join_type ::= INNER",
- /* 520 */ "query_specification ::= SELECT set_quantifier_opt select_list from_clause_opt where_clause_opt partition_by_clause_opt range_opt every_opt fill_opt twindow_clause_opt group_by_clause_opt having_clause_opt",
- /* 521 */ "set_quantifier_opt ::=",
- /* 522 */ "set_quantifier_opt ::= DISTINCT",
- /* 523 */ "set_quantifier_opt ::= ALL",
- /* 524 */ "select_list ::= select_item",
- /* 525 */ "select_list ::= select_list NK_COMMA select_item",
- /* 526 */ "select_item ::= NK_STAR",
- /* 527 */ "select_item ::= common_expression",
- /* 528 */ "select_item ::= common_expression column_alias",
- /* 529 */ "select_item ::= common_expression AS column_alias",
- /* 530 */ "select_item ::= table_name NK_DOT NK_STAR",
- /* 531 */ "where_clause_opt ::=",
- /* 532 */ "where_clause_opt ::= WHERE search_condition",
- /* 533 */ "partition_by_clause_opt ::=",
- /* 534 */ "partition_by_clause_opt ::= PARTITION BY partition_list",
- /* 535 */ "partition_list ::= partition_item",
- /* 536 */ "partition_list ::= partition_list NK_COMMA partition_item",
- /* 537 */ "partition_item ::= expr_or_subquery",
- /* 538 */ "partition_item ::= expr_or_subquery column_alias",
- /* 539 */ "partition_item ::= expr_or_subquery AS column_alias",
- /* 540 */ "twindow_clause_opt ::=",
- /* 541 */ "twindow_clause_opt ::= SESSION NK_LP column_reference NK_COMMA duration_literal NK_RP",
- /* 542 */ "twindow_clause_opt ::= STATE_WINDOW NK_LP expr_or_subquery NK_RP",
- /* 543 */ "twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_RP sliding_opt fill_opt",
- /* 544 */ "twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_COMMA duration_literal NK_RP sliding_opt fill_opt",
- /* 545 */ "twindow_clause_opt ::= EVENT_WINDOW START WITH search_condition END WITH search_condition",
- /* 546 */ "sliding_opt ::=",
- /* 547 */ "sliding_opt ::= SLIDING NK_LP duration_literal NK_RP",
- /* 548 */ "fill_opt ::=",
- /* 549 */ "fill_opt ::= FILL NK_LP fill_mode NK_RP",
- /* 550 */ "fill_opt ::= FILL NK_LP VALUE NK_COMMA expression_list NK_RP",
- /* 551 */ "fill_opt ::= FILL NK_LP VALUE_F NK_COMMA expression_list NK_RP",
- /* 552 */ "fill_mode ::= NONE",
- /* 553 */ "fill_mode ::= PREV",
- /* 554 */ "fill_mode ::= NULL",
- /* 555 */ "fill_mode ::= NULL_F",
- /* 556 */ "fill_mode ::= LINEAR",
- /* 557 */ "fill_mode ::= NEXT",
- /* 558 */ "group_by_clause_opt ::=",
- /* 559 */ "group_by_clause_opt ::= GROUP BY group_by_list",
- /* 560 */ "group_by_list ::= expr_or_subquery",
- /* 561 */ "group_by_list ::= group_by_list NK_COMMA expr_or_subquery",
- /* 562 */ "having_clause_opt ::=",
- /* 563 */ "having_clause_opt ::= HAVING search_condition",
- /* 564 */ "range_opt ::=",
- /* 565 */ "range_opt ::= RANGE NK_LP expr_or_subquery NK_COMMA expr_or_subquery NK_RP",
- /* 566 */ "range_opt ::= RANGE NK_LP expr_or_subquery NK_RP",
- /* 567 */ "every_opt ::=",
- /* 568 */ "every_opt ::= EVERY NK_LP duration_literal NK_RP",
- /* 569 */ "query_expression ::= query_simple order_by_clause_opt slimit_clause_opt limit_clause_opt",
- /* 570 */ "query_simple ::= query_specification",
- /* 571 */ "query_simple ::= union_query_expression",
- /* 572 */ "union_query_expression ::= query_simple_or_subquery UNION ALL query_simple_or_subquery",
- /* 573 */ "union_query_expression ::= query_simple_or_subquery UNION query_simple_or_subquery",
- /* 574 */ "query_simple_or_subquery ::= query_simple",
- /* 575 */ "query_simple_or_subquery ::= subquery",
- /* 576 */ "query_or_subquery ::= query_expression",
- /* 577 */ "query_or_subquery ::= subquery",
- /* 578 */ "order_by_clause_opt ::=",
- /* 579 */ "order_by_clause_opt ::= ORDER BY sort_specification_list",
- /* 580 */ "slimit_clause_opt ::=",
- /* 581 */ "slimit_clause_opt ::= SLIMIT NK_INTEGER",
- /* 582 */ "slimit_clause_opt ::= SLIMIT NK_INTEGER SOFFSET NK_INTEGER",
- /* 583 */ "slimit_clause_opt ::= SLIMIT NK_INTEGER NK_COMMA NK_INTEGER",
- /* 584 */ "limit_clause_opt ::=",
- /* 585 */ "limit_clause_opt ::= LIMIT NK_INTEGER",
- /* 586 */ "limit_clause_opt ::= LIMIT NK_INTEGER OFFSET NK_INTEGER",
- /* 587 */ "limit_clause_opt ::= LIMIT NK_INTEGER NK_COMMA NK_INTEGER",
- /* 588 */ "subquery ::= NK_LP query_expression NK_RP",
- /* 589 */ "subquery ::= NK_LP subquery NK_RP",
- /* 590 */ "search_condition ::= common_expression",
- /* 591 */ "sort_specification_list ::= sort_specification",
- /* 592 */ "sort_specification_list ::= sort_specification_list NK_COMMA sort_specification",
- /* 593 */ "sort_specification ::= expr_or_subquery ordering_specification_opt null_ordering_opt",
- /* 594 */ "ordering_specification_opt ::=",
- /* 595 */ "ordering_specification_opt ::= ASC",
- /* 596 */ "ordering_specification_opt ::= DESC",
- /* 597 */ "null_ordering_opt ::=",
- /* 598 */ "null_ordering_opt ::= NULLS FIRST",
- /* 599 */ "null_ordering_opt ::= NULLS LAST",
+ /* 520 */ "join_type ::= LEFT",
+ /* 521 */ "join_type ::= LEFT OUTER",
+ /* 522 */ "query_specification ::= SELECT set_quantifier_opt select_list from_clause_opt where_clause_opt partition_by_clause_opt range_opt every_opt fill_opt twindow_clause_opt group_by_clause_opt having_clause_opt",
+ /* 523 */ "set_quantifier_opt ::=",
+ /* 524 */ "set_quantifier_opt ::= DISTINCT",
+ /* 525 */ "set_quantifier_opt ::= ALL",
+ /* 526 */ "select_list ::= select_item",
+ /* 527 */ "select_list ::= select_list NK_COMMA select_item",
+ /* 528 */ "select_item ::= NK_STAR",
+ /* 529 */ "select_item ::= common_expression",
+ /* 530 */ "select_item ::= common_expression column_alias",
+ /* 531 */ "select_item ::= common_expression AS column_alias",
+ /* 532 */ "select_item ::= table_name NK_DOT NK_STAR",
+ /* 533 */ "where_clause_opt ::=",
+ /* 534 */ "where_clause_opt ::= WHERE search_condition",
+ /* 535 */ "partition_by_clause_opt ::=",
+ /* 536 */ "partition_by_clause_opt ::= PARTITION BY partition_list",
+ /* 537 */ "partition_list ::= partition_item",
+ /* 538 */ "partition_list ::= partition_list NK_COMMA partition_item",
+ /* 539 */ "partition_item ::= expr_or_subquery",
+ /* 540 */ "partition_item ::= expr_or_subquery column_alias",
+ /* 541 */ "partition_item ::= expr_or_subquery AS column_alias",
+ /* 542 */ "twindow_clause_opt ::=",
+ /* 543 */ "twindow_clause_opt ::= SESSION NK_LP column_reference NK_COMMA duration_literal NK_RP",
+ /* 544 */ "twindow_clause_opt ::= STATE_WINDOW NK_LP expr_or_subquery NK_RP",
+ /* 545 */ "twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_RP sliding_opt fill_opt",
+ /* 546 */ "twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_COMMA duration_literal NK_RP sliding_opt fill_opt",
+ /* 547 */ "twindow_clause_opt ::= EVENT_WINDOW START WITH search_condition END WITH search_condition",
+ /* 548 */ "sliding_opt ::=",
+ /* 549 */ "sliding_opt ::= SLIDING NK_LP duration_literal NK_RP",
+ /* 550 */ "fill_opt ::=",
+ /* 551 */ "fill_opt ::= FILL NK_LP fill_mode NK_RP",
+ /* 552 */ "fill_opt ::= FILL NK_LP VALUE NK_COMMA expression_list NK_RP",
+ /* 553 */ "fill_opt ::= FILL NK_LP VALUE_F NK_COMMA expression_list NK_RP",
+ /* 554 */ "fill_mode ::= NONE",
+ /* 555 */ "fill_mode ::= PREV",
+ /* 556 */ "fill_mode ::= NULL",
+ /* 557 */ "fill_mode ::= NULL_F",
+ /* 558 */ "fill_mode ::= LINEAR",
+ /* 559 */ "fill_mode ::= NEXT",
+ /* 560 */ "group_by_clause_opt ::=",
+ /* 561 */ "group_by_clause_opt ::= GROUP BY group_by_list",
+ /* 562 */ "group_by_list ::= expr_or_subquery",
+ /* 563 */ "group_by_list ::= group_by_list NK_COMMA expr_or_subquery",
+ /* 564 */ "having_clause_opt ::=",
+ /* 565 */ "having_clause_opt ::= HAVING search_condition",
+ /* 566 */ "range_opt ::=",
+ /* 567 */ "range_opt ::= RANGE NK_LP expr_or_subquery NK_COMMA expr_or_subquery NK_RP",
+ /* 568 */ "range_opt ::= RANGE NK_LP expr_or_subquery NK_RP",
+ /* 569 */ "every_opt ::=",
+ /* 570 */ "every_opt ::= EVERY NK_LP duration_literal NK_RP",
+ /* 571 */ "query_expression ::= query_simple order_by_clause_opt slimit_clause_opt limit_clause_opt",
+ /* 572 */ "query_simple ::= query_specification",
+ /* 573 */ "query_simple ::= union_query_expression",
+ /* 574 */ "union_query_expression ::= query_simple_or_subquery UNION ALL query_simple_or_subquery",
+ /* 575 */ "union_query_expression ::= query_simple_or_subquery UNION query_simple_or_subquery",
+ /* 576 */ "query_simple_or_subquery ::= query_simple",
+ /* 577 */ "query_simple_or_subquery ::= subquery",
+ /* 578 */ "query_or_subquery ::= query_expression",
+ /* 579 */ "query_or_subquery ::= subquery",
+ /* 580 */ "order_by_clause_opt ::=",
+ /* 581 */ "order_by_clause_opt ::= ORDER BY sort_specification_list",
+ /* 582 */ "slimit_clause_opt ::=",
+ /* 583 */ "slimit_clause_opt ::= SLIMIT NK_INTEGER",
+ /* 584 */ "slimit_clause_opt ::= SLIMIT NK_INTEGER SOFFSET NK_INTEGER",
+ /* 585 */ "slimit_clause_opt ::= SLIMIT NK_INTEGER NK_COMMA NK_INTEGER",
+ /* 586 */ "limit_clause_opt ::=",
+ /* 587 */ "limit_clause_opt ::= LIMIT NK_INTEGER",
+ /* 588 */ "limit_clause_opt ::= LIMIT NK_INTEGER OFFSET NK_INTEGER",
+ /* 589 */ "limit_clause_opt ::= LIMIT NK_INTEGER NK_COMMA NK_INTEGER",
+ /* 590 */ "subquery ::= NK_LP query_expression NK_RP",
+ /* 591 */ "subquery ::= NK_LP subquery NK_RP",
+ /* 592 */ "search_condition ::= common_expression",
+ /* 593 */ "sort_specification_list ::= sort_specification",
+ /* 594 */ "sort_specification_list ::= sort_specification_list NK_COMMA sort_specification",
+ /* 595 */ "sort_specification ::= expr_or_subquery ordering_specification_opt null_ordering_opt",
+ /* 596 */ "ordering_specification_opt ::=",
+ /* 597 */ "ordering_specification_opt ::= ASC",
+ /* 598 */ "ordering_specification_opt ::= DESC",
+ /* 599 */ "null_ordering_opt ::=",
+ /* 600 */ "null_ordering_opt ::= NULLS FIRST",
+ /* 601 */ "null_ordering_opt ::= NULLS LAST",
 };
 #endif /* NDEBUG */
 
@@ -2697,211 +2699,211 @@ static void yy_destructor(
     */
 /********* Begin destructor definitions ***************************************/
       /* Default NON-TERMINAL Destructor */
-    case 338: /* cmd */
-    case 341: /* literal */
-    case 347: /* with_opt */
-    case 353: /* search_condition */
-    case 358: /* db_options */
-    case 360: /* alter_db_options */
-    case 362: /* start_opt */
-    case 363: /* end_opt */
-    case 367: /* signed */
-    case 369: /* retention */
-    case 370: /* full_table_name */
-    case 373: /* table_options */
-    case 377: /* alter_table_clause */
-    case 378: /* alter_table_options */
-    case 381: /* signed_literal */
-    case 382: /* create_subtable_clause */
-    case 385: /* drop_table_clause */
-    case 387: /* column_def */
-    case 391: /* duration_literal */
-    case 392: /* rollup_func_name */
-    case 394: /* col_name */
-    case 395: /* db_name_cond_opt */
-    case 396: /* like_pattern_opt */
-    case 397: /* table_name_cond */
-    case 398: /* from_db_opt */
-    case 400: /* tag_item */
-    case 402: /* full_index_name */
-    case 403: /* index_options */
-    case 406: /* sliding_opt */
-    case 407: /* sma_stream_opt */
-    case 408: /* func */
-    case 411: /* query_or_subquery */
-    case 412: /* where_clause_opt */
-    case 415: /* explain_options */
-    case 416: /* insert_query */
-    case 422: /* stream_options */
-    case 425: /* subtable_opt */
-    case 427: /* expression */
-    case 429: /* literal_func */
-    case 432: /* expr_or_subquery */
-    case 433: /* pseudo_column */
-    case 434: /* column_reference */
-    case 435: /* function_expression */
-    case 436: /* case_when_expression */
-    case 441: /* star_func_para */
-    case 443: /* case_when_else_opt */
-    case 444: /* common_expression */
-    case 445: /* when_then_expr */
-    case 446: /* predicate */
-    case 449: /* in_predicate_value */
-    case 450: /* boolean_value_expression */
-    case 451: /* boolean_primary */
-    case 452: /* from_clause_opt */
-    case 453: /* table_reference_list */
-    case 454: /* table_reference */
-    case 455: /* table_primary */
-    case 456: /* joined_table */
-    case 458: /* subquery */
-    case 459: /* parenthesized_joined_table */
-    case 461: /* query_specification */
-    case 465: /* range_opt */
-    case 466: /* every_opt */
-    case 467: /* fill_opt */
-    case 468: /* twindow_clause_opt */
-    case 470: /* having_clause_opt */
-    case 471: /* select_item */
-    case 473: /* partition_item */
-    case 476: /* query_expression */
-    case 477: /* query_simple */
-    case 479: /* slimit_clause_opt */
-    case 480: /* limit_clause_opt */
-    case 481: /* union_query_expression */
-    case 482: /* query_simple_or_subquery */
-    case 484: /* sort_specification */
+    case 340: /* cmd */
+    case 343: /* literal */
+    case 349: /* with_opt */
+    case 355: /* search_condition */
+    case 360: /* db_options */
+    case 362: /* alter_db_options */
+    case 364: /* start_opt */
+    case 365: /* end_opt */
+    case 369: /* signed */
+    case 371: /* retention */
+    case 372: /* full_table_name */
+    case 375: /* table_options */
+    case 379: /* alter_table_clause */
+    case 380: /* alter_table_options */
+    case 383: /* signed_literal */
+    case 384: /* create_subtable_clause */
+    case 387: /* drop_table_clause */
+    case 389: /* column_def */
+    case 393: /* duration_literal */
+    case 394: /* rollup_func_name */
+    case 396: /* col_name */
+    case 397: /* db_name_cond_opt */
+    case 398: /* like_pattern_opt */
+    case 399: /* table_name_cond */
+    case 400: /* from_db_opt */
+    case 402: /* tag_item */
+    case 404: /* full_index_name */
+    case 405: /* index_options */
+    case 408: /* sliding_opt */
+    case 409: /* sma_stream_opt */
+    case 410: /* func */
+    case 413: /* query_or_subquery */
+    case 414: /* where_clause_opt */
+    case 417: /* explain_options */
+    case 418: /* insert_query */
+    case 424: /* stream_options */
+    case 427: /* subtable_opt */
+    case 429: /* expression */
+    case 431: /* literal_func */
+    case 434: /* expr_or_subquery */
+    case 435: /* pseudo_column */
+    case 436: /* column_reference */
+    case 437: /* function_expression */
+    case 438: /* case_when_expression */
+    case 443: /* star_func_para */
+    case 445: /* case_when_else_opt */
+    case 446: /* common_expression */
+    case 447: /* when_then_expr */
+    case 448: /* predicate */
+    case 451: /* in_predicate_value */
+    case 452: /* boolean_value_expression */
+    case 453: /* boolean_primary */
+    case 454: /* from_clause_opt */
+    case 455: /* table_reference_list */
+    case 456: /* table_reference */
+    case 457: /* table_primary */
+    case 458: /* joined_table */
+    case 460: /* subquery */
+    case 461: /* parenthesized_joined_table */
+    case 463: /* query_specification */
+    case 467: /* range_opt */
+    case 468: /* every_opt */
+    case 469: /* fill_opt */
+    case 470: /* twindow_clause_opt */
+    case 472: /* having_clause_opt */
+    case 473: /* select_item */
+    case 475: /* partition_item */
+    case 478: /* query_expression */
+    case 479: /* query_simple */
+    case 481: /* slimit_clause_opt */
+    case 482: /* limit_clause_opt */
+    case 483: /* union_query_expression */
+    case 484: /* query_simple_or_subquery */
+    case 486: /* sort_specification */
 {
- nodesDestroyNode((yypminor->yy452)); 
+ nodesDestroyNode((yypminor->yy698)); 
 }
       break;
-    case 339: /* account_options */
-    case 340: /* alter_account_options */
-    case 342: /* alter_account_option */
-    case 361: /* speed_opt */
-    case 410: /* with_meta */
-    case 419: /* bufsize_opt */
+    case 341: /* account_options */
+    case 342: /* alter_account_options */
+    case 344: /* alter_account_option */
+    case 363: /* speed_opt */
+    case 412: /* with_meta */
+    case 421: /* bufsize_opt */
 {
  
 }
       break;
-    case 343: /* user_name */
-    case 350: /* db_name */
-    case 351: /* table_name */
-    case 352: /* topic_name */
-    case 354: /* dnode_endpoint */
-    case 379: /* column_name */
-    case 393: /* function_name */
-    case 401: /* column_alias */
-    case 404: /* index_name */
-    case 409: /* sma_func_name */
-    case 413: /* cgroup_name */
-    case 420: /* language_opt */
-    case 421: /* stream_name */
-    case 431: /* table_alias */
-    case 437: /* star_func */
-    case 439: /* noarg_func */
-    case 457: /* alias_opt */
+    case 345: /* user_name */
+    case 352: /* db_name */
+    case 353: /* table_name */
+    case 354: /* topic_name */
+    case 356: /* dnode_endpoint */
+    case 381: /* column_name */
+    case 395: /* function_name */
+    case 403: /* column_alias */
+    case 406: /* index_name */
+    case 411: /* sma_func_name */
+    case 415: /* cgroup_name */
+    case 422: /* language_opt */
+    case 423: /* stream_name */
+    case 433: /* table_alias */
+    case 439: /* star_func */
+    case 441: /* noarg_func */
+    case 459: /* alias_opt */
 {
  
 }
       break;
-    case 344: /* sysinfo_opt */
+    case 346: /* sysinfo_opt */
 {
  
 }
       break;
-    case 345: /* privileges */
-    case 348: /* priv_type_list */
-    case 349: /* priv_type */
+    case 347: /* privileges */
+    case 350: /* priv_type_list */
+    case 351: /* priv_type */
 {
  
 }
       break;
-    case 346: /* priv_level */
+    case 348: /* priv_level */
 {
  
 }
       break;
-    case 355: /* force_opt */
-    case 356: /* unsafe_opt */
-    case 357: /* not_exists_opt */
-    case 359: /* exists_opt */
-    case 414: /* analyze_opt */
-    case 417: /* or_replace_opt */
-    case 418: /* agg_func_opt */
-    case 426: /* ignore_opt */
-    case 462: /* set_quantifier_opt */
+    case 357: /* force_opt */
+    case 358: /* unsafe_opt */
+    case 359: /* not_exists_opt */
+    case 361: /* exists_opt */
+    case 416: /* analyze_opt */
+    case 419: /* or_replace_opt */
+    case 420: /* agg_func_opt */
+    case 428: /* ignore_opt */
+    case 464: /* set_quantifier_opt */
 {
  
 }
       break;
-    case 364: /* integer_list */
-    case 365: /* variable_list */
-    case 366: /* retention_list */
-    case 371: /* column_def_list */
-    case 372: /* tags_def_opt */
-    case 374: /* multi_create_clause */
-    case 375: /* tags_def */
-    case 376: /* multi_drop_clause */
-    case 383: /* specific_cols_opt */
-    case 384: /* expression_list */
-    case 386: /* col_name_list */
-    case 388: /* duration_list */
-    case 389: /* rollup_func_list */
-    case 399: /* tag_list_opt */
-    case 405: /* func_list */
-    case 423: /* col_list_opt */
-    case 424: /* tag_def_or_ref_opt */
-    case 428: /* dnode_list */
-    case 430: /* literal_list */
-    case 438: /* star_func_para_list */
-    case 440: /* other_para_list */
-    case 442: /* when_then_list */
-    case 463: /* select_list */
-    case 464: /* partition_by_clause_opt */
-    case 469: /* group_by_clause_opt */
-    case 472: /* partition_list */
-    case 475: /* group_by_list */
-    case 478: /* order_by_clause_opt */
-    case 483: /* sort_specification_list */
+    case 366: /* integer_list */
+    case 367: /* variable_list */
+    case 368: /* retention_list */
+    case 373: /* column_def_list */
+    case 374: /* tags_def_opt */
+    case 376: /* multi_create_clause */
+    case 377: /* tags_def */
+    case 378: /* multi_drop_clause */
+    case 385: /* specific_cols_opt */
+    case 386: /* expression_list */
+    case 388: /* col_name_list */
+    case 390: /* duration_list */
+    case 391: /* rollup_func_list */
+    case 401: /* tag_list_opt */
+    case 407: /* func_list */
+    case 425: /* col_list_opt */
+    case 426: /* tag_def_or_ref_opt */
+    case 430: /* dnode_list */
+    case 432: /* literal_list */
+    case 440: /* star_func_para_list */
+    case 442: /* other_para_list */
+    case 444: /* when_then_list */
+    case 465: /* select_list */
+    case 466: /* partition_by_clause_opt */
+    case 471: /* group_by_clause_opt */
+    case 474: /* partition_list */
+    case 477: /* group_by_list */
+    case 480: /* order_by_clause_opt */
+    case 485: /* sort_specification_list */
 {
- nodesDestroyList((yypminor->yy812)); 
+ nodesDestroyList((yypminor->yy88)); 
 }
       break;
-    case 368: /* alter_db_option */
-    case 390: /* alter_table_option */
+    case 370: /* alter_db_option */
+    case 392: /* alter_table_option */
 {
  
 }
       break;
-    case 380: /* type_name */
+    case 382: /* type_name */
 {
  
 }
       break;
-    case 447: /* compare_op */
-    case 448: /* in_op */
+    case 449: /* compare_op */
+    case 450: /* in_op */
 {
  
 }
       break;
-    case 460: /* join_type */
+    case 462: /* join_type */
 {
  
 }
       break;
-    case 474: /* fill_mode */
+    case 476: /* fill_mode */
 {
  
 }
       break;
-    case 485: /* ordering_specification_opt */
+    case 487: /* ordering_specification_opt */
 {
  
 }
       break;
-    case 486: /* null_ordering_opt */
+    case 488: /* null_ordering_opt */
 {
  
 }
@@ -3192,606 +3194,608 @@ static void yy_shift(
 /* For rule J, yyRuleInfoLhs[J] contains the symbol on the left-hand side
 ** of that rule */
 static const YYCODETYPE yyRuleInfoLhs[] = {
-   338,  /* (0) cmd ::= CREATE ACCOUNT NK_ID PASS NK_STRING account_options */
-   338,  /* (1) cmd ::= ALTER ACCOUNT NK_ID alter_account_options */
-   339,  /* (2) account_options ::= */
-   339,  /* (3) account_options ::= account_options PPS literal */
-   339,  /* (4) account_options ::= account_options TSERIES literal */
-   339,  /* (5) account_options ::= account_options STORAGE literal */
-   339,  /* (6) account_options ::= account_options STREAMS literal */
-   339,  /* (7) account_options ::= account_options QTIME literal */
-   339,  /* (8) account_options ::= account_options DBS literal */
-   339,  /* (9) account_options ::= account_options USERS literal */
-   339,  /* (10) account_options ::= account_options CONNS literal */
-   339,  /* (11) account_options ::= account_options STATE literal */
-   340,  /* (12) alter_account_options ::= alter_account_option */
-   340,  /* (13) alter_account_options ::= alter_account_options alter_account_option */
-   342,  /* (14) alter_account_option ::= PASS literal */
-   342,  /* (15) alter_account_option ::= PPS literal */
-   342,  /* (16) alter_account_option ::= TSERIES literal */
-   342,  /* (17) alter_account_option ::= STORAGE literal */
-   342,  /* (18) alter_account_option ::= STREAMS literal */
-   342,  /* (19) alter_account_option ::= QTIME literal */
-   342,  /* (20) alter_account_option ::= DBS literal */
-   342,  /* (21) alter_account_option ::= USERS literal */
-   342,  /* (22) alter_account_option ::= CONNS literal */
-   342,  /* (23) alter_account_option ::= STATE literal */
-   338,  /* (24) cmd ::= CREATE USER user_name PASS NK_STRING sysinfo_opt */
-   338,  /* (25) cmd ::= ALTER USER user_name PASS NK_STRING */
-   338,  /* (26) cmd ::= ALTER USER user_name ENABLE NK_INTEGER */
-   338,  /* (27) cmd ::= ALTER USER user_name SYSINFO NK_INTEGER */
-   338,  /* (28) cmd ::= DROP USER user_name */
-   344,  /* (29) sysinfo_opt ::= */
-   344,  /* (30) sysinfo_opt ::= SYSINFO NK_INTEGER */
-   338,  /* (31) cmd ::= GRANT privileges ON priv_level with_opt TO user_name */
-   338,  /* (32) cmd ::= REVOKE privileges ON priv_level with_opt FROM user_name */
-   345,  /* (33) privileges ::= ALL */
-   345,  /* (34) privileges ::= priv_type_list */
-   345,  /* (35) privileges ::= SUBSCRIBE */
-   348,  /* (36) priv_type_list ::= priv_type */
-   348,  /* (37) priv_type_list ::= priv_type_list NK_COMMA priv_type */
-   349,  /* (38) priv_type ::= READ */
-   349,  /* (39) priv_type ::= WRITE */
-   346,  /* (40) priv_level ::= NK_STAR NK_DOT NK_STAR */
-   346,  /* (41) priv_level ::= db_name NK_DOT NK_STAR */
-   346,  /* (42) priv_level ::= db_name NK_DOT table_name */
-   346,  /* (43) priv_level ::= topic_name */
-   347,  /* (44) with_opt ::= */
-   347,  /* (45) with_opt ::= WITH search_condition */
-   338,  /* (46) cmd ::= CREATE DNODE dnode_endpoint */
-   338,  /* (47) cmd ::= CREATE DNODE dnode_endpoint PORT NK_INTEGER */
-   338,  /* (48) cmd ::= DROP DNODE NK_INTEGER force_opt */
-   338,  /* (49) cmd ::= DROP DNODE dnode_endpoint force_opt */
-   338,  /* (50) cmd ::= DROP DNODE NK_INTEGER unsafe_opt */
-   338,  /* (51) cmd ::= DROP DNODE dnode_endpoint unsafe_opt */
-   338,  /* (52) cmd ::= ALTER DNODE NK_INTEGER NK_STRING */
-   338,  /* (53) cmd ::= ALTER DNODE NK_INTEGER NK_STRING NK_STRING */
-   338,  /* (54) cmd ::= ALTER ALL DNODES NK_STRING */
-   338,  /* (55) cmd ::= ALTER ALL DNODES NK_STRING NK_STRING */
-   338,  /* (56) cmd ::= RESTORE DNODE NK_INTEGER */
-   354,  /* (57) dnode_endpoint ::= NK_STRING */
-   354,  /* (58) dnode_endpoint ::= NK_ID */
-   354,  /* (59) dnode_endpoint ::= NK_IPTOKEN */
-   355,  /* (60) force_opt ::= */
-   355,  /* (61) force_opt ::= FORCE */
-   356,  /* (62) unsafe_opt ::= UNSAFE */
-   338,  /* (63) cmd ::= ALTER LOCAL NK_STRING */
-   338,  /* (64) cmd ::= ALTER LOCAL NK_STRING NK_STRING */
-   338,  /* (65) cmd ::= CREATE QNODE ON DNODE NK_INTEGER */
-   338,  /* (66) cmd ::= DROP QNODE ON DNODE NK_INTEGER */
-   338,  /* (67) cmd ::= RESTORE QNODE ON DNODE NK_INTEGER */
-   338,  /* (68) cmd ::= CREATE BNODE ON DNODE NK_INTEGER */
-   338,  /* (69) cmd ::= DROP BNODE ON DNODE NK_INTEGER */
-   338,  /* (70) cmd ::= CREATE SNODE ON DNODE NK_INTEGER */
-   338,  /* (71) cmd ::= DROP SNODE ON DNODE NK_INTEGER */
-   338,  /* (72) cmd ::= CREATE MNODE ON DNODE NK_INTEGER */
-   338,  /* (73) cmd ::= DROP MNODE ON DNODE NK_INTEGER */
-   338,  /* (74) cmd ::= RESTORE MNODE ON DNODE NK_INTEGER */
-   338,  /* (75) cmd ::= RESTORE VNODE ON DNODE NK_INTEGER */
-   338,  /* (76) cmd ::= CREATE DATABASE not_exists_opt db_name db_options */
-   338,  /* (77) cmd ::= DROP DATABASE exists_opt db_name */
-   338,  /* (78) cmd ::= USE db_name */
-   338,  /* (79) cmd ::= ALTER DATABASE db_name alter_db_options */
-   338,  /* (80) cmd ::= FLUSH DATABASE db_name */
-   338,  /* (81) cmd ::= TRIM DATABASE db_name speed_opt */
-   338,  /* (82) cmd ::= COMPACT DATABASE db_name start_opt end_opt */
-   357,  /* (83) not_exists_opt ::= IF NOT EXISTS */
-   357,  /* (84) not_exists_opt ::= */
-   359,  /* (85) exists_opt ::= IF EXISTS */
-   359,  /* (86) exists_opt ::= */
-   358,  /* (87) db_options ::= */
-   358,  /* (88) db_options ::= db_options BUFFER NK_INTEGER */
-   358,  /* (89) db_options ::= db_options CACHEMODEL NK_STRING */
-   358,  /* (90) db_options ::= db_options CACHESIZE NK_INTEGER */
-   358,  /* (91) db_options ::= db_options COMP NK_INTEGER */
-   358,  /* (92) db_options ::= db_options DURATION NK_INTEGER */
-   358,  /* (93) db_options ::= db_options DURATION NK_VARIABLE */
-   358,  /* (94) db_options ::= db_options MAXROWS NK_INTEGER */
-   358,  /* (95) db_options ::= db_options MINROWS NK_INTEGER */
-   358,  /* (96) db_options ::= db_options KEEP integer_list */
-   358,  /* (97) db_options ::= db_options KEEP variable_list */
-   358,  /* (98) db_options ::= db_options PAGES NK_INTEGER */
-   358,  /* (99) db_options ::= db_options PAGESIZE NK_INTEGER */
-   358,  /* (100) db_options ::= db_options TSDB_PAGESIZE NK_INTEGER */
-   358,  /* (101) db_options ::= db_options PRECISION NK_STRING */
-   358,  /* (102) db_options ::= db_options REPLICA NK_INTEGER */
-   358,  /* (103) db_options ::= db_options VGROUPS NK_INTEGER */
-   358,  /* (104) db_options ::= db_options SINGLE_STABLE NK_INTEGER */
-   358,  /* (105) db_options ::= db_options RETENTIONS retention_list */
-   358,  /* (106) db_options ::= db_options SCHEMALESS NK_INTEGER */
-   358,  /* (107) db_options ::= db_options WAL_LEVEL NK_INTEGER */
-   358,  /* (108) db_options ::= db_options WAL_FSYNC_PERIOD NK_INTEGER */
-   358,  /* (109) db_options ::= db_options WAL_RETENTION_PERIOD NK_INTEGER */
-   358,  /* (110) db_options ::= db_options WAL_RETENTION_PERIOD NK_MINUS NK_INTEGER */
-   358,  /* (111) db_options ::= db_options WAL_RETENTION_SIZE NK_INTEGER */
-   358,  /* (112) db_options ::= db_options WAL_RETENTION_SIZE NK_MINUS NK_INTEGER */
-   358,  /* (113) db_options ::= db_options WAL_ROLL_PERIOD NK_INTEGER */
-   358,  /* (114) db_options ::= db_options WAL_SEGMENT_SIZE NK_INTEGER */
-   358,  /* (115) db_options ::= db_options STT_TRIGGER NK_INTEGER */
-   358,  /* (116) db_options ::= db_options TABLE_PREFIX signed */
-   358,  /* (117) db_options ::= db_options TABLE_SUFFIX signed */
-   360,  /* (118) alter_db_options ::= alter_db_option */
-   360,  /* (119) alter_db_options ::= alter_db_options alter_db_option */
-   368,  /* (120) alter_db_option ::= BUFFER NK_INTEGER */
-   368,  /* (121) alter_db_option ::= CACHEMODEL NK_STRING */
-   368,  /* (122) alter_db_option ::= CACHESIZE NK_INTEGER */
-   368,  /* (123) alter_db_option ::= WAL_FSYNC_PERIOD NK_INTEGER */
-   368,  /* (124) alter_db_option ::= KEEP integer_list */
-   368,  /* (125) alter_db_option ::= KEEP variable_list */
-   368,  /* (126) alter_db_option ::= PAGES NK_INTEGER */
-   368,  /* (127) alter_db_option ::= REPLICA NK_INTEGER */
-   368,  /* (128) alter_db_option ::= WAL_LEVEL NK_INTEGER */
-   368,  /* (129) alter_db_option ::= STT_TRIGGER NK_INTEGER */
-   368,  /* (130) alter_db_option ::= MINROWS NK_INTEGER */
-   368,  /* (131) alter_db_option ::= WAL_RETENTION_PERIOD NK_INTEGER */
-   368,  /* (132) alter_db_option ::= WAL_RETENTION_PERIOD NK_MINUS NK_INTEGER */
-   368,  /* (133) alter_db_option ::= WAL_RETENTION_SIZE NK_INTEGER */
-   368,  /* (134) alter_db_option ::= WAL_RETENTION_SIZE NK_MINUS NK_INTEGER */
-   364,  /* (135) integer_list ::= NK_INTEGER */
-   364,  /* (136) integer_list ::= integer_list NK_COMMA NK_INTEGER */
-   365,  /* (137) variable_list ::= NK_VARIABLE */
-   365,  /* (138) variable_list ::= variable_list NK_COMMA NK_VARIABLE */
-   366,  /* (139) retention_list ::= retention */
-   366,  /* (140) retention_list ::= retention_list NK_COMMA retention */
-   369,  /* (141) retention ::= NK_VARIABLE NK_COLON NK_VARIABLE */
-   361,  /* (142) speed_opt ::= */
-   361,  /* (143) speed_opt ::= MAX_SPEED NK_INTEGER */
-   362,  /* (144) start_opt ::= */
-   362,  /* (145) start_opt ::= START WITH NK_INTEGER */
-   362,  /* (146) start_opt ::= START WITH NK_STRING */
-   362,  /* (147) start_opt ::= START WITH TIMESTAMP NK_STRING */
-   363,  /* (148) end_opt ::= */
-   363,  /* (149) end_opt ::= END WITH NK_INTEGER */
-   363,  /* (150) end_opt ::= END WITH NK_STRING */
-   363,  /* (151) end_opt ::= END WITH TIMESTAMP NK_STRING */
-   338,  /* (152) cmd ::= CREATE TABLE not_exists_opt full_table_name NK_LP column_def_list NK_RP tags_def_opt table_options */
-   338,  /* (153) cmd ::= CREATE TABLE multi_create_clause */
-   338,  /* (154) cmd ::= CREATE STABLE not_exists_opt full_table_name NK_LP column_def_list NK_RP tags_def table_options */
-   338,  /* (155) cmd ::= DROP TABLE multi_drop_clause */
-   338,  /* (156) cmd ::= DROP STABLE exists_opt full_table_name */
-   338,  /* (157) cmd ::= ALTER TABLE alter_table_clause */
-   338,  /* (158) cmd ::= ALTER STABLE alter_table_clause */
-   377,  /* (159) alter_table_clause ::= full_table_name alter_table_options */
-   377,  /* (160) alter_table_clause ::= full_table_name ADD COLUMN column_name type_name */
-   377,  /* (161) alter_table_clause ::= full_table_name DROP COLUMN column_name */
-   377,  /* (162) alter_table_clause ::= full_table_name MODIFY COLUMN column_name type_name */
-   377,  /* (163) alter_table_clause ::= full_table_name RENAME COLUMN column_name column_name */
-   377,  /* (164) alter_table_clause ::= full_table_name ADD TAG column_name type_name */
-   377,  /* (165) alter_table_clause ::= full_table_name DROP TAG column_name */
-   377,  /* (166) alter_table_clause ::= full_table_name MODIFY TAG column_name type_name */
-   377,  /* (167) alter_table_clause ::= full_table_name RENAME TAG column_name column_name */
-   377,  /* (168) alter_table_clause ::= full_table_name SET TAG column_name NK_EQ signed_literal */
-   374,  /* (169) multi_create_clause ::= create_subtable_clause */
-   374,  /* (170) multi_create_clause ::= multi_create_clause create_subtable_clause */
-   382,  /* (171) create_subtable_clause ::= not_exists_opt full_table_name USING full_table_name specific_cols_opt TAGS NK_LP expression_list NK_RP table_options */
-   376,  /* (172) multi_drop_clause ::= drop_table_clause */
-   376,  /* (173) multi_drop_clause ::= multi_drop_clause NK_COMMA drop_table_clause */
-   385,  /* (174) drop_table_clause ::= exists_opt full_table_name */
-   383,  /* (175) specific_cols_opt ::= */
-   383,  /* (176) specific_cols_opt ::= NK_LP col_name_list NK_RP */
-   370,  /* (177) full_table_name ::= table_name */
-   370,  /* (178) full_table_name ::= db_name NK_DOT table_name */
-   371,  /* (179) column_def_list ::= column_def */
-   371,  /* (180) column_def_list ::= column_def_list NK_COMMA column_def */
-   387,  /* (181) column_def ::= column_name type_name */
-   380,  /* (182) type_name ::= BOOL */
-   380,  /* (183) type_name ::= TINYINT */
-   380,  /* (184) type_name ::= SMALLINT */
-   380,  /* (185) type_name ::= INT */
-   380,  /* (186) type_name ::= INTEGER */
-   380,  /* (187) type_name ::= BIGINT */
-   380,  /* (188) type_name ::= FLOAT */
-   380,  /* (189) type_name ::= DOUBLE */
-   380,  /* (190) type_name ::= BINARY NK_LP NK_INTEGER NK_RP */
-   380,  /* (191) type_name ::= TIMESTAMP */
-   380,  /* (192) type_name ::= NCHAR NK_LP NK_INTEGER NK_RP */
-   380,  /* (193) type_name ::= TINYINT UNSIGNED */
-   380,  /* (194) type_name ::= SMALLINT UNSIGNED */
-   380,  /* (195) type_name ::= INT UNSIGNED */
-   380,  /* (196) type_name ::= BIGINT UNSIGNED */
-   380,  /* (197) type_name ::= JSON */
-   380,  /* (198) type_name ::= VARCHAR NK_LP NK_INTEGER NK_RP */
-   380,  /* (199) type_name ::= MEDIUMBLOB */
-   380,  /* (200) type_name ::= BLOB */
-   380,  /* (201) type_name ::= VARBINARY NK_LP NK_INTEGER NK_RP */
-   380,  /* (202) type_name ::= GEOMETRY NK_LP NK_INTEGER NK_RP */
-   380,  /* (203) type_name ::= DECIMAL */
-   380,  /* (204) type_name ::= DECIMAL NK_LP NK_INTEGER NK_RP */
-   380,  /* (205) type_name ::= DECIMAL NK_LP NK_INTEGER NK_COMMA NK_INTEGER NK_RP */
-   372,  /* (206) tags_def_opt ::= */
-   372,  /* (207) tags_def_opt ::= tags_def */
-   375,  /* (208) tags_def ::= TAGS NK_LP column_def_list NK_RP */
-   373,  /* (209) table_options ::= */
-   373,  /* (210) table_options ::= table_options COMMENT NK_STRING */
-   373,  /* (211) table_options ::= table_options MAX_DELAY duration_list */
-   373,  /* (212) table_options ::= table_options WATERMARK duration_list */
-   373,  /* (213) table_options ::= table_options ROLLUP NK_LP rollup_func_list NK_RP */
-   373,  /* (214) table_options ::= table_options TTL NK_INTEGER */
-   373,  /* (215) table_options ::= table_options SMA NK_LP col_name_list NK_RP */
-   373,  /* (216) table_options ::= table_options DELETE_MARK duration_list */
-   378,  /* (217) alter_table_options ::= alter_table_option */
-   378,  /* (218) alter_table_options ::= alter_table_options alter_table_option */
-   390,  /* (219) alter_table_option ::= COMMENT NK_STRING */
-   390,  /* (220) alter_table_option ::= TTL NK_INTEGER */
-   388,  /* (221) duration_list ::= duration_literal */
-   388,  /* (222) duration_list ::= duration_list NK_COMMA duration_literal */
-   389,  /* (223) rollup_func_list ::= rollup_func_name */
-   389,  /* (224) rollup_func_list ::= rollup_func_list NK_COMMA rollup_func_name */
-   392,  /* (225) rollup_func_name ::= function_name */
-   392,  /* (226) rollup_func_name ::= FIRST */
-   392,  /* (227) rollup_func_name ::= LAST */
-   386,  /* (228) col_name_list ::= col_name */
-   386,  /* (229) col_name_list ::= col_name_list NK_COMMA col_name */
-   394,  /* (230) col_name ::= column_name */
-   338,  /* (231) cmd ::= SHOW DNODES */
-   338,  /* (232) cmd ::= SHOW USERS */
-   338,  /* (233) cmd ::= SHOW USER PRIVILEGES */
-   338,  /* (234) cmd ::= SHOW DATABASES */
-   338,  /* (235) cmd ::= SHOW db_name_cond_opt TABLES like_pattern_opt */
-   338,  /* (236) cmd ::= SHOW db_name_cond_opt STABLES like_pattern_opt */
-   338,  /* (237) cmd ::= SHOW db_name_cond_opt VGROUPS */
-   338,  /* (238) cmd ::= SHOW MNODES */
-   338,  /* (239) cmd ::= SHOW QNODES */
-   338,  /* (240) cmd ::= SHOW FUNCTIONS */
-   338,  /* (241) cmd ::= SHOW INDEXES FROM table_name_cond from_db_opt */
-   338,  /* (242) cmd ::= SHOW INDEXES FROM db_name NK_DOT table_name */
-   338,  /* (243) cmd ::= SHOW STREAMS */
-   338,  /* (244) cmd ::= SHOW ACCOUNTS */
-   338,  /* (245) cmd ::= SHOW APPS */
-   338,  /* (246) cmd ::= SHOW CONNECTIONS */
-   338,  /* (247) cmd ::= SHOW LICENCES */
-   338,  /* (248) cmd ::= SHOW GRANTS */
-   338,  /* (249) cmd ::= SHOW CREATE DATABASE db_name */
-   338,  /* (250) cmd ::= SHOW CREATE TABLE full_table_name */
-   338,  /* (251) cmd ::= SHOW CREATE STABLE full_table_name */
-   338,  /* (252) cmd ::= SHOW QUERIES */
-   338,  /* (253) cmd ::= SHOW SCORES */
-   338,  /* (254) cmd ::= SHOW TOPICS */
-   338,  /* (255) cmd ::= SHOW VARIABLES */
-   338,  /* (256) cmd ::= SHOW CLUSTER VARIABLES */
-   338,  /* (257) cmd ::= SHOW LOCAL VARIABLES */
-   338,  /* (258) cmd ::= SHOW DNODE NK_INTEGER VARIABLES like_pattern_opt */
-   338,  /* (259) cmd ::= SHOW BNODES */
-   338,  /* (260) cmd ::= SHOW SNODES */
-   338,  /* (261) cmd ::= SHOW CLUSTER */
-   338,  /* (262) cmd ::= SHOW TRANSACTIONS */
-   338,  /* (263) cmd ::= SHOW TABLE DISTRIBUTED full_table_name */
-   338,  /* (264) cmd ::= SHOW CONSUMERS */
-   338,  /* (265) cmd ::= SHOW SUBSCRIPTIONS */
-   338,  /* (266) cmd ::= SHOW TAGS FROM table_name_cond from_db_opt */
-   338,  /* (267) cmd ::= SHOW TAGS FROM db_name NK_DOT table_name */
-   338,  /* (268) cmd ::= SHOW TABLE TAGS tag_list_opt FROM table_name_cond from_db_opt */
-   338,  /* (269) cmd ::= SHOW TABLE TAGS tag_list_opt FROM db_name NK_DOT table_name */
-   338,  /* (270) cmd ::= SHOW VNODES NK_INTEGER */
-   338,  /* (271) cmd ::= SHOW VNODES NK_STRING */
-   338,  /* (272) cmd ::= SHOW db_name_cond_opt ALIVE */
-   338,  /* (273) cmd ::= SHOW CLUSTER ALIVE */
-   395,  /* (274) db_name_cond_opt ::= */
-   395,  /* (275) db_name_cond_opt ::= db_name NK_DOT */
-   396,  /* (276) like_pattern_opt ::= */
-   396,  /* (277) like_pattern_opt ::= LIKE NK_STRING */
-   397,  /* (278) table_name_cond ::= table_name */
-   398,  /* (279) from_db_opt ::= */
-   398,  /* (280) from_db_opt ::= FROM db_name */
-   399,  /* (281) tag_list_opt ::= */
-   399,  /* (282) tag_list_opt ::= tag_item */
-   399,  /* (283) tag_list_opt ::= tag_list_opt NK_COMMA tag_item */
-   400,  /* (284) tag_item ::= TBNAME */
-   400,  /* (285) tag_item ::= QTAGS */
-   400,  /* (286) tag_item ::= column_name */
-   400,  /* (287) tag_item ::= column_name column_alias */
-   400,  /* (288) tag_item ::= column_name AS column_alias */
-   338,  /* (289) cmd ::= CREATE SMA INDEX not_exists_opt full_index_name ON full_table_name index_options */
-   338,  /* (290) cmd ::= CREATE INDEX not_exists_opt full_index_name ON full_table_name NK_LP col_name_list NK_RP */
-   338,  /* (291) cmd ::= DROP INDEX exists_opt full_index_name */
-   402,  /* (292) full_index_name ::= index_name */
-   402,  /* (293) full_index_name ::= db_name NK_DOT index_name */
-   403,  /* (294) index_options ::= FUNCTION NK_LP func_list NK_RP INTERVAL NK_LP duration_literal NK_RP sliding_opt sma_stream_opt */
-   403,  /* (295) index_options ::= FUNCTION NK_LP func_list NK_RP INTERVAL NK_LP duration_literal NK_COMMA duration_literal NK_RP sliding_opt sma_stream_opt */
-   405,  /* (296) func_list ::= func */
-   405,  /* (297) func_list ::= func_list NK_COMMA func */
-   408,  /* (298) func ::= sma_func_name NK_LP expression_list NK_RP */
-   409,  /* (299) sma_func_name ::= function_name */
-   409,  /* (300) sma_func_name ::= COUNT */
-   409,  /* (301) sma_func_name ::= FIRST */
-   409,  /* (302) sma_func_name ::= LAST */
-   409,  /* (303) sma_func_name ::= LAST_ROW */
-   407,  /* (304) sma_stream_opt ::= */
-   407,  /* (305) sma_stream_opt ::= sma_stream_opt WATERMARK duration_literal */
-   407,  /* (306) sma_stream_opt ::= sma_stream_opt MAX_DELAY duration_literal */
-   407,  /* (307) sma_stream_opt ::= sma_stream_opt DELETE_MARK duration_literal */
-   410,  /* (308) with_meta ::= AS */
-   410,  /* (309) with_meta ::= WITH META AS */
-   410,  /* (310) with_meta ::= ONLY META AS */
-   338,  /* (311) cmd ::= CREATE TOPIC not_exists_opt topic_name AS query_or_subquery */
-   338,  /* (312) cmd ::= CREATE TOPIC not_exists_opt topic_name with_meta DATABASE db_name */
-   338,  /* (313) cmd ::= CREATE TOPIC not_exists_opt topic_name with_meta STABLE full_table_name where_clause_opt */
-   338,  /* (314) cmd ::= DROP TOPIC exists_opt topic_name */
-   338,  /* (315) cmd ::= DROP CONSUMER GROUP exists_opt cgroup_name ON topic_name */
-   338,  /* (316) cmd ::= DESC full_table_name */
-   338,  /* (317) cmd ::= DESCRIBE full_table_name */
-   338,  /* (318) cmd ::= RESET QUERY CACHE */
-   338,  /* (319) cmd ::= EXPLAIN analyze_opt explain_options query_or_subquery */
-   338,  /* (320) cmd ::= EXPLAIN analyze_opt explain_options insert_query */
-   414,  /* (321) analyze_opt ::= */
-   414,  /* (322) analyze_opt ::= ANALYZE */
-   415,  /* (323) explain_options ::= */
-   415,  /* (324) explain_options ::= explain_options VERBOSE NK_BOOL */
-   415,  /* (325) explain_options ::= explain_options RATIO NK_FLOAT */
-   338,  /* (326) cmd ::= CREATE or_replace_opt agg_func_opt FUNCTION not_exists_opt function_name AS NK_STRING OUTPUTTYPE type_name bufsize_opt language_opt */
-   338,  /* (327) cmd ::= DROP FUNCTION exists_opt function_name */
-   418,  /* (328) agg_func_opt ::= */
-   418,  /* (329) agg_func_opt ::= AGGREGATE */
-   419,  /* (330) bufsize_opt ::= */
-   419,  /* (331) bufsize_opt ::= BUFSIZE NK_INTEGER */
-   420,  /* (332) language_opt ::= */
-   420,  /* (333) language_opt ::= LANGUAGE NK_STRING */
-   417,  /* (334) or_replace_opt ::= */
-   417,  /* (335) or_replace_opt ::= OR REPLACE */
-   338,  /* (336) cmd ::= CREATE STREAM not_exists_opt stream_name stream_options INTO full_table_name col_list_opt tag_def_or_ref_opt subtable_opt AS query_or_subquery */
-   338,  /* (337) cmd ::= DROP STREAM exists_opt stream_name */
-   338,  /* (338) cmd ::= PAUSE STREAM exists_opt stream_name */
-   338,  /* (339) cmd ::= RESUME STREAM exists_opt ignore_opt stream_name */
-   423,  /* (340) col_list_opt ::= */
-   423,  /* (341) col_list_opt ::= NK_LP col_name_list NK_RP */
-   424,  /* (342) tag_def_or_ref_opt ::= */
-   424,  /* (343) tag_def_or_ref_opt ::= tags_def */
-   424,  /* (344) tag_def_or_ref_opt ::= TAGS NK_LP col_name_list NK_RP */
-   422,  /* (345) stream_options ::= */
-   422,  /* (346) stream_options ::= stream_options TRIGGER AT_ONCE */
-   422,  /* (347) stream_options ::= stream_options TRIGGER WINDOW_CLOSE */
-   422,  /* (348) stream_options ::= stream_options TRIGGER MAX_DELAY duration_literal */
-   422,  /* (349) stream_options ::= stream_options WATERMARK duration_literal */
-   422,  /* (350) stream_options ::= stream_options IGNORE EXPIRED NK_INTEGER */
-   422,  /* (351) stream_options ::= stream_options FILL_HISTORY NK_INTEGER */
-   422,  /* (352) stream_options ::= stream_options DELETE_MARK duration_literal */
-   422,  /* (353) stream_options ::= stream_options IGNORE UPDATE NK_INTEGER */
-   425,  /* (354) subtable_opt ::= */
-   425,  /* (355) subtable_opt ::= SUBTABLE NK_LP expression NK_RP */
-   426,  /* (356) ignore_opt ::= */
-   426,  /* (357) ignore_opt ::= IGNORE UNTREATED */
-   338,  /* (358) cmd ::= KILL CONNECTION NK_INTEGER */
-   338,  /* (359) cmd ::= KILL QUERY NK_STRING */
-   338,  /* (360) cmd ::= KILL TRANSACTION NK_INTEGER */
-   338,  /* (361) cmd ::= BALANCE VGROUP */
-   338,  /* (362) cmd ::= BALANCE VGROUP LEADER */
-   338,  /* (363) cmd ::= MERGE VGROUP NK_INTEGER NK_INTEGER */
-   338,  /* (364) cmd ::= REDISTRIBUTE VGROUP NK_INTEGER dnode_list */
-   338,  /* (365) cmd ::= SPLIT VGROUP NK_INTEGER */
-   428,  /* (366) dnode_list ::= DNODE NK_INTEGER */
-   428,  /* (367) dnode_list ::= dnode_list DNODE NK_INTEGER */
-   338,  /* (368) cmd ::= DELETE FROM full_table_name where_clause_opt */
-   338,  /* (369) cmd ::= query_or_subquery */
-   338,  /* (370) cmd ::= insert_query */
-   416,  /* (371) insert_query ::= INSERT INTO full_table_name NK_LP col_name_list NK_RP query_or_subquery */
-   416,  /* (372) insert_query ::= INSERT INTO full_table_name query_or_subquery */
-   341,  /* (373) literal ::= NK_INTEGER */
-   341,  /* (374) literal ::= NK_FLOAT */
-   341,  /* (375) literal ::= NK_STRING */
-   341,  /* (376) literal ::= NK_BOOL */
-   341,  /* (377) literal ::= TIMESTAMP NK_STRING */
-   341,  /* (378) literal ::= duration_literal */
-   341,  /* (379) literal ::= NULL */
-   341,  /* (380) literal ::= NK_QUESTION */
-   391,  /* (381) duration_literal ::= NK_VARIABLE */
-   367,  /* (382) signed ::= NK_INTEGER */
-   367,  /* (383) signed ::= NK_PLUS NK_INTEGER */
-   367,  /* (384) signed ::= NK_MINUS NK_INTEGER */
-   367,  /* (385) signed ::= NK_FLOAT */
-   367,  /* (386) signed ::= NK_PLUS NK_FLOAT */
-   367,  /* (387) signed ::= NK_MINUS NK_FLOAT */
-   381,  /* (388) signed_literal ::= signed */
-   381,  /* (389) signed_literal ::= NK_STRING */
-   381,  /* (390) signed_literal ::= NK_BOOL */
-   381,  /* (391) signed_literal ::= TIMESTAMP NK_STRING */
-   381,  /* (392) signed_literal ::= duration_literal */
-   381,  /* (393) signed_literal ::= NULL */
-   381,  /* (394) signed_literal ::= literal_func */
-   381,  /* (395) signed_literal ::= NK_QUESTION */
-   430,  /* (396) literal_list ::= signed_literal */
-   430,  /* (397) literal_list ::= literal_list NK_COMMA signed_literal */
-   350,  /* (398) db_name ::= NK_ID */
-   351,  /* (399) table_name ::= NK_ID */
-   379,  /* (400) column_name ::= NK_ID */
-   393,  /* (401) function_name ::= NK_ID */
-   431,  /* (402) table_alias ::= NK_ID */
-   401,  /* (403) column_alias ::= NK_ID */
-   343,  /* (404) user_name ::= NK_ID */
-   352,  /* (405) topic_name ::= NK_ID */
-   421,  /* (406) stream_name ::= NK_ID */
-   413,  /* (407) cgroup_name ::= NK_ID */
-   404,  /* (408) index_name ::= NK_ID */
-   432,  /* (409) expr_or_subquery ::= expression */
-   427,  /* (410) expression ::= literal */
-   427,  /* (411) expression ::= pseudo_column */
-   427,  /* (412) expression ::= column_reference */
-   427,  /* (413) expression ::= function_expression */
-   427,  /* (414) expression ::= case_when_expression */
-   427,  /* (415) expression ::= NK_LP expression NK_RP */
-   427,  /* (416) expression ::= NK_PLUS expr_or_subquery */
-   427,  /* (417) expression ::= NK_MINUS expr_or_subquery */
-   427,  /* (418) expression ::= expr_or_subquery NK_PLUS expr_or_subquery */
-   427,  /* (419) expression ::= expr_or_subquery NK_MINUS expr_or_subquery */
-   427,  /* (420) expression ::= expr_or_subquery NK_STAR expr_or_subquery */
-   427,  /* (421) expression ::= expr_or_subquery NK_SLASH expr_or_subquery */
-   427,  /* (422) expression ::= expr_or_subquery NK_REM expr_or_subquery */
-   427,  /* (423) expression ::= column_reference NK_ARROW NK_STRING */
-   427,  /* (424) expression ::= expr_or_subquery NK_BITAND expr_or_subquery */
-   427,  /* (425) expression ::= expr_or_subquery NK_BITOR expr_or_subquery */
-   384,  /* (426) expression_list ::= expr_or_subquery */
-   384,  /* (427) expression_list ::= expression_list NK_COMMA expr_or_subquery */
-   434,  /* (428) column_reference ::= column_name */
-   434,  /* (429) column_reference ::= table_name NK_DOT column_name */
-   433,  /* (430) pseudo_column ::= ROWTS */
-   433,  /* (431) pseudo_column ::= TBNAME */
-   433,  /* (432) pseudo_column ::= table_name NK_DOT TBNAME */
-   433,  /* (433) pseudo_column ::= QSTART */
-   433,  /* (434) pseudo_column ::= QEND */
-   433,  /* (435) pseudo_column ::= QDURATION */
-   433,  /* (436) pseudo_column ::= WSTART */
-   433,  /* (437) pseudo_column ::= WEND */
-   433,  /* (438) pseudo_column ::= WDURATION */
-   433,  /* (439) pseudo_column ::= IROWTS */
-   433,  /* (440) pseudo_column ::= ISFILLED */
-   433,  /* (441) pseudo_column ::= QTAGS */
-   435,  /* (442) function_expression ::= function_name NK_LP expression_list NK_RP */
-   435,  /* (443) function_expression ::= star_func NK_LP star_func_para_list NK_RP */
-   435,  /* (444) function_expression ::= CAST NK_LP expr_or_subquery AS type_name NK_RP */
-   435,  /* (445) function_expression ::= literal_func */
-   429,  /* (446) literal_func ::= noarg_func NK_LP NK_RP */
-   429,  /* (447) literal_func ::= NOW */
-   439,  /* (448) noarg_func ::= NOW */
-   439,  /* (449) noarg_func ::= TODAY */
-   439,  /* (450) noarg_func ::= TIMEZONE */
-   439,  /* (451) noarg_func ::= DATABASE */
-   439,  /* (452) noarg_func ::= CLIENT_VERSION */
-   439,  /* (453) noarg_func ::= SERVER_VERSION */
-   439,  /* (454) noarg_func ::= SERVER_STATUS */
-   439,  /* (455) noarg_func ::= CURRENT_USER */
-   439,  /* (456) noarg_func ::= USER */
-   437,  /* (457) star_func ::= COUNT */
-   437,  /* (458) star_func ::= FIRST */
-   437,  /* (459) star_func ::= LAST */
-   437,  /* (460) star_func ::= LAST_ROW */
-   438,  /* (461) star_func_para_list ::= NK_STAR */
-   438,  /* (462) star_func_para_list ::= other_para_list */
-   440,  /* (463) other_para_list ::= star_func_para */
-   440,  /* (464) other_para_list ::= other_para_list NK_COMMA star_func_para */
-   441,  /* (465) star_func_para ::= expr_or_subquery */
-   441,  /* (466) star_func_para ::= table_name NK_DOT NK_STAR */
-   436,  /* (467) case_when_expression ::= CASE when_then_list case_when_else_opt END */
-   436,  /* (468) case_when_expression ::= CASE common_expression when_then_list case_when_else_opt END */
-   442,  /* (469) when_then_list ::= when_then_expr */
-   442,  /* (470) when_then_list ::= when_then_list when_then_expr */
-   445,  /* (471) when_then_expr ::= WHEN common_expression THEN common_expression */
-   443,  /* (472) case_when_else_opt ::= */
-   443,  /* (473) case_when_else_opt ::= ELSE common_expression */
-   446,  /* (474) predicate ::= expr_or_subquery compare_op expr_or_subquery */
-   446,  /* (475) predicate ::= expr_or_subquery BETWEEN expr_or_subquery AND expr_or_subquery */
-   446,  /* (476) predicate ::= expr_or_subquery NOT BETWEEN expr_or_subquery AND expr_or_subquery */
-   446,  /* (477) predicate ::= expr_or_subquery IS NULL */
-   446,  /* (478) predicate ::= expr_or_subquery IS NOT NULL */
-   446,  /* (479) predicate ::= expr_or_subquery in_op in_predicate_value */
-   447,  /* (480) compare_op ::= NK_LT */
-   447,  /* (481) compare_op ::= NK_GT */
-   447,  /* (482) compare_op ::= NK_LE */
-   447,  /* (483) compare_op ::= NK_GE */
-   447,  /* (484) compare_op ::= NK_NE */
-   447,  /* (485) compare_op ::= NK_EQ */
-   447,  /* (486) compare_op ::= LIKE */
-   447,  /* (487) compare_op ::= NOT LIKE */
-   447,  /* (488) compare_op ::= MATCH */
-   447,  /* (489) compare_op ::= NMATCH */
-   447,  /* (490) compare_op ::= CONTAINS */
-   448,  /* (491) in_op ::= IN */
-   448,  /* (492) in_op ::= NOT IN */
-   449,  /* (493) in_predicate_value ::= NK_LP literal_list NK_RP */
-   450,  /* (494) boolean_value_expression ::= boolean_primary */
-   450,  /* (495) boolean_value_expression ::= NOT boolean_primary */
-   450,  /* (496) boolean_value_expression ::= boolean_value_expression OR boolean_value_expression */
-   450,  /* (497) boolean_value_expression ::= boolean_value_expression AND boolean_value_expression */
-   451,  /* (498) boolean_primary ::= predicate */
-   451,  /* (499) boolean_primary ::= NK_LP boolean_value_expression NK_RP */
-   444,  /* (500) common_expression ::= expr_or_subquery */
-   444,  /* (501) common_expression ::= boolean_value_expression */
-   452,  /* (502) from_clause_opt ::= */
-   452,  /* (503) from_clause_opt ::= FROM table_reference_list */
-   453,  /* (504) table_reference_list ::= table_reference */
-   453,  /* (505) table_reference_list ::= table_reference_list NK_COMMA table_reference */
-   454,  /* (506) table_reference ::= table_primary */
-   454,  /* (507) table_reference ::= joined_table */
-   455,  /* (508) table_primary ::= table_name alias_opt */
-   455,  /* (509) table_primary ::= db_name NK_DOT table_name alias_opt */
-   455,  /* (510) table_primary ::= subquery alias_opt */
-   455,  /* (511) table_primary ::= parenthesized_joined_table */
-   457,  /* (512) alias_opt ::= */
-   457,  /* (513) alias_opt ::= table_alias */
-   457,  /* (514) alias_opt ::= AS table_alias */
-   459,  /* (515) parenthesized_joined_table ::= NK_LP joined_table NK_RP */
-   459,  /* (516) parenthesized_joined_table ::= NK_LP parenthesized_joined_table NK_RP */
-   456,  /* (517) joined_table ::= table_reference join_type JOIN table_reference ON search_condition */
-   460,  /* (518) join_type ::= */
-   460,  /* (519) join_type ::= INNER */
-   461,  /* (520) query_specification ::= SELECT set_quantifier_opt select_list from_clause_opt where_clause_opt partition_by_clause_opt range_opt every_opt fill_opt twindow_clause_opt group_by_clause_opt having_clause_opt */
-   462,  /* (521) set_quantifier_opt ::= */
-   462,  /* (522) set_quantifier_opt ::= DISTINCT */
-   462,  /* (523) set_quantifier_opt ::= ALL */
-   463,  /* (524) select_list ::= select_item */
-   463,  /* (525) select_list ::= select_list NK_COMMA select_item */
-   471,  /* (526) select_item ::= NK_STAR */
-   471,  /* (527) select_item ::= common_expression */
-   471,  /* (528) select_item ::= common_expression column_alias */
-   471,  /* (529) select_item ::= common_expression AS column_alias */
-   471,  /* (530) select_item ::= table_name NK_DOT NK_STAR */
-   412,  /* (531) where_clause_opt ::= */
-   412,  /* (532) where_clause_opt ::= WHERE search_condition */
-   464,  /* (533) partition_by_clause_opt ::= */
-   464,  /* (534) partition_by_clause_opt ::= PARTITION BY partition_list */
-   472,  /* (535) partition_list ::= partition_item */
-   472,  /* (536) partition_list ::= partition_list NK_COMMA partition_item */
-   473,  /* (537) partition_item ::= expr_or_subquery */
-   473,  /* (538) partition_item ::= expr_or_subquery column_alias */
-   473,  /* (539) partition_item ::= expr_or_subquery AS column_alias */
-   468,  /* (540) twindow_clause_opt ::= */
-   468,  /* (541) twindow_clause_opt ::= SESSION NK_LP column_reference NK_COMMA duration_literal NK_RP */
-   468,  /* (542) twindow_clause_opt ::= STATE_WINDOW NK_LP expr_or_subquery NK_RP */
-   468,  /* (543) twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_RP sliding_opt fill_opt */
-   468,  /* (544) twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_COMMA duration_literal NK_RP sliding_opt fill_opt */
-   468,  /* (545) twindow_clause_opt ::= EVENT_WINDOW START WITH search_condition END WITH search_condition */
-   406,  /* (546) sliding_opt ::= */
-   406,  /* (547) sliding_opt ::= SLIDING NK_LP duration_literal NK_RP */
-   467,  /* (548) fill_opt ::= */
-   467,  /* (549) fill_opt ::= FILL NK_LP fill_mode NK_RP */
-   467,  /* (550) fill_opt ::= FILL NK_LP VALUE NK_COMMA expression_list NK_RP */
-   467,  /* (551) fill_opt ::= FILL NK_LP VALUE_F NK_COMMA expression_list NK_RP */
-   474,  /* (552) fill_mode ::= NONE */
-   474,  /* (553) fill_mode ::= PREV */
-   474,  /* (554) fill_mode ::= NULL */
-   474,  /* (555) fill_mode ::= NULL_F */
-   474,  /* (556) fill_mode ::= LINEAR */
-   474,  /* (557) fill_mode ::= NEXT */
-   469,  /* (558) group_by_clause_opt ::= */
-   469,  /* (559) group_by_clause_opt ::= GROUP BY group_by_list */
-   475,  /* (560) group_by_list ::= expr_or_subquery */
-   475,  /* (561) group_by_list ::= group_by_list NK_COMMA expr_or_subquery */
-   470,  /* (562) having_clause_opt ::= */
-   470,  /* (563) having_clause_opt ::= HAVING search_condition */
-   465,  /* (564) range_opt ::= */
-   465,  /* (565) range_opt ::= RANGE NK_LP expr_or_subquery NK_COMMA expr_or_subquery NK_RP */
-   465,  /* (566) range_opt ::= RANGE NK_LP expr_or_subquery NK_RP */
-   466,  /* (567) every_opt ::= */
-   466,  /* (568) every_opt ::= EVERY NK_LP duration_literal NK_RP */
-   476,  /* (569) query_expression ::= query_simple order_by_clause_opt slimit_clause_opt limit_clause_opt */
-   477,  /* (570) query_simple ::= query_specification */
-   477,  /* (571) query_simple ::= union_query_expression */
-   481,  /* (572) union_query_expression ::= query_simple_or_subquery UNION ALL query_simple_or_subquery */
-   481,  /* (573) union_query_expression ::= query_simple_or_subquery UNION query_simple_or_subquery */
-   482,  /* (574) query_simple_or_subquery ::= query_simple */
-   482,  /* (575) query_simple_or_subquery ::= subquery */
-   411,  /* (576) query_or_subquery ::= query_expression */
-   411,  /* (577) query_or_subquery ::= subquery */
-   478,  /* (578) order_by_clause_opt ::= */
-   478,  /* (579) order_by_clause_opt ::= ORDER BY sort_specification_list */
-   479,  /* (580) slimit_clause_opt ::= */
-   479,  /* (581) slimit_clause_opt ::= SLIMIT NK_INTEGER */
-   479,  /* (582) slimit_clause_opt ::= SLIMIT NK_INTEGER SOFFSET NK_INTEGER */
-   479,  /* (583) slimit_clause_opt ::= SLIMIT NK_INTEGER NK_COMMA NK_INTEGER */
-   480,  /* (584) limit_clause_opt ::= */
-   480,  /* (585) limit_clause_opt ::= LIMIT NK_INTEGER */
-   480,  /* (586) limit_clause_opt ::= LIMIT NK_INTEGER OFFSET NK_INTEGER */
-   480,  /* (587) limit_clause_opt ::= LIMIT NK_INTEGER NK_COMMA NK_INTEGER */
-   458,  /* (588) subquery ::= NK_LP query_expression NK_RP */
-   458,  /* (589) subquery ::= NK_LP subquery NK_RP */
-   353,  /* (590) search_condition ::= common_expression */
-   483,  /* (591) sort_specification_list ::= sort_specification */
-   483,  /* (592) sort_specification_list ::= sort_specification_list NK_COMMA sort_specification */
-   484,  /* (593) sort_specification ::= expr_or_subquery ordering_specification_opt null_ordering_opt */
-   485,  /* (594) ordering_specification_opt ::= */
-   485,  /* (595) ordering_specification_opt ::= ASC */
-   485,  /* (596) ordering_specification_opt ::= DESC */
-   486,  /* (597) null_ordering_opt ::= */
-   486,  /* (598) null_ordering_opt ::= NULLS FIRST */
-   486,  /* (599) null_ordering_opt ::= NULLS LAST */
+   340,  /* (0) cmd ::= CREATE ACCOUNT NK_ID PASS NK_STRING account_options */
+   340,  /* (1) cmd ::= ALTER ACCOUNT NK_ID alter_account_options */
+   341,  /* (2) account_options ::= */
+   341,  /* (3) account_options ::= account_options PPS literal */
+   341,  /* (4) account_options ::= account_options TSERIES literal */
+   341,  /* (5) account_options ::= account_options STORAGE literal */
+   341,  /* (6) account_options ::= account_options STREAMS literal */
+   341,  /* (7) account_options ::= account_options QTIME literal */
+   341,  /* (8) account_options ::= account_options DBS literal */
+   341,  /* (9) account_options ::= account_options USERS literal */
+   341,  /* (10) account_options ::= account_options CONNS literal */
+   341,  /* (11) account_options ::= account_options STATE literal */
+   342,  /* (12) alter_account_options ::= alter_account_option */
+   342,  /* (13) alter_account_options ::= alter_account_options alter_account_option */
+   344,  /* (14) alter_account_option ::= PASS literal */
+   344,  /* (15) alter_account_option ::= PPS literal */
+   344,  /* (16) alter_account_option ::= TSERIES literal */
+   344,  /* (17) alter_account_option ::= STORAGE literal */
+   344,  /* (18) alter_account_option ::= STREAMS literal */
+   344,  /* (19) alter_account_option ::= QTIME literal */
+   344,  /* (20) alter_account_option ::= DBS literal */
+   344,  /* (21) alter_account_option ::= USERS literal */
+   344,  /* (22) alter_account_option ::= CONNS literal */
+   344,  /* (23) alter_account_option ::= STATE literal */
+   340,  /* (24) cmd ::= CREATE USER user_name PASS NK_STRING sysinfo_opt */
+   340,  /* (25) cmd ::= ALTER USER user_name PASS NK_STRING */
+   340,  /* (26) cmd ::= ALTER USER user_name ENABLE NK_INTEGER */
+   340,  /* (27) cmd ::= ALTER USER user_name SYSINFO NK_INTEGER */
+   340,  /* (28) cmd ::= DROP USER user_name */
+   346,  /* (29) sysinfo_opt ::= */
+   346,  /* (30) sysinfo_opt ::= SYSINFO NK_INTEGER */
+   340,  /* (31) cmd ::= GRANT privileges ON priv_level with_opt TO user_name */
+   340,  /* (32) cmd ::= REVOKE privileges ON priv_level with_opt FROM user_name */
+   347,  /* (33) privileges ::= ALL */
+   347,  /* (34) privileges ::= priv_type_list */
+   347,  /* (35) privileges ::= SUBSCRIBE */
+   350,  /* (36) priv_type_list ::= priv_type */
+   350,  /* (37) priv_type_list ::= priv_type_list NK_COMMA priv_type */
+   351,  /* (38) priv_type ::= READ */
+   351,  /* (39) priv_type ::= WRITE */
+   348,  /* (40) priv_level ::= NK_STAR NK_DOT NK_STAR */
+   348,  /* (41) priv_level ::= db_name NK_DOT NK_STAR */
+   348,  /* (42) priv_level ::= db_name NK_DOT table_name */
+   348,  /* (43) priv_level ::= topic_name */
+   349,  /* (44) with_opt ::= */
+   349,  /* (45) with_opt ::= WITH search_condition */
+   340,  /* (46) cmd ::= CREATE DNODE dnode_endpoint */
+   340,  /* (47) cmd ::= CREATE DNODE dnode_endpoint PORT NK_INTEGER */
+   340,  /* (48) cmd ::= DROP DNODE NK_INTEGER force_opt */
+   340,  /* (49) cmd ::= DROP DNODE dnode_endpoint force_opt */
+   340,  /* (50) cmd ::= DROP DNODE NK_INTEGER unsafe_opt */
+   340,  /* (51) cmd ::= DROP DNODE dnode_endpoint unsafe_opt */
+   340,  /* (52) cmd ::= ALTER DNODE NK_INTEGER NK_STRING */
+   340,  /* (53) cmd ::= ALTER DNODE NK_INTEGER NK_STRING NK_STRING */
+   340,  /* (54) cmd ::= ALTER ALL DNODES NK_STRING */
+   340,  /* (55) cmd ::= ALTER ALL DNODES NK_STRING NK_STRING */
+   340,  /* (56) cmd ::= RESTORE DNODE NK_INTEGER */
+   356,  /* (57) dnode_endpoint ::= NK_STRING */
+   356,  /* (58) dnode_endpoint ::= NK_ID */
+   356,  /* (59) dnode_endpoint ::= NK_IPTOKEN */
+   357,  /* (60) force_opt ::= */
+   357,  /* (61) force_opt ::= FORCE */
+   358,  /* (62) unsafe_opt ::= UNSAFE */
+   340,  /* (63) cmd ::= ALTER LOCAL NK_STRING */
+   340,  /* (64) cmd ::= ALTER LOCAL NK_STRING NK_STRING */
+   340,  /* (65) cmd ::= CREATE QNODE ON DNODE NK_INTEGER */
+   340,  /* (66) cmd ::= DROP QNODE ON DNODE NK_INTEGER */
+   340,  /* (67) cmd ::= RESTORE QNODE ON DNODE NK_INTEGER */
+   340,  /* (68) cmd ::= CREATE BNODE ON DNODE NK_INTEGER */
+   340,  /* (69) cmd ::= DROP BNODE ON DNODE NK_INTEGER */
+   340,  /* (70) cmd ::= CREATE SNODE ON DNODE NK_INTEGER */
+   340,  /* (71) cmd ::= DROP SNODE ON DNODE NK_INTEGER */
+   340,  /* (72) cmd ::= CREATE MNODE ON DNODE NK_INTEGER */
+   340,  /* (73) cmd ::= DROP MNODE ON DNODE NK_INTEGER */
+   340,  /* (74) cmd ::= RESTORE MNODE ON DNODE NK_INTEGER */
+   340,  /* (75) cmd ::= RESTORE VNODE ON DNODE NK_INTEGER */
+   340,  /* (76) cmd ::= CREATE DATABASE not_exists_opt db_name db_options */
+   340,  /* (77) cmd ::= DROP DATABASE exists_opt db_name */
+   340,  /* (78) cmd ::= USE db_name */
+   340,  /* (79) cmd ::= ALTER DATABASE db_name alter_db_options */
+   340,  /* (80) cmd ::= FLUSH DATABASE db_name */
+   340,  /* (81) cmd ::= TRIM DATABASE db_name speed_opt */
+   340,  /* (82) cmd ::= COMPACT DATABASE db_name start_opt end_opt */
+   359,  /* (83) not_exists_opt ::= IF NOT EXISTS */
+   359,  /* (84) not_exists_opt ::= */
+   361,  /* (85) exists_opt ::= IF EXISTS */
+   361,  /* (86) exists_opt ::= */
+   360,  /* (87) db_options ::= */
+   360,  /* (88) db_options ::= db_options BUFFER NK_INTEGER */
+   360,  /* (89) db_options ::= db_options CACHEMODEL NK_STRING */
+   360,  /* (90) db_options ::= db_options CACHESIZE NK_INTEGER */
+   360,  /* (91) db_options ::= db_options COMP NK_INTEGER */
+   360,  /* (92) db_options ::= db_options DURATION NK_INTEGER */
+   360,  /* (93) db_options ::= db_options DURATION NK_VARIABLE */
+   360,  /* (94) db_options ::= db_options MAXROWS NK_INTEGER */
+   360,  /* (95) db_options ::= db_options MINROWS NK_INTEGER */
+   360,  /* (96) db_options ::= db_options KEEP integer_list */
+   360,  /* (97) db_options ::= db_options KEEP variable_list */
+   360,  /* (98) db_options ::= db_options PAGES NK_INTEGER */
+   360,  /* (99) db_options ::= db_options PAGESIZE NK_INTEGER */
+   360,  /* (100) db_options ::= db_options TSDB_PAGESIZE NK_INTEGER */
+   360,  /* (101) db_options ::= db_options PRECISION NK_STRING */
+   360,  /* (102) db_options ::= db_options REPLICA NK_INTEGER */
+   360,  /* (103) db_options ::= db_options VGROUPS NK_INTEGER */
+   360,  /* (104) db_options ::= db_options SINGLE_STABLE NK_INTEGER */
+   360,  /* (105) db_options ::= db_options RETENTIONS retention_list */
+   360,  /* (106) db_options ::= db_options SCHEMALESS NK_INTEGER */
+   360,  /* (107) db_options ::= db_options WAL_LEVEL NK_INTEGER */
+   360,  /* (108) db_options ::= db_options WAL_FSYNC_PERIOD NK_INTEGER */
+   360,  /* (109) db_options ::= db_options WAL_RETENTION_PERIOD NK_INTEGER */
+   360,  /* (110) db_options ::= db_options WAL_RETENTION_PERIOD NK_MINUS NK_INTEGER */
+   360,  /* (111) db_options ::= db_options WAL_RETENTION_SIZE NK_INTEGER */
+   360,  /* (112) db_options ::= db_options WAL_RETENTION_SIZE NK_MINUS NK_INTEGER */
+   360,  /* (113) db_options ::= db_options WAL_ROLL_PERIOD NK_INTEGER */
+   360,  /* (114) db_options ::= db_options WAL_SEGMENT_SIZE NK_INTEGER */
+   360,  /* (115) db_options ::= db_options STT_TRIGGER NK_INTEGER */
+   360,  /* (116) db_options ::= db_options TABLE_PREFIX signed */
+   360,  /* (117) db_options ::= db_options TABLE_SUFFIX signed */
+   362,  /* (118) alter_db_options ::= alter_db_option */
+   362,  /* (119) alter_db_options ::= alter_db_options alter_db_option */
+   370,  /* (120) alter_db_option ::= BUFFER NK_INTEGER */
+   370,  /* (121) alter_db_option ::= CACHEMODEL NK_STRING */
+   370,  /* (122) alter_db_option ::= CACHESIZE NK_INTEGER */
+   370,  /* (123) alter_db_option ::= WAL_FSYNC_PERIOD NK_INTEGER */
+   370,  /* (124) alter_db_option ::= KEEP integer_list */
+   370,  /* (125) alter_db_option ::= KEEP variable_list */
+   370,  /* (126) alter_db_option ::= PAGES NK_INTEGER */
+   370,  /* (127) alter_db_option ::= REPLICA NK_INTEGER */
+   370,  /* (128) alter_db_option ::= WAL_LEVEL NK_INTEGER */
+   370,  /* (129) alter_db_option ::= STT_TRIGGER NK_INTEGER */
+   370,  /* (130) alter_db_option ::= MINROWS NK_INTEGER */
+   370,  /* (131) alter_db_option ::= WAL_RETENTION_PERIOD NK_INTEGER */
+   370,  /* (132) alter_db_option ::= WAL_RETENTION_PERIOD NK_MINUS NK_INTEGER */
+   370,  /* (133) alter_db_option ::= WAL_RETENTION_SIZE NK_INTEGER */
+   370,  /* (134) alter_db_option ::= WAL_RETENTION_SIZE NK_MINUS NK_INTEGER */
+   366,  /* (135) integer_list ::= NK_INTEGER */
+   366,  /* (136) integer_list ::= integer_list NK_COMMA NK_INTEGER */
+   367,  /* (137) variable_list ::= NK_VARIABLE */
+   367,  /* (138) variable_list ::= variable_list NK_COMMA NK_VARIABLE */
+   368,  /* (139) retention_list ::= retention */
+   368,  /* (140) retention_list ::= retention_list NK_COMMA retention */
+   371,  /* (141) retention ::= NK_VARIABLE NK_COLON NK_VARIABLE */
+   363,  /* (142) speed_opt ::= */
+   363,  /* (143) speed_opt ::= MAX_SPEED NK_INTEGER */
+   364,  /* (144) start_opt ::= */
+   364,  /* (145) start_opt ::= START WITH NK_INTEGER */
+   364,  /* (146) start_opt ::= START WITH NK_STRING */
+   364,  /* (147) start_opt ::= START WITH TIMESTAMP NK_STRING */
+   365,  /* (148) end_opt ::= */
+   365,  /* (149) end_opt ::= END WITH NK_INTEGER */
+   365,  /* (150) end_opt ::= END WITH NK_STRING */
+   365,  /* (151) end_opt ::= END WITH TIMESTAMP NK_STRING */
+   340,  /* (152) cmd ::= CREATE TABLE not_exists_opt full_table_name NK_LP column_def_list NK_RP tags_def_opt table_options */
+   340,  /* (153) cmd ::= CREATE TABLE multi_create_clause */
+   340,  /* (154) cmd ::= CREATE STABLE not_exists_opt full_table_name NK_LP column_def_list NK_RP tags_def table_options */
+   340,  /* (155) cmd ::= DROP TABLE multi_drop_clause */
+   340,  /* (156) cmd ::= DROP STABLE exists_opt full_table_name */
+   340,  /* (157) cmd ::= ALTER TABLE alter_table_clause */
+   340,  /* (158) cmd ::= ALTER STABLE alter_table_clause */
+   379,  /* (159) alter_table_clause ::= full_table_name alter_table_options */
+   379,  /* (160) alter_table_clause ::= full_table_name ADD COLUMN column_name type_name */
+   379,  /* (161) alter_table_clause ::= full_table_name DROP COLUMN column_name */
+   379,  /* (162) alter_table_clause ::= full_table_name MODIFY COLUMN column_name type_name */
+   379,  /* (163) alter_table_clause ::= full_table_name RENAME COLUMN column_name column_name */
+   379,  /* (164) alter_table_clause ::= full_table_name ADD TAG column_name type_name */
+   379,  /* (165) alter_table_clause ::= full_table_name DROP TAG column_name */
+   379,  /* (166) alter_table_clause ::= full_table_name MODIFY TAG column_name type_name */
+   379,  /* (167) alter_table_clause ::= full_table_name RENAME TAG column_name column_name */
+   379,  /* (168) alter_table_clause ::= full_table_name SET TAG column_name NK_EQ signed_literal */
+   376,  /* (169) multi_create_clause ::= create_subtable_clause */
+   376,  /* (170) multi_create_clause ::= multi_create_clause create_subtable_clause */
+   384,  /* (171) create_subtable_clause ::= not_exists_opt full_table_name USING full_table_name specific_cols_opt TAGS NK_LP expression_list NK_RP table_options */
+   378,  /* (172) multi_drop_clause ::= drop_table_clause */
+   378,  /* (173) multi_drop_clause ::= multi_drop_clause NK_COMMA drop_table_clause */
+   387,  /* (174) drop_table_clause ::= exists_opt full_table_name */
+   385,  /* (175) specific_cols_opt ::= */
+   385,  /* (176) specific_cols_opt ::= NK_LP col_name_list NK_RP */
+   372,  /* (177) full_table_name ::= table_name */
+   372,  /* (178) full_table_name ::= db_name NK_DOT table_name */
+   373,  /* (179) column_def_list ::= column_def */
+   373,  /* (180) column_def_list ::= column_def_list NK_COMMA column_def */
+   389,  /* (181) column_def ::= column_name type_name */
+   382,  /* (182) type_name ::= BOOL */
+   382,  /* (183) type_name ::= TINYINT */
+   382,  /* (184) type_name ::= SMALLINT */
+   382,  /* (185) type_name ::= INT */
+   382,  /* (186) type_name ::= INTEGER */
+   382,  /* (187) type_name ::= BIGINT */
+   382,  /* (188) type_name ::= FLOAT */
+   382,  /* (189) type_name ::= DOUBLE */
+   382,  /* (190) type_name ::= BINARY NK_LP NK_INTEGER NK_RP */
+   382,  /* (191) type_name ::= TIMESTAMP */
+   382,  /* (192) type_name ::= NCHAR NK_LP NK_INTEGER NK_RP */
+   382,  /* (193) type_name ::= TINYINT UNSIGNED */
+   382,  /* (194) type_name ::= SMALLINT UNSIGNED */
+   382,  /* (195) type_name ::= INT UNSIGNED */
+   382,  /* (196) type_name ::= BIGINT UNSIGNED */
+   382,  /* (197) type_name ::= JSON */
+   382,  /* (198) type_name ::= VARCHAR NK_LP NK_INTEGER NK_RP */
+   382,  /* (199) type_name ::= MEDIUMBLOB */
+   382,  /* (200) type_name ::= BLOB */
+   382,  /* (201) type_name ::= VARBINARY NK_LP NK_INTEGER NK_RP */
+   382,  /* (202) type_name ::= GEOMETRY NK_LP NK_INTEGER NK_RP */
+   382,  /* (203) type_name ::= DECIMAL */
+   382,  /* (204) type_name ::= DECIMAL NK_LP NK_INTEGER NK_RP */
+   382,  /* (205) type_name ::= DECIMAL NK_LP NK_INTEGER NK_COMMA NK_INTEGER NK_RP */
+   374,  /* (206) tags_def_opt ::= */
+   374,  /* (207) tags_def_opt ::= tags_def */
+   377,  /* (208) tags_def ::= TAGS NK_LP column_def_list NK_RP */
+   375,  /* (209) table_options ::= */
+   375,  /* (210) table_options ::= table_options COMMENT NK_STRING */
+   375,  /* (211) table_options ::= table_options MAX_DELAY duration_list */
+   375,  /* (212) table_options ::= table_options WATERMARK duration_list */
+   375,  /* (213) table_options ::= table_options ROLLUP NK_LP rollup_func_list NK_RP */
+   375,  /* (214) table_options ::= table_options TTL NK_INTEGER */
+   375,  /* (215) table_options ::= table_options SMA NK_LP col_name_list NK_RP */
+   375,  /* (216) table_options ::= table_options DELETE_MARK duration_list */
+   380,  /* (217) alter_table_options ::= alter_table_option */
+   380,  /* (218) alter_table_options ::= alter_table_options alter_table_option */
+   392,  /* (219) alter_table_option ::= COMMENT NK_STRING */
+   392,  /* (220) alter_table_option ::= TTL NK_INTEGER */
+   390,  /* (221) duration_list ::= duration_literal */
+   390,  /* (222) duration_list ::= duration_list NK_COMMA duration_literal */
+   391,  /* (223) rollup_func_list ::= rollup_func_name */
+   391,  /* (224) rollup_func_list ::= rollup_func_list NK_COMMA rollup_func_name */
+   394,  /* (225) rollup_func_name ::= function_name */
+   394,  /* (226) rollup_func_name ::= FIRST */
+   394,  /* (227) rollup_func_name ::= LAST */
+   388,  /* (228) col_name_list ::= col_name */
+   388,  /* (229) col_name_list ::= col_name_list NK_COMMA col_name */
+   396,  /* (230) col_name ::= column_name */
+   340,  /* (231) cmd ::= SHOW DNODES */
+   340,  /* (232) cmd ::= SHOW USERS */
+   340,  /* (233) cmd ::= SHOW USER PRIVILEGES */
+   340,  /* (234) cmd ::= SHOW DATABASES */
+   340,  /* (235) cmd ::= SHOW db_name_cond_opt TABLES like_pattern_opt */
+   340,  /* (236) cmd ::= SHOW db_name_cond_opt STABLES like_pattern_opt */
+   340,  /* (237) cmd ::= SHOW db_name_cond_opt VGROUPS */
+   340,  /* (238) cmd ::= SHOW MNODES */
+   340,  /* (239) cmd ::= SHOW QNODES */
+   340,  /* (240) cmd ::= SHOW FUNCTIONS */
+   340,  /* (241) cmd ::= SHOW INDEXES FROM table_name_cond from_db_opt */
+   340,  /* (242) cmd ::= SHOW INDEXES FROM db_name NK_DOT table_name */
+   340,  /* (243) cmd ::= SHOW STREAMS */
+   340,  /* (244) cmd ::= SHOW ACCOUNTS */
+   340,  /* (245) cmd ::= SHOW APPS */
+   340,  /* (246) cmd ::= SHOW CONNECTIONS */
+   340,  /* (247) cmd ::= SHOW LICENCES */
+   340,  /* (248) cmd ::= SHOW GRANTS */
+   340,  /* (249) cmd ::= SHOW CREATE DATABASE db_name */
+   340,  /* (250) cmd ::= SHOW CREATE TABLE full_table_name */
+   340,  /* (251) cmd ::= SHOW CREATE STABLE full_table_name */
+   340,  /* (252) cmd ::= SHOW QUERIES */
+   340,  /* (253) cmd ::= SHOW SCORES */
+   340,  /* (254) cmd ::= SHOW TOPICS */
+   340,  /* (255) cmd ::= SHOW VARIABLES */
+   340,  /* (256) cmd ::= SHOW CLUSTER VARIABLES */
+   340,  /* (257) cmd ::= SHOW LOCAL VARIABLES */
+   340,  /* (258) cmd ::= SHOW DNODE NK_INTEGER VARIABLES like_pattern_opt */
+   340,  /* (259) cmd ::= SHOW BNODES */
+   340,  /* (260) cmd ::= SHOW SNODES */
+   340,  /* (261) cmd ::= SHOW CLUSTER */
+   340,  /* (262) cmd ::= SHOW TRANSACTIONS */
+   340,  /* (263) cmd ::= SHOW TABLE DISTRIBUTED full_table_name */
+   340,  /* (264) cmd ::= SHOW CONSUMERS */
+   340,  /* (265) cmd ::= SHOW SUBSCRIPTIONS */
+   340,  /* (266) cmd ::= SHOW TAGS FROM table_name_cond from_db_opt */
+   340,  /* (267) cmd ::= SHOW TAGS FROM db_name NK_DOT table_name */
+   340,  /* (268) cmd ::= SHOW TABLE TAGS tag_list_opt FROM table_name_cond from_db_opt */
+   340,  /* (269) cmd ::= SHOW TABLE TAGS tag_list_opt FROM db_name NK_DOT table_name */
+   340,  /* (270) cmd ::= SHOW VNODES NK_INTEGER */
+   340,  /* (271) cmd ::= SHOW VNODES NK_STRING */
+   340,  /* (272) cmd ::= SHOW db_name_cond_opt ALIVE */
+   340,  /* (273) cmd ::= SHOW CLUSTER ALIVE */
+   397,  /* (274) db_name_cond_opt ::= */
+   397,  /* (275) db_name_cond_opt ::= db_name NK_DOT */
+   398,  /* (276) like_pattern_opt ::= */
+   398,  /* (277) like_pattern_opt ::= LIKE NK_STRING */
+   399,  /* (278) table_name_cond ::= table_name */
+   400,  /* (279) from_db_opt ::= */
+   400,  /* (280) from_db_opt ::= FROM db_name */
+   401,  /* (281) tag_list_opt ::= */
+   401,  /* (282) tag_list_opt ::= tag_item */
+   401,  /* (283) tag_list_opt ::= tag_list_opt NK_COMMA tag_item */
+   402,  /* (284) tag_item ::= TBNAME */
+   402,  /* (285) tag_item ::= QTAGS */
+   402,  /* (286) tag_item ::= column_name */
+   402,  /* (287) tag_item ::= column_name column_alias */
+   402,  /* (288) tag_item ::= column_name AS column_alias */
+   340,  /* (289) cmd ::= CREATE SMA INDEX not_exists_opt full_index_name ON full_table_name index_options */
+   340,  /* (290) cmd ::= CREATE INDEX not_exists_opt full_index_name ON full_table_name NK_LP col_name_list NK_RP */
+   340,  /* (291) cmd ::= DROP INDEX exists_opt full_index_name */
+   404,  /* (292) full_index_name ::= index_name */
+   404,  /* (293) full_index_name ::= db_name NK_DOT index_name */
+   405,  /* (294) index_options ::= FUNCTION NK_LP func_list NK_RP INTERVAL NK_LP duration_literal NK_RP sliding_opt sma_stream_opt */
+   405,  /* (295) index_options ::= FUNCTION NK_LP func_list NK_RP INTERVAL NK_LP duration_literal NK_COMMA duration_literal NK_RP sliding_opt sma_stream_opt */
+   407,  /* (296) func_list ::= func */
+   407,  /* (297) func_list ::= func_list NK_COMMA func */
+   410,  /* (298) func ::= sma_func_name NK_LP expression_list NK_RP */
+   411,  /* (299) sma_func_name ::= function_name */
+   411,  /* (300) sma_func_name ::= COUNT */
+   411,  /* (301) sma_func_name ::= FIRST */
+   411,  /* (302) sma_func_name ::= LAST */
+   411,  /* (303) sma_func_name ::= LAST_ROW */
+   409,  /* (304) sma_stream_opt ::= */
+   409,  /* (305) sma_stream_opt ::= sma_stream_opt WATERMARK duration_literal */
+   409,  /* (306) sma_stream_opt ::= sma_stream_opt MAX_DELAY duration_literal */
+   409,  /* (307) sma_stream_opt ::= sma_stream_opt DELETE_MARK duration_literal */
+   412,  /* (308) with_meta ::= AS */
+   412,  /* (309) with_meta ::= WITH META AS */
+   412,  /* (310) with_meta ::= ONLY META AS */
+   340,  /* (311) cmd ::= CREATE TOPIC not_exists_opt topic_name AS query_or_subquery */
+   340,  /* (312) cmd ::= CREATE TOPIC not_exists_opt topic_name with_meta DATABASE db_name */
+   340,  /* (313) cmd ::= CREATE TOPIC not_exists_opt topic_name with_meta STABLE full_table_name where_clause_opt */
+   340,  /* (314) cmd ::= DROP TOPIC exists_opt topic_name */
+   340,  /* (315) cmd ::= DROP CONSUMER GROUP exists_opt cgroup_name ON topic_name */
+   340,  /* (316) cmd ::= DESC full_table_name */
+   340,  /* (317) cmd ::= DESCRIBE full_table_name */
+   340,  /* (318) cmd ::= RESET QUERY CACHE */
+   340,  /* (319) cmd ::= EXPLAIN analyze_opt explain_options query_or_subquery */
+   340,  /* (320) cmd ::= EXPLAIN analyze_opt explain_options insert_query */
+   416,  /* (321) analyze_opt ::= */
+   416,  /* (322) analyze_opt ::= ANALYZE */
+   417,  /* (323) explain_options ::= */
+   417,  /* (324) explain_options ::= explain_options VERBOSE NK_BOOL */
+   417,  /* (325) explain_options ::= explain_options RATIO NK_FLOAT */
+   340,  /* (326) cmd ::= CREATE or_replace_opt agg_func_opt FUNCTION not_exists_opt function_name AS NK_STRING OUTPUTTYPE type_name bufsize_opt language_opt */
+   340,  /* (327) cmd ::= DROP FUNCTION exists_opt function_name */
+   420,  /* (328) agg_func_opt ::= */
+   420,  /* (329) agg_func_opt ::= AGGREGATE */
+   421,  /* (330) bufsize_opt ::= */
+   421,  /* (331) bufsize_opt ::= BUFSIZE NK_INTEGER */
+   422,  /* (332) language_opt ::= */
+   422,  /* (333) language_opt ::= LANGUAGE NK_STRING */
+   419,  /* (334) or_replace_opt ::= */
+   419,  /* (335) or_replace_opt ::= OR REPLACE */
+   340,  /* (336) cmd ::= CREATE STREAM not_exists_opt stream_name stream_options INTO full_table_name col_list_opt tag_def_or_ref_opt subtable_opt AS query_or_subquery */
+   340,  /* (337) cmd ::= DROP STREAM exists_opt stream_name */
+   340,  /* (338) cmd ::= PAUSE STREAM exists_opt stream_name */
+   340,  /* (339) cmd ::= RESUME STREAM exists_opt ignore_opt stream_name */
+   425,  /* (340) col_list_opt ::= */
+   425,  /* (341) col_list_opt ::= NK_LP col_name_list NK_RP */
+   426,  /* (342) tag_def_or_ref_opt ::= */
+   426,  /* (343) tag_def_or_ref_opt ::= tags_def */
+   426,  /* (344) tag_def_or_ref_opt ::= TAGS NK_LP col_name_list NK_RP */
+   424,  /* (345) stream_options ::= */
+   424,  /* (346) stream_options ::= stream_options TRIGGER AT_ONCE */
+   424,  /* (347) stream_options ::= stream_options TRIGGER WINDOW_CLOSE */
+   424,  /* (348) stream_options ::= stream_options TRIGGER MAX_DELAY duration_literal */
+   424,  /* (349) stream_options ::= stream_options WATERMARK duration_literal */
+   424,  /* (350) stream_options ::= stream_options IGNORE EXPIRED NK_INTEGER */
+   424,  /* (351) stream_options ::= stream_options FILL_HISTORY NK_INTEGER */
+   424,  /* (352) stream_options ::= stream_options DELETE_MARK duration_literal */
+   424,  /* (353) stream_options ::= stream_options IGNORE UPDATE NK_INTEGER */
+   427,  /* (354) subtable_opt ::= */
+   427,  /* (355) subtable_opt ::= SUBTABLE NK_LP expression NK_RP */
+   428,  /* (356) ignore_opt ::= */
+   428,  /* (357) ignore_opt ::= IGNORE UNTREATED */
+   340,  /* (358) cmd ::= KILL CONNECTION NK_INTEGER */
+   340,  /* (359) cmd ::= KILL QUERY NK_STRING */
+   340,  /* (360) cmd ::= KILL TRANSACTION NK_INTEGER */
+   340,  /* (361) cmd ::= BALANCE VGROUP */
+   340,  /* (362) cmd ::= BALANCE VGROUP LEADER */
+   340,  /* (363) cmd ::= MERGE VGROUP NK_INTEGER NK_INTEGER */
+   340,  /* (364) cmd ::= REDISTRIBUTE VGROUP NK_INTEGER dnode_list */
+   340,  /* (365) cmd ::= SPLIT VGROUP NK_INTEGER */
+   430,  /* (366) dnode_list ::= DNODE NK_INTEGER */
+   430,  /* (367) dnode_list ::= dnode_list DNODE NK_INTEGER */
+   340,  /* (368) cmd ::= DELETE FROM full_table_name where_clause_opt */
+   340,  /* (369) cmd ::= query_or_subquery */
+   340,  /* (370) cmd ::= insert_query */
+   418,  /* (371) insert_query ::= INSERT INTO full_table_name NK_LP col_name_list NK_RP query_or_subquery */
+   418,  /* (372) insert_query ::= INSERT INTO full_table_name query_or_subquery */
+   343,  /* (373) literal ::= NK_INTEGER */
+   343,  /* (374) literal ::= NK_FLOAT */
+   343,  /* (375) literal ::= NK_STRING */
+   343,  /* (376) literal ::= NK_BOOL */
+   343,  /* (377) literal ::= TIMESTAMP NK_STRING */
+   343,  /* (378) literal ::= duration_literal */
+   343,  /* (379) literal ::= NULL */
+   343,  /* (380) literal ::= NK_QUESTION */
+   393,  /* (381) duration_literal ::= NK_VARIABLE */
+   369,  /* (382) signed ::= NK_INTEGER */
+   369,  /* (383) signed ::= NK_PLUS NK_INTEGER */
+   369,  /* (384) signed ::= NK_MINUS NK_INTEGER */
+   369,  /* (385) signed ::= NK_FLOAT */
+   369,  /* (386) signed ::= NK_PLUS NK_FLOAT */
+   369,  /* (387) signed ::= NK_MINUS NK_FLOAT */
+   383,  /* (388) signed_literal ::= signed */
+   383,  /* (389) signed_literal ::= NK_STRING */
+   383,  /* (390) signed_literal ::= NK_BOOL */
+   383,  /* (391) signed_literal ::= TIMESTAMP NK_STRING */
+   383,  /* (392) signed_literal ::= duration_literal */
+   383,  /* (393) signed_literal ::= NULL */
+   383,  /* (394) signed_literal ::= literal_func */
+   383,  /* (395) signed_literal ::= NK_QUESTION */
+   432,  /* (396) literal_list ::= signed_literal */
+   432,  /* (397) literal_list ::= literal_list NK_COMMA signed_literal */
+   352,  /* (398) db_name ::= NK_ID */
+   353,  /* (399) table_name ::= NK_ID */
+   381,  /* (400) column_name ::= NK_ID */
+   395,  /* (401) function_name ::= NK_ID */
+   433,  /* (402) table_alias ::= NK_ID */
+   403,  /* (403) column_alias ::= NK_ID */
+   345,  /* (404) user_name ::= NK_ID */
+   354,  /* (405) topic_name ::= NK_ID */
+   423,  /* (406) stream_name ::= NK_ID */
+   415,  /* (407) cgroup_name ::= NK_ID */
+   406,  /* (408) index_name ::= NK_ID */
+   434,  /* (409) expr_or_subquery ::= expression */
+   429,  /* (410) expression ::= literal */
+   429,  /* (411) expression ::= pseudo_column */
+   429,  /* (412) expression ::= column_reference */
+   429,  /* (413) expression ::= function_expression */
+   429,  /* (414) expression ::= case_when_expression */
+   429,  /* (415) expression ::= NK_LP expression NK_RP */
+   429,  /* (416) expression ::= NK_PLUS expr_or_subquery */
+   429,  /* (417) expression ::= NK_MINUS expr_or_subquery */
+   429,  /* (418) expression ::= expr_or_subquery NK_PLUS expr_or_subquery */
+   429,  /* (419) expression ::= expr_or_subquery NK_MINUS expr_or_subquery */
+   429,  /* (420) expression ::= expr_or_subquery NK_STAR expr_or_subquery */
+   429,  /* (421) expression ::= expr_or_subquery NK_SLASH expr_or_subquery */
+   429,  /* (422) expression ::= expr_or_subquery NK_REM expr_or_subquery */
+   429,  /* (423) expression ::= column_reference NK_ARROW NK_STRING */
+   429,  /* (424) expression ::= expr_or_subquery NK_BITAND expr_or_subquery */
+   429,  /* (425) expression ::= expr_or_subquery NK_BITOR expr_or_subquery */
+   386,  /* (426) expression_list ::= expr_or_subquery */
+   386,  /* (427) expression_list ::= expression_list NK_COMMA expr_or_subquery */
+   436,  /* (428) column_reference ::= column_name */
+   436,  /* (429) column_reference ::= table_name NK_DOT column_name */
+   435,  /* (430) pseudo_column ::= ROWTS */
+   435,  /* (431) pseudo_column ::= TBNAME */
+   435,  /* (432) pseudo_column ::= table_name NK_DOT TBNAME */
+   435,  /* (433) pseudo_column ::= QSTART */
+   435,  /* (434) pseudo_column ::= QEND */
+   435,  /* (435) pseudo_column ::= QDURATION */
+   435,  /* (436) pseudo_column ::= WSTART */
+   435,  /* (437) pseudo_column ::= WEND */
+   435,  /* (438) pseudo_column ::= WDURATION */
+   435,  /* (439) pseudo_column ::= IROWTS */
+   435,  /* (440) pseudo_column ::= ISFILLED */
+   435,  /* (441) pseudo_column ::= QTAGS */
+   437,  /* (442) function_expression ::= function_name NK_LP expression_list NK_RP */
+   437,  /* (443) function_expression ::= star_func NK_LP star_func_para_list NK_RP */
+   437,  /* (444) function_expression ::= CAST NK_LP expr_or_subquery AS type_name NK_RP */
+   437,  /* (445) function_expression ::= literal_func */
+   431,  /* (446) literal_func ::= noarg_func NK_LP NK_RP */
+   431,  /* (447) literal_func ::= NOW */
+   441,  /* (448) noarg_func ::= NOW */
+   441,  /* (449) noarg_func ::= TODAY */
+   441,  /* (450) noarg_func ::= TIMEZONE */
+   441,  /* (451) noarg_func ::= DATABASE */
+   441,  /* (452) noarg_func ::= CLIENT_VERSION */
+   441,  /* (453) noarg_func ::= SERVER_VERSION */
+   441,  /* (454) noarg_func ::= SERVER_STATUS */
+   441,  /* (455) noarg_func ::= CURRENT_USER */
+   441,  /* (456) noarg_func ::= USER */
+   439,  /* (457) star_func ::= COUNT */
+   439,  /* (458) star_func ::= FIRST */
+   439,  /* (459) star_func ::= LAST */
+   439,  /* (460) star_func ::= LAST_ROW */
+   440,  /* (461) star_func_para_list ::= NK_STAR */
+   440,  /* (462) star_func_para_list ::= other_para_list */
+   442,  /* (463) other_para_list ::= star_func_para */
+   442,  /* (464) other_para_list ::= other_para_list NK_COMMA star_func_para */
+   443,  /* (465) star_func_para ::= expr_or_subquery */
+   443,  /* (466) star_func_para ::= table_name NK_DOT NK_STAR */
+   438,  /* (467) case_when_expression ::= CASE when_then_list case_when_else_opt END */
+   438,  /* (468) case_when_expression ::= CASE common_expression when_then_list case_when_else_opt END */
+   444,  /* (469) when_then_list ::= when_then_expr */
+   444,  /* (470) when_then_list ::= when_then_list when_then_expr */
+   447,  /* (471) when_then_expr ::= WHEN common_expression THEN common_expression */
+   445,  /* (472) case_when_else_opt ::= */
+   445,  /* (473) case_when_else_opt ::= ELSE common_expression */
+   448,  /* (474) predicate ::= expr_or_subquery compare_op expr_or_subquery */
+   448,  /* (475) predicate ::= expr_or_subquery BETWEEN expr_or_subquery AND expr_or_subquery */
+   448,  /* (476) predicate ::= expr_or_subquery NOT BETWEEN expr_or_subquery AND expr_or_subquery */
+   448,  /* (477) predicate ::= expr_or_subquery IS NULL */
+   448,  /* (478) predicate ::= expr_or_subquery IS NOT NULL */
+   448,  /* (479) predicate ::= expr_or_subquery in_op in_predicate_value */
+   449,  /* (480) compare_op ::= NK_LT */
+   449,  /* (481) compare_op ::= NK_GT */
+   449,  /* (482) compare_op ::= NK_LE */
+   449,  /* (483) compare_op ::= NK_GE */
+   449,  /* (484) compare_op ::= NK_NE */
+   449,  /* (485) compare_op ::= NK_EQ */
+   449,  /* (486) compare_op ::= LIKE */
+   449,  /* (487) compare_op ::= NOT LIKE */
+   449,  /* (488) compare_op ::= MATCH */
+   449,  /* (489) compare_op ::= NMATCH */
+   449,  /* (490) compare_op ::= CONTAINS */
+   450,  /* (491) in_op ::= IN */
+   450,  /* (492) in_op ::= NOT IN */
+   451,  /* (493) in_predicate_value ::= NK_LP literal_list NK_RP */
+   452,  /* (494) boolean_value_expression ::= boolean_primary */
+   452,  /* (495) boolean_value_expression ::= NOT boolean_primary */
+   452,  /* (496) boolean_value_expression ::= boolean_value_expression OR boolean_value_expression */
+   452,  /* (497) boolean_value_expression ::= boolean_value_expression AND boolean_value_expression */
+   453,  /* (498) boolean_primary ::= predicate */
+   453,  /* (499) boolean_primary ::= NK_LP boolean_value_expression NK_RP */
+   446,  /* (500) common_expression ::= expr_or_subquery */
+   446,  /* (501) common_expression ::= boolean_value_expression */
+   454,  /* (502) from_clause_opt ::= */
+   454,  /* (503) from_clause_opt ::= FROM table_reference_list */
+   455,  /* (504) table_reference_list ::= table_reference */
+   455,  /* (505) table_reference_list ::= table_reference_list NK_COMMA table_reference */
+   456,  /* (506) table_reference ::= table_primary */
+   456,  /* (507) table_reference ::= joined_table */
+   457,  /* (508) table_primary ::= table_name alias_opt */
+   457,  /* (509) table_primary ::= db_name NK_DOT table_name alias_opt */
+   457,  /* (510) table_primary ::= subquery alias_opt */
+   457,  /* (511) table_primary ::= parenthesized_joined_table */
+   459,  /* (512) alias_opt ::= */
+   459,  /* (513) alias_opt ::= table_alias */
+   459,  /* (514) alias_opt ::= AS table_alias */
+   461,  /* (515) parenthesized_joined_table ::= NK_LP joined_table NK_RP */
+   461,  /* (516) parenthesized_joined_table ::= NK_LP parenthesized_joined_table NK_RP */
+   458,  /* (517) joined_table ::= table_reference join_type JOIN table_reference ON search_condition */
+   462,  /* (518) join_type ::= */
+   462,  /* (519) join_type ::= INNER */
+   462,  /* (520) join_type ::= LEFT */
+   462,  /* (521) join_type ::= LEFT OUTER */
+   463,  /* (522) query_specification ::= SELECT set_quantifier_opt select_list from_clause_opt where_clause_opt partition_by_clause_opt range_opt every_opt fill_opt twindow_clause_opt group_by_clause_opt having_clause_opt */
+   464,  /* (523) set_quantifier_opt ::= */
+   464,  /* (524) set_quantifier_opt ::= DISTINCT */
+   464,  /* (525) set_quantifier_opt ::= ALL */
+   465,  /* (526) select_list ::= select_item */
+   465,  /* (527) select_list ::= select_list NK_COMMA select_item */
+   473,  /* (528) select_item ::= NK_STAR */
+   473,  /* (529) select_item ::= common_expression */
+   473,  /* (530) select_item ::= common_expression column_alias */
+   473,  /* (531) select_item ::= common_expression AS column_alias */
+   473,  /* (532) select_item ::= table_name NK_DOT NK_STAR */
+   414,  /* (533) where_clause_opt ::= */
+   414,  /* (534) where_clause_opt ::= WHERE search_condition */
+   466,  /* (535) partition_by_clause_opt ::= */
+   466,  /* (536) partition_by_clause_opt ::= PARTITION BY partition_list */
+   474,  /* (537) partition_list ::= partition_item */
+   474,  /* (538) partition_list ::= partition_list NK_COMMA partition_item */
+   475,  /* (539) partition_item ::= expr_or_subquery */
+   475,  /* (540) partition_item ::= expr_or_subquery column_alias */
+   475,  /* (541) partition_item ::= expr_or_subquery AS column_alias */
+   470,  /* (542) twindow_clause_opt ::= */
+   470,  /* (543) twindow_clause_opt ::= SESSION NK_LP column_reference NK_COMMA duration_literal NK_RP */
+   470,  /* (544) twindow_clause_opt ::= STATE_WINDOW NK_LP expr_or_subquery NK_RP */
+   470,  /* (545) twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_RP sliding_opt fill_opt */
+   470,  /* (546) twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_COMMA duration_literal NK_RP sliding_opt fill_opt */
+   470,  /* (547) twindow_clause_opt ::= EVENT_WINDOW START WITH search_condition END WITH search_condition */
+   408,  /* (548) sliding_opt ::= */
+   408,  /* (549) sliding_opt ::= SLIDING NK_LP duration_literal NK_RP */
+   469,  /* (550) fill_opt ::= */
+   469,  /* (551) fill_opt ::= FILL NK_LP fill_mode NK_RP */
+   469,  /* (552) fill_opt ::= FILL NK_LP VALUE NK_COMMA expression_list NK_RP */
+   469,  /* (553) fill_opt ::= FILL NK_LP VALUE_F NK_COMMA expression_list NK_RP */
+   476,  /* (554) fill_mode ::= NONE */
+   476,  /* (555) fill_mode ::= PREV */
+   476,  /* (556) fill_mode ::= NULL */
+   476,  /* (557) fill_mode ::= NULL_F */
+   476,  /* (558) fill_mode ::= LINEAR */
+   476,  /* (559) fill_mode ::= NEXT */
+   471,  /* (560) group_by_clause_opt ::= */
+   471,  /* (561) group_by_clause_opt ::= GROUP BY group_by_list */
+   477,  /* (562) group_by_list ::= expr_or_subquery */
+   477,  /* (563) group_by_list ::= group_by_list NK_COMMA expr_or_subquery */
+   472,  /* (564) having_clause_opt ::= */
+   472,  /* (565) having_clause_opt ::= HAVING search_condition */
+   467,  /* (566) range_opt ::= */
+   467,  /* (567) range_opt ::= RANGE NK_LP expr_or_subquery NK_COMMA expr_or_subquery NK_RP */
+   467,  /* (568) range_opt ::= RANGE NK_LP expr_or_subquery NK_RP */
+   468,  /* (569) every_opt ::= */
+   468,  /* (570) every_opt ::= EVERY NK_LP duration_literal NK_RP */
+   478,  /* (571) query_expression ::= query_simple order_by_clause_opt slimit_clause_opt limit_clause_opt */
+   479,  /* (572) query_simple ::= query_specification */
+   479,  /* (573) query_simple ::= union_query_expression */
+   483,  /* (574) union_query_expression ::= query_simple_or_subquery UNION ALL query_simple_or_subquery */
+   483,  /* (575) union_query_expression ::= query_simple_or_subquery UNION query_simple_or_subquery */
+   484,  /* (576) query_simple_or_subquery ::= query_simple */
+   484,  /* (577) query_simple_or_subquery ::= subquery */
+   413,  /* (578) query_or_subquery ::= query_expression */
+   413,  /* (579) query_or_subquery ::= subquery */
+   480,  /* (580) order_by_clause_opt ::= */
+   480,  /* (581) order_by_clause_opt ::= ORDER BY sort_specification_list */
+   481,  /* (582) slimit_clause_opt ::= */
+   481,  /* (583) slimit_clause_opt ::= SLIMIT NK_INTEGER */
+   481,  /* (584) slimit_clause_opt ::= SLIMIT NK_INTEGER SOFFSET NK_INTEGER */
+   481,  /* (585) slimit_clause_opt ::= SLIMIT NK_INTEGER NK_COMMA NK_INTEGER */
+   482,  /* (586) limit_clause_opt ::= */
+   482,  /* (587) limit_clause_opt ::= LIMIT NK_INTEGER */
+   482,  /* (588) limit_clause_opt ::= LIMIT NK_INTEGER OFFSET NK_INTEGER */
+   482,  /* (589) limit_clause_opt ::= LIMIT NK_INTEGER NK_COMMA NK_INTEGER */
+   460,  /* (590) subquery ::= NK_LP query_expression NK_RP */
+   460,  /* (591) subquery ::= NK_LP subquery NK_RP */
+   355,  /* (592) search_condition ::= common_expression */
+   485,  /* (593) sort_specification_list ::= sort_specification */
+   485,  /* (594) sort_specification_list ::= sort_specification_list NK_COMMA sort_specification */
+   486,  /* (595) sort_specification ::= expr_or_subquery ordering_specification_opt null_ordering_opt */
+   487,  /* (596) ordering_specification_opt ::= */
+   487,  /* (597) ordering_specification_opt ::= ASC */
+   487,  /* (598) ordering_specification_opt ::= DESC */
+   488,  /* (599) null_ordering_opt ::= */
+   488,  /* (600) null_ordering_opt ::= NULLS FIRST */
+   488,  /* (601) null_ordering_opt ::= NULLS LAST */
 };
 
 /* For rule J, yyRuleInfoNRhs[J] contains the negative of the number
@@ -4317,86 +4321,88 @@ static const signed char yyRuleInfoNRhs[] = {
    -6,  /* (517) joined_table ::= table_reference join_type JOIN table_reference ON search_condition */
     0,  /* (518) join_type ::= */
    -1,  /* (519) join_type ::= INNER */
-  -12,  /* (520) query_specification ::= SELECT set_quantifier_opt select_list from_clause_opt where_clause_opt partition_by_clause_opt range_opt every_opt fill_opt twindow_clause_opt group_by_clause_opt having_clause_opt */
-    0,  /* (521) set_quantifier_opt ::= */
-   -1,  /* (522) set_quantifier_opt ::= DISTINCT */
-   -1,  /* (523) set_quantifier_opt ::= ALL */
-   -1,  /* (524) select_list ::= select_item */
-   -3,  /* (525) select_list ::= select_list NK_COMMA select_item */
-   -1,  /* (526) select_item ::= NK_STAR */
-   -1,  /* (527) select_item ::= common_expression */
-   -2,  /* (528) select_item ::= common_expression column_alias */
-   -3,  /* (529) select_item ::= common_expression AS column_alias */
-   -3,  /* (530) select_item ::= table_name NK_DOT NK_STAR */
-    0,  /* (531) where_clause_opt ::= */
-   -2,  /* (532) where_clause_opt ::= WHERE search_condition */
-    0,  /* (533) partition_by_clause_opt ::= */
-   -3,  /* (534) partition_by_clause_opt ::= PARTITION BY partition_list */
-   -1,  /* (535) partition_list ::= partition_item */
-   -3,  /* (536) partition_list ::= partition_list NK_COMMA partition_item */
-   -1,  /* (537) partition_item ::= expr_or_subquery */
-   -2,  /* (538) partition_item ::= expr_or_subquery column_alias */
-   -3,  /* (539) partition_item ::= expr_or_subquery AS column_alias */
-    0,  /* (540) twindow_clause_opt ::= */
-   -6,  /* (541) twindow_clause_opt ::= SESSION NK_LP column_reference NK_COMMA duration_literal NK_RP */
-   -4,  /* (542) twindow_clause_opt ::= STATE_WINDOW NK_LP expr_or_subquery NK_RP */
-   -6,  /* (543) twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_RP sliding_opt fill_opt */
-   -8,  /* (544) twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_COMMA duration_literal NK_RP sliding_opt fill_opt */
-   -7,  /* (545) twindow_clause_opt ::= EVENT_WINDOW START WITH search_condition END WITH search_condition */
-    0,  /* (546) sliding_opt ::= */
-   -4,  /* (547) sliding_opt ::= SLIDING NK_LP duration_literal NK_RP */
-    0,  /* (548) fill_opt ::= */
-   -4,  /* (549) fill_opt ::= FILL NK_LP fill_mode NK_RP */
-   -6,  /* (550) fill_opt ::= FILL NK_LP VALUE NK_COMMA expression_list NK_RP */
-   -6,  /* (551) fill_opt ::= FILL NK_LP VALUE_F NK_COMMA expression_list NK_RP */
-   -1,  /* (552) fill_mode ::= NONE */
-   -1,  /* (553) fill_mode ::= PREV */
-   -1,  /* (554) fill_mode ::= NULL */
-   -1,  /* (555) fill_mode ::= NULL_F */
-   -1,  /* (556) fill_mode ::= LINEAR */
-   -1,  /* (557) fill_mode ::= NEXT */
-    0,  /* (558) group_by_clause_opt ::= */
-   -3,  /* (559) group_by_clause_opt ::= GROUP BY group_by_list */
-   -1,  /* (560) group_by_list ::= expr_or_subquery */
-   -3,  /* (561) group_by_list ::= group_by_list NK_COMMA expr_or_subquery */
-    0,  /* (562) having_clause_opt ::= */
-   -2,  /* (563) having_clause_opt ::= HAVING search_condition */
-    0,  /* (564) range_opt ::= */
-   -6,  /* (565) range_opt ::= RANGE NK_LP expr_or_subquery NK_COMMA expr_or_subquery NK_RP */
-   -4,  /* (566) range_opt ::= RANGE NK_LP expr_or_subquery NK_RP */
-    0,  /* (567) every_opt ::= */
-   -4,  /* (568) every_opt ::= EVERY NK_LP duration_literal NK_RP */
-   -4,  /* (569) query_expression ::= query_simple order_by_clause_opt slimit_clause_opt limit_clause_opt */
-   -1,  /* (570) query_simple ::= query_specification */
-   -1,  /* (571) query_simple ::= union_query_expression */
-   -4,  /* (572) union_query_expression ::= query_simple_or_subquery UNION ALL query_simple_or_subquery */
-   -3,  /* (573) union_query_expression ::= query_simple_or_subquery UNION query_simple_or_subquery */
-   -1,  /* (574) query_simple_or_subquery ::= query_simple */
-   -1,  /* (575) query_simple_or_subquery ::= subquery */
-   -1,  /* (576) query_or_subquery ::= query_expression */
-   -1,  /* (577) query_or_subquery ::= subquery */
-    0,  /* (578) order_by_clause_opt ::= */
-   -3,  /* (579) order_by_clause_opt ::= ORDER BY sort_specification_list */
-    0,  /* (580) slimit_clause_opt ::= */
-   -2,  /* (581) slimit_clause_opt ::= SLIMIT NK_INTEGER */
-   -4,  /* (582) slimit_clause_opt ::= SLIMIT NK_INTEGER SOFFSET NK_INTEGER */
-   -4,  /* (583) slimit_clause_opt ::= SLIMIT NK_INTEGER NK_COMMA NK_INTEGER */
-    0,  /* (584) limit_clause_opt ::= */
-   -2,  /* (585) limit_clause_opt ::= LIMIT NK_INTEGER */
-   -4,  /* (586) limit_clause_opt ::= LIMIT NK_INTEGER OFFSET NK_INTEGER */
-   -4,  /* (587) limit_clause_opt ::= LIMIT NK_INTEGER NK_COMMA NK_INTEGER */
-   -3,  /* (588) subquery ::= NK_LP query_expression NK_RP */
-   -3,  /* (589) subquery ::= NK_LP subquery NK_RP */
-   -1,  /* (590) search_condition ::= common_expression */
-   -1,  /* (591) sort_specification_list ::= sort_specification */
-   -3,  /* (592) sort_specification_list ::= sort_specification_list NK_COMMA sort_specification */
-   -3,  /* (593) sort_specification ::= expr_or_subquery ordering_specification_opt null_ordering_opt */
-    0,  /* (594) ordering_specification_opt ::= */
-   -1,  /* (595) ordering_specification_opt ::= ASC */
-   -1,  /* (596) ordering_specification_opt ::= DESC */
-    0,  /* (597) null_ordering_opt ::= */
-   -2,  /* (598) null_ordering_opt ::= NULLS FIRST */
-   -2,  /* (599) null_ordering_opt ::= NULLS LAST */
+   -1,  /* (520) join_type ::= LEFT */
+   -2,  /* (521) join_type ::= LEFT OUTER */
+  -12,  /* (522) query_specification ::= SELECT set_quantifier_opt select_list from_clause_opt where_clause_opt partition_by_clause_opt range_opt every_opt fill_opt twindow_clause_opt group_by_clause_opt having_clause_opt */
+    0,  /* (523) set_quantifier_opt ::= */
+   -1,  /* (524) set_quantifier_opt ::= DISTINCT */
+   -1,  /* (525) set_quantifier_opt ::= ALL */
+   -1,  /* (526) select_list ::= select_item */
+   -3,  /* (527) select_list ::= select_list NK_COMMA select_item */
+   -1,  /* (528) select_item ::= NK_STAR */
+   -1,  /* (529) select_item ::= common_expression */
+   -2,  /* (530) select_item ::= common_expression column_alias */
+   -3,  /* (531) select_item ::= common_expression AS column_alias */
+   -3,  /* (532) select_item ::= table_name NK_DOT NK_STAR */
+    0,  /* (533) where_clause_opt ::= */
+   -2,  /* (534) where_clause_opt ::= WHERE search_condition */
+    0,  /* (535) partition_by_clause_opt ::= */
+   -3,  /* (536) partition_by_clause_opt ::= PARTITION BY partition_list */
+   -1,  /* (537) partition_list ::= partition_item */
+   -3,  /* (538) partition_list ::= partition_list NK_COMMA partition_item */
+   -1,  /* (539) partition_item ::= expr_or_subquery */
+   -2,  /* (540) partition_item ::= expr_or_subquery column_alias */
+   -3,  /* (541) partition_item ::= expr_or_subquery AS column_alias */
+    0,  /* (542) twindow_clause_opt ::= */
+   -6,  /* (543) twindow_clause_opt ::= SESSION NK_LP column_reference NK_COMMA duration_literal NK_RP */
+   -4,  /* (544) twindow_clause_opt ::= STATE_WINDOW NK_LP expr_or_subquery NK_RP */
+   -6,  /* (545) twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_RP sliding_opt fill_opt */
+   -8,  /* (546) twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_COMMA duration_literal NK_RP sliding_opt fill_opt */
+   -7,  /* (547) twindow_clause_opt ::= EVENT_WINDOW START WITH search_condition END WITH search_condition */
+    0,  /* (548) sliding_opt ::= */
+   -4,  /* (549) sliding_opt ::= SLIDING NK_LP duration_literal NK_RP */
+    0,  /* (550) fill_opt ::= */
+   -4,  /* (551) fill_opt ::= FILL NK_LP fill_mode NK_RP */
+   -6,  /* (552) fill_opt ::= FILL NK_LP VALUE NK_COMMA expression_list NK_RP */
+   -6,  /* (553) fill_opt ::= FILL NK_LP VALUE_F NK_COMMA expression_list NK_RP */
+   -1,  /* (554) fill_mode ::= NONE */
+   -1,  /* (555) fill_mode ::= PREV */
+   -1,  /* (556) fill_mode ::= NULL */
+   -1,  /* (557) fill_mode ::= NULL_F */
+   -1,  /* (558) fill_mode ::= LINEAR */
+   -1,  /* (559) fill_mode ::= NEXT */
+    0,  /* (560) group_by_clause_opt ::= */
+   -3,  /* (561) group_by_clause_opt ::= GROUP BY group_by_list */
+   -1,  /* (562) group_by_list ::= expr_or_subquery */
+   -3,  /* (563) group_by_list ::= group_by_list NK_COMMA expr_or_subquery */
+    0,  /* (564) having_clause_opt ::= */
+   -2,  /* (565) having_clause_opt ::= HAVING search_condition */
+    0,  /* (566) range_opt ::= */
+   -6,  /* (567) range_opt ::= RANGE NK_LP expr_or_subquery NK_COMMA expr_or_subquery NK_RP */
+   -4,  /* (568) range_opt ::= RANGE NK_LP expr_or_subquery NK_RP */
+    0,  /* (569) every_opt ::= */
+   -4,  /* (570) every_opt ::= EVERY NK_LP duration_literal NK_RP */
+   -4,  /* (571) query_expression ::= query_simple order_by_clause_opt slimit_clause_opt limit_clause_opt */
+   -1,  /* (572) query_simple ::= query_specification */
+   -1,  /* (573) query_simple ::= union_query_expression */
+   -4,  /* (574) union_query_expression ::= query_simple_or_subquery UNION ALL query_simple_or_subquery */
+   -3,  /* (575) union_query_expression ::= query_simple_or_subquery UNION query_simple_or_subquery */
+   -1,  /* (576) query_simple_or_subquery ::= query_simple */
+   -1,  /* (577) query_simple_or_subquery ::= subquery */
+   -1,  /* (578) query_or_subquery ::= query_expression */
+   -1,  /* (579) query_or_subquery ::= subquery */
+    0,  /* (580) order_by_clause_opt ::= */
+   -3,  /* (581) order_by_clause_opt ::= ORDER BY sort_specification_list */
+    0,  /* (582) slimit_clause_opt ::= */
+   -2,  /* (583) slimit_clause_opt ::= SLIMIT NK_INTEGER */
+   -4,  /* (584) slimit_clause_opt ::= SLIMIT NK_INTEGER SOFFSET NK_INTEGER */
+   -4,  /* (585) slimit_clause_opt ::= SLIMIT NK_INTEGER NK_COMMA NK_INTEGER */
+    0,  /* (586) limit_clause_opt ::= */
+   -2,  /* (587) limit_clause_opt ::= LIMIT NK_INTEGER */
+   -4,  /* (588) limit_clause_opt ::= LIMIT NK_INTEGER OFFSET NK_INTEGER */
+   -4,  /* (589) limit_clause_opt ::= LIMIT NK_INTEGER NK_COMMA NK_INTEGER */
+   -3,  /* (590) subquery ::= NK_LP query_expression NK_RP */
+   -3,  /* (591) subquery ::= NK_LP subquery NK_RP */
+   -1,  /* (592) search_condition ::= common_expression */
+   -1,  /* (593) sort_specification_list ::= sort_specification */
+   -3,  /* (594) sort_specification_list ::= sort_specification_list NK_COMMA sort_specification */
+   -3,  /* (595) sort_specification ::= expr_or_subquery ordering_specification_opt null_ordering_opt */
+    0,  /* (596) ordering_specification_opt ::= */
+   -1,  /* (597) ordering_specification_opt ::= ASC */
+   -1,  /* (598) ordering_specification_opt ::= DESC */
+    0,  /* (599) null_ordering_opt ::= */
+   -2,  /* (600) null_ordering_opt ::= NULLS FIRST */
+   -2,  /* (601) null_ordering_opt ::= NULLS LAST */
 };
 
 static void yy_accept(yyParser*);  /* Forward Declaration */
@@ -4488,11 +4494,11 @@ static YYACTIONTYPE yy_reduce(
         YYMINORTYPE yylhsminor;
       case 0: /* cmd ::= CREATE ACCOUNT NK_ID PASS NK_STRING account_options */
 { pCxt->errCode = generateSyntaxErrMsg(&pCxt->msgBuf, TSDB_CODE_PAR_EXPRIE_STATEMENT); }
-  yy_destructor(yypParser,339,&yymsp[0].minor);
+  yy_destructor(yypParser,341,&yymsp[0].minor);
         break;
       case 1: /* cmd ::= ALTER ACCOUNT NK_ID alter_account_options */
 { pCxt->errCode = generateSyntaxErrMsg(&pCxt->msgBuf, TSDB_CODE_PAR_EXPRIE_STATEMENT); }
-  yy_destructor(yypParser,340,&yymsp[0].minor);
+  yy_destructor(yypParser,342,&yymsp[0].minor);
         break;
       case 2: /* account_options ::= */
 { }
@@ -4506,20 +4512,20 @@ static YYACTIONTYPE yy_reduce(
       case 9: /* account_options ::= account_options USERS literal */ yytestcase(yyruleno==9);
       case 10: /* account_options ::= account_options CONNS literal */ yytestcase(yyruleno==10);
       case 11: /* account_options ::= account_options STATE literal */ yytestcase(yyruleno==11);
-{  yy_destructor(yypParser,339,&yymsp[-2].minor);
+{  yy_destructor(yypParser,341,&yymsp[-2].minor);
 { }
-  yy_destructor(yypParser,341,&yymsp[0].minor);
+  yy_destructor(yypParser,343,&yymsp[0].minor);
 }
         break;
       case 12: /* alter_account_options ::= alter_account_option */
-{  yy_destructor(yypParser,342,&yymsp[0].minor);
+{  yy_destructor(yypParser,344,&yymsp[0].minor);
 { }
 }
         break;
       case 13: /* alter_account_options ::= alter_account_options alter_account_option */
-{  yy_destructor(yypParser,340,&yymsp[-1].minor);
+{  yy_destructor(yypParser,342,&yymsp[-1].minor);
 { }
-  yy_destructor(yypParser,342,&yymsp[0].minor);
+  yy_destructor(yypParser,344,&yymsp[0].minor);
 }
         break;
       case 14: /* alter_account_option ::= PASS literal */
@@ -4533,71 +4539,71 @@ static YYACTIONTYPE yy_reduce(
       case 22: /* alter_account_option ::= CONNS literal */ yytestcase(yyruleno==22);
       case 23: /* alter_account_option ::= STATE literal */ yytestcase(yyruleno==23);
 { }
-  yy_destructor(yypParser,341,&yymsp[0].minor);
+  yy_destructor(yypParser,343,&yymsp[0].minor);
         break;
       case 24: /* cmd ::= CREATE USER user_name PASS NK_STRING sysinfo_opt */
-{ pCxt->pRootNode = createCreateUserStmt(pCxt, &yymsp[-3].minor.yy371, &yymsp[-1].minor.yy0, yymsp[0].minor.yy475); }
+{ pCxt->pRootNode = createCreateUserStmt(pCxt, &yymsp[-3].minor.yy731, &yymsp[-1].minor.yy0, yymsp[0].minor.yy821); }
         break;
       case 25: /* cmd ::= ALTER USER user_name PASS NK_STRING */
-{ pCxt->pRootNode = createAlterUserStmt(pCxt, &yymsp[-2].minor.yy371, TSDB_ALTER_USER_PASSWD, &yymsp[0].minor.yy0); }
+{ pCxt->pRootNode = createAlterUserStmt(pCxt, &yymsp[-2].minor.yy731, TSDB_ALTER_USER_PASSWD, &yymsp[0].minor.yy0); }
         break;
       case 26: /* cmd ::= ALTER USER user_name ENABLE NK_INTEGER */
-{ pCxt->pRootNode = createAlterUserStmt(pCxt, &yymsp[-2].minor.yy371, TSDB_ALTER_USER_ENABLE, &yymsp[0].minor.yy0); }
+{ pCxt->pRootNode = createAlterUserStmt(pCxt, &yymsp[-2].minor.yy731, TSDB_ALTER_USER_ENABLE, &yymsp[0].minor.yy0); }
         break;
       case 27: /* cmd ::= ALTER USER user_name SYSINFO NK_INTEGER */
-{ pCxt->pRootNode = createAlterUserStmt(pCxt, &yymsp[-2].minor.yy371, TSDB_ALTER_USER_SYSINFO, &yymsp[0].minor.yy0); }
+{ pCxt->pRootNode = createAlterUserStmt(pCxt, &yymsp[-2].minor.yy731, TSDB_ALTER_USER_SYSINFO, &yymsp[0].minor.yy0); }
         break;
       case 28: /* cmd ::= DROP USER user_name */
-{ pCxt->pRootNode = createDropUserStmt(pCxt, &yymsp[0].minor.yy371); }
+{ pCxt->pRootNode = createDropUserStmt(pCxt, &yymsp[0].minor.yy731); }
         break;
       case 29: /* sysinfo_opt ::= */
-{ yymsp[1].minor.yy475 = 1; }
+{ yymsp[1].minor.yy821 = 1; }
         break;
       case 30: /* sysinfo_opt ::= SYSINFO NK_INTEGER */
-{ yymsp[-1].minor.yy475 = taosStr2Int8(yymsp[0].minor.yy0.z, NULL, 10); }
+{ yymsp[-1].minor.yy821 = taosStr2Int8(yymsp[0].minor.yy0.z, NULL, 10); }
         break;
       case 31: /* cmd ::= GRANT privileges ON priv_level with_opt TO user_name */
-{ pCxt->pRootNode = createGrantStmt(pCxt, yymsp[-5].minor.yy729, &yymsp[-3].minor.yy347, &yymsp[0].minor.yy371, yymsp[-2].minor.yy452); }
+{ pCxt->pRootNode = createGrantStmt(pCxt, yymsp[-5].minor.yy159, &yymsp[-3].minor.yy303, &yymsp[0].minor.yy731, yymsp[-2].minor.yy698); }
         break;
       case 32: /* cmd ::= REVOKE privileges ON priv_level with_opt FROM user_name */
-{ pCxt->pRootNode = createRevokeStmt(pCxt, yymsp[-5].minor.yy729, &yymsp[-3].minor.yy347, &yymsp[0].minor.yy371, yymsp[-2].minor.yy452); }
+{ pCxt->pRootNode = createRevokeStmt(pCxt, yymsp[-5].minor.yy159, &yymsp[-3].minor.yy303, &yymsp[0].minor.yy731, yymsp[-2].minor.yy698); }
         break;
       case 33: /* privileges ::= ALL */
-{ yymsp[0].minor.yy729 = PRIVILEGE_TYPE_ALL; }
+{ yymsp[0].minor.yy159 = PRIVILEGE_TYPE_ALL; }
         break;
       case 34: /* privileges ::= priv_type_list */
       case 36: /* priv_type_list ::= priv_type */ yytestcase(yyruleno==36);
-{ yylhsminor.yy729 = yymsp[0].minor.yy729; }
-  yymsp[0].minor.yy729 = yylhsminor.yy729;
+{ yylhsminor.yy159 = yymsp[0].minor.yy159; }
+  yymsp[0].minor.yy159 = yylhsminor.yy159;
         break;
       case 35: /* privileges ::= SUBSCRIBE */
-{ yymsp[0].minor.yy729 = PRIVILEGE_TYPE_SUBSCRIBE; }
+{ yymsp[0].minor.yy159 = PRIVILEGE_TYPE_SUBSCRIBE; }
         break;
       case 37: /* priv_type_list ::= priv_type_list NK_COMMA priv_type */
-{ yylhsminor.yy729 = yymsp[-2].minor.yy729 | yymsp[0].minor.yy729; }
-  yymsp[-2].minor.yy729 = yylhsminor.yy729;
+{ yylhsminor.yy159 = yymsp[-2].minor.yy159 | yymsp[0].minor.yy159; }
+  yymsp[-2].minor.yy159 = yylhsminor.yy159;
         break;
       case 38: /* priv_type ::= READ */
-{ yymsp[0].minor.yy729 = PRIVILEGE_TYPE_READ; }
+{ yymsp[0].minor.yy159 = PRIVILEGE_TYPE_READ; }
         break;
       case 39: /* priv_type ::= WRITE */
-{ yymsp[0].minor.yy729 = PRIVILEGE_TYPE_WRITE; }
+{ yymsp[0].minor.yy159 = PRIVILEGE_TYPE_WRITE; }
         break;
       case 40: /* priv_level ::= NK_STAR NK_DOT NK_STAR */
-{ yylhsminor.yy347.first = yymsp[-2].minor.yy0; yylhsminor.yy347.second = yymsp[0].minor.yy0; }
-  yymsp[-2].minor.yy347 = yylhsminor.yy347;
+{ yylhsminor.yy303.first = yymsp[-2].minor.yy0; yylhsminor.yy303.second = yymsp[0].minor.yy0; }
+  yymsp[-2].minor.yy303 = yylhsminor.yy303;
         break;
       case 41: /* priv_level ::= db_name NK_DOT NK_STAR */
-{ yylhsminor.yy347.first = yymsp[-2].minor.yy371; yylhsminor.yy347.second = yymsp[0].minor.yy0; }
-  yymsp[-2].minor.yy347 = yylhsminor.yy347;
+{ yylhsminor.yy303.first = yymsp[-2].minor.yy731; yylhsminor.yy303.second = yymsp[0].minor.yy0; }
+  yymsp[-2].minor.yy303 = yylhsminor.yy303;
         break;
       case 42: /* priv_level ::= db_name NK_DOT table_name */
-{ yylhsminor.yy347.first = yymsp[-2].minor.yy371; yylhsminor.yy347.second = yymsp[0].minor.yy371; }
-  yymsp[-2].minor.yy347 = yylhsminor.yy347;
+{ yylhsminor.yy303.first = yymsp[-2].minor.yy731; yylhsminor.yy303.second = yymsp[0].minor.yy731; }
+  yymsp[-2].minor.yy303 = yylhsminor.yy303;
         break;
       case 43: /* priv_level ::= topic_name */
-{ yylhsminor.yy347.first = yymsp[0].minor.yy371; yylhsminor.yy347.second = nil_token; }
-  yymsp[0].minor.yy347 = yylhsminor.yy347;
+{ yylhsminor.yy303.first = yymsp[0].minor.yy731; yylhsminor.yy303.second = nil_token; }
+  yymsp[0].minor.yy303 = yylhsminor.yy303;
         break;
       case 44: /* with_opt ::= */
       case 144: /* start_opt ::= */ yytestcase(yyruleno==144);
@@ -4606,40 +4612,40 @@ static YYACTIONTYPE yy_reduce(
       case 354: /* subtable_opt ::= */ yytestcase(yyruleno==354);
       case 472: /* case_when_else_opt ::= */ yytestcase(yyruleno==472);
       case 502: /* from_clause_opt ::= */ yytestcase(yyruleno==502);
-      case 531: /* where_clause_opt ::= */ yytestcase(yyruleno==531);
-      case 540: /* twindow_clause_opt ::= */ yytestcase(yyruleno==540);
-      case 546: /* sliding_opt ::= */ yytestcase(yyruleno==546);
-      case 548: /* fill_opt ::= */ yytestcase(yyruleno==548);
-      case 562: /* having_clause_opt ::= */ yytestcase(yyruleno==562);
-      case 564: /* range_opt ::= */ yytestcase(yyruleno==564);
-      case 567: /* every_opt ::= */ yytestcase(yyruleno==567);
-      case 580: /* slimit_clause_opt ::= */ yytestcase(yyruleno==580);
-      case 584: /* limit_clause_opt ::= */ yytestcase(yyruleno==584);
-{ yymsp[1].minor.yy452 = NULL; }
+      case 533: /* where_clause_opt ::= */ yytestcase(yyruleno==533);
+      case 542: /* twindow_clause_opt ::= */ yytestcase(yyruleno==542);
+      case 548: /* sliding_opt ::= */ yytestcase(yyruleno==548);
+      case 550: /* fill_opt ::= */ yytestcase(yyruleno==550);
+      case 564: /* having_clause_opt ::= */ yytestcase(yyruleno==564);
+      case 566: /* range_opt ::= */ yytestcase(yyruleno==566);
+      case 569: /* every_opt ::= */ yytestcase(yyruleno==569);
+      case 582: /* slimit_clause_opt ::= */ yytestcase(yyruleno==582);
+      case 586: /* limit_clause_opt ::= */ yytestcase(yyruleno==586);
+{ yymsp[1].minor.yy698 = NULL; }
         break;
       case 45: /* with_opt ::= WITH search_condition */
       case 503: /* from_clause_opt ::= FROM table_reference_list */ yytestcase(yyruleno==503);
-      case 532: /* where_clause_opt ::= WHERE search_condition */ yytestcase(yyruleno==532);
-      case 563: /* having_clause_opt ::= HAVING search_condition */ yytestcase(yyruleno==563);
-{ yymsp[-1].minor.yy452 = yymsp[0].minor.yy452; }
+      case 534: /* where_clause_opt ::= WHERE search_condition */ yytestcase(yyruleno==534);
+      case 565: /* having_clause_opt ::= HAVING search_condition */ yytestcase(yyruleno==565);
+{ yymsp[-1].minor.yy698 = yymsp[0].minor.yy698; }
         break;
       case 46: /* cmd ::= CREATE DNODE dnode_endpoint */
-{ pCxt->pRootNode = createCreateDnodeStmt(pCxt, &yymsp[0].minor.yy371, NULL); }
+{ pCxt->pRootNode = createCreateDnodeStmt(pCxt, &yymsp[0].minor.yy731, NULL); }
         break;
       case 47: /* cmd ::= CREATE DNODE dnode_endpoint PORT NK_INTEGER */
-{ pCxt->pRootNode = createCreateDnodeStmt(pCxt, &yymsp[-2].minor.yy371, &yymsp[0].minor.yy0); }
+{ pCxt->pRootNode = createCreateDnodeStmt(pCxt, &yymsp[-2].minor.yy731, &yymsp[0].minor.yy0); }
         break;
       case 48: /* cmd ::= DROP DNODE NK_INTEGER force_opt */
-{ pCxt->pRootNode = createDropDnodeStmt(pCxt, &yymsp[-1].minor.yy0, yymsp[0].minor.yy667, false); }
+{ pCxt->pRootNode = createDropDnodeStmt(pCxt, &yymsp[-1].minor.yy0, yymsp[0].minor.yy83, false); }
         break;
       case 49: /* cmd ::= DROP DNODE dnode_endpoint force_opt */
-{ pCxt->pRootNode = createDropDnodeStmt(pCxt, &yymsp[-1].minor.yy371, yymsp[0].minor.yy667, false); }
+{ pCxt->pRootNode = createDropDnodeStmt(pCxt, &yymsp[-1].minor.yy731, yymsp[0].minor.yy83, false); }
         break;
       case 50: /* cmd ::= DROP DNODE NK_INTEGER unsafe_opt */
-{ pCxt->pRootNode = createDropDnodeStmt(pCxt, &yymsp[-1].minor.yy0, false, yymsp[0].minor.yy667); }
+{ pCxt->pRootNode = createDropDnodeStmt(pCxt, &yymsp[-1].minor.yy0, false, yymsp[0].minor.yy83); }
         break;
       case 51: /* cmd ::= DROP DNODE dnode_endpoint unsafe_opt */
-{ pCxt->pRootNode = createDropDnodeStmt(pCxt, &yymsp[-1].minor.yy371, false, yymsp[0].minor.yy667); }
+{ pCxt->pRootNode = createDropDnodeStmt(pCxt, &yymsp[-1].minor.yy731, false, yymsp[0].minor.yy83); }
         break;
       case 52: /* cmd ::= ALTER DNODE NK_INTEGER NK_STRING */
 { pCxt->pRootNode = createAlterDnodeStmt(pCxt, &yymsp[-1].minor.yy0, &yymsp[0].minor.yy0, NULL); }
@@ -4687,8 +4693,8 @@ static YYACTIONTYPE yy_reduce(
       case 458: /* star_func ::= FIRST */ yytestcase(yyruleno==458);
       case 459: /* star_func ::= LAST */ yytestcase(yyruleno==459);
       case 460: /* star_func ::= LAST_ROW */ yytestcase(yyruleno==460);
-{ yylhsminor.yy371 = yymsp[0].minor.yy0; }
-  yymsp[0].minor.yy371 = yylhsminor.yy371;
+{ yylhsminor.yy731 = yymsp[0].minor.yy0; }
+  yymsp[0].minor.yy731 = yylhsminor.yy731;
         break;
       case 60: /* force_opt ::= */
       case 84: /* not_exists_opt ::= */ yytestcase(yyruleno==84);
@@ -4697,15 +4703,15 @@ static YYACTIONTYPE yy_reduce(
       case 328: /* agg_func_opt ::= */ yytestcase(yyruleno==328);
       case 334: /* or_replace_opt ::= */ yytestcase(yyruleno==334);
       case 356: /* ignore_opt ::= */ yytestcase(yyruleno==356);
-      case 521: /* set_quantifier_opt ::= */ yytestcase(yyruleno==521);
-{ yymsp[1].minor.yy667 = false; }
+      case 523: /* set_quantifier_opt ::= */ yytestcase(yyruleno==523);
+{ yymsp[1].minor.yy83 = false; }
         break;
       case 61: /* force_opt ::= FORCE */
       case 62: /* unsafe_opt ::= UNSAFE */ yytestcase(yyruleno==62);
       case 322: /* analyze_opt ::= ANALYZE */ yytestcase(yyruleno==322);
       case 329: /* agg_func_opt ::= AGGREGATE */ yytestcase(yyruleno==329);
-      case 522: /* set_quantifier_opt ::= DISTINCT */ yytestcase(yyruleno==522);
-{ yymsp[0].minor.yy667 = true; }
+      case 524: /* set_quantifier_opt ::= DISTINCT */ yytestcase(yyruleno==524);
+{ yymsp[0].minor.yy83 = true; }
         break;
       case 63: /* cmd ::= ALTER LOCAL NK_STRING */
 { pCxt->pRootNode = createAlterLocalStmt(pCxt, &yymsp[0].minor.yy0, NULL); }
@@ -4747,234 +4753,234 @@ static YYACTIONTYPE yy_reduce(
 { pCxt->pRootNode = createRestoreComponentNodeStmt(pCxt, QUERY_NODE_RESTORE_VNODE_STMT, &yymsp[0].minor.yy0); }
         break;
       case 76: /* cmd ::= CREATE DATABASE not_exists_opt db_name db_options */
-{ pCxt->pRootNode = createCreateDatabaseStmt(pCxt, yymsp[-2].minor.yy667, &yymsp[-1].minor.yy371, yymsp[0].minor.yy452); }
+{ pCxt->pRootNode = createCreateDatabaseStmt(pCxt, yymsp[-2].minor.yy83, &yymsp[-1].minor.yy731, yymsp[0].minor.yy698); }
         break;
       case 77: /* cmd ::= DROP DATABASE exists_opt db_name */
-{ pCxt->pRootNode = createDropDatabaseStmt(pCxt, yymsp[-1].minor.yy667, &yymsp[0].minor.yy371); }
+{ pCxt->pRootNode = createDropDatabaseStmt(pCxt, yymsp[-1].minor.yy83, &yymsp[0].minor.yy731); }
         break;
       case 78: /* cmd ::= USE db_name */
-{ pCxt->pRootNode = createUseDatabaseStmt(pCxt, &yymsp[0].minor.yy371); }
+{ pCxt->pRootNode = createUseDatabaseStmt(pCxt, &yymsp[0].minor.yy731); }
         break;
       case 79: /* cmd ::= ALTER DATABASE db_name alter_db_options */
-{ pCxt->pRootNode = createAlterDatabaseStmt(pCxt, &yymsp[-1].minor.yy371, yymsp[0].minor.yy452); }
+{ pCxt->pRootNode = createAlterDatabaseStmt(pCxt, &yymsp[-1].minor.yy731, yymsp[0].minor.yy698); }
         break;
       case 80: /* cmd ::= FLUSH DATABASE db_name */
-{ pCxt->pRootNode = createFlushDatabaseStmt(pCxt, &yymsp[0].minor.yy371); }
+{ pCxt->pRootNode = createFlushDatabaseStmt(pCxt, &yymsp[0].minor.yy731); }
         break;
       case 81: /* cmd ::= TRIM DATABASE db_name speed_opt */
-{ pCxt->pRootNode = createTrimDatabaseStmt(pCxt, &yymsp[-1].minor.yy371, yymsp[0].minor.yy416); }
+{ pCxt->pRootNode = createTrimDatabaseStmt(pCxt, &yymsp[-1].minor.yy731, yymsp[0].minor.yy724); }
         break;
       case 82: /* cmd ::= COMPACT DATABASE db_name start_opt end_opt */
-{ pCxt->pRootNode = createCompactStmt(pCxt, &yymsp[-2].minor.yy371, yymsp[-1].minor.yy452, yymsp[0].minor.yy452); }
+{ pCxt->pRootNode = createCompactStmt(pCxt, &yymsp[-2].minor.yy731, yymsp[-1].minor.yy698, yymsp[0].minor.yy698); }
         break;
       case 83: /* not_exists_opt ::= IF NOT EXISTS */
-{ yymsp[-2].minor.yy667 = true; }
+{ yymsp[-2].minor.yy83 = true; }
         break;
       case 85: /* exists_opt ::= IF EXISTS */
       case 335: /* or_replace_opt ::= OR REPLACE */ yytestcase(yyruleno==335);
       case 357: /* ignore_opt ::= IGNORE UNTREATED */ yytestcase(yyruleno==357);
-{ yymsp[-1].minor.yy667 = true; }
+{ yymsp[-1].minor.yy83 = true; }
         break;
       case 87: /* db_options ::= */
-{ yymsp[1].minor.yy452 = createDefaultDatabaseOptions(pCxt); }
+{ yymsp[1].minor.yy698 = createDefaultDatabaseOptions(pCxt); }
         break;
       case 88: /* db_options ::= db_options BUFFER NK_INTEGER */
-{ yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-2].minor.yy452, DB_OPTION_BUFFER, &yymsp[0].minor.yy0); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-2].minor.yy698, DB_OPTION_BUFFER, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 89: /* db_options ::= db_options CACHEMODEL NK_STRING */
-{ yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-2].minor.yy452, DB_OPTION_CACHEMODEL, &yymsp[0].minor.yy0); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-2].minor.yy698, DB_OPTION_CACHEMODEL, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 90: /* db_options ::= db_options CACHESIZE NK_INTEGER */
-{ yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-2].minor.yy452, DB_OPTION_CACHESIZE, &yymsp[0].minor.yy0); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-2].minor.yy698, DB_OPTION_CACHESIZE, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 91: /* db_options ::= db_options COMP NK_INTEGER */
-{ yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-2].minor.yy452, DB_OPTION_COMP, &yymsp[0].minor.yy0); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-2].minor.yy698, DB_OPTION_COMP, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 92: /* db_options ::= db_options DURATION NK_INTEGER */
       case 93: /* db_options ::= db_options DURATION NK_VARIABLE */ yytestcase(yyruleno==93);
-{ yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-2].minor.yy452, DB_OPTION_DAYS, &yymsp[0].minor.yy0); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-2].minor.yy698, DB_OPTION_DAYS, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 94: /* db_options ::= db_options MAXROWS NK_INTEGER */
-{ yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-2].minor.yy452, DB_OPTION_MAXROWS, &yymsp[0].minor.yy0); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-2].minor.yy698, DB_OPTION_MAXROWS, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 95: /* db_options ::= db_options MINROWS NK_INTEGER */
-{ yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-2].minor.yy452, DB_OPTION_MINROWS, &yymsp[0].minor.yy0); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-2].minor.yy698, DB_OPTION_MINROWS, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 96: /* db_options ::= db_options KEEP integer_list */
       case 97: /* db_options ::= db_options KEEP variable_list */ yytestcase(yyruleno==97);
-{ yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-2].minor.yy452, DB_OPTION_KEEP, yymsp[0].minor.yy812); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-2].minor.yy698, DB_OPTION_KEEP, yymsp[0].minor.yy88); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 98: /* db_options ::= db_options PAGES NK_INTEGER */
-{ yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-2].minor.yy452, DB_OPTION_PAGES, &yymsp[0].minor.yy0); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-2].minor.yy698, DB_OPTION_PAGES, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 99: /* db_options ::= db_options PAGESIZE NK_INTEGER */
-{ yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-2].minor.yy452, DB_OPTION_PAGESIZE, &yymsp[0].minor.yy0); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-2].minor.yy698, DB_OPTION_PAGESIZE, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 100: /* db_options ::= db_options TSDB_PAGESIZE NK_INTEGER */
-{ yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-2].minor.yy452, DB_OPTION_TSDB_PAGESIZE, &yymsp[0].minor.yy0); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-2].minor.yy698, DB_OPTION_TSDB_PAGESIZE, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 101: /* db_options ::= db_options PRECISION NK_STRING */
-{ yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-2].minor.yy452, DB_OPTION_PRECISION, &yymsp[0].minor.yy0); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-2].minor.yy698, DB_OPTION_PRECISION, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 102: /* db_options ::= db_options REPLICA NK_INTEGER */
-{ yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-2].minor.yy452, DB_OPTION_REPLICA, &yymsp[0].minor.yy0); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-2].minor.yy698, DB_OPTION_REPLICA, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 103: /* db_options ::= db_options VGROUPS NK_INTEGER */
-{ yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-2].minor.yy452, DB_OPTION_VGROUPS, &yymsp[0].minor.yy0); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-2].minor.yy698, DB_OPTION_VGROUPS, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 104: /* db_options ::= db_options SINGLE_STABLE NK_INTEGER */
-{ yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-2].minor.yy452, DB_OPTION_SINGLE_STABLE, &yymsp[0].minor.yy0); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-2].minor.yy698, DB_OPTION_SINGLE_STABLE, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 105: /* db_options ::= db_options RETENTIONS retention_list */
-{ yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-2].minor.yy452, DB_OPTION_RETENTIONS, yymsp[0].minor.yy812); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-2].minor.yy698, DB_OPTION_RETENTIONS, yymsp[0].minor.yy88); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 106: /* db_options ::= db_options SCHEMALESS NK_INTEGER */
-{ yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-2].minor.yy452, DB_OPTION_SCHEMALESS, &yymsp[0].minor.yy0); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-2].minor.yy698, DB_OPTION_SCHEMALESS, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 107: /* db_options ::= db_options WAL_LEVEL NK_INTEGER */
-{ yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-2].minor.yy452, DB_OPTION_WAL, &yymsp[0].minor.yy0); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-2].minor.yy698, DB_OPTION_WAL, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 108: /* db_options ::= db_options WAL_FSYNC_PERIOD NK_INTEGER */
-{ yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-2].minor.yy452, DB_OPTION_FSYNC, &yymsp[0].minor.yy0); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-2].minor.yy698, DB_OPTION_FSYNC, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 109: /* db_options ::= db_options WAL_RETENTION_PERIOD NK_INTEGER */
-{ yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-2].minor.yy452, DB_OPTION_WAL_RETENTION_PERIOD, &yymsp[0].minor.yy0); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-2].minor.yy698, DB_OPTION_WAL_RETENTION_PERIOD, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 110: /* db_options ::= db_options WAL_RETENTION_PERIOD NK_MINUS NK_INTEGER */
 { 
                                                                                     SToken t = yymsp[-1].minor.yy0;
                                                                                     t.n = (yymsp[0].minor.yy0.z + yymsp[0].minor.yy0.n) - yymsp[-1].minor.yy0.z;
-                                                                                    yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-3].minor.yy452, DB_OPTION_WAL_RETENTION_PERIOD, &t);
+                                                                                    yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-3].minor.yy698, DB_OPTION_WAL_RETENTION_PERIOD, &t);
                                                                                   }
-  yymsp[-3].minor.yy452 = yylhsminor.yy452;
+  yymsp[-3].minor.yy698 = yylhsminor.yy698;
         break;
       case 111: /* db_options ::= db_options WAL_RETENTION_SIZE NK_INTEGER */
-{ yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-2].minor.yy452, DB_OPTION_WAL_RETENTION_SIZE, &yymsp[0].minor.yy0); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-2].minor.yy698, DB_OPTION_WAL_RETENTION_SIZE, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 112: /* db_options ::= db_options WAL_RETENTION_SIZE NK_MINUS NK_INTEGER */
 { 
                                                                                     SToken t = yymsp[-1].minor.yy0;
                                                                                     t.n = (yymsp[0].minor.yy0.z + yymsp[0].minor.yy0.n) - yymsp[-1].minor.yy0.z;
-                                                                                    yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-3].minor.yy452, DB_OPTION_WAL_RETENTION_SIZE, &t);
+                                                                                    yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-3].minor.yy698, DB_OPTION_WAL_RETENTION_SIZE, &t);
                                                                                   }
-  yymsp[-3].minor.yy452 = yylhsminor.yy452;
+  yymsp[-3].minor.yy698 = yylhsminor.yy698;
         break;
       case 113: /* db_options ::= db_options WAL_ROLL_PERIOD NK_INTEGER */
-{ yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-2].minor.yy452, DB_OPTION_WAL_ROLL_PERIOD, &yymsp[0].minor.yy0); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-2].minor.yy698, DB_OPTION_WAL_ROLL_PERIOD, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 114: /* db_options ::= db_options WAL_SEGMENT_SIZE NK_INTEGER */
-{ yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-2].minor.yy452, DB_OPTION_WAL_SEGMENT_SIZE, &yymsp[0].minor.yy0); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-2].minor.yy698, DB_OPTION_WAL_SEGMENT_SIZE, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 115: /* db_options ::= db_options STT_TRIGGER NK_INTEGER */
-{ yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-2].minor.yy452, DB_OPTION_STT_TRIGGER, &yymsp[0].minor.yy0); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-2].minor.yy698, DB_OPTION_STT_TRIGGER, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 116: /* db_options ::= db_options TABLE_PREFIX signed */
-{ yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-2].minor.yy452, DB_OPTION_TABLE_PREFIX, yymsp[0].minor.yy452); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-2].minor.yy698, DB_OPTION_TABLE_PREFIX, yymsp[0].minor.yy698); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 117: /* db_options ::= db_options TABLE_SUFFIX signed */
-{ yylhsminor.yy452 = setDatabaseOption(pCxt, yymsp[-2].minor.yy452, DB_OPTION_TABLE_SUFFIX, yymsp[0].minor.yy452); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setDatabaseOption(pCxt, yymsp[-2].minor.yy698, DB_OPTION_TABLE_SUFFIX, yymsp[0].minor.yy698); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 118: /* alter_db_options ::= alter_db_option */
-{ yylhsminor.yy452 = createAlterDatabaseOptions(pCxt); yylhsminor.yy452 = setAlterDatabaseOption(pCxt, yylhsminor.yy452, &yymsp[0].minor.yy365); }
-  yymsp[0].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createAlterDatabaseOptions(pCxt); yylhsminor.yy698 = setAlterDatabaseOption(pCxt, yylhsminor.yy698, &yymsp[0].minor.yy23); }
+  yymsp[0].minor.yy698 = yylhsminor.yy698;
         break;
       case 119: /* alter_db_options ::= alter_db_options alter_db_option */
-{ yylhsminor.yy452 = setAlterDatabaseOption(pCxt, yymsp[-1].minor.yy452, &yymsp[0].minor.yy365); }
-  yymsp[-1].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setAlterDatabaseOption(pCxt, yymsp[-1].minor.yy698, &yymsp[0].minor.yy23); }
+  yymsp[-1].minor.yy698 = yylhsminor.yy698;
         break;
       case 120: /* alter_db_option ::= BUFFER NK_INTEGER */
-{ yymsp[-1].minor.yy365.type = DB_OPTION_BUFFER; yymsp[-1].minor.yy365.val = yymsp[0].minor.yy0; }
+{ yymsp[-1].minor.yy23.type = DB_OPTION_BUFFER; yymsp[-1].minor.yy23.val = yymsp[0].minor.yy0; }
         break;
       case 121: /* alter_db_option ::= CACHEMODEL NK_STRING */
-{ yymsp[-1].minor.yy365.type = DB_OPTION_CACHEMODEL; yymsp[-1].minor.yy365.val = yymsp[0].minor.yy0; }
+{ yymsp[-1].minor.yy23.type = DB_OPTION_CACHEMODEL; yymsp[-1].minor.yy23.val = yymsp[0].minor.yy0; }
         break;
       case 122: /* alter_db_option ::= CACHESIZE NK_INTEGER */
-{ yymsp[-1].minor.yy365.type = DB_OPTION_CACHESIZE; yymsp[-1].minor.yy365.val = yymsp[0].minor.yy0; }
+{ yymsp[-1].minor.yy23.type = DB_OPTION_CACHESIZE; yymsp[-1].minor.yy23.val = yymsp[0].minor.yy0; }
         break;
       case 123: /* alter_db_option ::= WAL_FSYNC_PERIOD NK_INTEGER */
-{ yymsp[-1].minor.yy365.type = DB_OPTION_FSYNC; yymsp[-1].minor.yy365.val = yymsp[0].minor.yy0; }
+{ yymsp[-1].minor.yy23.type = DB_OPTION_FSYNC; yymsp[-1].minor.yy23.val = yymsp[0].minor.yy0; }
         break;
       case 124: /* alter_db_option ::= KEEP integer_list */
       case 125: /* alter_db_option ::= KEEP variable_list */ yytestcase(yyruleno==125);
-{ yymsp[-1].minor.yy365.type = DB_OPTION_KEEP; yymsp[-1].minor.yy365.pList = yymsp[0].minor.yy812; }
+{ yymsp[-1].minor.yy23.type = DB_OPTION_KEEP; yymsp[-1].minor.yy23.pList = yymsp[0].minor.yy88; }
         break;
       case 126: /* alter_db_option ::= PAGES NK_INTEGER */
-{ yymsp[-1].minor.yy365.type = DB_OPTION_PAGES; yymsp[-1].minor.yy365.val = yymsp[0].minor.yy0; }
+{ yymsp[-1].minor.yy23.type = DB_OPTION_PAGES; yymsp[-1].minor.yy23.val = yymsp[0].minor.yy0; }
         break;
       case 127: /* alter_db_option ::= REPLICA NK_INTEGER */
-{ yymsp[-1].minor.yy365.type = DB_OPTION_REPLICA; yymsp[-1].minor.yy365.val = yymsp[0].minor.yy0; }
+{ yymsp[-1].minor.yy23.type = DB_OPTION_REPLICA; yymsp[-1].minor.yy23.val = yymsp[0].minor.yy0; }
         break;
       case 128: /* alter_db_option ::= WAL_LEVEL NK_INTEGER */
-{ yymsp[-1].minor.yy365.type = DB_OPTION_WAL; yymsp[-1].minor.yy365.val = yymsp[0].minor.yy0; }
+{ yymsp[-1].minor.yy23.type = DB_OPTION_WAL; yymsp[-1].minor.yy23.val = yymsp[0].minor.yy0; }
         break;
       case 129: /* alter_db_option ::= STT_TRIGGER NK_INTEGER */
-{ yymsp[-1].minor.yy365.type = DB_OPTION_STT_TRIGGER; yymsp[-1].minor.yy365.val = yymsp[0].minor.yy0; }
+{ yymsp[-1].minor.yy23.type = DB_OPTION_STT_TRIGGER; yymsp[-1].minor.yy23.val = yymsp[0].minor.yy0; }
         break;
       case 130: /* alter_db_option ::= MINROWS NK_INTEGER */
-{ yymsp[-1].minor.yy365.type = DB_OPTION_MINROWS; yymsp[-1].minor.yy365.val = yymsp[0].minor.yy0; }
+{ yymsp[-1].minor.yy23.type = DB_OPTION_MINROWS; yymsp[-1].minor.yy23.val = yymsp[0].minor.yy0; }
         break;
       case 131: /* alter_db_option ::= WAL_RETENTION_PERIOD NK_INTEGER */
-{ yymsp[-1].minor.yy365.type = DB_OPTION_WAL_RETENTION_PERIOD; yymsp[-1].minor.yy365.val = yymsp[0].minor.yy0; }
+{ yymsp[-1].minor.yy23.type = DB_OPTION_WAL_RETENTION_PERIOD; yymsp[-1].minor.yy23.val = yymsp[0].minor.yy0; }
         break;
       case 132: /* alter_db_option ::= WAL_RETENTION_PERIOD NK_MINUS NK_INTEGER */
 { 
                                                                                     SToken t = yymsp[-1].minor.yy0;
                                                                                     t.n = (yymsp[0].minor.yy0.z + yymsp[0].minor.yy0.n) - yymsp[-1].minor.yy0.z;
-                                                                                    yymsp[-2].minor.yy365.type = DB_OPTION_WAL_RETENTION_PERIOD; yymsp[-2].minor.yy365.val = t;
+                                                                                    yymsp[-2].minor.yy23.type = DB_OPTION_WAL_RETENTION_PERIOD; yymsp[-2].minor.yy23.val = t;
                                                                                   }
         break;
       case 133: /* alter_db_option ::= WAL_RETENTION_SIZE NK_INTEGER */
-{ yymsp[-1].minor.yy365.type = DB_OPTION_WAL_RETENTION_SIZE; yymsp[-1].minor.yy365.val = yymsp[0].minor.yy0; }
+{ yymsp[-1].minor.yy23.type = DB_OPTION_WAL_RETENTION_SIZE; yymsp[-1].minor.yy23.val = yymsp[0].minor.yy0; }
         break;
       case 134: /* alter_db_option ::= WAL_RETENTION_SIZE NK_MINUS NK_INTEGER */
 { 
                                                                                     SToken t = yymsp[-1].minor.yy0;
                                                                                     t.n = (yymsp[0].minor.yy0.z + yymsp[0].minor.yy0.n) - yymsp[-1].minor.yy0.z;
-                                                                                    yymsp[-2].minor.yy365.type = DB_OPTION_WAL_RETENTION_SIZE; yymsp[-2].minor.yy365.val = t;
+                                                                                    yymsp[-2].minor.yy23.type = DB_OPTION_WAL_RETENTION_SIZE; yymsp[-2].minor.yy23.val = t;
                                                                                   }
         break;
       case 135: /* integer_list ::= NK_INTEGER */
-{ yylhsminor.yy812 = createNodeList(pCxt, createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &yymsp[0].minor.yy0)); }
-  yymsp[0].minor.yy812 = yylhsminor.yy812;
+{ yylhsminor.yy88 = createNodeList(pCxt, createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &yymsp[0].minor.yy0)); }
+  yymsp[0].minor.yy88 = yylhsminor.yy88;
         break;
       case 136: /* integer_list ::= integer_list NK_COMMA NK_INTEGER */
       case 367: /* dnode_list ::= dnode_list DNODE NK_INTEGER */ yytestcase(yyruleno==367);
-{ yylhsminor.yy812 = addNodeToList(pCxt, yymsp[-2].minor.yy812, createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &yymsp[0].minor.yy0)); }
-  yymsp[-2].minor.yy812 = yylhsminor.yy812;
+{ yylhsminor.yy88 = addNodeToList(pCxt, yymsp[-2].minor.yy88, createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &yymsp[0].minor.yy0)); }
+  yymsp[-2].minor.yy88 = yylhsminor.yy88;
         break;
       case 137: /* variable_list ::= NK_VARIABLE */
-{ yylhsminor.yy812 = createNodeList(pCxt, createDurationValueNode(pCxt, &yymsp[0].minor.yy0)); }
-  yymsp[0].minor.yy812 = yylhsminor.yy812;
+{ yylhsminor.yy88 = createNodeList(pCxt, createDurationValueNode(pCxt, &yymsp[0].minor.yy0)); }
+  yymsp[0].minor.yy88 = yylhsminor.yy88;
         break;
       case 138: /* variable_list ::= variable_list NK_COMMA NK_VARIABLE */
-{ yylhsminor.yy812 = addNodeToList(pCxt, yymsp[-2].minor.yy812, createDurationValueNode(pCxt, &yymsp[0].minor.yy0)); }
-  yymsp[-2].minor.yy812 = yylhsminor.yy812;
+{ yylhsminor.yy88 = addNodeToList(pCxt, yymsp[-2].minor.yy88, createDurationValueNode(pCxt, &yymsp[0].minor.yy0)); }
+  yymsp[-2].minor.yy88 = yylhsminor.yy88;
         break;
       case 139: /* retention_list ::= retention */
       case 169: /* multi_create_clause ::= create_subtable_clause */ yytestcase(yyruleno==169);
@@ -4987,11 +4993,11 @@ static YYACTIONTYPE yy_reduce(
       case 396: /* literal_list ::= signed_literal */ yytestcase(yyruleno==396);
       case 463: /* other_para_list ::= star_func_para */ yytestcase(yyruleno==463);
       case 469: /* when_then_list ::= when_then_expr */ yytestcase(yyruleno==469);
-      case 524: /* select_list ::= select_item */ yytestcase(yyruleno==524);
-      case 535: /* partition_list ::= partition_item */ yytestcase(yyruleno==535);
-      case 591: /* sort_specification_list ::= sort_specification */ yytestcase(yyruleno==591);
-{ yylhsminor.yy812 = createNodeList(pCxt, yymsp[0].minor.yy452); }
-  yymsp[0].minor.yy812 = yylhsminor.yy812;
+      case 526: /* select_list ::= select_item */ yytestcase(yyruleno==526);
+      case 537: /* partition_list ::= partition_item */ yytestcase(yyruleno==537);
+      case 593: /* sort_specification_list ::= sort_specification */ yytestcase(yyruleno==593);
+{ yylhsminor.yy88 = createNodeList(pCxt, yymsp[0].minor.yy698); }
+  yymsp[0].minor.yy88 = yylhsminor.yy88;
         break;
       case 140: /* retention_list ::= retention_list NK_COMMA retention */
       case 173: /* multi_drop_clause ::= multi_drop_clause NK_COMMA drop_table_clause */ yytestcase(yyruleno==173);
@@ -5002,285 +5008,285 @@ static YYACTIONTYPE yy_reduce(
       case 297: /* func_list ::= func_list NK_COMMA func */ yytestcase(yyruleno==297);
       case 397: /* literal_list ::= literal_list NK_COMMA signed_literal */ yytestcase(yyruleno==397);
       case 464: /* other_para_list ::= other_para_list NK_COMMA star_func_para */ yytestcase(yyruleno==464);
-      case 525: /* select_list ::= select_list NK_COMMA select_item */ yytestcase(yyruleno==525);
-      case 536: /* partition_list ::= partition_list NK_COMMA partition_item */ yytestcase(yyruleno==536);
-      case 592: /* sort_specification_list ::= sort_specification_list NK_COMMA sort_specification */ yytestcase(yyruleno==592);
-{ yylhsminor.yy812 = addNodeToList(pCxt, yymsp[-2].minor.yy812, yymsp[0].minor.yy452); }
-  yymsp[-2].minor.yy812 = yylhsminor.yy812;
+      case 527: /* select_list ::= select_list NK_COMMA select_item */ yytestcase(yyruleno==527);
+      case 538: /* partition_list ::= partition_list NK_COMMA partition_item */ yytestcase(yyruleno==538);
+      case 594: /* sort_specification_list ::= sort_specification_list NK_COMMA sort_specification */ yytestcase(yyruleno==594);
+{ yylhsminor.yy88 = addNodeToList(pCxt, yymsp[-2].minor.yy88, yymsp[0].minor.yy698); }
+  yymsp[-2].minor.yy88 = yylhsminor.yy88;
         break;
       case 141: /* retention ::= NK_VARIABLE NK_COLON NK_VARIABLE */
-{ yylhsminor.yy452 = createNodeListNodeEx(pCxt, createDurationValueNode(pCxt, &yymsp[-2].minor.yy0), createDurationValueNode(pCxt, &yymsp[0].minor.yy0)); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createNodeListNodeEx(pCxt, createDurationValueNode(pCxt, &yymsp[-2].minor.yy0), createDurationValueNode(pCxt, &yymsp[0].minor.yy0)); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 142: /* speed_opt ::= */
       case 330: /* bufsize_opt ::= */ yytestcase(yyruleno==330);
-{ yymsp[1].minor.yy416 = 0; }
+{ yymsp[1].minor.yy724 = 0; }
         break;
       case 143: /* speed_opt ::= MAX_SPEED NK_INTEGER */
       case 331: /* bufsize_opt ::= BUFSIZE NK_INTEGER */ yytestcase(yyruleno==331);
-{ yymsp[-1].minor.yy416 = taosStr2Int32(yymsp[0].minor.yy0.z, NULL, 10); }
+{ yymsp[-1].minor.yy724 = taosStr2Int32(yymsp[0].minor.yy0.z, NULL, 10); }
         break;
       case 145: /* start_opt ::= START WITH NK_INTEGER */
       case 149: /* end_opt ::= END WITH NK_INTEGER */ yytestcase(yyruleno==149);
-{ yymsp[-2].minor.yy452 = createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &yymsp[0].minor.yy0); }
+{ yymsp[-2].minor.yy698 = createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &yymsp[0].minor.yy0); }
         break;
       case 146: /* start_opt ::= START WITH NK_STRING */
       case 150: /* end_opt ::= END WITH NK_STRING */ yytestcase(yyruleno==150);
-{ yymsp[-2].minor.yy452 = createValueNode(pCxt, TSDB_DATA_TYPE_TIMESTAMP, &yymsp[0].minor.yy0); }
+{ yymsp[-2].minor.yy698 = createValueNode(pCxt, TSDB_DATA_TYPE_TIMESTAMP, &yymsp[0].minor.yy0); }
         break;
       case 147: /* start_opt ::= START WITH TIMESTAMP NK_STRING */
       case 151: /* end_opt ::= END WITH TIMESTAMP NK_STRING */ yytestcase(yyruleno==151);
-{ yymsp[-3].minor.yy452 = createValueNode(pCxt, TSDB_DATA_TYPE_TIMESTAMP, &yymsp[0].minor.yy0); }
+{ yymsp[-3].minor.yy698 = createValueNode(pCxt, TSDB_DATA_TYPE_TIMESTAMP, &yymsp[0].minor.yy0); }
         break;
       case 152: /* cmd ::= CREATE TABLE not_exists_opt full_table_name NK_LP column_def_list NK_RP tags_def_opt table_options */
       case 154: /* cmd ::= CREATE STABLE not_exists_opt full_table_name NK_LP column_def_list NK_RP tags_def table_options */ yytestcase(yyruleno==154);
-{ pCxt->pRootNode = createCreateTableStmt(pCxt, yymsp[-6].minor.yy667, yymsp[-5].minor.yy452, yymsp[-3].minor.yy812, yymsp[-1].minor.yy812, yymsp[0].minor.yy452); }
+{ pCxt->pRootNode = createCreateTableStmt(pCxt, yymsp[-6].minor.yy83, yymsp[-5].minor.yy698, yymsp[-3].minor.yy88, yymsp[-1].minor.yy88, yymsp[0].minor.yy698); }
         break;
       case 153: /* cmd ::= CREATE TABLE multi_create_clause */
-{ pCxt->pRootNode = createCreateMultiTableStmt(pCxt, yymsp[0].minor.yy812); }
+{ pCxt->pRootNode = createCreateMultiTableStmt(pCxt, yymsp[0].minor.yy88); }
         break;
       case 155: /* cmd ::= DROP TABLE multi_drop_clause */
-{ pCxt->pRootNode = createDropTableStmt(pCxt, yymsp[0].minor.yy812); }
+{ pCxt->pRootNode = createDropTableStmt(pCxt, yymsp[0].minor.yy88); }
         break;
       case 156: /* cmd ::= DROP STABLE exists_opt full_table_name */
-{ pCxt->pRootNode = createDropSuperTableStmt(pCxt, yymsp[-1].minor.yy667, yymsp[0].minor.yy452); }
+{ pCxt->pRootNode = createDropSuperTableStmt(pCxt, yymsp[-1].minor.yy83, yymsp[0].minor.yy698); }
         break;
       case 157: /* cmd ::= ALTER TABLE alter_table_clause */
       case 369: /* cmd ::= query_or_subquery */ yytestcase(yyruleno==369);
       case 370: /* cmd ::= insert_query */ yytestcase(yyruleno==370);
-{ pCxt->pRootNode = yymsp[0].minor.yy452; }
+{ pCxt->pRootNode = yymsp[0].minor.yy698; }
         break;
       case 158: /* cmd ::= ALTER STABLE alter_table_clause */
-{ pCxt->pRootNode = setAlterSuperTableType(yymsp[0].minor.yy452); }
+{ pCxt->pRootNode = setAlterSuperTableType(yymsp[0].minor.yy698); }
         break;
       case 159: /* alter_table_clause ::= full_table_name alter_table_options */
-{ yylhsminor.yy452 = createAlterTableModifyOptions(pCxt, yymsp[-1].minor.yy452, yymsp[0].minor.yy452); }
-  yymsp[-1].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createAlterTableModifyOptions(pCxt, yymsp[-1].minor.yy698, yymsp[0].minor.yy698); }
+  yymsp[-1].minor.yy698 = yylhsminor.yy698;
         break;
       case 160: /* alter_table_clause ::= full_table_name ADD COLUMN column_name type_name */
-{ yylhsminor.yy452 = createAlterTableAddModifyCol(pCxt, yymsp[-4].minor.yy452, TSDB_ALTER_TABLE_ADD_COLUMN, &yymsp[-1].minor.yy371, yymsp[0].minor.yy310); }
-  yymsp[-4].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createAlterTableAddModifyCol(pCxt, yymsp[-4].minor.yy698, TSDB_ALTER_TABLE_ADD_COLUMN, &yymsp[-1].minor.yy731, yymsp[0].minor.yy394); }
+  yymsp[-4].minor.yy698 = yylhsminor.yy698;
         break;
       case 161: /* alter_table_clause ::= full_table_name DROP COLUMN column_name */
-{ yylhsminor.yy452 = createAlterTableDropCol(pCxt, yymsp[-3].minor.yy452, TSDB_ALTER_TABLE_DROP_COLUMN, &yymsp[0].minor.yy371); }
-  yymsp[-3].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createAlterTableDropCol(pCxt, yymsp[-3].minor.yy698, TSDB_ALTER_TABLE_DROP_COLUMN, &yymsp[0].minor.yy731); }
+  yymsp[-3].minor.yy698 = yylhsminor.yy698;
         break;
       case 162: /* alter_table_clause ::= full_table_name MODIFY COLUMN column_name type_name */
-{ yylhsminor.yy452 = createAlterTableAddModifyCol(pCxt, yymsp[-4].minor.yy452, TSDB_ALTER_TABLE_UPDATE_COLUMN_BYTES, &yymsp[-1].minor.yy371, yymsp[0].minor.yy310); }
-  yymsp[-4].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createAlterTableAddModifyCol(pCxt, yymsp[-4].minor.yy698, TSDB_ALTER_TABLE_UPDATE_COLUMN_BYTES, &yymsp[-1].minor.yy731, yymsp[0].minor.yy394); }
+  yymsp[-4].minor.yy698 = yylhsminor.yy698;
         break;
       case 163: /* alter_table_clause ::= full_table_name RENAME COLUMN column_name column_name */
-{ yylhsminor.yy452 = createAlterTableRenameCol(pCxt, yymsp[-4].minor.yy452, TSDB_ALTER_TABLE_UPDATE_COLUMN_NAME, &yymsp[-1].minor.yy371, &yymsp[0].minor.yy371); }
-  yymsp[-4].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createAlterTableRenameCol(pCxt, yymsp[-4].minor.yy698, TSDB_ALTER_TABLE_UPDATE_COLUMN_NAME, &yymsp[-1].minor.yy731, &yymsp[0].minor.yy731); }
+  yymsp[-4].minor.yy698 = yylhsminor.yy698;
         break;
       case 164: /* alter_table_clause ::= full_table_name ADD TAG column_name type_name */
-{ yylhsminor.yy452 = createAlterTableAddModifyCol(pCxt, yymsp[-4].minor.yy452, TSDB_ALTER_TABLE_ADD_TAG, &yymsp[-1].minor.yy371, yymsp[0].minor.yy310); }
-  yymsp[-4].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createAlterTableAddModifyCol(pCxt, yymsp[-4].minor.yy698, TSDB_ALTER_TABLE_ADD_TAG, &yymsp[-1].minor.yy731, yymsp[0].minor.yy394); }
+  yymsp[-4].minor.yy698 = yylhsminor.yy698;
         break;
       case 165: /* alter_table_clause ::= full_table_name DROP TAG column_name */
-{ yylhsminor.yy452 = createAlterTableDropCol(pCxt, yymsp[-3].minor.yy452, TSDB_ALTER_TABLE_DROP_TAG, &yymsp[0].minor.yy371); }
-  yymsp[-3].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createAlterTableDropCol(pCxt, yymsp[-3].minor.yy698, TSDB_ALTER_TABLE_DROP_TAG, &yymsp[0].minor.yy731); }
+  yymsp[-3].minor.yy698 = yylhsminor.yy698;
         break;
       case 166: /* alter_table_clause ::= full_table_name MODIFY TAG column_name type_name */
-{ yylhsminor.yy452 = createAlterTableAddModifyCol(pCxt, yymsp[-4].minor.yy452, TSDB_ALTER_TABLE_UPDATE_TAG_BYTES, &yymsp[-1].minor.yy371, yymsp[0].minor.yy310); }
-  yymsp[-4].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createAlterTableAddModifyCol(pCxt, yymsp[-4].minor.yy698, TSDB_ALTER_TABLE_UPDATE_TAG_BYTES, &yymsp[-1].minor.yy731, yymsp[0].minor.yy394); }
+  yymsp[-4].minor.yy698 = yylhsminor.yy698;
         break;
       case 167: /* alter_table_clause ::= full_table_name RENAME TAG column_name column_name */
-{ yylhsminor.yy452 = createAlterTableRenameCol(pCxt, yymsp[-4].minor.yy452, TSDB_ALTER_TABLE_UPDATE_TAG_NAME, &yymsp[-1].minor.yy371, &yymsp[0].minor.yy371); }
-  yymsp[-4].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createAlterTableRenameCol(pCxt, yymsp[-4].minor.yy698, TSDB_ALTER_TABLE_UPDATE_TAG_NAME, &yymsp[-1].minor.yy731, &yymsp[0].minor.yy731); }
+  yymsp[-4].minor.yy698 = yylhsminor.yy698;
         break;
       case 168: /* alter_table_clause ::= full_table_name SET TAG column_name NK_EQ signed_literal */
-{ yylhsminor.yy452 = createAlterTableSetTag(pCxt, yymsp[-5].minor.yy452, &yymsp[-2].minor.yy371, yymsp[0].minor.yy452); }
-  yymsp[-5].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createAlterTableSetTag(pCxt, yymsp[-5].minor.yy698, &yymsp[-2].minor.yy731, yymsp[0].minor.yy698); }
+  yymsp[-5].minor.yy698 = yylhsminor.yy698;
         break;
       case 170: /* multi_create_clause ::= multi_create_clause create_subtable_clause */
       case 470: /* when_then_list ::= when_then_list when_then_expr */ yytestcase(yyruleno==470);
-{ yylhsminor.yy812 = addNodeToList(pCxt, yymsp[-1].minor.yy812, yymsp[0].minor.yy452); }
-  yymsp[-1].minor.yy812 = yylhsminor.yy812;
+{ yylhsminor.yy88 = addNodeToList(pCxt, yymsp[-1].minor.yy88, yymsp[0].minor.yy698); }
+  yymsp[-1].minor.yy88 = yylhsminor.yy88;
         break;
       case 171: /* create_subtable_clause ::= not_exists_opt full_table_name USING full_table_name specific_cols_opt TAGS NK_LP expression_list NK_RP table_options */
-{ yylhsminor.yy452 = createCreateSubTableClause(pCxt, yymsp[-9].minor.yy667, yymsp[-8].minor.yy452, yymsp[-6].minor.yy452, yymsp[-5].minor.yy812, yymsp[-2].minor.yy812, yymsp[0].minor.yy452); }
-  yymsp[-9].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createCreateSubTableClause(pCxt, yymsp[-9].minor.yy83, yymsp[-8].minor.yy698, yymsp[-6].minor.yy698, yymsp[-5].minor.yy88, yymsp[-2].minor.yy88, yymsp[0].minor.yy698); }
+  yymsp[-9].minor.yy698 = yylhsminor.yy698;
         break;
       case 174: /* drop_table_clause ::= exists_opt full_table_name */
-{ yylhsminor.yy452 = createDropTableClause(pCxt, yymsp[-1].minor.yy667, yymsp[0].minor.yy452); }
-  yymsp[-1].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createDropTableClause(pCxt, yymsp[-1].minor.yy83, yymsp[0].minor.yy698); }
+  yymsp[-1].minor.yy698 = yylhsminor.yy698;
         break;
       case 175: /* specific_cols_opt ::= */
       case 206: /* tags_def_opt ::= */ yytestcase(yyruleno==206);
       case 281: /* tag_list_opt ::= */ yytestcase(yyruleno==281);
       case 340: /* col_list_opt ::= */ yytestcase(yyruleno==340);
       case 342: /* tag_def_or_ref_opt ::= */ yytestcase(yyruleno==342);
-      case 533: /* partition_by_clause_opt ::= */ yytestcase(yyruleno==533);
-      case 558: /* group_by_clause_opt ::= */ yytestcase(yyruleno==558);
-      case 578: /* order_by_clause_opt ::= */ yytestcase(yyruleno==578);
-{ yymsp[1].minor.yy812 = NULL; }
+      case 535: /* partition_by_clause_opt ::= */ yytestcase(yyruleno==535);
+      case 560: /* group_by_clause_opt ::= */ yytestcase(yyruleno==560);
+      case 580: /* order_by_clause_opt ::= */ yytestcase(yyruleno==580);
+{ yymsp[1].minor.yy88 = NULL; }
         break;
       case 176: /* specific_cols_opt ::= NK_LP col_name_list NK_RP */
       case 341: /* col_list_opt ::= NK_LP col_name_list NK_RP */ yytestcase(yyruleno==341);
-{ yymsp[-2].minor.yy812 = yymsp[-1].minor.yy812; }
+{ yymsp[-2].minor.yy88 = yymsp[-1].minor.yy88; }
         break;
       case 177: /* full_table_name ::= table_name */
-{ yylhsminor.yy452 = createRealTableNode(pCxt, NULL, &yymsp[0].minor.yy371, NULL); }
-  yymsp[0].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createRealTableNode(pCxt, NULL, &yymsp[0].minor.yy731, NULL); }
+  yymsp[0].minor.yy698 = yylhsminor.yy698;
         break;
       case 178: /* full_table_name ::= db_name NK_DOT table_name */
-{ yylhsminor.yy452 = createRealTableNode(pCxt, &yymsp[-2].minor.yy371, &yymsp[0].minor.yy371, NULL); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createRealTableNode(pCxt, &yymsp[-2].minor.yy731, &yymsp[0].minor.yy731, NULL); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 181: /* column_def ::= column_name type_name */
-{ yylhsminor.yy452 = createColumnDefNode(pCxt, &yymsp[-1].minor.yy371, yymsp[0].minor.yy310, NULL); }
-  yymsp[-1].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createColumnDefNode(pCxt, &yymsp[-1].minor.yy731, yymsp[0].minor.yy394, NULL); }
+  yymsp[-1].minor.yy698 = yylhsminor.yy698;
         break;
       case 182: /* type_name ::= BOOL */
-{ yymsp[0].minor.yy310 = createDataType(TSDB_DATA_TYPE_BOOL); }
+{ yymsp[0].minor.yy394 = createDataType(TSDB_DATA_TYPE_BOOL); }
         break;
       case 183: /* type_name ::= TINYINT */
-{ yymsp[0].minor.yy310 = createDataType(TSDB_DATA_TYPE_TINYINT); }
+{ yymsp[0].minor.yy394 = createDataType(TSDB_DATA_TYPE_TINYINT); }
         break;
       case 184: /* type_name ::= SMALLINT */
-{ yymsp[0].minor.yy310 = createDataType(TSDB_DATA_TYPE_SMALLINT); }
+{ yymsp[0].minor.yy394 = createDataType(TSDB_DATA_TYPE_SMALLINT); }
         break;
       case 185: /* type_name ::= INT */
       case 186: /* type_name ::= INTEGER */ yytestcase(yyruleno==186);
-{ yymsp[0].minor.yy310 = createDataType(TSDB_DATA_TYPE_INT); }
+{ yymsp[0].minor.yy394 = createDataType(TSDB_DATA_TYPE_INT); }
         break;
       case 187: /* type_name ::= BIGINT */
-{ yymsp[0].minor.yy310 = createDataType(TSDB_DATA_TYPE_BIGINT); }
+{ yymsp[0].minor.yy394 = createDataType(TSDB_DATA_TYPE_BIGINT); }
         break;
       case 188: /* type_name ::= FLOAT */
-{ yymsp[0].minor.yy310 = createDataType(TSDB_DATA_TYPE_FLOAT); }
+{ yymsp[0].minor.yy394 = createDataType(TSDB_DATA_TYPE_FLOAT); }
         break;
       case 189: /* type_name ::= DOUBLE */
-{ yymsp[0].minor.yy310 = createDataType(TSDB_DATA_TYPE_DOUBLE); }
+{ yymsp[0].minor.yy394 = createDataType(TSDB_DATA_TYPE_DOUBLE); }
         break;
       case 190: /* type_name ::= BINARY NK_LP NK_INTEGER NK_RP */
-{ yymsp[-3].minor.yy310 = createVarLenDataType(TSDB_DATA_TYPE_BINARY, &yymsp[-1].minor.yy0); }
+{ yymsp[-3].minor.yy394 = createVarLenDataType(TSDB_DATA_TYPE_BINARY, &yymsp[-1].minor.yy0); }
         break;
       case 191: /* type_name ::= TIMESTAMP */
-{ yymsp[0].minor.yy310 = createDataType(TSDB_DATA_TYPE_TIMESTAMP); }
+{ yymsp[0].minor.yy394 = createDataType(TSDB_DATA_TYPE_TIMESTAMP); }
         break;
       case 192: /* type_name ::= NCHAR NK_LP NK_INTEGER NK_RP */
-{ yymsp[-3].minor.yy310 = createVarLenDataType(TSDB_DATA_TYPE_NCHAR, &yymsp[-1].minor.yy0); }
+{ yymsp[-3].minor.yy394 = createVarLenDataType(TSDB_DATA_TYPE_NCHAR, &yymsp[-1].minor.yy0); }
         break;
       case 193: /* type_name ::= TINYINT UNSIGNED */
-{ yymsp[-1].minor.yy310 = createDataType(TSDB_DATA_TYPE_UTINYINT); }
+{ yymsp[-1].minor.yy394 = createDataType(TSDB_DATA_TYPE_UTINYINT); }
         break;
       case 194: /* type_name ::= SMALLINT UNSIGNED */
-{ yymsp[-1].minor.yy310 = createDataType(TSDB_DATA_TYPE_USMALLINT); }
+{ yymsp[-1].minor.yy394 = createDataType(TSDB_DATA_TYPE_USMALLINT); }
         break;
       case 195: /* type_name ::= INT UNSIGNED */
-{ yymsp[-1].minor.yy310 = createDataType(TSDB_DATA_TYPE_UINT); }
+{ yymsp[-1].minor.yy394 = createDataType(TSDB_DATA_TYPE_UINT); }
         break;
       case 196: /* type_name ::= BIGINT UNSIGNED */
-{ yymsp[-1].minor.yy310 = createDataType(TSDB_DATA_TYPE_UBIGINT); }
+{ yymsp[-1].minor.yy394 = createDataType(TSDB_DATA_TYPE_UBIGINT); }
         break;
       case 197: /* type_name ::= JSON */
-{ yymsp[0].minor.yy310 = createDataType(TSDB_DATA_TYPE_JSON); }
+{ yymsp[0].minor.yy394 = createDataType(TSDB_DATA_TYPE_JSON); }
         break;
       case 198: /* type_name ::= VARCHAR NK_LP NK_INTEGER NK_RP */
-{ yymsp[-3].minor.yy310 = createVarLenDataType(TSDB_DATA_TYPE_VARCHAR, &yymsp[-1].minor.yy0); }
+{ yymsp[-3].minor.yy394 = createVarLenDataType(TSDB_DATA_TYPE_VARCHAR, &yymsp[-1].minor.yy0); }
         break;
       case 199: /* type_name ::= MEDIUMBLOB */
-{ yymsp[0].minor.yy310 = createDataType(TSDB_DATA_TYPE_MEDIUMBLOB); }
+{ yymsp[0].minor.yy394 = createDataType(TSDB_DATA_TYPE_MEDIUMBLOB); }
         break;
       case 200: /* type_name ::= BLOB */
-{ yymsp[0].minor.yy310 = createDataType(TSDB_DATA_TYPE_BLOB); }
+{ yymsp[0].minor.yy394 = createDataType(TSDB_DATA_TYPE_BLOB); }
         break;
       case 201: /* type_name ::= VARBINARY NK_LP NK_INTEGER NK_RP */
-{ yymsp[-3].minor.yy310 = createVarLenDataType(TSDB_DATA_TYPE_VARBINARY, &yymsp[-1].minor.yy0); }
+{ yymsp[-3].minor.yy394 = createVarLenDataType(TSDB_DATA_TYPE_VARBINARY, &yymsp[-1].minor.yy0); }
         break;
       case 202: /* type_name ::= GEOMETRY NK_LP NK_INTEGER NK_RP */
-{ yymsp[-3].minor.yy310 = createVarLenDataType(TSDB_DATA_TYPE_GEOMETRY, &yymsp[-1].minor.yy0); }
+{ yymsp[-3].minor.yy394 = createVarLenDataType(TSDB_DATA_TYPE_GEOMETRY, &yymsp[-1].minor.yy0); }
         break;
       case 203: /* type_name ::= DECIMAL */
-{ yymsp[0].minor.yy310 = createDataType(TSDB_DATA_TYPE_DECIMAL); }
+{ yymsp[0].minor.yy394 = createDataType(TSDB_DATA_TYPE_DECIMAL); }
         break;
       case 204: /* type_name ::= DECIMAL NK_LP NK_INTEGER NK_RP */
-{ yymsp[-3].minor.yy310 = createDataType(TSDB_DATA_TYPE_DECIMAL); }
+{ yymsp[-3].minor.yy394 = createDataType(TSDB_DATA_TYPE_DECIMAL); }
         break;
       case 205: /* type_name ::= DECIMAL NK_LP NK_INTEGER NK_COMMA NK_INTEGER NK_RP */
-{ yymsp[-5].minor.yy310 = createDataType(TSDB_DATA_TYPE_DECIMAL); }
+{ yymsp[-5].minor.yy394 = createDataType(TSDB_DATA_TYPE_DECIMAL); }
         break;
       case 207: /* tags_def_opt ::= tags_def */
       case 343: /* tag_def_or_ref_opt ::= tags_def */ yytestcase(yyruleno==343);
       case 462: /* star_func_para_list ::= other_para_list */ yytestcase(yyruleno==462);
-{ yylhsminor.yy812 = yymsp[0].minor.yy812; }
-  yymsp[0].minor.yy812 = yylhsminor.yy812;
+{ yylhsminor.yy88 = yymsp[0].minor.yy88; }
+  yymsp[0].minor.yy88 = yylhsminor.yy88;
         break;
       case 208: /* tags_def ::= TAGS NK_LP column_def_list NK_RP */
       case 344: /* tag_def_or_ref_opt ::= TAGS NK_LP col_name_list NK_RP */ yytestcase(yyruleno==344);
-{ yymsp[-3].minor.yy812 = yymsp[-1].minor.yy812; }
+{ yymsp[-3].minor.yy88 = yymsp[-1].minor.yy88; }
         break;
       case 209: /* table_options ::= */
-{ yymsp[1].minor.yy452 = createDefaultTableOptions(pCxt); }
+{ yymsp[1].minor.yy698 = createDefaultTableOptions(pCxt); }
         break;
       case 210: /* table_options ::= table_options COMMENT NK_STRING */
-{ yylhsminor.yy452 = setTableOption(pCxt, yymsp[-2].minor.yy452, TABLE_OPTION_COMMENT, &yymsp[0].minor.yy0); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setTableOption(pCxt, yymsp[-2].minor.yy698, TABLE_OPTION_COMMENT, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 211: /* table_options ::= table_options MAX_DELAY duration_list */
-{ yylhsminor.yy452 = setTableOption(pCxt, yymsp[-2].minor.yy452, TABLE_OPTION_MAXDELAY, yymsp[0].minor.yy812); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setTableOption(pCxt, yymsp[-2].minor.yy698, TABLE_OPTION_MAXDELAY, yymsp[0].minor.yy88); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 212: /* table_options ::= table_options WATERMARK duration_list */
-{ yylhsminor.yy452 = setTableOption(pCxt, yymsp[-2].minor.yy452, TABLE_OPTION_WATERMARK, yymsp[0].minor.yy812); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setTableOption(pCxt, yymsp[-2].minor.yy698, TABLE_OPTION_WATERMARK, yymsp[0].minor.yy88); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 213: /* table_options ::= table_options ROLLUP NK_LP rollup_func_list NK_RP */
-{ yylhsminor.yy452 = setTableOption(pCxt, yymsp[-4].minor.yy452, TABLE_OPTION_ROLLUP, yymsp[-1].minor.yy812); }
-  yymsp[-4].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setTableOption(pCxt, yymsp[-4].minor.yy698, TABLE_OPTION_ROLLUP, yymsp[-1].minor.yy88); }
+  yymsp[-4].minor.yy698 = yylhsminor.yy698;
         break;
       case 214: /* table_options ::= table_options TTL NK_INTEGER */
-{ yylhsminor.yy452 = setTableOption(pCxt, yymsp[-2].minor.yy452, TABLE_OPTION_TTL, &yymsp[0].minor.yy0); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setTableOption(pCxt, yymsp[-2].minor.yy698, TABLE_OPTION_TTL, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 215: /* table_options ::= table_options SMA NK_LP col_name_list NK_RP */
-{ yylhsminor.yy452 = setTableOption(pCxt, yymsp[-4].minor.yy452, TABLE_OPTION_SMA, yymsp[-1].minor.yy812); }
-  yymsp[-4].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setTableOption(pCxt, yymsp[-4].minor.yy698, TABLE_OPTION_SMA, yymsp[-1].minor.yy88); }
+  yymsp[-4].minor.yy698 = yylhsminor.yy698;
         break;
       case 216: /* table_options ::= table_options DELETE_MARK duration_list */
-{ yylhsminor.yy452 = setTableOption(pCxt, yymsp[-2].minor.yy452, TABLE_OPTION_DELETE_MARK, yymsp[0].minor.yy812); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setTableOption(pCxt, yymsp[-2].minor.yy698, TABLE_OPTION_DELETE_MARK, yymsp[0].minor.yy88); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 217: /* alter_table_options ::= alter_table_option */
-{ yylhsminor.yy452 = createAlterTableOptions(pCxt); yylhsminor.yy452 = setTableOption(pCxt, yylhsminor.yy452, yymsp[0].minor.yy365.type, &yymsp[0].minor.yy365.val); }
-  yymsp[0].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createAlterTableOptions(pCxt); yylhsminor.yy698 = setTableOption(pCxt, yylhsminor.yy698, yymsp[0].minor.yy23.type, &yymsp[0].minor.yy23.val); }
+  yymsp[0].minor.yy698 = yylhsminor.yy698;
         break;
       case 218: /* alter_table_options ::= alter_table_options alter_table_option */
-{ yylhsminor.yy452 = setTableOption(pCxt, yymsp[-1].minor.yy452, yymsp[0].minor.yy365.type, &yymsp[0].minor.yy365.val); }
-  yymsp[-1].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setTableOption(pCxt, yymsp[-1].minor.yy698, yymsp[0].minor.yy23.type, &yymsp[0].minor.yy23.val); }
+  yymsp[-1].minor.yy698 = yylhsminor.yy698;
         break;
       case 219: /* alter_table_option ::= COMMENT NK_STRING */
-{ yymsp[-1].minor.yy365.type = TABLE_OPTION_COMMENT; yymsp[-1].minor.yy365.val = yymsp[0].minor.yy0; }
+{ yymsp[-1].minor.yy23.type = TABLE_OPTION_COMMENT; yymsp[-1].minor.yy23.val = yymsp[0].minor.yy0; }
         break;
       case 220: /* alter_table_option ::= TTL NK_INTEGER */
-{ yymsp[-1].minor.yy365.type = TABLE_OPTION_TTL; yymsp[-1].minor.yy365.val = yymsp[0].minor.yy0; }
+{ yymsp[-1].minor.yy23.type = TABLE_OPTION_TTL; yymsp[-1].minor.yy23.val = yymsp[0].minor.yy0; }
         break;
       case 221: /* duration_list ::= duration_literal */
       case 426: /* expression_list ::= expr_or_subquery */ yytestcase(yyruleno==426);
-{ yylhsminor.yy812 = createNodeList(pCxt, releaseRawExprNode(pCxt, yymsp[0].minor.yy452)); }
-  yymsp[0].minor.yy812 = yylhsminor.yy812;
+{ yylhsminor.yy88 = createNodeList(pCxt, releaseRawExprNode(pCxt, yymsp[0].minor.yy698)); }
+  yymsp[0].minor.yy88 = yylhsminor.yy88;
         break;
       case 222: /* duration_list ::= duration_list NK_COMMA duration_literal */
       case 427: /* expression_list ::= expression_list NK_COMMA expr_or_subquery */ yytestcase(yyruleno==427);
-{ yylhsminor.yy812 = addNodeToList(pCxt, yymsp[-2].minor.yy812, releaseRawExprNode(pCxt, yymsp[0].minor.yy452)); }
-  yymsp[-2].minor.yy812 = yylhsminor.yy812;
+{ yylhsminor.yy88 = addNodeToList(pCxt, yymsp[-2].minor.yy88, releaseRawExprNode(pCxt, yymsp[0].minor.yy698)); }
+  yymsp[-2].minor.yy88 = yylhsminor.yy88;
         break;
       case 225: /* rollup_func_name ::= function_name */
-{ yylhsminor.yy452 = createFunctionNode(pCxt, &yymsp[0].minor.yy371, NULL); }
-  yymsp[0].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createFunctionNode(pCxt, &yymsp[0].minor.yy731, NULL); }
+  yymsp[0].minor.yy698 = yylhsminor.yy698;
         break;
       case 226: /* rollup_func_name ::= FIRST */
       case 227: /* rollup_func_name ::= LAST */ yytestcase(yyruleno==227);
       case 285: /* tag_item ::= QTAGS */ yytestcase(yyruleno==285);
-{ yylhsminor.yy452 = createFunctionNode(pCxt, &yymsp[0].minor.yy0, NULL); }
-  yymsp[0].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createFunctionNode(pCxt, &yymsp[0].minor.yy0, NULL); }
+  yymsp[0].minor.yy698 = yylhsminor.yy698;
         break;
       case 230: /* col_name ::= column_name */
       case 286: /* tag_item ::= column_name */ yytestcase(yyruleno==286);
-{ yylhsminor.yy452 = createColumnNode(pCxt, NULL, &yymsp[0].minor.yy371); }
-  yymsp[0].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createColumnNode(pCxt, NULL, &yymsp[0].minor.yy731); }
+  yymsp[0].minor.yy698 = yylhsminor.yy698;
         break;
       case 231: /* cmd ::= SHOW DNODES */
 { pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_DNODES_STMT); }
@@ -5295,13 +5301,13 @@ static YYACTIONTYPE yy_reduce(
 { pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_DATABASES_STMT); }
         break;
       case 235: /* cmd ::= SHOW db_name_cond_opt TABLES like_pattern_opt */
-{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_TABLES_STMT, yymsp[-2].minor.yy452, yymsp[0].minor.yy452, OP_TYPE_LIKE); }
+{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_TABLES_STMT, yymsp[-2].minor.yy698, yymsp[0].minor.yy698, OP_TYPE_LIKE); }
         break;
       case 236: /* cmd ::= SHOW db_name_cond_opt STABLES like_pattern_opt */
-{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_STABLES_STMT, yymsp[-2].minor.yy452, yymsp[0].minor.yy452, OP_TYPE_LIKE); }
+{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_STABLES_STMT, yymsp[-2].minor.yy698, yymsp[0].minor.yy698, OP_TYPE_LIKE); }
         break;
       case 237: /* cmd ::= SHOW db_name_cond_opt VGROUPS */
-{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_VGROUPS_STMT, yymsp[-1].minor.yy452, NULL, OP_TYPE_LIKE); }
+{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_VGROUPS_STMT, yymsp[-1].minor.yy698, NULL, OP_TYPE_LIKE); }
         break;
       case 238: /* cmd ::= SHOW MNODES */
 { pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_MNODES_STMT); }
@@ -5313,10 +5319,10 @@ static YYACTIONTYPE yy_reduce(
 { pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_FUNCTIONS_STMT); }
         break;
       case 241: /* cmd ::= SHOW INDEXES FROM table_name_cond from_db_opt */
-{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_INDEXES_STMT, yymsp[0].minor.yy452, yymsp[-1].minor.yy452, OP_TYPE_EQUAL); }
+{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_INDEXES_STMT, yymsp[0].minor.yy698, yymsp[-1].minor.yy698, OP_TYPE_EQUAL); }
         break;
       case 242: /* cmd ::= SHOW INDEXES FROM db_name NK_DOT table_name */
-{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_INDEXES_STMT, createIdentifierValueNode(pCxt, &yymsp[-2].minor.yy371), createIdentifierValueNode(pCxt, &yymsp[0].minor.yy371), OP_TYPE_EQUAL); }
+{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_INDEXES_STMT, createIdentifierValueNode(pCxt, &yymsp[-2].minor.yy731), createIdentifierValueNode(pCxt, &yymsp[0].minor.yy731), OP_TYPE_EQUAL); }
         break;
       case 243: /* cmd ::= SHOW STREAMS */
 { pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_STREAMS_STMT); }
@@ -5335,13 +5341,13 @@ static YYACTIONTYPE yy_reduce(
 { pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_LICENCES_STMT); }
         break;
       case 249: /* cmd ::= SHOW CREATE DATABASE db_name */
-{ pCxt->pRootNode = createShowCreateDatabaseStmt(pCxt, &yymsp[0].minor.yy371); }
+{ pCxt->pRootNode = createShowCreateDatabaseStmt(pCxt, &yymsp[0].minor.yy731); }
         break;
       case 250: /* cmd ::= SHOW CREATE TABLE full_table_name */
-{ pCxt->pRootNode = createShowCreateTableStmt(pCxt, QUERY_NODE_SHOW_CREATE_TABLE_STMT, yymsp[0].minor.yy452); }
+{ pCxt->pRootNode = createShowCreateTableStmt(pCxt, QUERY_NODE_SHOW_CREATE_TABLE_STMT, yymsp[0].minor.yy698); }
         break;
       case 251: /* cmd ::= SHOW CREATE STABLE full_table_name */
-{ pCxt->pRootNode = createShowCreateTableStmt(pCxt, QUERY_NODE_SHOW_CREATE_STABLE_STMT, yymsp[0].minor.yy452); }
+{ pCxt->pRootNode = createShowCreateTableStmt(pCxt, QUERY_NODE_SHOW_CREATE_STABLE_STMT, yymsp[0].minor.yy698); }
         break;
       case 252: /* cmd ::= SHOW QUERIES */
 { pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_QUERIES_STMT); }
@@ -5360,7 +5366,7 @@ static YYACTIONTYPE yy_reduce(
 { pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_LOCAL_VARIABLES_STMT); }
         break;
       case 258: /* cmd ::= SHOW DNODE NK_INTEGER VARIABLES like_pattern_opt */
-{ pCxt->pRootNode = createShowDnodeVariablesStmt(pCxt, createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &yymsp[-2].minor.yy0), yymsp[0].minor.yy452); }
+{ pCxt->pRootNode = createShowDnodeVariablesStmt(pCxt, createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &yymsp[-2].minor.yy0), yymsp[0].minor.yy698); }
         break;
       case 259: /* cmd ::= SHOW BNODES */
 { pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_BNODES_STMT); }
@@ -5375,7 +5381,7 @@ static YYACTIONTYPE yy_reduce(
 { pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_TRANSACTIONS_STMT); }
         break;
       case 263: /* cmd ::= SHOW TABLE DISTRIBUTED full_table_name */
-{ pCxt->pRootNode = createShowTableDistributedStmt(pCxt, yymsp[0].minor.yy452); }
+{ pCxt->pRootNode = createShowTableDistributedStmt(pCxt, yymsp[0].minor.yy698); }
         break;
       case 264: /* cmd ::= SHOW CONSUMERS */
 { pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_CONSUMERS_STMT); }
@@ -5384,16 +5390,16 @@ static YYACTIONTYPE yy_reduce(
 { pCxt->pRootNode = createShowStmt(pCxt, QUERY_NODE_SHOW_SUBSCRIPTIONS_STMT); }
         break;
       case 266: /* cmd ::= SHOW TAGS FROM table_name_cond from_db_opt */
-{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_TAGS_STMT, yymsp[0].minor.yy452, yymsp[-1].minor.yy452, OP_TYPE_EQUAL); }
+{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_TAGS_STMT, yymsp[0].minor.yy698, yymsp[-1].minor.yy698, OP_TYPE_EQUAL); }
         break;
       case 267: /* cmd ::= SHOW TAGS FROM db_name NK_DOT table_name */
-{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_TAGS_STMT, createIdentifierValueNode(pCxt, &yymsp[-2].minor.yy371), createIdentifierValueNode(pCxt, &yymsp[0].minor.yy371), OP_TYPE_EQUAL); }
+{ pCxt->pRootNode = createShowStmtWithCond(pCxt, QUERY_NODE_SHOW_TAGS_STMT, createIdentifierValueNode(pCxt, &yymsp[-2].minor.yy731), createIdentifierValueNode(pCxt, &yymsp[0].minor.yy731), OP_TYPE_EQUAL); }
         break;
       case 268: /* cmd ::= SHOW TABLE TAGS tag_list_opt FROM table_name_cond from_db_opt */
-{ pCxt->pRootNode = createShowTableTagsStmt(pCxt, yymsp[-1].minor.yy452, yymsp[0].minor.yy452, yymsp[-3].minor.yy812); }
+{ pCxt->pRootNode = createShowTableTagsStmt(pCxt, yymsp[-1].minor.yy698, yymsp[0].minor.yy698, yymsp[-3].minor.yy88); }
         break;
       case 269: /* cmd ::= SHOW TABLE TAGS tag_list_opt FROM db_name NK_DOT table_name */
-{ pCxt->pRootNode = createShowTableTagsStmt(pCxt, createIdentifierValueNode(pCxt, &yymsp[0].minor.yy371), createIdentifierValueNode(pCxt, &yymsp[-2].minor.yy371), yymsp[-4].minor.yy812); }
+{ pCxt->pRootNode = createShowTableTagsStmt(pCxt, createIdentifierValueNode(pCxt, &yymsp[0].minor.yy731), createIdentifierValueNode(pCxt, &yymsp[-2].minor.yy731), yymsp[-4].minor.yy88); }
         break;
       case 270: /* cmd ::= SHOW VNODES NK_INTEGER */
 { pCxt->pRootNode = createShowVnodesStmt(pCxt, createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &yymsp[0].minor.yy0), NULL); }
@@ -5402,192 +5408,192 @@ static YYACTIONTYPE yy_reduce(
 { pCxt->pRootNode = createShowVnodesStmt(pCxt, NULL, createValueNode(pCxt, TSDB_DATA_TYPE_VARCHAR, &yymsp[0].minor.yy0)); }
         break;
       case 272: /* cmd ::= SHOW db_name_cond_opt ALIVE */
-{ pCxt->pRootNode = createShowAliveStmt(pCxt, yymsp[-1].minor.yy452,    QUERY_NODE_SHOW_DB_ALIVE_STMT); }
+{ pCxt->pRootNode = createShowAliveStmt(pCxt, yymsp[-1].minor.yy698,    QUERY_NODE_SHOW_DB_ALIVE_STMT); }
         break;
       case 273: /* cmd ::= SHOW CLUSTER ALIVE */
 { pCxt->pRootNode = createShowAliveStmt(pCxt, NULL, QUERY_NODE_SHOW_CLUSTER_ALIVE_STMT); }
         break;
       case 274: /* db_name_cond_opt ::= */
       case 279: /* from_db_opt ::= */ yytestcase(yyruleno==279);
-{ yymsp[1].minor.yy452 = createDefaultDatabaseCondValue(pCxt); }
+{ yymsp[1].minor.yy698 = createDefaultDatabaseCondValue(pCxt); }
         break;
       case 275: /* db_name_cond_opt ::= db_name NK_DOT */
-{ yylhsminor.yy452 = createIdentifierValueNode(pCxt, &yymsp[-1].minor.yy371); }
-  yymsp[-1].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createIdentifierValueNode(pCxt, &yymsp[-1].minor.yy731); }
+  yymsp[-1].minor.yy698 = yylhsminor.yy698;
         break;
       case 277: /* like_pattern_opt ::= LIKE NK_STRING */
-{ yymsp[-1].minor.yy452 = createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[0].minor.yy0); }
+{ yymsp[-1].minor.yy698 = createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[0].minor.yy0); }
         break;
       case 278: /* table_name_cond ::= table_name */
-{ yylhsminor.yy452 = createIdentifierValueNode(pCxt, &yymsp[0].minor.yy371); }
-  yymsp[0].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createIdentifierValueNode(pCxt, &yymsp[0].minor.yy731); }
+  yymsp[0].minor.yy698 = yylhsminor.yy698;
         break;
       case 280: /* from_db_opt ::= FROM db_name */
-{ yymsp[-1].minor.yy452 = createIdentifierValueNode(pCxt, &yymsp[0].minor.yy371); }
+{ yymsp[-1].minor.yy698 = createIdentifierValueNode(pCxt, &yymsp[0].minor.yy731); }
         break;
       case 284: /* tag_item ::= TBNAME */
-{ yylhsminor.yy452 = setProjectionAlias(pCxt, createFunctionNode(pCxt, &yymsp[0].minor.yy0, NULL), &yymsp[0].minor.yy0); }
-  yymsp[0].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setProjectionAlias(pCxt, createFunctionNode(pCxt, &yymsp[0].minor.yy0, NULL), &yymsp[0].minor.yy0); }
+  yymsp[0].minor.yy698 = yylhsminor.yy698;
         break;
       case 287: /* tag_item ::= column_name column_alias */
-{ yylhsminor.yy452 = setProjectionAlias(pCxt, createColumnNode(pCxt, NULL, &yymsp[-1].minor.yy371), &yymsp[0].minor.yy371); }
-  yymsp[-1].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setProjectionAlias(pCxt, createColumnNode(pCxt, NULL, &yymsp[-1].minor.yy731), &yymsp[0].minor.yy731); }
+  yymsp[-1].minor.yy698 = yylhsminor.yy698;
         break;
       case 288: /* tag_item ::= column_name AS column_alias */
-{ yylhsminor.yy452 = setProjectionAlias(pCxt, createColumnNode(pCxt, NULL, &yymsp[-2].minor.yy371), &yymsp[0].minor.yy371); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setProjectionAlias(pCxt, createColumnNode(pCxt, NULL, &yymsp[-2].minor.yy731), &yymsp[0].minor.yy731); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 289: /* cmd ::= CREATE SMA INDEX not_exists_opt full_index_name ON full_table_name index_options */
-{ pCxt->pRootNode = createCreateIndexStmt(pCxt, INDEX_TYPE_SMA, yymsp[-4].minor.yy667, yymsp[-3].minor.yy452, yymsp[-1].minor.yy452, NULL, yymsp[0].minor.yy452); }
+{ pCxt->pRootNode = createCreateIndexStmt(pCxt, INDEX_TYPE_SMA, yymsp[-4].minor.yy83, yymsp[-3].minor.yy698, yymsp[-1].minor.yy698, NULL, yymsp[0].minor.yy698); }
         break;
       case 290: /* cmd ::= CREATE INDEX not_exists_opt full_index_name ON full_table_name NK_LP col_name_list NK_RP */
-{ pCxt->pRootNode = createCreateIndexStmt(pCxt, INDEX_TYPE_NORMAL, yymsp[-6].minor.yy667, yymsp[-5].minor.yy452, yymsp[-3].minor.yy452, yymsp[-1].minor.yy812, NULL); }
+{ pCxt->pRootNode = createCreateIndexStmt(pCxt, INDEX_TYPE_NORMAL, yymsp[-6].minor.yy83, yymsp[-5].minor.yy698, yymsp[-3].minor.yy698, yymsp[-1].minor.yy88, NULL); }
         break;
       case 291: /* cmd ::= DROP INDEX exists_opt full_index_name */
-{ pCxt->pRootNode = createDropIndexStmt(pCxt, yymsp[-1].minor.yy667, yymsp[0].minor.yy452); }
+{ pCxt->pRootNode = createDropIndexStmt(pCxt, yymsp[-1].minor.yy83, yymsp[0].minor.yy698); }
         break;
       case 292: /* full_index_name ::= index_name */
-{ yylhsminor.yy452 = createRealTableNodeForIndexName(pCxt, NULL, &yymsp[0].minor.yy371); }
-  yymsp[0].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createRealTableNodeForIndexName(pCxt, NULL, &yymsp[0].minor.yy731); }
+  yymsp[0].minor.yy698 = yylhsminor.yy698;
         break;
       case 293: /* full_index_name ::= db_name NK_DOT index_name */
-{ yylhsminor.yy452 = createRealTableNodeForIndexName(pCxt, &yymsp[-2].minor.yy371, &yymsp[0].minor.yy371); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createRealTableNodeForIndexName(pCxt, &yymsp[-2].minor.yy731, &yymsp[0].minor.yy731); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 294: /* index_options ::= FUNCTION NK_LP func_list NK_RP INTERVAL NK_LP duration_literal NK_RP sliding_opt sma_stream_opt */
-{ yymsp[-9].minor.yy452 = createIndexOption(pCxt, yymsp[-7].minor.yy812, releaseRawExprNode(pCxt, yymsp[-3].minor.yy452), NULL, yymsp[-1].minor.yy452, yymsp[0].minor.yy452); }
+{ yymsp[-9].minor.yy698 = createIndexOption(pCxt, yymsp[-7].minor.yy88, releaseRawExprNode(pCxt, yymsp[-3].minor.yy698), NULL, yymsp[-1].minor.yy698, yymsp[0].minor.yy698); }
         break;
       case 295: /* index_options ::= FUNCTION NK_LP func_list NK_RP INTERVAL NK_LP duration_literal NK_COMMA duration_literal NK_RP sliding_opt sma_stream_opt */
-{ yymsp[-11].minor.yy452 = createIndexOption(pCxt, yymsp[-9].minor.yy812, releaseRawExprNode(pCxt, yymsp[-5].minor.yy452), releaseRawExprNode(pCxt, yymsp[-3].minor.yy452), yymsp[-1].minor.yy452, yymsp[0].minor.yy452); }
+{ yymsp[-11].minor.yy698 = createIndexOption(pCxt, yymsp[-9].minor.yy88, releaseRawExprNode(pCxt, yymsp[-5].minor.yy698), releaseRawExprNode(pCxt, yymsp[-3].minor.yy698), yymsp[-1].minor.yy698, yymsp[0].minor.yy698); }
         break;
       case 298: /* func ::= sma_func_name NK_LP expression_list NK_RP */
-{ yylhsminor.yy452 = createFunctionNode(pCxt, &yymsp[-3].minor.yy371, yymsp[-1].minor.yy812); }
-  yymsp[-3].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createFunctionNode(pCxt, &yymsp[-3].minor.yy731, yymsp[-1].minor.yy88); }
+  yymsp[-3].minor.yy698 = yylhsminor.yy698;
         break;
       case 299: /* sma_func_name ::= function_name */
       case 513: /* alias_opt ::= table_alias */ yytestcase(yyruleno==513);
-{ yylhsminor.yy371 = yymsp[0].minor.yy371; }
-  yymsp[0].minor.yy371 = yylhsminor.yy371;
+{ yylhsminor.yy731 = yymsp[0].minor.yy731; }
+  yymsp[0].minor.yy731 = yylhsminor.yy731;
         break;
       case 304: /* sma_stream_opt ::= */
       case 345: /* stream_options ::= */ yytestcase(yyruleno==345);
-{ yymsp[1].minor.yy452 = createStreamOptions(pCxt); }
+{ yymsp[1].minor.yy698 = createStreamOptions(pCxt); }
         break;
       case 305: /* sma_stream_opt ::= sma_stream_opt WATERMARK duration_literal */
-{ ((SStreamOptions*)yymsp[-2].minor.yy452)->pWatermark = releaseRawExprNode(pCxt, yymsp[0].minor.yy452); yylhsminor.yy452 = yymsp[-2].minor.yy452; }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ ((SStreamOptions*)yymsp[-2].minor.yy698)->pWatermark = releaseRawExprNode(pCxt, yymsp[0].minor.yy698); yylhsminor.yy698 = yymsp[-2].minor.yy698; }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 306: /* sma_stream_opt ::= sma_stream_opt MAX_DELAY duration_literal */
-{ ((SStreamOptions*)yymsp[-2].minor.yy452)->pDelay = releaseRawExprNode(pCxt, yymsp[0].minor.yy452); yylhsminor.yy452 = yymsp[-2].minor.yy452; }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ ((SStreamOptions*)yymsp[-2].minor.yy698)->pDelay = releaseRawExprNode(pCxt, yymsp[0].minor.yy698); yylhsminor.yy698 = yymsp[-2].minor.yy698; }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 307: /* sma_stream_opt ::= sma_stream_opt DELETE_MARK duration_literal */
-{ ((SStreamOptions*)yymsp[-2].minor.yy452)->pDeleteMark = releaseRawExprNode(pCxt, yymsp[0].minor.yy452); yylhsminor.yy452 = yymsp[-2].minor.yy452; }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ ((SStreamOptions*)yymsp[-2].minor.yy698)->pDeleteMark = releaseRawExprNode(pCxt, yymsp[0].minor.yy698); yylhsminor.yy698 = yymsp[-2].minor.yy698; }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 308: /* with_meta ::= AS */
-{ yymsp[0].minor.yy416 = 0; }
+{ yymsp[0].minor.yy724 = 0; }
         break;
       case 309: /* with_meta ::= WITH META AS */
-{ yymsp[-2].minor.yy416 = 1; }
+{ yymsp[-2].minor.yy724 = 1; }
         break;
       case 310: /* with_meta ::= ONLY META AS */
-{ yymsp[-2].minor.yy416 = 2; }
+{ yymsp[-2].minor.yy724 = 2; }
         break;
       case 311: /* cmd ::= CREATE TOPIC not_exists_opt topic_name AS query_or_subquery */
-{ pCxt->pRootNode = createCreateTopicStmtUseQuery(pCxt, yymsp[-3].minor.yy667, &yymsp[-2].minor.yy371, yymsp[0].minor.yy452); }
+{ pCxt->pRootNode = createCreateTopicStmtUseQuery(pCxt, yymsp[-3].minor.yy83, &yymsp[-2].minor.yy731, yymsp[0].minor.yy698); }
         break;
       case 312: /* cmd ::= CREATE TOPIC not_exists_opt topic_name with_meta DATABASE db_name */
-{ pCxt->pRootNode = createCreateTopicStmtUseDb(pCxt, yymsp[-4].minor.yy667, &yymsp[-3].minor.yy371, &yymsp[0].minor.yy371, yymsp[-2].minor.yy416); }
+{ pCxt->pRootNode = createCreateTopicStmtUseDb(pCxt, yymsp[-4].minor.yy83, &yymsp[-3].minor.yy731, &yymsp[0].minor.yy731, yymsp[-2].minor.yy724); }
         break;
       case 313: /* cmd ::= CREATE TOPIC not_exists_opt topic_name with_meta STABLE full_table_name where_clause_opt */
-{ pCxt->pRootNode = createCreateTopicStmtUseTable(pCxt, yymsp[-5].minor.yy667, &yymsp[-4].minor.yy371, yymsp[-1].minor.yy452, yymsp[-3].minor.yy416, yymsp[0].minor.yy452); }
+{ pCxt->pRootNode = createCreateTopicStmtUseTable(pCxt, yymsp[-5].minor.yy83, &yymsp[-4].minor.yy731, yymsp[-1].minor.yy698, yymsp[-3].minor.yy724, yymsp[0].minor.yy698); }
         break;
       case 314: /* cmd ::= DROP TOPIC exists_opt topic_name */
-{ pCxt->pRootNode = createDropTopicStmt(pCxt, yymsp[-1].minor.yy667, &yymsp[0].minor.yy371); }
+{ pCxt->pRootNode = createDropTopicStmt(pCxt, yymsp[-1].minor.yy83, &yymsp[0].minor.yy731); }
         break;
       case 315: /* cmd ::= DROP CONSUMER GROUP exists_opt cgroup_name ON topic_name */
-{ pCxt->pRootNode = createDropCGroupStmt(pCxt, yymsp[-3].minor.yy667, &yymsp[-2].minor.yy371, &yymsp[0].minor.yy371); }
+{ pCxt->pRootNode = createDropCGroupStmt(pCxt, yymsp[-3].minor.yy83, &yymsp[-2].minor.yy731, &yymsp[0].minor.yy731); }
         break;
       case 316: /* cmd ::= DESC full_table_name */
       case 317: /* cmd ::= DESCRIBE full_table_name */ yytestcase(yyruleno==317);
-{ pCxt->pRootNode = createDescribeStmt(pCxt, yymsp[0].minor.yy452); }
+{ pCxt->pRootNode = createDescribeStmt(pCxt, yymsp[0].minor.yy698); }
         break;
       case 318: /* cmd ::= RESET QUERY CACHE */
 { pCxt->pRootNode = createResetQueryCacheStmt(pCxt); }
         break;
       case 319: /* cmd ::= EXPLAIN analyze_opt explain_options query_or_subquery */
       case 320: /* cmd ::= EXPLAIN analyze_opt explain_options insert_query */ yytestcase(yyruleno==320);
-{ pCxt->pRootNode = createExplainStmt(pCxt, yymsp[-2].minor.yy667, yymsp[-1].minor.yy452, yymsp[0].minor.yy452); }
+{ pCxt->pRootNode = createExplainStmt(pCxt, yymsp[-2].minor.yy83, yymsp[-1].minor.yy698, yymsp[0].minor.yy698); }
         break;
       case 323: /* explain_options ::= */
-{ yymsp[1].minor.yy452 = createDefaultExplainOptions(pCxt); }
+{ yymsp[1].minor.yy698 = createDefaultExplainOptions(pCxt); }
         break;
       case 324: /* explain_options ::= explain_options VERBOSE NK_BOOL */
-{ yylhsminor.yy452 = setExplainVerbose(pCxt, yymsp[-2].minor.yy452, &yymsp[0].minor.yy0); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setExplainVerbose(pCxt, yymsp[-2].minor.yy698, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 325: /* explain_options ::= explain_options RATIO NK_FLOAT */
-{ yylhsminor.yy452 = setExplainRatio(pCxt, yymsp[-2].minor.yy452, &yymsp[0].minor.yy0); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setExplainRatio(pCxt, yymsp[-2].minor.yy698, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 326: /* cmd ::= CREATE or_replace_opt agg_func_opt FUNCTION not_exists_opt function_name AS NK_STRING OUTPUTTYPE type_name bufsize_opt language_opt */
-{ pCxt->pRootNode = createCreateFunctionStmt(pCxt, yymsp[-7].minor.yy667, yymsp[-9].minor.yy667, &yymsp[-6].minor.yy371, &yymsp[-4].minor.yy0, yymsp[-2].minor.yy310, yymsp[-1].minor.yy416, &yymsp[0].minor.yy371, yymsp[-10].minor.yy667); }
+{ pCxt->pRootNode = createCreateFunctionStmt(pCxt, yymsp[-7].minor.yy83, yymsp[-9].minor.yy83, &yymsp[-6].minor.yy731, &yymsp[-4].minor.yy0, yymsp[-2].minor.yy394, yymsp[-1].minor.yy724, &yymsp[0].minor.yy731, yymsp[-10].minor.yy83); }
         break;
       case 327: /* cmd ::= DROP FUNCTION exists_opt function_name */
-{ pCxt->pRootNode = createDropFunctionStmt(pCxt, yymsp[-1].minor.yy667, &yymsp[0].minor.yy371); }
+{ pCxt->pRootNode = createDropFunctionStmt(pCxt, yymsp[-1].minor.yy83, &yymsp[0].minor.yy731); }
         break;
       case 332: /* language_opt ::= */
-{ yymsp[1].minor.yy371 = nil_token; }
+{ yymsp[1].minor.yy731 = nil_token; }
         break;
       case 333: /* language_opt ::= LANGUAGE NK_STRING */
-{ yymsp[-1].minor.yy371 = yymsp[0].minor.yy0; }
+{ yymsp[-1].minor.yy731 = yymsp[0].minor.yy0; }
         break;
       case 336: /* cmd ::= CREATE STREAM not_exists_opt stream_name stream_options INTO full_table_name col_list_opt tag_def_or_ref_opt subtable_opt AS query_or_subquery */
-{ pCxt->pRootNode = createCreateStreamStmt(pCxt, yymsp[-9].minor.yy667, &yymsp[-8].minor.yy371, yymsp[-5].minor.yy452, yymsp[-7].minor.yy452, yymsp[-3].minor.yy812, yymsp[-2].minor.yy452, yymsp[0].minor.yy452, yymsp[-4].minor.yy812); }
+{ pCxt->pRootNode = createCreateStreamStmt(pCxt, yymsp[-9].minor.yy83, &yymsp[-8].minor.yy731, yymsp[-5].minor.yy698, yymsp[-7].minor.yy698, yymsp[-3].minor.yy88, yymsp[-2].minor.yy698, yymsp[0].minor.yy698, yymsp[-4].minor.yy88); }
         break;
       case 337: /* cmd ::= DROP STREAM exists_opt stream_name */
-{ pCxt->pRootNode = createDropStreamStmt(pCxt, yymsp[-1].minor.yy667, &yymsp[0].minor.yy371); }
+{ pCxt->pRootNode = createDropStreamStmt(pCxt, yymsp[-1].minor.yy83, &yymsp[0].minor.yy731); }
         break;
       case 338: /* cmd ::= PAUSE STREAM exists_opt stream_name */
-{ pCxt->pRootNode = createPauseStreamStmt(pCxt, yymsp[-1].minor.yy667, &yymsp[0].minor.yy371); }
+{ pCxt->pRootNode = createPauseStreamStmt(pCxt, yymsp[-1].minor.yy83, &yymsp[0].minor.yy731); }
         break;
       case 339: /* cmd ::= RESUME STREAM exists_opt ignore_opt stream_name */
-{ pCxt->pRootNode = createResumeStreamStmt(pCxt, yymsp[-2].minor.yy667, yymsp[-1].minor.yy667, &yymsp[0].minor.yy371); }
+{ pCxt->pRootNode = createResumeStreamStmt(pCxt, yymsp[-2].minor.yy83, yymsp[-1].minor.yy83, &yymsp[0].minor.yy731); }
         break;
       case 346: /* stream_options ::= stream_options TRIGGER AT_ONCE */
       case 347: /* stream_options ::= stream_options TRIGGER WINDOW_CLOSE */ yytestcase(yyruleno==347);
-{ yylhsminor.yy452 = setStreamOptions(pCxt, yymsp[-2].minor.yy452, SOPT_TRIGGER_TYPE_SET, &yymsp[0].minor.yy0, NULL); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setStreamOptions(pCxt, yymsp[-2].minor.yy698, SOPT_TRIGGER_TYPE_SET, &yymsp[0].minor.yy0, NULL); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 348: /* stream_options ::= stream_options TRIGGER MAX_DELAY duration_literal */
-{ yylhsminor.yy452 = setStreamOptions(pCxt, yymsp[-3].minor.yy452, SOPT_TRIGGER_TYPE_SET, &yymsp[-1].minor.yy0, releaseRawExprNode(pCxt, yymsp[0].minor.yy452)); }
-  yymsp[-3].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setStreamOptions(pCxt, yymsp[-3].minor.yy698, SOPT_TRIGGER_TYPE_SET, &yymsp[-1].minor.yy0, releaseRawExprNode(pCxt, yymsp[0].minor.yy698)); }
+  yymsp[-3].minor.yy698 = yylhsminor.yy698;
         break;
       case 349: /* stream_options ::= stream_options WATERMARK duration_literal */
-{ yylhsminor.yy452 = setStreamOptions(pCxt, yymsp[-2].minor.yy452, SOPT_WATERMARK_SET, NULL, releaseRawExprNode(pCxt, yymsp[0].minor.yy452)); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setStreamOptions(pCxt, yymsp[-2].minor.yy698, SOPT_WATERMARK_SET, NULL, releaseRawExprNode(pCxt, yymsp[0].minor.yy698)); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 350: /* stream_options ::= stream_options IGNORE EXPIRED NK_INTEGER */
-{ yylhsminor.yy452 = setStreamOptions(pCxt, yymsp[-3].minor.yy452, SOPT_IGNORE_EXPIRED_SET, &yymsp[0].minor.yy0, NULL); }
-  yymsp[-3].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setStreamOptions(pCxt, yymsp[-3].minor.yy698, SOPT_IGNORE_EXPIRED_SET, &yymsp[0].minor.yy0, NULL); }
+  yymsp[-3].minor.yy698 = yylhsminor.yy698;
         break;
       case 351: /* stream_options ::= stream_options FILL_HISTORY NK_INTEGER */
-{ yylhsminor.yy452 = setStreamOptions(pCxt, yymsp[-2].minor.yy452, SOPT_FILL_HISTORY_SET, &yymsp[0].minor.yy0, NULL); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setStreamOptions(pCxt, yymsp[-2].minor.yy698, SOPT_FILL_HISTORY_SET, &yymsp[0].minor.yy0, NULL); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 352: /* stream_options ::= stream_options DELETE_MARK duration_literal */
-{ yylhsminor.yy452 = setStreamOptions(pCxt, yymsp[-2].minor.yy452, SOPT_DELETE_MARK_SET, NULL, releaseRawExprNode(pCxt, yymsp[0].minor.yy452)); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setStreamOptions(pCxt, yymsp[-2].minor.yy698, SOPT_DELETE_MARK_SET, NULL, releaseRawExprNode(pCxt, yymsp[0].minor.yy698)); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 353: /* stream_options ::= stream_options IGNORE UPDATE NK_INTEGER */
-{ yylhsminor.yy452 = setStreamOptions(pCxt, yymsp[-3].minor.yy452, SOPT_IGNORE_UPDATE_SET, &yymsp[0].minor.yy0, NULL); }
-  yymsp[-3].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = setStreamOptions(pCxt, yymsp[-3].minor.yy698, SOPT_IGNORE_UPDATE_SET, &yymsp[0].minor.yy0, NULL); }
+  yymsp[-3].minor.yy698 = yylhsminor.yy698;
         break;
       case 355: /* subtable_opt ::= SUBTABLE NK_LP expression NK_RP */
-      case 547: /* sliding_opt ::= SLIDING NK_LP duration_literal NK_RP */ yytestcase(yyruleno==547);
-      case 568: /* every_opt ::= EVERY NK_LP duration_literal NK_RP */ yytestcase(yyruleno==568);
-{ yymsp[-3].minor.yy452 = releaseRawExprNode(pCxt, yymsp[-1].minor.yy452); }
+      case 549: /* sliding_opt ::= SLIDING NK_LP duration_literal NK_RP */ yytestcase(yyruleno==549);
+      case 570: /* every_opt ::= EVERY NK_LP duration_literal NK_RP */ yytestcase(yyruleno==570);
+{ yymsp[-3].minor.yy698 = releaseRawExprNode(pCxt, yymsp[-1].minor.yy698); }
         break;
       case 358: /* cmd ::= KILL CONNECTION NK_INTEGER */
 { pCxt->pRootNode = createKillStmt(pCxt, QUERY_NODE_KILL_CONNECTION_STMT, &yymsp[0].minor.yy0); }
@@ -5608,42 +5614,42 @@ static YYACTIONTYPE yy_reduce(
 { pCxt->pRootNode = createMergeVgroupStmt(pCxt, &yymsp[-1].minor.yy0, &yymsp[0].minor.yy0); }
         break;
       case 364: /* cmd ::= REDISTRIBUTE VGROUP NK_INTEGER dnode_list */
-{ pCxt->pRootNode = createRedistributeVgroupStmt(pCxt, &yymsp[-1].minor.yy0, yymsp[0].minor.yy812); }
+{ pCxt->pRootNode = createRedistributeVgroupStmt(pCxt, &yymsp[-1].minor.yy0, yymsp[0].minor.yy88); }
         break;
       case 365: /* cmd ::= SPLIT VGROUP NK_INTEGER */
 { pCxt->pRootNode = createSplitVgroupStmt(pCxt, &yymsp[0].minor.yy0); }
         break;
       case 366: /* dnode_list ::= DNODE NK_INTEGER */
-{ yymsp[-1].minor.yy812 = createNodeList(pCxt, createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &yymsp[0].minor.yy0)); }
+{ yymsp[-1].minor.yy88 = createNodeList(pCxt, createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &yymsp[0].minor.yy0)); }
         break;
       case 368: /* cmd ::= DELETE FROM full_table_name where_clause_opt */
-{ pCxt->pRootNode = createDeleteStmt(pCxt, yymsp[-1].minor.yy452, yymsp[0].minor.yy452); }
+{ pCxt->pRootNode = createDeleteStmt(pCxt, yymsp[-1].minor.yy698, yymsp[0].minor.yy698); }
         break;
       case 371: /* insert_query ::= INSERT INTO full_table_name NK_LP col_name_list NK_RP query_or_subquery */
-{ yymsp[-6].minor.yy452 = createInsertStmt(pCxt, yymsp[-4].minor.yy452, yymsp[-2].minor.yy812, yymsp[0].minor.yy452); }
+{ yymsp[-6].minor.yy698 = createInsertStmt(pCxt, yymsp[-4].minor.yy698, yymsp[-2].minor.yy88, yymsp[0].minor.yy698); }
         break;
       case 372: /* insert_query ::= INSERT INTO full_table_name query_or_subquery */
-{ yymsp[-3].minor.yy452 = createInsertStmt(pCxt, yymsp[-1].minor.yy452, NULL, yymsp[0].minor.yy452); }
+{ yymsp[-3].minor.yy698 = createInsertStmt(pCxt, yymsp[-1].minor.yy698, NULL, yymsp[0].minor.yy698); }
         break;
       case 373: /* literal ::= NK_INTEGER */
-{ yylhsminor.yy452 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_UBIGINT, &yymsp[0].minor.yy0)); }
-  yymsp[0].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_UBIGINT, &yymsp[0].minor.yy0)); }
+  yymsp[0].minor.yy698 = yylhsminor.yy698;
         break;
       case 374: /* literal ::= NK_FLOAT */
-{ yylhsminor.yy452 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_DOUBLE, &yymsp[0].minor.yy0)); }
-  yymsp[0].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_DOUBLE, &yymsp[0].minor.yy0)); }
+  yymsp[0].minor.yy698 = yylhsminor.yy698;
         break;
       case 375: /* literal ::= NK_STRING */
-{ yylhsminor.yy452 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[0].minor.yy0)); }
-  yymsp[0].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[0].minor.yy0)); }
+  yymsp[0].minor.yy698 = yylhsminor.yy698;
         break;
       case 376: /* literal ::= NK_BOOL */
-{ yylhsminor.yy452 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_BOOL, &yymsp[0].minor.yy0)); }
-  yymsp[0].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_BOOL, &yymsp[0].minor.yy0)); }
+  yymsp[0].minor.yy698 = yylhsminor.yy698;
         break;
       case 377: /* literal ::= TIMESTAMP NK_STRING */
-{ yylhsminor.yy452 = createRawExprNodeExt(pCxt, &yymsp[-1].minor.yy0, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_TIMESTAMP, &yymsp[0].minor.yy0)); }
-  yymsp[-1].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createRawExprNodeExt(pCxt, &yymsp[-1].minor.yy0, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_TIMESTAMP, &yymsp[0].minor.yy0)); }
+  yymsp[-1].minor.yy698 = yylhsminor.yy698;
         break;
       case 378: /* literal ::= duration_literal */
       case 388: /* signed_literal ::= signed */ yytestcase(yyruleno==388);
@@ -5662,175 +5668,175 @@ static YYACTIONTYPE yy_reduce(
       case 506: /* table_reference ::= table_primary */ yytestcase(yyruleno==506);
       case 507: /* table_reference ::= joined_table */ yytestcase(yyruleno==507);
       case 511: /* table_primary ::= parenthesized_joined_table */ yytestcase(yyruleno==511);
-      case 570: /* query_simple ::= query_specification */ yytestcase(yyruleno==570);
-      case 571: /* query_simple ::= union_query_expression */ yytestcase(yyruleno==571);
-      case 574: /* query_simple_or_subquery ::= query_simple */ yytestcase(yyruleno==574);
-      case 576: /* query_or_subquery ::= query_expression */ yytestcase(yyruleno==576);
-{ yylhsminor.yy452 = yymsp[0].minor.yy452; }
-  yymsp[0].minor.yy452 = yylhsminor.yy452;
+      case 572: /* query_simple ::= query_specification */ yytestcase(yyruleno==572);
+      case 573: /* query_simple ::= union_query_expression */ yytestcase(yyruleno==573);
+      case 576: /* query_simple_or_subquery ::= query_simple */ yytestcase(yyruleno==576);
+      case 578: /* query_or_subquery ::= query_expression */ yytestcase(yyruleno==578);
+{ yylhsminor.yy698 = yymsp[0].minor.yy698; }
+  yymsp[0].minor.yy698 = yylhsminor.yy698;
         break;
       case 379: /* literal ::= NULL */
-{ yylhsminor.yy452 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_NULL, &yymsp[0].minor.yy0)); }
-  yymsp[0].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createValueNode(pCxt, TSDB_DATA_TYPE_NULL, &yymsp[0].minor.yy0)); }
+  yymsp[0].minor.yy698 = yylhsminor.yy698;
         break;
       case 380: /* literal ::= NK_QUESTION */
-{ yylhsminor.yy452 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createPlaceholderValueNode(pCxt, &yymsp[0].minor.yy0)); }
-  yymsp[0].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createPlaceholderValueNode(pCxt, &yymsp[0].minor.yy0)); }
+  yymsp[0].minor.yy698 = yylhsminor.yy698;
         break;
       case 381: /* duration_literal ::= NK_VARIABLE */
-{ yylhsminor.yy452 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createDurationValueNode(pCxt, &yymsp[0].minor.yy0)); }
-  yymsp[0].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createDurationValueNode(pCxt, &yymsp[0].minor.yy0)); }
+  yymsp[0].minor.yy698 = yylhsminor.yy698;
         break;
       case 382: /* signed ::= NK_INTEGER */
-{ yylhsminor.yy452 = createValueNode(pCxt, TSDB_DATA_TYPE_UBIGINT, &yymsp[0].minor.yy0); }
-  yymsp[0].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createValueNode(pCxt, TSDB_DATA_TYPE_UBIGINT, &yymsp[0].minor.yy0); }
+  yymsp[0].minor.yy698 = yylhsminor.yy698;
         break;
       case 383: /* signed ::= NK_PLUS NK_INTEGER */
-{ yymsp[-1].minor.yy452 = createValueNode(pCxt, TSDB_DATA_TYPE_UBIGINT, &yymsp[0].minor.yy0); }
+{ yymsp[-1].minor.yy698 = createValueNode(pCxt, TSDB_DATA_TYPE_UBIGINT, &yymsp[0].minor.yy0); }
         break;
       case 384: /* signed ::= NK_MINUS NK_INTEGER */
 { 
                                                                                     SToken t = yymsp[-1].minor.yy0;
                                                                                     t.n = (yymsp[0].minor.yy0.z + yymsp[0].minor.yy0.n) - yymsp[-1].minor.yy0.z;
-                                                                                    yylhsminor.yy452 = createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &t);
+                                                                                    yylhsminor.yy698 = createValueNode(pCxt, TSDB_DATA_TYPE_BIGINT, &t);
                                                                                   }
-  yymsp[-1].minor.yy452 = yylhsminor.yy452;
+  yymsp[-1].minor.yy698 = yylhsminor.yy698;
         break;
       case 385: /* signed ::= NK_FLOAT */
-{ yylhsminor.yy452 = createValueNode(pCxt, TSDB_DATA_TYPE_DOUBLE, &yymsp[0].minor.yy0); }
-  yymsp[0].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createValueNode(pCxt, TSDB_DATA_TYPE_DOUBLE, &yymsp[0].minor.yy0); }
+  yymsp[0].minor.yy698 = yylhsminor.yy698;
         break;
       case 386: /* signed ::= NK_PLUS NK_FLOAT */
-{ yymsp[-1].minor.yy452 = createValueNode(pCxt, TSDB_DATA_TYPE_DOUBLE, &yymsp[0].minor.yy0); }
+{ yymsp[-1].minor.yy698 = createValueNode(pCxt, TSDB_DATA_TYPE_DOUBLE, &yymsp[0].minor.yy0); }
         break;
       case 387: /* signed ::= NK_MINUS NK_FLOAT */
 { 
                                                                                     SToken t = yymsp[-1].minor.yy0;
                                                                                     t.n = (yymsp[0].minor.yy0.z + yymsp[0].minor.yy0.n) - yymsp[-1].minor.yy0.z;
-                                                                                    yylhsminor.yy452 = createValueNode(pCxt, TSDB_DATA_TYPE_DOUBLE, &t);
+                                                                                    yylhsminor.yy698 = createValueNode(pCxt, TSDB_DATA_TYPE_DOUBLE, &t);
                                                                                   }
-  yymsp[-1].minor.yy452 = yylhsminor.yy452;
+  yymsp[-1].minor.yy698 = yylhsminor.yy698;
         break;
       case 389: /* signed_literal ::= NK_STRING */
-{ yylhsminor.yy452 = createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[0].minor.yy0); }
-  yymsp[0].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[0].minor.yy0); }
+  yymsp[0].minor.yy698 = yylhsminor.yy698;
         break;
       case 390: /* signed_literal ::= NK_BOOL */
-{ yylhsminor.yy452 = createValueNode(pCxt, TSDB_DATA_TYPE_BOOL, &yymsp[0].minor.yy0); }
-  yymsp[0].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createValueNode(pCxt, TSDB_DATA_TYPE_BOOL, &yymsp[0].minor.yy0); }
+  yymsp[0].minor.yy698 = yylhsminor.yy698;
         break;
       case 391: /* signed_literal ::= TIMESTAMP NK_STRING */
-{ yymsp[-1].minor.yy452 = createValueNode(pCxt, TSDB_DATA_TYPE_TIMESTAMP, &yymsp[0].minor.yy0); }
+{ yymsp[-1].minor.yy698 = createValueNode(pCxt, TSDB_DATA_TYPE_TIMESTAMP, &yymsp[0].minor.yy0); }
         break;
       case 392: /* signed_literal ::= duration_literal */
       case 394: /* signed_literal ::= literal_func */ yytestcase(yyruleno==394);
       case 465: /* star_func_para ::= expr_or_subquery */ yytestcase(yyruleno==465);
-      case 527: /* select_item ::= common_expression */ yytestcase(yyruleno==527);
-      case 537: /* partition_item ::= expr_or_subquery */ yytestcase(yyruleno==537);
-      case 575: /* query_simple_or_subquery ::= subquery */ yytestcase(yyruleno==575);
-      case 577: /* query_or_subquery ::= subquery */ yytestcase(yyruleno==577);
-      case 590: /* search_condition ::= common_expression */ yytestcase(yyruleno==590);
-{ yylhsminor.yy452 = releaseRawExprNode(pCxt, yymsp[0].minor.yy452); }
-  yymsp[0].minor.yy452 = yylhsminor.yy452;
+      case 529: /* select_item ::= common_expression */ yytestcase(yyruleno==529);
+      case 539: /* partition_item ::= expr_or_subquery */ yytestcase(yyruleno==539);
+      case 577: /* query_simple_or_subquery ::= subquery */ yytestcase(yyruleno==577);
+      case 579: /* query_or_subquery ::= subquery */ yytestcase(yyruleno==579);
+      case 592: /* search_condition ::= common_expression */ yytestcase(yyruleno==592);
+{ yylhsminor.yy698 = releaseRawExprNode(pCxt, yymsp[0].minor.yy698); }
+  yymsp[0].minor.yy698 = yylhsminor.yy698;
         break;
       case 393: /* signed_literal ::= NULL */
-{ yylhsminor.yy452 = createValueNode(pCxt, TSDB_DATA_TYPE_NULL, &yymsp[0].minor.yy0); }
-  yymsp[0].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createValueNode(pCxt, TSDB_DATA_TYPE_NULL, &yymsp[0].minor.yy0); }
+  yymsp[0].minor.yy698 = yylhsminor.yy698;
         break;
       case 395: /* signed_literal ::= NK_QUESTION */
-{ yylhsminor.yy452 = createPlaceholderValueNode(pCxt, &yymsp[0].minor.yy0); }
-  yymsp[0].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createPlaceholderValueNode(pCxt, &yymsp[0].minor.yy0); }
+  yymsp[0].minor.yy698 = yylhsminor.yy698;
         break;
       case 415: /* expression ::= NK_LP expression NK_RP */
       case 499: /* boolean_primary ::= NK_LP boolean_value_expression NK_RP */ yytestcase(yyruleno==499);
-      case 589: /* subquery ::= NK_LP subquery NK_RP */ yytestcase(yyruleno==589);
-{ yylhsminor.yy452 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy0, &yymsp[0].minor.yy0, releaseRawExprNode(pCxt, yymsp[-1].minor.yy452)); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+      case 591: /* subquery ::= NK_LP subquery NK_RP */ yytestcase(yyruleno==591);
+{ yylhsminor.yy698 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy0, &yymsp[0].minor.yy0, releaseRawExprNode(pCxt, yymsp[-1].minor.yy698)); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 416: /* expression ::= NK_PLUS expr_or_subquery */
 {
-                                                                                    SToken t = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy452);
-                                                                                    yylhsminor.yy452 = createRawExprNodeExt(pCxt, &yymsp[-1].minor.yy0, &t, releaseRawExprNode(pCxt, yymsp[0].minor.yy452));
+                                                                                    SToken t = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy698);
+                                                                                    yylhsminor.yy698 = createRawExprNodeExt(pCxt, &yymsp[-1].minor.yy0, &t, releaseRawExprNode(pCxt, yymsp[0].minor.yy698));
                                                                                   }
-  yymsp[-1].minor.yy452 = yylhsminor.yy452;
+  yymsp[-1].minor.yy698 = yylhsminor.yy698;
         break;
       case 417: /* expression ::= NK_MINUS expr_or_subquery */
 {
-                                                                                    SToken t = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy452);
-                                                                                    yylhsminor.yy452 = createRawExprNodeExt(pCxt, &yymsp[-1].minor.yy0, &t, createOperatorNode(pCxt, OP_TYPE_MINUS, releaseRawExprNode(pCxt, yymsp[0].minor.yy452), NULL));
+                                                                                    SToken t = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy698);
+                                                                                    yylhsminor.yy698 = createRawExprNodeExt(pCxt, &yymsp[-1].minor.yy0, &t, createOperatorNode(pCxt, OP_TYPE_MINUS, releaseRawExprNode(pCxt, yymsp[0].minor.yy698), NULL));
                                                                                   }
-  yymsp[-1].minor.yy452 = yylhsminor.yy452;
+  yymsp[-1].minor.yy698 = yylhsminor.yy698;
         break;
       case 418: /* expression ::= expr_or_subquery NK_PLUS expr_or_subquery */
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy452);
-                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy452);
-                                                                                    yylhsminor.yy452 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_ADD, releaseRawExprNode(pCxt, yymsp[-2].minor.yy452), releaseRawExprNode(pCxt, yymsp[0].minor.yy452))); 
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy698);
+                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy698);
+                                                                                    yylhsminor.yy698 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_ADD, releaseRawExprNode(pCxt, yymsp[-2].minor.yy698), releaseRawExprNode(pCxt, yymsp[0].minor.yy698))); 
                                                                                   }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 419: /* expression ::= expr_or_subquery NK_MINUS expr_or_subquery */
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy452);
-                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy452);
-                                                                                    yylhsminor.yy452 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_SUB, releaseRawExprNode(pCxt, yymsp[-2].minor.yy452), releaseRawExprNode(pCxt, yymsp[0].minor.yy452))); 
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy698);
+                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy698);
+                                                                                    yylhsminor.yy698 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_SUB, releaseRawExprNode(pCxt, yymsp[-2].minor.yy698), releaseRawExprNode(pCxt, yymsp[0].minor.yy698))); 
                                                                                   }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 420: /* expression ::= expr_or_subquery NK_STAR expr_or_subquery */
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy452);
-                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy452);
-                                                                                    yylhsminor.yy452 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_MULTI, releaseRawExprNode(pCxt, yymsp[-2].minor.yy452), releaseRawExprNode(pCxt, yymsp[0].minor.yy452))); 
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy698);
+                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy698);
+                                                                                    yylhsminor.yy698 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_MULTI, releaseRawExprNode(pCxt, yymsp[-2].minor.yy698), releaseRawExprNode(pCxt, yymsp[0].minor.yy698))); 
                                                                                   }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 421: /* expression ::= expr_or_subquery NK_SLASH expr_or_subquery */
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy452);
-                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy452);
-                                                                                    yylhsminor.yy452 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_DIV, releaseRawExprNode(pCxt, yymsp[-2].minor.yy452), releaseRawExprNode(pCxt, yymsp[0].minor.yy452))); 
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy698);
+                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy698);
+                                                                                    yylhsminor.yy698 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_DIV, releaseRawExprNode(pCxt, yymsp[-2].minor.yy698), releaseRawExprNode(pCxt, yymsp[0].minor.yy698))); 
                                                                                   }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 422: /* expression ::= expr_or_subquery NK_REM expr_or_subquery */
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy452);
-                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy452);
-                                                                                    yylhsminor.yy452 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_REM, releaseRawExprNode(pCxt, yymsp[-2].minor.yy452), releaseRawExprNode(pCxt, yymsp[0].minor.yy452)));
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy698);
+                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy698);
+                                                                                    yylhsminor.yy698 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_REM, releaseRawExprNode(pCxt, yymsp[-2].minor.yy698), releaseRawExprNode(pCxt, yymsp[0].minor.yy698)));
                                                                                   }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 423: /* expression ::= column_reference NK_ARROW NK_STRING */
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy452);
-                                                                                    yylhsminor.yy452 = createRawExprNodeExt(pCxt, &s, &yymsp[0].minor.yy0, createOperatorNode(pCxt, OP_TYPE_JSON_GET_VALUE, releaseRawExprNode(pCxt, yymsp[-2].minor.yy452), createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[0].minor.yy0))); 
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy698);
+                                                                                    yylhsminor.yy698 = createRawExprNodeExt(pCxt, &s, &yymsp[0].minor.yy0, createOperatorNode(pCxt, OP_TYPE_JSON_GET_VALUE, releaseRawExprNode(pCxt, yymsp[-2].minor.yy698), createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[0].minor.yy0))); 
                                                                                   }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 424: /* expression ::= expr_or_subquery NK_BITAND expr_or_subquery */
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy452);
-                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy452);
-                                                                                    yylhsminor.yy452 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_BIT_AND, releaseRawExprNode(pCxt, yymsp[-2].minor.yy452), releaseRawExprNode(pCxt, yymsp[0].minor.yy452)));
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy698);
+                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy698);
+                                                                                    yylhsminor.yy698 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_BIT_AND, releaseRawExprNode(pCxt, yymsp[-2].minor.yy698), releaseRawExprNode(pCxt, yymsp[0].minor.yy698)));
                                                                                   }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 425: /* expression ::= expr_or_subquery NK_BITOR expr_or_subquery */
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy452);
-                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy452);
-                                                                                    yylhsminor.yy452 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_BIT_OR, releaseRawExprNode(pCxt, yymsp[-2].minor.yy452), releaseRawExprNode(pCxt, yymsp[0].minor.yy452)));
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy698);
+                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy698);
+                                                                                    yylhsminor.yy698 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, OP_TYPE_BIT_OR, releaseRawExprNode(pCxt, yymsp[-2].minor.yy698), releaseRawExprNode(pCxt, yymsp[0].minor.yy698)));
                                                                                   }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 428: /* column_reference ::= column_name */
-{ yylhsminor.yy452 = createRawExprNode(pCxt, &yymsp[0].minor.yy371, createColumnNode(pCxt, NULL, &yymsp[0].minor.yy371)); }
-  yymsp[0].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createRawExprNode(pCxt, &yymsp[0].minor.yy731, createColumnNode(pCxt, NULL, &yymsp[0].minor.yy731)); }
+  yymsp[0].minor.yy698 = yylhsminor.yy698;
         break;
       case 429: /* column_reference ::= table_name NK_DOT column_name */
-{ yylhsminor.yy452 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy371, &yymsp[0].minor.yy371, createColumnNode(pCxt, &yymsp[-2].minor.yy371, &yymsp[0].minor.yy371)); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy731, &yymsp[0].minor.yy731, createColumnNode(pCxt, &yymsp[-2].minor.yy731, &yymsp[0].minor.yy731)); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 430: /* pseudo_column ::= ROWTS */
       case 431: /* pseudo_column ::= TBNAME */ yytestcase(yyruleno==431);
@@ -5844,334 +5850,340 @@ static YYACTIONTYPE yy_reduce(
       case 440: /* pseudo_column ::= ISFILLED */ yytestcase(yyruleno==440);
       case 441: /* pseudo_column ::= QTAGS */ yytestcase(yyruleno==441);
       case 447: /* literal_func ::= NOW */ yytestcase(yyruleno==447);
-{ yylhsminor.yy452 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createFunctionNode(pCxt, &yymsp[0].minor.yy0, NULL)); }
-  yymsp[0].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createRawExprNode(pCxt, &yymsp[0].minor.yy0, createFunctionNode(pCxt, &yymsp[0].minor.yy0, NULL)); }
+  yymsp[0].minor.yy698 = yylhsminor.yy698;
         break;
       case 432: /* pseudo_column ::= table_name NK_DOT TBNAME */
-{ yylhsminor.yy452 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy371, &yymsp[0].minor.yy0, createFunctionNode(pCxt, &yymsp[0].minor.yy0, createNodeList(pCxt, createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[-2].minor.yy371)))); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy731, &yymsp[0].minor.yy0, createFunctionNode(pCxt, &yymsp[0].minor.yy0, createNodeList(pCxt, createValueNode(pCxt, TSDB_DATA_TYPE_BINARY, &yymsp[-2].minor.yy731)))); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 442: /* function_expression ::= function_name NK_LP expression_list NK_RP */
       case 443: /* function_expression ::= star_func NK_LP star_func_para_list NK_RP */ yytestcase(yyruleno==443);
-{ yylhsminor.yy452 = createRawExprNodeExt(pCxt, &yymsp[-3].minor.yy371, &yymsp[0].minor.yy0, createFunctionNode(pCxt, &yymsp[-3].minor.yy371, yymsp[-1].minor.yy812)); }
-  yymsp[-3].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createRawExprNodeExt(pCxt, &yymsp[-3].minor.yy731, &yymsp[0].minor.yy0, createFunctionNode(pCxt, &yymsp[-3].minor.yy731, yymsp[-1].minor.yy88)); }
+  yymsp[-3].minor.yy698 = yylhsminor.yy698;
         break;
       case 444: /* function_expression ::= CAST NK_LP expr_or_subquery AS type_name NK_RP */
-{ yylhsminor.yy452 = createRawExprNodeExt(pCxt, &yymsp[-5].minor.yy0, &yymsp[0].minor.yy0, createCastFunctionNode(pCxt, releaseRawExprNode(pCxt, yymsp[-3].minor.yy452), yymsp[-1].minor.yy310)); }
-  yymsp[-5].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createRawExprNodeExt(pCxt, &yymsp[-5].minor.yy0, &yymsp[0].minor.yy0, createCastFunctionNode(pCxt, releaseRawExprNode(pCxt, yymsp[-3].minor.yy698), yymsp[-1].minor.yy394)); }
+  yymsp[-5].minor.yy698 = yylhsminor.yy698;
         break;
       case 446: /* literal_func ::= noarg_func NK_LP NK_RP */
-{ yylhsminor.yy452 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy371, &yymsp[0].minor.yy0, createFunctionNode(pCxt, &yymsp[-2].minor.yy371, NULL)); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy731, &yymsp[0].minor.yy0, createFunctionNode(pCxt, &yymsp[-2].minor.yy731, NULL)); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 461: /* star_func_para_list ::= NK_STAR */
-{ yylhsminor.yy812 = createNodeList(pCxt, createColumnNode(pCxt, NULL, &yymsp[0].minor.yy0)); }
-  yymsp[0].minor.yy812 = yylhsminor.yy812;
+{ yylhsminor.yy88 = createNodeList(pCxt, createColumnNode(pCxt, NULL, &yymsp[0].minor.yy0)); }
+  yymsp[0].minor.yy88 = yylhsminor.yy88;
         break;
       case 466: /* star_func_para ::= table_name NK_DOT NK_STAR */
-      case 530: /* select_item ::= table_name NK_DOT NK_STAR */ yytestcase(yyruleno==530);
-{ yylhsminor.yy452 = createColumnNode(pCxt, &yymsp[-2].minor.yy371, &yymsp[0].minor.yy0); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+      case 532: /* select_item ::= table_name NK_DOT NK_STAR */ yytestcase(yyruleno==532);
+{ yylhsminor.yy698 = createColumnNode(pCxt, &yymsp[-2].minor.yy731, &yymsp[0].minor.yy0); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 467: /* case_when_expression ::= CASE when_then_list case_when_else_opt END */
-{ yylhsminor.yy452 = createRawExprNodeExt(pCxt, &yymsp[-3].minor.yy0, &yymsp[0].minor.yy0, createCaseWhenNode(pCxt, NULL, yymsp[-2].minor.yy812, yymsp[-1].minor.yy452)); }
-  yymsp[-3].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createRawExprNodeExt(pCxt, &yymsp[-3].minor.yy0, &yymsp[0].minor.yy0, createCaseWhenNode(pCxt, NULL, yymsp[-2].minor.yy88, yymsp[-1].minor.yy698)); }
+  yymsp[-3].minor.yy698 = yylhsminor.yy698;
         break;
       case 468: /* case_when_expression ::= CASE common_expression when_then_list case_when_else_opt END */
-{ yylhsminor.yy452 = createRawExprNodeExt(pCxt, &yymsp[-4].minor.yy0, &yymsp[0].minor.yy0, createCaseWhenNode(pCxt, releaseRawExprNode(pCxt, yymsp[-3].minor.yy452), yymsp[-2].minor.yy812, yymsp[-1].minor.yy452)); }
-  yymsp[-4].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createRawExprNodeExt(pCxt, &yymsp[-4].minor.yy0, &yymsp[0].minor.yy0, createCaseWhenNode(pCxt, releaseRawExprNode(pCxt, yymsp[-3].minor.yy698), yymsp[-2].minor.yy88, yymsp[-1].minor.yy698)); }
+  yymsp[-4].minor.yy698 = yylhsminor.yy698;
         break;
       case 471: /* when_then_expr ::= WHEN common_expression THEN common_expression */
-{ yymsp[-3].minor.yy452 = createWhenThenNode(pCxt, releaseRawExprNode(pCxt, yymsp[-2].minor.yy452), releaseRawExprNode(pCxt, yymsp[0].minor.yy452)); }
+{ yymsp[-3].minor.yy698 = createWhenThenNode(pCxt, releaseRawExprNode(pCxt, yymsp[-2].minor.yy698), releaseRawExprNode(pCxt, yymsp[0].minor.yy698)); }
         break;
       case 473: /* case_when_else_opt ::= ELSE common_expression */
-{ yymsp[-1].minor.yy452 = releaseRawExprNode(pCxt, yymsp[0].minor.yy452); }
+{ yymsp[-1].minor.yy698 = releaseRawExprNode(pCxt, yymsp[0].minor.yy698); }
         break;
       case 474: /* predicate ::= expr_or_subquery compare_op expr_or_subquery */
       case 479: /* predicate ::= expr_or_subquery in_op in_predicate_value */ yytestcase(yyruleno==479);
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy452);
-                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy452);
-                                                                                    yylhsminor.yy452 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, yymsp[-1].minor.yy354, releaseRawExprNode(pCxt, yymsp[-2].minor.yy452), releaseRawExprNode(pCxt, yymsp[0].minor.yy452)));
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy698);
+                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy698);
+                                                                                    yylhsminor.yy698 = createRawExprNodeExt(pCxt, &s, &e, createOperatorNode(pCxt, yymsp[-1].minor.yy464, releaseRawExprNode(pCxt, yymsp[-2].minor.yy698), releaseRawExprNode(pCxt, yymsp[0].minor.yy698)));
                                                                                   }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 475: /* predicate ::= expr_or_subquery BETWEEN expr_or_subquery AND expr_or_subquery */
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-4].minor.yy452);
-                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy452);
-                                                                                    yylhsminor.yy452 = createRawExprNodeExt(pCxt, &s, &e, createBetweenAnd(pCxt, releaseRawExprNode(pCxt, yymsp[-4].minor.yy452), releaseRawExprNode(pCxt, yymsp[-2].minor.yy452), releaseRawExprNode(pCxt, yymsp[0].minor.yy452)));
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-4].minor.yy698);
+                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy698);
+                                                                                    yylhsminor.yy698 = createRawExprNodeExt(pCxt, &s, &e, createBetweenAnd(pCxt, releaseRawExprNode(pCxt, yymsp[-4].minor.yy698), releaseRawExprNode(pCxt, yymsp[-2].minor.yy698), releaseRawExprNode(pCxt, yymsp[0].minor.yy698)));
                                                                                   }
-  yymsp[-4].minor.yy452 = yylhsminor.yy452;
+  yymsp[-4].minor.yy698 = yylhsminor.yy698;
         break;
       case 476: /* predicate ::= expr_or_subquery NOT BETWEEN expr_or_subquery AND expr_or_subquery */
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-5].minor.yy452);
-                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy452);
-                                                                                    yylhsminor.yy452 = createRawExprNodeExt(pCxt, &s, &e, createNotBetweenAnd(pCxt, releaseRawExprNode(pCxt, yymsp[-5].minor.yy452), releaseRawExprNode(pCxt, yymsp[-2].minor.yy452), releaseRawExprNode(pCxt, yymsp[0].minor.yy452)));
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-5].minor.yy698);
+                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy698);
+                                                                                    yylhsminor.yy698 = createRawExprNodeExt(pCxt, &s, &e, createNotBetweenAnd(pCxt, releaseRawExprNode(pCxt, yymsp[-5].minor.yy698), releaseRawExprNode(pCxt, yymsp[-2].minor.yy698), releaseRawExprNode(pCxt, yymsp[0].minor.yy698)));
                                                                                   }
-  yymsp[-5].minor.yy452 = yylhsminor.yy452;
+  yymsp[-5].minor.yy698 = yylhsminor.yy698;
         break;
       case 477: /* predicate ::= expr_or_subquery IS NULL */
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy452);
-                                                                                    yylhsminor.yy452 = createRawExprNodeExt(pCxt, &s, &yymsp[0].minor.yy0, createOperatorNode(pCxt, OP_TYPE_IS_NULL, releaseRawExprNode(pCxt, yymsp[-2].minor.yy452), NULL));
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy698);
+                                                                                    yylhsminor.yy698 = createRawExprNodeExt(pCxt, &s, &yymsp[0].minor.yy0, createOperatorNode(pCxt, OP_TYPE_IS_NULL, releaseRawExprNode(pCxt, yymsp[-2].minor.yy698), NULL));
                                                                                   }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 478: /* predicate ::= expr_or_subquery IS NOT NULL */
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-3].minor.yy452);
-                                                                                    yylhsminor.yy452 = createRawExprNodeExt(pCxt, &s, &yymsp[0].minor.yy0, createOperatorNode(pCxt, OP_TYPE_IS_NOT_NULL, releaseRawExprNode(pCxt, yymsp[-3].minor.yy452), NULL));
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-3].minor.yy698);
+                                                                                    yylhsminor.yy698 = createRawExprNodeExt(pCxt, &s, &yymsp[0].minor.yy0, createOperatorNode(pCxt, OP_TYPE_IS_NOT_NULL, releaseRawExprNode(pCxt, yymsp[-3].minor.yy698), NULL));
                                                                                   }
-  yymsp[-3].minor.yy452 = yylhsminor.yy452;
+  yymsp[-3].minor.yy698 = yylhsminor.yy698;
         break;
       case 480: /* compare_op ::= NK_LT */
-{ yymsp[0].minor.yy354 = OP_TYPE_LOWER_THAN; }
+{ yymsp[0].minor.yy464 = OP_TYPE_LOWER_THAN; }
         break;
       case 481: /* compare_op ::= NK_GT */
-{ yymsp[0].minor.yy354 = OP_TYPE_GREATER_THAN; }
+{ yymsp[0].minor.yy464 = OP_TYPE_GREATER_THAN; }
         break;
       case 482: /* compare_op ::= NK_LE */
-{ yymsp[0].minor.yy354 = OP_TYPE_LOWER_EQUAL; }
+{ yymsp[0].minor.yy464 = OP_TYPE_LOWER_EQUAL; }
         break;
       case 483: /* compare_op ::= NK_GE */
-{ yymsp[0].minor.yy354 = OP_TYPE_GREATER_EQUAL; }
+{ yymsp[0].minor.yy464 = OP_TYPE_GREATER_EQUAL; }
         break;
       case 484: /* compare_op ::= NK_NE */
-{ yymsp[0].minor.yy354 = OP_TYPE_NOT_EQUAL; }
+{ yymsp[0].minor.yy464 = OP_TYPE_NOT_EQUAL; }
         break;
       case 485: /* compare_op ::= NK_EQ */
-{ yymsp[0].minor.yy354 = OP_TYPE_EQUAL; }
+{ yymsp[0].minor.yy464 = OP_TYPE_EQUAL; }
         break;
       case 486: /* compare_op ::= LIKE */
-{ yymsp[0].minor.yy354 = OP_TYPE_LIKE; }
+{ yymsp[0].minor.yy464 = OP_TYPE_LIKE; }
         break;
       case 487: /* compare_op ::= NOT LIKE */
-{ yymsp[-1].minor.yy354 = OP_TYPE_NOT_LIKE; }
+{ yymsp[-1].minor.yy464 = OP_TYPE_NOT_LIKE; }
         break;
       case 488: /* compare_op ::= MATCH */
-{ yymsp[0].minor.yy354 = OP_TYPE_MATCH; }
+{ yymsp[0].minor.yy464 = OP_TYPE_MATCH; }
         break;
       case 489: /* compare_op ::= NMATCH */
-{ yymsp[0].minor.yy354 = OP_TYPE_NMATCH; }
+{ yymsp[0].minor.yy464 = OP_TYPE_NMATCH; }
         break;
       case 490: /* compare_op ::= CONTAINS */
-{ yymsp[0].minor.yy354 = OP_TYPE_JSON_CONTAINS; }
+{ yymsp[0].minor.yy464 = OP_TYPE_JSON_CONTAINS; }
         break;
       case 491: /* in_op ::= IN */
-{ yymsp[0].minor.yy354 = OP_TYPE_IN; }
+{ yymsp[0].minor.yy464 = OP_TYPE_IN; }
         break;
       case 492: /* in_op ::= NOT IN */
-{ yymsp[-1].minor.yy354 = OP_TYPE_NOT_IN; }
+{ yymsp[-1].minor.yy464 = OP_TYPE_NOT_IN; }
         break;
       case 493: /* in_predicate_value ::= NK_LP literal_list NK_RP */
-{ yylhsminor.yy452 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy0, &yymsp[0].minor.yy0, createNodeListNode(pCxt, yymsp[-1].minor.yy812)); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy0, &yymsp[0].minor.yy0, createNodeListNode(pCxt, yymsp[-1].minor.yy88)); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 495: /* boolean_value_expression ::= NOT boolean_primary */
 {
-                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy452);
-                                                                                    yylhsminor.yy452 = createRawExprNodeExt(pCxt, &yymsp[-1].minor.yy0, &e, createLogicConditionNode(pCxt, LOGIC_COND_TYPE_NOT, releaseRawExprNode(pCxt, yymsp[0].minor.yy452), NULL));
+                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy698);
+                                                                                    yylhsminor.yy698 = createRawExprNodeExt(pCxt, &yymsp[-1].minor.yy0, &e, createLogicConditionNode(pCxt, LOGIC_COND_TYPE_NOT, releaseRawExprNode(pCxt, yymsp[0].minor.yy698), NULL));
                                                                                   }
-  yymsp[-1].minor.yy452 = yylhsminor.yy452;
+  yymsp[-1].minor.yy698 = yylhsminor.yy698;
         break;
       case 496: /* boolean_value_expression ::= boolean_value_expression OR boolean_value_expression */
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy452);
-                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy452);
-                                                                                    yylhsminor.yy452 = createRawExprNodeExt(pCxt, &s, &e, createLogicConditionNode(pCxt, LOGIC_COND_TYPE_OR, releaseRawExprNode(pCxt, yymsp[-2].minor.yy452), releaseRawExprNode(pCxt, yymsp[0].minor.yy452)));
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy698);
+                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy698);
+                                                                                    yylhsminor.yy698 = createRawExprNodeExt(pCxt, &s, &e, createLogicConditionNode(pCxt, LOGIC_COND_TYPE_OR, releaseRawExprNode(pCxt, yymsp[-2].minor.yy698), releaseRawExprNode(pCxt, yymsp[0].minor.yy698)));
                                                                                   }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 497: /* boolean_value_expression ::= boolean_value_expression AND boolean_value_expression */
 {
-                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy452);
-                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy452);
-                                                                                    yylhsminor.yy452 = createRawExprNodeExt(pCxt, &s, &e, createLogicConditionNode(pCxt, LOGIC_COND_TYPE_AND, releaseRawExprNode(pCxt, yymsp[-2].minor.yy452), releaseRawExprNode(pCxt, yymsp[0].minor.yy452)));
+                                                                                    SToken s = getTokenFromRawExprNode(pCxt, yymsp[-2].minor.yy698);
+                                                                                    SToken e = getTokenFromRawExprNode(pCxt, yymsp[0].minor.yy698);
+                                                                                    yylhsminor.yy698 = createRawExprNodeExt(pCxt, &s, &e, createLogicConditionNode(pCxt, LOGIC_COND_TYPE_AND, releaseRawExprNode(pCxt, yymsp[-2].minor.yy698), releaseRawExprNode(pCxt, yymsp[0].minor.yy698)));
                                                                                   }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 505: /* table_reference_list ::= table_reference_list NK_COMMA table_reference */
-{ yylhsminor.yy452 = createJoinTableNode(pCxt, JOIN_TYPE_INNER, yymsp[-2].minor.yy452, yymsp[0].minor.yy452, NULL); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createJoinTableNode(pCxt, JOIN_TYPE_INNER, yymsp[-2].minor.yy698, yymsp[0].minor.yy698, NULL); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
       case 508: /* table_primary ::= table_name alias_opt */
-{ yylhsminor.yy452 = createRealTableNode(pCxt, NULL, &yymsp[-1].minor.yy371, &yymsp[0].minor.yy371); }
-  yymsp[-1].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createRealTableNode(pCxt, NULL, &yymsp[-1].minor.yy731, &yymsp[0].minor.yy731); }
+  yymsp[-1].minor.yy698 = yylhsminor.yy698;
         break;
       case 509: /* table_primary ::= db_name NK_DOT table_name alias_opt */
-{ yylhsminor.yy452 = createRealTableNode(pCxt, &yymsp[-3].minor.yy371, &yymsp[-1].minor.yy371, &yymsp[0].minor.yy371); }
-  yymsp[-3].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createRealTableNode(pCxt, &yymsp[-3].minor.yy731, &yymsp[-1].minor.yy731, &yymsp[0].minor.yy731); }
+  yymsp[-3].minor.yy698 = yylhsminor.yy698;
         break;
       case 510: /* table_primary ::= subquery alias_opt */
-{ yylhsminor.yy452 = createTempTableNode(pCxt, releaseRawExprNode(pCxt, yymsp[-1].minor.yy452), &yymsp[0].minor.yy371); }
-  yymsp[-1].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createTempTableNode(pCxt, releaseRawExprNode(pCxt, yymsp[-1].minor.yy698), &yymsp[0].minor.yy731); }
+  yymsp[-1].minor.yy698 = yylhsminor.yy698;
         break;
       case 512: /* alias_opt ::= */
-{ yymsp[1].minor.yy371 = nil_token;  }
+{ yymsp[1].minor.yy731 = nil_token;  }
         break;
       case 514: /* alias_opt ::= AS table_alias */
-{ yymsp[-1].minor.yy371 = yymsp[0].minor.yy371; }
+{ yymsp[-1].minor.yy731 = yymsp[0].minor.yy731; }
         break;
       case 515: /* parenthesized_joined_table ::= NK_LP joined_table NK_RP */
       case 516: /* parenthesized_joined_table ::= NK_LP parenthesized_joined_table NK_RP */ yytestcase(yyruleno==516);
-{ yymsp[-2].minor.yy452 = yymsp[-1].minor.yy452; }
+{ yymsp[-2].minor.yy698 = yymsp[-1].minor.yy698; }
         break;
       case 517: /* joined_table ::= table_reference join_type JOIN table_reference ON search_condition */
-{ yylhsminor.yy452 = createJoinTableNode(pCxt, yymsp[-4].minor.yy140, yymsp[-5].minor.yy452, yymsp[-2].minor.yy452, yymsp[0].minor.yy452); }
-  yymsp[-5].minor.yy452 = yylhsminor.yy452;
+{ yylhsminor.yy698 = createJoinTableNode(pCxt, yymsp[-4].minor.yy24, yymsp[-5].minor.yy698, yymsp[-2].minor.yy698, yymsp[0].minor.yy698); }
+  yymsp[-5].minor.yy698 = yylhsminor.yy698;
         break;
       case 518: /* join_type ::= */
-{ yymsp[1].minor.yy140 = JOIN_TYPE_INNER; }
+{ yymsp[1].minor.yy24 = JOIN_TYPE_INNER; }
         break;
       case 519: /* join_type ::= INNER */
-{ yymsp[0].minor.yy140 = JOIN_TYPE_INNER; }
+{ yymsp[0].minor.yy24 = JOIN_TYPE_INNER; }
+        break;
+      case 520: /* join_type ::= LEFT */
+{ yymsp[0].minor.yy24 = JOIN_TYPE_LEFT; }
+        break;
+      case 521: /* join_type ::= LEFT OUTER */
+{ yymsp[-1].minor.yy24 = JOIN_TYPE_LEFT; }
         break;
-      case 520: /* query_specification ::= SELECT set_quantifier_opt select_list from_clause_opt where_clause_opt partition_by_clause_opt range_opt every_opt fill_opt twindow_clause_opt group_by_clause_opt having_clause_opt */
+      case 522: /* query_specification ::= SELECT set_quantifier_opt select_list from_clause_opt where_clause_opt partition_by_clause_opt range_opt every_opt fill_opt twindow_clause_opt group_by_clause_opt having_clause_opt */
 { 
-                                                                                    yymsp[-11].minor.yy452 = createSelectStmt(pCxt, yymsp[-10].minor.yy667, yymsp[-9].minor.yy812, yymsp[-8].minor.yy452);
-                                                                                    yymsp[-11].minor.yy452 = addWhereClause(pCxt, yymsp[-11].minor.yy452, yymsp[-7].minor.yy452);
-                                                                                    yymsp[-11].minor.yy452 = addPartitionByClause(pCxt, yymsp[-11].minor.yy452, yymsp[-6].minor.yy812);
-                                                                                    yymsp[-11].minor.yy452 = addWindowClauseClause(pCxt, yymsp[-11].minor.yy452, yymsp[-2].minor.yy452);
-                                                                                    yymsp[-11].minor.yy452 = addGroupByClause(pCxt, yymsp[-11].minor.yy452, yymsp[-1].minor.yy812);
-                                                                                    yymsp[-11].minor.yy452 = addHavingClause(pCxt, yymsp[-11].minor.yy452, yymsp[0].minor.yy452);
-                                                                                    yymsp[-11].minor.yy452 = addRangeClause(pCxt, yymsp[-11].minor.yy452, yymsp[-5].minor.yy452);
-                                                                                    yymsp[-11].minor.yy452 = addEveryClause(pCxt, yymsp[-11].minor.yy452, yymsp[-4].minor.yy452);
-                                                                                    yymsp[-11].minor.yy452 = addFillClause(pCxt, yymsp[-11].minor.yy452, yymsp[-3].minor.yy452);
+                                                                                    yymsp[-11].minor.yy698 = createSelectStmt(pCxt, yymsp[-10].minor.yy83, yymsp[-9].minor.yy88, yymsp[-8].minor.yy698);
+                                                                                    yymsp[-11].minor.yy698 = addWhereClause(pCxt, yymsp[-11].minor.yy698, yymsp[-7].minor.yy698);
+                                                                                    yymsp[-11].minor.yy698 = addPartitionByClause(pCxt, yymsp[-11].minor.yy698, yymsp[-6].minor.yy88);
+                                                                                    yymsp[-11].minor.yy698 = addWindowClauseClause(pCxt, yymsp[-11].minor.yy698, yymsp[-2].minor.yy698);
+                                                                                    yymsp[-11].minor.yy698 = addGroupByClause(pCxt, yymsp[-11].minor.yy698, yymsp[-1].minor.yy88);
+                                                                                    yymsp[-11].minor.yy698 = addHavingClause(pCxt, yymsp[-11].minor.yy698, yymsp[0].minor.yy698);
+                                                                                    yymsp[-11].minor.yy698 = addRangeClause(pCxt, yymsp[-11].minor.yy698, yymsp[-5].minor.yy698);
+                                                                                    yymsp[-11].minor.yy698 = addEveryClause(pCxt, yymsp[-11].minor.yy698, yymsp[-4].minor.yy698);
+                                                                                    yymsp[-11].minor.yy698 = addFillClause(pCxt, yymsp[-11].minor.yy698, yymsp[-3].minor.yy698);
                                                                                   }
         break;
-      case 523: /* set_quantifier_opt ::= ALL */
-{ yymsp[0].minor.yy667 = false; }
+      case 525: /* set_quantifier_opt ::= ALL */
+{ yymsp[0].minor.yy83 = false; }
         break;
-      case 526: /* select_item ::= NK_STAR */
-{ yylhsminor.yy452 = createColumnNode(pCxt, NULL, &yymsp[0].minor.yy0); }
-  yymsp[0].minor.yy452 = yylhsminor.yy452;
+      case 528: /* select_item ::= NK_STAR */
+{ yylhsminor.yy698 = createColumnNode(pCxt, NULL, &yymsp[0].minor.yy0); }
+  yymsp[0].minor.yy698 = yylhsminor.yy698;
         break;
-      case 528: /* select_item ::= common_expression column_alias */
-      case 538: /* partition_item ::= expr_or_subquery column_alias */ yytestcase(yyruleno==538);
-{ yylhsminor.yy452 = setProjectionAlias(pCxt, releaseRawExprNode(pCxt, yymsp[-1].minor.yy452), &yymsp[0].minor.yy371); }
-  yymsp[-1].minor.yy452 = yylhsminor.yy452;
+      case 530: /* select_item ::= common_expression column_alias */
+      case 540: /* partition_item ::= expr_or_subquery column_alias */ yytestcase(yyruleno==540);
+{ yylhsminor.yy698 = setProjectionAlias(pCxt, releaseRawExprNode(pCxt, yymsp[-1].minor.yy698), &yymsp[0].minor.yy731); }
+  yymsp[-1].minor.yy698 = yylhsminor.yy698;
         break;
-      case 529: /* select_item ::= common_expression AS column_alias */
-      case 539: /* partition_item ::= expr_or_subquery AS column_alias */ yytestcase(yyruleno==539);
-{ yylhsminor.yy452 = setProjectionAlias(pCxt, releaseRawExprNode(pCxt, yymsp[-2].minor.yy452), &yymsp[0].minor.yy371); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+      case 531: /* select_item ::= common_expression AS column_alias */
+      case 541: /* partition_item ::= expr_or_subquery AS column_alias */ yytestcase(yyruleno==541);
+{ yylhsminor.yy698 = setProjectionAlias(pCxt, releaseRawExprNode(pCxt, yymsp[-2].minor.yy698), &yymsp[0].minor.yy731); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
-      case 534: /* partition_by_clause_opt ::= PARTITION BY partition_list */
-      case 559: /* group_by_clause_opt ::= GROUP BY group_by_list */ yytestcase(yyruleno==559);
-      case 579: /* order_by_clause_opt ::= ORDER BY sort_specification_list */ yytestcase(yyruleno==579);
-{ yymsp[-2].minor.yy812 = yymsp[0].minor.yy812; }
+      case 536: /* partition_by_clause_opt ::= PARTITION BY partition_list */
+      case 561: /* group_by_clause_opt ::= GROUP BY group_by_list */ yytestcase(yyruleno==561);
+      case 581: /* order_by_clause_opt ::= ORDER BY sort_specification_list */ yytestcase(yyruleno==581);
+{ yymsp[-2].minor.yy88 = yymsp[0].minor.yy88; }
         break;
-      case 541: /* twindow_clause_opt ::= SESSION NK_LP column_reference NK_COMMA duration_literal NK_RP */
-{ yymsp[-5].minor.yy452 = createSessionWindowNode(pCxt, releaseRawExprNode(pCxt, yymsp[-3].minor.yy452), releaseRawExprNode(pCxt, yymsp[-1].minor.yy452)); }
+      case 543: /* twindow_clause_opt ::= SESSION NK_LP column_reference NK_COMMA duration_literal NK_RP */
+{ yymsp[-5].minor.yy698 = createSessionWindowNode(pCxt, releaseRawExprNode(pCxt, yymsp[-3].minor.yy698), releaseRawExprNode(pCxt, yymsp[-1].minor.yy698)); }
         break;
-      case 542: /* twindow_clause_opt ::= STATE_WINDOW NK_LP expr_or_subquery NK_RP */
-{ yymsp[-3].minor.yy452 = createStateWindowNode(pCxt, releaseRawExprNode(pCxt, yymsp[-1].minor.yy452)); }
+      case 544: /* twindow_clause_opt ::= STATE_WINDOW NK_LP expr_or_subquery NK_RP */
+{ yymsp[-3].minor.yy698 = createStateWindowNode(pCxt, releaseRawExprNode(pCxt, yymsp[-1].minor.yy698)); }
         break;
-      case 543: /* twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_RP sliding_opt fill_opt */
-{ yymsp[-5].minor.yy452 = createIntervalWindowNode(pCxt, releaseRawExprNode(pCxt, yymsp[-3].minor.yy452), NULL, yymsp[-1].minor.yy452, yymsp[0].minor.yy452); }
+      case 545: /* twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_RP sliding_opt fill_opt */
+{ yymsp[-5].minor.yy698 = createIntervalWindowNode(pCxt, releaseRawExprNode(pCxt, yymsp[-3].minor.yy698), NULL, yymsp[-1].minor.yy698, yymsp[0].minor.yy698); }
         break;
-      case 544: /* twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_COMMA duration_literal NK_RP sliding_opt fill_opt */
-{ yymsp[-7].minor.yy452 = createIntervalWindowNode(pCxt, releaseRawExprNode(pCxt, yymsp[-5].minor.yy452), releaseRawExprNode(pCxt, yymsp[-3].minor.yy452), yymsp[-1].minor.yy452, yymsp[0].minor.yy452); }
+      case 546: /* twindow_clause_opt ::= INTERVAL NK_LP duration_literal NK_COMMA duration_literal NK_RP sliding_opt fill_opt */
+{ yymsp[-7].minor.yy698 = createIntervalWindowNode(pCxt, releaseRawExprNode(pCxt, yymsp[-5].minor.yy698), releaseRawExprNode(pCxt, yymsp[-3].minor.yy698), yymsp[-1].minor.yy698, yymsp[0].minor.yy698); }
         break;
-      case 545: /* twindow_clause_opt ::= EVENT_WINDOW START WITH search_condition END WITH search_condition */
-{ yymsp[-6].minor.yy452 = createEventWindowNode(pCxt, yymsp[-3].minor.yy452, yymsp[0].minor.yy452); }
+      case 547: /* twindow_clause_opt ::= EVENT_WINDOW START WITH search_condition END WITH search_condition */
+{ yymsp[-6].minor.yy698 = createEventWindowNode(pCxt, yymsp[-3].minor.yy698, yymsp[0].minor.yy698); }
         break;
-      case 549: /* fill_opt ::= FILL NK_LP fill_mode NK_RP */
-{ yymsp[-3].minor.yy452 = createFillNode(pCxt, yymsp[-1].minor.yy844, NULL); }
+      case 551: /* fill_opt ::= FILL NK_LP fill_mode NK_RP */
+{ yymsp[-3].minor.yy698 = createFillNode(pCxt, yymsp[-1].minor.yy498, NULL); }
         break;
-      case 550: /* fill_opt ::= FILL NK_LP VALUE NK_COMMA expression_list NK_RP */
-{ yymsp[-5].minor.yy452 = createFillNode(pCxt, FILL_MODE_VALUE, createNodeListNode(pCxt, yymsp[-1].minor.yy812)); }
+      case 552: /* fill_opt ::= FILL NK_LP VALUE NK_COMMA expression_list NK_RP */
+{ yymsp[-5].minor.yy698 = createFillNode(pCxt, FILL_MODE_VALUE, createNodeListNode(pCxt, yymsp[-1].minor.yy88)); }
         break;
-      case 551: /* fill_opt ::= FILL NK_LP VALUE_F NK_COMMA expression_list NK_RP */
-{ yymsp[-5].minor.yy452 = createFillNode(pCxt, FILL_MODE_VALUE_F, createNodeListNode(pCxt, yymsp[-1].minor.yy812)); }
+      case 553: /* fill_opt ::= FILL NK_LP VALUE_F NK_COMMA expression_list NK_RP */
+{ yymsp[-5].minor.yy698 = createFillNode(pCxt, FILL_MODE_VALUE_F, createNodeListNode(pCxt, yymsp[-1].minor.yy88)); }
         break;
-      case 552: /* fill_mode ::= NONE */
-{ yymsp[0].minor.yy844 = FILL_MODE_NONE; }
+      case 554: /* fill_mode ::= NONE */
+{ yymsp[0].minor.yy498 = FILL_MODE_NONE; }
         break;
-      case 553: /* fill_mode ::= PREV */
-{ yymsp[0].minor.yy844 = FILL_MODE_PREV; }
+      case 555: /* fill_mode ::= PREV */
+{ yymsp[0].minor.yy498 = FILL_MODE_PREV; }
         break;
-      case 554: /* fill_mode ::= NULL */
-{ yymsp[0].minor.yy844 = FILL_MODE_NULL; }
+      case 556: /* fill_mode ::= NULL */
+{ yymsp[0].minor.yy498 = FILL_MODE_NULL; }
         break;
-      case 555: /* fill_mode ::= NULL_F */
-{ yymsp[0].minor.yy844 = FILL_MODE_NULL_F; }
+      case 557: /* fill_mode ::= NULL_F */
+{ yymsp[0].minor.yy498 = FILL_MODE_NULL_F; }
         break;
-      case 556: /* fill_mode ::= LINEAR */
-{ yymsp[0].minor.yy844 = FILL_MODE_LINEAR; }
+      case 558: /* fill_mode ::= LINEAR */
+{ yymsp[0].minor.yy498 = FILL_MODE_LINEAR; }
         break;
-      case 557: /* fill_mode ::= NEXT */
-{ yymsp[0].minor.yy844 = FILL_MODE_NEXT; }
+      case 559: /* fill_mode ::= NEXT */
+{ yymsp[0].minor.yy498 = FILL_MODE_NEXT; }
         break;
-      case 560: /* group_by_list ::= expr_or_subquery */
-{ yylhsminor.yy812 = createNodeList(pCxt, createGroupingSetNode(pCxt, releaseRawExprNode(pCxt, yymsp[0].minor.yy452))); }
-  yymsp[0].minor.yy812 = yylhsminor.yy812;
+      case 562: /* group_by_list ::= expr_or_subquery */
+{ yylhsminor.yy88 = createNodeList(pCxt, createGroupingSetNode(pCxt, releaseRawExprNode(pCxt, yymsp[0].minor.yy698))); }
+  yymsp[0].minor.yy88 = yylhsminor.yy88;
         break;
-      case 561: /* group_by_list ::= group_by_list NK_COMMA expr_or_subquery */
-{ yylhsminor.yy812 = addNodeToList(pCxt, yymsp[-2].minor.yy812, createGroupingSetNode(pCxt, releaseRawExprNode(pCxt, yymsp[0].minor.yy452))); }
-  yymsp[-2].minor.yy812 = yylhsminor.yy812;
+      case 563: /* group_by_list ::= group_by_list NK_COMMA expr_or_subquery */
+{ yylhsminor.yy88 = addNodeToList(pCxt, yymsp[-2].minor.yy88, createGroupingSetNode(pCxt, releaseRawExprNode(pCxt, yymsp[0].minor.yy698))); }
+  yymsp[-2].minor.yy88 = yylhsminor.yy88;
         break;
-      case 565: /* range_opt ::= RANGE NK_LP expr_or_subquery NK_COMMA expr_or_subquery NK_RP */
-{ yymsp[-5].minor.yy452 = createInterpTimeRange(pCxt, releaseRawExprNode(pCxt, yymsp[-3].minor.yy452), releaseRawExprNode(pCxt, yymsp[-1].minor.yy452)); }
+      case 567: /* range_opt ::= RANGE NK_LP expr_or_subquery NK_COMMA expr_or_subquery NK_RP */
+{ yymsp[-5].minor.yy698 = createInterpTimeRange(pCxt, releaseRawExprNode(pCxt, yymsp[-3].minor.yy698), releaseRawExprNode(pCxt, yymsp[-1].minor.yy698)); }
         break;
-      case 566: /* range_opt ::= RANGE NK_LP expr_or_subquery NK_RP */
-{ yymsp[-3].minor.yy452 = createInterpTimePoint(pCxt, releaseRawExprNode(pCxt, yymsp[-1].minor.yy452)); }
+      case 568: /* range_opt ::= RANGE NK_LP expr_or_subquery NK_RP */
+{ yymsp[-3].minor.yy698 = createInterpTimePoint(pCxt, releaseRawExprNode(pCxt, yymsp[-1].minor.yy698)); }
         break;
-      case 569: /* query_expression ::= query_simple order_by_clause_opt slimit_clause_opt limit_clause_opt */
+      case 571: /* query_expression ::= query_simple order_by_clause_opt slimit_clause_opt limit_clause_opt */
 {
-                                                                                    yylhsminor.yy452 = addOrderByClause(pCxt, yymsp[-3].minor.yy452, yymsp[-2].minor.yy812);
-                                                                                    yylhsminor.yy452 = addSlimitClause(pCxt, yylhsminor.yy452, yymsp[-1].minor.yy452);
-                                                                                    yylhsminor.yy452 = addLimitClause(pCxt, yylhsminor.yy452, yymsp[0].minor.yy452);
+                                                                                    yylhsminor.yy698 = addOrderByClause(pCxt, yymsp[-3].minor.yy698, yymsp[-2].minor.yy88);
+                                                                                    yylhsminor.yy698 = addSlimitClause(pCxt, yylhsminor.yy698, yymsp[-1].minor.yy698);
+                                                                                    yylhsminor.yy698 = addLimitClause(pCxt, yylhsminor.yy698, yymsp[0].minor.yy698);
                                                                                   }
-  yymsp[-3].minor.yy452 = yylhsminor.yy452;
+  yymsp[-3].minor.yy698 = yylhsminor.yy698;
         break;
-      case 572: /* union_query_expression ::= query_simple_or_subquery UNION ALL query_simple_or_subquery */
-{ yylhsminor.yy452 = createSetOperator(pCxt, SET_OP_TYPE_UNION_ALL, yymsp[-3].minor.yy452, yymsp[0].minor.yy452); }
-  yymsp[-3].minor.yy452 = yylhsminor.yy452;
+      case 574: /* union_query_expression ::= query_simple_or_subquery UNION ALL query_simple_or_subquery */
+{ yylhsminor.yy698 = createSetOperator(pCxt, SET_OP_TYPE_UNION_ALL, yymsp[-3].minor.yy698, yymsp[0].minor.yy698); }
+  yymsp[-3].minor.yy698 = yylhsminor.yy698;
         break;
-      case 573: /* union_query_expression ::= query_simple_or_subquery UNION query_simple_or_subquery */
-{ yylhsminor.yy452 = createSetOperator(pCxt, SET_OP_TYPE_UNION, yymsp[-2].minor.yy452, yymsp[0].minor.yy452); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+      case 575: /* union_query_expression ::= query_simple_or_subquery UNION query_simple_or_subquery */
+{ yylhsminor.yy698 = createSetOperator(pCxt, SET_OP_TYPE_UNION, yymsp[-2].minor.yy698, yymsp[0].minor.yy698); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
-      case 581: /* slimit_clause_opt ::= SLIMIT NK_INTEGER */
-      case 585: /* limit_clause_opt ::= LIMIT NK_INTEGER */ yytestcase(yyruleno==585);
-{ yymsp[-1].minor.yy452 = createLimitNode(pCxt, &yymsp[0].minor.yy0, NULL); }
+      case 583: /* slimit_clause_opt ::= SLIMIT NK_INTEGER */
+      case 587: /* limit_clause_opt ::= LIMIT NK_INTEGER */ yytestcase(yyruleno==587);
+{ yymsp[-1].minor.yy698 = createLimitNode(pCxt, &yymsp[0].minor.yy0, NULL); }
         break;
-      case 582: /* slimit_clause_opt ::= SLIMIT NK_INTEGER SOFFSET NK_INTEGER */
-      case 586: /* limit_clause_opt ::= LIMIT NK_INTEGER OFFSET NK_INTEGER */ yytestcase(yyruleno==586);
-{ yymsp[-3].minor.yy452 = createLimitNode(pCxt, &yymsp[-2].minor.yy0, &yymsp[0].minor.yy0); }
+      case 584: /* slimit_clause_opt ::= SLIMIT NK_INTEGER SOFFSET NK_INTEGER */
+      case 588: /* limit_clause_opt ::= LIMIT NK_INTEGER OFFSET NK_INTEGER */ yytestcase(yyruleno==588);
+{ yymsp[-3].minor.yy698 = createLimitNode(pCxt, &yymsp[-2].minor.yy0, &yymsp[0].minor.yy0); }
         break;
-      case 583: /* slimit_clause_opt ::= SLIMIT NK_INTEGER NK_COMMA NK_INTEGER */
-      case 587: /* limit_clause_opt ::= LIMIT NK_INTEGER NK_COMMA NK_INTEGER */ yytestcase(yyruleno==587);
-{ yymsp[-3].minor.yy452 = createLimitNode(pCxt, &yymsp[0].minor.yy0, &yymsp[-2].minor.yy0); }
+      case 585: /* slimit_clause_opt ::= SLIMIT NK_INTEGER NK_COMMA NK_INTEGER */
+      case 589: /* limit_clause_opt ::= LIMIT NK_INTEGER NK_COMMA NK_INTEGER */ yytestcase(yyruleno==589);
+{ yymsp[-3].minor.yy698 = createLimitNode(pCxt, &yymsp[0].minor.yy0, &yymsp[-2].minor.yy0); }
         break;
-      case 588: /* subquery ::= NK_LP query_expression NK_RP */
-{ yylhsminor.yy452 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy0, &yymsp[0].minor.yy0, yymsp[-1].minor.yy452); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+      case 590: /* subquery ::= NK_LP query_expression NK_RP */
+{ yylhsminor.yy698 = createRawExprNodeExt(pCxt, &yymsp[-2].minor.yy0, &yymsp[0].minor.yy0, yymsp[-1].minor.yy698); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
-      case 593: /* sort_specification ::= expr_or_subquery ordering_specification_opt null_ordering_opt */
-{ yylhsminor.yy452 = createOrderByExprNode(pCxt, releaseRawExprNode(pCxt, yymsp[-2].minor.yy452), yymsp[-1].minor.yy690, yymsp[0].minor.yy399); }
-  yymsp[-2].minor.yy452 = yylhsminor.yy452;
+      case 595: /* sort_specification ::= expr_or_subquery ordering_specification_opt null_ordering_opt */
+{ yylhsminor.yy698 = createOrderByExprNode(pCxt, releaseRawExprNode(pCxt, yymsp[-2].minor.yy698), yymsp[-1].minor.yy44, yymsp[0].minor.yy409); }
+  yymsp[-2].minor.yy698 = yylhsminor.yy698;
         break;
-      case 594: /* ordering_specification_opt ::= */
-{ yymsp[1].minor.yy690 = ORDER_ASC; }
+      case 596: /* ordering_specification_opt ::= */
+{ yymsp[1].minor.yy44 = ORDER_ASC; }
         break;
-      case 595: /* ordering_specification_opt ::= ASC */
-{ yymsp[0].minor.yy690 = ORDER_ASC; }
+      case 597: /* ordering_specification_opt ::= ASC */
+{ yymsp[0].minor.yy44 = ORDER_ASC; }
         break;
-      case 596: /* ordering_specification_opt ::= DESC */
-{ yymsp[0].minor.yy690 = ORDER_DESC; }
+      case 598: /* ordering_specification_opt ::= DESC */
+{ yymsp[0].minor.yy44 = ORDER_DESC; }
         break;
-      case 597: /* null_ordering_opt ::= */
-{ yymsp[1].minor.yy399 = NULL_ORDER_DEFAULT; }
+      case 599: /* null_ordering_opt ::= */
+{ yymsp[1].minor.yy409 = NULL_ORDER_DEFAULT; }
         break;
-      case 598: /* null_ordering_opt ::= NULLS FIRST */
-{ yymsp[-1].minor.yy399 = NULL_ORDER_FIRST; }
+      case 600: /* null_ordering_opt ::= NULLS FIRST */
+{ yymsp[-1].minor.yy409 = NULL_ORDER_FIRST; }
         break;
-      case 599: /* null_ordering_opt ::= NULLS LAST */
-{ yymsp[-1].minor.yy399 = NULL_ORDER_LAST; }
+      case 601: /* null_ordering_opt ::= NULLS LAST */
+{ yymsp[-1].minor.yy409 = NULL_ORDER_LAST; }
         break;
       default:
         break;
@@ -489,4 +489,14 @@ TEST_F(ParserSelectTest, joinSemanticCheck) {
   run("SELECT count(*) FROM t1 a join t1 b on a.ts=b.ts where a.ts=b.ts");
 }
 
+TEST_F(ParserSelectTest, leftJoin) {
+  useDb("root", "test");
+
+  run("SELECT a.c1, b.c1 FROM t1 a LEFT JOIN t1 b ON a.c1 = b.c1");
+
+  run("SELECT a.c1, b.c1 FROM t1 a left join t1 b ON a.c1 = b.c1 WHERE b.c1 IS NULL");
+
+  run("SELECT a.c1, b.c1 FROM t1 a LEFT OUTER JOIN t1 b ON a.c1 = b.c1");
+}
+
 }  // namespace ParserTest
@@ -435,6 +435,7 @@ static int32_t createJoinLogicNode(SLogicPlanContext* pCxt, SSelectStmt* pSelect
   }
 
   pJoin->joinType = pJoinTable->joinType;
+  pJoin->joinAlgo = JOIN_ALGO_MERGE;
   pJoin->isSingleTableJoin = pJoinTable->table.singleTable;
   pJoin->node.inputTsOrder = ORDER_ASC;
   pJoin->node.groupAction = GROUP_ACTION_CLEAR;
@@ -523,6 +523,10 @@ static ECondAction pushDownCondOptGetCondAction(EJoinType joinType, SNodeList* p
   SCpdIsMultiTableCondCxt cxt = {
       .pLeftCols = pLeftCols, .pRightCols = pRightCols, .havaLeftCol = false, .haveRightCol = false};
   nodesWalkExpr(pNode, pushDownCondOptIsCrossTableCond, &cxt);
+  if (JOIN_TYPE_LEFT == joinType) {
+    // the right columns are null extended by the join, so only the conditions of the left table can be pushed down
+    return (cxt.havaLeftCol && !cxt.haveRightCol) ? COND_ACTION_PUSH_LEFT_CHILD : COND_ACTION_STAY;
+  }
   return (JOIN_TYPE_INNER != joinType
               ? COND_ACTION_STAY
               : (cxt.havaLeftCol && cxt.haveRightCol
@@ -693,6 +697,10 @@ static int32_t pushDownCondOptCheckJoinOnCond(SOptimizeContext* pCxt, SJoinLogic
   if (!pushDownCondOptContainPriKeyEqualCond(pJoin, pJoin->pOnConditions)) {
     return generateUsageErrMsg(pCxt->pPlanCxt->pMsg, pCxt->pPlanCxt->msgLen, TSDB_CODE_PLAN_EXPECTED_TS_EQUAL);
   }
+  // the merge join only implements the inner join
+  if (JOIN_TYPE_INNER != pJoin->joinType) {
+    return generateUsageErrMsg(pCxt->pPlanCxt->pMsg, pCxt->pPlanCxt->msgLen, TSDB_CODE_PLAN_NOT_SUPPORT_JOIN_COND);
+  }
   return TSDB_CODE_SUCCESS;
 }
 
@@ -841,13 +849,78 @@ static int32_t pushDownCondOptJoinExtractColEqualOnCond(SOptimizeContext* pCxt,
   return TSDB_CODE_SUCCESS;
 }
 
+static void pushDownCondOptCountColEqualOnCond(SJoinLogicNode* pJoin, int32_t* pEqualNum, int32_t* pTotalNum) {
+  if (QUERY_NODE_LOGIC_CONDITION == nodeType(pJoin->pOnConditions) &&
+      LOGIC_COND_TYPE_AND == ((SLogicConditionNode*)(pJoin->pOnConditions))->condType) {
+    SNode* pCond = NULL;
+    FOREACH(pCond, ((SLogicConditionNode*)(pJoin->pOnConditions))->pParameterList) {
+      if (pushDownCondOptIsColEqualOnCond(pJoin, pCond)) {
+        ++(*pEqualNum);
+      }
+      ++(*pTotalNum);
+    }
+    return;
+  }
+
+  if (pushDownCondOptIsColEqualOnCond(pJoin, pJoin->pOnConditions)) {
+    ++(*pEqualNum);
+  }
+  ++(*pTotalNum);
+}
+
+static bool pushDownCondOptCanUseHashJoin(SJoinLogicNode* pJoin) {
+  if (NULL == pJoin->pOnConditions) {
+    return false;
+  }
+  // the output of hash join is out of order
+  SLogicNode* pParent = pJoin->node.pParent;
+  if (NULL != pParent && DATA_ORDER_LEVEL_NONE != pParent->requireDataOrder) {
+    return false;
+  }
+
+  int32_t equalNum = 0;
+  int32_t totalNum = 0;
+  pushDownCondOptCountColEqualOnCond(pJoin, &equalNum, &totalNum);
+  if (JOIN_TYPE_INNER == pJoin->joinType) {
+    return equalNum > 0 && !pushDownCondOptContainPriKeyEqualCond(pJoin, pJoin->pOnConditions);
+  }
+  // the rows of outer join are null extended by keys only
+  return equalNum > 0 && equalNum == totalNum;
+}
+
+static int32_t pushDownCondOptSetHashJoin(SOptimizeContext* pCxt, SJoinLogicNode* pJoin) {
+  pJoin->joinAlgo = JOIN_ALGO_HASH;
+  pJoin->node.requireDataOrder = DATA_ORDER_LEVEL_NONE;
+  pJoin->node.resultDataOrder = DATA_ORDER_LEVEL_NONE;
+
+  int32_t code = TSDB_CODE_SUCCESS;
+  SNode*  pChild = NULL;
+  FOREACH(pChild, pJoin->node.pChildren) {
+    code = adjustLogicNodeDataRequirement((SLogicNode*)pChild, DATA_ORDER_LEVEL_NONE);
+    if (TSDB_CODE_SUCCESS != code) {
+      break;
+    }
+  }
+  if (TSDB_CODE_SUCCESS == code) {
+    code = pushDownCondOptJoinExtractColEqualOnCond(pCxt, pJoin);
+  }
+  return code;
+}
+
+static int32_t pushDownCondOptJoinExtractCond(SOptimizeContext* pCxt, SJoinLogicNode* pJoin) {
+  if (pushDownCondOptCanUseHashJoin(pJoin)) {
+    return pushDownCondOptSetHashJoin(pCxt, pJoin);
+  }
+  return pushDownCondOptJoinExtractMergeCond(pCxt, pJoin);
+}
+
 static int32_t pushDownCondOptDealJoin(SOptimizeContext* pCxt, SJoinLogicNode* pJoin) {
   if (OPTIMIZE_FLAG_TEST_MASK(pJoin->node.optimizedFlag, OPTIMIZE_FLAG_PUSH_DOWN_CONDE)) {
     return TSDB_CODE_SUCCESS;
   }
 
   if (NULL == pJoin->node.pConditions) {
-    int32_t code = pushDownCondOptJoinExtractMergeCond(pCxt, pJoin);
+    int32_t code = pushDownCondOptJoinExtractCond(pCxt, pJoin);
     if (TSDB_CODE_SUCCESS == code) {
       OPTIMIZE_FLAG_SET_MASK(pJoin->node.optimizedFlag, OPTIMIZE_FLAG_PUSH_DOWN_CONDE);
       pCxt->optimized = true;
@@ -872,10 +945,10 @@ static int32_t pushDownCondOptDealJoin(SOptimizeContext* pCxt, SJoinLogicNode* p
   }
 
   if (TSDB_CODE_SUCCESS == code) {
-    code = pushDownCondOptJoinExtractMergeCond(pCxt, pJoin);
+    code = pushDownCondOptJoinExtractCond(pCxt, pJoin);
   }
 
-  if (TSDB_CODE_SUCCESS == code) {
+  if (TSDB_CODE_SUCCESS == code && JOIN_ALGO_MERGE == pJoin->joinAlgo) {
     code = pushDownCondOptJoinExtractColEqualOnCond(pCxt, pJoin);
   }
 
@@ -1212,6 +1285,10 @@ static int32_t sortPriKeyOptGetSequencingNodesImpl(SLogicNode* pNode, bool group
       return nodesListMakeAppend(pSequencingNodes, (SNode*)pNode);
     }
     case QUERY_NODE_LOGIC_PLAN_JOIN: {
+      if (JOIN_ALGO_HASH == ((SJoinLogicNode*)pNode)->joinAlgo) {
+        *pNotOptimize = true;
+        return TSDB_CODE_SUCCESS;
+      }
       int32_t code = sortPriKeyOptGetSequencingNodesImpl((SLogicNode*)nodesListGetNode(pNode->pChildren, 0), groupSort,
                                                          sortOrder, pNotOptimize, pSequencingNodes);
       if (TSDB_CODE_SUCCESS == code) {
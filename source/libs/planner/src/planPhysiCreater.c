@@ -620,7 +620,8 @@ static int32_t createSystemTableScanPhysiNode(SPhysiPlanContext* pCxt, SSubplan*
     pSubplan->execNode.nodeId = MNODE_HANDLE;
     pSubplan->execNode.epSet = pCxt->pPlanCxt->mgmtEpSet;
   }
-  if (0 == strcmp(pScanLogicNode->tableName.tname, TSDB_INS_TABLE_DNODE_VARIABLES)) {
+  if (0 == strcmp(pScanLogicNode->tableName.tname, TSDB_INS_TABLE_DNODE_VARIABLES) ||
+      0 == strcmp(pScanLogicNode->tableName.tname, TSDB_INS_TABLE_DISKS)) {
     pScan->mgmtEpSet = pScanLogicNode->pVgroupList->vgroups->epSet;
   } else {
     pScan->mgmtEpSet = pCxt->pPlanCxt->mgmtEpSet;
@@ -666,8 +667,112 @@ static int32_t createScanPhysiNode(SPhysiPlanContext* pCxt, SSubplan* pSubplan,
   return TSDB_CODE_FAILED;
 }
 
+static bool isHashJoinKeyCond(SNode* pKeyConds, SNode* pCond) {
+  if (QUERY_NODE_LOGIC_CONDITION == nodeType(pKeyConds)) {
+    SNode* pKey = NULL;
+    FOREACH(pKey, ((SLogicConditionNode*)pKeyConds)->pParameterList) {
+      if (nodesEqualNode(pKey, pCond)) {
+        return true;
+      }
+    }
+    return false;
+  }
+  return nodesEqualNode(pKeyConds, pCond);
+}
+
+// the equal keys are evaluated by the hash table, only the other on conditions are left to the filter
+static int32_t getHashJoinOtherOnCond(SJoinLogicNode* pJoinLogicNode, SNode** pOtherCond) {
+  SNode* pOnCond = pJoinLogicNode->pOnConditions;
+  if (QUERY_NODE_LOGIC_CONDITION != nodeType(pOnCond) ||
+      LOGIC_COND_TYPE_AND != ((SLogicConditionNode*)pOnCond)->condType) {
+    if (isHashJoinKeyCond(pJoinLogicNode->pColEqualOnConditions, pOnCond)) {
+      return TSDB_CODE_SUCCESS;
+    }
+    *pOtherCond = nodesCloneNode(pOnCond);
+    return NULL == *pOtherCond ? TSDB_CODE_OUT_OF_MEMORY : TSDB_CODE_SUCCESS;
+  }
+
+  int32_t    code = TSDB_CODE_SUCCESS;
+  SNodeList* pOtherConds = NULL;
+  SNode*     pCond = NULL;
+  FOREACH(pCond, ((SLogicConditionNode*)pOnCond)->pParameterList) {
+    if (!isHashJoinKeyCond(pJoinLogicNode->pColEqualOnConditions, pCond)) {
+      code = nodesListMakeStrictAppend(&pOtherConds, nodesCloneNode(pCond));
+      if (TSDB_CODE_SUCCESS != code) {
+        break;
+      }
+    }
+  }
+  if (TSDB_CODE_SUCCESS == code) {
+    code = nodesMergeConds(pOtherCond, &pOtherConds);
+  }
+  nodesDestroyList(pOtherConds);
+  return code;
+}
+
+static int32_t createHashJoinPhysiNode(SPhysiPlanContext* pCxt, SNodeList* pChildren, SJoinLogicNode* pJoinLogicNode,
+                                       SPhysiNode** pPhyNode) {
+  SHashJoinPhysiNode* pJoin =
+      (SHashJoinPhysiNode*)makePhysiNode(pCxt, (SLogicNode*)pJoinLogicNode, QUERY_NODE_PHYSICAL_PLAN_HASH_JOIN);
+  if (NULL == pJoin) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+
+  SDataBlockDescNode* pLeftDesc = ((SPhysiNode*)nodesListGetNode(pChildren, 0))->pOutputDataBlockDesc;
+  SDataBlockDescNode* pRightDesc = ((SPhysiNode*)nodesListGetNode(pChildren, 1))->pOutputDataBlockDesc;
+  SNode*              pOtherCond = NULL;
+
+  pJoin->joinType = pJoinLogicNode->joinType;
+  int32_t code = setNodeSlotId(pCxt, pLeftDesc->dataBlockId, pRightDesc->dataBlockId,
+                               pJoinLogicNode->pColEqualOnConditions, &pJoin->pColEqualOnConditions);
+  if (TSDB_CODE_SUCCESS == code) {
+    code = setListSlotId(pCxt, pLeftDesc->dataBlockId, pRightDesc->dataBlockId, pJoinLogicNode->node.pTargets,
+                         &pJoin->pTargets);
+  }
+  if (TSDB_CODE_SUCCESS == code) {
+    code = addDataBlockSlots(pCxt, pJoin->pTargets, pJoin->node.pOutputDataBlockDesc);
+  }
+  if (TSDB_CODE_SUCCESS == code) {
+    code = getHashJoinOtherOnCond(pJoinLogicNode, &pOtherCond);
+  }
+
+  if (TSDB_CODE_SUCCESS == code && NULL != pOtherCond) {
+    SNodeList* pCondCols = nodesMakeList();
+    if (NULL == pCondCols) {
+      code = TSDB_CODE_OUT_OF_MEMORY;
+    } else {
+      code = nodesCollectColumnsFromNode(pOtherCond, NULL, COLLECT_COL_TYPE_ALL, &pCondCols);
+    }
+    if (TSDB_CODE_SUCCESS == code) {
+      code = addDataBlockSlots(pCxt, pCondCols, pJoin->node.pOutputDataBlockDesc);
+    }
+    nodesDestroyList(pCondCols);
+  }
+
+  if (TSDB_CODE_SUCCESS == code && NULL != pOtherCond) {
+    code = setNodeSlotId(pCxt, ((SPhysiNode*)pJoin)->pOutputDataBlockDesc->dataBlockId, -1, pOtherCond,
+                         &pJoin->pOnConditions);
+  }
+  if (TSDB_CODE_SUCCESS == code) {
+    code = setConditionsSlotId(pCxt, (const SLogicNode*)pJoinLogicNode, (SPhysiNode*)pJoin);
+  }
+  nodesDestroyNode(pOtherCond);
+
+  if (TSDB_CODE_SUCCESS == code) {
+    *pPhyNode = (SPhysiNode*)pJoin;
+  } else {
+    nodesDestroyNode((SNode*)pJoin);
+  }
+
+  return code;
+}
+
 static int32_t createJoinPhysiNode(SPhysiPlanContext* pCxt, SNodeList* pChildren, SJoinLogicNode* pJoinLogicNode,
                                    SPhysiNode** pPhyNode) {
+  if (JOIN_ALGO_HASH == pJoinLogicNode->joinAlgo) {
+    return createHashJoinPhysiNode(pCxt, pChildren, pJoinLogicNode, pPhyNode);
+  }
+
   SSortMergeJoinPhysiNode* pJoin =
       (SSortMergeJoinPhysiNode*)makePhysiNode(pCxt, (SLogicNode*)pJoinLogicNode, QUERY_NODE_PHYSICAL_PLAN_MERGE_JOIN);
   if (NULL == pJoin) {
@@ -1605,6 +1605,11 @@ static int32_t sclGetMathOperatorResType(SOperatorNode *pOp) {
       (TSDB_DATA_TYPE_TIMESTAMP == rdt.type && TSDB_DATA_TYPE_BOOL == ldt.type)) {
     pOp->node.resType.type = TSDB_DATA_TYPE_TIMESTAMP;
     pOp->node.resType.bytes = tDataTypes[TSDB_DATA_TYPE_TIMESTAMP].bytes;
+  } else if ((OP_TYPE_ADD == pOp->opType || OP_TYPE_SUB == pOp->opType || OP_TYPE_MULTI == pOp->opType) &&
+             IS_INTEGER_TYPE(ldt.type) && IS_INTEGER_TYPE(rdt.type)) {
+    // integer add, sub and multiply stay integers, and wrap around on overflow
+    pOp->node.resType.type = TSDB_DATA_TYPE_BIGINT;
+    pOp->node.resType.bytes = tDataTypes[TSDB_DATA_TYPE_BIGINT].bytes;
   } else {
     pOp->node.resType.type = TSDB_DATA_TYPE_DOUBLE;
     pOp->node.resType.bytes = tDataTypes[TSDB_DATA_TYPE_DOUBLE].bytes;
@@ -1146,6 +1146,504 @@ static void doReleaseVec(SColumnInfoData *pCol, int32_t type) {
   }
 }
 
+enum {
+  VECTOR_MATH_ADD = 0x1,
+  VECTOR_MATH_SUB = 0x2,
+  VECTOR_MATH_RSUB = 0x3,  // constant on the left side: c - col
+  VECTOR_MATH_MULTI = 0x4,
+};
+
+#define VECTOR_MATH_WIDEN_LOOP(_dst, _src, _t, _n)   \
+  do {                                               \
+    const _t *_s = (const _t *)(_src);               \
+    for (int32_t _k = 0; _k < (_n); ++_k) {          \
+      (_dst)[_k] = (double)_s[_k];                   \
+    }                                                \
+  } while (0)
+
+#define VECTOR_MATH_VEC_LOOP(_dst, _src, _t, _n, _op) \
+  do {                                                \
+    const _t *_s = (const _t *)(_src);                \
+    for (int32_t _k = 0; _k < (_n); ++_k) {           \
+      (_dst)[_k] = (_dst)[_k] _op (double)_s[_k];    \
+    }                                                 \
+  } while (0)
+
+#define VECTOR_MATH_VEC_DISPATCH(_dst, _src, _type, _n, _op)          \
+  do {                                                                \
+    switch (_type) {                                                  \
+      case TSDB_DATA_TYPE_BOOL:                                       \
+        VECTOR_MATH_VEC_LOOP(_dst, _src, bool, _n, _op);              \
+        break;                                                        \
+      case TSDB_DATA_TYPE_TINYINT:                                    \
+        VECTOR_MATH_VEC_LOOP(_dst, _src, int8_t, _n, _op);            \
+        break;                                                        \
+      case TSDB_DATA_TYPE_UTINYINT:                                   \
+        VECTOR_MATH_VEC_LOOP(_dst, _src, uint8_t, _n, _op);           \
+        break;                                                        \
+      case TSDB_DATA_TYPE_SMALLINT:                                   \
+        VECTOR_MATH_VEC_LOOP(_dst, _src, int16_t, _n, _op);           \
+        break;                                                        \
+      case TSDB_DATA_TYPE_USMALLINT:                                  \
+        VECTOR_MATH_VEC_LOOP(_dst, _src, uint16_t, _n, _op);          \
+        break;                                                        \
+      case TSDB_DATA_TYPE_INT:                                        \
+        VECTOR_MATH_VEC_LOOP(_dst, _src, int32_t, _n, _op);           \
+        break;                                                        \
+      case TSDB_DATA_TYPE_UINT:                                       \
+        VECTOR_MATH_VEC_LOOP(_dst, _src, uint32_t, _n, _op);          \
+        break;                                                        \
+      case TSDB_DATA_TYPE_BIGINT:                                     \
+      case TSDB_DATA_TYPE_TIMESTAMP:                                  \
+        VECTOR_MATH_VEC_LOOP(_dst, _src, int64_t, _n, _op);           \
+        break;                                                        \
+      case TSDB_DATA_TYPE_UBIGINT:                                    \
+        VECTOR_MATH_VEC_LOOP(_dst, _src, uint64_t, _n, _op);          \
+        break;                                                        \
+      case TSDB_DATA_TYPE_FLOAT:                                      \
+        VECTOR_MATH_VEC_LOOP(_dst, _src, float, _n, _op);             \
+        break;                                                        \
+      case TSDB_DATA_TYPE_DOUBLE:                                     \
+        VECTOR_MATH_VEC_LOOP(_dst, _src, double, _n, _op);            \
+        break;                                                        \
+      default:                                                        \
+        break;                                                        \
+    }                                                                 \
+  } while (0)
+
+static bool vectorMathIsKernelType(int32_t type) {
+  switch (type) {
+    case TSDB_DATA_TYPE_BOOL:
+    case TSDB_DATA_TYPE_TINYINT:
+    case TSDB_DATA_TYPE_UTINYINT:
+    case TSDB_DATA_TYPE_SMALLINT:
+    case TSDB_DATA_TYPE_USMALLINT:
+    case TSDB_DATA_TYPE_INT:
+    case TSDB_DATA_TYPE_UINT:
+    case TSDB_DATA_TYPE_BIGINT:
+    case TSDB_DATA_TYPE_UBIGINT:
+    case TSDB_DATA_TYPE_TIMESTAMP:
+    case TSDB_DATA_TYPE_FLOAT:
+    case TSDB_DATA_TYPE_DOUBLE:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// widen one typed column into the double output buffer
+static void vectorMathWidenToDouble(double *dst, const void *src, int32_t type, int32_t numOfRows) {
+  int32_t k = 0;
+
+#if __AVX2__
+  if (tsAVX2Enable && tsSIMDBuiltins) {
+    if (type == TSDB_DATA_TYPE_INT) {
+      for (; k + 4 <= numOfRows; k += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i *)((const int32_t *)src + k));
+        _mm256_storeu_pd(dst + k, _mm256_cvtepi32_pd(v));
+      }
+    } else if (type == TSDB_DATA_TYPE_FLOAT) {
+      for (; k + 4 <= numOfRows; k += 4) {
+        __m128 v = _mm_loadu_ps((const float *)src + k);
+        _mm256_storeu_pd(dst + k, _mm256_cvtps_pd(v));
+      }
+    }
+  }
+#endif
+
+  switch (type) {
+    case TSDB_DATA_TYPE_BOOL:
+      VECTOR_MATH_WIDEN_LOOP(dst, src, bool, numOfRows);
+      break;
+    case TSDB_DATA_TYPE_TINYINT:
+      VECTOR_MATH_WIDEN_LOOP(dst, src, int8_t, numOfRows);
+      break;
+    case TSDB_DATA_TYPE_UTINYINT:
+      VECTOR_MATH_WIDEN_LOOP(dst, src, uint8_t, numOfRows);
+      break;
+    case TSDB_DATA_TYPE_SMALLINT:
+      VECTOR_MATH_WIDEN_LOOP(dst, src, int16_t, numOfRows);
+      break;
+    case TSDB_DATA_TYPE_USMALLINT:
+      VECTOR_MATH_WIDEN_LOOP(dst, src, uint16_t, numOfRows);
+      break;
+    case TSDB_DATA_TYPE_INT:
+      VECTOR_MATH_WIDEN_LOOP(dst + k, (const int32_t *)src + k, int32_t, numOfRows - k);
+      break;
+    case TSDB_DATA_TYPE_UINT:
+      VECTOR_MATH_WIDEN_LOOP(dst, src, uint32_t, numOfRows);
+      break;
+    case TSDB_DATA_TYPE_BIGINT:
+    case TSDB_DATA_TYPE_TIMESTAMP:
+      VECTOR_MATH_WIDEN_LOOP(dst, src, int64_t, numOfRows);
+      break;
+    case TSDB_DATA_TYPE_UBIGINT:
+      VECTOR_MATH_WIDEN_LOOP(dst, src, uint64_t, numOfRows);
+      break;
+    case TSDB_DATA_TYPE_FLOAT:
+      VECTOR_MATH_WIDEN_LOOP(dst + k, (const float *)src + k, float, numOfRows - k);
+      break;
+    case TSDB_DATA_TYPE_DOUBLE:
+      if (dst != src) {
+        memcpy(dst, src, sizeof(double) * numOfRows);
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+// dst[k] = dst[k] op src[k], with src of any numeric type
+static void vectorMathDoubleVecKernel(double *dst, const void *src, int32_t type, int32_t numOfRows, int32_t op) {
+  int32_t k = 0;
+
+#if __AVX2__
+  if (tsAVX2Enable && tsSIMDBuiltins && (type == TSDB_DATA_TYPE_DOUBLE || type == TSDB_DATA_TYPE_FLOAT ||
+                                         type == TSDB_DATA_TYPE_INT)) {
+    for (; k + 4 <= numOfRows; k += 4) {
+      __m256d r;
+      if (type == TSDB_DATA_TYPE_DOUBLE) {
+        r = _mm256_loadu_pd((const double *)src + k);
+      } else if (type == TSDB_DATA_TYPE_FLOAT) {
+        r = _mm256_cvtps_pd(_mm_loadu_ps((const float *)src + k));
+      } else {
+        r = _mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i *)((const int32_t *)src + k)));
+      }
+
+      __m256d l = _mm256_loadu_pd(dst + k);
+      if (op == VECTOR_MATH_ADD) {
+        l = _mm256_add_pd(l, r);
+      } else if (op == VECTOR_MATH_SUB) {
+        l = _mm256_sub_pd(l, r);
+      } else {
+        l = _mm256_mul_pd(l, r);
+      }
+      _mm256_storeu_pd(dst + k, l);
+    }
+
+    if (k == numOfRows) {
+      return;
+    }
+
+    // the remaining rows are handled by the scalar loop below
+    src = (const char *)src + k * tDataTypes[type].bytes;
+    dst += k;
+    numOfRows -= k;
+  }
+#endif
+
+  if (op == VECTOR_MATH_ADD) {
+    VECTOR_MATH_VEC_DISPATCH(dst, src, type, numOfRows, +);
+  } else if (op == VECTOR_MATH_SUB) {
+    VECTOR_MATH_VEC_DISPATCH(dst, src, type, numOfRows, -);
+  } else {
+    VECTOR_MATH_VEC_DISPATCH(dst, src, type, numOfRows, *);
+  }
+}
+
+// dst[k] = dst[k] op v, or v - dst[k] for VECTOR_MATH_RSUB
+static void vectorMathDoubleConstKernel(double *dst, double v, int32_t numOfRows, int32_t op) {
+  int32_t k = 0;
+
+#if __AVX2__
+  if (tsAVX2Enable && tsSIMDBuiltins) {
+    __m256d c = _mm256_set1_pd(v);
+    for (; k + 4 <= numOfRows; k += 4) {
+      __m256d l = _mm256_loadu_pd(dst + k);
+      if (op == VECTOR_MATH_ADD) {
+        l = _mm256_add_pd(l, c);
+      } else if (op == VECTOR_MATH_SUB) {
+        l = _mm256_sub_pd(l, c);
+      } else if (op == VECTOR_MATH_RSUB) {
+        l = _mm256_sub_pd(c, l);
+      } else {
+        l = _mm256_mul_pd(l, c);
+      }
+      _mm256_storeu_pd(dst + k, l);
+    }
+  }
+#endif
+
+  if (op == VECTOR_MATH_ADD) {
+    for (; k < numOfRows; ++k) dst[k] = dst[k] + v;
+  } else if (op == VECTOR_MATH_SUB) {
+    for (; k < numOfRows; ++k) dst[k] = dst[k] - v;
+  } else if (op == VECTOR_MATH_RSUB) {
+    for (; k < numOfRows; ++k) dst[k] = v - dst[k];
+  } else {
+    for (; k < numOfRows; ++k) dst[k] = dst[k] * v;
+  }
+}
+
+// Copy the null flags of pCol into the output column. Bitmap words without any null value are skipped at once, so
+// the cost is proportional to the number of null runs instead of the number of rows.
+static void vectorMathMergeNull(SColumnInfoData *pOutputCol, const SColumnInfoData *pCol, int32_t numOfRows) {
+  if (!pCol->hasNull || pCol->nullbitmap == NULL) {
+    return;
+  }
+
+  int32_t bytes = pOutputCol->info.bytes;
+  int32_t len = BitmapLen(numOfRows);
+  int32_t j = 0;
+
+  while (j < len) {
+    if (j + (int32_t)sizeof(uint64_t) <= len) {
+      uint64_t w = 0;
+      memcpy(&w, pCol->nullbitmap + j, sizeof(uint64_t));
+      if (w == 0) {
+        j += sizeof(uint64_t);
+        continue;
+      }
+    }
+
+    uint8_t bm = (uint8_t)pCol->nullbitmap[j];
+    if (bm != 0) {
+      int32_t start = j << NBIT;
+      int32_t end = TMIN(start + 8, numOfRows);
+      if (end - start < 8) {
+        bm &= (uint8_t)(0xFFu << (8 - (end - start)));
+      }
+
+      pOutputCol->nullbitmap[j] |= bm;
+      for (int32_t r = start; r < end; ++r) {
+        if (colDataIsNull_f(pCol->nullbitmap, r)) {
+          memset(pOutputCol->pData + bytes * r, 0, bytes);
+        }
+      }
+      pOutputCol->hasNull = true;
+    }
+    j += 1;
+  }
+}
+
+/**
+ * Type specialized add/sub/multiply for numeric inputs producing a double column in ascending order. Integer columns
+ * are widened block by block instead of row by row through getVectorDoubleValueFn, and the null bitmaps are merged
+ * once per block. Returns false if the inputs are not covered, and the generic row based path is used instead.
+ */
+static bool vectorMathDoubleKernel(SColumnInfoData *pLeftCol, int32_t leftRows, SColumnInfoData *pRightCol,
+                                   int32_t rightRows, SColumnInfoData *pOutputCol, int32_t _ord, int32_t op) {
+  if (_ord != TSDB_ORDER_ASC || pOutputCol->info.type != TSDB_DATA_TYPE_DOUBLE ||
+      !vectorMathIsKernelType(pLeftCol->info.type) || !vectorMathIsKernelType(pRightCol->info.type)) {
+    return false;
+  }
+
+  double *output = (double *)pOutputCol->pData;
+
+  if (leftRows == rightRows) {
+    vectorMathWidenToDouble(output, pLeftCol->pData, pLeftCol->info.type, leftRows);
+    vectorMathDoubleVecKernel(output, pRightCol->pData, pRightCol->info.type, rightRows, op);
+    vectorMathMergeNull(pOutputCol, pLeftCol, leftRows);
+    vectorMathMergeNull(pOutputCol, pRightCol, rightRows);
+  } else if (leftRows == 1) {
+    if (colDataIsNull_s(pLeftCol, 0)) {
+      colDataSetNNULL(pOutputCol, 0, rightRows);
+      return true;
+    }
+
+    double v = getVectorDoubleValueFn(pLeftCol->info.type)(pLeftCol->pData, 0);
+    vectorMathWidenToDouble(output, pRightCol->pData, pRightCol->info.type, rightRows);
+    vectorMathDoubleConstKernel(output, v, rightRows, (op == VECTOR_MATH_SUB) ? VECTOR_MATH_RSUB : op);
+    vectorMathMergeNull(pOutputCol, pRightCol, rightRows);
+  } else if (rightRows == 1) {
+    if (colDataIsNull_s(pRightCol, 0)) {
+      colDataSetNNULL(pOutputCol, 0, leftRows);
+      return true;
+    }
+
+    double v = getVectorDoubleValueFn(pRightCol->info.type)(pRightCol->pData, 0);
+    vectorMathWidenToDouble(output, pLeftCol->pData, pLeftCol->info.type, leftRows);
+    vectorMathDoubleConstKernel(output, v, leftRows, op);
+    vectorMathMergeNull(pOutputCol, pLeftCol, leftRows);
+  }
+
+  return true;
+}
+
+#define VECTOR_MATH_INTEGER_DISPATCH(_type, _loop, ...) \
+  do {                                                  \
+    switch (_type) {                                    \
+      case TSDB_DATA_TYPE_TINYINT:                      \
+        _loop(int8_t, __VA_ARGS__);                     \
+        break;                                          \
+      case TSDB_DATA_TYPE_UTINYINT:                     \
+        _loop(uint8_t, __VA_ARGS__);                    \
+        break;                                          \
+      case TSDB_DATA_TYPE_SMALLINT:                     \
+        _loop(int16_t, __VA_ARGS__);                    \
+        break;                                          \
+      case TSDB_DATA_TYPE_USMALLINT:                    \
+        _loop(uint16_t, __VA_ARGS__);                   \
+        break;                                          \
+      case TSDB_DATA_TYPE_INT:                          \
+        _loop(int32_t, __VA_ARGS__);                    \
+        break;                                          \
+      case TSDB_DATA_TYPE_UINT:                         \
+        _loop(uint32_t, __VA_ARGS__);                   \
+        break;                                          \
+      case TSDB_DATA_TYPE_BIGINT:                       \
+        _loop(int64_t, __VA_ARGS__);                    \
+        break;                                          \
+      case TSDB_DATA_TYPE_UBIGINT:                      \
+        _loop(uint64_t, __VA_ARGS__);                   \
+        break;                                          \
+      default:                                          \
+        break;                                          \
+    }                                                   \
+  } while (0)
+
+#define VECTOR_MATH_BIGINT_WIDEN_LOOP(_t, _dst, _src, _n) \
+  do {                                                    \
+    const _t *_s = (const _t *)(_src);                    \
+    for (int32_t _k = 0; _k < (_n); ++_k) {               \
+      (_dst)[_k] = (int64_t)_s[_k];                       \
+    }                                                     \
+  } while (0)
+
+// computed on uint64_t, so an overflow wraps around instead of being undefined
+#define VECTOR_MATH_BIGINT_VEC_LOOP(_t, _dst, _src, _n, _op)                          \
+  do {                                                                                \
+    const _t *_s = (const _t *)(_src);                                                \
+    for (int32_t _k = 0; _k < (_n); ++_k) {                                           \
+      (_dst)[_k] = (int64_t)((uint64_t)(_dst)[_k] _op (uint64_t)(int64_t)_s[_k]);     \
+    }                                                                                 \
+  } while (0)
+
+// widen one integer column into the bigint output buffer
+static void vectorMathWidenToBigint(int64_t *dst, const void *src, int32_t type, int32_t numOfRows) {
+  int32_t k = 0;
+
+#if __AVX2__
+  if (tsAVX2Enable && tsSIMDBuiltins && type == TSDB_DATA_TYPE_INT) {
+    for (; k + 4 <= numOfRows; k += 4) {
+      __m128i v = _mm_loadu_si128((const __m128i *)((const int32_t *)src + k));
+      _mm256_storeu_si256((__m256i *)(dst + k), _mm256_cvtepi32_epi64(v));
+    }
+    src = (const int32_t *)src + k;
+    dst += k;
+    numOfRows -= k;
+  }
+#endif
+
+  if ((type == TSDB_DATA_TYPE_BIGINT || type == TSDB_DATA_TYPE_UBIGINT) && dst != src) {
+    memcpy(dst, src, sizeof(int64_t) * numOfRows);
+    return;
+  }
+  VECTOR_MATH_INTEGER_DISPATCH(type, VECTOR_MATH_BIGINT_WIDEN_LOOP, dst, src, numOfRows);
+}
+
+// dst[k] = dst[k] op src[k], with src of any integer type
+static void vectorMathBigintVecKernel(int64_t *dst, const void *src, int32_t type, int32_t numOfRows, int32_t op) {
+  int32_t k = 0;
+
+#if __AVX2__
+  // there is no 64 bit multiply in AVX2, the products are left to the scalar loop
+  if (tsAVX2Enable && tsSIMDBuiltins && op != VECTOR_MATH_MULTI &&
+      (type == TSDB_DATA_TYPE_BIGINT || type == TSDB_DATA_TYPE_UBIGINT || type == TSDB_DATA_TYPE_INT)) {
+    for (; k + 4 <= numOfRows; k += 4) {
+      __m256i r;
+      if (type == TSDB_DATA_TYPE_INT) {
+        r = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)((const int32_t *)src + k)));
+      } else {
+        r = _mm256_loadu_si256((const __m256i *)((const int64_t *)src + k));
+      }
+
+      __m256i l = _mm256_loadu_si256((const __m256i *)(dst + k));
+      l = (op == VECTOR_MATH_ADD) ? _mm256_add_epi64(l, r) : _mm256_sub_epi64(l, r);
+      _mm256_storeu_si256((__m256i *)(dst + k), l);
+    }
+
+    src = (const char *)src + k * tDataTypes[type].bytes;
+    dst += k;
+    numOfRows -= k;
+  }
+#endif
+
+  if (op == VECTOR_MATH_ADD) {
+    VECTOR_MATH_INTEGER_DISPATCH(type, VECTOR_MATH_BIGINT_VEC_LOOP, dst, src, numOfRows, +);
+  } else if (op == VECTOR_MATH_SUB) {
+    VECTOR_MATH_INTEGER_DISPATCH(type, VECTOR_MATH_BIGINT_VEC_LOOP, dst, src, numOfRows, -);
+  } else {
+    VECTOR_MATH_INTEGER_DISPATCH(type, VECTOR_MATH_BIGINT_VEC_LOOP, dst, src, numOfRows, *);
+  }
+}
+
+// dst[k] = dst[k] op v, or v - dst[k] for VECTOR_MATH_RSUB
+static void vectorMathBigintConstKernel(int64_t *dst, int64_t v, int32_t numOfRows, int32_t op) {
+  int32_t  k = 0;
+  uint64_t c = (uint64_t)v;
+
+#if __AVX2__
+  if (tsAVX2Enable && tsSIMDBuiltins && op != VECTOR_MATH_MULTI) {
+    __m256i cv = _mm256_set1_epi64x(v);
+    for (; k + 4 <= numOfRows; k += 4) {
+      __m256i l = _mm256_loadu_si256((const __m256i *)(dst + k));
+      if (op == VECTOR_MATH_ADD) {
+        l = _mm256_add_epi64(l, cv);
+      } else if (op == VECTOR_MATH_SUB) {
+        l = _mm256_sub_epi64(l, cv);
+      } else {
+        l = _mm256_sub_epi64(cv, l);
+      }
+      _mm256_storeu_si256((__m256i *)(dst + k), l);
+    }
+  }
+#endif
+
+  if (op == VECTOR_MATH_ADD) {
+    for (; k < numOfRows; ++k) dst[k] = (int64_t)((uint64_t)dst[k] + c);
+  } else if (op == VECTOR_MATH_SUB) {
+    for (; k < numOfRows; ++k) dst[k] = (int64_t)((uint64_t)dst[k] - c);
+  } else if (op == VECTOR_MATH_RSUB) {
+    for (; k < numOfRows; ++k) dst[k] = (int64_t)(c - (uint64_t)dst[k]);
+  } else {
+    for (; k < numOfRows; ++k) dst[k] = (int64_t)((uint64_t)dst[k] * c);
+  }
+}
+
+/**
+ * Add/sub/multiply of two integer inputs producing a bigint column, see sclGetMathOperatorResType. Every row is
+ * computed on its own index, so the kernel serves both scan orders. Returns false if the inputs are not covered.
+ */
+static bool vectorMathBigintKernel(SColumnInfoData *pLeftCol, int32_t leftRows, SColumnInfoData *pRightCol,
+                                   int32_t rightRows, SColumnInfoData *pOutputCol, int32_t op) {
+  if (pOutputCol->info.type != TSDB_DATA_TYPE_BIGINT || !IS_INTEGER_TYPE(pLeftCol->info.type) ||
+      !IS_INTEGER_TYPE(pRightCol->info.type)) {
+    return false;
+  }
+
+  int64_t *output = (int64_t *)pOutputCol->pData;
+
+  if (leftRows == rightRows) {
+    vectorMathWidenToBigint(output, pLeftCol->pData, pLeftCol->info.type, leftRows);
+    vectorMathBigintVecKernel(output, pRightCol->pData, pRightCol->info.type, rightRows, op);
+    vectorMathMergeNull(pOutputCol, pLeftCol, leftRows);
+    vectorMathMergeNull(pOutputCol, pRightCol, rightRows);
+  } else if (leftRows == 1) {
+    if (colDataIsNull_s(pLeftCol, 0)) {
+      colDataSetNNULL(pOutputCol, 0, rightRows);
+      return true;
+    }
+
+    int64_t v = getVectorBigintValueFn(pLeftCol->info.type)(pLeftCol->pData, 0);
+    vectorMathWidenToBigint(output, pRightCol->pData, pRightCol->info.type, rightRows);
+    vectorMathBigintConstKernel(output, v, rightRows, (op == VECTOR_MATH_SUB) ? VECTOR_MATH_RSUB : op);
+    vectorMathMergeNull(pOutputCol, pRightCol, rightRows);
+  } else if (rightRows == 1) {
+    if (colDataIsNull_s(pRightCol, 0)) {
+      colDataSetNNULL(pOutputCol, 0, leftRows);
+      return true;
+    }
+
+    int64_t v = getVectorBigintValueFn(pRightCol->info.type)(pRightCol->pData, 0);
+    vectorMathWidenToBigint(output, pLeftCol->pData, pLeftCol->info.type, leftRows);
+    vectorMathBigintConstKernel(output, v, leftRows, op);
+    vectorMathMergeNull(pOutputCol, pLeftCol, leftRows);
+  }
+
+  return true;
+}
+
 void vectorMathAdd(SScalarParam *pLeft, SScalarParam *pRight, SScalarParam *pOut, int32_t _ord) {
   SColumnInfoData *pOutputCol = pOut->columnData;
 
@@ -1186,7 +1684,11 @@ void vectorMathAdd(SScalarParam *pLeft, SScalarParam *pRight, SScalarParam *pOut
         *output = getVectorBigintValueFnLeft(pLeftCol->pData, i) + getVectorBigintValueFnRight(pRightCol->pData, i);
       }
     }
-  } else {
+  } else if (vectorMathBigintKernel(pLeftCol, pLeft->numOfRows, pRightCol, pRight->numOfRows, pOutputCol,
+                                    VECTOR_MATH_ADD)) {
+    // integer inputs, done by the bigint kernel
+  } else if (!vectorMathDoubleKernel(pLeftCol, pLeft->numOfRows, pRightCol, pRight->numOfRows, pOutputCol, _ord,
+                                     VECTOR_MATH_ADD)) {
     double              *output = (double *)pOutputCol->pData;
     _getDoubleValue_fn_t getVectorDoubleValueFnLeft = getVectorDoubleValueFn(pLeftCol->info.type);
     _getDoubleValue_fn_t getVectorDoubleValueFnRight = getVectorDoubleValueFn(pRightCol->info.type);
@@ -1287,7 +1789,11 @@ void vectorMathSub(SScalarParam *pLeft, SScalarParam *pRight, SScalarParam *pOut
         *output = getVectorBigintValueFnLeft(pLeftCol->pData, i) - getVectorBigintValueFnRight(pRightCol->pData, i);
       }
     }
-  } else {
+  } else if (vectorMathBigintKernel(pLeftCol, pLeft->numOfRows, pRightCol, pRight->numOfRows, pOutputCol,
+                                    VECTOR_MATH_SUB)) {
+    // integer inputs, done by the bigint kernel
+  } else if (!vectorMathDoubleKernel(pLeftCol, pLeft->numOfRows, pRightCol, pRight->numOfRows, pOutputCol, _ord,
+                                     VECTOR_MATH_SUB)) {
     double              *output = (double *)pOutputCol->pData;
     _getDoubleValue_fn_t getVectorDoubleValueFnLeft = getVectorDoubleValueFn(pLeftCol->info.type);
     _getDoubleValue_fn_t getVectorDoubleValueFnRight = getVectorDoubleValueFn(pRightCol->info.type);
@@ -1347,7 +1853,13 @@ void vectorMathMultiply(SScalarParam *pLeft, SScalarParam *pRight, SScalarParam
   _getDoubleValue_fn_t getVectorDoubleValueFnRight = getVectorDoubleValueFn(pRightCol->info.type);
 
   double *output = (double *)pOutputCol->pData;
-  if (pLeft->numOfRows == pRight->numOfRows) {
+  if (vectorMathBigintKernel(pLeftCol, pLeft->numOfRows, pRightCol, pRight->numOfRows, pOutputCol,
+                             VECTOR_MATH_MULTI)) {
+    // integer inputs, done by the bigint kernel
+  } else if (vectorMathDoubleKernel(pLeftCol, pLeft->numOfRows, pRightCol, pRight->numOfRows, pOutputCol, _ord,
+                                    VECTOR_MATH_MULTI)) {
+    // done by the type specialized kernel
+  } else if (pLeft->numOfRows == pRight->numOfRows) {
     for (; i < pRight->numOfRows && i >= 0; i += step, output += 1) {
       if (IS_NULL) {
         colDataSetNULL(pOutputCol, i);
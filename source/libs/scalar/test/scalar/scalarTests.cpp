@@ -1503,6 +1503,541 @@ TEST(columnTest, smallint_value_add_int_column) {
   nodesDestroyNode(opNode);
 }
 
+TEST(columnTest, int_column_multi_double_value_with_null) {
+  SNode       *pLeft = NULL, *pRight = NULL, *opNode = NULL;
+  int32_t      leftv[10] = {0, 1, -2, 3, 100, -5, 6, 7, 8, 9};
+  double       rightv = 1.8;
+  SSDataBlock *src = NULL;
+  int32_t      rowNum = sizeof(leftv) / sizeof(leftv[0]);
+  scltMakeColumnNode(&pLeft, &src, TSDB_DATA_TYPE_INT, sizeof(int32_t), rowNum, leftv);
+  scltMakeValueNode(&pRight, TSDB_DATA_TYPE_DOUBLE, &rightv);
+  scltMakeOpNode(&opNode, OP_TYPE_MULTI, TSDB_DATA_TYPE_DOUBLE, pLeft, pRight);
+
+  SColumnInfoData *pcolumn = (SColumnInfoData *)taosArrayGetLast(src->pDataBlock);
+  colDataSetVal(pcolumn, 1, NULL, true);
+  colDataSetVal(pcolumn, 8, NULL, true);
+
+  SArray *blockList = taosArrayInit(1, POINTER_BYTES);
+  taosArrayPush(blockList, &src);
+  SColumnInfo colInfo = createColumnInfo(1, TSDB_DATA_TYPE_DOUBLE, sizeof(double));
+  int16_t     dataBlockId = 0, slotId = 0;
+  scltAppendReservedSlot(blockList, &dataBlockId, &slotId, false, rowNum, &colInfo);
+  scltMakeTargetNode(&opNode, dataBlockId, slotId, opNode);
+
+  int32_t code = scalarCalculate(opNode, blockList, NULL);
+  ASSERT_EQ(code, 0);
+
+  SSDataBlock *res = *(SSDataBlock **)taosArrayGetLast(blockList);
+  ASSERT_EQ(res->info.rows, rowNum);
+  SColumnInfoData *column = (SColumnInfoData *)taosArrayGetLast(res->pDataBlock);
+  ASSERT_EQ(column->info.type, TSDB_DATA_TYPE_DOUBLE);
+  for (int32_t i = 0; i < rowNum; ++i) {
+    if (i == 1 || i == 8) {
+      ASSERT_TRUE(colDataIsNull_f(column->nullbitmap, i));
+    } else {
+      ASSERT_FALSE(colDataIsNull_f(column->nullbitmap, i));
+      ASSERT_EQ(*((double *)colDataGetData(column, i)), leftv[i] * rightv);
+    }
+  }
+  taosArrayDestroyEx(blockList, scltFreeDataBlock);
+  nodesDestroyNode(opNode);
+}
+
+// calculates pLeft op pRight of the rows in src, and copies the double result and the null flag of each row out
+void scltCalcDoubleOp(SNode *pLeft, SNode *pRight, SSDataBlock *src, EOperatorType opType, int32_t rowNum,
+                      double *pRes, bool *pNull) {
+  SNode *opNode = NULL;
+  scltMakeOpNode(&opNode, opType, TSDB_DATA_TYPE_DOUBLE, pLeft, pRight);
+
+  SArray *blockList = taosArrayInit(1, POINTER_BYTES);
+  taosArrayPush(blockList, &src);
+  SColumnInfo colInfo = createColumnInfo(1, TSDB_DATA_TYPE_DOUBLE, sizeof(double));
+  int16_t     dataBlockId = 0, slotId = 0;
+  scltAppendReservedSlot(blockList, &dataBlockId, &slotId, false, rowNum, &colInfo);
+  scltMakeTargetNode(&opNode, dataBlockId, slotId, opNode);
+
+  int32_t code = scalarCalculate(opNode, blockList, NULL);
+  ASSERT_EQ(code, 0);
+
+  SSDataBlock *res = *(SSDataBlock **)taosArrayGetLast(blockList);
+  ASSERT_EQ(res->info.rows, rowNum);
+  SColumnInfoData *column = (SColumnInfoData *)taosArrayGetLast(res->pDataBlock);
+  ASSERT_EQ(column->info.type, TSDB_DATA_TYPE_DOUBLE);
+  for (int32_t i = 0; i < rowNum; ++i) {
+    pNull[i] = colDataIsNull_f(column->nullbitmap, i);
+    pRes[i] = pNull[i] ? 0 : *((double *)colDataGetData(column, i));
+  }
+  taosArrayDestroyEx(blockList, scltFreeDataBlock);
+  nodesDestroyNode(opNode);
+}
+
+TEST(columnTest, int_column_add_double_value_with_null) {
+  SNode       *pLeft = NULL, *pRight = NULL;
+  int32_t      leftv[11] = {0, 1, -2, 3, 100, -5, 6, 7, 8, 9, INT32_MAX};
+  double       rightv = -0.5;
+  double       res[11] = {0};
+  bool         isNull[11] = {0};
+  SSDataBlock *src = NULL;
+  int32_t      rowNum = sizeof(leftv) / sizeof(leftv[0]);
+  scltMakeColumnNode(&pLeft, &src, TSDB_DATA_TYPE_INT, sizeof(int32_t), rowNum, leftv);
+  scltMakeValueNode(&pRight, TSDB_DATA_TYPE_DOUBLE, &rightv);
+
+  SColumnInfoData *pcolumn = (SColumnInfoData *)taosArrayGetLast(src->pDataBlock);
+  colDataSetVal(pcolumn, 0, NULL, true);
+  colDataSetVal(pcolumn, 9, NULL, true);
+
+  scltCalcDoubleOp(pLeft, pRight, src, OP_TYPE_ADD, rowNum, res, isNull);
+  for (int32_t i = 0; i < rowNum; ++i) {
+    if (i == 0 || i == 9) {
+      ASSERT_TRUE(isNull[i]);
+    } else {
+      ASSERT_FALSE(isNull[i]);
+      ASSERT_EQ(res[i], leftv[i] + rightv);
+    }
+  }
+}
+
+TEST(columnTest, bigint_column_sub_int_value_with_null) {
+  SNode       *pLeft = NULL, *pRight = NULL;
+  int64_t      leftv[9] = {0, 1, -2, 3, 100, -5, 6, 7, INT64_MIN};
+  int32_t      rightv = 3;
+  double       res[9] = {0};
+  bool         isNull[9] = {0};
+  SSDataBlock *src = NULL;
+  int32_t      rowNum = sizeof(leftv) / sizeof(leftv[0]);
+  scltMakeColumnNode(&pLeft, &src, TSDB_DATA_TYPE_BIGINT, sizeof(int64_t), rowNum, leftv);
+  scltMakeValueNode(&pRight, TSDB_DATA_TYPE_INT, &rightv);
+
+  SColumnInfoData *pcolumn = (SColumnInfoData *)taosArrayGetLast(src->pDataBlock);
+  colDataSetVal(pcolumn, 4, NULL, true);
+
+  scltCalcDoubleOp(pLeft, pRight, src, OP_TYPE_SUB, rowNum, res, isNull);
+  for (int32_t i = 0; i < rowNum; ++i) {
+    if (i == 4) {
+      ASSERT_TRUE(isNull[i]);
+    } else {
+      ASSERT_FALSE(isNull[i]);
+      ASSERT_EQ(res[i], (double)leftv[i] - rightv);
+    }
+  }
+}
+
+// the constant is on the left, so the kernel subtracts the column from it
+TEST(columnTest, double_value_sub_int_column_with_null) {
+  SNode       *pLeft = NULL, *pRight = NULL;
+  double       leftv = 10.25;
+  int32_t      rightv[10] = {0, 1, -2, 3, 100, -5, 6, 7, 8, 9};
+  double       res[10] = {0};
+  bool         isNull[10] = {0};
+  SSDataBlock *src = NULL;
+  int32_t      rowNum = sizeof(rightv) / sizeof(rightv[0]);
+  scltMakeValueNode(&pLeft, TSDB_DATA_TYPE_DOUBLE, &leftv);
+  scltMakeColumnNode(&pRight, &src, TSDB_DATA_TYPE_INT, sizeof(int32_t), rowNum, rightv);
+
+  SColumnInfoData *pcolumn = (SColumnInfoData *)taosArrayGetLast(src->pDataBlock);
+  colDataSetVal(pcolumn, 3, NULL, true);
+  colDataSetVal(pcolumn, 7, NULL, true);
+
+  scltCalcDoubleOp(pLeft, pRight, src, OP_TYPE_SUB, rowNum, res, isNull);
+  for (int32_t i = 0; i < rowNum; ++i) {
+    if (i == 3 || i == 7) {
+      ASSERT_TRUE(isNull[i]);
+    } else {
+      ASSERT_FALSE(isNull[i]);
+      ASSERT_EQ(res[i], leftv - rightv[i]);
+    }
+  }
+}
+
+// a null constant makes all the rows null
+TEST(columnTest, null_value_sub_int_column) {
+  SNode       *pLeft = NULL, *pRight = NULL;
+  int32_t      rightv[5] = {0, 1, -2, 3, 100};
+  double       res[5] = {0};
+  bool         isNull[5] = {0};
+  int32_t      leftv = 1;
+  SSDataBlock *src = NULL;
+  int32_t      rowNum = sizeof(rightv) / sizeof(rightv[0]);
+  scltMakeValueNode(&pLeft, TSDB_DATA_TYPE_INT, &leftv);
+  ((SValueNode *)pLeft)->isNull = true;
+  scltMakeColumnNode(&pRight, &src, TSDB_DATA_TYPE_INT, sizeof(int32_t), rowNum, rightv);
+
+  scltCalcDoubleOp(pLeft, pRight, src, OP_TYPE_SUB, rowNum, res, isNull);
+  for (int32_t i = 0; i < rowNum; ++i) {
+    ASSERT_TRUE(isNull[i]);
+  }
+}
+
+TEST(columnTest, float_column_sub_int_column_with_null) {
+  SNode       *pLeft = NULL, *pRight = NULL;
+  float        leftv[13] = {0.5, 1, -2.25, 3, 100, -5, 6, 7, 8, 9, 10.75, 11, 12};
+  int32_t      rightv[13] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, -13};
+  double       res[13] = {0};
+  bool         isNull[13] = {0};
+  SSDataBlock *src = NULL;
+  int32_t      rowNum = sizeof(leftv) / sizeof(leftv[0]);
+  scltMakeColumnNode(&pLeft, &src, TSDB_DATA_TYPE_FLOAT, sizeof(float), rowNum, leftv);
+  SColumnInfoData *pLeftColumn = (SColumnInfoData *)taosArrayGetLast(src->pDataBlock);
+  colDataSetVal(pLeftColumn, 2, NULL, true);
+  colDataSetVal(pLeftColumn, 12, NULL, true);
+
+  scltMakeColumnNode(&pRight, &src, TSDB_DATA_TYPE_INT, sizeof(int32_t), rowNum, rightv);
+  SColumnInfoData *pRightColumn = (SColumnInfoData *)taosArrayGetLast(src->pDataBlock);
+  colDataSetVal(pRightColumn, 2, NULL, true);
+  colDataSetVal(pRightColumn, 5, NULL, true);
+  colDataSetVal(pRightColumn, 9, NULL, true);
+
+  scltCalcDoubleOp(pLeft, pRight, src, OP_TYPE_SUB, rowNum, res, isNull);
+  for (int32_t i = 0; i < rowNum; ++i) {
+    if (i == 2 || i == 5 || i == 9 || i == 12) {
+      ASSERT_TRUE(isNull[i]);
+    } else {
+      ASSERT_FALSE(isNull[i]);
+      ASSERT_EQ(res[i], (double)leftv[i] - rightv[i]);
+    }
+  }
+}
+
+TEST(columnTest, smallint_column_add_double_column) {
+  SNode       *pLeft = NULL, *pRight = NULL;
+  int16_t      leftv[6] = {1, -2, 3, 4, 5, INT16_MIN};
+  double       rightv[6] = {0.5, 1.5, -2.5, 1e10, 0, 0.125};
+  double       res[6] = {0};
+  bool         isNull[6] = {0};
+  SSDataBlock *src = NULL;
+  int32_t      rowNum = sizeof(leftv) / sizeof(leftv[0]);
+  scltMakeColumnNode(&pLeft, &src, TSDB_DATA_TYPE_SMALLINT, sizeof(int16_t), rowNum, leftv);
+  scltMakeColumnNode(&pRight, &src, TSDB_DATA_TYPE_DOUBLE, sizeof(double), rowNum, rightv);
+
+  scltCalcDoubleOp(pLeft, pRight, src, OP_TYPE_ADD, rowNum, res, isNull);
+  for (int32_t i = 0; i < rowNum; ++i) {
+    ASSERT_FALSE(isNull[i]);
+    ASSERT_EQ(res[i], leftv[i] + rightv[i]);
+  }
+}
+
+// the AVX2 kernels give the same results and null flags as the scalar loops, for the full vectors and the tail rows
+TEST(columnTest, math_kernel_avx2_equals_scalar) {
+  char sse42 = 0, avx = 0, avx2 = 0, fma = 0;
+  taosGetCpuInstructions(&sse42, &avx, &avx2, &fma);
+  if (!avx2) {
+    GTEST_SKIP() << "no avx2 support";
+  }
+
+  const int32_t rowNum = 1027;
+  int32_t      *intv = (int32_t *)taosMemoryMalloc(sizeof(int32_t) * rowNum);
+  float        *floatv = (float *)taosMemoryMalloc(sizeof(float) * rowNum);
+  double       *doublev = (double *)taosMemoryMalloc(sizeof(double) * rowNum);
+  for (int32_t i = 0; i < rowNum; ++i) {
+    intv[i] = (int32_t)taosRand() - RAND_MAX / 2;
+    floatv[i] = (float)taosRand() / 7.0f;
+    doublev[i] = (double)taosRand() / 3.0;
+  }
+
+  int32_t types[3] = {TSDB_DATA_TYPE_INT, TSDB_DATA_TYPE_FLOAT, TSDB_DATA_TYPE_DOUBLE};
+  void   *values[3] = {intv, floatv, doublev};
+  double  constv = 1.75;
+
+  EOperatorType ops[3] = {OP_TYPE_ADD, OP_TYPE_SUB, OP_TYPE_MULTI};
+
+  double *res[2] = {(double *)taosMemoryMalloc(sizeof(double) * rowNum),
+                    (double *)taosMemoryMalloc(sizeof(double) * rowNum)};
+  bool   *isNull[2] = {(bool *)taosMemoryMalloc(rowNum), (bool *)taosMemoryMalloc(rowNum)};
+
+  char avx2Enable = tsAVX2Enable, simdBuiltins = tsSIMDBuiltins;
+  for (int32_t op = 0; op < 3; ++op) {
+    for (int32_t l = 0; l < 3; ++l) {
+      // the right operand is one of the columns, or the constant on either side
+      for (int32_t r = 0; r < 5; ++r) {
+        for (int32_t simd = 0; simd < 2; ++simd) {
+          tsAVX2Enable = simd;
+          tsSIMDBuiltins = simd;
+
+          SNode       *pLeft = NULL, *pRight = NULL;
+          SSDataBlock *src = NULL;
+          scltMakeColumnNode(&pLeft, &src, types[l], tDataTypes[types[l]].bytes, rowNum, values[l]);
+          SColumnInfoData *pcolumn = (SColumnInfoData *)taosArrayGetLast(src->pDataBlock);
+          for (int32_t i = 0; i < rowNum; i += 13) {
+            colDataSetVal(pcolumn, i, NULL, true);
+          }
+
+          if (r < 3) {
+            scltMakeColumnNode(&pRight, &src, types[r], tDataTypes[types[r]].bytes, rowNum, values[r]);
+            pcolumn = (SColumnInfoData *)taosArrayGetLast(src->pDataBlock);
+            for (int32_t i = 5; i < rowNum; i += 17) {
+              colDataSetVal(pcolumn, i, NULL, true);
+            }
+          } else {
+            scltMakeValueNode(&pRight, TSDB_DATA_TYPE_DOUBLE, &constv);
+          }
+
+          if (r == 4) {
+            scltCalcDoubleOp(pRight, pLeft, src, ops[op], rowNum, res[simd], isNull[simd]);
+          } else {
+            scltCalcDoubleOp(pLeft, pRight, src, ops[op], rowNum, res[simd], isNull[simd]);
+          }
+        }
+
+        for (int32_t i = 0; i < rowNum; ++i) {
+          ASSERT_EQ(isNull[0][i], isNull[1][i]) << "op:" << op << " l:" << l << " r:" << r << " row:" << i;
+          ASSERT_EQ(res[0][i], res[1][i]) << "op:" << op << " l:" << l << " r:" << r << " row:" << i;
+        }
+      }
+    }
+  }
+  tsAVX2Enable = avx2Enable;
+  tsSIMDBuiltins = simdBuiltins;
+
+  taosMemoryFree(intv);
+  taosMemoryFree(floatv);
+  taosMemoryFree(doublev);
+  for (int32_t i = 0; i < 2; ++i) {
+    taosMemoryFree(res[i]);
+    taosMemoryFree(isNull[i]);
+  }
+}
+
+// calculates pLeft op pRight of the rows in src as bigint, and copies the result and the null flag of each row out
+void scltCalcBigintOp(SNode *pLeft, SNode *pRight, SSDataBlock *src, EOperatorType opType, int32_t rowNum,
+                      int64_t *pRes, bool *pNull) {
+  SNode *opNode = NULL;
+  scltMakeOpNode(&opNode, opType, TSDB_DATA_TYPE_BIGINT, pLeft, pRight);
+
+  SArray *blockList = taosArrayInit(1, POINTER_BYTES);
+  taosArrayPush(blockList, &src);
+  SColumnInfo colInfo = createColumnInfo(1, TSDB_DATA_TYPE_BIGINT, sizeof(int64_t));
+  int16_t     dataBlockId = 0, slotId = 0;
+  scltAppendReservedSlot(blockList, &dataBlockId, &slotId, false, rowNum, &colInfo);
+  scltMakeTargetNode(&opNode, dataBlockId, slotId, opNode);
+
+  int32_t code = scalarCalculate(opNode, blockList, NULL);
+  ASSERT_EQ(code, 0);
+
+  SSDataBlock *res = *(SSDataBlock **)taosArrayGetLast(blockList);
+  ASSERT_EQ(res->info.rows, rowNum);
+  SColumnInfoData *column = (SColumnInfoData *)taosArrayGetLast(res->pDataBlock);
+  ASSERT_EQ(column->info.type, TSDB_DATA_TYPE_BIGINT);
+  for (int32_t i = 0; i < rowNum; ++i) {
+    pNull[i] = colDataIsNull_f(column->nullbitmap, i);
+    pRes[i] = pNull[i] ? 0 : *((int64_t *)colDataGetData(column, i));
+  }
+  taosArrayDestroyEx(blockList, scltFreeDataBlock);
+  nodesDestroyNode(opNode);
+}
+
+TEST(columnTest, math_operator_integer_result_type) {
+  SNode *pLeft = NULL, *pRight = NULL, *opNode = NULL;
+  scltMakeColumnNode(&pLeft, NULL, TSDB_DATA_TYPE_INT, sizeof(int32_t), 0, NULL);
+  scltMakeColumnNode(&pRight, NULL, TSDB_DATA_TYPE_TINYINT, sizeof(int8_t), 0, NULL);
+
+  EOperatorType intOps[3] = {OP_TYPE_ADD, OP_TYPE_SUB, OP_TYPE_MULTI};
+  for (int32_t i = 0; i < 3; ++i) {
+    scltMakeOpNode(&opNode, intOps[i], TSDB_DATA_TYPE_NULL, pLeft, pRight);
+    ASSERT_EQ(scalarGetOperatorResultType((SOperatorNode *)opNode), 0);
+    ASSERT_EQ(((SOperatorNode *)opNode)->node.resType.type, TSDB_DATA_TYPE_BIGINT);
+    ((SOperatorNode *)opNode)->pLeft = ((SOperatorNode *)opNode)->pRight = NULL;
+    nodesDestroyNode(opNode);
+  }
+
+  // division and remainder, and any float operand, still give a double
+  EOperatorType doubleOps[2] = {OP_TYPE_DIV, OP_TYPE_REM};
+  for (int32_t i = 0; i < 2; ++i) {
+    scltMakeOpNode(&opNode, doubleOps[i], TSDB_DATA_TYPE_NULL, pLeft, pRight);
+    ASSERT_EQ(scalarGetOperatorResultType((SOperatorNode *)opNode), 0);
+    ASSERT_EQ(((SOperatorNode *)opNode)->node.resType.type, TSDB_DATA_TYPE_DOUBLE);
+    ((SOperatorNode *)opNode)->pLeft = ((SOperatorNode *)opNode)->pRight = NULL;
+    nodesDestroyNode(opNode);
+  }
+
+  ((SColumnNode *)pRight)->node.resType.type = TSDB_DATA_TYPE_FLOAT;
+  ((SColumnNode *)pRight)->node.resType.bytes = sizeof(float);
+  scltMakeOpNode(&opNode, OP_TYPE_ADD, TSDB_DATA_TYPE_NULL, pLeft, pRight);
+  ASSERT_EQ(scalarGetOperatorResultType((SOperatorNode *)opNode), 0);
+  ASSERT_EQ(((SOperatorNode *)opNode)->node.resType.type, TSDB_DATA_TYPE_DOUBLE);
+  nodesDestroyNode(opNode);
+}
+
+TEST(columnTest, int_column_add_bigint_value_with_null) {
+  SNode       *pLeft = NULL, *pRight = NULL;
+  int32_t      leftv[11] = {0, 1, -2, 3, 100, -5, 6, 7, 8, 9, INT32_MAX};
+  int64_t      rightv = INT64_MAX;
+  int64_t      res[11] = {0};
+  bool         isNull[11] = {0};
+  SSDataBlock *src = NULL;
+  int32_t      rowNum = sizeof(leftv) / sizeof(leftv[0]);
+  scltMakeColumnNode(&pLeft, &src, TSDB_DATA_TYPE_INT, sizeof(int32_t), rowNum, leftv);
+  scltMakeValueNode(&pRight, TSDB_DATA_TYPE_BIGINT, &rightv);
+
+  SColumnInfoData *pcolumn = (SColumnInfoData *)taosArrayGetLast(src->pDataBlock);
+  colDataSetVal(pcolumn, 0, NULL, true);
+  colDataSetVal(pcolumn, 9, NULL, true);
+
+  scltCalcBigintOp(pLeft, pRight, src, OP_TYPE_ADD, rowNum, res, isNull);
+  for (int32_t i = 0; i < rowNum; ++i) {
+    if (i == 0 || i == 9) {
+      ASSERT_TRUE(isNull[i]);
+    } else {
+      ASSERT_FALSE(isNull[i]);
+      // the sum wraps around past INT64_MAX
+      ASSERT_EQ(res[i], (int64_t)((uint64_t)leftv[i] + (uint64_t)rightv));
+    }
+  }
+}
+
+// the constant is on the left, so the kernel subtracts the column from it
+TEST(columnTest, int_value_sub_smallint_column_with_null) {
+  SNode       *pLeft = NULL, *pRight = NULL;
+  int32_t      leftv = 10;
+  int16_t      rightv[10] = {0, 1, -2, 3, 100, -5, 6, 7, INT16_MIN, INT16_MAX};
+  int64_t      res[10] = {0};
+  bool         isNull[10] = {0};
+  SSDataBlock *src = NULL;
+  int32_t      rowNum = sizeof(rightv) / sizeof(rightv[0]);
+  scltMakeValueNode(&pLeft, TSDB_DATA_TYPE_INT, &leftv);
+  scltMakeColumnNode(&pRight, &src, TSDB_DATA_TYPE_SMALLINT, sizeof(int16_t), rowNum, rightv);
+
+  SColumnInfoData *pcolumn = (SColumnInfoData *)taosArrayGetLast(src->pDataBlock);
+  colDataSetVal(pcolumn, 3, NULL, true);
+  colDataSetVal(pcolumn, 7, NULL, true);
+
+  scltCalcBigintOp(pLeft, pRight, src, OP_TYPE_SUB, rowNum, res, isNull);
+  for (int32_t i = 0; i < rowNum; ++i) {
+    if (i == 3 || i == 7) {
+      ASSERT_TRUE(isNull[i]);
+    } else {
+      ASSERT_FALSE(isNull[i]);
+      ASSERT_EQ(res[i], (int64_t)leftv - rightv[i]);
+    }
+  }
+}
+
+// a null constant makes all the rows null
+TEST(columnTest, bigint_column_multi_null_value) {
+  SNode       *pLeft = NULL, *pRight = NULL;
+  int64_t      leftv[5] = {0, 1, -2, 3, 100};
+  int64_t      res[5] = {0};
+  bool         isNull[5] = {0};
+  int32_t      rightv = 1;
+  SSDataBlock *src = NULL;
+  int32_t      rowNum = sizeof(leftv) / sizeof(leftv[0]);
+  scltMakeColumnNode(&pLeft, &src, TSDB_DATA_TYPE_BIGINT, sizeof(int64_t), rowNum, leftv);
+  scltMakeValueNode(&pRight, TSDB_DATA_TYPE_INT, &rightv);
+  ((SValueNode *)pRight)->isNull = true;
+
+  scltCalcBigintOp(pLeft, pRight, src, OP_TYPE_MULTI, rowNum, res, isNull);
+  for (int32_t i = 0; i < rowNum; ++i) {
+    ASSERT_TRUE(isNull[i]);
+  }
+}
+
+TEST(columnTest, bigint_column_multi_tinyint_column_with_null) {
+  SNode       *pLeft = NULL, *pRight = NULL;
+  int64_t      leftv[7] = {1, -2, 3, 4, INT64_MAX, INT64_MIN, 9};
+  int8_t       rightv[7] = {5, 6, -7, 8, 2, -1, INT8_MIN};
+  int64_t      res[7] = {0};
+  bool         isNull[7] = {0};
+  SSDataBlock *src = NULL;
+  int32_t      rowNum = sizeof(leftv) / sizeof(leftv[0]);
+  scltMakeColumnNode(&pLeft, &src, TSDB_DATA_TYPE_BIGINT, sizeof(int64_t), rowNum, leftv);
+  SColumnInfoData *pLeftColumn = (SColumnInfoData *)taosArrayGetLast(src->pDataBlock);
+  colDataSetVal(pLeftColumn, 1, NULL, true);
+
+  scltMakeColumnNode(&pRight, &src, TSDB_DATA_TYPE_TINYINT, sizeof(int8_t), rowNum, rightv);
+  SColumnInfoData *pRightColumn = (SColumnInfoData *)taosArrayGetLast(src->pDataBlock);
+  colDataSetVal(pRightColumn, 3, NULL, true);
+
+  scltCalcBigintOp(pLeft, pRight, src, OP_TYPE_MULTI, rowNum, res, isNull);
+  for (int32_t i = 0; i < rowNum; ++i) {
+    if (i == 1 || i == 3) {
+      ASSERT_TRUE(isNull[i]);
+    } else {
+      ASSERT_FALSE(isNull[i]);
+      ASSERT_EQ(res[i], (int64_t)((uint64_t)leftv[i] * (uint64_t)(int64_t)rightv[i]));
+    }
+  }
+}
+
+// the AVX2 bigint kernels give the same results and null flags as the scalar loops
+TEST(columnTest, bigint_kernel_avx2_equals_scalar) {
+  char sse42 = 0, avx = 0, avx2 = 0, fma = 0;
+  taosGetCpuInstructions(&sse42, &avx, &avx2, &fma);
+  if (!avx2) {
+    GTEST_SKIP() << "no avx2 support";
+  }
+
+  const int32_t rowNum = 1027;
+  int8_t       *tinyintv = (int8_t *)taosMemoryMalloc(sizeof(int8_t) * rowNum);
+  int32_t      *intv = (int32_t *)taosMemoryMalloc(sizeof(int32_t) * rowNum);
+  int64_t      *bigintv = (int64_t *)taosMemoryMalloc(sizeof(int64_t) * rowNum);
+  for (int32_t i = 0; i < rowNum; ++i) {
+    tinyintv[i] = (int8_t)taosRand();
+    intv[i] = (int32_t)taosRand() - RAND_MAX / 2;
+    bigintv[i] = ((int64_t)taosRand() << 33) - (int64_t)taosRand();
+  }
+
+  int32_t types[3] = {TSDB_DATA_TYPE_TINYINT, TSDB_DATA_TYPE_INT, TSDB_DATA_TYPE_BIGINT};
+  void   *values[3] = {tinyintv, intv, bigintv};
+  int64_t constv = -3;
+
+  EOperatorType ops[3] = {OP_TYPE_ADD, OP_TYPE_SUB, OP_TYPE_MULTI};
+
+  int64_t *res[2] = {(int64_t *)taosMemoryMalloc(sizeof(int64_t) * rowNum),
+                     (int64_t *)taosMemoryMalloc(sizeof(int64_t) * rowNum)};
+  bool    *isNull[2] = {(bool *)taosMemoryMalloc(rowNum), (bool *)taosMemoryMalloc(rowNum)};
+
+  char avx2Enable = tsAVX2Enable, simdBuiltins = tsSIMDBuiltins;
+  for (int32_t op = 0; op < 3; ++op) {
+    for (int32_t l = 0; l < 3; ++l) {
+      // the right operand is one of the columns, or the constant on either side
+      for (int32_t r = 0; r < 5; ++r) {
+        for (int32_t simd = 0; simd < 2; ++simd) {
+          tsAVX2Enable = simd;
+          tsSIMDBuiltins = simd;
+
+          SNode       *pLeft = NULL, *pRight = NULL;
+          SSDataBlock *src = NULL;
+          scltMakeColumnNode(&pLeft, &src, types[l], tDataTypes[types[l]].bytes, rowNum, values[l]);
+          SColumnInfoData *pcolumn = (SColumnInfoData *)taosArrayGetLast(src->pDataBlock);
+          for (int32_t i = 0; i < rowNum; i += 13) {
+            colDataSetVal(pcolumn, i, NULL, true);
+          }
+
+          if (r < 3) {
+            scltMakeColumnNode(&pRight, &src, types[r], tDataTypes[types[r]].bytes, rowNum, values[r]);
+            pcolumn = (SColumnInfoData *)taosArrayGetLast(src->pDataBlock);
+            for (int32_t i = 5; i < rowNum; i += 17) {
+              colDataSetVal(pcolumn, i, NULL, true);
+            }
+          } else {
+            scltMakeValueNode(&pRight, TSDB_DATA_TYPE_BIGINT, &constv);
+          }
+
+          if (r == 4) {
+            scltCalcBigintOp(pRight, pLeft, src, ops[op], rowNum, res[simd], isNull[simd]);
+          } else {
+            scltCalcBigintOp(pLeft, pRight, src, ops[op], rowNum, res[simd], isNull[simd]);
+          }
+        }
+
+        for (int32_t i = 0; i < rowNum; ++i) {
+          ASSERT_EQ(isNull[0][i], isNull[1][i]) << "op:" << op << " l:" << l << " r:" << r << " row:" << i;
+          ASSERT_EQ(res[0][i], res[1][i]) << "op:" << op << " l:" << l << " r:" << r << " row:" << i;
+        }
+      }
+    }
+  }
+  tsAVX2Enable = avx2Enable;
+  tsSIMDBuiltins = simdBuiltins;
+
+  taosMemoryFree(tinyintv);
+  taosMemoryFree(intv);
+  taosMemoryFree(bigintv);
+  for (int32_t i = 0; i < 2; ++i) {
+    taosMemoryFree(res[i]);
+    taosMemoryFree(isNull[i]);
+  }
+}
+
 TEST(columnTest, bigint_column_multi_binary_column) {
   SNode  *pLeft = NULL, *pRight = NULL, *opNode = NULL;
   int64_t leftv[5] = {1, 2, 3, 4, 5};
@@ -20,36 +20,46 @@
 #include "streamBackendRocksdb.h"
 #include "taos.h"
 #include "tcommon.h"
+#include "tcompression.h"
 #include "thash.h"
 #include "tsimplehash.h"
 
 #define FLUSH_RATIO                    0.5
 #define FLUSH_NUM                      4
 #define DEFAULT_MAX_STREAM_BUFFER_SIZE (128 * 1024 * 1024);
+#define COMP_MEM_RATIO                 0.25  // max ratio of the memory used by the compressed rows
+#define COMP_MIN_GAIN_RATIO            0.75  // the row is kept uncompressed if not smaller than this ratio
+#define COMP_BUFF_SIZE(_size)          ((_size) + (_size) / 255 + 16 + 1)
 
 struct SStreamFileState {
-  SList*     usedBuffs;
-  SList*     freeBuffs;
-  SSHashObj* rowBuffMap;
-  void*      pFileStore;
-  int32_t    rowSize;
-  int32_t    selectivityRowSize;
-  int32_t    keyLen;
-  uint64_t   preCheckPointVersion;
-  uint64_t   checkPointVersion;
-  TSKEY      maxTs;
-  TSKEY      deleteMark;
-  TSKEY      flushMark;
-  uint64_t   maxRowCount;
-  uint64_t   curRowCount;
-  GetTsFun   getTs;
-  char*      id;
+  SList*       usedBuffs;
+  SList*       freeBuffs;
+  SSHashObj*   rowBuffMap;
+  void*        pFileStore;
+  int32_t      rowSize;
+  int32_t      selectivityRowSize;
+  int32_t      keyLen;
+  uint64_t     preCheckPointVersion;
+  uint64_t     checkPointVersion;
+  TSKEY        maxTs;
+  TSKEY        deleteMark;
+  TSKEY        flushMark;
+  uint64_t     maxRowCount;
+  uint64_t     curRowCount;
+  int64_t      memSize;
+  int64_t      compSize;  // bytes of the compressed rows
+  char*        pCompBuf;  // buffer to compress or decompress a row
+  GetTsFun     getTs;
+  DecodeRowFun decodeRow;  // convert the rows saved in the layout of an older version
+  void*        pDecodeParam;
+  char*        id;
 };
 
 typedef SRowBuffPos SRowBuffInfo;
 
 SStreamFileState* streamFileStateInit(int64_t memSize, uint32_t keySize, uint32_t rowSize, uint32_t selectRowSize,
-                                      GetTsFun fp, void* pFile, TSKEY delMark, const char* idstr) {
+                                      GetTsFun fp, DecodeRowFun fpDecode, void* pDecodeParam, void* pFile,
+                                      TSKEY delMark, const char* idstr) {
   if (memSize <= 0) {
     memSize = DEFAULT_MAX_STREAM_BUFFER_SIZE;
   }
@@ -63,12 +73,14 @@ SStreamFileState* streamFileStateInit(int64_t memSize, uint32_t keySize, uint32_
   }
   rowSize += selectRowSize;
   pFileState->maxRowCount = TMAX((uint64_t)memSize / rowSize, FLUSH_NUM * 2);
+  pFileState->memSize = memSize;
   pFileState->usedBuffs = tdListNew(POINTER_BYTES);
   pFileState->freeBuffs = tdListNew(POINTER_BYTES);
+  pFileState->pCompBuf = taosMemoryMalloc(COMP_BUFF_SIZE(rowSize));
   _hash_fn_t hashFn = taosGetDefaultHashFunction(TSDB_DATA_TYPE_BINARY);
   int32_t    cap = TMIN(10240, pFileState->maxRowCount);
   pFileState->rowBuffMap = tSimpleHashInit(cap, hashFn);
-  if (!pFileState->usedBuffs || !pFileState->freeBuffs || !pFileState->rowBuffMap) {
+  if (!pFileState->usedBuffs || !pFileState->freeBuffs || !pFileState->rowBuffMap || !pFileState->pCompBuf) {
     goto _error;
   }
 
@@ -79,13 +91,17 @@ SStreamFileState* streamFileStateInit(int64_t memSize, uint32_t keySize, uint32_
   pFileState->checkPointVersion = 1;
   pFileState->pFileStore = pFile;
   pFileState->getTs = fp;
+  pFileState->decodeRow = fpDecode;
+  pFileState->pDecodeParam = pDecodeParam;
   pFileState->curRowCount = 0;
   pFileState->deleteMark = delMark;
   pFileState->flushMark = INT64_MIN;
   pFileState->maxTs = INT64_MIN;
   pFileState->id = taosStrdup(idstr);
 
-  recoverSnapshot(pFileState);
+  if (recoverSnapshot(pFileState) != TSDB_CODE_SUCCESS) {
+    goto _error;
+  }
   return pFileState;
 
 _error:
@@ -96,6 +112,7 @@ _error:
 void destroyRowBuffPos(SRowBuffPos* pPos) {
   taosMemoryFreeClear(pPos->pKey);
   taosMemoryFreeClear(pPos->pRowBuff);
+  taosMemoryFreeClear(pPos->pCompBuff);
   taosMemoryFree(pPos);
 }
 
@@ -130,12 +147,27 @@ void streamFileStateDestroy(SStreamFileState* pFileState) {
   }
 
   taosMemoryFree(pFileState->id);
+  taosMemoryFree(pFileState->pCompBuf);
   tdListFreeP(pFileState->usedBuffs, destroyRowBuffAllPosPtr);
   tdListFreeP(pFileState->freeBuffs, destroyRowBuff);
   tSimpleHashCleanup(pFileState->rowBuffMap);
   taosMemoryFree(pFileState);
 }
 
+// give the row buffer back to the free list, or drop the compressed row
+static void releaseRowBuff(SStreamFileState* pFileState, SRowBuffPos* pPos) {
+  if (pPos->pRowBuff != NULL) {
+    tdListAppend(pFileState->freeBuffs, &(pPos->pRowBuff));
+    pPos->pRowBuff = NULL;
+  }
+
+  if (pPos->pCompBuff != NULL) {
+    pFileState->compSize -= pPos->compLen;
+    taosMemoryFreeClear(pPos->pCompBuff);
+    pPos->compLen = 0;
+  }
+}
+
 void clearExpiredRowBuff(SStreamFileState* pFileState, TSKEY ts, bool all) {
   SListIter iter = {0};
   tdListInitIter(pFileState->usedBuffs, &iter, TD_LIST_FORWARD);
@@ -144,9 +176,8 @@ void clearExpiredRowBuff(SStreamFileState* pFileState, TSKEY ts, bool all) {
   while ((pNode = tdListNext(&iter)) != NULL) {
     SRowBuffPos* pPos = *(SRowBuffPos**)(pNode->data);
     if (all || (pFileState->getTs(pPos->pKey) < ts && !pPos->beUsed)) {
-      ASSERT(pPos->pRowBuff != NULL);
-      tdListAppend(pFileState->freeBuffs, &(pPos->pRowBuff));
-      pPos->pRowBuff = NULL;
+      ASSERT(pPos->pRowBuff != NULL || pPos->pCompBuff != NULL);
+      releaseRowBuff(pFileState, pPos);
       if (!all) {
         tSimpleHashRemove(pFileState->rowBuffMap, pPos->pKey, pFileState->keyLen);
       }
@@ -174,7 +205,8 @@ void popUsedBuffs(SStreamFileState* pFileState, SStreamSnapshot* pFlushList, uin
   SListNode* pNode = NULL;
   while ((pNode = tdListNext(&iter)) != NULL && i < max) {
     SRowBuffPos* pPos = *(SRowBuffPos**)pNode->data;
-    if (pPos->beUsed == used) {
+    // the row being decompressed has neither buffer
+    if (pPos->beUsed == used && (pPos->pRowBuff != NULL || pPos->pCompBuff != NULL)) {
       tdListAppend(pFlushList, &pPos);
       pFileState->flushMark = TMAX(pFileState->flushMark, pFileState->getTs(pPos->pKey));
       tSimpleHashRemove(pFileState->rowBuffMap, pPos->pKey, pFileState->keyLen);
@@ -208,17 +240,140 @@ int32_t flushRowBuff(SStreamFileState* pFileState) {
   SListNode* pNode = NULL;
   while ((pNode = tdListNext(&fIter)) != NULL) {
     SRowBuffPos* pPos = *(SRowBuffPos**)pNode->data;
-    ASSERT(pPos->pRowBuff != NULL);
-    tdListAppend(pFileState->freeBuffs, &pPos->pRowBuff);
-    pPos->pRowBuff = NULL;
+    releaseRowBuff(pFileState, pPos);
+  }
+
+  tdListFreeP(pFlushList, destroyRowBuffPosPtr);
+  return TSDB_CODE_SUCCESS;
+}
+
+// the row buffers and the compressed rows share the memory of the file state
+static uint64_t getMaxRowCount(SStreamFileState* pFileState) {
+  uint64_t compRows = (pFileState->compSize + pFileState->rowSize - 1) / pFileState->rowSize;
+  uint64_t maxRows = pFileState->maxRowCount - TMIN(compRows, pFileState->maxRowCount);
+  return TMAX(maxRows, FLUSH_NUM * 2);
+}
+
+static int32_t compressRowBuff(SStreamFileState* pFileState, SRowBuffPos* pPos) {
+  int32_t len = tsCompressString(pPos->pRowBuff, pFileState->rowSize, 1, pFileState->pCompBuf,
+                                 COMP_BUFF_SIZE(pFileState->rowSize), ONE_STAGE_COMP, NULL, 0);
+  if (len <= 0 || len > pFileState->rowSize * COMP_MIN_GAIN_RATIO) {
+    return TSDB_CODE_FAILED;
+  }
+
+  pPos->pCompBuff = taosMemoryMalloc(len);
+  if (pPos->pCompBuff == NULL) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+
+  memcpy(pPos->pCompBuff, pFileState->pCompBuf, len);
+  pPos->compLen = len;
+  pFileState->compSize += len;
+
+  tdListAppend(pFileState->freeBuffs, &(pPos->pRowBuff));
+  pPos->pRowBuff = NULL;
+  return TSDB_CODE_SUCCESS;
+}
+
+static int32_t decompressRowBuff(SStreamFileState* pFileState, void* pCompBuff, int32_t compLen, void* pBuff) {
+  int32_t len = tsDecompressString(pCompBuff, compLen, 1, pBuff, pFileState->rowSize, ONE_STAGE_COMP, NULL, 0);
+  if (len != pFileState->rowSize) {
+    qError("%s failed to decompress stream state row, len:%d, rowSize:%d", pFileState->id, len, pFileState->rowSize);
+    return TSDB_CODE_FAILED;
+  }
+  return TSDB_CODE_SUCCESS;
+}
+
+// spill all the compressed rows to disk
+static int32_t flushCompRowBuff(SStreamFileState* pFileState) {
+  SStreamSnapshot* pFlushList = tdListNew(POINTER_BYTES);
+  if (!pFlushList) {
+    return TSDB_CODE_OUT_OF_MEMORY;
+  }
+
+  SListIter iter = {0};
+  tdListInitIter(pFileState->usedBuffs, &iter, TD_LIST_FORWARD);
+  SListNode* pNode = NULL;
+  while ((pNode = tdListNext(&iter)) != NULL) {
+    SRowBuffPos* pPos = *(SRowBuffPos**)pNode->data;
+    if (pPos->pCompBuff != NULL && !pPos->beUsed) {
+      tdListAppend(pFlushList, &pPos);
+      pFileState->flushMark = TMAX(pFileState->flushMark, pFileState->getTs(pPos->pKey));
+      tSimpleHashRemove(pFileState->rowBuffMap, pPos->pKey, pFileState->keyLen);
+      tdListPopNode(pFileState->usedBuffs, pNode);
+      taosMemoryFreeClear(pNode);
+    }
+  }
+
+  qDebug("%s stream state flush %d compressed rows to disk", pFileState->id, listNEles(pFlushList));
+  int32_t code = flushSnapshot(pFileState, pFlushList, false);
+
+  tdListInitIter(pFlushList, &iter, TD_LIST_FORWARD);
+  while ((pNode = tdListNext(&iter)) != NULL) {
+    SRowBuffPos* pPos = *(SRowBuffPos**)pNode->data;
+    releaseRowBuff(pFileState, pPos);
   }
 
   tdListFreeP(pFlushList, destroyRowBuffPosPtr);
+  return code;
+}
+
+/*
+ * The rows are kept in three tiers: row buffers of full size, compressed rows in memory, and rows on disk. The cold
+ * rows, which are not used by the operator, are compressed to release their row buffers, before any row buffer is
+ * flushed to disk. Once the compressed rows take COMP_MEM_RATIO of the memory, they are flushed to disk to make room.
+ * The row buffers of the rows that do not compress well are flushed to disk directly, as before.
+ */
+static int32_t compressColdRowBuff(SStreamFileState* pFileState) {
+  int64_t maxCompSize = pFileState->memSize * COMP_MEM_RATIO;
+  if (pFileState->compSize >= maxCompSize) {
+    int32_t code = flushCompRowBuff(pFileState);
+    if (code != TSDB_CODE_SUCCESS) {
+      return code;
+    }
+  }
+
+  uint64_t  num = TMAX((uint64_t)(pFileState->curRowCount * FLUSH_RATIO), FLUSH_NUM);
+  uint64_t  i = 0;
+  SListIter iter = {0};
+  tdListInitIter(pFileState->usedBuffs, &iter, TD_LIST_FORWARD);
+
+  SListNode* pNode = NULL;
+  while ((pNode = tdListNext(&iter)) != NULL && i < num && pFileState->compSize < maxCompSize) {
+    SRowBuffPos* pPos = *(SRowBuffPos**)pNode->data;
+    if (pPos->beUsed || pPos->pRowBuff == NULL) {
+      continue;
+    }
+
+    int32_t code = compressRowBuff(pFileState, pPos);
+    if (code == TSDB_CODE_OUT_OF_MEMORY) {
+      return code;
+    } else if (code == TSDB_CODE_SUCCESS) {
+      i++;
+    }
+  }
+
+  // the memory taken by the compressed rows is released from the row buffers
+  while (pFileState->curRowCount > getMaxRowCount(pFileState) && listNEles(pFileState->freeBuffs) > 1) {
+    SListNode* pFree = tdListPopHead(pFileState->freeBuffs);
+    taosMemoryFree(*(void**)pFree->data);
+    taosMemoryFree(pFree);
+    pFileState->curRowCount--;
+  }
+
+  qDebug("%s stream state compress %" PRIu64 " rows, compressed size:%" PRId64 ", row buffers:%" PRIu64,
+         pFileState->id, i, pFileState->compSize, pFileState->curRowCount);
   return TSDB_CODE_SUCCESS;
 }
 
 int32_t clearRowBuff(SStreamFileState* pFileState) {
   clearExpiredRowBuff(pFileState, pFileState->maxTs - pFileState->deleteMark, false);
+  if (isListEmpty(pFileState->freeBuffs)) {
+    int32_t code = compressColdRowBuff(pFileState);
+    if (code != TSDB_CODE_SUCCESS) {
+      return code;
+    }
+  }
   if (isListEmpty(pFileState->freeBuffs)) {
     return flushRowBuff(pFileState);
   }
@@ -236,58 +391,188 @@ void* getFreeBuff(SList* lists, int32_t buffSize) {
   return ptr;
 }
 
-SRowBuffPos* getNewRowPos(SStreamFileState* pFileState) {
-  SRowBuffPos* pPos = taosMemoryCalloc(1, sizeof(SRowBuffPos));
-  pPos->pKey = taosMemoryCalloc(1, pFileState->keyLen);
-  void* pBuff = getFreeBuff(pFileState->freeBuffs, pFileState->rowSize);
+// a new row buffer is allocated only if the row buffers and the compressed rows are within the memory of the file state
+static void* newRowBuff(SStreamFileState* pFileState) {
+  if (pFileState->curRowCount >= getMaxRowCount(pFileState)) {
+    return NULL;
+  }
+
+  void* pBuff = taosMemoryCalloc(1, pFileState->rowSize);
   if (pBuff) {
-    pPos->pRowBuff = pBuff;
-    goto _end;
+    pFileState->curRowCount++;
+  }
+  return pBuff;
+}
+
+static void* allocRowBuff(SStreamFileState* pFileState) {
+  void* pBuff = getFreeBuff(pFileState->freeBuffs, pFileState->rowSize);
+  if (pBuff == NULL) {
+    pBuff = newRowBuff(pFileState);
   }
 
-  if (pFileState->curRowCount < pFileState->maxRowCount) {
-    pBuff = taosMemoryCalloc(1, pFileState->rowSize);
-    if (pBuff) {
-      pPos->pRowBuff = pBuff;
-      pFileState->curRowCount++;
-      goto _end;
+  while (pBuff == NULL) {
+    int32_t numOfRows = listNEles(pFileState->usedBuffs);
+    int32_t code = clearRowBuff(pFileState);
+    if (code != TSDB_CODE_SUCCESS) {
+      terrno = code;
+      return NULL;
+    }
+
+    // the flushed rows may be compressed ones, which give the memory back rather than their row buffers
+    pBuff = getFreeBuff(pFileState->freeBuffs, pFileState->rowSize);
+    if (pBuff == NULL) {
+      pBuff = newRowBuff(pFileState);
+    }
+
+    if (pBuff == NULL && listNEles(pFileState->usedBuffs) == numOfRows) {
+      qError("%s failed to alloc stream state row, no row to flush, row buffers:%" PRIu64 ", compressed size:%" PRId64,
+             pFileState->id, pFileState->curRowCount, pFileState->compSize);
+      terrno = TSDB_CODE_OUT_OF_MEMORY;
+      return NULL;
     }
   }
+  return pBuff;
+}
+
+SRowBuffPos* getNewRowPos(SStreamFileState* pFileState) {
+  SRowBuffPos* pPos = taosMemoryCalloc(1, sizeof(SRowBuffPos));
+  if (pPos == NULL) {
+    terrno = TSDB_CODE_OUT_OF_MEMORY;
+    return NULL;
+  }
+
+  pPos->pKey = taosMemoryCalloc(1, pFileState->keyLen);
+  if (pPos->pKey == NULL) {
+    terrno = TSDB_CODE_OUT_OF_MEMORY;
+    destroyRowBuffPos(pPos);
+    return NULL;
+  }
 
-  int32_t code = clearRowBuff(pFileState);
-  ASSERT(code == 0);
-  pPos->pRowBuff = getFreeBuff(pFileState->freeBuffs, pFileState->rowSize);
+  pPos->pRowBuff = allocRowBuff(pFileState);
+  if (pPos->pRowBuff == NULL) {
+    destroyRowBuffPos(pPos);
+    return NULL;
+  }
 
-_end:
   tdListAppend(pFileState->usedBuffs, &pPos);
-  ASSERT(pPos->pRowBuff != NULL);
   return pPos;
 }
 
+// a row saved by an older version may be larger, it is converted by the decoder of the operator
+static int32_t loadRowBuff(SStreamFileState* pFileState, void* pRowBuff, const void* pVal, int32_t len) {
+  if (len <= pFileState->rowSize) {
+    memcpy(pRowBuff, pVal, len);
+    return TSDB_CODE_SUCCESS;
+  }
+
+  int32_t code = TSDB_CODE_FAILED;
+  if (pFileState->decodeRow != NULL) {
+    code = pFileState->decodeRow(pFileState->pDecodeParam, pVal, len, pRowBuff, pFileState->rowSize);
+  }
+  if (code != TSDB_CODE_SUCCESS) {
+    qError("%s failed to load stream state row, len:%d, rowSize:%d", pFileState->id, len, pFileState->rowSize);
+  }
+  return code;
+}
+
+// a row that can not be restored is dropped from memory like a flushed one, it is reloaded from disk on next access
+static void dropRowBuffPos(SStreamFileState* pFileState, SRowBuffPos* pPos) {
+  SListIter iter = {0};
+  tdListInitIter(pFileState->usedBuffs, &iter, TD_LIST_FORWARD);
+
+  SListNode* pNode = NULL;
+  while ((pNode = tdListNext(&iter)) != NULL) {
+    if (*(SRowBuffPos**)pNode->data == pPos) {
+      tdListPopNode(pFileState->usedBuffs, pNode);
+      taosMemoryFreeClear(pNode);
+      break;
+    }
+  }
+
+  SRowBuffPos** pos = tSimpleHashGet(pFileState->rowBuffMap, pPos->pKey, pFileState->keyLen);
+  if (pos != NULL && *pos == pPos) {
+    tSimpleHashRemove(pFileState->rowBuffMap, pPos->pKey, pFileState->keyLen);
+  }
+}
+
+// bring the compressed row back to a row buffer, the row stays in the used list
+static int32_t restoreRowBuff(SStreamFileState* pFileState, SRowBuffPos* pPos) {
+  void*   pCompBuff = pPos->pCompBuff;
+  int32_t compLen = pPos->compLen;
+  bool    beUsed = pPos->beUsed;
+
+  // neither expired nor flushed while a row buffer is allocated for it
+  pPos->pCompBuff = NULL;
+  pPos->compLen = 0;
+  pPos->beUsed = true;
+  pFileState->compSize -= compLen;
+
+  pPos->pRowBuff = allocRowBuff(pFileState);
+  pPos->beUsed = beUsed;
+  if (pPos->pRowBuff == NULL) {
+    pPos->pCompBuff = pCompBuff;
+    pPos->compLen = compLen;
+    pFileState->compSize += compLen;
+    return terrno;
+  }
+
+  int32_t code = decompressRowBuff(pFileState, pCompBuff, compLen, pPos->pRowBuff);
+  taosMemoryFree(pCompBuff);
+  if (code != TSDB_CODE_SUCCESS) {
+    tdListAppend(pFileState->freeBuffs, &(pPos->pRowBuff));
+    pPos->pRowBuff = NULL;
+    dropRowBuffPos(pFileState, pPos);
+  }
+  return code;
+}
+
 int32_t getRowBuff(SStreamFileState* pFileState, void* pKey, int32_t keyLen, void** pVal, int32_t* pVLen) {
   pFileState->maxTs = TMAX(pFileState->maxTs, pFileState->getTs(pKey));
   SRowBuffPos** pos = tSimpleHashGet(pFileState->rowBuffMap, pKey, keyLen);
   if (pos) {
+    SRowBuffPos* pPos = *pos;
+    if (pPos->pRowBuff == NULL) {
+      int32_t code = restoreRowBuff(pFileState, pPos);
+      if (code != TSDB_CODE_SUCCESS) {
+        // nobody else refers to a row out of use, once it is out of the lists
+        if (pPos->pRowBuff == NULL && pPos->pCompBuff == NULL && !pPos->beUsed) {
+          destroyRowBuffPos(pPos);
+        }
+        return code;
+      }
+    }
+    pPos->beUsed = true;
     *pVLen = pFileState->rowSize;
-    *pVal = *pos;
-    (*pos)->beUsed = true;
+    *pVal = pPos;
     return TSDB_CODE_SUCCESS;
   }
   SRowBuffPos* pNewPos = getNewRowPos(pFileState);
+  if (pNewPos == NULL) {
+    return terrno;
+  }
   pNewPos->beUsed = true;
-  ASSERT(pNewPos->pRowBuff);
   memcpy(pNewPos->pKey, pKey, keyLen);
 
   TSKEY ts = pFileState->getTs(pKey);
-  if (ts > pFileState->maxTs - pFileState->deleteMark && ts < pFileState->flushMark) {
+  if (ts > pFileState->maxTs - pFileState->deleteMark && ts <= pFileState->flushMark) {
     int32_t len = 0;
     void*   p = NULL;
     int32_t code = streamStateGet_rocksdb(pFileState->pFileStore, pKey, &p, &len);
     qDebug("===stream===get %" PRId64 " from disc, res %d", ts, code);
     if (code == TSDB_CODE_SUCCESS) {
-      memcpy(pNewPos->pRowBuff, p, len);
+      code = loadRowBuff(pFileState, pNewPos->pRowBuff, p, len);
+    } else {
+      code = TSDB_CODE_SUCCESS;
     }
     taosMemoryFree(p);
+    if (code != TSDB_CODE_SUCCESS) {
+      // the row buffer is freed along with the position
+      pFileState->curRowCount--;
+      destroyRowBuffPos(pNewPos);
+      SListNode* pNode = tdListPopTail(pFileState->usedBuffs);
+      taosMemoryFreeClear(pNode);
+      return code;
+    }
   }
 
   tSimpleHashPut(pFileState->rowBuffMap, pKey, keyLen, &pNewPos, POINTER_BYTES);
@@ -310,19 +595,31 @@ int32_t getRowBuffByPos(SStreamFileState* pFileState, SRowBuffPos* pPos, void**
     return TSDB_CODE_SUCCESS;
   }
 
-  pPos->pRowBuff = getFreeBuff(pFileState->freeBuffs, pFileState->rowSize);
+  if (pPos->pCompBuff) {
+    int32_t code = restoreRowBuff(pFileState, pPos);
+    if (code != TSDB_CODE_SUCCESS) {
+      return code;
+    }
+    (*pVal) = pPos->pRowBuff;
+    return TSDB_CODE_SUCCESS;
+  }
+
+  pPos->pRowBuff = allocRowBuff(pFileState);
   if (!pPos->pRowBuff) {
-    int32_t code = clearRowBuff(pFileState);
-    ASSERT(code == 0);
-    pPos->pRowBuff = getFreeBuff(pFileState->freeBuffs, pFileState->rowSize);
-    ASSERT(pPos->pRowBuff);
+    return terrno;
   }
 
   int32_t len = 0;
   void*   pBuff = NULL;
   streamStateGet_rocksdb(pFileState->pFileStore, pPos->pKey, &pBuff, &len);
-  memcpy(pPos->pRowBuff, pBuff, len);
+  int32_t code = loadRowBuff(pFileState, pPos->pRowBuff, pBuff, len);
   taosMemoryFree(pBuff);
+  if (code != TSDB_CODE_SUCCESS) {
+    tdListAppend(pFileState->freeBuffs, &(pPos->pRowBuff));
+    pPos->pRowBuff = NULL;
+    return code;
+  }
+
   (*pVal) = pPos->pRowBuff;
   tdListPrepend(pFileState->usedBuffs, &pPos);
   return TSDB_CODE_SUCCESS;
@@ -369,11 +666,31 @@ int32_t flushSnapshot(SStreamFileState* pFileState, SStreamSnapshot* pSnapshot,
 
   int32_t len = pFileState->rowSize + sizeof(uint64_t) + sizeof(int32_t) + 1;
   char*   buf = taosMemoryCalloc(1, len);
+  char*   pRowBuf = NULL;
 
   void* batch = streamStateCreateBatch();
   while ((pNode = tdListNext(&iter)) != NULL && code == TSDB_CODE_SUCCESS) {
     SRowBuffPos* pPos = *(SRowBuffPos**)pNode->data;
-    ASSERT(pPos->pRowBuff && pFileState->rowSize > 0);
+    ASSERT(pFileState->rowSize > 0);
+
+    void* pRowBuff = pPos->pRowBuff;
+    if (pRowBuff == NULL) {
+      if (pPos->pCompBuff == NULL) {
+        continue;
+      }
+      if (pRowBuf == NULL) {
+        pRowBuf = taosMemoryMalloc(pFileState->rowSize);
+        if (pRowBuf == NULL) {
+          code = TSDB_CODE_OUT_OF_MEMORY;
+          break;
+        }
+      }
+      code = decompressRowBuff(pFileState, pPos->pCompBuff, pPos->compLen, pRowBuf);
+      if (code != TSDB_CODE_SUCCESS) {
+        break;
+      }
+      pRowBuff = pRowBuf;
+    }
 
     if (streamStateGetBatchSize(batch) >= BATCH_LIMIT) {
       streamStatePutBatch_rocksdb(pFileState->pFileStore, batch);
@@ -381,13 +698,14 @@ int32_t flushSnapshot(SStreamFileState* pFileState, SStreamSnapshot* pSnapshot,
     }
 
     SStateKey sKey = {.key = *((SWinKey*)pPos->pKey), .opNum = ((SStreamState*)pFileState->pFileStore)->number};
-    code = streamStatePutBatchOptimize(pFileState->pFileStore, idx, batch, &sKey, pPos->pRowBuff, pFileState->rowSize,
-                                       0, buf);
+    code = streamStatePutBatchOptimize(pFileState->pFileStore, idx, batch, &sKey, pRowBuff, pFileState->rowSize, 0,
+                                       buf);
     // todo handle failure
     memset(buf, 0, len);
 //    qDebug("===stream===put %" PRId64 " to disc, res %d", sKey.key.ts, code);
   }
   taosMemoryFree(buf);
+  taosMemoryFree(pRowBuf);
 
   if (streamStateGetBatchSize(batch) > 0) {
     streamStatePutBatch_rocksdb(pFileState->pFileStore, batch);
@@ -493,9 +811,11 @@ int32_t recoverSnapshot(SStreamFileState* pFileState) {
   SWinKey          key = {.groupId = 0, .ts = 0};
   SStreamStateCur* pCur = streamStateSeekToLast_rocksdb(pFileState->pFileStore, &key);
   if (pCur == NULL) {
-    return -1;
+    return TSDB_CODE_SUCCESS;
   }
 
+  // the recovery stops at the first row that is not loaded, only running out of memory is an error
+  int32_t ret = TSDB_CODE_SUCCESS;
   while (code == TSDB_CODE_SUCCESS) {
     if (pFileState->curRowCount == pFileState->maxRowCount) {
       break;
@@ -503,24 +823,35 @@ int32_t recoverSnapshot(SStreamFileState* pFileState) {
     void*        pVal = NULL;
     int32_t      pVLen = 0;
     SRowBuffPos* pNewPos = getNewRowPos(pFileState);
+    if (pNewPos == NULL) {
+      ret = terrno;
+      break;
+    }
     code = streamStateGetKVByCur_rocksdb(pCur, pNewPos->pKey, (const void**)&pVal, &pVLen);
-    if (code != TSDB_CODE_SUCCESS || pFileState->getTs(pNewPos->pKey) < pFileState->flushMark) {
+    if (code == TSDB_CODE_SUCCESS && pFileState->getTs(pNewPos->pKey) >= pFileState->flushMark) {
+      code = loadRowBuff(pFileState, pNewPos->pRowBuff, pVal, pVLen);
+    } else {
+      code = TSDB_CODE_FAILED;
+    }
+    if (code != TSDB_CODE_SUCCESS) {
       destroyRowBuffPos(pNewPos);
       SListNode* pNode = tdListPopTail(pFileState->usedBuffs);
       taosMemoryFreeClear(pNode);
       break;
     }
-    memcpy(pNewPos->pRowBuff, pVal, pVLen);
     code = tSimpleHashPut(pFileState->rowBuffMap, pNewPos->pKey, pFileState->keyLen, &pNewPos, POINTER_BYTES);
     if (code != TSDB_CODE_SUCCESS) {
       destroyRowBuffPos(pNewPos);
+      SListNode* pNode = tdListPopTail(pFileState->usedBuffs);
+      taosMemoryFreeClear(pNode);
+      ret = TSDB_CODE_OUT_OF_MEMORY;
       break;
     }
     code = streamStateCurPrev_rocksdb(pFileState->pFileStore, pCur);
   }
   streamStateFreeCur(pCur);
 
-  return TSDB_CODE_SUCCESS;
+  return ret;
 }
 
 int32_t streamFileStateGeSelectRowSize(SStreamFileState* pFileState) { return pFileState->selectivityRowSize; }
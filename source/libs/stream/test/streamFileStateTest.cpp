@@ -0,0 +1,392 @@
+/*
+ * Copyright (c) 2019 TAOS Data, Inc. <jhtao@taosdata.com>
+ *
+ * This program is free software: you can use, redistribute, and/or modify
+ * it under the terms of the GNU Affero General Public License, version 3
+ * or later ("AGPL"), as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#include "streamState.h"
+#include "stub.h"
+#include "tstreamFileState.h"
+
+extern "C" {
+#include "streamBackendRocksdb.h"
+}
+
+namespace {
+
+const int32_t TEST_ROW_SIZE = 1000;
+const int32_t TEST_MAX_ROWS = 16;
+
+// the rows put to or got from the backend, keyed by the window start
+struct STestStore {
+  std::map<int64_t, std::string> rows;
+  int32_t                        numOfGet;
+  int32_t                        numOfPut;
+  int32_t                        numOfState;
+};
+
+STestStore gStore;
+
+int testGetCfIdx(SStreamState* pState, const char* funcName) { return 0; }
+
+void* testCreateBatch() { return taosMemoryCalloc(1, sizeof(int64_t)); }
+
+int32_t testGetBatchSize(void* pBatch) { return 0; }
+
+void testClearBatch(void* pBatch) {}
+
+void testDestroyBatch(void* pBatch) { taosMemoryFree(pBatch); }
+
+int32_t testPutBatch(SStreamState* pState, const char* cfName, rocksdb_writebatch_t* pBatch, void* key, void* val,
+                     int32_t vlen, int64_t ttl) {
+  gStore.numOfState++;
+  return TSDB_CODE_SUCCESS;
+}
+
+int32_t testPutBatchOptimize(SStreamState* pState, int32_t cfIdx, rocksdb_writebatch_t* pBatch, void* key, void* val,
+                             int32_t vlen, int64_t ttl, void* tmpBuf) {
+  SStateKey* pKey = (SStateKey*)key;
+  gStore.rows[pKey->key.ts] = std::string((const char*)val, vlen);
+  gStore.numOfPut++;
+  return TSDB_CODE_SUCCESS;
+}
+
+int32_t testPutBatchRocksdb(SStreamState* pState, void* pBatch) { return TSDB_CODE_SUCCESS; }
+
+int32_t testGet(SStreamState* pState, const SWinKey* key, void** pVal, int32_t* pVLen) {
+  gStore.numOfGet++;
+  auto it = gStore.rows.find(key->ts);
+  if (it == gStore.rows.end()) {
+    return TSDB_CODE_FAILED;
+  }
+  *pVal = taosMemoryMalloc(it->second.size());
+  memcpy(*pVal, it->second.data(), it->second.size());
+  *pVLen = it->second.size();
+  return TSDB_CODE_SUCCESS;
+}
+
+int32_t testDel(SStreamState* pState, const SWinKey* key) {
+  gStore.rows.erase(key->ts);
+  return TSDB_CODE_SUCCESS;
+}
+
+SStreamStateCur* testSeekToLast(SStreamState* pState, const SWinKey* key) { return NULL; }
+
+void setStreamBackend() {
+  static Stub stub;
+  stub.set(streamStateGetCfIdx, testGetCfIdx);
+  stub.set(streamStateCreateBatch, testCreateBatch);
+  stub.set(streamStateGetBatchSize, testGetBatchSize);
+  stub.set(streamStateClearBatch, testClearBatch);
+  stub.set(streamStateDestroyBatch, testDestroyBatch);
+  stub.set(streamStatePutBatch, testPutBatch);
+  stub.set(streamStatePutBatchOptimize, testPutBatchOptimize);
+  stub.set(streamStatePutBatch_rocksdb, testPutBatchRocksdb);
+  stub.set(streamStateGet_rocksdb, testGet);
+  stub.set(streamStateDel_rocksdb, testDel);
+  stub.set(streamStateSeekToLast_rocksdb, testSeekToLast);
+}
+
+TSKEY testGetTs(void* pKey) { return ((SWinKey*)pKey)->ts; }
+
+// the row is mostly zero, so that it compresses well
+void fillRow(char* pRow, int64_t ts) {
+  memset(pRow, 0, TEST_ROW_SIZE);
+  *(int64_t*)pRow = ts;
+  memset(pRow + sizeof(int64_t), (char)(ts % 127 + 1), 32);
+}
+
+bool checkRow(const char* pRow, int64_t ts) {
+  char expect[TEST_ROW_SIZE];
+  fillRow(expect, ts);
+  return memcmp(pRow, expect, TEST_ROW_SIZE) == 0;
+}
+
+// the rows of the older version are TEST_LEGACY_EXTRA bytes larger and start with the window start as well
+const int32_t TEST_LEGACY_EXTRA = 100;
+
+int32_t testDecodeRow(void* param, const void* pSrc, int32_t srcLen, void* pDst, int32_t dstLen) {
+  (*(int32_t*)param)++;
+  if (srcLen != TEST_ROW_SIZE + TEST_LEGACY_EXTRA || dstLen != TEST_ROW_SIZE) {
+    return TSDB_CODE_FAILED;
+  }
+  fillRow((char*)pDst, *(const int64_t*)pSrc);
+  return TSDB_CODE_SUCCESS;
+}
+
+}  // namespace
+
+class StreamFileStateTest : public ::testing::Test {
+ protected:
+  static void SetUpTestSuite() { setStreamBackend(); }
+
+  void SetUp() override {
+    gStore.rows.clear();
+    gStore.numOfGet = 0;
+    gStore.numOfPut = 0;
+    gStore.numOfState = 0;
+    memset(&state, 0, sizeof(SStreamState));
+    state.checkPointId = 1;
+  }
+
+  SStreamFileState* init(TSKEY deleteMark, DecodeRowFun fpDecode = NULL) {
+    return streamFileStateInit((int64_t)TEST_ROW_SIZE * TEST_MAX_ROWS, sizeof(SWinKey), TEST_ROW_SIZE, 0, testGetTs,
+                               fpDecode, &numOfDecode, &state, deleteMark, "streamFileStateTest");
+  }
+
+  // write the row and release it, as the operator does
+  void putRow(SStreamFileState* pFileState, int64_t ts) {
+    SWinKey      key = {0, ts};
+    SRowBuffPos* pPos = NULL;
+    int32_t      len = 0;
+    ASSERT_EQ(getRowBuff(pFileState, &key, sizeof(SWinKey), (void**)&pPos, &len), TSDB_CODE_SUCCESS);
+    ASSERT_EQ(len, TEST_ROW_SIZE);
+    fillRow((char*)pPos->pRowBuff, ts);
+    releaseRowBuffPos(pPos);
+  }
+
+  void getRow(SStreamFileState* pFileState, int64_t ts) {
+    SWinKey      key = {0, ts};
+    SRowBuffPos* pPos = NULL;
+    int32_t      len = 0;
+    ASSERT_EQ(getRowBuff(pFileState, &key, sizeof(SWinKey), (void**)&pPos, &len), TSDB_CODE_SUCCESS);
+    ASSERT_TRUE(pPos->pRowBuff != NULL);
+    ASSERT_TRUE(pPos->pCompBuff == NULL);
+    ASSERT_TRUE(checkRow((const char*)pPos->pRowBuff, ts)) << "ts:" << ts;
+    releaseRowBuffPos(pPos);
+  }
+
+  // the positions of the rows which are compressed in memory
+  std::map<int64_t, SRowBuffPos*> compressedRows(SStreamFileState* pFileState) {
+    std::map<int64_t, SRowBuffPos*> rows;
+    SListIter                       iter = {0};
+    tdListInitIter(getSnapshot(pFileState), &iter, TD_LIST_FORWARD);
+    SListNode* pNode = NULL;
+    while ((pNode = tdListNext(&iter)) != NULL) {
+      SRowBuffPos* pPos = *(SRowBuffPos**)pNode->data;
+      if (pPos->pCompBuff != NULL) {
+        rows[testGetTs(pPos->pKey)] = pPos;
+      }
+    }
+    return rows;
+  }
+
+  SStreamState state;
+  int32_t      numOfDecode = 0;
+};
+
+TEST_F(StreamFileStateTest, compressedRowHit) {
+  SStreamFileState* pFileState = init(INT64_MAX / 2);
+  ASSERT_TRUE(pFileState != NULL);
+
+  // the cold rows are compressed to make room for the new ones, rather than being flushed to disk
+  for (int64_t ts = 0; ts <= TEST_MAX_ROWS; ++ts) {
+    putRow(pFileState, ts);
+  }
+  auto rows = compressedRows(pFileState);
+  ASSERT_FALSE(rows.empty());
+  ASSERT_EQ(gStore.numOfPut, 0);
+
+  for (const auto& row : rows) {
+    ASSERT_LT(row.second->compLen, TEST_ROW_SIZE);
+    getRow(pFileState, row.first);
+  }
+  for (int64_t ts = 0; ts <= TEST_MAX_ROWS; ++ts) {
+    getRow(pFileState, ts);
+  }
+  ASSERT_EQ(gStore.numOfGet, 0);
+  ASSERT_EQ(gStore.numOfPut, 0);
+
+  streamFileStateDestroy(pFileState);
+}
+
+TEST_F(StreamFileStateTest, compressedRowRestoreFailed) {
+  SStreamFileState* pFileState = init(INT64_MAX / 2);
+  ASSERT_TRUE(pFileState != NULL);
+
+  for (int64_t ts = 0; ts <= TEST_MAX_ROWS; ++ts) {
+    putRow(pFileState, ts);
+  }
+  auto rows = compressedRows(pFileState);
+  ASSERT_FALSE(rows.empty());
+
+  // an invalid compression indicator, the row can not be restored
+  SRowBuffPos* pCorrupt = rows.begin()->second;
+  ((char*)pCorrupt->pCompBuff)[0] = 2;
+
+  SWinKey      key = {0, rows.begin()->first};
+  SRowBuffPos* pPos = NULL;
+  int32_t      len = 0;
+  ASSERT_NE(getRowBuff(pFileState, &key, sizeof(SWinKey), (void**)&pPos, &len), TSDB_CODE_SUCCESS);
+  ASSERT_TRUE(pPos == NULL);
+
+  // the row is dropped, the next access starts it over
+  ASSERT_FALSE(hasRowBuff(pFileState, &key, sizeof(SWinKey)));
+  ASSERT_EQ(getRowBuff(pFileState, &key, sizeof(SWinKey), (void**)&pPos, &len), TSDB_CODE_SUCCESS);
+  ASSERT_TRUE(pPos->pRowBuff != NULL);
+  releaseRowBuffPos(pPos);
+
+  // the row buffers taken by the failed restores are given back
+  for (int64_t ts = TEST_MAX_ROWS + 1; ts <= TEST_MAX_ROWS * 4; ++ts) {
+    putRow(pFileState, ts);
+  }
+
+  streamFileStateDestroy(pFileState);
+}
+
+// the row held by the operator is not handed out when it can not be restored, it is reloaded on next access
+TEST_F(StreamFileStateTest, compressedRowByPosRestoreFailed) {
+  SStreamFileState* pFileState = init(INT64_MAX / 2);
+  ASSERT_TRUE(pFileState != NULL);
+
+  for (int64_t ts = 0; ts <= TEST_MAX_ROWS; ++ts) {
+    putRow(pFileState, ts);
+  }
+  auto rows = compressedRows(pFileState);
+  ASSERT_FALSE(rows.empty());
+
+  SRowBuffPos* pCorrupt = rows.begin()->second;
+  ((char*)pCorrupt->pCompBuff)[0] = 2;
+
+  void* pVal = NULL;
+  ASSERT_NE(getRowBuffByPos(pFileState, pCorrupt, &pVal), TSDB_CODE_SUCCESS);
+  ASSERT_TRUE(pVal == NULL);
+  ASSERT_TRUE(pCorrupt->pRowBuff == NULL);
+  ASSERT_TRUE(pCorrupt->pCompBuff == NULL);
+  ASSERT_EQ(compressedRows(pFileState).count(rows.begin()->first), 0);
+
+  SWinKey key = {0, rows.begin()->first};
+  ASSERT_FALSE(hasRowBuff(pFileState, &key, sizeof(SWinKey)));
+
+  ASSERT_EQ(getRowBuffByPos(pFileState, pCorrupt, &pVal), TSDB_CODE_SUCCESS);
+  ASSERT_TRUE(pVal != NULL && pVal == pCorrupt->pRowBuff);
+  ASSERT_EQ(gStore.numOfGet, 1);
+
+  streamFileStateDestroy(pFileState);
+}
+
+TEST_F(StreamFileStateTest, checkpointFlushCompressedRows) {
+  SStreamFileState* pFileState = init(INT64_MAX / 2);
+  ASSERT_TRUE(pFileState != NULL);
+
+  for (int64_t ts = 0; ts <= TEST_MAX_ROWS; ++ts) {
+    putRow(pFileState, ts);
+  }
+  auto rows = compressedRows(pFileState);
+  ASSERT_FALSE(rows.empty());
+
+  // the checkpoint writes the rows, decompressed, and keeps them in memory
+  ASSERT_EQ(flushSnapshot(pFileState, getSnapshot(pFileState), true), TSDB_CODE_SUCCESS);
+  ASSERT_EQ(gStore.rows.size(), TEST_MAX_ROWS + 1);
+  for (int64_t ts = 0; ts <= TEST_MAX_ROWS; ++ts) {
+    ASSERT_EQ(gStore.rows[ts].size(), TEST_ROW_SIZE);
+    ASSERT_TRUE(checkRow(gStore.rows[ts].data(), ts)) << "ts:" << ts;
+  }
+  ASSERT_GT(gStore.numOfState, 0);
+  for (const auto& row : rows) {
+    ASSERT_TRUE(row.second->pCompBuff != NULL);
+  }
+
+  for (int64_t ts = 0; ts <= TEST_MAX_ROWS; ++ts) {
+    getRow(pFileState, ts);
+  }
+  ASSERT_EQ(gStore.numOfGet, 0);
+
+  streamFileStateDestroy(pFileState);
+}
+
+TEST_F(StreamFileStateTest, expireCompressedRows) {
+  SStreamFileState* pFileState = init(100);
+  ASSERT_TRUE(pFileState != NULL);
+
+  for (int64_t ts = 0; ts <= TEST_MAX_ROWS; ++ts) {
+    putRow(pFileState, ts);
+  }
+  auto rows = compressedRows(pFileState);
+  ASSERT_FALSE(rows.empty());
+
+  // the compressed rows are dropped once they are older than the delete mark
+  putRow(pFileState, 500);
+  getSnapshot(pFileState);
+  for (int64_t ts = 0; ts <= TEST_MAX_ROWS; ++ts) {
+    SWinKey key = {0, ts};
+    ASSERT_FALSE(hasRowBuff(pFileState, &key, sizeof(SWinKey)));
+  }
+
+  // the memory of the expired rows is reused by the new ones
+  for (int64_t ts = 501; ts <= 501 + TEST_MAX_ROWS * 2; ++ts) {
+    putRow(pFileState, ts);
+  }
+  for (int64_t ts = 501; ts <= 501 + TEST_MAX_ROWS * 2; ++ts) {
+    getRow(pFileState, ts);
+  }
+  ASSERT_EQ(gStore.numOfPut, 0);
+
+  streamFileStateDestroy(pFileState);
+}
+
+TEST_F(StreamFileStateTest, spillRows) {
+  SStreamFileState* pFileState = init(INT64_MAX / 2);
+  ASSERT_TRUE(pFileState != NULL);
+
+  // more rows than the memory holds, even compressed, so some of them are flushed to disk
+  const int64_t numOfRows = TEST_MAX_ROWS * 20;
+  for (int64_t ts = 0; ts < numOfRows; ++ts) {
+    putRow(pFileState, ts);
+  }
+  ASSERT_GT(gStore.numOfPut, 0);
+
+  for (int64_t ts = 0; ts < numOfRows; ts += 7) {
+    getRow(pFileState, ts);
+  }
+  for (int64_t ts = numOfRows - 1; ts >= 0; ts -= 3) {
+    getRow(pFileState, ts);
+  }
+
+  streamFileStateDestroy(pFileState);
+}
+
+// the rows saved by an older version are larger, they are loaded through the decoder of the operator
+TEST_F(StreamFileStateTest, legacyRowDecoded) {
+  std::string legacy(TEST_ROW_SIZE + TEST_LEGACY_EXTRA, '\x7f');
+  *(int64_t*)&legacy[0] = 5;
+  gStore.rows[5] = legacy;
+  gStore.rows[6] = legacy;
+
+  SStreamFileState* pFileState = init(INT64_MAX / 2, testDecodeRow);
+  ASSERT_TRUE(pFileState != NULL);
+  streamFileStateReloadInfo(pFileState, 10);
+
+  getRow(pFileState, 5);
+  ASSERT_EQ(numOfDecode, 1);
+  streamFileStateDestroy(pFileState);
+
+  // no decoder, the row is not copied over the buffer
+  pFileState = init(INT64_MAX / 2);
+  ASSERT_TRUE(pFileState != NULL);
+  streamFileStateReloadInfo(pFileState, 10);
+
+  SWinKey      key = {0, 6};
+  SRowBuffPos* pPos = NULL;
+  int32_t      len = 0;
+  ASSERT_NE(getRowBuff(pFileState, &key, sizeof(SWinKey), (void**)&pPos, &len), TSDB_CODE_SUCCESS);
+  ASSERT_FALSE(hasRowBuff(pFileState, &key, sizeof(SWinKey)));
+  streamFileStateDestroy(pFileState);
+}
+
+#pragma GCC diagnostic pop
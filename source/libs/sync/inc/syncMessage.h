@@ -219,7 +219,7 @@ typedef struct SyncSnapshotRsp {
   int32_t   ack;
   int32_t   code;
   SyncIndex snapBeginIndex;  // when ack = SYNC_SNAPSHOT_SEQ_BEGIN, it's valid
-  int16_t   reserved;
+  int16_t   windowSize;      // blocks the receiver keeps ahead of ack, 0 from receivers taking one block at a time
 } SyncSnapshotRsp;
 
 typedef struct SyncLeaderTransfer {
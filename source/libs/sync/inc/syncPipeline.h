@@ -60,6 +60,9 @@ typedef struct SSyncLogBuffer {
   bool             isCatchup;
 } SSyncLogBuffer;
 
+// max # of matched entries persisted with one wal write
+#define SYNC_LOG_PERSIST_BATCH 64
+
 // SSyncLogRepMgr
 SSyncLogReplMgr* syncLogReplCreate();
 void             syncLogReplDestroy(SSyncLogReplMgr* pMgr);
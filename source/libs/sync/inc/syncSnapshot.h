@@ -30,22 +30,60 @@ extern "C" {
 
 #define SYNC_SNAPSHOT_RETRY_MS 5000
 
+// max number of data blocks in flight between snapshot sender and receiver
+#define SYNC_SNAPSHOT_WINDOW_SIZE 8
+
+// duplicated acks before the first not acked block is resent without waiting for the resend timer
+#define SYNC_SNAPSHOT_DUP_ACKS 2
+
+typedef struct SSyncSnapBlock {
+  int32_t seq;
+  int32_t blockLen;
+  int32_t capacity;  // receiver keeps the buffer for reuse
+  void   *pBlock;
+  int64_t sendTime;
+} SSyncSnapBlock;
+
+// max number of blocks read by the read-ahead thread and not taken into the window yet
+#define SYNC_SNAPSHOT_READ_AHEAD 8
+
+// blocks are read by a thread of the sender ahead of the acks, and the buffers of acked blocks are offered back to
+// the reads
+typedef struct SSyncSnapReadAhead {
+  TdThread       thread;
+  TdThreadMutex  mutex;
+  TdThreadCond   notEmpty;  // a block is read, or the read ends
+  TdThreadCond   notFull;   // a block is taken, or the thread is asked to stop
+  bool           running;
+  bool           stop;
+  bool           end;   // reader exhausted or failed
+  int32_t        code;  // read error
+  int32_t        head;
+  int32_t        num;
+  SSyncSnapBlock blocks[SYNC_SNAPSHOT_READ_AHEAD];
+  int32_t        numOfFree;
+  SSyncSnapBlock freeBlocks[SYNC_SNAPSHOT_WINDOW_SIZE];  // released buffers, blockLen is not used
+} SSyncSnapReadAhead;
+
 typedef struct SSyncSnapshotSender {
-  bool           start;
-  int32_t        seq;
-  int32_t        ack;
-  void          *pReader;
-  void          *pCurrentBlock;
-  int32_t        blockLen;
-  SSnapshotParam snapshotParam;
-  SSnapshot      snapshot;
-  SSyncCfg       lastConfig;
-  int64_t        sendingMS;
-  SyncTerm       term;
-  int64_t        startTime;
-  int64_t        endTime;
-  int64_t        lastSendTime;
-  bool           finish;
+  bool               start;
+  int32_t            seq;         // last sent
+  int32_t            ack;         // last acked, acks are cumulative
+  int32_t            windowSize;  // negotiated with the receiver when the snapshot is prepared
+  int32_t            dupAcks;     // duplicated acks of the current ack
+  void              *pReader;
+  bool               readEnd;
+  SSyncSnapBlock     window[SYNC_SNAPSHOT_WINDOW_SIZE];  // sent but not acked blocks, indexed by seq
+  SSyncSnapReadAhead readAhead;
+  SSnapshotParam     snapshotParam;
+  SSnapshot          snapshot;
+  SSyncCfg           lastConfig;
+  int64_t            sendingMS;
+  SyncTerm           term;
+  int64_t            startTime;
+  int64_t            endTime;
+  int64_t            lastSendTime;
+  bool               finish;
 
   // init when create
   SSyncNode *pSyncNode;
@@ -72,6 +110,9 @@ typedef struct SSyncSnapshotReceiver {
   SSnapshotParam snapshotParam;
   SSnapshot      snapshot;
 
+  // blocks arrived ahead of ack + 1, indexed by seq
+  SSyncSnapBlock window[SYNC_SNAPSHOT_WINDOW_SIZE];
+
   // init when create
   SSyncNode *pSyncNode;
 } SSyncSnapshotReceiver;
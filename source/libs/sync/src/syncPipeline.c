@@ -406,25 +406,33 @@ static inline bool syncLogStoreNeedFlush(SSyncRaftEntry* pEntry, int32_t replica
   return (replicaNum > 1) && (pEntry->originalRpcType == TDMT_VND_COMMIT);
 }
 
-int32_t syncLogStorePersist(SSyncLogStore* pLogStore, SSyncNode* pNode, SSyncRaftEntry* pEntry) {
-  ASSERT(pEntry->index >= 0);
+// group commit of consecutive entries matched in the log buffer
+int32_t syncLogStorePersist(SSyncLogStore* pLogStore, SSyncNode* pNode, SSyncRaftEntry** ppEntries, int32_t num) {
+  SSyncRaftEntry* pFirst = ppEntries[0];
+  SSyncRaftEntry* pLast = ppEntries[num - 1];
+
+  ASSERT(pFirst->index >= 0);
   SyncIndex lastVer = pLogStore->syncLogLastIndex(pLogStore);
-  if (lastVer >= pEntry->index && pLogStore->syncLogTruncate(pLogStore, pEntry->index) < 0) {
-    sError("failed to truncate log store since %s. from index:%" PRId64 "", terrstr(), pEntry->index);
+  if (lastVer >= pFirst->index && pLogStore->syncLogTruncate(pLogStore, pFirst->index) < 0) {
+    sError("failed to truncate log store since %s. from index:%" PRId64 "", terrstr(), pFirst->index);
     return -1;
   }
   lastVer = pLogStore->syncLogLastIndex(pLogStore);
-  ASSERT(pEntry->index == lastVer + 1);
+  ASSERT(pFirst->index == lastVer + 1);
+
+  bool doFsync = false;
+  for (int32_t i = 0; i < num; ++i) {
+    doFsync = doFsync || syncLogStoreNeedFlush(ppEntries[i], pNode->replicaNum);
+  }
 
-  bool doFsync = syncLogStoreNeedFlush(pEntry, pNode->replicaNum);
-  if (pLogStore->syncLogAppendEntry(pLogStore, pEntry, doFsync) < 0) {
-    sError("failed to append sync log entry since %s. index:%" PRId64 ", term:%" PRId64 "", terrstr(), pEntry->index,
-           pEntry->term);
+  if (pLogStore->syncLogAppendEntryBatch(pLogStore, ppEntries, num, doFsync) < 0) {
+    sError("failed to append sync log entries since %s. index:%" PRId64 "-%" PRId64 ", term:%" PRId64 "", terrstr(),
+           pFirst->index, pLast->index, pLast->term);
     return -1;
   }
 
   lastVer = pLogStore->syncLogLastIndex(pLogStore);
-  ASSERT(pEntry->index == lastVer);
+  ASSERT(pLast->index == lastVer);
   return 0;
 }
 
@@ -432,8 +440,10 @@ int64_t syncLogBufferProceed(SSyncLogBuffer* pBuf, SSyncNode* pNode, SyncTerm* p
   taosThreadMutexLock(&pBuf->mutex);
   syncLogBufferValidate(pBuf);
 
-  SSyncLogStore* pLogStore = pNode->pLogStore;
-  int64_t        matchIndex = pBuf->matchIndex;
+  SSyncLogStore*  pLogStore = pNode->pLogStore;
+  int64_t         matchIndex = pBuf->matchIndex;
+  SSyncRaftEntry* pending[SYNC_LOG_PERSIST_BATCH];
+  int32_t         nPending = 0;
 
   while (pBuf->matchIndex + 1 < pBuf->endIndex) {
     int64_t index = pBuf->matchIndex + 1;
@@ -478,8 +488,15 @@ int64_t syncLogBufferProceed(SSyncLogBuffer* pBuf, SSyncNode* pNode, SyncTerm* p
     // replicate on demand
     (void)syncNodeReplicateWithoutLock(pNode);
 
-    // persist
-    if (syncLogStorePersist(pLogStore, pNode, pEntry) < 0) {
+    // persist, entries matched in a row are written together
+    pending[nPending++] = pEntry;
+    if (nPending < SYNC_LOG_PERSIST_BATCH && pBuf->matchIndex + 1 < pBuf->endIndex) {
+      continue;
+    }
+
+    int32_t code = syncLogStorePersist(pLogStore, pNode, pending, nPending);
+    nPending = 0;
+    if (code < 0) {
       sError("vgId:%d, failed to persist sync log entry from buffer since %s. index:%" PRId64, pNode->vgId, terrstr(),
              pEntry->index);
       taosMsleep(1);
@@ -493,6 +510,17 @@ int64_t syncLogBufferProceed(SSyncLogBuffer* pBuf, SSyncNode* pNode, SyncTerm* p
   }  // end of while
 
 _out:
+  // entries matched before stopping at a missing or mismatching one
+  if (nPending > 0) {
+    if (syncLogStorePersist(pLogStore, pNode, pending, nPending) < 0) {
+      sError("vgId:%d, failed to persist sync log entry from buffer since %s. index:%" PRId64, pNode->vgId, terrstr(),
+             pending[nPending - 1]->index);
+      taosMsleep(1);
+    } else {
+      matchIndex = pending[nPending - 1]->index;
+      syncIndexMgrSetIndex(pNode->pMatchIndex, &pNode->myRaftId, matchIndex);
+    }
+  }
   pBuf->matchIndex = matchIndex;
   if (pMatchTerm) {
     *pMatchTerm = pBuf->entries[(matchIndex + pBuf->size) % pBuf->size].pItem->term;
@@ -24,6 +24,8 @@
 // public function
 static int32_t   raftLogRestoreFromSnapshot(struct SSyncLogStore* pLogStore, SyncIndex snapshotIndex);
 static int32_t   raftLogAppendEntry(struct SSyncLogStore* pLogStore, SSyncRaftEntry* pEntry, bool forceSync);
+static int32_t   raftLogAppendEntryBatch(struct SSyncLogStore* pLogStore, SSyncRaftEntry** ppEntries, int32_t num,
+                                         bool forceSync);
 static int32_t   raftLogTruncate(struct SSyncLogStore* pLogStore, SyncIndex fromIndex);
 static bool      raftLogExist(struct SSyncLogStore* pLogStore, SyncIndex index);
 static int32_t   raftLogUpdateCommitIndex(SSyncLogStore* pLogStore, SyncIndex index);
@@ -72,6 +74,7 @@ SSyncLogStore* logStoreCreate(SSyncNode* pSyncNode) {
   pLogStore->syncLogLastIndex = raftLogLastIndex;
   pLogStore->syncLogLastTerm = raftLogLastTerm;
   pLogStore->syncLogAppendEntry = raftLogAppendEntry;
+  pLogStore->syncLogAppendEntryBatch = raftLogAppendEntryBatch;
   pLogStore->syncLogGetEntry = raftLogGetEntry;
   pLogStore->syncLogTruncate = raftLogTruncate;
   pLogStore->syncLogWriteIndex = raftLogWriteIndex;
@@ -226,6 +229,51 @@ static int32_t raftLogAppendEntry(struct SSyncLogStore* pLogStore, SSyncRaftEntr
   return 0;
 }
 
+// consecutive entries are written with one vectored write and share one fsync
+static int32_t raftLogAppendEntryBatch(struct SSyncLogStore* pLogStore, SSyncRaftEntry** ppEntries, int32_t num,
+                                       bool forceSync) {
+  SSyncLogStoreData* pData = pLogStore->data;
+  SWal*              pWal = pData->pWal;
+
+  if (num == 1) {
+    return raftLogAppendEntry(pLogStore, ppEntries[0], forceSync);
+  }
+
+  SWalBatchEntry* pWalEntries = taosMemoryCalloc(num, sizeof(SWalBatchEntry));
+  if (pWalEntries == NULL) {
+    terrno = TSDB_CODE_OUT_OF_MEMORY;
+    return -1;
+  }
+
+  for (int32_t i = 0; i < num; ++i) {
+    SSyncRaftEntry* pEntry = ppEntries[i];
+    pWalEntries[i].index = pEntry->index;
+    pWalEntries[i].msgType = pEntry->originalRpcType;
+    pWalEntries[i].syncMeta.isWeek = pEntry->isWeak;
+    pWalEntries[i].syncMeta.seqNum = pEntry->seqNum;
+    pWalEntries[i].syncMeta.term = pEntry->term;
+    pWalEntries[i].body = pEntry->data;
+    pWalEntries[i].bodyLen = pEntry->dataLen;
+  }
+
+  int64_t tsWriteBegin = taosGetTimestampNs();
+  int64_t index = walAppendLogBatch(pWal, pWalEntries, num, forceSync);
+  int64_t tsElapsed = taosGetTimestampNs() - tsWriteBegin;
+  taosMemoryFree(pWalEntries);
+
+  if (index < 0) {
+    sNError(pData->pSyncNode, "wal batch write error, index:%" PRId64 "-%" PRId64 ", err:0x%x, msg:%s",
+            ppEntries[0]->index, ppEntries[num - 1]->index, terrno, tstrerror(terrno));
+    return -1;
+  }
+
+  ASSERT(ppEntries[num - 1]->index == index);
+
+  sNTrace(pData->pSyncNode, "write index:%" PRId64 "-%" PRId64 ", entries:%d, elapsed:%" PRId64, ppEntries[0]->index,
+          index, num, tsElapsed);
+  return 0;
+}
+
 // entry found, return 0
 // entry not found, return -1, terrno = TSDB_CODE_WAL_LOG_NOT_EXIST
 // other error, return -1
@@ -23,6 +23,194 @@
 #include "syncReplication.h"
 #include "syncUtil.h"
 
+static void snapshotBlockInit(SSyncSnapBlock *pWindow) {
+  for (int32_t i = 0; i < SYNC_SNAPSHOT_WINDOW_SIZE; ++i) {
+    pWindow[i].seq = SYNC_SNAPSHOT_SEQ_INVALID;
+    pWindow[i].blockLen = 0;
+    pWindow[i].capacity = 0;
+    pWindow[i].pBlock = NULL;
+    pWindow[i].sendTime = 0;
+  }
+}
+
+static void snapshotBlockRelease(SSyncSnapBlock *pBlock) {
+  taosMemoryFreeClear(pBlock->pBlock);
+  pBlock->seq = SYNC_SNAPSHOT_SEQ_INVALID;
+  pBlock->blockLen = 0;
+  pBlock->capacity = 0;
+  pBlock->sendTime = 0;
+}
+
+static void snapshotBlockClear(SSyncSnapBlock *pWindow) {
+  for (int32_t i = 0; i < SYNC_SNAPSHOT_WINDOW_SIZE; ++i) {
+    snapshotBlockRelease(&pWindow[i]);
+  }
+}
+
+static FORCE_INLINE SSyncSnapBlock *snapshotBlockGet(SSyncSnapBlock *pWindow, int32_t seq) {
+  return &pWindow[seq % SYNC_SNAPSHOT_WINDOW_SIZE];
+}
+
+// reads blocks until SYNC_SNAPSHOT_READ_AHEAD of them wait to be sent, the reads are handed a released buffer when
+// there is one
+static void *snapshotReadAheadFunc(void *param) {
+  SSyncSnapshotSender *pSender = param;
+  SSyncSnapReadAhead  *pRead = &pSender->readAhead;
+  SSyncFSM            *pFsm = pSender->pSyncNode->pFsm;
+  setThreadName("sync-snap-read");
+
+  while (1) {
+    taosThreadMutexLock(&pRead->mutex);
+    while (!pRead->stop && pRead->num >= SYNC_SNAPSHOT_READ_AHEAD) {
+      taosThreadCondWait(&pRead->notFull, &pRead->mutex);
+    }
+    if (pRead->stop) {
+      taosThreadMutexUnlock(&pRead->mutex);
+      break;
+    }
+
+    void   *pBlock = NULL;
+    int32_t capacity = 0;
+    if (pRead->numOfFree > 0) {
+      SSyncSnapBlock *pFree = &pRead->freeBlocks[--pRead->numOfFree];
+      pBlock = pFree->pBlock;
+      capacity = pFree->capacity;
+      pFree->pBlock = NULL;
+      pFree->capacity = 0;
+    }
+    taosThreadMutexUnlock(&pRead->mutex);
+
+    // the offered buffer is owned by the fsm from here on
+    void   *pOffered = pBlock;
+    int32_t blockLen = capacity;
+    int32_t code = pFsm->FpSnapshotDoRead(pFsm, pSender->pReader, &pBlock, &blockLen);
+    if (code != 0) {
+      code = (terrno != 0) ? terrno : TSDB_CODE_SYN_INTERNAL_ERROR;
+    }
+
+    taosThreadMutexLock(&pRead->mutex);
+    if (code != 0 || blockLen <= 0) {
+      if (code == 0) {
+        taosMemoryFree(pBlock);
+      }
+      pRead->code = code;
+      pRead->end = true;
+      taosThreadCondSignal(&pRead->notEmpty);
+      taosThreadMutexUnlock(&pRead->mutex);
+      break;
+    }
+
+    SSyncSnapBlock *pSlot = &pRead->blocks[(pRead->head + pRead->num) % SYNC_SNAPSHOT_READ_AHEAD];
+    pSlot->pBlock = pBlock;
+    pSlot->blockLen = blockLen;
+    pSlot->capacity = (pBlock == pOffered) ? TMAX(capacity, blockLen) : blockLen;
+    pRead->num++;
+    taosThreadCondSignal(&pRead->notEmpty);
+    taosThreadMutexUnlock(&pRead->mutex);
+  }
+
+  return NULL;
+}
+
+static int32_t snapshotReadAheadStart(SSyncSnapshotSender *pSender) {
+  SSyncSnapReadAhead *pRead = &pSender->readAhead;
+  pRead->stop = false;
+  pRead->end = false;
+  pRead->code = 0;
+  pRead->head = 0;
+  pRead->num = 0;
+
+  TdThreadAttr thAttr;
+  taosThreadAttrInit(&thAttr);
+  taosThreadAttrSetDetachState(&thAttr, PTHREAD_CREATE_JOINABLE);
+  if (taosThreadCreate(&pRead->thread, &thAttr, snapshotReadAheadFunc, pSender) != 0) {
+    terrno = TAOS_SYSTEM_ERROR(errno);
+    sSError(pSender, "snapshot sender create read-ahead thread failed since %s", terrstr());
+    taosThreadAttrDestroy(&thAttr);
+    return -1;
+  }
+  taosThreadAttrDestroy(&thAttr);
+
+  pRead->running = true;
+  return 0;
+}
+
+// stops the read-ahead thread before the reader is closed, and frees the blocks read but not sent and the released
+// buffers
+static void snapshotReadAheadStop(SSyncSnapshotSender *pSender) {
+  SSyncSnapReadAhead *pRead = &pSender->readAhead;
+  if (pRead->running) {
+    taosThreadMutexLock(&pRead->mutex);
+    pRead->stop = true;
+    taosThreadCondSignal(&pRead->notFull);
+    taosThreadMutexUnlock(&pRead->mutex);
+    taosThreadJoin(pRead->thread, NULL);
+    pRead->running = false;
+  }
+
+  for (int32_t i = 0; i < pRead->num; ++i) {
+    snapshotBlockRelease(&pRead->blocks[(pRead->head + i) % SYNC_SNAPSHOT_READ_AHEAD]);
+  }
+  for (int32_t i = 0; i < pRead->numOfFree; ++i) {
+    snapshotBlockRelease(&pRead->freeBlocks[i]);
+  }
+  pRead->head = 0;
+  pRead->num = 0;
+  pRead->numOfFree = 0;
+  pRead->end = false;
+  pRead->code = 0;
+}
+
+// takes the next block read ahead, waits for the read-ahead thread if it is behind, pBlock->pBlock is NULL at the end
+static int32_t snapshotReadAheadTake(SSyncSnapshotSender *pSender, SSyncSnapBlock *pBlock) {
+  SSyncSnapReadAhead *pRead = &pSender->readAhead;
+  int32_t             code = 0;
+
+  taosThreadMutexLock(&pRead->mutex);
+  while (pRead->running && pRead->num == 0 && !pRead->end) {
+    taosThreadCondWait(&pRead->notEmpty, &pRead->mutex);
+  }
+
+  if (pRead->num > 0) {
+    SSyncSnapBlock *pSlot = &pRead->blocks[pRead->head];
+    *pBlock = *pSlot;
+    pSlot->pBlock = NULL;
+    pSlot->blockLen = 0;
+    pSlot->capacity = 0;
+    pRead->head = (pRead->head + 1) % SYNC_SNAPSHOT_READ_AHEAD;
+    pRead->num--;
+    taosThreadCondSignal(&pRead->notFull);
+  } else {
+    pBlock->pBlock = NULL;
+    pBlock->blockLen = 0;
+    pBlock->capacity = 0;
+    code = pRead->end ? pRead->code : TSDB_CODE_SYN_INTERNAL_ERROR;
+  }
+  taosThreadMutexUnlock(&pRead->mutex);
+
+  if (code != 0) {
+    terrno = code;
+    return -1;
+  }
+  return 0;
+}
+
+// keeps the buffer of an acked block for the next reads instead of freeing it
+static void snapshotReadAheadRecycle(SSyncSnapshotSender *pSender, SSyncSnapBlock *pBlock) {
+  SSyncSnapReadAhead *pRead = &pSender->readAhead;
+
+  taosThreadMutexLock(&pRead->mutex);
+  if (pBlock->pBlock != NULL && pRead->numOfFree < SYNC_SNAPSHOT_WINDOW_SIZE) {
+    SSyncSnapBlock *pFree = &pRead->freeBlocks[pRead->numOfFree++];
+    pFree->pBlock = pBlock->pBlock;
+    pFree->capacity = pBlock->capacity;
+    pBlock->pBlock = NULL;
+  }
+  taosThreadMutexUnlock(&pRead->mutex);
+
+  snapshotBlockRelease(pBlock);
+}
+
 SSyncSnapshotSender *snapshotSenderCreate(SSyncNode *pSyncNode, int32_t replicaIndex) {
   bool condition = (pSyncNode->pFsm->FpSnapshotStartRead != NULL) && (pSyncNode->pFsm->FpSnapshotStopRead != NULL) &&
                    (pSyncNode->pFsm->FpSnapshotDoRead != NULL);
@@ -37,9 +225,16 @@ SSyncSnapshotSender *snapshotSenderCreate(SSyncNode *pSyncNode, int32_t replicaI
   pSender->start = false;
   pSender->seq = SYNC_SNAPSHOT_SEQ_INVALID;
   pSender->ack = SYNC_SNAPSHOT_SEQ_INVALID;
+  pSender->windowSize = 1;
+  pSender->dupAcks = 0;
   pSender->pReader = NULL;
-  pSender->pCurrentBlock = NULL;
-  pSender->blockLen = 0;
+  pSender->readEnd = false;
+  snapshotBlockInit(pSender->window);
+  snapshotBlockInit(pSender->readAhead.blocks);
+  snapshotBlockInit(pSender->readAhead.freeBlocks);
+  taosThreadMutexInit(&pSender->readAhead.mutex, NULL);
+  taosThreadCondInit(&pSender->readAhead.notEmpty, NULL);
+  taosThreadCondInit(&pSender->readAhead.notFull, NULL);
   pSender->sendingMS = SYNC_SNAPSHOT_RETRY_MS;
   pSender->pSyncNode = pSyncNode;
   pSender->replicaIndex = replicaIndex;
@@ -55,18 +250,20 @@ SSyncSnapshotSender *snapshotSenderCreate(SSyncNode *pSyncNode, int32_t replicaI
 void snapshotSenderDestroy(SSyncSnapshotSender *pSender) {
   if (pSender == NULL) return;
 
-  // free current block
-  if (pSender->pCurrentBlock != NULL) {
-    taosMemoryFree(pSender->pCurrentBlock);
-    pSender->pCurrentBlock = NULL;
-  }
+  // free blocks in flight
+  snapshotBlockClear(pSender->window);
 
-  // close reader
+  // stop reading ahead, then close reader
+  snapshotReadAheadStop(pSender);
   if (pSender->pReader != NULL) {
     pSender->pSyncNode->pFsm->FpSnapshotStopRead(pSender->pSyncNode->pFsm, pSender->pReader);
     pSender->pReader = NULL;
   }
 
+  taosThreadMutexDestroy(&pSender->readAhead.mutex);
+  taosThreadCondDestroy(&pSender->readAhead.notEmpty);
+  taosThreadCondDestroy(&pSender->readAhead.notFull);
+
   // free sender
   taosMemoryFree(pSender);
 }
@@ -77,9 +274,11 @@ int32_t snapshotSenderStart(SSyncSnapshotSender *pSender) {
   pSender->start = true;
   pSender->seq = SYNC_SNAPSHOT_SEQ_BEGIN;
   pSender->ack = SYNC_SNAPSHOT_SEQ_INVALID;
+  pSender->windowSize = 1;
+  pSender->dupAcks = 0;
   pSender->pReader = NULL;
-  pSender->pCurrentBlock = NULL;
-  pSender->blockLen = 0;
+  pSender->readEnd = false;
+  snapshotBlockClear(pSender->window);
   pSender->snapshotParam.start = SYNC_INDEX_INVALID;
   pSender->snapshotParam.end = SYNC_INDEX_INVALID;
   pSender->snapshot.data = NULL;
@@ -134,52 +333,23 @@ void snapshotSenderStop(SSyncSnapshotSender *pSender, bool finish) {
   pSender->finish = finish;
   pSender->endTime = taosGetTimestampMs();
 
-  // close reader
+  // stop reading ahead, then close reader
+  snapshotReadAheadStop(pSender);
   if (pSender->pReader != NULL) {
     pSender->pSyncNode->pFsm->FpSnapshotStopRead(pSender->pSyncNode->pFsm, pSender->pReader);
     pSender->pReader = NULL;
   }
 
-  // free current block
-  if (pSender->pCurrentBlock != NULL) {
-    taosMemoryFree(pSender->pCurrentBlock);
-    pSender->pCurrentBlock = NULL;
-    pSender->blockLen = 0;
-  }
+  // free blocks in flight
+  snapshotBlockClear(pSender->window);
+  pSender->readEnd = false;
 }
 
-// when sender receive ack, call this function to send msg from seq
-// seq = ack + 1, already updated
-static int32_t snapshotSend(SSyncSnapshotSender *pSender) {
-  // free memory last time (current seq - 1)
-  if (pSender->pCurrentBlock != NULL) {
-    taosMemoryFree(pSender->pCurrentBlock);
-    pSender->pCurrentBlock = NULL;
-    pSender->blockLen = 0;
-  }
-
-  // read data
-  int32_t ret = pSender->pSyncNode->pFsm->FpSnapshotDoRead(pSender->pSyncNode->pFsm, pSender->pReader,
-                                                           &pSender->pCurrentBlock, &pSender->blockLen);
-  if (ret != 0) {
-    sSError(pSender, "snapshot sender read failed since %s", terrstr());
-    return -1;
-  }
-
-  if (pSender->blockLen > 0) {
-    // has read data
-    sSDebug(pSender, "vgId:%d, snapshot sender continue to read, blockLen:%d seq:%d", pSender->pSyncNode->vgId,
-            pSender->blockLen, pSender->seq);
-  } else {
-    // read finish, update seq to end
-    pSender->seq = SYNC_SNAPSHOT_SEQ_END;
-    sSInfo(pSender, "vgId:%d, snapshot sender read to the end, blockLen:%d seq:%d", pSender->pSyncNode->vgId,
-           pSender->blockLen, pSender->seq);
-  }
-
+static int32_t snapshotSendBlock(SSyncSnapshotSender *pSender, int32_t seq, const void *pBlock, int32_t blockLen,
+                                 const char *event) {
   // build msg
   SRpcMsg rpcMsg = {0};
-  if (syncBuildSnapshotSend(&rpcMsg, pSender->blockLen, pSender->pSyncNode->vgId) != 0) {
+  if (syncBuildSnapshotSend(&rpcMsg, blockLen, pSender->pSyncNode->vgId) != 0) {
     sSError(pSender, "vgId:%d, snapshot sender build msg failed since %s", pSender->pSyncNode->vgId, terrstr());
     return -1;
   }
@@ -193,18 +363,15 @@ static int32_t snapshotSend(SSyncSnapshotSender *pSender) {
   pMsg->lastTerm = pSender->snapshot.lastApplyTerm;
   pMsg->lastConfigIndex = pSender->snapshot.lastConfigIndex;
   pMsg->lastConfig = pSender->lastConfig;
-  pMsg->seq = pSender->seq;
+  pMsg->startTime = pSender->startTime;
+  pMsg->seq = seq;
 
-  if (pSender->pCurrentBlock != NULL) {
-    memcpy(pMsg->data, pSender->pCurrentBlock, pSender->blockLen);
+  if (pBlock != NULL && blockLen > 0) {
+    memcpy(pMsg->data, pBlock, blockLen);
   }
 
   // event log
-  if (pSender->seq == SYNC_SNAPSHOT_SEQ_END) {
-    syncLogSendSyncSnapshotSend(pSender->pSyncNode, pMsg, "snapshot sender finish");
-  } else {
-    syncLogSendSyncSnapshotSend(pSender->pSyncNode, pMsg, "snapshot sender sending");
-  }
+  syncLogSendSyncSnapshotSend(pSender->pSyncNode, pMsg, event);
 
   // send msg
   if (syncNodeSendMsgById(&pMsg->destId, pSender->pSyncNode, &rpcMsg) != 0) {
@@ -216,54 +383,120 @@ static int32_t snapshotSend(SSyncSnapshotSender *pSender) {
   return 0;
 }
 
-// send snapshot data from cache
+// when sender receive ack, call this function to fill the window:
+// blocks read ahead by the read-ahead thread are sent until windowSize blocks are in flight,
+// the end msg is sent once the reader is exhausted and all the data blocks are acked
+static int32_t snapshotSend(SSyncSnapshotSender *pSender) {
+  if (pSender->seq == SYNC_SNAPSHOT_SEQ_END) {
+    return 0;
+  }
+
+  while (!pSender->readEnd && pSender->seq - pSender->ack < pSender->windowSize) {
+    // take the data read ahead
+    SSyncSnapBlock block = {0};
+    if (snapshotReadAheadTake(pSender, &block) != 0) {
+      sSError(pSender, "snapshot sender read failed since %s", terrstr());
+      return -1;
+    }
+
+    void   *pBlock = block.pBlock;
+    int32_t blockLen = block.blockLen;
+    if (pBlock == NULL) {
+      pSender->readEnd = true;
+      sSInfo(pSender, "vgId:%d, snapshot sender read to the end, seq:%d ack:%d", pSender->pSyncNode->vgId,
+             pSender->seq, pSender->ack);
+      break;
+    }
+
+    int32_t         seq = pSender->seq + 1;
+    SSyncSnapBlock *pSlot = snapshotBlockGet(pSender->window, seq);
+    ASSERT(pSlot->pBlock == NULL);
+    pSlot->seq = seq;
+    pSlot->pBlock = pBlock;
+    pSlot->blockLen = blockLen;
+    pSlot->capacity = block.capacity;
+    pSender->seq = seq;
+
+    sSDebug(pSender, "vgId:%d, snapshot sender continue to read, blockLen:%d seq:%d ack:%d", pSender->pSyncNode->vgId,
+            blockLen, seq, pSender->ack);
+
+    if (snapshotSendBlock(pSender, seq, pBlock, blockLen, "snapshot sender sending") != 0) {
+      return -1;
+    }
+    pSlot->sendTime = pSender->lastSendTime;
+  }
+
+  if (pSender->readEnd && pSender->ack == pSender->seq) {
+    // all data acked, update seq to end
+    pSender->seq = SYNC_SNAPSHOT_SEQ_END;
+    return snapshotSendBlock(pSender, SYNC_SNAPSHOT_SEQ_END, NULL, 0, "snapshot sender finish");
+  }
+
+  return 0;
+}
+
+// resend what is not acked yet, only the blocks sent before the resend interval
 int32_t snapshotReSend(SSyncSnapshotSender *pSender) {
-  // build msg
-  SRpcMsg rpcMsg = {0};
-  if (syncBuildSnapshotSend(&rpcMsg, pSender->blockLen, pSender->pSyncNode->vgId) != 0) {
-    sSError(pSender, "snapshot sender build msg failed since %s", terrstr());
-    return -1;
+  if (pSender->seq == SYNC_SNAPSHOT_SEQ_BEGIN || pSender->seq == SYNC_SNAPSHOT_SEQ_END) {
+    return snapshotSendBlock(pSender, pSender->seq, NULL, 0, "snapshot sender resend");
   }
 
-  SyncSnapshotSend *pMsg = rpcMsg.pCont;
-  pMsg->srcId = pSender->pSyncNode->myRaftId;
-  pMsg->destId = pSender->pSyncNode->replicasId[pSender->replicaIndex];
-  pMsg->term = raftStoreGetTerm(pSender->pSyncNode);
-  pMsg->beginIndex = pSender->snapshotParam.start;
-  pMsg->lastIndex = pSender->snapshot.lastApplyIndex;
-  pMsg->lastTerm = pSender->snapshot.lastApplyTerm;
-  pMsg->lastConfigIndex = pSender->snapshot.lastConfigIndex;
-  pMsg->lastConfig = pSender->lastConfig;
-  pMsg->seq = pSender->seq;
+  int64_t now = taosGetTimestampMs();
+  for (int32_t seq = pSender->ack + 1; seq <= pSender->seq; ++seq) {
+    SSyncSnapBlock *pSlot = snapshotBlockGet(pSender->window, seq);
+    if (pSlot->seq != seq || now - pSlot->sendTime < SYNC_SNAP_RESEND_MS) {
+      continue;
+    }
 
-  if (pSender->pCurrentBlock != NULL && pSender->blockLen > 0) {
-    memcpy(pMsg->data, pSender->pCurrentBlock, pSender->blockLen);
+    if (snapshotSendBlock(pSender, seq, pSlot->pBlock, pSlot->blockLen, "snapshot sender resend") != 0) {
+      return -1;
+    }
+    pSlot->sendTime = pSender->lastSendTime;
   }
 
-  // event log
-  syncLogSendSyncSnapshotSend(pSender->pSyncNode, pMsg, "snapshot sender resend");
+  return 0;
+}
 
-  // send msg
-  if (syncNodeSendMsgById(&pMsg->destId, pSender->pSyncNode, &rpcMsg) != 0) {
-    sSError(pSender, "snapshot sender resend msg failed since %s", terrstr());
-    return -1;
+// the receiver acks each block kept ahead of a gap with the same ack, so duplicated acks mean block ack + 1 is lost,
+// resend it once per ack instead of waiting for the resend timer
+static int32_t snapshotFastReSend(SSyncSnapshotSender *pSender) {
+  if (++pSender->dupAcks != SYNC_SNAPSHOT_DUP_ACKS || pSender->ack >= pSender->seq) {
+    return 0;
   }
 
-  pSender->lastSendTime = taosGetTimestampMs();
+  int32_t         seq = pSender->ack + 1;
+  SSyncSnapBlock *pSlot = snapshotBlockGet(pSender->window, seq);
+  if (pSlot->seq != seq) {
+    return 0;
+  }
+
+  sSDebug(pSender, "snapshot sender fast resend, dupAcks:%d seq:%d", pSender->dupAcks, seq);
+  if (snapshotSendBlock(pSender, seq, pSlot->pBlock, pSlot->blockLen, "snapshot sender fast resend") != 0) {
+    return -1;
+  }
+  pSlot->sendTime = pSender->lastSendTime;
   return 0;
 }
 
+// acks are cumulative, release all the blocks up to ack, and keep their buffers for the next reads
 static int32_t snapshotSenderUpdateProgress(SSyncSnapshotSender *pSender, SyncSnapshotRsp *pMsg) {
-  if (pMsg->ack != pSender->seq) {
-    sSError(pSender, "snapshot sender update seq failed, ack:%d seq:%d", pMsg->ack, pSender->seq);
+  if (pMsg->ack < pSender->ack || pMsg->ack > pSender->seq) {
+    sSError(pSender, "snapshot sender update seq failed, ack:%d my ack:%d seq:%d", pMsg->ack, pSender->ack,
+            pSender->seq);
     terrno = TSDB_CODE_SYN_INTERNAL_ERROR;
     return -1;
   }
 
+  for (int32_t seq = TMAX(pSender->ack + 1, SYNC_SNAPSHOT_SEQ_BEGIN + 1); seq <= pMsg->ack; ++seq) {
+    SSyncSnapBlock *pSlot = snapshotBlockGet(pSender->window, seq);
+    if (pSlot->seq == seq) {
+      snapshotReadAheadRecycle(pSender, pSlot);
+    }
+  }
   pSender->ack = pMsg->ack;
-  pSender->seq++;
+  pSender->dupAcks = 0;
 
-  sSDebug(pSender, "snapshot sender update seq:%d", pSender->seq);
+  sSDebug(pSender, "snapshot sender update ack:%d seq:%d", pSender->ack, pSender->seq);
   return 0;
 }
 
@@ -321,6 +554,7 @@ SSyncSnapshotReceiver *snapshotReceiverCreate(SSyncNode *pSyncNode, SRaftId from
   pReceiver->snapshot.lastApplyIndex = SYNC_INDEX_INVALID;
   pReceiver->snapshot.lastApplyTerm = 0;
   pReceiver->snapshot.lastConfigIndex = SYNC_INDEX_INVALID;
+  snapshotBlockInit(pReceiver->window);
 
   return pReceiver;
 }
@@ -338,6 +572,9 @@ void snapshotReceiverDestroy(SSyncSnapshotReceiver *pReceiver) {
     pReceiver->pWriter = NULL;
   }
 
+  // free buffered blocks
+  snapshotBlockClear(pReceiver->window);
+
   // free receiver
   taosMemoryFree(pReceiver);
 }
@@ -355,6 +592,9 @@ static int32_t snapshotReceiverStartWriter(SSyncSnapshotReceiver *pReceiver, Syn
 
   // update ack
   pReceiver->ack = SYNC_SNAPSHOT_SEQ_BEGIN;
+  for (int32_t i = 0; i < SYNC_SNAPSHOT_WINDOW_SIZE; ++i) {
+    pReceiver->window[i].seq = SYNC_SNAPSHOT_SEQ_INVALID;
+  }
 
   // update snapshot
   pReceiver->snapshot.lastApplyIndex = pBeginMsg->lastIndex;
@@ -408,6 +648,7 @@ void snapshotReceiverStop(SSyncSnapshotReceiver *pReceiver) {
     sRInfo(pReceiver, "snapshot receiver stop, writer is null");
   }
 
+  snapshotBlockClear(pReceiver->window);
   pReceiver->start = false;
 }
 
@@ -468,10 +709,34 @@ static int32_t snapshotReceiverFinish(SSyncSnapshotReceiver *pReceiver, SyncSnap
   return 0;
 }
 
-// apply data block
+static int32_t snapshotReceiverWriteBlock(SSyncSnapshotReceiver *pReceiver, void *pBlock, int32_t blockLen,
+                                           int32_t seq) {
+  sRDebug(pReceiver, "snapshot receiver continue to write, blockLen:%d seq:%d", blockLen, seq);
+
+  if (blockLen > 0) {
+    // apply data block
+    int32_t code =
+        pReceiver->pSyncNode->pFsm->FpSnapshotDoWrite(pReceiver->pSyncNode->pFsm, pReceiver->pWriter, pBlock, blockLen);
+    if (code != 0) {
+      sRError(pReceiver, "snapshot receiver continue write failed since %s", terrstr());
+      return -1;
+    }
+  }
+
+  // update progress
+  pReceiver->ack = seq;
+  return 0;
+}
+
+// apply data block, blocks arrived out of order are kept in the window until the gap is filled
 // update progress
 static int32_t snapshotReceiverGotData(SSyncSnapshotReceiver *pReceiver, SyncSnapshotSend *pMsg) {
-  if (pMsg->seq != pReceiver->ack + 1) {
+  if (pMsg->seq <= pReceiver->ack) {
+    sRDebug(pReceiver, "snapshot receiver ignore duplicated seq:%d, ack:%d", pMsg->seq, pReceiver->ack);
+    return 0;
+  }
+
+  if (pMsg->seq > pReceiver->ack + SYNC_SNAPSHOT_WINDOW_SIZE) {
     sRError(pReceiver, "snapshot receiver invalid seq, ack:%d seq:%d", pReceiver->ack, pMsg->seq);
     terrno = TSDB_CODE_SYN_INVALID_SNAPSHOT_MSG;
     return -1;
@@ -483,23 +748,48 @@ static int32_t snapshotReceiverGotData(SSyncSnapshotReceiver *pReceiver, SyncSna
     return -1;
   }
 
-  sRDebug(pReceiver, "snapshot receiver continue to write, blockLen:%d seq:%d", pMsg->dataLen, pMsg->seq);
+  if (pMsg->seq > pReceiver->ack + 1) {
+    SSyncSnapBlock *pSlot = snapshotBlockGet(pReceiver->window, pMsg->seq);
+    if (pSlot->capacity < pMsg->dataLen) {
+      void *pBlock = taosMemoryRealloc(pSlot->pBlock, pMsg->dataLen);
+      if (pBlock == NULL) {
+        terrno = TSDB_CODE_OUT_OF_MEMORY;
+        return -1;
+      }
+      pSlot->pBlock = pBlock;
+      pSlot->capacity = pMsg->dataLen;
+    }
 
-  if (pMsg->dataLen > 0) {
-    // apply data block
-    int32_t code = pReceiver->pSyncNode->pFsm->FpSnapshotDoWrite(pReceiver->pSyncNode->pFsm, pReceiver->pWriter,
-                                                                 pMsg->data, pMsg->dataLen);
-    if (code != 0) {
-      sRError(pReceiver, "snapshot receiver continue write failed since %s", terrstr());
-      return -1;
+    if (pMsg->dataLen > 0) {
+      memcpy(pSlot->pBlock, pMsg->data, pMsg->dataLen);
     }
+    pSlot->blockLen = pMsg->dataLen;
+    pSlot->seq = pMsg->seq;
+
+    sRDebug(pReceiver, "snapshot receiver keep block ahead of ack, blockLen:%d seq:%d ack:%d", pMsg->dataLen,
+            pMsg->seq, pReceiver->ack);
+    return 0;
   }
 
-  // update progress
-  pReceiver->ack = pMsg->seq;
+  if (snapshotReceiverWriteBlock(pReceiver, pMsg->data, pMsg->dataLen, pMsg->seq) != 0) {
+    return -1;
+  }
+
+  // apply the kept blocks following the new ack, the buffers are kept for reuse
+  while (true) {
+    SSyncSnapBlock *pSlot = snapshotBlockGet(pReceiver->window, pReceiver->ack + 1);
+    if (pSlot->seq != pReceiver->ack + 1) {
+      break;
+    }
+
+    pSlot->seq = SYNC_SNAPSHOT_SEQ_INVALID;
+    if (snapshotReceiverWriteBlock(pReceiver, pSlot->pBlock, pSlot->blockLen, pReceiver->ack + 1) != 0) {
+      return -1;
+    }
+  }
 
   // event log
-  sRDebug(pReceiver, "snapshot receiver continue to write finish");
+  sRDebug(pReceiver, "snapshot receiver continue to write finish, ack:%d", pReceiver->ack);
   return 0;
 }
 
@@ -594,6 +884,7 @@ _SEND_REPLY:
   pRspMsg->ack = pMsg->seq;  // receiver maybe already closed
   pRspMsg->code = code;
   pRspMsg->snapBeginIndex = syncNodeGetSnapBeginIndex(pSyncNode);
+  pRspMsg->windowSize = SYNC_SNAPSHOT_WINDOW_SIZE;
 
   // send msg
   syncLogSendSyncSnapshotRsp(pSyncNode, pRspMsg, "snapshot receiver pre-snapshot");
@@ -869,19 +1160,29 @@ static int32_t syncNodeOnSnapshotPrepRsp(SSyncNode *pSyncNode, SSyncSnapshotSend
   // update sender
   pSender->snapshot = snapshot;
 
-  // start reader
+  // start reader, the reads of a former pre-snapshot rsp are stopped first
+  snapshotReadAheadStop(pSender);
   int32_t code = pSyncNode->pFsm->FpSnapshotStartRead(pSyncNode->pFsm, &pSender->snapshotParam, &pSender->pReader);
   if (code != 0) {
     sSError(pSender, "prepare snapshot failed since %s", terrstr());
     return -1;
   }
 
+  // read the first blocks while the begin msg is on the way
+  if (snapshotReadAheadStart(pSender) != 0) {
+    return -1;
+  }
+
   // update next index
   syncIndexMgrSetIndex(pSyncNode->pNextIndex, &pMsg->srcId, snapshot.lastApplyIndex + 1);
 
   // update seq
   pSender->seq = SYNC_SNAPSHOT_SEQ_BEGIN;
 
+  // receivers without a window reject any block but ack + 1, so they get one block at a time
+  pSender->windowSize = TMAX(1, TMIN(pMsg->windowSize, SYNC_SNAPSHOT_WINDOW_SIZE));
+  sSInfo(pSender, "prepare snapshot, window size:%d, receiver window size:%d", pSender->windowSize, pMsg->windowSize);
+
   // build begin msg
   SRpcMsg rpcMsg = {0};
   if (syncBuildSnapshotSend(&rpcMsg, 0, pSender->pSyncNode->vgId) != 0) {
@@ -914,7 +1215,7 @@ static int32_t syncNodeOnSnapshotPrepRsp(SSyncNode *pSyncNode, SSyncSnapshotSend
 // sender on message
 //
 // condition 1 sender receives SYNC_SNAPSHOT_SEQ_END, close sender
-// condition 2 sender receives ack, set seq = ack + 1, send msg from seq
+// condition 2 sender receives ack, release blocks up to ack, read and send ahead until the window is full
 // condition 3 sender receives error msg, just print error log
 //
 int32_t syncNodeOnSnapshotRsp(SSyncNode *pSyncNode, const SRpcMsg *pRpcMsg) {
@@ -981,18 +1282,6 @@ int32_t syncNodeOnSnapshotRsp(SSyncNode *pSyncNode, const SRpcMsg *pRpcMsg) {
     goto _ERROR;
   }
 
-  if (pMsg->ack == SYNC_SNAPSHOT_SEQ_BEGIN) {
-    syncLogRecvSyncSnapshotRsp(pSyncNode, pMsg, "process seq begin");
-    if (snapshotSenderUpdateProgress(pSender, pMsg) != 0) {
-      return -1;
-    }
-
-    if (snapshotSend(pSender) != 0) {
-      return -1;
-    }
-    return 0;
-  }
-
   // receive ack is finish, close sender
   if (pMsg->ack == SYNC_SNAPSHOT_SEQ_END) {
     syncLogRecvSyncSnapshotRsp(pSyncNode, pMsg, "process seq end");
@@ -1001,9 +1290,16 @@ int32_t syncNodeOnSnapshotRsp(SSyncNode *pSyncNode, const SRpcMsg *pRpcMsg) {
     return 0;
   }
 
-  // send next msg
-  if (pMsg->ack == pSender->seq) {
-    syncLogRecvSyncSnapshotRsp(pSyncNode, pMsg, "process seq data");
+  // ack of begin or data msg, release acked blocks and fill the window
+  if (pMsg->ack >= pSender->ack && pMsg->ack <= pSender->seq) {
+    if (pMsg->ack == pSender->ack) {
+      // duplicated ack, the first not acked block is lost or late
+      syncLogRecvSyncSnapshotRsp(pSyncNode, pMsg, "process duplicated ack");
+      return snapshotFastReSend(pSender);
+    }
+
+    syncLogRecvSyncSnapshotRsp(pSyncNode, pMsg,
+                               pMsg->ack == SYNC_SNAPSHOT_SEQ_BEGIN ? "process seq begin" : "process seq data");
     // update sender ack
     if (snapshotSenderUpdateProgress(pSender, pMsg) != 0) {
       return -1;
@@ -1011,16 +1307,10 @@ int32_t syncNodeOnSnapshotRsp(SSyncNode *pSyncNode, const SRpcMsg *pRpcMsg) {
     if (snapshotSend(pSender) != 0) {
       return -1;
     }
-  } else if (pMsg->ack == pSender->seq - 1) {
-    // maybe resend
-    syncLogRecvSyncSnapshotRsp(pSyncNode, pMsg, "process seq and resend");
-    if (snapshotReSend(pSender) != 0) {
-      return -1;
-    }
   } else {
     // error log
     syncLogRecvSyncSnapshotRsp(pSyncNode, pMsg, "receive error ack");
-    sSError(pSender, "snapshot sender receive error ack:%d, my seq:%d", pMsg->ack, pSender->seq);
+    sSError(pSender, "snapshot sender receive error ack:%d, my ack:%d seq:%d", pMsg->ack, pSender->ack, pSender->seq);
     snapshotSenderStop(pSender, true);
     syncNodeReplicateReset(pSyncNode, &pMsg->srcId);
     return -1;
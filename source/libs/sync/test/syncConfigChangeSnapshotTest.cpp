@@ -90,6 +90,7 @@ int32_t SnapshotStopRead(struct SSyncFSM* pFsm, void* pReader) {
 
 int32_t SnapshotDoRead(struct SSyncFSM* pFsm, void* pReader, void** ppBuf, int32_t* len) {
   static int readIter = 0;
+  taosMemoryFreeClear(*ppBuf);
 
   if (readIter == 5) {
     *len = 0;
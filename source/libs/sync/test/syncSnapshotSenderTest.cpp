@@ -44,9 +44,10 @@ SSyncSnapshotSender* createSender() {
   pSender->seq = 10;
   pSender->ack = 20;
   pSender->pReader = (void*)0x11;
-  pSender->blockLen = 20;
-  pSender->pCurrentBlock = taosMemoryMalloc(pSender->blockLen);
-  snprintf((char*)(pSender->pCurrentBlock), pSender->blockLen, "%s", "hello");
+  pSender->window[1].seq = 1;
+  pSender->window[1].blockLen = 20;
+  pSender->window[1].pBlock = taosMemoryMalloc(pSender->window[1].blockLen);
+  snprintf((char*)(pSender->window[1].pBlock), pSender->window[1].blockLen, "%s", "hello");
 
   pSender->snapshot.lastApplyIndex = 99;
   pSender->snapshot.lastApplyTerm = 88;
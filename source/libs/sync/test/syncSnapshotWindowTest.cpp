@@ -0,0 +1,491 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "syncIndexMgr.h"
+#include "syncMessage.h"
+#include "syncPipeline.h"
+#include "syncSnapshot.h"
+
+namespace {
+
+// mnode, so the receiver takes the begin index without a wal
+const int32_t kVgId = 1;
+const int32_t kNumOfBlocks = 20;
+
+struct SSnapMsg {
+  int32_t     seq;
+  std::string data;
+};
+
+// the blocks read by the sender, the msgs sent, the acks replied and the blocks written by the receiver,
+// the reads are done by the read-ahead thread of the sender
+struct SSnapEnv {
+  int32_t               numOfRead = 0;
+  int32_t               numOfReuse = 0;  // reads into a buffer released by an acked block
+  int32_t               failAt = 0;      // the read of this block fails
+  std::vector<SSnapMsg> sent;
+  std::vector<int32_t>  acks;
+  std::vector<SSnapMsg> written;
+};
+
+SSnapEnv gEnv;
+
+// all the blocks have the same length, so a kept buffer fits any later block
+std::string blockData(int32_t i) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "snapshot block %04d", i);
+  return buf;
+}
+
+int32_t snapSendMsg(const SEpSet* pEpSet, SRpcMsg* pMsg) {
+  if (pMsg->msgType == TDMT_SYNC_SNAPSHOT_SEND) {
+    SyncSnapshotSend* pSend = (SyncSnapshotSend*)pMsg->pCont;
+    gEnv.sent.push_back({pSend->seq, std::string(pSend->data, pSend->dataLen)});
+  } else if (pMsg->msgType == TDMT_SYNC_SNAPSHOT_RSP) {
+    SyncSnapshotRsp* pRsp = (SyncSnapshotRsp*)pMsg->pCont;
+    gEnv.acks.push_back(pRsp->ack);
+  }
+  rpcFreeCont(pMsg->pCont);
+  return 0;
+}
+
+void snapGetSnapshotInfo(const SSyncFSM* pFsm, SSnapshot* pSnapshot) {
+  pSnapshot->lastApplyIndex = 100;
+  pSnapshot->lastApplyTerm = 1;
+  pSnapshot->lastConfigIndex = SYNC_INDEX_INVALID;
+}
+
+int32_t snapStartRead(const SSyncFSM* pFsm, void* pParam, void** ppReader) {
+  *ppReader = (void*)0x1;
+  return 0;
+}
+
+void snapStopRead(const SSyncFSM* pFsm, void* pReader) {}
+
+int32_t snapDoRead(const SSyncFSM* pFsm, void* pReader, void** ppBuf, int32_t* len) {
+  void*   pBuf = *ppBuf;
+  int32_t capacity = *len;
+  *ppBuf = NULL;
+  *len = 0;
+  if (gEnv.numOfRead + 1 == gEnv.failAt) {
+    taosMemoryFree(pBuf);
+    terrno = TSDB_CODE_OUT_OF_MEMORY;
+    return -1;
+  }
+
+  if (gEnv.numOfRead < kNumOfBlocks) {
+    std::string data = blockData(++gEnv.numOfRead);
+    if (pBuf != NULL && capacity >= (int32_t)data.size()) {
+      gEnv.numOfReuse++;
+    } else {
+      taosMemoryFree(pBuf);
+      pBuf = taosMemoryMalloc(data.size());
+    }
+    memcpy(pBuf, data.data(), data.size());
+    *ppBuf = pBuf;
+    *len = data.size();
+  } else {
+    taosMemoryFree(pBuf);
+  }
+  return 0;
+}
+
+int32_t snapStartWrite(const SSyncFSM* pFsm, void* pParam, void** ppWriter) {
+  *ppWriter = (void*)0x1;
+  return 0;
+}
+
+int32_t snapStopWrite(const SSyncFSM* pFsm, void* pWriter, bool isApply, SSnapshot* pSnapshot) { return 0; }
+
+int32_t snapDoWrite(const SSyncFSM* pFsm, void* pWriter, void* pBuf, int32_t len) {
+  gEnv.written.push_back({0, std::string((char*)pBuf, len)});
+  return 0;
+}
+
+// the leader runs the sender and the follower runs the receiver, the msgs between them go through the handlers
+class SyncSnapshotWindowTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    sDebugFlag = 0;
+    gEnv = SSnapEnv();
+
+    pFsm = (SSyncFSM*)taosMemoryCalloc(1, sizeof(SSyncFSM));
+    pFsm->FpGetSnapshotInfo = snapGetSnapshotInfo;
+    pFsm->FpSnapshotStartRead = snapStartRead;
+    pFsm->FpSnapshotStopRead = snapStopRead;
+    pFsm->FpSnapshotDoRead = snapDoRead;
+    pFsm->FpSnapshotStartWrite = snapStartWrite;
+    pFsm->FpSnapshotStopWrite = snapStopWrite;
+    pFsm->FpSnapshotDoWrite = snapDoWrite;
+
+    SRaftId leaderId = {1, kVgId};
+    SRaftId followerId = {2, kVgId};
+    pLeader = createNode(leaderId, followerId, TAOS_SYNC_STATE_LEADER);
+    pFollower = createNode(followerId, leaderId, TAOS_SYNC_STATE_FOLLOWER);
+
+    pLeader->pLogBuf = syncLogBufferCreate();
+    ASSERT_NE(pLeader->pLogBuf, nullptr);
+    pLeader->pNextIndex = syncIndexMgrCreate(pLeader);
+    ASSERT_NE(pLeader->pNextIndex, nullptr);
+
+    pSender = snapshotSenderCreate(pLeader, 0);
+    ASSERT_NE(pSender, nullptr);
+    pLeader->senders[0] = pSender;
+    pReceiver = snapshotReceiverCreate(pFollower, leaderId);
+    ASSERT_NE(pReceiver, nullptr);
+    pFollower->pNewNodeReceiver = pReceiver;
+  }
+
+  void TearDown() override {
+    snapshotSenderDestroy(pSender);
+    snapshotReceiverDestroy(pReceiver);
+    syncLogBufferDestroy(pLeader->pLogBuf);
+    syncIndexMgrDestroy(pLeader->pNextIndex);
+    taosMemoryFree(pLeader);
+    taosMemoryFree(pFollower);
+    taosMemoryFree(pFsm);
+  }
+
+  SSyncNode* createNode(SRaftId myId, SRaftId peerId, ESyncState state) {
+    SSyncNode* pNode = (SSyncNode*)taosMemoryCalloc(1, sizeof(SSyncNode));
+    pNode->vgId = kVgId;
+    pNode->pFsm = pFsm;
+    pNode->state = state;
+    pNode->electBaseLine = 1000;
+    pNode->myRaftId = myId;
+    pNode->peersNum = 1;
+    pNode->peersId[0] = peerId;
+    pNode->replicaNum = 1;
+    pNode->totalReplicaNum = 1;
+    pNode->replicasId[0] = peerId;
+    pNode->syncSendMSg = snapSendMsg;
+    return pNode;
+  }
+
+  // the receiver replies the pre-snapshot msg with its window size and acks the begin msg, the window is filled
+  // before the first ack of a data block
+  void startSender(int16_t windowSize = SYNC_SNAPSHOT_WINDOW_SIZE) {
+    ASSERT_EQ(snapshotSenderStart(pSender), 0);
+    ASSERT_EQ(sentSeqs(), std::vector<int32_t>({SYNC_SNAPSHOT_SEQ_PREP_SNAPSHOT}));
+
+    gEnv.sent.clear();
+    ASSERT_EQ(ack(SYNC_SNAPSHOT_SEQ_PREP_SNAPSHOT, windowSize), 0);
+    ASSERT_EQ(sentSeqs(), std::vector<int32_t>({SYNC_SNAPSHOT_SEQ_BEGIN}));
+
+    gEnv.sent.clear();
+    ASSERT_EQ(ack(SYNC_SNAPSHOT_SEQ_BEGIN), 0);
+  }
+
+  int32_t ack(int32_t seq, int16_t windowSize = SYNC_SNAPSHOT_WINDOW_SIZE) {
+    SRpcMsg rpcMsg = {0};
+    if (syncBuildSnapshotSendRsp(&rpcMsg, kVgId) != 0) {
+      return -1;
+    }
+    SyncSnapshotRsp* pRsp = (SyncSnapshotRsp*)rpcMsg.pCont;
+    pRsp->srcId = pFollower->myRaftId;
+    pRsp->destId = pLeader->myRaftId;
+    pRsp->startTime = pSender->startTime;
+    pRsp->ack = seq;
+    pRsp->windowSize = windowSize;
+    int32_t code = syncNodeOnSnapshotRsp(pLeader, &rpcMsg);
+    rpcFreeCont(rpcMsg.pCont);
+    return code;
+  }
+
+  // the receiver gets the pre-snapshot and the begin msg of the sender, or of a sender not started in the test
+  void startReceiver() {
+    startTime = pSender->start ? pSender->startTime : taosGetTimestampMs();
+    ASSERT_EQ(receive(SYNC_SNAPSHOT_SEQ_PREP_SNAPSHOT, ""), 0);
+    ASSERT_EQ(receive(SYNC_SNAPSHOT_SEQ_BEGIN, ""), 0);
+    ASSERT_EQ(gEnv.acks, std::vector<int32_t>({SYNC_SNAPSHOT_SEQ_PREP_SNAPSHOT, SYNC_SNAPSHOT_SEQ_BEGIN}));
+    gEnv.acks.clear();
+  }
+
+  int32_t receive(int32_t seq, const std::string& data) {
+    SRpcMsg rpcMsg = {0};
+    if (syncBuildSnapshotSend(&rpcMsg, data.size(), kVgId) != 0) {
+      return -1;
+    }
+    SyncSnapshotSend* pMsg = (SyncSnapshotSend*)rpcMsg.pCont;
+    pMsg->srcId = pLeader->myRaftId;
+    pMsg->destId = pFollower->myRaftId;
+    pMsg->startTime = startTime;
+    pMsg->seq = seq;
+    memcpy(pMsg->data, data.data(), data.size());
+    int32_t code = syncNodeOnSnapshot(pFollower, &rpcMsg);
+    rpcFreeCont(rpcMsg.pCont);
+    return code;
+  }
+
+  // the seqs of the sent msgs in the order they went out
+  std::vector<int32_t> sentSeqs() {
+    std::vector<int32_t> seqs;
+    for (const auto& msg : gEnv.sent) seqs.push_back(msg.seq);
+    return seqs;
+  }
+
+  std::vector<std::string> writtenData() {
+    std::vector<std::string> data;
+    for (const auto& msg : gEnv.written) data.push_back(msg.data);
+    return data;
+  }
+
+  std::vector<std::string> expectData(int32_t first, int32_t last) {
+    std::vector<std::string> data;
+    for (int32_t i = first; i <= last; ++i) data.push_back(blockData(i));
+    return data;
+  }
+
+  SSyncFSM*              pFsm = NULL;
+  SSyncNode*             pLeader = NULL;
+  SSyncNode*             pFollower = NULL;
+  SSyncSnapshotSender*   pSender = NULL;
+  SSyncSnapshotReceiver* pReceiver = NULL;
+  int64_t                startTime = 0;
+};
+
+}  // namespace
+
+// the sender reads ahead of the acks until the window is full, and every ack slides the window
+TEST_F(SyncSnapshotWindowTest, senderFillsWindow) {
+  startSender();
+  ASSERT_EQ(pSender->windowSize, SYNC_SNAPSHOT_WINDOW_SIZE);
+
+  std::vector<int32_t> expect;
+  for (int32_t i = 1; i <= SYNC_SNAPSHOT_WINDOW_SIZE; ++i) expect.push_back(i);
+  ASSERT_EQ(sentSeqs(), expect);
+  ASSERT_EQ(pSender->seq, SYNC_SNAPSHOT_WINDOW_SIZE);
+  for (const auto& msg : gEnv.sent) {
+    ASSERT_EQ(msg.data, blockData(msg.seq));
+  }
+
+  // a duplicated ack sends nothing, the acks are cumulative and release the blocks up to the ack
+  gEnv.sent.clear();
+  ASSERT_EQ(ack(SYNC_SNAPSHOT_SEQ_BEGIN), 0);
+  ASSERT_TRUE(gEnv.sent.empty());
+
+  ASSERT_EQ(ack(3), 0);
+  ASSERT_EQ(sentSeqs(), std::vector<int32_t>({9, 10, 11}));
+  for (int32_t seq = 1; seq <= 3; ++seq) {
+    ASSERT_EQ(pSender->window[seq % SYNC_SNAPSHOT_WINDOW_SIZE].seq, seq + SYNC_SNAPSHOT_WINDOW_SIZE);
+  }
+  ASSERT_EQ(pSender->window[4 % SYNC_SNAPSHOT_WINDOW_SIZE].seq, 4);
+
+  // the end msg follows the last data block only once all of them are acked
+  gEnv.sent.clear();
+  ASSERT_EQ(ack(11), 0);
+  ASSERT_EQ(ack(19), 0);
+  ASSERT_TRUE(pSender->readEnd);
+  ASSERT_EQ(pSender->seq, kNumOfBlocks);
+  ASSERT_EQ(sentSeqs().back(), kNumOfBlocks);
+
+  // the read-ahead thread is done, and the blocks read after the first acks went into the released buffers
+  ASSERT_EQ(gEnv.numOfRead, kNumOfBlocks);
+  ASSERT_GE(gEnv.numOfReuse, kNumOfBlocks - SYNC_SNAPSHOT_WINDOW_SIZE - SYNC_SNAPSHOT_READ_AHEAD);
+
+  ASSERT_EQ(ack(kNumOfBlocks), 0);
+  ASSERT_EQ(sentSeqs().back(), SYNC_SNAPSHOT_SEQ_END);
+  ASSERT_EQ(pSender->seq, SYNC_SNAPSHOT_SEQ_END);
+  for (int32_t i = 0; i < SYNC_SNAPSHOT_WINDOW_SIZE; ++i) {
+    ASSERT_EQ(pSender->window[i].pBlock, nullptr);
+  }
+}
+
+// an ack beyond the sent blocks or behind the last ack stops the sender
+TEST_F(SyncSnapshotWindowTest, senderInvalidAck) {
+  startSender();
+  ASSERT_EQ(ack(3), 0);
+  ASSERT_EQ(ack(pSender->seq + 1), -1);
+  ASSERT_FALSE(snapshotSenderIsStart(pSender));
+  for (int32_t i = 0; i < SYNC_SNAPSHOT_WINDOW_SIZE; ++i) {
+    ASSERT_EQ(pSender->window[i].pBlock, nullptr);
+  }
+
+  gEnv = SSnapEnv();
+  startSender();
+  ASSERT_EQ(ack(3), 0);
+  ASSERT_EQ(ack(2), -1);
+  ASSERT_FALSE(snapshotSenderIsStart(pSender));
+}
+
+// a receiver without a window replies the pre-snapshot msg with 0, and gets one block at a time
+TEST_F(SyncSnapshotWindowTest, senderOldReceiver) {
+  startSender(0);
+  ASSERT_EQ(pSender->windowSize, 1);
+  ASSERT_EQ(sentSeqs(), std::vector<int32_t>({1}));
+
+  gEnv.sent.clear();
+  ASSERT_EQ(ack(1), 0);
+  ASSERT_EQ(sentSeqs(), std::vector<int32_t>({2}));
+
+  // duplicated acks resend the only block in flight
+  gEnv.sent.clear();
+  ASSERT_EQ(ack(2), 0);
+  ASSERT_EQ(sentSeqs(), std::vector<int32_t>({3}));
+  ASSERT_EQ(ack(2), 0);
+  ASSERT_EQ(ack(2), 0);
+  ASSERT_EQ(sentSeqs(), std::vector<int32_t>({3, 3}));
+
+  // a receiver can not take more than the sender keeps
+  snapshotSenderStop(pSender, false);
+  gEnv = SSnapEnv();
+  startSender(SYNC_SNAPSHOT_WINDOW_SIZE * 2);
+  ASSERT_EQ(pSender->windowSize, SYNC_SNAPSHOT_WINDOW_SIZE);
+  ASSERT_EQ(gEnv.sent.size(), SYNC_SNAPSHOT_WINDOW_SIZE);
+}
+
+// a failed read ahead fails the ack that needs the block, the blocks read before it are sent
+TEST_F(SyncSnapshotWindowTest, senderReadFails) {
+  gEnv.failAt = SYNC_SNAPSHOT_WINDOW_SIZE + 2;
+  startSender();
+  ASSERT_EQ(gEnv.sent.size(), SYNC_SNAPSHOT_WINDOW_SIZE);
+
+  gEnv.sent.clear();
+  ASSERT_EQ(ack(2), -1);
+  ASSERT_EQ(sentSeqs(), std::vector<int32_t>({SYNC_SNAPSHOT_WINDOW_SIZE + 1}));
+  ASSERT_EQ(terrno, TSDB_CODE_OUT_OF_MEMORY);
+}
+
+// duplicated acks resend the first not acked block once per ack, without waiting for the resend timer
+TEST_F(SyncSnapshotWindowTest, senderFastResend) {
+  startSender();
+  ASSERT_EQ(ack(2), 0);
+
+  gEnv.sent.clear();
+  ASSERT_EQ(ack(2), 0);
+  ASSERT_TRUE(gEnv.sent.empty());
+  ASSERT_EQ(ack(2), 0);
+  ASSERT_EQ(sentSeqs(), std::vector<int32_t>({3}));
+  ASSERT_EQ(gEnv.sent[0].data, blockData(3));
+  for (int32_t i = 0; i < SYNC_SNAPSHOT_WINDOW_SIZE; ++i) {
+    ASSERT_EQ(ack(2), 0);
+  }
+  ASSERT_EQ(sentSeqs(), std::vector<int32_t>({3}));
+
+  // the count starts over with the next ack
+  gEnv.sent.clear();
+  ASSERT_EQ(ack(5), 0);
+  ASSERT_EQ(sentSeqs(), std::vector<int32_t>({11, 12, 13}));
+  ASSERT_EQ(ack(5), 0);
+  ASSERT_EQ(ack(5), 0);
+  ASSERT_EQ(sentSeqs(), std::vector<int32_t>({11, 12, 13, 6}));
+}
+
+// only the blocks not acked within the resend interval are sent again
+TEST_F(SyncSnapshotWindowTest, senderResendsLostBlocks) {
+  startSender();
+  ASSERT_EQ(ack(2), 0);
+
+  int64_t now = taosGetTimestampMs();
+  for (int32_t seq = pSender->ack + 1; seq <= pSender->seq; ++seq) {
+    SSyncSnapBlock* pBlock = &pSender->window[seq % SYNC_SNAPSHOT_WINDOW_SIZE];
+    ASSERT_EQ(pBlock->seq, seq);
+    pBlock->sendTime = (seq == 3 || seq == 6) ? now - SYNC_SNAP_RESEND_MS - 1 : now;
+  }
+
+  gEnv.sent.clear();
+  ASSERT_EQ(snapshotReSend(pSender), 0);
+  ASSERT_EQ(sentSeqs(), std::vector<int32_t>({3, 6}));
+  ASSERT_EQ(gEnv.sent[0].data, blockData(3));
+  ASSERT_EQ(gEnv.sent[1].data, blockData(6));
+
+  // the resent blocks are not due again right away
+  gEnv.sent.clear();
+  ASSERT_EQ(snapshotReSend(pSender), 0);
+  ASSERT_TRUE(gEnv.sent.empty());
+}
+
+// blocks ahead of ack + 1 are kept and written in order once the gap is filled
+TEST_F(SyncSnapshotWindowTest, receiverOutOfOrder) {
+  startReceiver();
+
+  ASSERT_EQ(receive(2, blockData(2)), 0);
+  ASSERT_EQ(receive(4, blockData(4)), 0);
+  ASSERT_EQ(receive(3, blockData(3)), 0);
+  ASSERT_EQ(pReceiver->ack, SYNC_SNAPSHOT_SEQ_BEGIN);
+  ASSERT_TRUE(gEnv.written.empty());
+
+  // the blocks kept ahead of the gap are acked with the same ack, so the sender knows block 1 is missing
+  ASSERT_EQ(gEnv.acks, std::vector<int32_t>(3, SYNC_SNAPSHOT_SEQ_BEGIN));
+
+  ASSERT_EQ(receive(1, blockData(1)), 0);
+  ASSERT_EQ(pReceiver->ack, 4);
+  ASSERT_EQ(gEnv.acks.back(), 4);
+  ASSERT_EQ(writtenData(), expectData(1, 4));
+
+  // duplicated blocks are acked again without being written
+  ASSERT_EQ(receive(3, blockData(3)), 0);
+  ASSERT_EQ(receive(4, blockData(4)), 0);
+  ASSERT_EQ(pReceiver->ack, 4);
+  ASSERT_EQ(gEnv.written.size(), 4);
+
+  // a block beyond the window is rejected
+  ASSERT_NE(receive(4 + SYNC_SNAPSHOT_WINDOW_SIZE + 1, blockData(0)), 0);
+  ASSERT_EQ(pReceiver->ack, 4);
+
+  // the buffers of applied blocks are kept for reuse
+  ASSERT_EQ(receive(6, blockData(6)), 0);
+  SSyncSnapBlock* pBlock = &pReceiver->window[6 % SYNC_SNAPSHOT_WINDOW_SIZE];
+  void*           pBuf = pBlock->pBlock;
+  ASSERT_EQ(receive(4 + SYNC_SNAPSHOT_WINDOW_SIZE, blockData(4 + SYNC_SNAPSHOT_WINDOW_SIZE)), 0);
+  ASSERT_EQ(receive(5, blockData(5)), 0);
+  ASSERT_EQ(pReceiver->ack, 6);
+  ASSERT_EQ(writtenData(), expectData(1, 6));
+
+  ASSERT_EQ(receive(7, blockData(7)), 0);
+  ASSERT_EQ(receive(14, blockData(14)), 0);
+  ASSERT_EQ(pBlock->seq, 14);
+  ASSERT_EQ(pBlock->pBlock, pBuf);
+  ASSERT_EQ(receive(8, blockData(8)), 0);
+  ASSERT_EQ(pReceiver->ack, 8);
+}
+
+// blocks lost on the way are resent on duplicated acks, or once the resend interval passes, and the receiver writes
+// every block once and in order
+TEST_F(SyncSnapshotWindowTest, transferWithLoss) {
+  startSender();
+  startReceiver();
+
+  std::map<int32_t, int32_t> numOfSent;
+  int32_t                    numOfTimerResend = 0;
+  for (int32_t round = 0; round < 100 && pSender->seq != SYNC_SNAPSHOT_SEQ_END; ++round) {
+    std::vector<SSnapMsg> sent;
+    sent.swap(gEnv.sent);
+
+    if (sent.empty()) {
+      // nothing is on the way, so the resend timer goes off
+      for (int32_t i = 0; i < SYNC_SNAPSHOT_WINDOW_SIZE; ++i) {
+        pSender->window[i].sendTime -= SYNC_SNAP_RESEND_MS + 1;
+      }
+      ASSERT_EQ(snapshotReSend(pSender), 0);
+      numOfTimerResend += gEnv.sent.size();
+      continue;
+    }
+
+    // deliver in reverse order, and lose every third block the first time it is sent
+    for (auto it = sent.rbegin(); it != sent.rend(); ++it) {
+      if (it->seq == SYNC_SNAPSHOT_SEQ_END) continue;
+      if (numOfSent[it->seq]++ == 0 && it->seq % 3 == 0) continue;
+      ASSERT_EQ(receive(it->seq, it->data), 0);
+    }
+
+    // the acks go back in order, the duplicated ones trigger the fast resend
+    std::vector<int32_t> acks;
+    acks.swap(gEnv.acks);
+    for (int32_t seq : acks) {
+      ASSERT_EQ(ack(seq), 0);
+    }
+  }
+
+  ASSERT_EQ(pSender->seq, SYNC_SNAPSHOT_SEQ_END);
+  ASSERT_EQ(writtenData(), expectData(1, kNumOfBlocks));
+
+  // the acks are cumulative, so a resend covers the window from the first lost block, never the acked blocks
+  ASSERT_LE(numOfTimerResend, (kNumOfBlocks / 3) * SYNC_SNAPSHOT_WINDOW_SIZE);
+  for (const auto& it : numOfSent) {
+    ASSERT_GE(it.second, it.first % 3 == 0 ? 2 : 1) << "seq:" << it.first;
+  }
+}
@@ -28,19 +28,16 @@ cJSON *snapshotSender2Json(SSyncSnapshotSender *pSender) {
     snprintf(u64buf, sizeof(u64buf), "%p", pSender->pReader);
     cJSON_AddStringToObject(pRoot, "pReader", u64buf);
 
-    snprintf(u64buf, sizeof(u64buf), "%p", pSender->pCurrentBlock);
-    cJSON_AddStringToObject(pRoot, "pCurrentBlock", u64buf);
-    cJSON_AddNumberToObject(pRoot, "blockLen", pSender->blockLen);
-
-    if (pSender->pCurrentBlock != NULL) {
-      char *s;
-      s = syncUtilPrintBin((char *)(pSender->pCurrentBlock), pSender->blockLen);
-      cJSON_AddStringToObject(pRoot, "pCurrentBlock", s);
-      taosMemoryFree(s);
-      s = syncUtilPrintBin2((char *)(pSender->pCurrentBlock), pSender->blockLen);
-      cJSON_AddStringToObject(pRoot, "pCurrentBlock2", s);
-      taosMemoryFree(s);
+    cJSON_AddNumberToObject(pRoot, "readEnd", pSender->readEnd);
+
+    cJSON *pWindow = cJSON_CreateArray();
+    for (int32_t i = 0; i < SYNC_SNAPSHOT_WINDOW_SIZE; ++i) {
+      cJSON *pBlock = cJSON_CreateObject();
+      cJSON_AddNumberToObject(pBlock, "seq", pSender->window[i].seq);
+      cJSON_AddNumberToObject(pBlock, "blockLen", pSender->window[i].blockLen);
+      cJSON_AddItemToArray(pWindow, pBlock);
     }
+    cJSON_AddItemToObject(pRoot, "window", pWindow);
 
     cJSON *pSnapshot = cJSON_CreateObject();
     snprintf(u64buf, sizeof(u64buf), "%" PRIu64, pSender->snapshot.lastApplyIndex);
@@ -40,6 +40,11 @@ typedef struct {
   int32_t   id;
   char     *path;
   SDiskSize size;
+  // io accounting, indexed by ETfsIoType
+  int64_t ioInflightBytes[TFS_IO_MAX];  // bytes of the ios in flight
+  int64_t ioOps[TFS_IO_MAX];
+  int64_t ioBytes[TFS_IO_MAX];
+  int64_t ioLatency[TFS_IO_MAX];  // moving average of the io latency in us
 } STfsDisk;
 
 typedef struct {
@@ -76,6 +81,9 @@ typedef struct STfs {
 STfsDisk *tfsNewDisk(int32_t level, int32_t id, const char *dir);
 STfsDisk *tfsFreeDisk(STfsDisk *pDisk);
 int32_t   tfsUpdateDiskSize(STfsDisk *pDisk);
+void      tfsDiskIoBegin(STfsDisk *pDisk, ETfsIoType type, int64_t bytes);
+void      tfsDiskIoEnd(STfsDisk *pDisk, ETfsIoType type, int64_t bytes, int64_t latency);
+double    tfsDiskLoad(STfsDisk *pDisk);
 
 int32_t   tfsInitTier(STfsTier *pTier, int32_t level);
 void      tfsDestroyTier(STfsTier *pTier);
@@ -96,6 +104,12 @@ void      tfsPosNextId(STfsTier *pTier);
 
 #define TMPNAME_LEN (TSDB_FILENAME_LEN * 2 + 32)
 
+// weight of the latest sample in the moving average of io latency, as a shift
+#define TFS_IO_LATENCY_SHIFT 3
+
+// disks whose load is within this many bytes of the least loaded disk of the tier are allocated Round-Robin
+#define TFS_IO_LOAD_TOLERANCE (1024 * 1024)
+
 #ifdef __cplusplus
 }
 #endif
@@ -150,6 +150,42 @@ int32_t tfsAllocDisk(STfs *pTfs, int32_t expLevel, SDiskID *pDiskId) {
   return -1;
 }
 
+int32_t tfsGetDiskIdByPath(STfs *pTfs, const char *path, SDiskID *pDiskId) {
+  int32_t maxLen = 0;
+
+  pDiskId->level = -1;
+  pDiskId->id = -1;
+  if (pTfs == NULL) return -1;
+
+  for (int32_t level = 0; level < pTfs->nlevel; level++) {
+    STfsTier *pTier = TFS_TIER_AT(pTfs, level);
+    for (int32_t id = 0; id < pTier->ndisk; id++) {
+      STfsDisk *pDisk = pTier->disks[id];
+      if (pDisk == NULL) continue;
+
+      int32_t len = strlen(pDisk->path);
+      if (len <= maxLen || strncmp(path, pDisk->path, len) != 0) continue;
+      if (path[len] != 0 && path[len] != TD_DIRSEP[0]) continue;
+
+      maxLen = len;
+      pDiskId->level = level;
+      pDiskId->id = id;
+    }
+  }
+
+  return maxLen > 0 ? 0 : -1;
+}
+
+void tfsIoBegin(STfs *pTfs, SDiskID diskId, ETfsIoType type, int64_t bytes) {
+  if (pTfs == NULL || diskId.id < 0) return;
+  tfsDiskIoBegin(TFS_DISK_AT(pTfs, diskId), type, bytes);
+}
+
+void tfsIoEnd(STfs *pTfs, SDiskID diskId, ETfsIoType type, int64_t bytes, int64_t latency) {
+  if (pTfs == NULL || diskId.id < 0) return;
+  tfsDiskIoEnd(TFS_DISK_AT(pTfs, diskId), type, bytes, latency);
+}
+
 const char *tfsGetPrimaryPath(STfs *pTfs) { return TFS_PRIMARY_DISK(pTfs)->path; }
 
 const char *tfsGetDiskPath(STfs *pTfs, SDiskID diskId) { return TFS_DISK_AT(pTfs, diskId)->path; }
@@ -628,6 +664,13 @@ static STfsDisk *tfsNextDisk(STfs *pTfs, SDiskIter *pIter) {
   return pDisk;
 }
 
+static void tfsGetDiskIoInfo(STfsDisk *pDisk, ETfsIoType type, SMonDiskIo *pIo) {
+  pIo->ops = atomic_load_64(&pDisk->ioOps[type]);
+  pIo->bytes = atomic_load_64(&pDisk->ioBytes[type]);
+  pIo->inflightBytes = atomic_load_64(&pDisk->ioInflightBytes[type]);
+  pIo->latency = atomic_load_64(&pDisk->ioLatency[type]);
+}
+
 int32_t tfsGetMonitorInfo(STfs *pTfs, SMonDiskInfo *pInfo) {
   pInfo->datadirs = taosArrayInit(32, sizeof(SMonDiskDesc));
   if (pInfo->datadirs == NULL) return -1;
@@ -642,6 +685,9 @@ int32_t tfsGetMonitorInfo(STfs *pTfs, SMonDiskInfo *pInfo) {
       SMonDiskDesc dinfo = {0};
       dinfo.size = pDisk->size;
       dinfo.level = pDisk->level;
+      tfsGetDiskIoInfo(pDisk, TFS_IO_READ, &dinfo.read);
+      tfsGetDiskIoInfo(pDisk, TFS_IO_WRITE, &dinfo.write);
+      tfsGetDiskIoInfo(pDisk, TFS_IO_SYNC, &dinfo.sync);
       tstrncpy(dinfo.name, pDisk->path, sizeof(dinfo.name));
       taosArrayPush(pInfo->datadirs, &dinfo);
     }
@@ -54,3 +54,29 @@ int32_t tfsUpdateDiskSize(STfsDisk *pDisk) {
 
   return 0;
 }
+
+void tfsDiskIoBegin(STfsDisk *pDisk, ETfsIoType type, int64_t bytes) {
+  atomic_add_fetch_64(&pDisk->ioInflightBytes[type], bytes);
+}
+
+void tfsDiskIoEnd(STfsDisk *pDisk, ETfsIoType type, int64_t bytes, int64_t latency) {
+  atomic_sub_fetch_64(&pDisk->ioInflightBytes[type], bytes);
+  atomic_add_fetch_64(&pDisk->ioOps[type], 1);
+  atomic_add_fetch_64(&pDisk->ioBytes[type], bytes);
+
+  // racy update of the average is fine, a lost sample does not matter
+  int64_t avg = atomic_load_64(&pDisk->ioLatency[type]);
+  atomic_store_64(&pDisk->ioLatency[type], avg + ((latency - avg) >> TFS_IO_LATENCY_SHIFT));
+}
+
+// Bytes of the ios in flight on the disk, scaled up as the disk fills. An idle disk has no load, however slow its past
+// ios were.
+double tfsDiskLoad(STfsDisk *pDisk) {
+  double bytes = 0;
+  for (int32_t type = 0; type < TFS_IO_MAX; type++) {
+    bytes += atomic_load_64(&pDisk->ioInflightBytes[type]);
+  }
+
+  if (bytes <= 0 || pDisk->size.avail <= 0) return bytes;
+  return bytes * pDisk->size.total / pDisk->size.avail;
+}
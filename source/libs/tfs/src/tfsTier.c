@@ -96,7 +96,7 @@ void tfsUpdateTierSize(STfsTier *pTier) {
   tfsUnLockTier(pTier);
 }
 
-// Round-Robin to allocate disk on a tier
+// Round-Robin to allocate disk on a tier, skipping the disks much busier than the least loaded one
 int32_t tfsAllocDiskOnTier(STfsTier *pTier) {
   terrno = TSDB_CODE_FS_NO_VALID_DISK;
 
@@ -107,15 +107,27 @@ int32_t tfsAllocDiskOnTier(STfsTier *pTier) {
     return -1;
   }
 
-  int32_t retId = -1;
-  for (int32_t id = 0; id < TFS_MAX_DISKS_PER_TIER; ++id) {
-    int32_t   diskId = (pTier->nextid + id) % pTier->ndisk;
-    STfsDisk *pDisk = pTier->disks[diskId];
+  // the loads are read once, the ios keep changing them
+  double aLoad[TFS_MAX_DISKS_PER_TIER];
+  double minLoad = -1;
+  for (int32_t id = 0; id < pTier->ndisk; ++id) {
+    STfsDisk *pDisk = pTier->disks[id];
 
+    aLoad[id] = -1;
     if (pDisk == NULL) continue;
 
     if (pDisk->size.avail < TFS_MIN_DISK_FREE_SIZE) continue;
 
+    aLoad[id] = tfsDiskLoad(pDisk);
+    if (minLoad < 0 || aLoad[id] < minLoad) minLoad = aLoad[id];
+  }
+
+  int32_t retId = -1;
+  for (int32_t id = 0; id < pTier->ndisk && minLoad >= 0; ++id) {
+    int32_t diskId = (pTier->nextid + id) % pTier->ndisk;
+
+    if (aLoad[diskId] < 0 || aLoad[diskId] > minLoad + TFS_IO_LOAD_TOLERANCE) continue;
+
     retId = diskId;
     terrno = 0;
     pTier->nextid = (diskId + 1) % pTier->ndisk;
@@ -722,3 +722,196 @@ TEST_F(TfsTest, 05_MultiDisk) {
 
   tfsClose(pTfs);
 }
+
+TEST_F(TfsTest, 06_LoadAwareAlloc) {
+  int32_t code = 0;
+
+#ifdef _TD_DARWIN_64
+  const char *root00 = "/private" TD_TMP_DIR_PATH "tfsTest00";
+  const char *root01 = "/private" TD_TMP_DIR_PATH "tfsTest01";
+  const char *root02 = "/private" TD_TMP_DIR_PATH "tfsTest02";
+#else
+  const char *root00 = TD_TMP_DIR_PATH "tfsTest00";
+  const char *root01 = TD_TMP_DIR_PATH "tfsTest01";
+  const char *root02 = TD_TMP_DIR_PATH "tfsTest02";
+#endif
+
+  SDiskCfg dCfg[3] = {0};
+  tstrncpy(dCfg[0].dir, root00, TSDB_FILENAME_LEN);
+  dCfg[0].level = 0;
+  dCfg[0].primary = 1;
+  tstrncpy(dCfg[1].dir, root01, TSDB_FILENAME_LEN);
+  dCfg[1].level = 0;
+  dCfg[1].primary = 0;
+  tstrncpy(dCfg[2].dir, root02, TSDB_FILENAME_LEN);
+  dCfg[2].level = 0;
+  dCfg[2].primary = 0;
+
+  taosRemoveDir(root00);
+  taosRemoveDir(root01);
+  taosRemoveDir(root02);
+  taosMkDir(root00);
+  taosMkDir(root01);
+  taosMkDir(root02);
+
+  STfs *pTfs = tfsOpen(dCfg, 3);
+  ASSERT_NE(pTfs, nullptr);
+
+  SDiskID did0 = {0, 0};
+  SDiskID did1 = {0, 1};
+  SDiskID did2 = {0, 2};
+  SDiskID did;
+
+  // path to disk
+  char path[TSDB_FILENAME_LEN] = {0};
+  snprintf(path, sizeof(path), "%s%svnode%sv1f1.data", root01, TD_DIRSEP, TD_DIRSEP);
+  EXPECT_EQ(tfsGetDiskIdByPath(pTfs, path, &did), 0);
+  EXPECT_EQ(did.level, 0);
+  EXPECT_EQ(did.id, 1);
+  EXPECT_EQ(tfsGetDiskIdByPath(pTfs, root02, &did), 0);
+  EXPECT_EQ(did.id, 2);
+  snprintf(path, sizeof(path), "%sx%sv1f1.data", root01, TD_DIRSEP);
+  EXPECT_NE(tfsGetDiskIdByPath(pTfs, path, &did), 0);
+
+  // no io, round robin
+  for (int32_t i = 0; i < 6; i++) {
+    code = tfsAllocDisk(pTfs, 0, &did);
+    EXPECT_EQ(code, 0);
+    EXPECT_EQ(did.id, i % 3);
+  }
+
+  // the disks served ios of different latency, disk 0 is still busy
+  for (int32_t i = 0; i < 100; i++) {
+    tfsIoBegin(pTfs, did0, TFS_IO_WRITE, 4096);
+    tfsIoEnd(pTfs, did0, TFS_IO_WRITE, 4096, 100000);
+    tfsIoBegin(pTfs, did1, TFS_IO_WRITE, 4096);
+    tfsIoEnd(pTfs, did1, TFS_IO_WRITE, 4096, 1000);
+    tfsIoBegin(pTfs, did2, TFS_IO_WRITE, 4096);
+    tfsIoEnd(pTfs, did2, TFS_IO_WRITE, 4096, 100);
+  }
+  tfsIoBegin(pTfs, did0, TFS_IO_WRITE, 2 * 1024 * 1024);
+  tfsIoBegin(pTfs, did0, TFS_IO_READ, 4096);
+
+  // the busy disk is skipped, the others are still taken round robin
+  int32_t nAlloc[3] = {0};
+  for (int32_t i = 0; i < 4; i++) {
+    code = tfsAllocDisk(pTfs, 0, &did);
+    EXPECT_EQ(code, 0);
+    nAlloc[did.id]++;
+  }
+  EXPECT_EQ(nAlloc[0], 0);
+  EXPECT_EQ(nAlloc[1], 2);
+  EXPECT_EQ(nAlloc[2], 2);
+
+  // a page in flight is within the tolerance
+  tfsIoBegin(pTfs, did2, TFS_IO_WRITE, 4096);
+  memset(nAlloc, 0, sizeof(nAlloc));
+  for (int32_t i = 0; i < 4; i++) {
+    code = tfsAllocDisk(pTfs, 0, &did);
+    EXPECT_EQ(code, 0);
+    nAlloc[did.id]++;
+  }
+  EXPECT_EQ(nAlloc[1], 2);
+  EXPECT_EQ(nAlloc[2], 2);
+
+  // disk 2 gets busy with an fsync of many unsynced pages
+  tfsIoBegin(pTfs, did2, TFS_IO_SYNC, 4 * 1024 * 1024);
+  for (int32_t i = 0; i < 3; i++) {
+    code = tfsAllocDisk(pTfs, 0, &did);
+    EXPECT_EQ(code, 0);
+    EXPECT_EQ(did.id, 1);
+  }
+
+  SMonDiskInfo info = {0};
+  EXPECT_EQ(tfsGetMonitorInfo(pTfs, &info), 0);
+  EXPECT_EQ(taosArrayGetSize(info.datadirs), 3);
+  SMonDiskDesc *pDesc = (SMonDiskDesc *)taosArrayGet(info.datadirs, 0);
+  EXPECT_EQ(pDesc->write.ops, 100);
+  EXPECT_EQ(pDesc->write.bytes, 4096 * 100);
+  EXPECT_EQ(pDesc->write.inflightBytes, 2 * 1024 * 1024);
+  EXPECT_EQ(pDesc->read.inflightBytes, 4096);
+  EXPECT_GT(pDesc->write.latency, 90000);
+  pDesc = (SMonDiskDesc *)taosArrayGet(info.datadirs, 2);
+  EXPECT_EQ(pDesc->write.inflightBytes, 4096);
+  EXPECT_EQ(pDesc->sync.inflightBytes, 4 * 1024 * 1024);
+  EXPECT_EQ(pDesc->sync.ops, 0);
+  taosArrayDestroy(info.datadirs);
+
+  tfsClose(pTfs);
+}
+
+TEST_F(TfsTest, 07_AllocAfterIo) {
+  int32_t code = 0;
+
+#ifdef _TD_DARWIN_64
+  const char *root00 = "/private" TD_TMP_DIR_PATH "tfsTest00";
+  const char *root01 = "/private" TD_TMP_DIR_PATH "tfsTest01";
+  const char *root02 = "/private" TD_TMP_DIR_PATH "tfsTest02";
+#else
+  const char *root00 = TD_TMP_DIR_PATH "tfsTest00";
+  const char *root01 = TD_TMP_DIR_PATH "tfsTest01";
+  const char *root02 = TD_TMP_DIR_PATH "tfsTest02";
+#endif
+
+  SDiskCfg dCfg[3] = {0};
+  tstrncpy(dCfg[0].dir, root00, TSDB_FILENAME_LEN);
+  dCfg[0].level = 0;
+  dCfg[0].primary = 1;
+  tstrncpy(dCfg[1].dir, root01, TSDB_FILENAME_LEN);
+  dCfg[1].level = 0;
+  dCfg[1].primary = 0;
+  tstrncpy(dCfg[2].dir, root02, TSDB_FILENAME_LEN);
+  dCfg[2].level = 0;
+  dCfg[2].primary = 0;
+
+  taosRemoveDir(root00);
+  taosRemoveDir(root01);
+  taosRemoveDir(root02);
+  taosMkDir(root00);
+  taosMkDir(root01);
+  taosMkDir(root02);
+
+  STfs *pTfs = tfsOpen(dCfg, 3);
+  ASSERT_NE(pTfs, nullptr);
+
+  SDiskID aDid[3] = {{0, 0}, {0, 1}, {0, 2}};
+  SDiskID did;
+
+  // the disks served ios of very different latency
+  int64_t aLatency[3] = {100000, 10000, 100};
+  for (int32_t i = 0; i < 50; i++) {
+    for (int32_t id = 0; id < 3; id++) {
+      tfsIoBegin(pTfs, aDid[id], TFS_IO_WRITE, 4096);
+      tfsIoEnd(pTfs, aDid[id], TFS_IO_WRITE, 4096, aLatency[id]);
+    }
+  }
+
+  // the slow disks are avoided while they are busy
+  for (int32_t i = 0; i < 10; i++) {
+    tfsIoBegin(pTfs, aDid[0], TFS_IO_WRITE, 256 * 1024);
+    tfsIoBegin(pTfs, aDid[1], TFS_IO_WRITE, 256 * 1024);
+  }
+  for (int32_t i = 0; i < 3; i++) {
+    code = tfsAllocDisk(pTfs, 0, &did);
+    EXPECT_EQ(code, 0);
+    EXPECT_EQ(did.id, 2);
+  }
+
+  // once their ios are done, they are allocated as often as the fast one
+  for (int32_t i = 0; i < 10; i++) {
+    tfsIoEnd(pTfs, aDid[0], TFS_IO_WRITE, 256 * 1024, aLatency[0]);
+    tfsIoEnd(pTfs, aDid[1], TFS_IO_WRITE, 256 * 1024, aLatency[1]);
+  }
+
+  int32_t nAlloc[3] = {0};
+  for (int32_t i = 0; i < 30; i++) {
+    code = tfsAllocDisk(pTfs, 0, &did);
+    EXPECT_EQ(code, 0);
+    nAlloc[did.id]++;
+  }
+  EXPECT_EQ(nAlloc[0], 10);
+  EXPECT_EQ(nAlloc[1], 10);
+  EXPECT_EQ(nAlloc[2], 10);
+
+  tfsClose(pTfs);
+}
@@ -331,6 +331,7 @@ void* transCtxDumpBrokenlinkVal(STransCtx* ctx, int32_t* msgType);
 typedef struct STransReq {
   queue      q;
   uv_write_t wreq;
+  int32_t    num;  // msgs written by the req, 0 means 1
 } STransReq;
 
 void  transReqQueueInit(queue* q);
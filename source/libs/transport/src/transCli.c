@@ -78,6 +78,11 @@ typedef struct SCliConn {
   char  dst[32];
 
   int64_t refId;
+
+  // msgs sent in the current loop iteration, written out together by one uv_write
+  SArray* wbufs;
+  int32_t wbufLen;
+  queue   flushq;
 } SCliConn;
 
 typedef struct SCliMsg {
@@ -88,7 +93,7 @@ typedef struct SCliMsg {
 
   int64_t  refId;
   uint64_t st;
-  int      sent;  //(0: no send, 1: alread sent)
+  int      sent;  //(0: no send, 1: alread sent, 2: written out, wait for the resp)
 } SCliMsg;
 
 typedef struct SCliThrd {
@@ -123,6 +128,12 @@ typedef struct SCliThrd {
 
   int       newConnCount;
   SHashObj* msgCount;
+
+  // conns with pending writes, flushed before the loop polls
+  uv_prepare_t* flush;
+  queue         flushQ;
+  // recv buffers of closed conns, reused by new conns
+  SArray* recvBufPool;
 } SCliThrd;
 
 typedef struct SCliObj {
@@ -182,6 +193,9 @@ static void      cliDestroyConn(SCliConn* pConn, bool clear /*clear tcp handle o
 static void      cliDestroy(uv_handle_t* handle);
 static void      cliSend(SCliConn* pConn);
 static void      cliSendBatch(SCliConn* pConn);
+static void      cliFlushCb(uv_prepare_t* handle);
+static void      cliFlushWrite(SCliConn* pConn);
+static void      cliDropWrite(SCliConn* pConn);
 static void      cliDestroyConnMsgs(SCliConn* conn, bool destroy);
 
 static void    doFreeTimeoutMsg(void* param);
@@ -245,6 +259,12 @@ static void cliWalkCb(uv_handle_t* handle, void* arg);
   } while (0)
 
 #define CONN_PERSIST_TIME(para)   ((para) <= 90000 ? 90000 : (para))
+
+// a conn flushes its pending writes at once when they reach either limit
+#define CLI_WRITE_COALESCE_SIZE (256 * 1024)
+#define CLI_WRITE_COALESCE_NUM  64
+
+#define CLI_RECV_BUF_POOL_SIZE 64
 #define CONN_GET_INST_LABEL(conn) (((STrans*)(((SCliThrd*)(conn)->hostThrd)->pTransInst))->label)
 
 #define CONN_GET_MSGCTX_BY_AHANDLE(conn, ahandle)                         \
@@ -326,6 +346,8 @@ static void* cliWorkThread(void* arg);
 static void cliReleaseUnfinishedMsg(SCliConn* conn) {
   SCliThrd* pThrd = conn->hostThrd;
 
+  cliDropWrite(conn);
+
   for (int i = 0; i < transQueueSize(&conn->cliMsgs); i++) {
     SCliMsg* msg = transQueueGet(&conn->cliMsgs, i);
     if (msg != NULL && msg->ctx != NULL && msg->ctx->ahandle != (void*)0x9527) {
@@ -854,8 +876,14 @@ static SCliConn* cliCreateConn(SCliThrd* pThrd) {
 
   transQueueInit(&conn->cliMsgs, NULL);
 
-  transInitBuffer(&conn->readBuf);
+  if (taosArrayGetSize(pThrd->recvBufPool) > 0) {
+    conn->readBuf = *(SConnBuffer*)taosArrayPop(pThrd->recvBufPool);
+  } else {
+    transInitBuffer(&conn->readBuf);
+  }
   QUEUE_INIT(&conn->q);
+  QUEUE_INIT(&conn->flushq);
+  conn->wbufs = taosArrayInit(4, sizeof(uv_buf_t));
   conn->hostThrd = pThrd;
   conn->status = ConnNormal;
   conn->broken = false;
@@ -886,6 +914,8 @@ static void cliDestroyConn(SCliConn* conn, bool clear) {
   conn->list = NULL;
   pThrd->newConnCount--;
 
+  cliDropWrite(conn);
+
   transReleaseExHandle(transGetRefMgt(), conn->refId);
   transRemoveExHandle(transGetRefMgt(), conn->refId);
   conn->refId = -1;
@@ -932,32 +962,44 @@ static void cliDestroy(uv_handle_t* handle) {
 
   tTrace("%s conn %p destroy successfully", CONN_GET_INST_LABEL(conn), conn);
   transReqQueueClear(&conn->wreqQueue);
-  transDestroyBuffer(&conn->readBuf);
+  cliDropWrite(conn);
+  taosArrayDestroy(conn->wbufs);
+  if (taosArrayGetSize(pThrd->recvBufPool) < CLI_RECV_BUF_POOL_SIZE) {
+    transClearBuffer(&conn->readBuf);
+    taosArrayPush(pThrd->recvBufPool, &conn->readBuf);
+  } else {
+    transDestroyBuffer(&conn->readBuf);
+  }
 
   taosMemoryFree(conn);
 }
-static bool cliHandleNoResp(SCliConn* conn) {
-  bool res = false;
-  if (!transQueueEmpty(&conn->cliMsgs)) {
-    SCliMsg* pMsg = transQueueGet(&conn->cliMsgs, 0);
+// the msgs coalesced in a write are the first numOfMsg ones sent but not yet written out, in their sending order.
+// Release the no-resp ones of them, and return the number released
+static int32_t cliHandleNoResp(SCliConn* conn, int32_t numOfMsg) {
+  int32_t nNoResp = 0;
+  for (int32_t i = 0; numOfMsg > 0 && i < transQueueSize(&conn->cliMsgs);) {
+    SCliMsg* pMsg = transQueueGet(&conn->cliMsgs, i);
+    if (pMsg->sent != 1) {
+      i++;
+      continue;
+    }
+
+    numOfMsg--;
     if (REQUEST_NO_RESP(&pMsg->msg)) {
-      transQueuePop(&conn->cliMsgs);
+      transQueueRm(&conn->cliMsgs, i);
       destroyCmsg(pMsg);
-      res = true;
-    }
-    if (res == true) {
-      if (cliMaySendCachedMsg(conn) == false) {
-        SCliThrd* thrd = conn->hostThrd;
-        addConnToPool(thrd->pool, conn);
-        res = false;
-      } else {
-        res = true;
-      }
+      nNoResp++;
+    } else {
+      pMsg->sent = 2;
+      i++;
     }
   }
-  return res;
+  return nNoResp;
 }
 static void cliSendCb(uv_write_t* req, int status) {
+  STransReq* wreq = req->data;
+  int32_t    numOfMsg = (wreq != NULL && wreq->num > 0) ? wreq->num : 1;
+
   SCliConn* pConn = transReqQueueRemove(req);
   if (pConn == NULL) return;
 
@@ -978,12 +1020,71 @@ static void cliSendCb(uv_write_t* req, int status) {
     }
     return;
   }
-  if (cliHandleNoResp(pConn) == true) {
-    tTrace("%s conn %p no resp required", CONN_GET_INST_LABEL(pConn), pConn);
-    return;
+  int32_t nNoResp = cliHandleNoResp(pConn, numOfMsg);
+  if (nNoResp > 0) {
+    tTrace("%s conn %p %d msgs no resp required", CONN_GET_INST_LABEL(pConn), pConn, nNoResp);
+    if (transQueueEmpty(&pConn->cliMsgs)) {
+      addConnToPool(((SCliThrd*)pConn->hostThrd)->pool, pConn);
+      return;
+    }
+    if (nNoResp == numOfMsg && cliMaySendCachedMsg(pConn) == true) {
+      return;
+    }
   }
   uv_read_start((uv_stream_t*)pConn->stream, cliAllocRecvBufferCb, cliRecvCb);
 }
+static void cliFlushWrite(SCliConn* pConn) {
+  QUEUE_REMOVE(&pConn->flushq);
+  QUEUE_INIT(&pConn->flushq);
+
+  int32_t numOfMsg = taosArrayGetSize(pConn->wbufs);
+  if (numOfMsg == 0) return;
+
+  uv_write_t* req = transReqQueuePush(&pConn->wreqQueue);
+  ((STransReq*)req->data)->num = numOfMsg;
+
+  tTrace("%s conn %p flush %d msgs, len:%d", CONN_GET_INST_LABEL(pConn), pConn, numOfMsg, pConn->wbufLen);
+
+  // uv_write copies the buf array, so it is reused by the next writes
+  int status = uv_write(req, (uv_stream_t*)pConn->stream, TARRAY_DATA(pConn->wbufs), numOfMsg, cliSendCb);
+  taosArrayClear(pConn->wbufs);
+  pConn->wbufLen = 0;
+  if (status != 0) {
+    tError("%s conn %p failed to send %d msgs, errmsg:%s", CONN_GET_INST_LABEL(pConn), pConn, numOfMsg,
+           uv_err_name(status));
+    cliHandleExcept(pConn);
+  }
+}
+static void cliDropWrite(SCliConn* pConn) {
+  QUEUE_REMOVE(&pConn->flushq);
+  QUEUE_INIT(&pConn->flushq);
+  taosArrayClear(pConn->wbufs);
+  pConn->wbufLen = 0;
+}
+static void cliFlushCb(uv_prepare_t* handle) {
+  SCliThrd* pThrd = handle->data;
+  while (!QUEUE_IS_EMPTY(&pThrd->flushQ)) {
+    queue*    h = QUEUE_HEAD(&pThrd->flushQ);
+    SCliConn* pConn = QUEUE_DATA(h, SCliConn, flushq);
+    cliFlushWrite(pConn);
+  }
+  uv_prepare_stop(handle);
+}
+static void cliQueueWrite(SCliConn* pConn, char* buf, int32_t len) {
+  SCliThrd* pThrd = pConn->hostThrd;
+
+  uv_buf_t wb = uv_buf_init(buf, len);
+  taosArrayPush(pConn->wbufs, &wb);
+  pConn->wbufLen += len;
+
+  if (QUEUE_IS_EMPTY(&pConn->flushq)) {
+    QUEUE_PUSH(&pThrd->flushQ, &pConn->flushq);
+    uv_prepare_start(pThrd->flush, cliFlushCb);
+  }
+  if (pConn->wbufLen >= CLI_WRITE_COALESCE_SIZE || taosArrayGetSize(pConn->wbufs) >= CLI_WRITE_COALESCE_NUM) {
+    cliFlushWrite(pConn);
+  }
+}
 void cliSendBatch(SCliConn* pConn) {
   SCliThrd* pThrd = pConn->hostThrd;
   STrans*   pTransInst = pThrd->pTransInst;
@@ -1116,15 +1217,7 @@ void cliSend(SCliConn* pConn) {
   tGDebug("%s conn %p %s is sent to %s, local info %s, len:%d", CONN_GET_INST_LABEL(pConn), pConn,
           TMSG_INFO(pHead->msgType), pConn->dst, pConn->src, msgLen);
 
-  uv_buf_t    wb = uv_buf_init((char*)pHead, msgLen);
-  uv_write_t* req = transReqQueuePush(&pConn->wreqQueue);
-
-  int status = uv_write(req, (uv_stream_t*)pConn->stream, &wb, 1, cliSendCb);
-  if (status != 0) {
-    tGError("%s conn %p failed to send msg:%s, errmsg:%s", CONN_GET_INST_LABEL(pConn), pConn, TMSG_INFO(pMsg->msgType),
-            uv_err_name(status));
-    cliHandleExcept(pConn);
-  }
+  cliQueueWrite(pConn, (char*)pHead, msgLen);
   return;
 _RETURN:
   return;
@@ -2025,6 +2118,13 @@ static SCliThrd* createThrdObj(void* trans) {
   pThrd->prepare->data = pThrd;
   // uv_prepare_start(pThrd->prepare, cliPrepareCb);
 
+  pThrd->flush = taosMemoryCalloc(1, sizeof(uv_prepare_t));
+  uv_prepare_init(pThrd->loop, pThrd->flush);
+  pThrd->flush->data = pThrd;
+  QUEUE_INIT(&pThrd->flushQ);
+
+  pThrd->recvBufPool = taosArrayInit(CLI_RECV_BUF_POOL_SIZE, sizeof(SConnBuffer));
+
   int32_t timerSize = 64;
   pThrd->timerList = taosArrayInit(timerSize, sizeof(void*));
   for (int i = 0; i < timerSize; i++) {
@@ -2077,7 +2177,12 @@ static void destroyThrdObj(SCliThrd* pThrd) {
   }
   taosArrayDestroy(pThrd->timerList);
   taosMemoryFree(pThrd->prepare);
+  taosMemoryFree(pThrd->flush);
   taosMemoryFree(pThrd->loop);
+  for (int i = 0; i < taosArrayGetSize(pThrd->recvBufPool); i++) {
+    transDestroyBuffer(taosArrayGet(pThrd->recvBufPool, i));
+  }
+  taosArrayDestroy(pThrd->recvBufPool);
   taosHashCleanup(pThrd->fqdn2ipCache);
   taosHashCleanup(pThrd->failFastCache);
 
@@ -13,6 +13,7 @@
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 #include <gtest/gtest.h>
+#include <atomic>
 #include <cstdio>
 #include <cstring>
 #include "tdatablock.h"
@@ -42,6 +43,7 @@ static void processRegisterFailure(void *parent, SRpcMsg *pMsg, SEpSet *pEpSet);
 static void processReq(void *parent, SRpcMsg *pMsg, SEpSet *pEpSet);
 // client process;
 static void processResp(void *parent, SRpcMsg *pMsg, SEpSet *pEpSet);
+static void destroyAhandle(void *ahandle);
 class Client {
  public:
   void Init(int nThread) {
@@ -51,6 +53,7 @@ class Client {
     rpcInit_.label = (char *)label;
     rpcInit_.numOfThreads = nThread;
     rpcInit_.cfp = processResp;
+    rpcInit_.dfp = destroyAhandle;
     rpcInit_.user = (char *)user;
     rpcInit_.parent = this;
     rpcInit_.connType = TAOS_CONN_CLIENT;
@@ -93,7 +96,16 @@ class Client {
     SendAndRecv(req, resp);
   }
 
+  void Send(SRpcMsg *req) {
+    SEpSet epSet = {0};
+    epSet.inUse = 0;
+    addEpIntoEpSet(&epSet, "127.0.0.1", 7000);
+
+    rpcSendRequest(this->transCli, &epSet, req, NULL);
+  }
+
   void SemWait() { tsem_wait(&this->sem); }
+  bool SemTimedWait(int64_t ms) { return tsem_timewait(&this->sem, ms) == 0; }
   void SemPost() { tsem_post(&this->sem); }
   void Reset() {}
 
@@ -209,6 +221,10 @@ static void processResp(void *parent, SRpcMsg *pMsg, SEpSet *pEpSet) {
   tDebug("received resp");
 }
 
+// ahandles of the msgs the client released unfinished
+static std::atomic<int32_t> numOfUnfinished(0);
+static void                 destroyAhandle(void *ahandle) { numOfUnfinished++; }
+
 static void initEnv() {
   dDebugFlag = 143;
   vDebugFlag = 0;
@@ -265,6 +281,12 @@ class TransObj {
   }
   void cliSendAndRecv(SRpcMsg *req, SRpcMsg *resp) { cli->SendAndRecv(req, resp); }
   void cliSendAndRecvNoHandle(SRpcMsg *req, SRpcMsg *resp) { cli->SendAndRecvNoHandle(req, resp); }
+  void cliSend(SRpcMsg *req) { cli->Send(req); }
+  bool cliWaitResp(int64_t ms, SRpcMsg *resp) {
+    if (!cli->SemTimedWait(ms)) return false;
+    *resp = *cli->Resp();
+    return true;
+  }
 
   ~TransObj() {
     delete cli;
@@ -504,3 +526,50 @@ TEST_F(TransEnv, noResp) {
 
   // no resp
 }
+TEST_F(TransEnv, noRespMixedInOneWrite) {
+  SRpcMsg resp = {0};
+  SRpcMsg req = {0};
+  req.info.persistHandle = 1;
+  req.msgType = 1;
+  req.pCont = rpcMallocCont(10);
+  req.contLen = 10;
+  tr->cliSendAndRecv(&req, &resp);
+  ASSERT_EQ(resp.code, 0);
+  void *handle = resp.info.handle;
+
+  // sent back to back on the persisted conn, the msgs are coalesced into one write, and only the ones with a resp
+  // are left on the conn once it is written out
+  numOfUnfinished = 0;
+  const int32_t numOfMsg = 8;
+  for (int32_t i = 0; i < numOfMsg; i++) {
+    memset(&req, 0, sizeof(req));
+    req.info.handle = handle;
+    req.info.ahandle = (void *)(int64_t)(i + 1);
+    req.info.noResp = (i % 2 == 0) ? 1 : 0;
+    req.info.persistHandle = req.info.noResp ? 0 : 1;
+    req.msgType = 1;
+    req.pCont = rpcMallocCont(10);
+    req.contLen = 10;
+    tr->cliSend(&req);
+  }
+  for (int32_t i = 0; i < numOfMsg / 2; i++) {
+    ASSERT_TRUE(tr->cliWaitResp(5000, &resp)) << "resp " << i << " lost";
+    EXPECT_EQ(resp.code, 0);
+  }
+  EXPECT_FALSE(tr->cliWaitResp(500, &resp));
+
+  // the conn is still usable
+  memset(&req, 0, sizeof(req));
+  req.info.handle = handle;
+  req.info.persistHandle = 1;
+  req.msgType = 1;
+  req.pCont = rpcMallocCont(10);
+  req.contLen = 10;
+  tr->cliSendAndRecv(&req, &resp);
+  EXPECT_EQ(resp.code, 0);
+
+  // the no-resp msgs were released once written out, none is left on the conn when it goes back to the pool
+  rpcReleaseHandle(handle, TAOS_CONN_CLIENT);
+  taosMsleep(500);
+  EXPECT_EQ(numOfUnfinished.load(), 0);
+}
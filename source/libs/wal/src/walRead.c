@@ -59,6 +59,7 @@ void walCloseReader(SWalReader *pReader) {
   taosCloseFile(&pReader->pIdxFile);
   taosCloseFile(&pReader->pLogFile);
   taosMemoryFreeClear(pReader->pHead);
+  taosMemoryFreeClear(pReader->pBuf);
   taosMemoryFree(pReader);
 }
 
@@ -128,11 +129,108 @@ void walReaderVerifyOffset(SWalReader *pWalReader, STqOffsetVal* pOffset){
   }
 }
 
+static void walReadBufReset(SWalReader *pReader, int64_t offset) {
+  pReader->bufOffset = offset;
+  pReader->bufLen = 0;
+  pReader->bufPos = 0;
+}
+
+// move to the offset of the log file, no seek is needed if it is in the buffer
+static int32_t walReadBufSeek(SWalReader *pReader, int64_t offset) {
+  pReader->bufBypass = false;
+  if (offset >= pReader->bufOffset && offset <= pReader->bufOffset + pReader->bufLen) {
+    pReader->bufPos = offset - pReader->bufOffset;
+    return 0;
+  }
+
+  if (taosLSeekFile(pReader->pLogFile, offset, SEEK_SET) < 0) {
+    terrno = TAOS_SYSTEM_ERROR(errno);
+    return -1;
+  }
+
+  walReadBufReset(pReader, offset);
+  return 0;
+}
+
+// read the log file through the buffer, so that many entries are read in one syscall
+static int64_t walReadBufData(SWalReader *pReader, void *buf, int64_t len) {
+  int64_t nread = 0;
+
+  while (nread < len) {
+    int64_t remain = pReader->bufLen - pReader->bufPos;
+    if (remain > 0) {
+      int64_t n = TMIN(remain, len - nread);
+      memcpy((char *)buf + nread, pReader->pBuf + pReader->bufPos, n);
+      pReader->bufPos += n;
+      nread += n;
+      continue;
+    }
+
+    walReadBufReset(pReader, pReader->bufOffset + pReader->bufLen);
+
+    // large bodies are read into the dest directly
+    if (pReader->bufBypass || len - nread >= WAL_READ_BUF_SIZE) {
+      int64_t n = taosReadFile(pReader->pLogFile, (char *)buf + nread, len - nread);
+      if (n < 0) {
+        terrno = TAOS_SYSTEM_ERROR(errno);
+        return -1;
+      }
+
+      pReader->bufOffset += n;
+      nread += n;
+      break;
+    }
+
+    if (pReader->pBuf == NULL) {
+      pReader->pBuf = taosMemoryMalloc(WAL_READ_BUF_SIZE);
+      if (pReader->pBuf == NULL) {
+        terrno = TSDB_CODE_OUT_OF_MEMORY;
+        return -1;
+      }
+    }
+
+    // entries committed before the read are complete, and will never be rolled back. The entry crossing the end of
+    // the buffer is checked against the earlier fill.
+    int64_t commitVer = walGetCommittedVer(pReader->pWal);
+    int64_t n = taosReadFile(pReader->pLogFile, pReader->pBuf, WAL_READ_BUF_SIZE);
+    if (n < 0) {
+      terrno = TAOS_SYSTEM_ERROR(errno);
+      return -1;
+    } else if (n == 0) {
+      break;
+    }
+
+    pReader->bufCommitVer = (nread > 0) ? TMIN(pReader->bufCommitVer, commitVer) : commitVer;
+    pReader->bufLen = n;
+  }
+
+  return nread;
+}
+
+// read the head of the entry at the current position. An entry that was not committed when it was buffered may have
+// been rolled back and rewritten since then, so read it from the log file again.
+static int64_t walReadBufHead(SWalReader *pReader) {
+  int64_t offset = pReader->bufOffset + pReader->bufPos;
+  int64_t contLen = walReadBufData(pReader, pReader->pHead, sizeof(SWalCkHead));
+
+  if (contLen == sizeof(SWalCkHead) && !pReader->bufBypass && pReader->pHead->head.version > pReader->bufCommitVer) {
+    if (taosLSeekFile(pReader->pLogFile, offset, SEEK_SET) < 0) {
+      terrno = TAOS_SYSTEM_ERROR(errno);
+      return -1;
+    }
+
+    walReadBufReset(pReader, offset);
+    pReader->bufBypass = true;
+    contLen = walReadBufData(pReader, pReader->pHead, sizeof(SWalCkHead));
+  }
+
+  return contLen;
+}
+
 static int64_t walReadSeekFilePos(SWalReader *pReader, int64_t fileFirstVer, int64_t ver) {
   int64_t ret = 0;
 
   TdFilePtr pIdxTFile = pReader->pIdxFile;
-  TdFilePtr pLogTFile = pReader->pLogFile;
 
   // seek position
   int64_t offset = (ver - fileFirstVer) * sizeof(SWalIdxEntry);
@@ -156,9 +254,8 @@ static int64_t walReadSeekFilePos(SWalReader *pReader, int64_t fileFirstVer, int
     return -1;
   }
 
-  ret = taosLSeekFile(pLogTFile, entry.offset, SEEK_SET);
-  if (ret < 0) {
-    terrno = TAOS_SYSTEM_ERROR(errno);
+  ret = entry.offset;
+  if (walReadBufSeek(pReader, entry.offset) < 0) {
     wError("vgId:%d, failed to seek log file, index:%" PRId64 ", pos:%" PRId64 ", since %s", pReader->pWal->cfg.vgId,
            ver, entry.offset, terrstr());
     return -1;
@@ -171,6 +268,8 @@ static int32_t walReadChangeFile(SWalReader *pReader, int64_t fileFirstVer) {
 
   taosCloseFile(&pReader->pIdxFile);
   taosCloseFile(&pReader->pLogFile);
+  pReader->bufBypass = false;
+  walReadBufReset(pReader, 0);
 
   walBuildLogName(pReader->pWal, fileFirstVer, fnameStr);
   TdFilePtr pLogFile = taosOpenFile(fnameStr, TD_FILE_READ);
@@ -275,7 +374,7 @@ int32_t walFetchHead(SWalReader *pRead, int64_t ver) {
   }
 
   while (1) {
-    contLen = taosReadFile(pRead->pLogFile, pRead->pHead, sizeof(SWalCkHead));
+    contLen = walReadBufHead(pRead);
     if (contLen == sizeof(SWalCkHead)) {
       break;
     } else if (contLen == 0 && !seeked) {
@@ -311,9 +410,7 @@ int32_t walSkipFetchBody(SWalReader *pRead) {
          pRead->pWal->cfg.vgId, pRead->pHead->head.version, pRead->pWal->vers.firstVer, pRead->pWal->vers.commitVer,
          pRead->pWal->vers.lastVer, pRead->pWal->vers.appliedVer);
 
-  int64_t code = taosLSeekFile(pRead->pLogFile, pRead->pHead->head.bodyLen, SEEK_CUR);
-  if (code < 0) {
-    terrno = TAOS_SYSTEM_ERROR(errno);
+  if (walReadBufSeek(pRead, pRead->bufOffset + pRead->bufPos + pRead->pHead->head.bodyLen) < 0) {
     return -1;
   }
 
@@ -341,7 +438,9 @@ int32_t walFetchBody(SWalReader *pRead) {
     pRead->capacity = pReadHead->bodyLen;
   }
 
-  if (pReadHead->bodyLen != taosReadFile(pRead->pLogFile, pReadHead->body, pReadHead->bodyLen)) {
+  int64_t contLen = walReadBufData(pRead, pReadHead->body, pReadHead->bodyLen);
+  pRead->bufBypass = false;
+  if (pReadHead->bodyLen != contLen) {
     if (pReadHead->bodyLen < 0) {
       terrno = TAOS_SYSTEM_ERROR(errno);
       wError("vgId:%d, wal fetch body error:%" PRId64 ", read request index:%" PRId64 ", since %s",
@@ -402,7 +501,7 @@ int32_t walReadVer(SWalReader *pReader, int64_t ver) {
   }
 
   while (1) {
-    contLen = taosReadFile(pReader->pLogFile, pReader->pHead, sizeof(SWalCkHead));
+    contLen = walReadBufHead(pReader);
     if (contLen == sizeof(SWalCkHead)) {
       break;
     } else if (contLen == 0 && !seeked) {
@@ -446,8 +545,9 @@ int32_t walReadVer(SWalReader *pReader, int64_t ver) {
     pReader->capacity = pReader->pHead->head.bodyLen;
   }
 
-  if ((contLen = taosReadFile(pReader->pLogFile, pReader->pHead->head.body, pReader->pHead->head.bodyLen)) !=
-      pReader->pHead->head.bodyLen) {
+  contLen = walReadBufData(pReader, pReader->pHead->head.body, pReader->pHead->head.bodyLen);
+  pReader->bufBypass = false;
+  if (contLen != pReader->pHead->head.bodyLen) {
     if (contLen < 0)
       terrno = TAOS_SYSTEM_ERROR(errno);
     else {
@@ -493,5 +593,7 @@ void walReadReset(SWalReader *pReader) {
   taosCloseFile(&pReader->pLogFile);
   pReader->curFileFirstVer = -1;
   pReader->curVersion = -1;
+  pReader->bufBypass = false;
+  walReadBufReset(pReader, 0);
   taosThreadMutexUnlock(&pReader->mutex);
 }
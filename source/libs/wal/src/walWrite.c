@@ -455,17 +455,17 @@ END:
   return code;
 }
 
-static int32_t walWriteIndex(SWal *pWal, int64_t ver, int64_t offset) {
-  SWalIdxEntry  entry = {.ver = ver, .offset = offset};
+static int32_t walWriteIndex(SWal *pWal, const SWalIdxEntry *pEntries, int32_t num) {
   SWalFileInfo *pFileInfo = walGetCurFileInfo(pWal);
 
-  int64_t idxOffset = (entry.ver - pFileInfo->firstVer) * sizeof(SWalIdxEntry);
-  wDebug("vgId:%d, write index, index:%" PRId64 ", offset:%" PRId64 ", at %" PRId64, pWal->cfg.vgId, ver, offset,
-         idxOffset);
+  int64_t idxOffset = (pEntries[0].ver - pFileInfo->firstVer) * sizeof(SWalIdxEntry);
+  wDebug("vgId:%d, write index, index:%" PRId64 ", offset:%" PRId64 ", num:%d, at %" PRId64, pWal->cfg.vgId,
+         pEntries[0].ver, pEntries[0].offset, num, idxOffset);
 
-  int64_t size = taosWriteFile(pWal->pIdxFile, &entry, sizeof(SWalIdxEntry));
-  if (size != sizeof(SWalIdxEntry)) {
-    wError("vgId:%d, failed to write idx entry due to %s. ver:%" PRId64, pWal->cfg.vgId, strerror(errno), ver);
+  int64_t size = taosWriteFile(pWal->pIdxFile, pEntries, sizeof(SWalIdxEntry) * num);
+  if (size != sizeof(SWalIdxEntry) * num) {
+    wError("vgId:%d, failed to write idx entry due to %s. ver:%" PRId64, pWal->cfg.vgId, strerror(errno),
+           pEntries[0].ver);
     terrno = TAOS_SYSTEM_ERROR(errno);
     return -1;
   }
@@ -474,47 +474,66 @@ static int32_t walWriteIndex(SWal *pWal, int64_t ver, int64_t offset) {
   int64_t endOffset = taosLSeekFile(pWal->pIdxFile, 0, SEEK_END);
   if (endOffset < 0) {
     wFatal("vgId:%d, failed to seek end of WAL idxfile due to %s. ver:%" PRId64 "", pWal->cfg.vgId, strerror(errno),
-           ver);
+           pEntries[0].ver);
     taosMsleep(100);
     exit(EXIT_FAILURE);
   }
   return 0;
 }
 
-static FORCE_INLINE int32_t walWriteImpl(SWal *pWal, int64_t index, tmsg_t msgType, SWalSyncInfo syncMeta,
-                                         const void *body, int32_t bodyLen) {
+/*
+ * Write a run of consecutive entries to the current idx/log file pair: the idx entries go out in one write and all the
+ * heads and bodies in one vectored write. The caller provides the scratch buffers, num elements for pHeads and pIdx,
+ * and 2 * num elements for pIov. On failure both files are truncated back to where the batch started.
+ */
+static int32_t walWriteBatchImpl(SWal *pWal, const SWalBatchEntry *pEntries, int32_t num, SWalCkHead *pHeads,
+                                 SWalIdxEntry *pIdx, TdFileIoVec *pIov) {
   int64_t code = 0;
 
   int64_t       offset = walGetCurFileOffset(pWal);
   SWalFileInfo *pFileInfo = walGetCurFileInfo(pWal);
+  int64_t       firstIndex = pEntries[0].index;
+  int64_t       lastIndex = pEntries[num - 1].index;
+  int64_t       size = 0;
 
-  pWal->writeHead.head.version = index;
-  pWal->writeHead.head.bodyLen = bodyLen;
-  pWal->writeHead.head.msgType = msgType;
-  pWal->writeHead.head.ingestTs = 0;
+  for (int32_t i = 0; i < num; ++i) {
+    const SWalBatchEntry *pEntry = &pEntries[i];
+    SWalCkHead           *pHead = &pHeads[i];
 
-  // sync info for sync module
-  pWal->writeHead.head.syncMeta = syncMeta;
+    if (pHead != &pWal->writeHead) {
+      *pHead = pWal->writeHead;
+    }
 
-  pWal->writeHead.cksumHead = walCalcHeadCksum(&pWal->writeHead);
-  pWal->writeHead.cksumBody = walCalcBodyCksum(body, bodyLen);
-  wDebug("vgId:%d, wal write log %" PRId64 ", msgType: %s, cksum head %u cksum body %u", pWal->cfg.vgId, index,
-         TMSG_INFO(msgType), pWal->writeHead.cksumHead, pWal->writeHead.cksumBody);
+    pHead->head.version = pEntry->index;
+    pHead->head.bodyLen = pEntry->bodyLen;
+    pHead->head.msgType = pEntry->msgType;
+    pHead->head.ingestTs = 0;
 
-  code = walWriteIndex(pWal, index, offset);
-  if (code < 0) {
-    goto END;
+    // sync info for sync module
+    pHead->head.syncMeta = pEntry->syncMeta;
+
+    pHead->cksumHead = walCalcHeadCksum(pHead);
+    pHead->cksumBody = walCalcBodyCksum(pEntry->body, pEntry->bodyLen);
+    wDebug("vgId:%d, wal write log %" PRId64 ", msgType: %s, cksum head %u cksum body %u", pWal->cfg.vgId,
+           pEntry->index, TMSG_INFO(pEntry->msgType), pHead->cksumHead, pHead->cksumBody);
+
+    pIdx[i].ver = pEntry->index;
+    pIdx[i].offset = offset + size;
+
+    pIov[2 * i].buf = pHead;
+    pIov[2 * i].len = sizeof(SWalCkHead);
+    pIov[2 * i + 1].buf = pEntry->body;
+    pIov[2 * i + 1].len = pEntry->bodyLen;
+
+    size += sizeof(SWalCkHead) + pEntry->bodyLen;
   }
 
-  if (taosWriteFile(pWal->pLogFile, &pWal->writeHead, sizeof(SWalCkHead)) != sizeof(SWalCkHead)) {
-    terrno = TAOS_SYSTEM_ERROR(errno);
-    wError("vgId:%d, file:%" PRId64 ".log, failed to write since %s", pWal->cfg.vgId, walGetLastFileFirstVer(pWal),
-           strerror(errno));
-    code = -1;
+  code = walWriteIndex(pWal, pIdx, num);
+  if (code < 0) {
     goto END;
   }
 
-  if (taosWriteFile(pWal->pLogFile, (char *)body, bodyLen) != bodyLen) {
+  if (taosWritevFile(pWal->pLogFile, pIov, num * 2) != size) {
     terrno = TAOS_SYSTEM_ERROR(errno);
     wError("vgId:%d, file:%" PRId64 ".log, failed to write since %s", pWal->cfg.vgId, walGetLastFileFirstVer(pWal),
            strerror(errno));
@@ -526,10 +545,10 @@ static FORCE_INLINE int32_t walWriteImpl(SWal *pWal, int64_t index, tmsg_t msgTy
   if (pWal->vers.firstVer == -1) {
     pWal->vers.firstVer = 0;
   }
-  pWal->vers.lastVer = index;
-  pWal->totSize += sizeof(SWalCkHead) + bodyLen;
-  pFileInfo->lastVer = index;
-  pFileInfo->fileSize += sizeof(SWalCkHead) + bodyLen;
+  pWal->vers.lastVer = lastIndex;
+  pWal->totSize += size;
+  pFileInfo->lastVer = lastIndex;
+  pFileInfo->fileSize += size;
 
   return 0;
 
@@ -543,7 +562,7 @@ END:
     exit(EXIT_FAILURE);
   }
 
-  int64_t idxOffset = (index - pFileInfo->firstVer) * sizeof(SWalIdxEntry);
+  int64_t idxOffset = (firstIndex - pFileInfo->firstVer) * sizeof(SWalIdxEntry);
   if (taosFtruncateFile(pWal->pIdxFile, idxOffset) < 0) {
     terrno = TAOS_SYSTEM_ERROR(errno);
     wFatal("vgId:%d, failed to recover WAL idxfile from write error since %s, offset:%" PRId64, pWal->cfg.vgId,
@@ -554,6 +573,20 @@ END:
   return -1;
 }
 
+static FORCE_INLINE int32_t walWriteImpl(SWal *pWal, int64_t index, tmsg_t msgType, SWalSyncInfo syncMeta,
+                                         const void *body, int32_t bodyLen) {
+  SWalBatchEntry entry = {
+      .index = index, .msgType = msgType, .syncMeta = syncMeta, .body = body, .bodyLen = bodyLen};
+  SWalIdxEntry idx;
+  TdFileIoVec  iov[2];
+
+  return walWriteBatchImpl(pWal, &entry, 1, &pWal->writeHead, &idx, iov);
+}
+
+static FORCE_INLINE bool walNeedFsync(SWal *pWal) {
+  return pWal->cfg.level == TAOS_WAL_FSYNC && pWal->cfg.fsyncPeriod == 0;
+}
+
 int64_t walAppendLog(SWal *pWal, int64_t index, tmsg_t msgType, SWalSyncInfo syncMeta, const void *body,
                      int32_t bodyLen) {
   taosThreadMutexLock(&pWal->mutex);
@@ -585,6 +618,71 @@ int64_t walAppendLog(SWal *pWal, int64_t index, tmsg_t msgType, SWalSyncInfo syn
   return index;
 }
 
+int64_t walAppendLogBatch(SWal *pWal, const SWalBatchEntry *pEntries, int32_t num, bool forceSync) {
+  if (num <= 0) {
+    terrno = TSDB_CODE_INVALID_PARA;
+    return -1;
+  }
+
+  for (int32_t i = 1; i < num; ++i) {
+    if (pEntries[i].index != pEntries[i - 1].index + 1) {
+      terrno = TSDB_CODE_WAL_INVALID_VER;
+      return -1;
+    }
+  }
+
+  // scratch space of the whole batch is prepared before taking the lock
+  int64_t size = (sizeof(SWalCkHead) + sizeof(SWalIdxEntry) + sizeof(TdFileIoVec) * 2) * num;
+  char   *pBuf = taosMemoryMalloc(size);
+  if (pBuf == NULL) {
+    terrno = TSDB_CODE_OUT_OF_MEMORY;
+    return -1;
+  }
+
+  TdFileIoVec  *pIov = (TdFileIoVec *)pBuf;
+  SWalIdxEntry *pIdx = (SWalIdxEntry *)(pBuf + sizeof(TdFileIoVec) * 2 * num);
+  SWalCkHead   *pHeads = (SWalCkHead *)(pBuf + (sizeof(TdFileIoVec) * 2 + sizeof(SWalIdxEntry)) * num);
+  int64_t       lastIndex = -1;
+
+  taosThreadMutexLock(&pWal->mutex);
+
+  if (pEntries[0].index != pWal->vers.lastVer + 1) {
+    terrno = TSDB_CODE_WAL_INVALID_VER;
+    goto _exit;
+  }
+
+  if (walCheckAndRoll(pWal) < 0) {
+    goto _exit;
+  }
+
+  if (pWal->pLogFile == NULL || pWal->pIdxFile == NULL || pWal->writeCur < 0) {
+    if (walInitWriteFile(pWal) < 0) {
+      goto _exit;
+    }
+  }
+
+  if (walWriteBatchImpl(pWal, pEntries, num, pHeads, pIdx, pIov) < 0) {
+    goto _exit;
+  }
+
+  // all the entries of the batch share one fsync
+  if (forceSync || walNeedFsync(pWal)) {
+    wTrace("vgId:%d, fileId:%" PRId64 ".log, do fsync for %d entries", pWal->cfg.vgId, walGetCurFileFirstVer(pWal),
+           num);
+    if (taosFsyncFile(pWal->pLogFile) < 0) {
+      wError("vgId:%d, file:%" PRId64 ".log, fsync failed since %s", pWal->cfg.vgId, walGetCurFileFirstVer(pWal),
+             strerror(errno));
+    }
+  }
+
+  lastIndex = pEntries[num - 1].index;
+
+_exit:
+  taosThreadMutexUnlock(&pWal->mutex);
+  taosMemoryFree(pBuf);
+  return lastIndex;
+}
+
 int32_t walWriteWithSyncInfo(SWal *pWal, int64_t index, tmsg_t msgType, SWalSyncInfo syncMeta, const void *body,
                              int32_t bodyLen) {
   int32_t code = 0;
@@ -632,7 +730,7 @@ int32_t walWrite(SWal *pWal, int64_t index, tmsg_t msgType, const void *body, in
 
 void walFsync(SWal *pWal, bool forceFsync) {
   taosThreadMutexLock(&pWal->mutex);
-  if (forceFsync || (pWal->cfg.level == TAOS_WAL_FSYNC && pWal->cfg.fsyncPeriod == 0)) {
+  if (forceFsync || walNeedFsync(pWal)) {
     wTrace("vgId:%d, fileId:%" PRId64 ".log, do fsync", pWal->cfg.vgId, walGetCurFileFirstVer(pWal));
     if (taosFsyncFile(pWal->pLogFile) < 0) {
       wError("vgId:%d, file:%" PRId64 ".log, fsync failed since %s", pWal->cfg.vgId, walGetCurFileFirstVer(pWal),
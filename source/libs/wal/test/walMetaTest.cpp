@@ -3,6 +3,7 @@
 #include <iostream>
 #include <queue>
 
+#include "stub.h"
 #include "walInt.h"
 
 const char* ranStr = "tvapq02tcp";
@@ -361,6 +362,167 @@ TEST_F(WalKeepEnv, readHandleRead) {
   walCloseReader(pRead);
 }
 
+TEST_F(WalKeepEnv, appendLogBatchRead) {
+  walResetEnv();
+  int         code;
+  SWalReader* pRead = walOpenReader(pWal, NULL);
+  ASSERT(pRead != NULL);
+
+  char           strs[100][100];
+  SWalBatchEntry entries[10];
+  SWalSyncInfo   syncMeta = {.isWeek = -1, .seqNum = UINT64_MAX, .term = UINT64_MAX};
+  for (int i = 0; i < 100; i += 10) {
+    for (int j = 0; j < 10; j++) {
+      sprintf(strs[i + j], "%s-%d", ranStr, i + j);
+      entries[j].index = i + j;
+      entries[j].msgType = 0;
+      entries[j].syncMeta = syncMeta;
+      entries[j].body = strs[i + j];
+      entries[j].bodyLen = strlen(strs[i + j]);
+    }
+    int64_t index = walAppendLogBatch(pWal, entries, 10, false);
+    ASSERT_EQ(index, i + 9);
+    ASSERT_EQ(pWal->vers.lastVer, i + 9);
+  }
+
+  // out of order batch is rejected as a whole
+  entries[0].index = 100;
+  entries[1].index = 102;
+  ASSERT_EQ(walAppendLogBatch(pWal, entries, 2, false), -1);
+  ASSERT_EQ(pWal->vers.lastVer, 99);
+
+  for (int i = 0; i < 100; i++) {
+    code = walReadVer(pRead, i);
+    ASSERT_EQ(code, 0);
+    ASSERT_EQ(pRead->pHead->head.version, i);
+    int len = strlen(strs[i]);
+    ASSERT_EQ(pRead->pHead->head.bodyLen, len);
+    for (int j = 0; j < len; j++) {
+      EXPECT_EQ(strs[i][j], pRead->pHead->head.body[j]);
+    }
+  }
+  walCloseReader(pRead);
+}
+
+// writes the first buffer and half of the second one, as a write that runs out of disk space would
+static int64_t walTestShortWritev(TdFilePtr pFile, const TdFileIoVec* iov, int32_t iovcnt) {
+  int64_t nwritten = taosWriteFile(pFile, iov[0].buf, iov[0].len);
+  nwritten += taosWriteFile(pFile, iov[1].buf, iov[1].len / 2);
+  errno = ENOSPC;
+  return nwritten;
+}
+
+TEST_F(WalKeepEnv, appendLogBatchShortWrite) {
+  walResetEnv();
+  int         code;
+  SWalReader* pRead = walOpenReader(pWal, NULL);
+  ASSERT(pRead != NULL);
+
+  char           strs[20][100];
+  SWalBatchEntry entries[10];
+  SWalSyncInfo   syncMeta = {.isWeek = -1, .seqNum = UINT64_MAX, .term = UINT64_MAX};
+  for (int i = 0; i < 20; i++) {
+    sprintf(strs[i], "%s-%d", ranStr, i);
+  }
+  for (int j = 0; j < 10; j++) {
+    entries[j].index = j;
+    entries[j].msgType = 0;
+    entries[j].syncMeta = syncMeta;
+    entries[j].body = strs[j];
+    entries[j].bodyLen = strlen(strs[j]);
+  }
+  ASSERT_EQ(walAppendLogBatch(pWal, entries, 10, false), 9);
+
+  int64_t logSize = 0, idxSize = 0;
+  ASSERT_EQ(taosFStatFile(pWal->pLogFile, &logSize, NULL), 0);
+  ASSERT_EQ(taosFStatFile(pWal->pIdxFile, &idxSize, NULL), 0);
+
+  for (int j = 0; j < 10; j++) {
+    entries[j].index = 10 + j;
+    entries[j].body = strs[10 + j];
+    entries[j].bodyLen = strlen(strs[10 + j]);
+  }
+
+  // the short write fails the batch, and both files are truncated back to where it started
+  Stub stub;
+  stub.set(taosWritevFile, walTestShortWritev);
+  ASSERT_EQ(walAppendLogBatch(pWal, entries, 10, false), -1);
+  stub.reset(taosWritevFile);
+
+  int64_t size = 0;
+  ASSERT_EQ(pWal->vers.lastVer, 9);
+  ASSERT_EQ(taosFStatFile(pWal->pLogFile, &size, NULL), 0);
+  ASSERT_EQ(size, logSize);
+  ASSERT_EQ(taosFStatFile(pWal->pIdxFile, &size, NULL), 0);
+  ASSERT_EQ(size, idxSize);
+
+  // the retried batch follows the entries written before the failure
+  ASSERT_EQ(walAppendLogBatch(pWal, entries, 10, false), 19);
+  for (int i = 0; i < 20; i++) {
+    code = walReadVer(pRead, i);
+    ASSERT_EQ(code, 0);
+    ASSERT_EQ(pRead->pHead->head.version, i);
+    int len = strlen(strs[i]);
+    ASSERT_EQ(pRead->pHead->head.bodyLen, len);
+    for (int j = 0; j < len; j++) {
+      EXPECT_EQ(strs[i][j], pRead->pHead->head.body[j]);
+    }
+  }
+  walCloseReader(pRead);
+}
+
+TEST_F(WalKeepEnv, readAheadRollback) {
+  walResetEnv();
+  int         code;
+  SWalReader* pRead = walOpenReader(pWal, NULL);
+  ASSERT(pRead != NULL);
+
+  char newStr[100];
+  for (int i = 0; i < 100; i++) {
+    sprintf(newStr, "%s-%d", ranStr, i);
+    code = walWrite(pWal, i, 0, newStr, strlen(newStr));
+    ASSERT_EQ(code, 0);
+  }
+  code = walCommit(pWal, 49);
+  ASSERT_EQ(code, 0);
+
+  // the uncommitted entries are in the read ahead buffer now
+  for (int i = 0; i < 50; i++) {
+    code = walReadVer(pRead, i);
+    ASSERT_EQ(code, 0);
+    ASSERT_EQ(pRead->pHead->head.version, i);
+  }
+
+  code = walRollback(pWal, 60);
+  ASSERT_EQ(code, 0);
+  for (int i = 60; i < 100; i++) {
+    sprintf(newStr, "%s-new-%d", ranStr, i);
+    code = walWrite(pWal, i, 0, newStr, strlen(newStr));
+    ASSERT_EQ(code, 0);
+  }
+  code = walCommit(pWal, 99);
+  ASSERT_EQ(code, 0);
+
+  for (int i = 50; i < 100; i++) {
+    code = walFetchHead(pRead, i);
+    ASSERT_EQ(code, 0);
+    code = walFetchBody(pRead);
+    ASSERT_EQ(code, 0);
+    ASSERT_EQ(pRead->pHead->head.version, i);
+    if (i < 60) {
+      sprintf(newStr, "%s-%d", ranStr, i);
+    } else {
+      sprintf(newStr, "%s-new-%d", ranStr, i);
+    }
+    int len = strlen(newStr);
+    ASSERT_EQ(pRead->pHead->head.bodyLen, len);
+    for (int j = 0; j < len; j++) {
+      EXPECT_EQ(newStr[j], pRead->pHead->head.body[j]);
+    }
+  }
+  walCloseReader(pRead);
+}
+
 TEST_F(WalRetentionEnv, repairMeta1) {
   walResetEnv();
   int code;
@@ -33,6 +33,7 @@
 #include <sys/sendfile.h>
 #endif
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #define LINUX_FILE_NO_TEXT_OPTION 0
 #define O_TEXT                    LINUX_FILE_NO_TEXT_OPTION
@@ -510,6 +511,88 @@ int64_t taosPWriteFile(TdFilePtr pFile, const void *buf, int64_t count, int64_t
   return ret;
 }
 
+// a batch of entries is written as head and body pairs, so a whole batch fits in one writev up to IOV_MAX buffers
+#ifdef IOV_MAX
+#define TD_FILE_IOV_BATCH IOV_MAX
+#else
+#define TD_FILE_IOV_BATCH 1024
+#endif
+
+int64_t taosWritevFile(TdFilePtr pFile, const TdFileIoVec *iov, int32_t iovcnt) {
+  if (pFile == NULL) {
+    return 0;
+  }
+#if FILE_WITH_LOCK
+  taosThreadRwlockWrlock(&(pFile->rwlock));
+#endif
+  if (pFile->fd < 0) {
+#if FILE_WITH_LOCK
+    taosThreadRwlockUnlock(&(pFile->rwlock));
+#endif
+    return 0;
+  }
+
+  int64_t total = 0;
+#ifdef WINDOWS
+  for (int32_t i = 0; i < iovcnt; ++i) {
+    int64_t nleft = iov[i].len;
+    char   *tbuf = (char *)iov[i].buf;
+    while (nleft > 0) {
+      int64_t nwritten = _write(pFile->fd, tbuf, (uint32_t)nleft);
+      if (nwritten < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+#if FILE_WITH_LOCK
+        taosThreadRwlockUnlock(&(pFile->rwlock));
+#endif
+        return -1;
+      }
+      nleft -= nwritten;
+      tbuf += nwritten;
+    }
+    total += iov[i].len;
+  }
+#else
+  struct iovec vec[TD_FILE_IOV_BATCH];
+  int32_t      next = 0;   // first iov not yet handed to the kernel
+  int64_t      skip = 0;   // bytes of iov[next] already written
+
+  while (next < iovcnt) {
+    int32_t cnt = 0;
+    for (int32_t i = next; i < iovcnt && cnt < TD_FILE_IOV_BATCH; ++i, ++cnt) {
+      vec[cnt].iov_base = (char *)iov[i].buf + ((i == next) ? skip : 0);
+      vec[cnt].iov_len = iov[i].len - ((i == next) ? skip : 0);
+    }
+
+    int64_t nwritten = writev(pFile->fd, vec, cnt);
+    if (nwritten < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+#if FILE_WITH_LOCK
+      taosThreadRwlockUnlock(&(pFile->rwlock));
+#endif
+      return -1;
+    }
+    total += nwritten;
+
+    // advance over the fully written buffers, keep the offset into a partially written one
+    nwritten += skip;
+    while (next < iovcnt && nwritten >= iov[next].len) {
+      nwritten -= iov[next].len;
+      next += 1;
+    }
+    skip = nwritten;
+  }
+#endif
+
+#if FILE_WITH_LOCK
+  taosThreadRwlockUnlock(&(pFile->rwlock));
+#endif
+  return total;
+}
+
 int64_t taosLSeekFile(TdFilePtr pFile, int64_t offset, int32_t whence) {
   if (pFile == NULL || pFile->fd < 0) {
     return -1;
@@ -1,7 +1,9 @@
 #define _DEFAULT_SOURCE
 #include "tpagedbuf.h"
+#include "lz4.h"
 #include "taoserror.h"
-#include "tcompression.h"
+#include "tlockfree.h"
+#include "tsched.h"
 #include "tsimplehash.h"
 #include "tlog.h"
 
@@ -10,20 +12,36 @@
 #define CLEAR_BUF_PAGE_IN_MEM_FLAG(_p) ((_p)->pData = NULL)
 #define HAS_DATA_IN_DISK(_p)           ((_p)->offset >= 0)
 #define NO_IN_MEM_AVAILABLE_PAGES(_b)  (listNEles((_b)->lruList) >= (_b)->inMemPages)
+#define GET_PAGE_FULL_SIZE(_b)         ((_b)->pageSize + (int32_t)sizeof(SFilePage))
+
+#define DBUF_FLUSH_QUEUE_SIZE 1024
+#define DBUF_FLUSH_THREADS     4
+#define DBUF_MIN_PENDING_PAGES 2
+#define DBUF_READ_AHEAD_PAGES  16
 
 typedef struct SPageDiskInfo {
   int64_t offset;
   int32_t length;
 } SPageDiskInfo, SFreeListItem;
 
+// the encoded image of an evicted page, waiting to be written by the flusher thread
+typedef struct SPageFlushReq {
+  SDiskbasedBuf* pBuf;
+  SPageInfo*     pg;
+  int64_t        offset;
+  int32_t        length;
+  char           data[];
+} SPageFlushReq;
+
 struct SPageInfo {
-  SListNode* pn;  // point to list node struct. it is NULL when the page is evicted from the in-memory buffer
-  void*      pData;
-  int64_t    offset;
-  int32_t    pageId;
-  int32_t    length : 29;
-  bool       used : 1;   // set current page is in used
-  bool       dirty : 1;  // set current buffer page is dirty or not
+  SListNode*     pn;  // point to list node struct. it is NULL when the page is evicted from the in-memory buffer
+  void*          pData;
+  SPageFlushReq* pFlush;  // pending write of this page, protected by SDiskbasedBuf.mutex
+  int64_t        offset;
+  int32_t        pageId;
+  int32_t        length : 29;
+  bool           used : 1;   // set current page is in used
+  bool           dirty : 1;  // set current buffer page is dirty or not
 };
 
 struct SDiskbasedBuf {
@@ -43,9 +61,21 @@ struct SDiskbasedBuf {
   void*     emptyDummyIdList;  // dummy id list
   void*     assistBuf;         // assistant buffer for compress/decompress data
   SArray*   pFree;             // free area in file
-  bool      comp;              // compressed before flushed to disk
+  bool      comp;              // lz4 compressed before flushed to disk
   uint64_t  nextPos;           // next page flush position
 
+  TdThreadMutex mutex;         // protects the pending flush requests
+  TdThreadCond  cond;
+  int32_t       numOfPending;  // flush requests not written yet
+  int32_t       maxPending;
+  int32_t       flushCode;     // the first error of the flusher thread
+  int32_t       flusherId;     // all the pages of the buffer are written by the same flusher
+
+  char*   pReadAhead;  // read ahead buffer of sequentially loaded pages
+  int64_t raOffset;
+  int32_t raLength;
+  int32_t lastLoadId;
+
   char*               id;           // for debug purpose
   bool                printStatis;  // Print statistics info when closing this buffer.
   SDiskbasedBufStatis statis;
@@ -70,29 +100,44 @@ static int32_t createDiskFile(SDiskbasedBuf* pBuf) {
   return TSDB_CODE_SUCCESS;
 }
 
-static char* doCompressData(void* data, int32_t srcSize, int32_t* dst, SDiskbasedBuf* pBuf) {  // do nothing
-  if (!pBuf->comp) {
-    *dst = srcSize;
-    return data;
+static TdThreadOnce dBufFlusherInit = PTHREAD_ONCE_INIT;
+static SRWLatch     dBufFlusherLatch = 0;  // taken in read mode to schedule a write, in write mode to stop the flushers
+static void*        dBufFlushers[DBUF_FLUSH_THREADS] = {0};
+static bool         dBufFlusherStopped = false;
+static int32_t      dBufFlusherSeq = 0;
+
+// Each flusher is a one-thread queue shared by the paged buffers assigned to it, so that the writes to the same file
+// are applied in FIFO order while the spills of different buffers are written in parallel.
+static void doInitFlusher(void) {
+  taosWLockLatch(&dBufFlusherLatch);
+  for (int32_t i = 0; i < DBUF_FLUSH_THREADS && !dBufFlusherStopped; ++i) {
+    dBufFlushers[i] = taosInitScheduler(DBUF_FLUSH_QUEUE_SIZE, 1, "dbuf", NULL);
   }
+  taosWUnLockLatch(&dBufFlusherLatch);
+}
 
-  *dst = tsCompressString(data, srcSize, 1, pBuf->assistBuf, srcSize, ONE_STAGE_COMP, NULL, 0);
+static void doPostFlusherBarrier(SSchedMsg* pMsg) { tsem_post(pMsg->ahandle); }
 
-  memcpy(data, pBuf->assistBuf, *dst);
-  return data;
-}
+// A page is stored in lz4 format only if it is smaller than the raw page, so the on-disk length tells the format.
+static int32_t doCompressData(const char* pSrc, int32_t srcSize, char* pDst, SDiskbasedBuf* pBuf) {
+  int32_t len = 0;
+  if (pBuf->comp) {
+    len = LZ4_compress_default(pSrc, pDst, srcSize, srcSize - 1);
+  }
 
-static char* doDecompressData(void* data, int32_t srcSize, int32_t* dst, SDiskbasedBuf* pBuf) {  // do nothing
-  if (!pBuf->comp) {
-    *dst = srcSize;
-    return data;
+  if (len <= 0) {
+    memcpy(pDst, pSrc, srcSize);
+    len = srcSize;
   }
+  return len;
+}
 
-  *dst = tsDecompressString(data, srcSize, 1, pBuf->assistBuf, pBuf->pageSize, ONE_STAGE_COMP, NULL, 0);
-  if (*dst > 0) {
-    memcpy(data, pBuf->assistBuf, *dst);
+static int32_t doDecompressData(const char* pSrc, int32_t srcSize, char* pDst, int32_t dstSize) {
+  int32_t len = LZ4_decompress_safe(pSrc, pDst, srcSize, dstSize);
+  if (len != dstSize) {
+    return TSDB_CODE_FILE_CORRUPTED;
   }
-  return data;
+  return TSDB_CODE_SUCCESS;
 }
 
 static uint64_t allocateNewPositionInFile(SDiskbasedBuf* pBuf, size_t size) {
@@ -129,30 +174,93 @@ static uint64_t allocateNewPositionInFile(SDiskbasedBuf* pBuf, size_t size) {
 
 static FORCE_INLINE size_t getAllocPageSize(int32_t pageSize) { return pageSize + POINTER_BYTES + sizeof(SFilePage); }
 
-static int32_t doFlushBufPageImpl(SDiskbasedBuf* pBuf, int64_t offset, const char* pData, int32_t size) {
-  int32_t ret = taosLSeekFile(pBuf->pFile, offset, SEEK_SET);
-  if (ret == -1) {
-    terrno = TAOS_SYSTEM_ERROR(errno);
-    return terrno;
+static void doFlushBufPageImpl(SSchedMsg* pMsg) {
+  SPageFlushReq* pReq = pMsg->msg;
+  SDiskbasedBuf* pBuf = pReq->pBuf;
+  int32_t        code = TSDB_CODE_SUCCESS;
+
+  int64_t ret = taosPWriteFile(pBuf->pFile, pReq->data, pReq->length, pReq->offset);
+  if (ret != pReq->length) {
+    code = TAOS_SYSTEM_ERROR(errno);
+  }
+
+  taosThreadMutexLock(&pBuf->mutex);
+  if (code != TSDB_CODE_SUCCESS) {
+    uError("failed to flush buf page:%d to disk since %s, %s", pReq->pg->pageId, tstrerror(code), pBuf->id);
+    if (pBuf->flushCode == TSDB_CODE_SUCCESS) {
+      pBuf->flushCode = code;
+    }
+  } else {
+    pBuf->statis.flushBytes += pReq->length;
+    pBuf->statis.flushPages += 1;
+  }
+
+  if (pReq->pg->pFlush == pReq) {
+    pReq->pg->pFlush = NULL;
+  }
+  pBuf->numOfPending -= 1;
+  taosThreadCondBroadcast(&pBuf->cond);
+  taosThreadMutexUnlock(&pBuf->mutex);
+
+  taosMemoryFree(pReq);
+}
+
+static int32_t doScheduleFlush(SDiskbasedBuf* pBuf, SPageFlushReq* pReq) {
+  taosThreadMutexLock(&pBuf->mutex);
+  while (pBuf->numOfPending >= pBuf->maxPending && pBuf->flushCode == TSDB_CODE_SUCCESS) {
+    taosThreadCondWait(&pBuf->cond, &pBuf->mutex);
+  }
+
+  int32_t code = pBuf->flushCode;
+  if (code == TSDB_CODE_SUCCESS) {
+    pBuf->numOfPending += 1;
+    pReq->pg->pFlush = pReq;
+  }
+  taosThreadMutexUnlock(&pBuf->mutex);
+
+  if (code != TSDB_CODE_SUCCESS) {
+    taosMemoryFree(pReq);
+    return code;
   }
 
-  ret = (int32_t)taosWriteFile(pBuf->pFile, pData, size);
-  if (ret != size) {
-    terrno = TAOS_SYSTEM_ERROR(errno);
-    return terrno;
+  // the read ahead data is stale once the same range of file is written again
+  if (pBuf->raLength > 0 && pReq->offset < pBuf->raOffset + pBuf->raLength &&
+      pBuf->raOffset < pReq->offset + pReq->length) {
+    pBuf->raLength = 0;
   }
 
-  // extend the file
-  if (pBuf->fileSize < offset + size) {
-    pBuf->fileSize = offset + size;
+  taosThreadOnce(&dBufFlusherInit, doInitFlusher);
+
+  // the flusher can not be stopped while the request is being queued
+  SSchedMsg msg = {.fp = doFlushBufPageImpl, .msg = pReq};
+  int32_t   ret = -1;
+  taosRLockLatch(&dBufFlusherLatch);
+  if (dBufFlushers[pBuf->flusherId] != NULL) {
+    ret = taosScheduleTask(dBufFlushers[pBuf->flusherId], &msg);
   }
+  taosRUnLockLatch(&dBufFlusherLatch);
 
-  pBuf->statis.flushBytes += size;
-  pBuf->statis.flushPages += 1;
+  if (ret != 0) {
+    // flusher is not available, write it in current thread after the queued writes of this buffer
+    taosThreadMutexLock(&pBuf->mutex);
+    while (pBuf->numOfPending > 1) {
+      taosThreadCondWait(&pBuf->cond, &pBuf->mutex);
+    }
+    taosThreadMutexUnlock(&pBuf->mutex);
+    doFlushBufPageImpl(&msg);
+  }
 
   return TSDB_CODE_SUCCESS;
 }
 
+static void doWaitFlush(SDiskbasedBuf* pBuf) {
+  taosThreadMutexLock(&pBuf->mutex);
+  while (pBuf->numOfPending > 0) {
+    taosThreadCondWait(&pBuf->cond, &pBuf->mutex);
+  }
+  taosThreadMutexUnlock(&pBuf->mutex);
+}
+
 static char* doFlushBufPage(SDiskbasedBuf* pBuf, SPageInfo* pg) {
   if (pg->pData == NULL || pg->used) {
     uError("invalid params in paged buffer process when flushing buf to disk, %s", pBuf->id);
@@ -160,49 +268,50 @@ static char* doFlushBufPage(SDiskbasedBuf* pBuf, SPageInfo* pg) {
     return NULL;
   }
 
-  int32_t size = pBuf->pageSize;
+  int32_t size = pg->length;
   int64_t offset = pg->offset;
 
-  char* t = NULL;
-  if ((!HAS_DATA_IN_DISK(pg)) || pg->dirty) {
-    void* payload = GET_PAYLOAD_DATA(pg);
-    t = doCompressData(payload, pBuf->pageSize + sizeof(SFilePage), &size, pBuf);
-    if (size < 0) {
-      uError("failed to compress data when flushing data to disk, %s", pBuf->id);
-      terrno = TSDB_CODE_INVALID_PARA;
+  // The encoded page is handed over to the flusher, so the buffer can be reused at once.
+  // NOTE: the size is -1 for a clean page that has never been flushed to disk.
+  if (pg->dirty) {
+    int32_t        fullSize = GET_PAGE_FULL_SIZE(pBuf);
+    SPageFlushReq* pReq = taosMemoryMalloc(sizeof(SPageFlushReq) + fullSize);
+    if (pReq == NULL) {
+      terrno = TSDB_CODE_OUT_OF_MEMORY;
       return NULL;
     }
-  }
 
-  // this page is flushed to disk for the first time
-  if (pg->dirty) {
-    if (!HAS_DATA_IN_DISK(pg)) {
+    size = doCompressData(GET_PAYLOAD_DATA(pg), fullSize, pReq->data, pBuf);
+
+    if (!HAS_DATA_IN_DISK(pg)) {  // this page is flushed to disk for the first time
       offset = allocateNewPositionInFile(pBuf, size);
       pBuf->nextPos += size;
-
-      int32_t code = doFlushBufPageImpl(pBuf, offset, t, size);
-      if (code != TSDB_CODE_SUCCESS) {
-        return NULL;
-      }
-    } else {
+    } else if (pg->length < size) {
       // length becomes greater, current space is not enough, allocate new place, otherwise, do nothing
-      if (pg->length < size) {
-        // 1. add current space to free list
-        SPageDiskInfo dinfo = {.length = pg->length, .offset = offset};
-        taosArrayPush(pBuf->pFree, &dinfo);
-
-        // 2. allocate new position, and update the info
-        offset = allocateNewPositionInFile(pBuf, size);
-        pBuf->nextPos += size;
-      }
+      // 1. add current space to free list
+      SPageDiskInfo dinfo = {.length = pg->length, .offset = offset};
+      taosArrayPush(pBuf->pFree, &dinfo);
 
-      int32_t code = doFlushBufPageImpl(pBuf, offset, t, size);
-      if (code != TSDB_CODE_SUCCESS) {
-        return NULL;
-      }
+      // 2. allocate new position, and update the info
+      offset = allocateNewPositionInFile(pBuf, size);
+      pBuf->nextPos += size;
+    }
+
+    // extend the file
+    if (pBuf->fileSize < offset + size) {
+      pBuf->fileSize = offset + size;
+    }
+
+    pReq->pBuf = pBuf;
+    pReq->pg = pg;
+    pReq->offset = offset;
+    pReq->length = size;
+
+    int32_t code = doScheduleFlush(pBuf, pReq);
+    if (code != TSDB_CODE_SUCCESS) {
+      terrno = code;
+      return NULL;
     }
-  } else {  // NOTE: the size may be -1, the this recycle page has not been flushed to disk yet.
-    size = pg->length;
   }
 
   char* pDataBuf = pg->pData;
@@ -234,6 +343,42 @@ static char* flushBufPage(SDiskbasedBuf* pBuf, SPageInfo* pg) {
   return p;
 }
 
+// Read the page together with the following pages that are stored right after it in file, when the pages are
+// accessed by page id sequentially. No flush should be in progress, otherwise the pages on disk may be stale.
+static int32_t doReadAhead(SDiskbasedBuf* pBuf, SPageInfo* pg) {
+  int64_t end = pg->offset + pg->length;
+
+  for (int32_t id = pg->pageId + 1; id <= pg->pageId + DBUF_READ_AHEAD_PAGES; ++id) {
+    SPageInfo** ppi = tSimpleHashGet(pBuf->all, &id, sizeof(int32_t));
+    if (ppi == NULL || *ppi == NULL || BUF_PAGE_IN_MEM(*ppi) || (*ppi)->pFlush != NULL || (*ppi)->offset != end ||
+        (*ppi)->length <= 0) {
+      break;
+    }
+    end += (*ppi)->length;
+  }
+
+  if (end == pg->offset + pg->length) {
+    return TSDB_CODE_SUCCESS;
+  }
+
+  if (pBuf->pReadAhead == NULL) {
+    pBuf->pReadAhead = taosMemoryMalloc((int64_t)GET_PAGE_FULL_SIZE(pBuf) * (DBUF_READ_AHEAD_PAGES + 1));
+    if (pBuf->pReadAhead == NULL) {
+      return TSDB_CODE_OUT_OF_MEMORY;
+    }
+  }
+
+  int64_t ret = taosPReadFile(pBuf->pFile, pBuf->pReadAhead, end - pg->offset, pg->offset);
+  if (ret != end - pg->offset) {
+    pBuf->raLength = 0;
+    return TAOS_SYSTEM_ERROR(errno);
+  }
+
+  pBuf->raOffset = pg->offset;
+  pBuf->raLength = (int32_t)(end - pg->offset);
+  return TSDB_CODE_SUCCESS;
+}
+
 // load file block data in disk
 static int32_t loadPageFromDisk(SDiskbasedBuf* pBuf, SPageInfo* pg) {
   if (pg->offset < 0 || pg->length <= 0) {
@@ -241,25 +386,64 @@ static int32_t loadPageFromDisk(SDiskbasedBuf* pBuf, SPageInfo* pg) {
     return TSDB_CODE_INVALID_PARA;
   }
 
-  int32_t ret = taosLSeekFile(pBuf->pFile, pg->offset, SEEK_SET);
-  if (ret == -1) {
-    ret = TAOS_SYSTEM_ERROR(errno);
-    return ret;
+  int32_t fullSize = GET_PAGE_FULL_SIZE(pBuf);
+  char*   pPage = GET_PAYLOAD_DATA(pg);
+  char*   pDst = pPage;
+  if (pg->length < fullSize) {  // lz4 compressed page
+    if (pBuf->assistBuf == NULL && (pBuf->assistBuf = taosMemoryMalloc(fullSize)) == NULL) {
+      return TSDB_CODE_OUT_OF_MEMORY;
+    }
+    pDst = pBuf->assistBuf;
+  }
+
+  // the page may still be in the flush queue
+  taosThreadMutexLock(&pBuf->mutex);
+  int32_t code = pBuf->flushCode;
+  bool    loaded = false;
+  bool    noPending = (pBuf->numOfPending == 0);
+  if (code == TSDB_CODE_SUCCESS && pg->pFlush != NULL) {
+    memcpy(pDst, pg->pFlush->data, pg->length);
+    loaded = true;
+  }
+  taosThreadMutexUnlock(&pBuf->mutex);
+
+  if (code != TSDB_CODE_SUCCESS) {
+    return code;
   }
 
-  void* pPage = (void*)GET_PAYLOAD_DATA(pg);
-  ret = (int32_t)taosReadFile(pBuf->pFile, pPage, pg->length);
-  if (ret != pg->length) {
-    ret = TAOS_SYSTEM_ERROR(errno);
-    return ret;
+  if (!loaded) {
+    bool hit = (pBuf->raLength > 0 && pg->offset >= pBuf->raOffset &&
+                pg->offset + pg->length <= pBuf->raOffset + pBuf->raLength);
+    if (!hit && noPending && pg->pageId == pBuf->lastLoadId + 1) {
+      code = doReadAhead(pBuf, pg);
+      if (code != TSDB_CODE_SUCCESS) {
+        return code;
+      }
+      hit = (pBuf->raLength > 0 && pg->offset == pBuf->raOffset);
+    }
+
+    if (hit) {
+      memcpy(pDst, pBuf->pReadAhead + (pg->offset - pBuf->raOffset), pg->length);
+    } else {
+      int64_t ret = taosPReadFile(pBuf->pFile, pDst, pg->length, pg->offset);
+      if (ret != pg->length) {
+        return TAOS_SYSTEM_ERROR(errno);
+      }
+    }
+
+    pBuf->statis.loadBytes += pg->length;
+    pBuf->statis.loadPages += 1;
   }
 
-  pBuf->statis.loadBytes += pg->length;
-  pBuf->statis.loadPages += 1;
+  pBuf->lastLoadId = pg->pageId;
 
-  int32_t fullSize = 0;
-  doDecompressData(pPage, pg->length, &fullSize, pBuf);
-  return 0;
+  if (pDst != pPage) {
+    code = doDecompressData(pDst, pg->length, pPage, fullSize);
+    if (code != TSDB_CODE_SUCCESS) {
+      uError("failed to decompress buf page:%d, length:%d, %s", pg->pageId, pg->length, pBuf->id);
+    }
+  }
+  return code;
 }
 
 static SPageInfo* registerNewPageInfo(SDiskbasedBuf* pBuf, int32_t pageId) {
@@ -273,6 +457,7 @@ static SPageInfo* registerNewPageInfo(SDiskbasedBuf* pBuf, int32_t pageId) {
 
   ppi->pageId = pageId;
   ppi->pData = NULL;
+  ppi->pFlush = NULL;
   ppi->offset = -1;
   ppi->length = -1;
   ppi->used = true;
@@ -338,7 +523,7 @@ static SPageInfo* getPageInfoFromPayload(void* page) {
 }
 
 int32_t createDiskbasedBuf(SDiskbasedBuf** pBuf, int32_t pagesize, int32_t inMemBufSize, const char* id,
-                           const char* dir) {
+                           const char* dir, bool comp) {
   *pBuf = taosMemoryCalloc(1, sizeof(SDiskbasedBuf));
 
   SDiskbasedBuf* pPBuf = *pBuf;
@@ -346,6 +531,9 @@ int32_t createDiskbasedBuf(SDiskbasedBuf** pBuf, int32_t pagesize, int32_t inMem
     goto _error;
   }
 
+  taosThreadMutexInit(&pPBuf->mutex, NULL);
+  taosThreadCondInit(&pPBuf->cond, NULL);
+
   pPBuf->pageSize = pagesize;
   pPBuf->numOfPages = 0;  // all pages are in buffer in the first place
   pPBuf->totalBufSize = 0;
@@ -355,6 +543,9 @@ int32_t createDiskbasedBuf(SDiskbasedBuf** pBuf, int32_t pagesize, int32_t inMem
   pPBuf->fileSize = 0;
   pPBuf->pFree = taosArrayInit(4, sizeof(SFreeListItem));
   pPBuf->freePgList = tdListNew(POINTER_BYTES);
+  pPBuf->comp = comp;
+  pPBuf->lastLoadId = -1;
+  pPBuf->flusherId = (atomic_fetch_add_32(&dBufFlusherSeq, 1) & INT32_MAX) % DBUF_FLUSH_THREADS;
 
   // at least more than 2 pages must be in memory
   if (inMemBufSize < pagesize * 2) {
@@ -362,6 +553,7 @@ int32_t createDiskbasedBuf(SDiskbasedBuf** pBuf, int32_t pagesize, int32_t inMem
   }
 
   pPBuf->inMemPages = inMemBufSize / pagesize;  // maximum allowed pages, it is a soft limit.
+  pPBuf->maxPending = TMAX(pPBuf->inMemPages / 4, DBUF_MIN_PENDING_PAGES);
   pPBuf->lruList = tdListNew(POINTER_BYTES);
   if (pPBuf->lruList == NULL) {
     goto _error;
@@ -562,6 +754,36 @@ size_t getTotalBufSize(const SDiskbasedBuf* pBuf) { return (size_t)pBuf->totalBu
 
 SArray* getDataBufPagesIdList(SDiskbasedBuf* pBuf) { return pBuf->pIdList; }
 
+void cleanupDiskbasedBufFlusher() {
+  void* pFlushers[DBUF_FLUSH_THREADS] = {0};
+
+  // no request is being queued once the latch is held, the requests scheduled from now on are written by the
+  // evicting thread
+  taosWLockLatch(&dBufFlusherLatch);
+  dBufFlusherStopped = true;
+  memcpy(pFlushers, dBufFlushers, sizeof(pFlushers));
+  memset(dBufFlushers, 0, sizeof(dBufFlushers));
+  taosWUnLockLatch(&dBufFlusherLatch);
+
+  for (int32_t i = 0; i < DBUF_FLUSH_THREADS; ++i) {
+    if (pFlushers[i] == NULL) {
+      continue;
+    }
+
+    // the flusher thread exits without running the queued requests, so wait for them before stopping it
+    tsem_t    sem;
+    SSchedMsg msg = {.fp = doPostFlusherBarrier, .ahandle = &sem};
+    tsem_init(&sem, 0, 0);
+    if (taosScheduleTask(pFlushers[i], &msg) == 0) {
+      tsem_wait(&sem);
+    }
+    tsem_destroy(&sem);
+
+    taosCleanUpScheduler(pFlushers[i]);
+    taosMemoryFree(pFlushers[i]);
+  }
+}
+
 void destroyDiskbasedBuf(SDiskbasedBuf* pBuf) {
   if (pBuf == NULL) {
     return;
@@ -571,6 +793,8 @@ void destroyDiskbasedBuf(SDiskbasedBuf* pBuf) {
 
   bool needRemoveFile = false;
   if (pBuf->pFile != NULL) {
+    doWaitFlush(pBuf);
+
     needRemoveFile = true;
     uDebug(
         "Paged buffer closed, total:%.2f Kb (%d Pages), inmem size:%.2f Kb (%d Pages), file size:%.2f Kb, page "
@@ -625,6 +849,9 @@ void destroyDiskbasedBuf(SDiskbasedBuf* pBuf) {
 
   taosMemoryFreeClear(pBuf->id);
   taosMemoryFreeClear(pBuf->assistBuf);
+  taosMemoryFreeClear(pBuf->pReadAhead);
+  taosThreadCondDestroy(&pBuf->cond);
+  taosThreadMutexDestroy(&pBuf->mutex);
   taosMemoryFreeClear(pBuf);
 }
 
@@ -647,12 +874,7 @@ void setBufPageDirty(void* pPage, bool dirty) {
   ppi->dirty = dirty;
 }
 
-void setBufPageCompressOnDisk(SDiskbasedBuf* pBuf, bool comp) {
-  pBuf->comp = comp;
-  if (comp  && (pBuf->assistBuf == NULL)) {
-    pBuf->assistBuf = taosMemoryMalloc(pBuf->pageSize + 2);  // EXTRA BYTES
-  }
-}
+void setBufPageCompressOnDisk(SDiskbasedBuf* pBuf, bool comp) { pBuf->comp = comp; }
 
 void dBufSetBufPageRecycled(SDiskbasedBuf* pBuf, void* pPage) {
   SPageInfo* ppi = getPageInfoFromPayload(pPage);
@@ -700,6 +922,8 @@ void dBufPrintStatis(const SDiskbasedBuf* pBuf) {
 }
 
 void clearDiskbasedBuf(SDiskbasedBuf* pBuf) {
+  doWaitFlush(pBuf);
+
   size_t n = taosArrayGetSize(pBuf->pIdList);
   for (int32_t i = 0; i < n; ++i) {
     SPageInfo* pi = taosArrayGetP(pBuf->pIdList, i);
@@ -721,4 +945,6 @@ void clearDiskbasedBuf(SDiskbasedBuf* pBuf) {
   pBuf->totalBufSize = 0;
   pBuf->allocateId = -1;
   pBuf->fileSize = 0;
+  pBuf->raLength = 0;
+  pBuf->lastLoadId = -1;
 }
@@ -12,12 +12,20 @@
  * You should have received a copy of the GNU Affero General Public License
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
-
 #define _DEFAULT_SOURCE
 #include "tqueue.h"
 #include "taoserror.h"
 #include "tlog.h"
 
+#define QSET_MIN_SPIN_COUNT 64
+#define QSET_MAX_SPIN_COUNT 8192
+
+#if !defined(WINDOWS) && (defined(__x86_64__) || defined(__i386__))
+#define QSET_CPU_RELAX() __builtin_ia32_pause()
+#else
+#define QSET_CPU_RELAX()
+#endif
+
 int64_t tsRpcQueueMemoryAllowed = 0;
 int64_t tsRpcQueueMemoryUsed = 0;
 
@@ -46,14 +54,44 @@ void taosSetQueueFp(STaosQueue *queue, FItem itemFp, FItems itemsFp) {
   queue->itemsFp = itemsFp;
 }
 
+// move the items pushed by the writers to the tail of the reader list, must be called with queue->mutex locked
+static void taosQueueTakePending(STaosQueue *queue) {
+  if (atomic_load_ptr(&queue->pending) == NULL) return;
+
+  STaosQnode *pNode = atomic_exchange_ptr(&queue->pending, NULL);
+  STaosQnode *pLast = pNode;
+  STaosQnode *pFirst = NULL;
+
+  // the writers push items into a stack, reverse it to keep the order of writing
+  while (pNode) {
+    STaosQnode *pNext = pNode->next;
+    pNode->next = pFirst;
+    pFirst = pNode;
+    pNode = pNext;
+  }
+
+  if (queue->tail) {
+    queue->tail->next = pFirst;
+  } else {
+    queue->head = pFirst;
+  }
+  queue->tail = pLast;
+}
+
+static bool taosQueueHasItems(STaosQueue *queue) {
+  return queue->head != NULL || atomic_load_ptr(&queue->pending) != NULL;
+}
+
 void taosCloseQueue(STaosQueue *queue) {
   if (queue == NULL) return;
   STaosQnode *pTemp;
   STaosQset  *qset;
 
   taosThreadMutexLock(&queue->mutex);
+  taosQueueTakePending(queue);
   STaosQnode *pNode = queue->head;
   queue->head = NULL;
+  queue->tail = NULL;
   qset = queue->qset;
   taosThreadMutexUnlock(&queue->mutex);
 
@@ -78,7 +116,7 @@ bool taosQueueEmpty(STaosQueue *queue) {
 
   bool empty = false;
   taosThreadMutexLock(&queue->mutex);
-  if (queue->head == NULL && queue->tail == NULL && queue->numOfItems == 0 /*&& queue->memOfItems == 0*/) {
+  if (!taosQueueHasItems(queue) && atomic_load_32(&queue->numOfItems) == 0 /*&& queue->memOfItems == 0*/) {
     empty = true;
   }
   taosThreadMutexUnlock(&queue->mutex);
@@ -88,29 +126,18 @@ bool taosQueueEmpty(STaosQueue *queue) {
 
 void taosUpdateItemSize(STaosQueue *queue, int32_t items) {
   if (queue == NULL) return;
-
-  taosThreadMutexLock(&queue->mutex);
-  queue->numOfItems -= items;
-  taosThreadMutexUnlock(&queue->mutex);
+  atomic_sub_fetch_32(&queue->numOfItems, items);
 }
 
 int32_t taosQueueItemSize(STaosQueue *queue) {
   if (queue == NULL) return 0;
 
-  taosThreadMutexLock(&queue->mutex);
-  int32_t numOfItems = queue->numOfItems;
-  taosThreadMutexUnlock(&queue->mutex);
-
-  uTrace("queue:%p, numOfItems:%d memOfItems:%" PRId64, queue, queue->numOfItems, queue->memOfItems);
+  int32_t numOfItems = atomic_load_32(&queue->numOfItems);
+  uTrace("queue:%p, numOfItems:%d memOfItems:%" PRId64, queue, numOfItems, atomic_load_64(&queue->memOfItems));
   return numOfItems;
 }
 
-int64_t taosQueueMemorySize(STaosQueue *queue) {
-  taosThreadMutexLock(&queue->mutex);
-  int64_t memOfItems = queue->memOfItems;
-  taosThreadMutexUnlock(&queue->mutex);
-  return memOfItems;
-}
+int64_t taosQueueMemorySize(STaosQueue *queue) { return atomic_load_64(&queue->memOfItems); }
 
 void *taosAllocateQitem(int32_t size, EQItype itype, int64_t dataSize) {
   STaosQnode *pNode = taosMemoryCalloc(1, sizeof(STaosQnode) + size);
@@ -156,43 +183,60 @@ void taosFreeQitem(void *pItem) {
   taosMemoryFree(pNode);
 }
 
+// wake up one reader sleeping on the qset, if there is any
+static void taosQsetWakeup(STaosQset *qset) {
+  int32_t waiters = atomic_load_32(&qset->numOfWaiters);
+  while (waiters > 0) {
+    int32_t old = atomic_val_compare_exchange_32(&qset->numOfWaiters, waiters, waiters - 1);
+    if (old == waiters) {
+      tsem_post(&qset->sem);
+      return;
+    }
+    waiters = old;
+  }
+}
+
 int32_t taosWriteQitem(STaosQueue *queue, void *pItem) {
   int32_t     code = 0;
   STaosQnode *pNode = (STaosQnode *)(((char *)pItem) - sizeof(STaosQnode));
-  pNode->next = NULL;
+  int64_t     size = pNode->size + pNode->dataSize;
 
-  taosThreadMutexLock(&queue->mutex);
-  if (queue->memLimit > 0 && (queue->memOfItems + pNode->size + pNode->dataSize) > queue->memLimit) {
+  // reserve the quota before the item is visible, so that concurrent writers never exceed the limits
+  int64_t memOfItems = atomic_add_fetch_64(&queue->memOfItems, size);
+  if (queue->memLimit > 0 && memOfItems > queue->memLimit) {
+    atomic_sub_fetch_64(&queue->memOfItems, size);
     code = TSDB_CODE_UTIL_QUEUE_OUT_OF_MEMORY;
     uError("item:%p failed to put into queue:%p, queue mem limit: %" PRId64 ", reason: %s" PRId64, pItem, queue,
            queue->memLimit, tstrerror(code));
-
-    taosThreadMutexUnlock(&queue->mutex);
     return code;
-  } else if (queue->itemLimit > 0 && queue->numOfItems + 1 > queue->itemLimit) {
+  }
+
+  int32_t numOfItems = atomic_add_fetch_32(&queue->numOfItems, 1);
+  if (queue->itemLimit > 0 && numOfItems > queue->itemLimit) {
+    atomic_sub_fetch_32(&queue->numOfItems, 1);
+    atomic_sub_fetch_64(&queue->memOfItems, size);
     code = TSDB_CODE_UTIL_QUEUE_OUT_OF_MEMORY;
     uError("item:%p failed to put into queue:%p, queue size limit: %" PRId64 ", reason: %s" PRId64, pItem, queue,
            queue->itemLimit, tstrerror(code));
-    taosThreadMutexUnlock(&queue->mutex);
     return code;
   }
 
-  if (queue->tail) {
-    queue->tail->next = pNode;
-    queue->tail = pNode;
-  } else {
-    queue->head = pNode;
-    queue->tail = pNode;
+  STaosQnode *pHead = atomic_load_ptr(&queue->pending);
+  while (1) {
+    pNode->next = pHead;
+    STaosQnode *pOld = atomic_val_compare_exchange_ptr(&queue->pending, pHead, pNode);
+    if (pOld == pHead) break;
+    pHead = pOld;
   }
-  queue->numOfItems++;
-  queue->memOfItems += (pNode->size + pNode->dataSize);
-  if (queue->qset) atomic_add_fetch_32(&queue->qset->numOfItems, 1);
 
-  uTrace("item:%p is put into queue:%p, items:%d mem:%" PRId64, pItem, queue, queue->numOfItems, queue->memOfItems);
+  uTrace("item:%p is put into queue:%p, items:%d mem:%" PRId64, pItem, queue, numOfItems, memOfItems);
 
-  taosThreadMutexUnlock(&queue->mutex);
+  STaosQset *qset = atomic_load_ptr(&queue->qset);
+  if (qset) {
+    atomic_add_fetch_32(&qset->numOfItems, 1);
+    taosQsetWakeup(qset);
+  }
 
-  if (queue->qset) tsem_post(&queue->qset->sem);
   return code;
 }
 
@@ -202,17 +246,17 @@ int32_t taosReadQitem(STaosQueue *queue, void **ppItem) {
 
   taosThreadMutexLock(&queue->mutex);
 
+  if (queue->head == NULL) taosQueueTakePending(queue);
   if (queue->head) {
     pNode = queue->head;
     *ppItem = pNode->item;
     queue->head = pNode->next;
     if (queue->head == NULL) queue->tail = NULL;
-    queue->numOfItems--;
-    queue->memOfItems -= (pNode->size + pNode->dataSize);
+    int32_t numOfItems = atomic_sub_fetch_32(&queue->numOfItems, 1);
+    int64_t memOfItems = atomic_sub_fetch_64(&queue->memOfItems, pNode->size + pNode->dataSize);
     if (queue->qset) atomic_sub_fetch_32(&queue->qset->numOfItems, 1);
     code = 1;
-    uTrace("item:%p is read out from queue:%p, items:%d mem:%" PRId64, *ppItem, queue, queue->numOfItems,
-           queue->memOfItems);
+    uTrace("item:%p is read out from queue:%p, items:%d mem:%" PRId64, *ppItem, queue, numOfItems, memOfItems);
   }
 
   taosThreadMutexUnlock(&queue->mutex);
@@ -230,37 +274,44 @@ STaosQall *taosAllocateQall() {
 
 void taosFreeQall(STaosQall *qall) { taosMemoryFree(qall); }
 
+// detach all the items of the queue into qall, must be called with queue->mutex locked
+static int32_t taosQueueTakeAll(STaosQueue *queue, STaosQall *qall, int64_t *memOfItems) {
+  taosQueueTakePending(queue);
+
+  int32_t numOfItems = 0;
+  *memOfItems = 0;
+  for (STaosQnode *pNode = queue->head; pNode != NULL; pNode = pNode->next) {
+    numOfItems++;
+    *memOfItems += pNode->size + pNode->dataSize;
+  }
+
+  qall->current = queue->head;
+  qall->start = queue->head;
+  qall->numOfItems = numOfItems;
+
+  queue->head = NULL;
+  queue->tail = NULL;
+  return numOfItems;
+}
+
 int32_t taosReadAllQitems(STaosQueue *queue, STaosQall *qall) {
   int32_t numOfItems = 0;
-  bool    empty;
+  int64_t memOfItems = 0;
 
   taosThreadMutexLock(&queue->mutex);
 
-  empty = queue->head == NULL;
-  if (!empty) {
-    memset(qall, 0, sizeof(STaosQall));
-    qall->current = queue->head;
-    qall->start = queue->head;
-    qall->numOfItems = queue->numOfItems;
-    numOfItems = qall->numOfItems;
-
-    queue->head = NULL;
-    queue->tail = NULL;
-    queue->numOfItems = 0;
-    queue->memOfItems = 0;
-    uTrace("read %d items from queue:%p, items:%d mem:%" PRId64, numOfItems, queue, queue->numOfItems,
-           queue->memOfItems);
-    if (queue->qset) atomic_sub_fetch_32(&queue->qset->numOfItems, qall->numOfItems);
+  // if source queue is empty, the destination qall is set to empty too.
+  memset(qall, 0, sizeof(STaosQall));
+  if (taosQueueHasItems(queue)) {
+    numOfItems = taosQueueTakeAll(queue, qall, &memOfItems);
+
+    int32_t leftItems = atomic_sub_fetch_32(&queue->numOfItems, numOfItems);
+    int64_t leftMem = atomic_sub_fetch_64(&queue->memOfItems, memOfItems);
+    uTrace("read %d items from queue:%p, items:%d mem:%" PRId64, numOfItems, queue, leftItems, leftMem);
+    if (queue->qset) atomic_sub_fetch_32(&queue->qset->numOfItems, numOfItems);
   }
 
   taosThreadMutexUnlock(&queue->mutex);
-
-  // if source queue is empty, we set destination qall to empty too.
-  if (empty) {
-    qall->current = NULL;
-    qall->start = NULL;
-    qall->numOfItems = 0;
-  }
   return numOfItems;
 }
 
@@ -291,6 +342,7 @@ STaosQset *taosOpenQset() {
 
   taosThreadMutexInit(&qset->mutex, NULL);
   tsem_init(&qset->sem, 0, 0);
+  qset->spinCount = QSET_MIN_SPIN_COUNT;
 
   uDebug("qset:%p is opened", qset);
   return qset;
@@ -305,7 +357,7 @@ void taosCloseQset(STaosQset *qset) {
     STaosQueue *queue = qset->head;
     qset->head = qset->head->next;
 
-    queue->qset = NULL;
+    atomic_store_ptr(&queue->qset, NULL);
     queue->next = NULL;
   }
   taosThreadMutexUnlock(&qset->mutex);
@@ -316,12 +368,12 @@ void taosCloseQset(STaosQset *qset) {
   uDebug("qset:%p is closed", qset);
 }
 
-// tsem_post 'qset->sem', so that reader threads waiting for it
-// resumes execution and return, should only be used to signal the
-// thread to exit.
+// ask one reader thread of the qset to return, should only be used to signal the thread to exit. A sleeping reader
+// is woken up by the same handshake as the writers, so its waiter registration is taken over here.
 void taosQsetThreadResume(STaosQset *qset) {
   uDebug("qset:%p, it will exit", qset);
-  tsem_post(&qset->sem);
+  atomic_add_fetch_32(&qset->numOfResumes, 1);
+  taosQsetWakeup(qset);
 }
 
 int32_t taosAddIntoQset(STaosQset *qset, STaosQueue *queue, void *ahandle) {
@@ -335,8 +387,8 @@ int32_t taosAddIntoQset(STaosQset *qset, STaosQueue *queue, void *ahandle) {
   qset->numOfQueues++;
 
   taosThreadMutexLock(&queue->mutex);
-  atomic_add_fetch_32(&qset->numOfItems, queue->numOfItems);
-  queue->qset = qset;
+  atomic_add_fetch_32(&qset->numOfItems, atomic_load_32(&queue->numOfItems));
+  atomic_store_ptr(&queue->qset, qset);
   taosThreadMutexUnlock(&queue->mutex);
 
   taosThreadMutexUnlock(&qset->mutex);
@@ -373,8 +425,8 @@ void taosRemoveFromQset(STaosQset *qset, STaosQueue *queue) {
       qset->numOfQueues--;
 
       taosThreadMutexLock(&queue->mutex);
-      atomic_sub_fetch_32(&qset->numOfItems, queue->numOfItems);
-      queue->qset = NULL;
+      atomic_sub_fetch_32(&qset->numOfItems, atomic_load_32(&queue->numOfItems));
+      atomic_store_ptr(&queue->qset, NULL);
       queue->next = NULL;
       taosThreadMutexUnlock(&queue->mutex);
     }
@@ -385,11 +437,79 @@ void taosRemoveFromQset(STaosQset *qset, STaosQueue *queue) {
   uDebug("queue:%p is removed from qset:%p", queue, qset);
 }
 
-int32_t taosReadQitemFromQset(STaosQset *qset, void **ppItem, SQueueInfo *qinfo) {
-  STaosQnode *pNode = NULL;
-  int32_t     code = 0;
+static bool taosQsetClaimResume(STaosQset *qset) {
+  int32_t resumes = atomic_load_32(&qset->numOfResumes);
+  while (resumes > 0) {
+    int32_t old = atomic_val_compare_exchange_32(&qset->numOfResumes, resumes, resumes - 1);
+    if (old == resumes) return true;
+    resumes = old;
+  }
+  return false;
+}
 
+// the reader registered as a waiter but will not sleep, undo the registration
+static void taosQsetCancelWait(STaosQset *qset) {
+  int32_t waiters = atomic_load_32(&qset->numOfWaiters);
+  while (waiters > 0) {
+    int32_t old = atomic_val_compare_exchange_32(&qset->numOfWaiters, waiters, waiters - 1);
+    if (old == waiters) return;
+    waiters = old;
+  }
+
+  // a writer has claimed the registration and posts the semaphore, consume it
   tsem_wait(&qset->sem);
+}
+
+typedef int32_t (*FQsetRead)(STaosQset *qset, void *param, SQueueInfo *qinfo);
+
+/*
+ * Read from the qset by readFp, and block until something is read out or the reader is asked to exit. The reader
+ * spins on the item counter of the qset before it sleeps. The spin count grows when the spinning pays off and
+ * shrinks when the reader has to sleep anyway.
+ */
+static int32_t taosReadFromQset(STaosQset *qset, FQsetRead readFp, void *param, SQueueInfo *qinfo) {
+  int32_t code = 0;
+
+  while (1) {
+    if (taosQsetClaimResume(qset)) return 0;
+
+    code = (*readFp)(qset, param, qinfo);
+    if (code != 0) return code;
+
+    int32_t spinCount = atomic_load_32(&qset->spinCount);
+    for (int32_t i = 0; i < spinCount && atomic_load_32(&qset->numOfItems) <= 0; ++i) {
+      QSET_CPU_RELAX();
+    }
+
+    code = (*readFp)(qset, param, qinfo);
+    if (code != 0) {
+      if (spinCount < QSET_MAX_SPIN_COUNT) atomic_store_32(&qset->spinCount, spinCount * 2);
+      return code;
+    }
+
+    if (spinCount > QSET_MIN_SPIN_COUNT) atomic_store_32(&qset->spinCount, spinCount / 2);
+
+    // check again after the registration, a writer either sees the waiter or its item is read out here
+    atomic_add_fetch_32(&qset->numOfWaiters, 1);
+    if (atomic_load_32(&qset->numOfResumes) > 0) {
+      taosQsetCancelWait(qset);
+      continue;
+    }
+
+    code = (*readFp)(qset, param, qinfo);
+    if (code != 0) {
+      taosQsetCancelWait(qset);
+      return code;
+    }
+
+    tsem_wait(&qset->sem);
+  }
+}
+
+static int32_t taosTryReadQitemFromQset(STaosQset *qset, void *param, SQueueInfo *qinfo) {
+  void      **ppItem = param;
+  STaosQnode *pNode = NULL;
+  int32_t     code = 0;
 
   taosThreadMutexLock(&qset->mutex);
 
@@ -398,10 +518,11 @@ int32_t taosReadQitemFromQset(STaosQset *qset, void **ppItem, SQueueInfo *qinfo)
     STaosQueue *queue = qset->current;
     if (queue) qset->current = queue->next;
     if (queue == NULL) break;
-    if (queue->head == NULL) continue;
+    if (!taosQueueHasItems(queue)) continue;
 
     taosThreadMutexLock(&queue->mutex);
 
+    if (queue->head == NULL) taosQueueTakePending(queue);
     if (queue->head) {
       pNode = queue->head;
       *ppItem = pNode->item;
@@ -413,11 +534,11 @@ int32_t taosReadQitemFromQset(STaosQset *qset, void **ppItem, SQueueInfo *qinfo)
       queue->head = pNode->next;
       if (queue->head == NULL) queue->tail = NULL;
       // queue->numOfItems--;
-      queue->memOfItems -= (pNode->size + pNode->dataSize);
+      int64_t memOfItems = atomic_sub_fetch_64(&queue->memOfItems, pNode->size + pNode->dataSize);
       atomic_sub_fetch_32(&qset->numOfItems, 1);
       code = 1;
-      uTrace("item:%p is read out from queue:%p, items:%d mem:%" PRId64, *ppItem, queue, queue->numOfItems - 1,
-             queue->memOfItems);
+      uTrace("item:%p is read out from queue:%p, items:%d mem:%" PRId64, *ppItem, queue,
+             atomic_load_32(&queue->numOfItems) - 1, memOfItems);
     }
 
     taosThreadMutexUnlock(&queue->mutex);
@@ -429,11 +550,15 @@ int32_t taosReadQitemFromQset(STaosQset *qset, void **ppItem, SQueueInfo *qinfo)
   return code;
 }
 
-int32_t taosReadAllQitemsFromQset(STaosQset *qset, STaosQall *qall, SQueueInfo *qinfo) {
+int32_t taosReadQitemFromQset(STaosQset *qset, void **ppItem, SQueueInfo *qinfo) {
+  return taosReadFromQset(qset, taosTryReadQitemFromQset, ppItem, qinfo);
+}
+
+static int32_t taosTryReadAllQitemsFromQset(STaosQset *qset, void *param, SQueueInfo *qinfo) {
+  STaosQall  *qall = param;
   STaosQueue *queue;
   int32_t     code = 0;
 
-  tsem_wait(&qset->sem);
   taosThreadMutexLock(&qset->mutex);
 
   for (int32_t i = 0; i < qset->numOfQueues; ++i) {
@@ -441,29 +566,22 @@ int32_t taosReadAllQitemsFromQset(STaosQset *qset, STaosQall *qall, SQueueInfo *
     queue = qset->current;
     if (queue) qset->current = queue->next;
     if (queue == NULL) break;
-    if (queue->head == NULL) continue;
+    if (!taosQueueHasItems(queue)) continue;
 
     taosThreadMutexLock(&queue->mutex);
 
-    if (queue->head) {
-      qall->current = queue->head;
-      qall->start = queue->head;
-      qall->numOfItems = queue->numOfItems;
-      code = qall->numOfItems;
+    int64_t memOfItems = 0;
+    code = taosQueueTakeAll(queue, qall, &memOfItems);
+    if (code > 0) {
       qinfo->ahandle = queue->ahandle;
       qinfo->fp = queue->itemsFp;
       qinfo->queue = queue;
 
-      queue->head = NULL;
-      queue->tail = NULL;
       // queue->numOfItems = 0;
-      queue->memOfItems = 0;
-      uTrace("read %d items from queue:%p, items:0 mem:%" PRId64, code, queue, queue->memOfItems);
+      int64_t leftMem = atomic_sub_fetch_64(&queue->memOfItems, memOfItems);
+      uTrace("read %d items from queue:%p, items:0 mem:%" PRId64, code, queue, leftMem);
 
       atomic_sub_fetch_32(&qset->numOfItems, qall->numOfItems);
-      for (int32_t j = 1; j < qall->numOfItems; ++j) {
-        tsem_wait(&qset->sem);
-      }
     }
 
     taosThreadMutexUnlock(&queue->mutex);
@@ -475,6 +593,10 @@ int32_t taosReadAllQitemsFromQset(STaosQset *qset, STaosQall *qall, SQueueInfo *
   return code;
 }
 
+int32_t taosReadAllQitemsFromQset(STaosQset *qset, STaosQall *qall, SQueueInfo *qinfo) {
+  return taosReadFromQset(qset, taosTryReadAllQitemsFromQset, qall, qinfo);
+}
+
 int32_t taosQallItemSize(STaosQall *qall) { return qall->numOfItems; }
 void    taosResetQitems(STaosQall *qall) { qall->current = qall->start; }
 int32_t taosGetQueueNumber(STaosQset *qset) { return qset->numOfQueues; }
@@ -13,7 +13,7 @@ namespace {
 // simple test
 void simpleTest() {
   SDiskbasedBuf* pBuf = NULL;
-  int32_t        ret = createDiskbasedBuf(&pBuf, 1024, 4096, "", TD_TMP_DIR_PATH);
+  int32_t        ret = createDiskbasedBuf(&pBuf, 1024, 4096, "", TD_TMP_DIR_PATH, true);
 
   int32_t pageId = 0;
   int32_t groupId = 0;
@@ -57,7 +57,7 @@ void simpleTest() {
 
 void writeDownTest() {
   SDiskbasedBuf* pBuf = NULL;
-  int32_t        ret = createDiskbasedBuf(&pBuf, 1024, 4 * 1024, "1", TD_TMP_DIR_PATH);
+  int32_t        ret = createDiskbasedBuf(&pBuf, 1024, 4 * 1024, "1", TD_TMP_DIR_PATH, true);
 
   int32_t pageId = 0;
   int32_t writePageId = 0;
@@ -106,7 +106,7 @@ void writeDownTest() {
 
 void recyclePageTest() {
   SDiskbasedBuf* pBuf = NULL;
-  int32_t        ret = createDiskbasedBuf(&pBuf, 1024, 4 * 1024, "1", TD_TMP_DIR_PATH);
+  int32_t        ret = createDiskbasedBuf(&pBuf, 1024, 4 * 1024, "1", TD_TMP_DIR_PATH, true);
 
   int32_t pageId = 0;
   int32_t writePageId = 0;
@@ -185,7 +185,7 @@ bool checkBufVarData(SFilePage* pPg, const char* varData, uint32_t varLen) {
 void testFlushAndReadBackBuffer() {
   SDiskbasedBuf* pBuf = NULL;
   uint32_t       totalLen = 4096;
-  auto           code = createDiskbasedBuf(&pBuf, totalLen, totalLen * 2, "1", TD_TMP_DIR_PATH);
+  auto           code = createDiskbasedBuf(&pBuf, totalLen, totalLen * 2, "1", TD_TMP_DIR_PATH, true);
   int32_t        pageId = -1;
   auto*          pPg = (SFilePage*)getNewBufPage(pBuf, &pageId);
   ASSERT_TRUE(pPg != nullptr);
@@ -219,6 +219,48 @@ void testFlushAndReadBackBuffer() {
   destroyDiskbasedBuf(pBuf);
 }
 
+// spill many pages through a small in-memory buffer, and load them back both in sequence and in reverse order
+void testSpillAndLoadBack(bool comp) {
+  SDiskbasedBuf* pBuf = NULL;
+  int32_t        pageSize = 1024;
+  int32_t        numOfPages = 64;
+  auto           code = createDiskbasedBuf(&pBuf, pageSize, pageSize * 4, "1", TD_TMP_DIR_PATH, comp);
+  ASSERT_EQ(code, 0);
+
+  for (int32_t i = 0; i < numOfPages; ++i) {
+    int32_t pageId = -1;
+    auto*   pPg = (SFilePage*)getNewBufPage(pBuf, &pageId);
+    ASSERT_TRUE(pPg != nullptr);
+    ASSERT_EQ(pageId, i);
+
+    pPg->num = i;
+    for (int32_t j = 0; j < pageSize / sizeof(int32_t) - 1; ++j) {
+      ((int32_t*)pPg->data)[j] = i * 7 + (j % 16);
+    }
+    setBufPageDirty(pPg, true);
+    releaseBufPage(pBuf, pPg);
+  }
+  ASSERT_FALSE(isAllDataInMemBuf(pBuf));
+
+  for (int32_t k = 0; k < 2; ++k) {
+    for (int32_t n = 0; n < numOfPages; ++n) {
+      int32_t i = (k == 0) ? n : numOfPages - n - 1;
+      auto*   pPg = (SFilePage*)getBufPage(pBuf, i);
+      ASSERT_TRUE(pPg != nullptr);
+      ASSERT_EQ(pPg->num, i);
+      for (int32_t j = 0; j < pageSize / sizeof(int32_t) - 1; ++j) {
+        ASSERT_EQ(((int32_t*)pPg->data)[j], i * 7 + (j % 16));
+      }
+      releaseBufPage(pBuf, pPg);
+    }
+  }
+
+  SDiskbasedBufStatis statis = getDBufStatis(pBuf);
+  ASSERT_GT(statis.loadPages, 0);
+
+  destroyDiskbasedBuf(pBuf);
+}
+
 }  // namespace
 
 TEST(testCase, resultBufferTest) {
@@ -229,4 +271,18 @@ TEST(testCase, resultBufferTest) {
   testFlushAndReadBackBuffer();
 }
 
+TEST(testCase, spillBufferTest) {
+  testSpillAndLoadBack(true);
+  testSpillAndLoadBack(false);
+}
+
+// once the shared flusher is stopped, the evicted pages are written by the query thread
+TEST(testCase, spillBufferAfterFlusherCleanupTest) {
+  testSpillAndLoadBack(true);
+  cleanupDiskbasedBufFlusher();
+  cleanupDiskbasedBufFlusher();
+  testSpillAndLoadBack(true);
+  testSpillAndLoadBack(false);
+}
+
 #pragma GCC diagnostic pop
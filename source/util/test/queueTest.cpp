@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "taoserror.h"
+#include "tqueue.h"
+
+namespace {
+
+typedef struct {
+  int32_t producer;
+  int32_t seq;
+} SQueueTestItem;
+
+const int32_t numOfProducers = 4;
+const int32_t numOfItemsPerProducer = 100000;
+
+void writeItems(STaosQueue *queue, int32_t producer) {
+  for (int32_t i = 0; i < numOfItemsPerProducer; ++i) {
+    SQueueTestItem *pItem = (SQueueTestItem *)taosAllocateQitem(sizeof(SQueueTestItem), DEF_QITEM, 0);
+    ASSERT_NE(pItem, nullptr);
+    pItem->producer = producer;
+    pItem->seq = i;
+    ASSERT_EQ(taosWriteQitem(queue, pItem), 0);
+  }
+}
+
+}  // namespace
+
+TEST(queueTest, readAllQitems) {
+  STaosQueue *queue = taosOpenQueue();
+  STaosQall  *qall = taosAllocateQall();
+
+  std::vector<std::thread> producers;
+  for (int32_t p = 0; p < numOfProducers; ++p) {
+    producers.emplace_back(writeItems, queue, p);
+  }
+
+  std::vector<int32_t> next(numOfProducers, 0);
+  int32_t              total = 0;
+  while (total < numOfProducers * numOfItemsPerProducer) {
+    int32_t num = taosReadAllQitems(queue, qall);
+    for (int32_t i = 0; i < num; ++i) {
+      SQueueTestItem *pItem = NULL;
+      ASSERT_EQ(taosGetQitem(qall, (void **)&pItem), 1);
+      // the items of each writer are read out in the order of writing
+      ASSERT_EQ(pItem->seq, next[pItem->producer]);
+      next[pItem->producer]++;
+      taosFreeQitem(pItem);
+    }
+    total += num;
+  }
+
+  for (auto &t : producers) t.join();
+
+  EXPECT_TRUE(taosQueueEmpty(queue));
+  EXPECT_EQ(taosQueueItemSize(queue), 0);
+  EXPECT_EQ(taosQueueMemorySize(queue), 0);
+
+  taosFreeQall(qall);
+  taosCloseQueue(queue);
+}
+
+TEST(queueTest, itemLimit) {
+  STaosQueue *queue = taosOpenQueue();
+  taosSetQueueCapacity(queue, 10);
+
+  for (int32_t i = 0; i < 10; ++i) {
+    void *pItem = taosAllocateQitem(sizeof(SQueueTestItem), DEF_QITEM, 0);
+    ASSERT_EQ(taosWriteQitem(queue, pItem), 0);
+  }
+
+  void *pItem = taosAllocateQitem(sizeof(SQueueTestItem), DEF_QITEM, 0);
+  EXPECT_EQ(taosWriteQitem(queue, pItem), TSDB_CODE_UTIL_QUEUE_OUT_OF_MEMORY);
+  EXPECT_EQ(taosQueueItemSize(queue), 10);
+
+  void *pRead = NULL;
+  ASSERT_EQ(taosReadQitem(queue, &pRead), 1);
+  taosFreeQitem(pRead);
+  EXPECT_EQ(taosWriteQitem(queue, pItem), 0);
+
+  taosCloseQueue(queue);
+}
+
+TEST(queueTest, readFromQset) {
+  STaosQset  *qset = taosOpenQset();
+  STaosQueue *queue1 = taosOpenQueue();
+  STaosQueue *queue2 = taosOpenQueue();
+  taosAddIntoQset(qset, queue1, NULL);
+  taosAddIntoQset(qset, queue2, NULL);
+
+  const int32_t        numOfReaders = 2;
+  std::atomic<int32_t> total(0);
+  std::vector<std::thread> readers;
+  for (int32_t r = 0; r < numOfReaders; ++r) {
+    readers.emplace_back([&]() {
+      SQueueInfo qinfo = {0};
+      void      *pItem = NULL;
+      while (taosReadQitemFromQset(qset, &pItem, &qinfo) != 0) {
+        taosFreeQitem(pItem);
+        taosUpdateItemSize((STaosQueue *)qinfo.queue, 1);
+        total++;
+      }
+    });
+  }
+
+  std::vector<std::thread> producers;
+  for (int32_t p = 0; p < numOfProducers; ++p) {
+    producers.emplace_back(writeItems, (p % 2) ? queue1 : queue2, p);
+  }
+  for (auto &t : producers) t.join();
+
+  while (total.load() < numOfProducers * numOfItemsPerProducer) {
+    taosMsleep(1);
+  }
+
+  // the readers exit once they are resumed
+  for (int32_t r = 0; r < numOfReaders; ++r) {
+    taosQsetThreadResume(qset);
+  }
+  for (auto &t : readers) t.join();
+
+  EXPECT_EQ(total.load(), numOfProducers * numOfItemsPerProducer);
+  EXPECT_TRUE(taosQueueEmpty(queue1));
+  EXPECT_TRUE(taosQueueEmpty(queue2));
+  EXPECT_EQ(qset->numOfWaiters, 0);
+  EXPECT_EQ(qset->numOfResumes, 0);
+
+  taosCloseQueue(queue1);
+  taosCloseQueue(queue2);
+  taosCloseQset(qset);
+}
+
+TEST(queueTest, resumeSleepingReader) {
+  STaosQset  *qset = taosOpenQset();
+  STaosQueue *queue = taosOpenQueue();
+  taosAddIntoQset(qset, queue, NULL);
+
+  const int32_t        numOfReaders = 2;
+  std::atomic<int32_t> total(0);
+  std::atomic<int32_t> exited(0);
+  std::vector<std::thread> readers;
+  for (int32_t r = 0; r < numOfReaders; ++r) {
+    readers.emplace_back([&]() {
+      SQueueInfo qinfo = {0};
+      void      *pItem = NULL;
+      while (taosReadQitemFromQset(qset, &pItem, &qinfo) != 0) {
+        taosFreeQitem(pItem);
+        taosUpdateItemSize((STaosQueue *)qinfo.queue, 1);
+        total++;
+      }
+      exited++;
+    });
+  }
+
+  while (atomic_load_32(&qset->numOfWaiters) < numOfReaders) {
+    taosMsleep(1);
+  }
+
+  // the resumed reader takes its registration along, the other one still sleeps and is woken up by the writer
+  taosQsetThreadResume(qset);
+  while (exited.load() < 1) {
+    taosMsleep(1);
+  }
+  EXPECT_EQ(atomic_load_32(&qset->numOfWaiters), numOfReaders - 1);
+
+  writeItems(queue, 0);
+  while (total.load() < numOfItemsPerProducer) {
+    taosMsleep(1);
+  }
+
+  taosQsetThreadResume(qset);
+  for (auto &t : readers) t.join();
+
+  EXPECT_EQ(exited.load(), numOfReaders);
+  EXPECT_EQ(qset->numOfWaiters, 0);
+  EXPECT_EQ(qset->numOfResumes, 0);
+
+  taosCloseQueue(queue);
+  taosCloseQset(qset);
+}
@@ -50,7 +50,8 @@ info_schema_tables = [
     "ins_streams",
     "ins_streams_tasks",
     "ins_vnodes",
-    "ins_user_privileges"
+    "ins_user_privileges",
+    "ins_disks"
 ]
 
 perf_schema_tables = [